@@ -91,6 +91,7 @@ CPUGeneratorImpl::CPUGeneratorImpl(uint64_t seed_in)
 void CPUGeneratorImpl::set_current_seed(uint64_t seed) {
   next_float_normal_sample_.reset();
   next_double_normal_sample_.reset();
+  philox_offset_per_thread_ = 0;
   engine_ = mt19937(seed);
 }
 
@@ -211,6 +212,10 @@ void CPUGeneratorImpl::set_state(const c10::TensorImpl& new_state) {
   this->engine_ = engine;
   this->next_float_normal_sample_ = float_normal_sample;
   this->next_double_normal_sample_ = double_normal_sample;
+  // The philox offset is not part of the serialized POD state (the layouts
+  // above are frozen for checkpoint compatibility), so restoring a state
+  // starts the counter reservation from scratch.
+  this->philox_offset_per_thread_ = 0;
 }
 
 /**
@@ -313,6 +318,45 @@ void CPUGeneratorImpl::set_next_double_normal_sample(c10::optional<double> randn
   next_double_normal_sample_ = randn;
 }
 
+/**
+ * Sets the philox_offset_per_thread_ to be used by philox_engine_inputs
+ *
+ * See Note [Acquire lock when using random generators]
+ */
+void CPUGeneratorImpl::set_philox_offset_per_thread(uint64_t offset) {
+  // see Note [Why enforce RNG offset % 4 == 0?] in CUDAGeneratorImpl.cpp
+  TORCH_CHECK(offset % 4 == 0, "offset must be a multiple of 4");
+  philox_offset_per_thread_ = offset;
+}
+
+/**
+ * Gets the current philox_offset_per_thread_ of CPUGeneratorImpl.
+ */
+uint64_t CPUGeneratorImpl::philox_offset_per_thread() const {
+  return philox_offset_per_thread_;
+}
+
+/**
+ * Reserves a range of the Philox counter for a consumer that draws at most
+ * `increment` 128-bit blocks per thread, and returns the seed together with
+ * the start of the reserved range. Mirrors
+ * CUDAGeneratorImpl::philox_engine_inputs.
+ *
+ * The reservation itself is a single wait-free fetch_add, so concurrent
+ * callers obtain disjoint counter ranges without serializing on the
+ * generator mutex. The mutex is still required to order reservations
+ * against seeding and state set/get; note that the mt19937-backed methods
+ * (random, random64, the normal sample cache) are unaffected by this
+ * counter and keep their usual locking discipline.
+ */
+std::pair<uint64_t, uint64_t> CPUGeneratorImpl::philox_engine_inputs(uint64_t increment) {
+  // rounds increment up to the nearest multiple of 4
+  increment = ((increment + 3) / 4) * 4;
+  uint64_t offset = philox_offset_per_thread_.fetch_add(increment, std::memory_order_relaxed);
+  TORCH_INTERNAL_ASSERT(offset % 4 == 0);
+  return std::make_pair(this->current_seed(), offset);
+}
+
 /**
  * Get the engine of the CPUGeneratorImpl
  */
@@ -348,6 +392,7 @@ CPUGeneratorImpl* CPUGeneratorImpl::clone_impl() const {
   gen->set_engine(engine_);
   gen->set_next_float_normal_sample(next_float_normal_sample_);
   gen->set_next_double_normal_sample(next_double_normal_sample_);
+  gen->set_philox_offset_per_thread(philox_offset_per_thread_);
   return gen;
 }
 
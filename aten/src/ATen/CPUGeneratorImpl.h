@@ -4,6 +4,7 @@
 #include <ATen/core/MT19937RNGEngine.h>
 #include <c10/core/GeneratorImpl.h>
 #include <c10/util/Optional.h>
+#include <atomic>
 
 namespace at {
 
@@ -30,12 +31,21 @@ struct TORCH_API CPUGeneratorImpl : public c10::GeneratorImpl {
   void set_next_double_normal_sample(c10::optional<double> randn);
   at::mt19937 engine();
   void set_engine(at::mt19937 engine);
+  void set_philox_offset_per_thread(uint64_t offset);
+  uint64_t philox_offset_per_thread() const;
+  std::pair<uint64_t, uint64_t> philox_engine_inputs(uint64_t increment);
 
  private:
   CPUGeneratorImpl* clone_impl() const override;
   at::mt19937 engine_;
   c10::optional<float> next_float_normal_sample_;
   c10::optional<double> next_double_normal_sample_;
+  // Counter reservation for Philox-based consumers, mirroring
+  // CUDAGeneratorImpl. Atomic so philox_engine_inputs is a single wait-free
+  // fetch_add that hands out disjoint counter ranges without the generator
+  // mutex. The mt19937 engine above is unrelated and still requires the lock
+  // (see Note [Acquire lock when using random generators]).
+  std::atomic<uint64_t> philox_offset_per_thread_{0};
 };
 
 namespace detail {
@@ -175,6 +175,14 @@ void Context::setBenchmarkLimitCuDNN(int b) {
   benchmark_limit_cudnn = b;
 }
 
+bool Context::pinnedKernelSelections() const {
+  return pinned_kernel_selections;
+}
+
+void Context::setPinnedKernelSelections(bool b) {
+  pinned_kernel_selections = b;
+}
+
 bool Context::allowTF32CuBLAS() const {
   return float32_matmul_precision != at::Float32MatmulPrecision::HIGHEST;
 }
@@ -250,6 +258,14 @@ void Context::setAllowBF16ReductionCuBLAS(bool b) {
   allow_bf16_reduction_cublas = b;
 }
 
+bool Context::allowBF16ReductionCPU() const {
+  return allow_bf16_reduction_cpu;
+}
+
+void Context::setAllowBF16ReductionCPU(bool b) {
+  allow_bf16_reduction_cpu = b;
+}
+
 
 bool Context::hasMKL() {
 #if AT_MKL_ENABLED()
@@ -2,6 +2,7 @@
 
 #include <ATen/CPUGeneratorImpl.h>
 #include <ATen/LinalgBackend.h>
+#include <ATen/PreForkInit.h>
 #include <ATen/core/ATenGeneral.h>
 #include <ATen/core/DeprecatedTypeProperties.h>
 #include <ATen/core/Generator.h>
@@ -89,6 +90,9 @@ class TORCH_API Context {
   static bool hasCuSOLVER() {
     return detail::getCUDAHooks().hasCuSOLVER();
   }
+  static bool hasCuSPARSELt() {
+    return detail::getCUDAHooks().hasCuSPARSELt();
+  }
   static bool hasHIP() {
     return detail::getHIPHooks().hasHIP();
   }
@@ -113,10 +117,16 @@ class TORCH_API Context {
   // defined in header so that getNonVariableType has ability to inline
   // call_once check. getNonVariableType is called fairly frequently
   void lazyInitCUDA() {
-    c10::call_once(thc_init, [&] { detail::getCUDAHooks().initCUDA(); });
+    c10::call_once(thc_init, [&] {
+      detail::timeLazyInit(
+          "at::Context::lazyInitCUDA", [] { detail::getCUDAHooks().initCUDA(); });
+    });
   }
   void lazyInitHIP() {
-    c10::call_once(thh_init, [&] { detail::getHIPHooks().initHIP(); });
+    c10::call_once(thh_init, [&] {
+      detail::timeLazyInit(
+          "at::Context::lazyInitHIP", [] { detail::getHIPHooks().initHIP(); });
+    });
   }
   static const at::cuda::NVRTC& getNVRTC() {
     return detail::getCUDAHooks().nvrtc();
@@ -139,6 +149,22 @@ class TORCH_API Context {
   bool deterministicCuDNN() const;
   void setDeterministicCuDNN(bool);
 
+  // Note [Pinned kernel selections]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // When enabled, runtime-benchmarked algorithm choices that are already
+  // cached (currently the cuDNN convolution benchmark caches) are frozen:
+  // a cached choice is never re-benchmarked or overwritten, even when it
+  // hits an out-of-memory condition - the caller retries it after freeing
+  // cached allocator blocks and, failing that, runs the default algorithm
+  // once without caching it, so the pinned choice resumes when memory
+  // pressure subsides. Shapes that have never been seen still get a
+  // one-time selection. Intended for latency-sensitive inference: enable
+  // after a warmup pass that has exercised every shape, so algorithm
+  // choices stop shifting when allocator pressure changes benchmark
+  // outcomes mid-run.
+  bool pinnedKernelSelections() const;
+  void setPinnedKernelSelections(bool);
+
   // Note [Disabling Fused SDP Kernels]
   // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Flash and Memory Efficient SDP kernels are enabled by default.
@@ -254,6 +280,14 @@ class TORCH_API Context {
   void setAllowFP16ReductionCuBLAS(bool);
   bool allowBF16ReductionCuBLAS() const;
   void setAllowBF16ReductionCuBLAS(bool);
+  // CPU analog of allowBF16ReductionCuBLAS: when enabled, the fallback
+  // CPU GEMM kernels accumulate BFloat16 inputs in BFloat16 instead of
+  // upconverting to Float. Off by default; opting in trades accuracy
+  // for less accumulator traffic on throughput-bound workloads. BLAS
+  // and oneDNN GEMMs are unaffected (they manage their own accumulation
+  // precision).
+  bool allowBF16ReductionCPU() const;
+  void setAllowBF16ReductionCPU(bool);
   at::QEngine qEngine() const;
   void setQEngine(at::QEngine e);
   static const std::vector<at::QEngine>& supportedQEngines();
@@ -303,9 +337,11 @@ class TORCH_API Context {
       ? at::Float32MatmulPrecision::HIGH
       : at::Float32MatmulPrecision::HIGHEST;
   int benchmark_limit_cudnn = 10;
+  bool pinned_kernel_selections = false;
   bool allow_tf32_cudnn = true;
   bool allow_fp16_reduction_cublas = true;
   bool allow_bf16_reduction_cublas = true;
+  bool allow_bf16_reduction_cpu = false;
   bool enabled_mkldnn = true;
   at::LinalgBackend linalg_preferred_backend = at::LinalgBackend::Default;
 #ifdef C10_MOBILE
@@ -423,6 +459,10 @@ static inline bool hasMAGMA() {
   return globalContext().hasMAGMA();
 }
 
+static inline bool hasCuSPARSELt() {
+  return globalContext().hasCuSPARSELt();
+}
+
 static inline bool hasMKLDNN() {
   return globalContext().hasMKLDNN();
 }
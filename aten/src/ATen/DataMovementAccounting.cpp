@@ -0,0 +1,41 @@
+#include <ATen/DataMovementAccounting.h>
+
+namespace at {
+
+namespace {
+// Innermost active guard on this thread, or nullptr.
+thread_local DataMovementAccountingGuard* current_accounting_guard = nullptr;
+} // namespace
+
+DataMovementAccountingGuard::DataMovementAccountingGuard()
+    : parent_(current_accounting_guard) {
+  current_accounting_guard = this;
+}
+
+DataMovementAccountingGuard::~DataMovementAccountingGuard() {
+  current_accounting_guard = parent_;
+  if (parent_ != nullptr) {
+    // Fold our totals into the enclosing guard so outer scopes account for
+    // everything that ran inside them.
+    parent_->stats_.operator_calls += stats_.operator_calls;
+    parent_->stats_.bytes_read += stats_.bytes_read;
+    parent_->stats_.bytes_written += stats_.bytes_written;
+  }
+}
+
+bool DataMovementAccountingGuard::enabled() {
+  return current_accounting_guard != nullptr;
+}
+
+void DataMovementAccountingGuard::record(
+    uint64_t bytes_read,
+    uint64_t bytes_written) {
+  auto* guard = current_accounting_guard;
+  if (guard != nullptr) {
+    guard->stats_.operator_calls++;
+    guard->stats_.bytes_read += bytes_read;
+    guard->stats_.bytes_written += bytes_written;
+  }
+}
+
+} // namespace at
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <cstdint>
+
+namespace at {
+
+// Logical data-movement totals accumulated while a
+// DataMovementAccountingGuard is active; see below.
+struct DataMovementStats {
+  // Number of TensorIterator-based operator executions observed.
+  uint64_t operator_calls = 0;
+  // Logical bytes read from / written to operand tensors. "Logical" means
+  // numel * element_size per operand as declared by the iterator, so a
+  // broadcast input counts every logical read even though the backing
+  // storage is smaller. Read-write outputs contribute to both totals.
+  uint64_t bytes_read = 0;
+  uint64_t bytes_written = 0;
+};
+
+// RAII guard that accumulates logical data-movement volume for all
+// TensorIterator-based operators executed on the calling thread while it is
+// in scope. Intended for per-request roofline accounting: wrap one
+// inference request in a guard and read stats() afterwards.
+//
+// Guards nest; an inner guard's totals are folded into the enclosing guard
+// when the inner guard is destroyed, so an outer guard always sees the full
+// volume of its scope. Accounting is thread-local: work an operator hands
+// off to other threads (intra-op parallelism counts on the launching
+// thread, but explicitly spawned threads do not) is not attributed to this
+// guard. When no guard is active the bookkeeping cost is a single
+// thread-local pointer check per operator.
+class TORCH_API DataMovementAccountingGuard {
+ public:
+  DataMovementAccountingGuard();
+  ~DataMovementAccountingGuard();
+  DataMovementAccountingGuard(const DataMovementAccountingGuard&) = delete;
+  DataMovementAccountingGuard& operator=(const DataMovementAccountingGuard&) =
+      delete;
+
+  const DataMovementStats& stats() const {
+    return stats_;
+  }
+
+  // Whether any guard is active on the calling thread.
+  static bool enabled();
+
+  // Credits one operator call moving the given logical volumes to the
+  // innermost guard on the calling thread; no-op when none is active.
+  static void record(uint64_t bytes_read, uint64_t bytes_written);
+
+ private:
+  DataMovementStats stats_;
+  DataMovementAccountingGuard* parent_;
+};
+
+} // namespace at
@@ -242,6 +242,67 @@ inline void deprecated_AT_DISPATCH_ALL_TYPES_AND_HALF_AND_COMPLEX() {}
     }                                                                       \
   }()
 
+// Variant of AT_DISPATCH_SWITCH that routes both unmatched dtypes and dtypes
+// excluded by selective build (see should_include_kernel_dtype above) to a
+// caller-supplied FALLBACK lambda instead of throwing. This is the hook for
+// size-constrained builds that instantiate a kernel for a dtype allowlist
+// only: the op can fall back by converting its inputs to a dtype that was
+// kept (typically float), re-running, and converting the result back.
+//
+//      AT_DISPATCH_SWITCH_WITH_FALLBACK(self.scalar_type(), "op_name",
+//          [&] { return op_impl(self.to(at::kFloat)).to(self.scalar_type()); },
+//          AT_DISPATCH_CASE_WITH_FALLBACK(at::ScalarType::Float, [&] {
+//            return op_impl<scalar_t>(self);
+//          })
+//      );
+//
+// Cases inside this switch must use AT_DISPATCH_CASE_WITH_FALLBACK (or
+// AT_PRIVATE_CASE_TYPE_WITH_FALLBACK_USING_HINT): the regular case macros
+// compile the unselected-dtype path to a throw and would bypass FALLBACK.
+// The FALLBACK lambda must return the same type as the case lambdas.
+
+#if defined __cpp_if_constexpr
+#define AT_PRIVATE_CASE_TYPE_WITH_FALLBACK_USING_HINT(enum_type, HINT, ...) \
+  case enum_type: {                                                         \
+    if constexpr (at::should_include_kernel_dtype(                          \
+                      at_dispatch_name, enum_type)) {                       \
+      using HINT C10_UNUSED = c10::impl::ScalarTypeToCPPTypeT<enum_type>;   \
+      return __VA_ARGS__();                                                 \
+    } else {                                                                \
+      return at_dispatch_fallback();                                        \
+    }                                                                       \
+  }
+#else // defined __cpp_if_constexpr
+// Without if constexpr the kernel body is always instantiated (matching the
+// plain case macros on such compilers); the branch still folds to a constant.
+#define AT_PRIVATE_CASE_TYPE_WITH_FALLBACK_USING_HINT(enum_type, HINT, ...) \
+  case enum_type: {                                                         \
+    if (!at::should_include_kernel_dtype(at_dispatch_name, enum_type)) {    \
+      return at_dispatch_fallback();                                        \
+    }                                                                       \
+    using HINT C10_UNUSED = c10::impl::ScalarTypeToCPPTypeT<enum_type>;     \
+    return __VA_ARGS__();                                                   \
+  }
+#endif
+
+#define AT_DISPATCH_CASE_WITH_FALLBACK(enum_type, ...) \
+  AT_PRIVATE_CASE_TYPE_WITH_FALLBACK_USING_HINT(enum_type, scalar_t, __VA_ARGS__)
+
+#define AT_DISPATCH_SWITCH_WITH_FALLBACK(TYPE, NAME, FALLBACK, ...)         \
+  [&] {                                                                     \
+    const auto& the_type = TYPE;                                            \
+    constexpr const char* at_dispatch_name = NAME;                          \
+    /* don't use TYPE again in case it is an expensive or side-effect op */ \
+    at::ScalarType _st = ::detail::scalar_type(the_type);                   \
+    RECORD_KERNEL_FUNCTION_DTYPE(at_dispatch_name, _st);                    \
+    auto at_dispatch_fallback = FALLBACK;                                   \
+    switch (_st) {                                                          \
+      __VA_ARGS__                                                           \
+      default:                                                              \
+        return at_dispatch_fallback();                                      \
+    }                                                                       \
+  }()
+
 #define AT_DISPATCH_CASE_FLOATING_TYPES(...)            \
   AT_DISPATCH_CASE(at::ScalarType::Double, __VA_ARGS__) \
   AT_DISPATCH_CASE(at::ScalarType::Float, __VA_ARGS__)
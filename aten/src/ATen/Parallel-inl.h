@@ -3,6 +3,10 @@
 #include <c10/util/Exception.h>
 #include <c10/util/SmallVector.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
 namespace at {
 
 template <class F>
@@ -80,4 +84,50 @@ inline scalar_t parallel_reduce(
 #endif
 }
 
+template <class F>
+inline void parallel_for_calibrated(
+    const char* tag,
+    const int64_t begin,
+    const int64_t end,
+    const int64_t default_grain,
+    const F& f) {
+  if (begin >= end) {
+    return;
+  }
+  if (!internal::grain_calibration_enabled()) {
+    parallel_for(begin, end, default_grain, f);
+    return;
+  }
+
+  // One cached grain per call site: the function type is unique to the
+  // lambda passed in, so each call site gets its own instantiation.
+  static std::atomic<int64_t> cached_grain{0};
+  int64_t grain = cached_grain.load(std::memory_order_relaxed);
+  int64_t pos = begin;
+  if (C10_UNLIKELY(grain == 0)) {
+    grain = internal::lookup_pinned_grain(tag);
+    if (grain == 0) {
+      // Time a small serial slice of the real work; the slice runs exactly
+      // once, keeping non-idempotent functions correct.
+      const int64_t probe_end =
+          std::min(end, begin + internal::GRAIN_CALIBRATION_PROBE);
+      const auto probe_start = std::chrono::steady_clock::now();
+      {
+        internal::ThreadIdGuard tid_guard(0);
+        f(begin, probe_end);
+      }
+      const auto probe_ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - probe_start)
+              .count();
+      grain = internal::record_probed_grain(tag, probe_end - begin, probe_ns);
+      pos = probe_end;
+    }
+    cached_grain.store(grain, std::memory_order_relaxed);
+  }
+  if (pos < end) {
+    parallel_for(pos, end, grain, f);
+  }
+}
+
 } // namespace at
@@ -1,9 +1,16 @@
 #pragma once
 #include <ATen/Config.h>
 #include <c10/macros/Macros.h>
+#include <cstdint>
 #include <functional>
 #include <string>
 
+namespace c10 {
+// Defined in c10/core/thread_pool.h; forward-declared to keep this widely
+// included header light.
+enum class TaskPriority : uint8_t;
+} // namespace c10
+
 namespace at {
 
 inline int64_t divup(int64_t x, int64_t y) {
@@ -26,6 +33,26 @@ TORCH_API int get_thread_num();
 // Checks whether the code runs in parallel region
 TORCH_API bool in_parallel_region();
 
+// How parallel_for assigns chunks of the [begin, end) range to worker
+// threads.
+enum class ParallelStrategy : uint8_t {
+  // The range is split into one equal chunk per thread.  This is the
+  // default and has the lowest scheduling overhead.
+  STATIC = 0,
+  // The range is split into many chunks of roughly grain_size elements
+  // which idle workers claim dynamically.  This trades a small amount of
+  // scheduling overhead for better load balance when the per-element cost
+  // is skewed (e.g. ragged EmbeddingBag rows).  Only honored by the native
+  // parallel backend; other backends fall back to STATIC.
+  WORK_STEALING,
+};
+
+// Sets the chunk scheduling strategy used by subsequent parallel_for calls
+TORCH_API void set_parallel_strategy(ParallelStrategy strategy);
+
+// Returns the current chunk scheduling strategy
+TORCH_API ParallelStrategy get_parallel_strategy();
+
 namespace internal {
 
 // Initialise num_threads lazily at first parallel call
@@ -53,6 +80,26 @@ class TORCH_API ThreadIdGuard {
   int old_id_;
 };
 
+// Number of elements timed by the first invocation of a calibrated
+// parallel_for call site (see parallel_for_calibrated below)
+constexpr int64_t GRAIN_CALIBRATION_PROBE = 4096;
+
+// Whether grain-size calibration was requested via TORCH_GRAIN_CALIBRATION=1;
+// checked once per process
+TORCH_API bool grain_calibration_enabled();
+
+// Returns the grain size pinned for `tag` via
+// TORCH_GRAIN_TABLE="tag=grain,tag=grain,...", or 0 if the tag is not pinned
+TORCH_API int64_t lookup_pinned_grain(const char* tag);
+
+// Derives a grain size from a timed probe (`probe_numel` elements in
+// `probe_ns` nanoseconds), records it in the table reported by
+// at::get_parallel_info(), and returns it
+TORCH_API int64_t record_probed_grain(
+    const char* tag,
+    int64_t probe_numel,
+    int64_t probe_ns);
+
 } // namespace internal
 
 /*
@@ -126,6 +173,36 @@ inline scalar_t parallel_reduce(
     const F& f,
     const SF& sf);
 
+/*
+parallel_for_calibrated
+
+Variant of parallel_for for call sites whose per-element cost is far from
+the assumption baked into the fixed at::internal::GRAIN_SIZE: cheap
+copy-like kernels pay scheduling overhead on needlessly small chunks while
+transcendental-heavy kernels under-split. When calibration is enabled via
+TORCH_GRAIN_CALIBRATION=1, the first invocation of each call site times a
+small serial slice of f and picks a grain size targeting a fixed amount of
+work per task; the slice is executed exactly once, so non-idempotent
+functions remain correct. The chosen grain is cached per call site for the
+process lifetime, reported by get_parallel_info() and can be pinned across
+runs via TORCH_GRAIN_TABLE="tag=grain,...". With calibration disabled (the
+default) this is exactly parallel_for(begin, end, default_grain, f).
+
+tag: stable identifier for the call site, used as the key in
+  TORCH_GRAIN_TABLE and in the get_parallel_info() report
+
+default_grain: grain size used when calibration is disabled
+
+Other arguments and restrictions are those of parallel_for.
+*/
+template <class F>
+inline void parallel_for_calibrated(
+    const char* tag,
+    const int64_t begin,
+    const int64_t end,
+    const int64_t default_grain,
+    const F& f);
+
 // Returns a detailed string describing parallelization settings
 TORCH_API std::string get_parallel_info();
 
@@ -137,6 +214,16 @@ TORCH_API int get_num_interop_threads();
 
 // Launches inter-op parallel task
 TORCH_API void launch(std::function<void()> func);
+
+// Launches inter-op parallel task in the given priority lane. Workers drain
+// c10::TaskPriority::High before c10::TaskPriority::Low, so latency-critical
+// work can overtake queued best-effort tasks; scheduling stays
+// work-conserving (Low runs whenever no High task is pending).
+TORCH_API void launch(std::function<void()> func, c10::TaskPriority priority);
+
+// Number of inter-op tasks queued (not yet running) in the given lane
+TORCH_API size_t get_interop_queued_tasks(c10::TaskPriority priority);
+
 namespace internal {
 void launch_no_thread_state(std::function<void()> fn);
 } // namespace internal
@@ -4,6 +4,10 @@
 #include <ATen/PTThreadPool.h>
 #include <ATen/Version.h>
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <thread>
 
@@ -40,6 +44,49 @@ size_t get_env_num_threads(const char* var_name, size_t def_value = 0) {
   return def_value;
 }
 
+// Grain calibration targets roughly this much work per parallel task: long
+// enough to amortize task submission, short enough to still load-balance.
+constexpr int64_t kGrainTargetTaskNs = 50000;
+constexpr int64_t kMinCalibratedGrain = 512;
+constexpr int64_t kMaxCalibratedGrain = 1 << 24;
+
+struct CalibratedGrainTable {
+  std::mutex mutex;
+  std::map<std::string, int64_t> entries;
+};
+
+CalibratedGrainTable& calibrated_grain_table() {
+  static CalibratedGrainTable table;
+  return table;
+}
+
+// Grains pinned through TORCH_GRAIN_TABLE="tag=grain,tag=grain,...";
+// parsed once on first lookup
+const std::map<std::string, int64_t>& pinned_grain_table() {
+  static std::map<std::string, int64_t> table = []() {
+    std::map<std::string, int64_t> result;
+    auto* value = get_env_var("TORCH_GRAIN_TABLE");
+    if (!value) {
+      return result;
+    }
+    std::istringstream stream(value);
+    std::string entry;
+    while (std::getline(stream, entry, ',')) {
+      const auto pos = entry.find('=');
+      try {
+        TORCH_CHECK(pos != std::string::npos && pos > 0);
+        const auto grain = c10::stoi(entry.substr(pos + 1));
+        TORCH_CHECK(grain > 0);
+        result[entry.substr(0, pos)] = grain;
+      } catch (const std::exception&) {
+        TORCH_WARN("Ignoring malformed TORCH_GRAIN_TABLE entry: ", entry);
+      }
+    }
+    return result;
+  }();
+  return table;
+}
+
 } // namespace
 
 std::string get_parallel_info() {
@@ -70,6 +117,10 @@ std::string get_parallel_info() {
      << get_env_var("OMP_NUM_THREADS", "[not set]") << std::endl;
   ss << "\tMKL_NUM_THREADS : "
      << get_env_var("MKL_NUM_THREADS", "[not set]") << std::endl;
+  ss << "\tTORCH_GRAIN_CALIBRATION : "
+     << get_env_var("TORCH_GRAIN_CALIBRATION", "[not set]") << std::endl;
+  ss << "\tTORCH_GRAIN_TABLE : "
+     << get_env_var("TORCH_GRAIN_TABLE", "[not set]") << std::endl;
 
   ss << "ATen parallel backend: ";
   #if AT_PARALLEL_OPENMP
@@ -88,9 +139,71 @@ std::string get_parallel_info() {
   ss << "Experimental: single thread pool" << std::endl;
   #endif
 
+  {
+    auto& table = calibrated_grain_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    if (!table.entries.empty()) {
+      // Emitted in TORCH_GRAIN_TABLE format so a calibrated table can be
+      // exported and pinned on later runs.
+      ss << "Calibrated grain sizes:" << std::endl << "\t";
+      bool first = true;
+      for (const auto& entry : table.entries) {
+        ss << (first ? "" : ",") << entry.first << "=" << entry.second;
+        first = false;
+      }
+      ss << std::endl;
+    }
+  }
+
   return ss.str();
 }
 
+namespace internal {
+
+bool grain_calibration_enabled() {
+  static bool enabled =
+      get_env_var("TORCH_GRAIN_CALIBRATION", "0")[0] == '1';
+  return enabled;
+}
+
+int64_t lookup_pinned_grain(const char* tag) {
+  const auto& table = pinned_grain_table();
+  auto it = table.find(tag);
+  return it != table.end() ? it->second : 0;
+}
+
+int64_t record_probed_grain(
+    const char* tag,
+    int64_t probe_numel,
+    int64_t probe_ns) {
+  // probe_ns / probe_numel is the serial per-element cost; size each task
+  // to take roughly kGrainTargetTaskNs. A probe too fast to time resolves
+  // to the upper clamp, which is what a near-free kernel wants anyway.
+  int64_t grain = kMaxCalibratedGrain;
+  if (probe_numel > 0 && probe_ns > 0) {
+    grain = kGrainTargetTaskNs * probe_numel / probe_ns;
+  }
+  grain = std::max(kMinCalibratedGrain, std::min(kMaxCalibratedGrain, grain));
+  auto& table = calibrated_grain_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  table.entries[tag] = grain;
+  return grain;
+}
+
+} // namespace internal
+
+namespace {
+std::atomic<ParallelStrategy> parallel_strategy_{ParallelStrategy::STATIC};
+} // namespace
+
+void set_parallel_strategy(ParallelStrategy strategy) {
+  parallel_strategy_.store(strategy, std::memory_order_relaxed);
+}
+
+ParallelStrategy get_parallel_strategy() {
+  return parallel_strategy_.load(std::memory_order_relaxed);
+}
+
 int intraop_default_num_threads() {
 #ifdef C10_MOBILE
   // Intraop thread pool size should be determined by mobile cpuinfo.
@@ -137,6 +137,73 @@ inline std::tuple<size_t, size_t> calc_num_tasks_and_chunk_size(
   return std::make_tuple(num_tasks, chunk_size);
 }
 
+// Dynamic variant of invoke_parallel used with
+// ParallelStrategy::WORK_STEALING: the range is split into chunks of roughly
+// grain_size elements and every worker repeatedly claims the next
+// unprocessed chunk from a shared cursor.  Workers that finish cheap chunks
+// immediately take over work that the static partitioning would have left
+// queued behind an expensive chunk on a single thread.
+static void _invoke_parallel_dynamic(
+    const int64_t begin,
+    const int64_t end,
+    const int64_t grain_size,
+    const std::function<void(int64_t, int64_t)>& f) {
+  const auto num_threads = (size_t)get_num_threads();
+  int64_t chunk_size = std::max(grain_size, (int64_t)1);
+  // Cap the number of chunks so the per-chunk claim stays negligible while
+  // still leaving several chunks per worker to balance across.
+  const int64_t max_chunks = (int64_t)num_threads * 8;
+  chunk_size = std::max(chunk_size, divup(end - begin, max_chunks));
+  const int64_t num_chunks = divup(end - begin, chunk_size);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+  struct {
+    std::atomic<int64_t> next_chunk{0};
+    std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
+    std::exception_ptr eptr;
+    std::mutex mutex;
+    volatile size_t remaining;
+    std::condition_variable cv;
+  } state;
+
+  auto task = [f, &state, begin, end, chunk_size, num_chunks]
+      (int /* unused */, size_t task_id) {
+    try {
+      ParallelRegionGuard guard(task_id);
+      int64_t chunk = 0;
+      while ((chunk = state.next_chunk.fetch_add(1)) < num_chunks) {
+        int64_t local_start = begin + chunk * chunk_size;
+        int64_t local_end = std::min(end, local_start + chunk_size);
+        f(local_start, local_end);
+      }
+    } catch (...) {
+      if (!state.err_flag.test_and_set()) {
+        state.eptr = std::current_exception();
+      }
+    }
+    {
+      std::unique_lock<std::mutex> lk(state.mutex);
+      if (--state.remaining == 0) {
+        state.cv.notify_one();
+      }
+    }
+  };
+  const size_t num_workers = std::min((size_t)num_chunks, num_threads);
+  state.remaining = num_workers;
+  _run_with_pool(task, num_workers);
+
+  // Wait for all tasks to finish.
+  {
+    std::unique_lock<std::mutex> lk(state.mutex);
+    if (state.remaining != 0) {
+      state.cv.wait(lk);
+    }
+  }
+  if (state.eptr) {
+    std::rethrow_exception(state.eptr);
+  }
+}
+
 void invoke_parallel(
   const int64_t begin,
   const int64_t end,
@@ -144,6 +211,12 @@ void invoke_parallel(
   const std::function<void(int64_t, int64_t)>& f) {
   at::internal::lazy_init_num_threads();
 
+  if (get_parallel_strategy() == ParallelStrategy::WORK_STEALING &&
+      end - begin > grain_size) {
+    _invoke_parallel_dynamic(begin, end, grain_size, f);
+    return;
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   size_t num_tasks, chunk_size;
   std::tie(num_tasks, chunk_size) =
@@ -69,6 +69,10 @@ int get_num_interop_threads() {
   }
 }
 
+size_t get_interop_queued_tasks(c10::TaskPriority priority) {
+  return get_pool().queuedTasks(priority);
+}
+
 namespace internal {
 void launch_no_thread_state(std::function<void()> fn) {
 #if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
@@ -79,16 +83,29 @@ void launch_no_thread_state(std::function<void()> fn) {
 }
 } // namespace internal
 
-void launch(std::function<void()> func) {
+static std::function<void()> wrap_thread_state(std::function<void()> func) {
   // NOLINTNEXTLINE(modernize-avoid-bind)
-  internal::launch_no_thread_state(std::bind([](
+  return std::bind([](
     std::function<void()> f, ThreadLocalState thread_locals) {
       ThreadLocalStateGuard guard(std::move(thread_locals));
       f();
     },
     std::move(func),
     ThreadLocalState()
-  ));
+  );
+}
+
+void launch(std::function<void()> func) {
+  internal::launch_no_thread_state(wrap_thread_state(std::move(func)));
+}
+
+void launch(std::function<void()> func, c10::TaskPriority priority) {
+#if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
+  // The single shared pool has no inter-op lanes; fall back to FIFO.
+  launch(std::move(func));
+#else
+  get_pool().run(wrap_thread_state(std::move(func)), priority);
+#endif
 }
 
 } // namespace at
@@ -0,0 +1,82 @@
+#include <ATen/PreForkInit.h>
+
+#include <ATen/CPUGeneratorImpl.h>
+#include <ATen/Context.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/DispatchStub.h>
+
+#include <chrono>
+#include <mutex>
+#include <utility>
+
+namespace at {
+
+namespace {
+
+std::mutex& audit_log_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<LazyInitCost>& audit_log() {
+  static std::vector<LazyInitCost> log;
+  return log;
+}
+
+// Runs one lazy-init component, appending its timing both to the audit log
+// and to the report returned by preForkInit().
+template <typename F>
+void run_timed(const char* name, std::vector<LazyInitCost>& report, F&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto duration_ms =
+      std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - start)
+          .count();
+  detail::recordLazyInitCost(name, duration_ms);
+  report.emplace_back(LazyInitCost{name, duration_ms});
+}
+
+} // namespace
+
+std::vector<LazyInitCost> preForkInit() {
+  std::vector<LazyInitCost> report;
+
+  run_timed("at::globalContext", report, [] { globalContext(); });
+
+  // Configures intra/inter-op thread counts (reads environment variables and
+  // the cpu topology). This does not spawn worker threads - those would not
+  // survive fork() - it only makes the forked children skip the per-thread
+  // lazy configuration on their first parallel region.
+  run_timed("at::init_num_threads", report, [] { init_num_threads(); });
+
+  // cpuinfo-based ISA detection, used by every DispatchStub on first call.
+  run_timed("at::native::get_cpu_capability", report, [] {
+    native::get_cpu_capability();
+  });
+
+  // The default CPU generator seeds itself from the system entropy source.
+  run_timed("at::detail::getDefaultCPUGenerator", report, [] {
+    at::detail::getDefaultCPUGenerator();
+  });
+
+  run_timed("at::getCPUAllocator", report, [] { getCPUAllocator(); });
+
+  return report;
+}
+
+namespace detail {
+
+void recordLazyInitCost(const char* name, double duration_ms) {
+  std::lock_guard<std::mutex> lock(audit_log_mutex());
+  audit_log().emplace_back(LazyInitCost{name, duration_ms});
+}
+
+} // namespace detail
+
+std::vector<LazyInitCost> lazyInitAuditLog() {
+  std::lock_guard<std::mutex> lock(audit_log_mutex());
+  return audit_log();
+}
+
+} // namespace at
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace at {
+
+// One lazily-initialized component, with the wall-clock cost of its first
+// initialization. Returned by preForkInit() and lazyInitAuditLog().
+struct LazyInitCost {
+  std::string name;
+  double duration_ms;
+};
+
+// Completes ATen's lazy CPU-side initialization so that processes forked
+// afterwards (e.g. replacement workers in an elastic fork server) do not pay
+// first-call costs. Covers the global context, the default CPU generator
+// (which reads the system entropy source), cpu capability detection via
+// cpuinfo, the CPU allocator, and thread-count configuration.
+//
+// Deliberately excluded:
+//  - CUDA/HIP contexts: a device context must not be created before fork();
+//    forked children have to call at::globalContext().lazyInitCUDA()
+//    themselves.
+//  - Thread pools: threads do not survive fork(), so warming them in the
+//    parent would be wasted work at best.
+//
+// Idempotent; returns per-component timings for the work performed by this
+// call. Costs that remain lazy (such as CUDA context creation in the child)
+// are reported by lazyInitAuditLog() instead.
+TORCH_API std::vector<LazyInitCost> preForkInit();
+
+namespace detail {
+
+// Appends a first-call cost to the process-wide lazy-init audit log. Called
+// from instrumented lazy initialization sites (see Context::lazyInitCUDA);
+// thread-safe.
+TORCH_API void recordLazyInitCost(const char* name, double duration_ms);
+
+// Runs a lazy initialization step and appends its wall-clock cost to the
+// audit log.
+template <typename F>
+void timeLazyInit(const char* name, F&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  recordLazyInitCost(
+      name,
+      std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+}
+
+} // namespace detail
+
+// Snapshot of the lazy-init costs observed so far in this process, in the
+// order they occurred. After preForkInit() in the parent, a forked child can
+// dump this to audit which first-call costs remain (typically just device
+// context creation).
+TORCH_API std::vector<LazyInitCost> lazyInitAuditLog();
+
+} // namespace at
@@ -55,6 +55,7 @@ void SparseTensorImpl::release_resources() {
   TensorImpl::release_resources();
   values_.reset();
   indices_.reset();
+  csr_cache_.reset();
 }
 
 void SparseTensorImpl::set_size(int64_t dim, int64_t new_size) {
@@ -106,6 +107,9 @@ void SparseTensorImpl::set_indices_and_values_unsafe(const Tensor& indices, cons
 
   indices_ = indices;
   values_ = values;
+  // Fresh indices/values may start at the same version numbers as the old
+  // ones, so drop the CSR cache explicitly.
+  invalidate_csr_cache();
   AT_ASSERT(device() == values_.device());
   AT_ASSERT(values_.device() == indices_.device());
 
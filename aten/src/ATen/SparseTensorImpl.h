@@ -38,6 +38,12 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
   // because many algorithms proceed by merging two sorted lists (of indices).
   bool coalesced_ = false;
 
+  // Derived CSR representation of this tensor, populated lazily by
+  // to_sparse_csr.  See Note [CSR conversion cache].
+  Tensor csr_cache_;
+  uint32_t csr_cache_indices_version_ = 0;
+  uint32_t csr_cache_values_version_ = 0;
+
   // compute_numel with integer multiplication overflow check, see gh-57542
   void refresh_numel() {
     TensorImpl::safe_refresh_numel();
@@ -72,6 +78,55 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     return values_;
   }
 
+  // Note [CSR conversion cache]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Workloads that repeatedly multiply the same sparse matrix (e.g. a fixed
+  // adjacency matrix, once per training step) would otherwise pay for a full
+  // COO -> CSR conversion on every step.  to_sparse_csr stashes the converted
+  // tensor here so that steady-state iterations reuse it.  The cache is
+  // dropped by every mutator that replaces indices_/values_, and is
+  // additionally validated against the version counters of indices_/values_
+  // so that in-place writes through _indices()/_values() are caught as well.
+  // Tensors whose components do not track versions (e.g. inference tensors)
+  // are never cached.
+
+  // Returns the cached CSR conversion of this tensor, or an undefined tensor
+  // if no valid cache entry exists.
+  Tensor csr_cache() const {
+    if (!csr_cache_.defined()) {
+      return Tensor();
+    }
+    const auto& indices_version =
+        indices_.unsafeGetTensorImpl()->version_counter();
+    const auto& values_version =
+        values_.unsafeGetTensorImpl()->version_counter();
+    if (!indices_version.enabled() || !values_version.enabled() ||
+        indices_version.current_version() != csr_cache_indices_version_ ||
+        values_version.current_version() != csr_cache_values_version_) {
+      return Tensor();
+    }
+    return csr_cache_;
+  }
+
+  // Stores the CSR conversion of this tensor, recording the current versions
+  // of indices_/values_ so that later in-place mutation invalidates it.
+  void set_csr_cache(const Tensor& csr) {
+    const auto& indices_version =
+        indices_.unsafeGetTensorImpl()->version_counter();
+    const auto& values_version =
+        values_.unsafeGetTensorImpl()->version_counter();
+    if (!indices_version.enabled() || !values_version.enabled()) {
+      return;
+    }
+    csr_cache_ = csr;
+    csr_cache_indices_version_ = indices_version.current_version();
+    csr_cache_values_version_ = values_version.current_version();
+  }
+
+  void invalidate_csr_cache() {
+    csr_cache_.reset();
+  }
+
   void set_size(int64_t dim, int64_t new_size) override;
   void set_stride(int64_t dim, int64_t new_stride) override;
   void set_storage_offset(int64_t storage_offset) override;
@@ -93,6 +148,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     set_sizes_and_strides(size, std::vector<int64_t>(size.size()));
     sparse_dim_ = sparse_dim;
     dense_dim_ = dense_dim;
+    invalidate_csr_cache();
     refresh_numel();
   }
 
@@ -224,6 +280,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     }
     sparse_dim_ = sparse_dim;
     dense_dim_ = dense_dim;
+    invalidate_csr_cache();
     refresh_numel();
   }
 
@@ -279,6 +336,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
         "set_coalesced ",
         err_msg_tensor_metadata_change_not_allowed);
     coalesced_ = coalesced;
+    invalidate_csr_cache();
   }
 
   // NOTE: this function is only used internally and not exposed to Python
@@ -291,6 +349,9 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     AT_ASSERT(new_nnz <= nnz());
     indices_ = indices_.narrow(1, 0, new_nnz);
     values_ = values_.narrow(0, 0, new_nnz);
+    // narrow produces views sharing the original version counters, so the
+    // version check alone would not catch this mutation.
+    invalidate_csr_cache();
     if (new_nnz < 2) {
       coalesced_ = true;
     }
@@ -392,6 +453,13 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     dest_sparse_impl->indices_ = src_sparse_impl->indices();
     dest_sparse_impl->values_ = src_sparse_impl->values();
     dest_sparse_impl->coalesced_ = src_sparse_impl->coalesced();
+    // Shallow copies share indices_/values_, so the CSR cache (validated
+    // against their version counters) remains valid for the copy.
+    dest_sparse_impl->csr_cache_ = src_sparse_impl->csr_cache_;
+    dest_sparse_impl->csr_cache_indices_version_ =
+        src_sparse_impl->csr_cache_indices_version_;
+    dest_sparse_impl->csr_cache_values_version_ =
+        src_sparse_impl->csr_cache_values_version_;
   }
 
   const char* tensorimpl_type_name() const override;
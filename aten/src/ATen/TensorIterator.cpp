@@ -5,6 +5,7 @@
 
 #include <ATen/core/Tensor.h>
 
+#include <ATen/DataMovementAccounting.h>
 #include <ATen/ExpandUtils.h>
 #include <ATen/Parallel.h>
 #include <ATen/native/TypeProperties.h>
@@ -23,6 +24,9 @@
 
 #include <c10/util/irange.h>
 #include <c10/util/SmallBuffer.h>
+#include <c10/util/env.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/hash.h>
 
 #include <array>
 #include <algorithm>
@@ -1461,11 +1465,196 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
 
 TensorIteratorBase::TensorIteratorBase() = default;
 
+// Note [TensorIterator plan cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// build() recomputes broadcasting, type promotion, dimension reordering and
+// coalescing on every call, even though inference workloads often construct
+// iterators over tensors whose metadata never changes.  When
+// TORCH_TENSORITERATOR_PLAN_CACHE=1 is set we memoize the outcome of build()
+// in a thread-local table keyed on the operand metadata
+// (sizes/strides/dtype/device) plus the config flags that influence the
+// build, and on a hit only rebind the data pointers.
+//
+// Caching is restricted to builds where nothing but metadata computation
+// happened: every operand must be defined up front, no output is resized, no
+// dtype-cast temporaries are created and no named tensors are involved.
+// Partial-overlap checks between inputs and outputs depend on data pointers
+// and are only performed on cache misses, which is why the cache is opt-in.
+namespace {
+
+struct IteratorPlanOperand {
+  OperandInfo::StrideVector stride_bytes;
+  Device device = kCPU;
+  ScalarType target_dtype = ScalarType::Undefined;
+  ScalarType current_dtype = ScalarType::Undefined;
+};
+
+struct IteratorPlan {
+  DimVector shape;
+  DimVector perm;
+  SmallVector<IteratorPlanOperand, 4> operands;
+  ScalarType common_dtype = ScalarType::Undefined;
+  Device common_device = kCPU;
+  bool has_coalesced_dimensions = false;
+  bool all_ops_same_shape = false;
+  bool all_ops_are_scalars = false;
+};
+
+bool plan_cache_enabled() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_TENSORITERATOR_PLAN_CACHE") == true;
+  return enabled;
+}
+
+ska::flat_hash_map<uint64_t, IteratorPlan>& plan_cache() {
+  // Thread-local so no locking is needed on the hot path; iterators built on
+  // different threads simply warm up their own tables.
+  static thread_local ska::flat_hash_map<uint64_t, IteratorPlan> cache;
+  return cache;
+}
+
+// Keeps a pathological workload (e.g. fully dynamic shapes) from growing the
+// table without bound; the cache is only profitable when keys repeat anyway.
+constexpr size_t kMaxCachedPlans = 512;
+
+} // namespace
+
+uint64_t TensorIteratorBase::compute_plan_cache_key(
+    const TensorIteratorConfig& config) const {
+  if (!plan_cache_enabled()) {
+    return 0;
+  }
+  // Static shapes/dtypes are used by callers that already bypass most of
+  // build(); don't bother caching those.
+  if (config.static_shape_.has_value() || config.static_dtype_.has_value() ||
+      config.static_device_.has_value()) {
+    return 0;
+  }
+  uint64_t key = c10::get_hash(
+      config.tensors_.size(),
+      config.num_outputs_,
+      config.is_reduction_,
+      config.resize_outputs_,
+      config.check_all_same_dtype_,
+      config.check_all_same_device_,
+      config.enforce_safe_casting_to_output_,
+      config.enforce_linear_iteration_,
+      config.promote_inputs_to_common_dtype_,
+      config.promote_integer_inputs_to_float_,
+      config.cast_common_dtype_to_outputs_);
+  for (const auto& t : config.tensors_) {
+    if (!t->defined() || t->is_meta() || t->has_names()) {
+      return 0;
+    }
+    key = c10::hash_combine(
+        key,
+        c10::get_hash(
+            t->device(), t->scalar_type(), t->sizes(), t->strides()));
+  }
+  // 0 is reserved for "not cacheable".
+  return key == 0 ? 1 : key;
+}
+
+bool TensorIteratorBase::try_restore_cached_plan(
+    TensorIteratorConfig& config,
+    uint64_t key) {
+  auto it = plan_cache().find(key);
+  if (it == plan_cache().end()) {
+    return false;
+  }
+  const auto& plan = it->second;
+  populate_operands(config);
+  mark_outputs();
+  shape_ = plan.shape;
+  perm_ = plan.perm;
+  common_dtype_ = plan.common_dtype;
+  common_device_ = plan.common_device;
+  has_coalesced_dimensions_ = plan.has_coalesced_dimensions;
+  all_ops_same_shape_ = plan.all_ops_same_shape;
+  all_ops_are_scalars_ = plan.all_ops_are_scalars;
+  TORCH_INTERNAL_ASSERT(plan.operands.size() == operands_.size());
+  for (const auto i : c10::irange(operands_.size())) {
+    auto& op = operands_[i];
+    const auto& cached = plan.operands[i];
+    op.stride_bytes = cached.stride_bytes;
+    op.device = cached.device;
+    op.target_dtype = cached.target_dtype;
+    op.current_dtype = cached.current_dtype;
+    op.data = op.tensor_base().data_ptr();
+  }
+  int64_t ndim_offsets = (ndim() ? ndim() : 1);
+  view_offsets_ = DimVector(ndim_offsets, 0);
+  return true;
+}
+
+void TensorIteratorBase::save_plan_to_cache(uint64_t key) {
+  // Only cache "clean" builds: resized outputs and dtype-cast temporaries
+  // mean build() did more than compute metadata, so a pointer rebind would
+  // not reproduce it.  Named outputs are excluded up front by the key.
+  for (const auto& op : operands_) {
+    if (op.will_resize || op.original_tensor_base().defined()) {
+      return;
+    }
+  }
+  if (!names_.empty()) {
+    return;
+  }
+  auto& cache = plan_cache();
+  if (cache.size() >= kMaxCachedPlans) {
+    cache.clear();
+  }
+  IteratorPlan plan;
+  plan.shape = shape_;
+  plan.perm = perm_;
+  plan.common_dtype = common_dtype_;
+  plan.common_device = common_device_;
+  plan.has_coalesced_dimensions = has_coalesced_dimensions_;
+  plan.all_ops_same_shape = all_ops_same_shape_;
+  plan.all_ops_are_scalars = all_ops_are_scalars_;
+  for (const auto& op : operands_) {
+    IteratorPlanOperand cached;
+    cached.stride_bytes = op.stride_bytes;
+    cached.device = op.device.value_or(common_device_);
+    cached.target_dtype = op.target_dtype;
+    cached.current_dtype = op.current_dtype;
+    plan.operands.push_back(std::move(cached));
+  }
+  cache.emplace(key, std::move(plan));
+}
+
+void TensorIteratorBase::account_data_movement() const {
+  if (!DataMovementAccountingGuard::enabled()) {
+    return;
+  }
+  const auto n = static_cast<uint64_t>(numel());
+  uint64_t bytes_read = 0;
+  uint64_t bytes_written = 0;
+  for (const auto& op : operands_) {
+    const uint64_t nbytes = n * op.tensor_base().element_size();
+    if (op.is_output) {
+      bytes_written += nbytes;
+      if (op.is_read_write) {
+        bytes_read += nbytes;
+      }
+    } else {
+      bytes_read += nbytes;
+    }
+  }
+  DataMovementAccountingGuard::record(bytes_read, bytes_written);
+}
+
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
   enforce_linear_iteration_ = config.enforce_linear_iteration_;
 
+  // See Note [TensorIterator plan cache]
+  const uint64_t plan_cache_key = compute_plan_cache_key(config);
+  if (plan_cache_key != 0 && try_restore_cached_plan(config, plan_cache_key)) {
+    account_data_movement();
+    return;
+  }
+
   // fill in operands_ based on configuration
   populate_operands(config);
   // set is_output and is_read_write flags on appropriate tensors
@@ -1525,6 +1714,12 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // a valid value for the offset
   int64_t ndim_offsets = (ndim() ? ndim() : 1);
   view_offsets_ = DimVector(ndim_offsets, 0);
+
+  account_data_movement();
+
+  if (plan_cache_key != 0) {
+    save_plan_to_cache(plan_cache_key);
+  }
 }
 
 // This is the structured kernels' implementation of set_output.  It is
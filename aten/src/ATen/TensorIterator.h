@@ -605,6 +605,16 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   void propagate_names_to_outputs();
   void coalesce_dimensions();
 
+  // See Note [TensorIterator plan cache] in TensorIterator.cpp.  A key of 0
+  // means the configuration is not eligible for plan caching.
+  uint64_t compute_plan_cache_key(const TensorIteratorConfig&) const;
+  bool try_restore_cached_plan(TensorIteratorConfig&, uint64_t key);
+  void save_plan_to_cache(uint64_t key);
+
+  // Credits this iterator's logical operand volume to any active
+  // DataMovementAccountingGuard; called once per successful build().
+  void account_data_movement() const;
+
  protected:
   /// Records the "computation" shape of the output tensor. The computation
   /// shape is different from the regular shape in a few ways:
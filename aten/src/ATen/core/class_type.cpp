@@ -19,6 +19,7 @@ void ClassType::addMethod(torch::jit::Function* method) {
       " on class: ",
       repr_str());
   methods_.push_back(method);
+  methodIndex_.emplace(method->name(), methods_.size() - 1);
 }
 
 const std::vector<torch::jit::Function*>& ClassType::getForwardHooks() const {
@@ -324,10 +325,9 @@ void ClassType::checkForwardHookSchema(
 }
 
 torch::jit::Function* ClassType::findMethod(const std::string& name) const {
-  for (auto method : methods_) {
-    if (name == method->name()) {
-      return method;
-    }
+  auto it = methodIndex_.find(name);
+  if (it != methodIndex_.end()) {
+    return methods_[it->second];
   }
   return nullptr;
 }
@@ -391,6 +391,11 @@ void ClassType::unsafeRemoveMethod(const std::string& name) {
   for (auto method : methods_) {
     if (method->name() == name) {
       methods_.erase(methods_.begin() + slot);
+      // Rebuild the name index: erasing shifts every subsequent slot.
+      methodIndex_.clear();
+      for (const auto i : c10::irange(methods_.size())) {
+        methodIndex_.emplace(methods_[i]->name(), i);
+      }
       return;
     }
     slot++;
@@ -525,6 +530,7 @@ void ClassType::checkNotExist(const std::string& name, const std::string& what)
 
 void ClassType::addAttribute(ClassAttribute classAttribute) {
     AT_ASSERT(attributes_.size() == attributeTypes_.size());
+    attributeSlots_.emplace(classAttribute.getName(), attributes_.size());
     attributeTypes_.emplace_back(classAttribute.getType());
     attributes_.emplace_back(std::move(classAttribute));
 }
@@ -575,6 +581,11 @@ void ClassType::unsafeRemoveAttribute(const std::string& name) {
   auto slot = getAttributeSlot(name);
   attributes_.erase(attributes_.begin() + slot);
   attributeTypes_.erase(attributeTypes_.begin() + slot);
+  // Removal shifts every later slot down by one.
+  attributeSlots_.clear();
+  for (size_t i = 0; i < attributes_.size(); ++i) {
+    attributeSlots_.emplace(attributes_[i].getName(), i);
+  }
   AT_ASSERT(attributes_.size() == attributeTypes_.size());
 }
 
@@ -5,6 +5,7 @@
 #include <ATen/core/ivalue.h>
 #include <ATen/core/jit_type_base.h>
 #include <c10/util/Optional.h>
+#include <c10/util/flat_hash_map.h>
 
 namespace torch {
 namespace jit {
@@ -108,18 +109,11 @@ struct TORCH_API ClassType : public NamedType {
   const std::vector<torch::jit::Function*>& methods() const;
 
   TypePtr findAttribute(const std::string& name) const {
-    size_t pos = 0;
-    for (const auto& attr : attributes_) {
-      if (name == attr.getName()) {
-        break;
-      }
-      ++pos;
-    }
-
-    if (pos >= attributes_.size()) {
+    auto slot = findAttributeSlot(name);
+    if (!slot) {
       return nullptr;
     }
-    return attributes_[pos].getType();
+    return attributes_[*slot].getType();
   }
 
   const TypePtr& getAttribute(const std::string& name) const {
@@ -153,14 +147,11 @@ struct TORCH_API ClassType : public NamedType {
   // When emitting instructions we specify the slot so that attribute access is
   // a constant lookup
   c10::optional<size_t> findAttributeSlot(const std::string& name) const {
-    size_t slot = 0;
-    for (const auto& attr : attributes_) {
-      if (name == attr.getName()) {
-        return slot;
-      }
-      slot++;
+    auto it = attributeSlots_.find(name);
+    if (it == attributeSlots_.end()) {
+      return c10::nullopt;
     }
-    return c10::nullopt;
+    return it->second;
   }
   size_t getAttributeSlot(const std::string& name) const {
     if (auto r = findAttributeSlot(name)) {
@@ -175,11 +166,7 @@ struct TORCH_API ClassType : public NamedType {
   }
 
   bool hasAttribute(const std::string& name) const {
-    return std::find_if(
-               attributes_.cbegin(),
-               attributes_.cend(),
-               [&](const ClassAttribute& attr) { return attr.getName() == name; }) !=
-        attributes_.cend();
+    return attributeSlots_.count(name) != 0;
   }
 
   bool isUnresolvedClassAttribute(const std::string& name) const;
@@ -418,9 +405,17 @@ struct TORCH_API ClassType : public NamedType {
   // Construct mirroring attributes_, only around due to the fact that `containedTypes()` method returns an ArrayRef.
   // Never fill this without using the appropriate provideNewClassAttribute method
   std::vector<TypePtr> attributeTypes_;
+  // Name -> slot index into attributes_, so name-based attribute resolution
+  // is a hash lookup instead of a linear scan. Kept in sync by
+  // addAttribute/unsafeRemoveAttribute.
+  ska::flat_hash_map<std::string, size_t> attributeSlots_;
 
   // List of methods associated with this class.
   std::vector<torch::jit::Function*> methods_;
+  // Mapping of method names -> indices in methods_. Used to speed up
+  // by-name method lookup on the call path (e.g. custom-class method
+  // dispatch), kept in sync by addMethod/unsafeRemoveMethod.
+  ska::flat_hash_map<std::string, size_t> methodIndex_;
   std::vector<torch::jit::Function*> staticmethods_;
 
   // List of hooks to be run before/after forward.
@@ -1,4 +1,5 @@
 #include <ATen/core/dispatch/Dispatcher.h>
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <sstream>
@@ -17,6 +18,35 @@ void dispatch_trace_nesting_incr() { ++dispatch_trace_nesting_value_; }
 void dispatch_trace_nesting_decr() { --dispatch_trace_nesting_value_; }
 int64_t dispatch_trace_nesting_value() { return dispatch_trace_nesting_value_; }
 
+namespace {
+
+// Note [Operator lookup cache]
+// findSchemaOrThrow is on the hot path for code that resolves operators by
+// name at call time.  The authoritative name table lives in a LeftRight, so
+// readers never block on the registration mutex, but every LeftRight::read
+// still performs two RMW operations on a shared counter, which shows up as
+// cache-line contention when many threads resolve names concurrently.  We
+// therefore keep a thread-local cache of successful lookups, validated
+// against a global version counter that is bumped whenever the published
+// table changes (or a registered schema is removed, which can invalidate a
+// cached handle without changing the table).  A reader that observes a stale
+// version drops its whole cache and re-resolves through the LeftRight table;
+// the hit path touches no shared mutable state.
+std::atomic<uint64_t> operator_table_version{1};
+
+void bumpOperatorTableVersion() {
+  operator_table_version.fetch_add(1, std::memory_order_release);
+}
+
+struct OperatorLookupCache {
+  uint64_t version = 0;
+  ska::flat_hash_map<OperatorName, OperatorHandle> handles;
+};
+
+thread_local OperatorLookupCache operator_lookup_cache;
+
+} // namespace
+
 namespace detail {
 
 class RegistrationListenerList final {
@@ -122,6 +152,18 @@ c10::optional<OperatorHandle> Dispatcher::findSchema(const OperatorName& overloa
 }
 
 OperatorHandle Dispatcher::findSchemaOrThrow(const char* name, const char* overload_name) {
+  // See Note [Operator lookup cache]
+  const auto version = operator_table_version.load(std::memory_order_acquire);
+  auto& cache = operator_lookup_cache;
+  if (C10_UNLIKELY(cache.version != version)) {
+    cache.handles.clear();
+    cache.version = version;
+  } else {
+    auto cached = cache.handles.find(OperatorName(name, overload_name));
+    if (C10_LIKELY(cached != cache.handles.end())) {
+      return cached->second;
+    }
+  }
   auto it = findSchema({name, overload_name});
   if (!it.has_value()) {
     // Check if we have ANYTHING; if that's the case, that means you're
@@ -134,6 +176,7 @@ OperatorHandle Dispatcher::findSchemaOrThrow(const char* name, const char* overl
         " but we found an implementation; did you forget to def() the operator?");
     }
   }
+  cache.handles.emplace(OperatorName(name, overload_name), *it);
   return it.value();
 }
 
@@ -160,6 +203,7 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
   operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
     operatorLookupTable.emplace(op_name, handle);
   });
+  bumpOperatorTableVersion();
 
   return handle;
 }
@@ -239,6 +283,8 @@ void Dispatcher::deregisterDef_(const OperatorHandle& op, const OperatorName& op
     // invariant
     listeners_->callOnOperatorDeregistered(op);
     op.operatorDef_->op.deregisterSchema();
+    // cached handles assume hasSchema(); see Note [Operator lookup cache]
+    bumpOperatorTableVersion();
   }
 
   cleanup(op, op_name);
@@ -315,6 +361,7 @@ void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name)
     operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
       operatorLookupTable.erase(op_name);
     });
+    bumpOperatorTableVersion();
   }
 }
 
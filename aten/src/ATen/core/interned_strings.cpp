@@ -23,6 +23,14 @@ const std::string& domain_prefix() {
 }
 
 Symbol InternedStrings::symbol(const std::string& s) {
+#if !defined(C10_MOBILE)
+  // Built-in symbols live in a frozen table that is never mutated after
+  // static initialization, so the hot interning path (JIT startup resolves
+  // millions of builtins) takes no lock.
+  if (auto sym = detail::builtin_symbol(c10::string_view(s.data(), s.size()))) {
+    return *sym;
+  }
+#endif
   std::lock_guard<std::mutex> guard(mutex_);
   return _symbol(s);
 }
@@ -6,6 +6,8 @@
 #include <vector>
 #include <ATen/core/symbol.h>
 #include <c10/util/Exception.h>
+#include <c10/util/Optional.h>
+#include <c10/util/string_view.h>
 
 namespace c10 {
 
@@ -31,4 +33,13 @@ struct TORCH_API InternedStrings {
   std::mutex mutex_;
 };
 
+namespace detail {
+#if !defined(C10_MOBILE)
+// Lock-free lookup in the frozen table of built-in symbols (everything
+// expanded from FORALL_NS_SYMBOLS); nullopt for runtime-added symbols.
+// Defined in register_symbols.cpp next to the entry array it indexes.
+c10::optional<Symbol> builtin_symbol(c10::string_view qual_name);
+#endif
+} // namespace detail
+
 } // namespace c10
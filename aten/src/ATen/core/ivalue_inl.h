@@ -324,8 +324,9 @@ struct TORCH_API TupleElements {
  private:
   size_t inlineSize_;
   // We represent TupleElements this way to save doing a heap
-  // allocation in the common (at least for unpickling) case where we
-  // have only 3 elements. We have our own union instead of
+  // allocation in the common (at least for unpickling and for the JIT
+  // interpreter's TUPLE_CONSTRUCT) case where we have at most 4
+  // elements. We have our own union instead of
   // c10::SmallVector<IValue> because c10::SmallVector<IValue> always
   // stores the begin/end/capacity pointers, which would be a waste of
   // space in our use case.
@@ -333,9 +334,9 @@ struct TORCH_API TupleElements {
     std::vector<IValue> elementsVector_;
     // Don't want to declare a std::array because the convenient
     // iteration and size members are a footgun in this case -- the
-    // actual size of the array may be smaller than 3!
+    // actual size of the array may be smaller than 4!
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
-    IValue elementsInline_[3];
+    IValue elementsInline_[4];
   };
 
   void destroyInline() {
@@ -356,8 +357,11 @@ struct TORCH_API TupleElements {
   : inlineSize_(0), elementsVector_(std::move(elements)) {}
 
   explicit TupleElements(c10::ArrayRef<IValue> elements)
-  : inlineSize_(elements.size() <= 3 ? elements.size() : 0) {
+  : inlineSize_(elements.size() <= 4 ? elements.size() : 0) {
     switch (inlineSize_) {
+      case 4:
+        new (&elementsInline_[3]) IValue(elements[3]);
+        C10_FALLTHROUGH;
       case 3:
         new (&elementsInline_[2]) IValue(elements[2]);
         C10_FALLTHROUGH;
@@ -391,6 +395,14 @@ struct TORCH_API TupleElements {
     new (&elementsInline_[2]) IValue(std::move(e3));
   }
 
+  explicit TupleElements(IValue&& e1, IValue&& e2, IValue&& e3, IValue&& e4)
+  : inlineSize_(4) {
+    new (&elementsInline_[0]) IValue(std::move(e1));
+    new (&elementsInline_[1]) IValue(std::move(e2));
+    new (&elementsInline_[2]) IValue(std::move(e3));
+    new (&elementsInline_[3]) IValue(std::move(e4));
+  }
+
   ~TupleElements() {
     if (inlineSize_) {
       destroyInline();
@@ -551,7 +563,7 @@ struct TORCH_API TupleElements {
 
   C10_NODISCARD IValue& at(size_t idx) {
     if (inlineSize_) {
-      TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inlineSize_ <= 3);
+      TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inlineSize_ <= 4);
       TORCH_CHECK(idx < inlineSize_, "TupleElements: invalid index Index = ", idx, "; Length = ", inlineSize_);
       return elementsInline_[idx];
     } else {
@@ -561,7 +573,7 @@ struct TORCH_API TupleElements {
 
   C10_NODISCARD const IValue& at(size_t idx) const {
     if (inlineSize_) {
-      TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inlineSize_ <= 3);
+      TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inlineSize_ <= 4);
       TORCH_CHECK(idx < inlineSize_, "TupleElements: invalid index Index = ", idx, "; Length = ", inlineSize_);
       return elementsInline_[idx];
     } else {
@@ -716,6 +728,10 @@ struct TORCH_API Tuple : c10::intrusive_ptr_target {
     return c10::make_intrusive<Tuple>(std::move(e1), std::move(e2), std::move(e3));
   }
 
+  static c10::intrusive_ptr<Tuple> create(IValue e1, IValue e2, IValue e3, IValue e4) {
+    return c10::make_intrusive<Tuple>(std::move(e1), std::move(e2), std::move(e3), std::move(e4));
+  }
+
  private:
   // Workaround inability to use `>` operator in template argument list.
   template <typename... Args>
@@ -730,6 +746,7 @@ struct TORCH_API Tuple : c10::intrusive_ptr_target {
       case 1:
       case 2:
       case 3:
+      case 4:
         return create(IValue(std::forward<Args>(elements_))...);
       default:
         return create(
@@ -826,6 +843,12 @@ struct TORCH_API Tuple : c10::intrusive_ptr_target {
   explicit Tuple(IValue&& e1, IValue&& e2, IValue&& e3, std::shared_ptr<TupleType> type)
     : elements_(std::move(e1), std::move(e2), std::move(e3)), type_(std::move(type)) {}
 
+  explicit Tuple(IValue&& e1, IValue&& e2, IValue&& e3, IValue&& e4)
+    : elements_(std::move(e1), std::move(e2), std::move(e3), std::move(e4)) {}
+
+  explicit Tuple(IValue&& e1, IValue&& e2, IValue&& e3, IValue&& e4, std::shared_ptr<TupleType> type)
+    : elements_(std::move(e1), std::move(e2), std::move(e3), std::move(e4)), type_(std::move(type)) {}
+
   friend class c10::intrusive_ptr<Tuple>;
 };
 
@@ -4,6 +4,11 @@
 #include <ATen/core/interned_strings_class.h>
 #include <ATen/core/interned_strings.h>
 
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/irange.h>
+
+#include <iterator>
+
 namespace c10 {
 
 namespace {
@@ -44,8 +49,50 @@ constexpr Entry entries[] = {
 #undef SYMBOL_ENTRY
 };
 
+#if !defined(C10_MOBILE)
+// Qualified-name string literals, in the same order as `entries`. Pasted
+// at preprocessing time so the frozen lookup table below can key directly
+// on static storage instead of owning copies.
+// NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+constexpr const char* qual_names[] = {
+#define SYMBOL_QUAL_NAME(n, s) #n "::" #s,
+
+    FORALL_NS_SYMBOLS(SYMBOL_QUAL_NAME)
+#undef SYMBOL_QUAL_NAME
+};
+
+// Frozen table over the built-in symbol set. It is fully built inside the
+// thread-safe static initializer and never mutated afterwards, so lookups
+// need no lock; only runtime-added symbols fall through to the mutex-
+// guarded dynamic table in InternedStrings.
+const ska::flat_hash_map<c10::string_view, Symbol>& builtin_symbol_table() {
+  static const auto* table = [] {
+    auto* map = new ska::flat_hash_map<c10::string_view, Symbol>();
+    map->reserve(std::size(entries));
+    for (const auto i : c10::irange(std::size(entries))) {
+      map->emplace(c10::string_view(qual_names[i]), entries[i].sym);
+    }
+    return map;
+  }();
+  return *table;
+}
+#endif
+
 } // namespace
 
+#if !defined(C10_MOBILE)
+namespace detail {
+c10::optional<Symbol> builtin_symbol(c10::string_view qual_name) {
+  const auto& table = builtin_symbol_table();
+  auto it = table.find(qual_name);
+  if (it == table.end()) {
+    return c10::nullopt;
+  }
+  return it->second;
+}
+} // namespace detail
+#endif
+
 InternedStrings::InternedStrings()
     : sym_to_info_(static_cast<size_t>(_keys::num_symbols)) {
   // Instead of a loop, this could be done by expanding the
@@ -0,0 +1,38 @@
+#include <ATen/cpu/PrecisionMode.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace at {
+namespace cpu {
+
+namespace {
+
+PrecisionMode precision_mode_from_env() {
+  const char* env = std::getenv("TORCH_CPU_PRECISION_MODE");
+  if (env != nullptr) {
+    if (std::strcmp(env, "strict") == 0) {
+      return PrecisionMode::Strict;
+    }
+    if (std::strcmp(env, "fast") == 0) {
+      return PrecisionMode::Fast;
+    }
+  }
+  return PrecisionMode::Default;
+}
+
+std::atomic<PrecisionMode> precision_mode{precision_mode_from_env()};
+
+} // namespace
+
+PrecisionMode get_precision_mode() {
+  return precision_mode.load(std::memory_order_relaxed);
+}
+
+void set_precision_mode(PrecisionMode mode) {
+  precision_mode.store(mode, std::memory_order_relaxed);
+}
+
+} // namespace cpu
+} // namespace at
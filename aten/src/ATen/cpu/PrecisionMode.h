@@ -0,0 +1,35 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+namespace at {
+namespace cpu {
+
+// Runtime precision mode for CPU transcendental kernels (exp/tanh/erf and
+// friends).
+//
+// - Strict:  always use the 1-ulp library implementations (Sleef).
+// - Default: current behavior; today this is the same as Strict.
+// - Fast:    kernels may substitute polynomial approximations that trade
+//            1-2 ulp of accuracy for throughput (see fast_exp/fast_tanh/
+//            fast_erf in ATen/cpu/vec). Intended for inference workloads
+//            that tolerate the extra error.
+//
+// The mode defaults to Default and can be preset with the environment
+// variable TORCH_CPU_PRECISION_MODE=strict|default|fast.
+enum class PrecisionMode {
+  Strict = 0,
+  Default = 1,
+  Fast = 2,
+};
+
+TORCH_API PrecisionMode get_precision_mode();
+TORCH_API void set_precision_mode(PrecisionMode mode);
+
+// True when kernels should pick the fast-math approximation tier.
+inline bool fast_math_enabled() {
+  return get_precision_mode() == PrecisionMode::Fast;
+}
+
+} // namespace cpu
+} // namespace at
@@ -78,6 +78,64 @@ struct VecReduceAllSIMD<float, Op> {
 #endif // defined(CPU_CAPABILITY_AVX512)
 #endif // defined(__GNUC__) && (__GNUC__ > 5) && !defined(_MSC_VER) && !defined(C10_MOBILE)
 
+#if defined(__aarch64__) && !defined(C10_MOBILE) && !defined(__CUDACC__)
+template <typename Op>
+struct VecReduceAllSIMD<float, Op> {
+  static inline float apply(const Op& vec_fun, const Vectorized<float>& acc_vec) {
+    using Vec = Vectorized<float>;
+    Vec v = acc_vec;
+    // 128-bit shuffle: [a1, a2, a3, a4, a5, a6, a7, a8] -> [a5, a6, a7, a8, a1, a2, a3, a4]
+    Vec v1 = {v.get_high(), v.get_low()};
+    // [a1+a5, a2+a6, a3+a7, a4+a8, -, -, -, -] ('+' stands for the reduction function. Note that the last 4 elements are not required)
+    v = vec_fun(v, v1);
+
+    // 64-bit shuffle: [a1+a5, a2+a6, a3+a7, a4+a8, -, -, -, -] -> [a3+a7, a4+a8, a1+a5, a2+a6, -, -, -, -]
+    float32x4_t v1_1 = vextq_f32(v.get_low(), v.get_low(), 2);
+    v1 = {v1_1, v1_1};
+    // [a1+a3+a5+a7, a2+a4+a6+a8, a1+a3+a5+a7, a2+a4+a6+a8, -, -, -, -]
+    v = vec_fun(v, v1);
+
+    // 32-bit shuffle: [a1+a3+a5+a7, a2+a4+a6+a8, a1+a3+a5+a7, a2+a4+a6+a8, -, -, -, -] -> [a2+a4+a6+a8, a1+a3+a5+a7, a2+a4+a6+a8, a1+a3+a5+a7, -, -, -, -]
+    v1_1 = vrev64q_f32(v.get_low());
+    v1 = {v1_1, v1_1};
+    // [a1+a2+a3+a4+a5+a6+a7+a8, a1+a2+a3+a4+a5+a6+a7+a8, a1+a2+a3+a4+a5+a6+a7+a8, a1+a2+a3+a4+a5+a6+a7+a8, -, -, -, -]
+    v = vec_fun(v, v1);
+
+    return vgetq_lane_f32(v.get_low(), 0);
+  }
+};
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+template <typename Op>
+struct VecReduceAllSIMD<c10::Half, Op> {
+  static inline c10::Half apply(const Op& vec_fun, const Vectorized<c10::Half>& acc_vec) {
+    using Vec = Vectorized<c10::Half>;
+    Vec v = acc_vec;
+    // 128-bit shuffle: fold the two fp16 registers into one
+    Vec v1 = {v.get_high(), v.get_low()};
+    v = vec_fun(v, v1);
+
+    // 64-bit shuffle within the low register
+    float16x8_t v1_1 = vextq_f16(v.get_low(), v.get_low(), 4);
+    v1 = {v1_1, v1_1};
+    v = vec_fun(v, v1);
+
+    // 32-bit shuffle
+    v1_1 = vextq_f16(v.get_low(), v.get_low(), 2);
+    v1 = {v1_1, v1_1};
+    v = vec_fun(v, v1);
+
+    // 16-bit shuffle
+    v1_1 = vextq_f16(v.get_low(), v.get_low(), 1);
+    v1 = {v1_1, v1_1};
+    v = vec_fun(v, v1);
+
+    return c10::Half(static_cast<float>(vgetq_lane_f16(v.get_low(), 0)));
+  }
+};
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#endif // defined(__aarch64__) && !defined(C10_MOBILE) && !defined(__CUDACC__)
+
 template <typename scalar_t, typename Op>
 inline scalar_t vec_reduce_all(const Op& vec_fun, const Vectorized<scalar_t>& acc_vec) {
   return VecReduceAllSIMD<scalar_t, Op>::apply(vec_fun, acc_vec);
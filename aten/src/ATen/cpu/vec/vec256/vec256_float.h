@@ -456,6 +456,99 @@ Vectorized<float> inline fmsub(const Vectorized<float>& a, const Vectorized<floa
   return _mm256_fmsub_ps(a, b, c);
 }
 
+// Fast-math tier (see vec_base.h); only used when
+// at::cpu::PrecisionMode::Fast is selected.
+//
+// Cephes-style polynomial exp, max error ~2 ulp over the finite range.
+// Inputs outside roughly [-87.3, 88.4] clamp to the nearest representable
+// result instead of flushing to 0/inf exactly where Sleef would.
+template <>
+Vectorized<float> inline fast_exp(const Vectorized<float>& a) {
+  const auto one = _mm256_set1_ps(1.0f);
+  auto x = _mm256_min_ps(a, _mm256_set1_ps(88.3762626647950f));
+  x = _mm256_max_ps(x, _mm256_set1_ps(-87.3365478515625f));
+  // express exp(x) as exp(g + n * log(2))
+  auto fx = _mm256_fmadd_ps(
+      x, _mm256_set1_ps(1.44269504088896341f), _mm256_set1_ps(0.5f));
+  fx = _mm256_floor_ps(fx);
+  // g = x - n * log(2), with log(2) split for extra precision
+  x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(0.693359375f), x);
+  x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(-2.12194440e-4f), x);
+  // degree-6 minimax polynomial for exp(g) on [-log(2)/2, log(2)/2]
+  auto y = _mm256_set1_ps(1.9875691500e-4f);
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507e-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073e-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894e-2f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459e-1f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201e-1f));
+  y = _mm256_fmadd_ps(y, _mm256_mul_ps(x, x), _mm256_add_ps(x, one));
+  // scale by 2^n via the exponent field
+  auto n = _mm256_cvttps_epi32(fx);
+  n = _mm256_add_epi32(n, _mm256_set1_epi32(0x7f));
+  n = _mm256_slli_epi32(n, 23);
+  return _mm256_mul_ps(y, _mm256_castsi256_ps(n));
+}
+
+// Rational approximation of tanh (as used by Eigen), accurate to a few
+// ulp on [-8, 8] and saturating to +-1 outside.
+template <>
+Vectorized<float> inline fast_tanh(const Vectorized<float>& a) {
+  auto x = _mm256_max_ps(
+      _mm256_min_ps(a, _mm256_set1_ps(7.99881172180175781f)),
+      _mm256_set1_ps(-7.99881172180175781f));
+  auto x2 = _mm256_mul_ps(x, x);
+  // numerator: x * P(x^2)
+  auto p = _mm256_fmadd_ps(
+      x2, _mm256_set1_ps(-2.76076847742355e-16f), _mm256_set1_ps(2.00018790482477e-13f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(-8.60467152213735e-11f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(5.12229709037114e-08f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(1.48572235717979e-05f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(6.37261928875436e-04f));
+  p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(4.89352455891786e-03f));
+  p = _mm256_mul_ps(p, x);
+  // denominator: Q(x^2)
+  auto q = _mm256_fmadd_ps(
+      x2, _mm256_set1_ps(1.19825839466702e-06f), _mm256_set1_ps(1.18534705686654e-04f));
+  q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(2.26843463243900e-03f));
+  q = _mm256_fmadd_ps(q, x2, _mm256_set1_ps(4.89352518554385e-03f));
+  return _mm256_div_ps(p, q);
+}
+
+// Same Abramowitz-Stegun polynomial as Vectorized<float>::erf(), with the
+// inner exp evaluated by fast_exp instead of Sleef.
+template <>
+Vectorized<float> inline fast_erf(const Vectorized<float>& a) {
+  // constants
+  const auto neg_zero_vec = _mm256_set1_ps(-0.f);
+  const auto one_vec = _mm256_set1_ps(1.0f);
+  const auto p = _mm256_set1_ps(0.3275911f);
+  const auto p1 = _mm256_set1_ps(0.254829592f);
+  const auto p2 = _mm256_set1_ps(-0.284496736f);
+  const auto p3 = _mm256_set1_ps(1.421413741f);
+  const auto p4 = _mm256_set1_ps(-1.453152027f);
+  const auto p5 = _mm256_set1_ps(1.061405429f);
+  // sign(x)
+  auto sign_mask = _mm256_and_ps(neg_zero_vec, a);
+  auto abs_vec = _mm256_xor_ps(sign_mask, a);
+  // t = 1 / (p * abs(x) + 1)
+  auto tmp0 = _mm256_fmadd_ps(p, abs_vec, one_vec);
+  auto t = _mm256_div_ps(one_vec, tmp0);
+  // r = p5 * t ^ 4 + p4 * t ^ 3 + p3 * t ^ 2 + p2 * t + p1
+  auto tmp1 = _mm256_fmadd_ps(p5, t, p4);
+  auto tmp2 = _mm256_fmadd_ps(tmp1, t, p3);
+  auto tmp3 = _mm256_fmadd_ps(tmp2, t, p2);
+  auto r = _mm256_fmadd_ps(tmp3, t, p1);
+  // - exp(- x * x)
+  auto pow_2 = _mm256_mul_ps(a, a);
+  auto neg_pow_2 = _mm256_xor_ps(neg_zero_vec, pow_2);
+  auto tmp4 = fast_exp(Vectorized<float>(neg_pow_2));
+  auto tmp5 = _mm256_xor_ps(neg_zero_vec, __m256(tmp4));
+  // erf(x) = sign(x) * (1 - r * t * exp(- x * x))
+  auto tmp6 = _mm256_mul_ps(tmp5, t);
+  auto tmp7 = _mm256_fmadd_ps(tmp6, r, one_vec);
+  return _mm256_xor_ps(sign_mask, tmp7);
+}
+
 // Used by Inductor CPP codegen
 template<>
 inline void transpose_mxn<float, 8, 8>(
@@ -31,6 +31,13 @@ static inline void cvtbf16_fp32(const __m512i& a, __m512& o1, __m512& o2) {
 }
 
 static inline __m512i cvtfp32_bf16(const __m512& a, const __m512& b) {
+#if defined(__AVX512BF16__)
+  // Sapphire Rapids and newer: VCVTNE2PS2BF16 narrows two fp32 vectors with
+  // round-to-nearest-even in a single instruction, replacing the software
+  // rounding sequence below.  The instruction quietens NaNs itself, so the
+  // explicit NaN blend is not needed.
+  return (__m512i)_mm512_cvtne2ps_pbh(b, a);
+#else
   __m512i lo = _mm512_castps_si512(a);
   __m512i hi = _mm512_castps_si512(b);
   __m512i nan = _mm512_set1_epi32(0xffff);
@@ -57,6 +64,7 @@ static inline __m512i cvtfp32_bf16(const __m512& a, const __m512& b) {
   t_lo = _mm512_packus_epi32(t_lo, t_hi); // t_hi[4-7] t_lo[4-7] t_hi[0-4] t_lo[0-4]
   __m512i idx = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
   return _mm512_permutexvar_epi64(idx, t_lo);
+#endif
 }
 
 static inline __m512i merge_compare_result(const __m512& a, const __m512& b) {
@@ -896,6 +896,26 @@ inline Vectorized<T> fmsub(const Vectorized<T>& a, const Vectorized<T>& b, const
   return a * b - c;
 }
 
+// Fast-math transcendental tier, selected at runtime via
+// at::cpu::set_precision_mode(PrecisionMode::Fast). ISA-specific headers
+// may overload these with polynomial implementations that trade 1-2 ulp
+// of accuracy for throughput; the generic versions forward to the precise
+// ops, so kernels can call them unconditionally on any Vectorized type.
+template <typename T>
+inline Vectorized<T> fast_exp(const Vectorized<T>& a) {
+  return a.exp();
+}
+
+template <typename T>
+inline Vectorized<T> fast_tanh(const Vectorized<T>& a) {
+  return a.tanh();
+}
+
+template <typename T>
+inline Vectorized<T> fast_erf(const Vectorized<T>& a) {
+  return a.erf();
+}
+
 template <int64_t scale = 1, typename T = void>
 std::enable_if_t<scale == 1 || scale == 2 || scale == 4 || scale == 8, Vectorized<T>>
 inline gather(T const* base_addr, const Vectorized<int_same_size_t<T>>& vindex) {
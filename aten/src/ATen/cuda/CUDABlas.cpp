@@ -347,6 +347,107 @@ void bgemm<at::BFloat16>(CUDABLAS_BGEMM_ARGTYPES(at::BFloat16)) {
   #endif // !defined(USE_ROCM)
 }
 
+#define GEMM_GROUPED_BATCHED_CHECK_ARGVALUES(Dtype)                    \
+  do {                                                                 \
+    CUDABLAS_NONNEGINT_CHECK(gemm_grouped_batched<Dtype>, m);          \
+    CUDABLAS_NONNEGINT_CHECK(gemm_grouped_batched<Dtype>, n);          \
+    CUDABLAS_NONNEGINT_CHECK(gemm_grouped_batched<Dtype>, k);          \
+    CUDABLAS_POSINT_CHECK(gemm_grouped_batched<Dtype>, lda);           \
+    CUDABLAS_POSINT_CHECK(gemm_grouped_batched<Dtype>, ldb);           \
+    CUDABLAS_POSINT_CHECK(gemm_grouped_batched<Dtype>, ldc);           \
+    CUDABLAS_NONNEGINT_CHECK(gemm_grouped_batched<Dtype>, num_batches);\
+  } while (0)
+
+template <>
+void gemm_grouped_batched<double>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(double)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  GEMM_GROUPED_BATCHED_CHECK_ARGVALUES(double);
+  TORCH_CUDABLAS_CHECK(cublasDgemmBatched(
+      handle, opa, opb, (int)m, (int)n, (int)k, &alpha,
+      a_array, (int)lda, b_array, (int)ldb, &beta,
+      c_array, (int)ldc, (int)num_batches));
+}
+
+template <>
+void gemm_grouped_batched<float>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(float)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  GEMM_GROUPED_BATCHED_CHECK_ARGVALUES(float);
+  TORCH_CUDABLAS_CHECK(cublasSgemmBatched(
+      handle, opa, opb, (int)m, (int)n, (int)k, &alpha,
+      a_array, (int)lda, b_array, (int)ldb, &beta,
+      c_array, (int)ldc, (int)num_batches));
+}
+
+template <>
+void gemm_grouped_batched<at::Half>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(at::Half)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  GEMM_GROUPED_BATCHED_CHECK_ARGVALUES(at::Half);
+  float falpha = alpha;
+  float fbeta = beta;
+#if !defined(USE_ROCM)
+  TORCH_CUDABLAS_CHECK(cublasGemmBatchedEx(
+      handle, opa, opb, (int)m, (int)n, (int)k, (void*)&falpha,
+      (const void**)a_array, CUDA_R_16F, (int)lda,
+      (const void**)b_array, CUDA_R_16F, (int)ldb, (void*)&fbeta,
+      (void**)c_array, CUDA_R_16F, (int)ldc,
+      (int)num_batches, CUDA_R_32F, CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+#else
+  TORCH_CUDABLAS_CHECK(rocblas_gemm_batched_ex(
+      handle, opa, opb, (int)m, (int)n, (int)k, (void*)&falpha,
+      (const void**)a_array, rocblas_datatype_f16_r, (int)lda,
+      (const void**)b_array, rocblas_datatype_f16_r, (int)ldb, (void*)&fbeta,
+      (void**)c_array, rocblas_datatype_f16_r, (int)ldc,
+      (void**)c_array, rocblas_datatype_f16_r, (int)ldc,
+      (int)num_batches, rocblas_datatype_f32_r, rocblas_gemm_algo_standard,
+      0, 0));
+#endif // !defined(USE_ROCM)
+}
+
+template <>
+void gemm_grouped_batched<at::BFloat16>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(at::BFloat16)) {
+  // See Note [Writing Nondeterministic Operations]
+  globalContext().alertCuBLASConfigNotDeterministic();
+  cublasHandle_t handle = at::cuda::getCurrentCUDABlasHandle();
+  cublasOperation_t opa = _cublasOpFromChar(transa);
+  cublasOperation_t opb = _cublasOpFromChar(transb);
+  _cublasAdjustLdLevel3(transa, transb, m, n, k, &lda, &ldb, &ldc);
+  GEMM_GROUPED_BATCHED_CHECK_ARGVALUES(at::BFloat16);
+  const float falpha = alpha;
+  const float fbeta = beta;
+#if !defined(USE_ROCM)
+  TORCH_CUDABLAS_CHECK(cublasGemmBatchedEx(
+      handle, opa, opb, (int)m, (int)n, (int)k, (void*)&falpha,
+      (const void**)a_array, CUDA_R_16BF, (int)lda,
+      (const void**)b_array, CUDA_R_16BF, (int)ldb, (void*)&fbeta,
+      (void**)c_array, CUDA_R_16BF, (int)ldc,
+      (int)num_batches, CUDA_R_32F, CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+#else
+  TORCH_CUDABLAS_CHECK(rocblas_gemm_batched_ex(
+      handle, opa, opb, (int)m, (int)n, (int)k, (void*)&falpha,
+      (const void**)a_array, rocblas_datatype_bf16_r, (int)lda,
+      (const void**)b_array, rocblas_datatype_bf16_r, (int)ldb, (void*)&fbeta,
+      (void**)c_array, rocblas_datatype_bf16_r, (int)ldc,
+      (void**)c_array, rocblas_datatype_bf16_r, (int)ldc,
+      (int)num_batches, rocblas_datatype_f32_r, rocblas_gemm_algo_standard,
+      0, 0));
+#endif // !defined(USE_ROCM)
+}
+
 template <>
 void gemm<double>(CUDABLAS_GEMM_ARGTYPES(double)) {
   // See Note [Writing Nondeterministic Operations]
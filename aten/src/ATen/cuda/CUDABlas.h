@@ -132,6 +132,32 @@ void bgemm<at::Half>(CUDABLAS_BGEMM_ARGTYPES(at::Half));
 template <>
 void bgemm<at::BFloat16>(CUDABLAS_BGEMM_ARGTYPES(at::BFloat16));
 
+// Batched GEMM over device arrays of matrix pointers, for groups of
+// equally-sized matmuls whose operands do not share a uniform batch stride
+// (e.g. hundreds of small per-layer adapter GEMMs gathered from a
+// TensorList).  Unlike bgemm, each of a/b/c is a device-resident array of
+// num_batches matrix pointers, so the whole group runs as a single cuBLAS
+// call instead of one launch per matrix.
+#define CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(Dtype)                                      \
+  char transa, char transb, int64_t m, int64_t n, int64_t k, at::opmath_type<Dtype> alpha, \
+      const Dtype **a_array, int64_t lda,                                                  \
+      const Dtype **b_array, int64_t ldb,                                                  \
+      at::opmath_type<Dtype> beta, Dtype **c_array, int64_t ldc, int64_t num_batches
+
+template <typename Dtype>
+inline void gemm_grouped_batched(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(Dtype)) {
+  AT_ERROR("at::cuda::blas::gemm_grouped_batched: not implemented for ", typeid(Dtype).name());
+}
+
+template <>
+void gemm_grouped_batched<double>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(double));
+template <>
+void gemm_grouped_batched<float>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(float));
+template <>
+void gemm_grouped_batched<at::Half>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(at::Half));
+template <>
+void gemm_grouped_batched<at::BFloat16>(CUDABLAS_GEMM_GROUPED_BATCHED_ARGTYPES(at::BFloat16));
+
 #define CUDABLAS_TRSM_ARGTYPES(Dtype)                                  \
   cublasHandle_t handle, cublasSideMode_t side, cublasFillMode_t uplo, \
       cublasOperation_t trans, cublasDiagType_t diag, int m, int n,    \
@@ -302,14 +302,35 @@ PhiloxCudaState CUDAGeneratorImpl::philox_cuda_state(uint64_t increment) {
     TORCH_CHECK(!graph_expects_this_gen_,
                 "CUDA generator expects graph capture to be underway, "
                 "but the current stream is not capturing.");
+    // A single wait-free fetch_add reserves [offset, offset + increment);
+    // concurrent callers reserving counter ranges never serialize here.
+    uint64_t offset = this->philox_offset_per_thread_.fetch_add(
+        increment, std::memory_order_relaxed);
     // see Note [Why enforce RNG offset % 4 == 0?]
-    TORCH_INTERNAL_ASSERT(this->philox_offset_per_thread_ % 4 == 0);
-    uint64_t offset = this->philox_offset_per_thread_;
-    this->philox_offset_per_thread_ += increment;
+    TORCH_INTERNAL_ASSERT(offset % 4 == 0);
     return PhiloxCudaState(this->seed_, offset);
   }
 }
 
+/**
+ * Self-locking wrapper around philox_cuda_state for consumer kernels.
+ *
+ * In eager mode the reservation is a wait-free fetch_add, so no lock is
+ * taken and concurrent ops do not serialize on the generator mutex. While a
+ * graph capture is underway offset_intragraph_ is updated non-atomically, so
+ * the reservation serializes on mutex_ as before. Callers that must order a
+ * reservation against concurrent seeding or state get/set should instead
+ * hold mutex_ themselves and call philox_cuda_state directly (see
+ * Note [Acquire lock when using random generators]).
+ */
+PhiloxCudaState CUDAGeneratorImpl::reserve_philox_cuda_state(uint64_t increment) {
+  if (at::cuda::currentStreamCaptureStatus() != at::cuda::CaptureStatus::None) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    return this->philox_cuda_state(increment);
+  }
+  return this->philox_cuda_state(increment);
+}
+
 /**
  * Temporarily accommodates call sites that use philox_engine_inputs.
  * Allows incremental refactor of call sites to use philox_cuda_state.
@@ -319,10 +340,10 @@ std::pair<uint64_t, uint64_t> CUDAGeneratorImpl::philox_engine_inputs(uint64_t i
                                "Cannot call CUDAGeneratorImpl::philox_engine_inputs");
   // rounds increment up to the nearest multiple of 4
   increment = ((increment + 3) / 4) * 4;
+  uint64_t offset = this->philox_offset_per_thread_.fetch_add(
+      increment, std::memory_order_relaxed);
   // see Note [Why enforce RNG offset % 4 == 0?]
-  TORCH_INTERNAL_ASSERT(this->philox_offset_per_thread_ % 4 == 0);
-  uint64_t offset = this->philox_offset_per_thread_;
-  this->philox_offset_per_thread_ += increment;
+  TORCH_INTERNAL_ASSERT(offset % 4 == 0);
   return std::make_pair(this->seed_, offset);
 }
 
@@ -74,17 +74,22 @@ namespace at {
  * }
  *
  * host_caller(...) {
- *   PhiloxCudaState rng_engine_inputs;
- *   {
- *     // See Note [Acquire lock when using random generators]
- *     std::lock_guard<std::mutex> lock(gen->mutex_);
- *
- *     // gen could be HostState or DevState here! No divergent code needed!
- *     rng_engine_inputs = gen->philox_cuda_state(offset_increment);
- *   }
+ *   // gen could be HostState or DevState here! No divergent code needed!
+ *   PhiloxCudaState rng_engine_inputs =
+ *       gen->reserve_philox_cuda_state(offset_increment);
  *   kernel<<<...>>>(..., rng_engine_inputs);
  * }
  *
+ * Note on locking: in eager mode the offset reservation inside
+ * philox_cuda_state is a single wait-free fetch_add, so concurrent
+ * philox_cuda_state calls hand out disjoint counter ranges even without
+ * the generator mutex, and reserve_philox_cuda_state takes no lock on
+ * that path. During capture offset_intragraph_ is updated
+ * non-atomically, so reserve_philox_cuda_state serializes on the mutex
+ * there. The mutex is also still what orders a reservation against
+ * concurrent seeding and state get/set; callers that need that ordering
+ * must hold mutex_ themselves and call philox_cuda_state directly (see
+ * Note [Acquire lock when using random generators]).
  */
 
 struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
@@ -106,6 +111,7 @@ struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
   void capture_prologue(int64_t* seed_extragraph, int64_t* offset_extragraph);
   uint64_t capture_epilogue();
   PhiloxCudaState philox_cuda_state(uint64_t increment);
+  PhiloxCudaState reserve_philox_cuda_state(uint64_t increment);
 
   bool reset_rnn_state() {
     return !no_reset_rnn_state_.test_and_set();
@@ -120,7 +126,12 @@ struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
 private:
   CUDAGeneratorImpl* clone_impl() const override;
   uint64_t seed_ = default_rng_seed_val;
-  uint64_t philox_offset_per_thread_ = 0;
+  // Atomic so that eager-mode offset reservation in philox_cuda_state /
+  // philox_engine_inputs is a single wait-free fetch_add: concurrent
+  // kernels reserving counter ranges do not serialize on the generator
+  // mutex. The mutex is still required around seeding and state get/set
+  // (see Note [Acquire lock when using random generators]).
+  std::atomic<uint64_t> philox_offset_per_thread_{0};
   int64_t* seed_extragraph_{};
   int64_t* offset_extragraph_{};
   uint32_t offset_intragraph_ = 0;
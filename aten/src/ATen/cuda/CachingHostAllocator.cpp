@@ -5,8 +5,14 @@
 #include <ATen/cuda/detail/CUDAHooks.h>
 #include <ATen/detail/CUDAHooksInterface.h>
 
+#include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+
 #include <cuda_runtime_api.h>
 #include <stdint.h>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -14,6 +20,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace at {
 namespace cuda {
@@ -32,6 +39,11 @@ struct Block {
   bool allocated_{false};
   size_t event_count_{0};
   std::unordered_set<at::cuda::CUDAStream> streams_;
+
+  // When the block was last inserted into the free list; guarded by the
+  // allocator's free_list_mutex_ and only meaningful while the block is on
+  // the free list. Used to trim long-idle blocks.
+  std::chrono::steady_clock::time_point idle_since_{};
 };
 
 // Note: cudaEventCreate when concurrently invoked from multiple threads can be
@@ -140,6 +152,17 @@ struct BlockComparator {
  * we do not enforce that free(Block* block) => block->event_count == 0. This is
  * for compatibility reasons, and we can explore enforcing these in subsequent
  * versions.
+ *
+ * Since every allocation is rounded up to a power of two, blocks fall into
+ * implicit power-of-two size classes, and we keep per-class accounting of
+ * allocated and cached blocks. This serves two purposes: a configurable cap
+ * on the idle bytes cached per class (blocks freed past the cap go straight
+ * back to the system, so mixed batch sizes cannot grow the pinned footprint
+ * without bound), and stats/trim entry points so long-lived processes can
+ * observe and bound the cache without a full empty_cache. The cached
+ * counters mirror the free list and share free_list_mutex_; the allocated
+ * counters are atomics because allocation and free touch them under
+ * different locks.
  */
 class CUDAHostAllocator {
  public:
@@ -157,6 +180,11 @@ class CUDAHostAllocator {
       if (it != free_list_.end()) {
         auto block = *it;
         block->allocated_ = true;
+        auto& cls = size_class_of(block);
+        cls.cached_blocks -= 1;
+        cls.cached_bytes -= block->size_;
+        cls.allocated_blocks.fetch_add(1, std::memory_order_relaxed);
+        cls.allocated_bytes.fetch_add(block->size_, std::memory_order_relaxed);
         free_list_.erase(it);
         return {block->ptr_, reinterpret_cast<void*>(block)};
       }
@@ -183,6 +211,11 @@ class CUDAHostAllocator {
     block->ptr_ = ptr;
     block->allocated_ = true;
 
+    num_host_alloc_.fetch_add(1, std::memory_order_relaxed);
+    auto& cls = size_class_of(block);
+    cls.allocated_blocks.fetch_add(1, std::memory_order_relaxed);
+    cls.allocated_bytes.fetch_add(block->size_, std::memory_order_relaxed);
+
     {
       std::lock_guard<std::mutex> g(blocks_mutex_);
       blocks_.insert(block);
@@ -204,6 +237,9 @@ class CUDAHostAllocator {
     {
       std::lock_guard<std::mutex> g(block->mutex_);
       block->allocated_ = false;
+      auto& cls = size_class_of(block);
+      cls.allocated_blocks.fetch_sub(1, std::memory_order_relaxed);
+      cls.allocated_bytes.fetch_sub(block->size_, std::memory_order_relaxed);
       if (block->streams_.empty()) {
         TORCH_INTERNAL_ASSERT(block->event_count_ == 0);
       } else {
@@ -220,8 +256,7 @@ class CUDAHostAllocator {
     }
 
     if (!events) {
-      std::lock_guard<std::mutex> g(free_list_mutex_);
-      free_list_.insert(block);
+      cache_or_release(block);
     } else {
       std::lock_guard<std::mutex> g(cuda_events_mutex_);
       for (auto&& event : *events) {
@@ -278,13 +313,75 @@ class CUDAHostAllocator {
     std::vector<Block*> blocks_to_remove(free_list_.begin(), free_list_.end());
     free_list_.clear();
     for (auto* block : blocks_to_remove) {
+      auto& cls = size_class_of(block);
+      cls.cached_blocks -= 1;
+      cls.cached_bytes -= block->size_;
       blocks_.erase(block);
       ptr_to_block_.erase(block->ptr_);
       AT_CUDA_CHECK(cudaFreeHost(block->ptr_));
+      num_host_free_.fetch_add(1, std::memory_order_relaxed);
       delete block;
     }
   }
 
+  // Releases blocks that have sat idle on the free list for longer than
+  // `max_idle_seconds`.
+  void trim(double max_idle_seconds) {
+    process_events();
+
+    const auto cutoff = std::chrono::steady_clock::now() -
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(max_idle_seconds));
+    std::vector<Block*> stale;
+    {
+      std::lock_guard<std::mutex> g(free_list_mutex_);
+      for (auto it = free_list_.begin(); it != free_list_.end();) {
+        auto* block = *it;
+        if (block->idle_since_ <= cutoff) {
+          auto& cls = size_class_of(block);
+          cls.cached_blocks -= 1;
+          cls.cached_bytes -= block->size_;
+          stale.push_back(block);
+          it = free_list_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    for (auto* block : stale) {
+      release_block(block);
+    }
+  }
+
+  void set_size_class_cache_limit(size_t bytes) {
+    size_class_cache_limit_.store(bytes, std::memory_order_relaxed);
+  }
+
+  HostStats get_stats() {
+    HostStats stats;
+    std::lock_guard<std::mutex> g(free_list_mutex_);
+    for (const auto i : c10::irange(kNumSizeClasses)) {
+      const auto& cls = size_classes_[i];
+      HostStats::SizeClassStats entry;
+      entry.block_size = static_cast<size_t>(1) << i;
+      entry.allocated_blocks =
+          cls.allocated_blocks.load(std::memory_order_relaxed);
+      entry.allocated_bytes =
+          cls.allocated_bytes.load(std::memory_order_relaxed);
+      entry.cached_blocks = cls.cached_blocks;
+      entry.cached_bytes = cls.cached_bytes;
+      if (entry.allocated_blocks == 0 && entry.cached_blocks == 0) {
+        continue;
+      }
+      stats.allocated_bytes += entry.allocated_bytes;
+      stats.cached_bytes += entry.cached_bytes;
+      stats.size_classes.push_back(entry);
+    }
+    stats.num_host_alloc = num_host_alloc_.load(std::memory_order_relaxed);
+    stats.num_host_free = num_host_free_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
  private:
   void process_events() {
     while (true) {
@@ -338,14 +435,72 @@ class CUDAHostAllocator {
       }
 
       if (available) {
-        std::lock_guard<std::mutex> g(free_list_mutex_);
+        cache_or_release(block);
+      }
+    }
+  }
+
+  // Parks a block on the free list, unless its size class is already at the
+  // cache limit, in which case the block is returned to the system.
+  void cache_or_release(Block* block) {
+    bool cached = true;
+    {
+      std::lock_guard<std::mutex> g(free_list_mutex_);
+      auto& cls = size_class_of(block);
+      const auto limit =
+          size_class_cache_limit_.load(std::memory_order_relaxed);
+      if (limit != 0 && cls.cached_bytes + block->size_ > limit) {
+        cached = false;
+      } else {
+        block->idle_since_ = std::chrono::steady_clock::now();
         free_list_.insert(block);
+        cls.cached_blocks += 1;
+        cls.cached_bytes += block->size_;
       }
     }
+    if (!cached) {
+      release_block(block);
+    }
+  }
+
+  // Returns a block to the system. The block must already be off the free
+  // list; cudaFreeHost happens outside any allocator mutex since it
+  // synchronizes with the device.
+  void release_block(Block* block) {
+    {
+      std::lock_guard<std::mutex> g(blocks_mutex_);
+      blocks_.erase(block);
+      ptr_to_block_.erase(block->ptr_);
+    }
+    AT_CUDA_CHECK(cudaFreeHost(block->ptr_));
+    num_host_free_.fetch_add(1, std::memory_order_relaxed);
+    delete block;
+  }
+
+  // Blocks are always power-of-two sized, so the class index is just the
+  // log2 of the block size.
+  static constexpr size_t kNumSizeClasses = 64;
+  struct SizeClass {
+    // Guarded by free_list_mutex_; mirrors the free list contents.
+    size_t cached_blocks{0};
+    size_t cached_bytes{0};
+    // Atomics: bumped on the allocate path and dropped on the free path,
+    // which run under different locks.
+    std::atomic<size_t> allocated_blocks{0};
+    std::atomic<size_t> allocated_bytes{0};
+  };
+
+  SizeClass& size_class_of(const Block* block) {
+    return size_classes_[c10::llvm::Log2_64_Ceil(block->size_)];
   }
 
   EventPool event_pool_;
 
+  std::array<SizeClass, kNumSizeClasses> size_classes_;
+  std::atomic<size_t> size_class_cache_limit_{0}; // 0 = unlimited
+  std::atomic<size_t> num_host_alloc_{0};
+  std::atomic<size_t> num_host_free_{0};
+
   alignas(64) std::mutex blocks_mutex_;
   std::unordered_set<Block*> blocks_;
   std::unordered_map<void*, Block*> ptr_to_block_;
@@ -384,6 +539,36 @@ void CachingHostAllocator_emptyCache() {
   getCUDAHostAllocator().empty_cache();
 }
 
+// Pre-populates the cache with `count` pinned blocks of at least `nbytes`
+// bytes each.  cudaHostAlloc serializes against all device work, so callers
+// that cycle through a fixed set of batch-sized slots (e.g. the DataLoader
+// pin-memory thread) can warm the cache once at startup and never stall the
+// GPU mid-iteration; afterwards the blocks recycle through the free list
+// like any other cached allocation.
+void CachingHostAllocator_preallocate(size_t nbytes, size_t count) {
+  auto& allocator = getCUDAHostAllocator();
+  std::vector<std::pair<void*, void*>> slots;
+  slots.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    slots.push_back(allocator.allocate(nbytes));
+  }
+  for (auto& slot : slots) {
+    allocator.free(slot.second);
+  }
+}
+
+HostStats CachingHostAllocator_getStats() {
+  return getCUDAHostAllocator().get_stats();
+}
+
+void CachingHostAllocator_setSizeClassCacheLimit(size_t bytes) {
+  getCUDAHostAllocator().set_size_class_cache_limit(bytes);
+}
+
+void CachingHostAllocator_trim(double max_idle_seconds) {
+  getCUDAHostAllocator().trim(max_idle_seconds);
+}
+
 struct CUDAHostAllocatorWrapper final : public at::Allocator {
   at::DataPtr allocate(size_t size) const override {
     auto ptr_and_ctx = getCUDAHostAllocator().allocate(size);
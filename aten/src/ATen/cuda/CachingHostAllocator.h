@@ -3,6 +3,9 @@
 #include <c10/core/Allocator.h>
 #include <c10/cuda/CUDAStream.h>
 
+#include <cstddef>
+#include <vector>
+
 namespace at {
 namespace cuda {
 
@@ -31,6 +34,51 @@ CachingHostAllocator_recordEvent(void* ptr, void* ctx, c10::cuda::CUDAStream str
 // Releases cached pinned memory allocations via cudaHostFree
 TORCH_CUDA_CPP_API void CachingHostAllocator_emptyCache();
 
+// Pre-populates the cache with `count` pinned blocks of at least `nbytes`
+// bytes each, so steady-state consumers cycling through batch-sized slots
+// (e.g. the DataLoader pin-memory thread) never hit cudaHostAlloc after
+// warm-up.
+TORCH_CUDA_CPP_API void CachingHostAllocator_preallocate(
+    size_t nbytes,
+    size_t count);
+
+// Summary statistics for the pinned memory cache. Every allocation is rounded
+// up to a power of two, so blocks fall into implicit power-of-two size
+// classes; `size_classes` lists only the classes that have seen traffic.
+struct HostStats {
+  struct SizeClassStats {
+    // Bytes per block in this class (a power of two).
+    size_t block_size{0};
+    // Blocks handed out to clients and not yet freed.
+    size_t allocated_blocks{0};
+    size_t allocated_bytes{0};
+    // Idle blocks parked on the free list, ready for reuse.
+    size_t cached_blocks{0};
+    size_t cached_bytes{0};
+  };
+  std::vector<SizeClassStats> size_classes;
+  size_t allocated_bytes{0};
+  size_t cached_bytes{0};
+  // Lifetime counts of cudaHostAlloc/cudaFreeHost calls.
+  size_t num_host_alloc{0};
+  size_t num_host_free{0};
+};
+
+TORCH_CUDA_CPP_API HostStats CachingHostAllocator_getStats();
+
+// Caps the bytes of idle pinned memory cached per size class. Blocks freed
+// while their class is at the cap are returned to the system instead of
+// cached. 0 (the default) means unlimited. The cap applies to blocks freed
+// after the call; use CachingHostAllocator_trim or
+// CachingHostAllocator_emptyCache to shrink an existing cache.
+TORCH_CUDA_CPP_API void CachingHostAllocator_setSizeClassCacheLimit(
+    size_t bytes);
+
+// Releases cached blocks that have sat idle on the free list for longer than
+// `max_idle_seconds`. Intended to be called periodically from a housekeeping
+// thread so long-lived processes keep a bounded pinned footprint.
+TORCH_CUDA_CPP_API void CachingHostAllocator_trim(double max_idle_seconds);
+
 inline TORCH_CUDA_CPP_API at::DataPtr HostAlloc(size_t size) {
   return getCachingHostAllocator()->allocate(size);
 }
@@ -0,0 +1,133 @@
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/DeferredLaunchBatcher.h>
+
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+// The batcher accumulating on this thread, if any. See
+// Note [Deferred launch batching].
+thread_local DeferredLaunchBatcher* current_batcher = nullptr;
+
+// Owned by the convenience wrappers below (Python bindings).
+thread_local std::unique_ptr<DeferredLaunchBatcher> tls_batcher;
+thread_local size_t tls_batcher_threshold = 0;
+
+} // namespace
+
+DeferredLaunchBatcher::DeferredLaunchBatcher(size_t flush_threshold)
+    : flush_threshold_(flush_threshold), mempool_id_(graph_pool_handle()) {
+  TORCH_CHECK(
+      flush_threshold_ > 0,
+      "DeferredLaunchBatcher flush_threshold must be positive, got ",
+      flush_threshold_);
+}
+
+DeferredLaunchBatcher::~DeferredLaunchBatcher() {
+  if (active_) {
+    // Don't leave a dangling capture poisoning the stream; submit what we
+    // have. Mirrors CUDAGraph's best-effort destructor behavior.
+    try {
+      flush();
+    } catch (const std::exception& e) {
+      TORCH_WARN(
+          "DeferredLaunchBatcher destroyed with an unflushable segment: ",
+          e.what());
+    }
+  }
+  // Make sure retired graph execs are no longer running before freeing them.
+  for (auto& segment : retired_) {
+    segment.done.synchronize();
+  }
+  if (current_batcher == this) {
+    current_batcher = nullptr;
+  }
+}
+
+DeferredLaunchBatcher* DeferredLaunchBatcher::current() {
+  return current_batcher;
+}
+
+void DeferredLaunchBatcher::begin() {
+  TORCH_CHECK(!active_, "This DeferredLaunchBatcher is already accumulating.");
+  TORCH_CHECK(
+      current_batcher == nullptr,
+      "Another DeferredLaunchBatcher is already accumulating on this thread.");
+  retire_completed_segments();
+  graph_ = std::make_unique<CUDAGraph>();
+  // All segments share this batcher's private mempool. Segments replay
+  // immediately and in capture order, so reusing the pool is safe and
+  // avoids reserving a fresh pool per flush.
+  graph_->capture_begin(mempool_id_);
+  pending_ops_ = 0;
+  active_ = true;
+  current_batcher = this;
+}
+
+void DeferredLaunchBatcher::flush() {
+  if (!active_) {
+    return;
+  }
+  active_ = false;
+  current_batcher = nullptr;
+  graph_->capture_end();
+  graph_->replay();
+  // The exec may still be running on the stream; park it behind an event
+  // instead of destroying it in flight.
+  RetiredSegment segment;
+  segment.done.record(getCurrentCUDAStream());
+  segment.graph = std::move(graph_);
+  retired_.push_back(std::move(segment));
+  pending_ops_ = 0;
+}
+
+void DeferredLaunchBatcher::note_op() {
+  if (!active_) {
+    return;
+  }
+  if (++pending_ops_ >= flush_threshold_) {
+    flush();
+    begin();
+  }
+}
+
+void DeferredLaunchBatcher::retire_completed_segments() {
+  retired_.erase(
+      std::remove_if(
+          retired_.begin(),
+          retired_.end(),
+          [](RetiredSegment& segment) { return segment.done.query(); }),
+      retired_.end());
+}
+
+void beginDeferredLaunchBatch(size_t flush_threshold) {
+  if (!tls_batcher || tls_batcher_threshold != flush_threshold) {
+    tls_batcher = std::make_unique<DeferredLaunchBatcher>(flush_threshold);
+    tls_batcher_threshold = flush_threshold;
+  }
+  tls_batcher->begin();
+}
+
+void noteDeferredLaunchOp() {
+  if (tls_batcher) {
+    tls_batcher->note_op();
+  }
+}
+
+void flushDeferredLaunchBatch() {
+  if (auto* batcher = DeferredLaunchBatcher::current()) {
+    batcher->flush();
+  }
+}
+
+bool deferredLaunchBatchActive() {
+  return DeferredLaunchBatcher::current() != nullptr;
+}
+
+} // namespace cuda
+} // namespace at
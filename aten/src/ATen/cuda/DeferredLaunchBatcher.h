@@ -0,0 +1,94 @@
+#pragma once
+
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/CUDAGraph.h>
+
+#include <memory>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+// Note [Deferred launch batching]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Sequences of tiny kernels are dominated by per-launch driver overhead.
+// Whole-model CUDA graph capture amortizes that cost, but requires static
+// control flow across the entire iteration. DeferredLaunchBatcher recovers
+// most of the benefit for dynamic workloads by capturing short *segments*
+// of work on the current thread's stream and submitting each segment as a
+// single graph launch:
+//
+//   at::cuda::DeferredLaunchBatcher batcher(/*flush_threshold=*/64);
+//   batcher.begin();
+//   ... enqueue small ops, calling batcher.note_op() after each ...
+//   batcher.flush();  // one cudaGraphLaunch for the whole segment
+//
+// note_op() rotates to a fresh segment automatically once flush_threshold
+// ops have accumulated, so arbitrarily long op sequences still submit in
+// bounded chunks. Sync entry points should call
+// DeferredLaunchBatcher::current()->flush() (the torch.cuda.synchronize
+// binding does) so batched work is actually submitted before blocking.
+//
+// The usual stream-capture restrictions apply between begin() and flush():
+// the current stream must be a non-default stream, and nothing may
+// synchronize with the host (e.g. Tensor::item()) since the captured work
+// has not executed yet. All segments from one batcher share a single
+// private memory pool (see Note [Interaction with CUDA graph capture] in
+// CUDACachingAllocator.cpp); this is safe because segments are replayed
+// immediately, in capture order.
+struct TORCH_CUDA_CPP_API DeferredLaunchBatcher {
+  explicit DeferredLaunchBatcher(size_t flush_threshold = 64);
+  ~DeferredLaunchBatcher();
+
+  DeferredLaunchBatcher(const DeferredLaunchBatcher&) = delete;
+  DeferredLaunchBatcher& operator=(const DeferredLaunchBatcher&) = delete;
+
+  // Begins accumulating work issued on the current thread's current stream.
+  // Only one batcher may be accumulating per thread.
+  void begin();
+
+  // Submits everything accumulated since begin() as a single graph launch.
+  // No-op if nothing is accumulating. The batcher is inactive afterwards;
+  // call begin() to start a new segment.
+  void flush();
+
+  // Records that one op was enqueued into the current segment; once
+  // flush_threshold ops have accumulated, submits the segment and begins a
+  // new one. No-op when not accumulating.
+  void note_op();
+
+  bool is_active() const {
+    return active_;
+  }
+
+  // The batcher currently accumulating on this thread, or nullptr. Sync
+  // entry points use this to flush pending work before blocking.
+  static DeferredLaunchBatcher* current();
+
+ private:
+  // Submitted segments whose graph execs may still be running on the
+  // stream; swept (and freed) once their completion events have fired.
+  struct RetiredSegment {
+    std::unique_ptr<CUDAGraph> graph;
+    CUDAEvent done;
+  };
+
+  void retire_completed_segments();
+
+  size_t flush_threshold_;
+  size_t pending_ops_ = 0;
+  bool active_ = false;
+  MempoolId_t mempool_id_;
+  std::unique_ptr<CUDAGraph> graph_;
+  std::vector<RetiredSegment> retired_;
+};
+
+// Convenience wrappers around a thread-local batcher, used by the Python
+// bindings (torch._C._cuda_beginDeferredLaunchBatch and friends).
+TORCH_CUDA_CPP_API void beginDeferredLaunchBatch(size_t flush_threshold);
+TORCH_CUDA_CPP_API void noteDeferredLaunchOp();
+TORCH_CUDA_CPP_API void flushDeferredLaunchBatch();
+TORCH_CUDA_CPP_API bool deferredLaunchBatchActive();
+
+} // namespace cuda
+} // namespace at
@@ -0,0 +1,140 @@
+#include <ATen/cuda/KernelLaunchTuner.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/util/Exception.h>
+#include <c10/util/env.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+struct DeviceDatabase {
+  bool loaded{false};
+  // Empty when no writable location is available; entries then live in
+  // memory only.
+  std::string path;
+  std::unordered_map<std::string, int64_t> entries;
+};
+
+std::mutex& tuner_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// Leaky singleton so lookups stay valid during static destruction at exit,
+// following the workspace map in WorkspacePool.cpp.
+std::vector<DeviceDatabase>& databases() {
+  static auto& instance =
+      *new std::vector<DeviceDatabase>(c10::cuda::device_count());
+  return instance;
+}
+
+std::string database_dir() {
+  const char* dir = std::getenv("TORCH_CUDA_KERNEL_TUNING_DB");
+  if (dir != nullptr) {
+    return dir;
+  }
+  const char* home = std::getenv("HOME");
+  if (home != nullptr) {
+    return std::string(home) + "/.cache/torch/kernel_tuning";
+  }
+  return "";
+}
+
+// Keys and device names become tokens in a whitespace-separated file
+// format, so squash any whitespace they contain.
+std::string sanitize(const std::string& s) {
+  std::string out = s;
+  for (auto& c : out) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  return out;
+}
+
+// Must be called with tuner_mutex() held.
+DeviceDatabase& load_database(DeviceIndex device) {
+  auto& db = databases().at(device);
+  if (db.loaded) {
+    return db;
+  }
+  db.loaded = true;
+  const std::string dir = database_dir();
+  if (!dir.empty()) {
+    cudaDeviceProp* prop = getDeviceProperties(device);
+    std::ostringstream path;
+    path << dir << '/' << sanitize(prop->name) << "_sm" << prop->major
+         << prop->minor << ".tune";
+    db.path = path.str();
+    std::ifstream file(db.path);
+    std::string key;
+    int64_t value = 0;
+    while (file >> key >> value) {
+      db.entries[key] = value;
+    }
+  }
+  return db;
+}
+
+DeviceIndex current_device() {
+  int device = 0;
+  AT_CUDA_CHECK(c10::cuda::GetDevice(&device));
+  return static_cast<DeviceIndex>(device);
+}
+
+} // namespace
+
+bool isKernelTuningEnabled() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_CUDA_KERNEL_TUNING") == true;
+  return enabled;
+}
+
+c10::optional<int64_t> lookupTunedValue(const std::string& key) {
+  const auto device = current_device();
+  std::lock_guard<std::mutex> lock(tuner_mutex());
+  auto& db = load_database(device);
+  auto it = db.entries.find(sanitize(key));
+  if (it == db.entries.end()) {
+    return c10::nullopt;
+  }
+  return it->second;
+}
+
+void recordTunedValue(const std::string& key, int64_t value) {
+  const auto device = current_device();
+  std::lock_guard<std::mutex> lock(tuner_mutex());
+  auto& db = load_database(device);
+  const std::string skey = sanitize(key);
+  if (!db.entries.emplace(skey, value).second) {
+    return;
+  }
+  if (db.path.empty()) {
+    return;
+  }
+  std::ofstream file(db.path, std::ios::app);
+  if (!file) {
+    TORCH_WARN_ONCE(
+        "TORCH_CUDA_KERNEL_TUNING: cannot write to ",
+        db.path,
+        "; tuned launch parameters will not persist across processes. "
+        "Create the directory or point TORCH_CUDA_KERNEL_TUNING_DB at a "
+        "writable one.");
+    db.path.clear();
+    return;
+  }
+  file << skey << ' ' << value << '\n';
+}
+
+} // namespace cuda
+} // namespace at
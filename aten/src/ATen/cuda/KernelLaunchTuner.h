@@ -0,0 +1,40 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <c10/util/Optional.h>
+
+#include <cstdint>
+#include <string>
+
+namespace at {
+namespace cuda {
+
+// A persistent per-device database of tuned kernel launch parameters.
+//
+// Built-in launch heuristics (e.g. the reduction configuration in
+// Reduce.cuh) are tuned for a handful of architectures and can be off on
+// newer parts. When TORCH_CUDA_KERNEL_TUNING=1 is set, callers may
+// benchmark a few candidate configurations on the first execution of a
+// (kernel, shape-class) pair and record the winner here; later executions
+// — including later processes — load it instead of re-measuring.
+//
+// Entries are keyed by an arbitrary caller-chosen string and scoped to the
+// current device's (name, compute capability) pair, so a database written
+// on one GPU model is never applied to another. Results are persisted to
+// one file per device model under TORCH_CUDA_KERNEL_TUNING_DB (default
+// $HOME/.cache/torch/kernel_tuning); the directory must exist, otherwise
+// results are kept in memory for the lifetime of the process only.
+
+// Whether TORCH_CUDA_KERNEL_TUNING=1 is set.
+TORCH_CUDA_CPP_API bool isKernelTuningEnabled();
+
+// Look up the tuned value recorded for `key` on the current device, if any.
+TORCH_CUDA_CPP_API c10::optional<int64_t> lookupTunedValue(
+    const std::string& key);
+
+// Record `value` as the tuned result for `key` on the current device and
+// append it to the on-disk database.
+TORCH_CUDA_CPP_API void recordTunedValue(const std::string& key, int64_t value);
+
+} // namespace cuda
+} // namespace at
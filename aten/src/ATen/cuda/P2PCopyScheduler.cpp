@@ -0,0 +1,243 @@
+#include <ATen/cuda/P2PCopyScheduler.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/PeerToPeerAccess.h>
+#include <ATen/Functions.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+// Transfers below this size are not worth splitting across streams.
+constexpr int64_t kSplitThresholdBytes = 4 * 1024 * 1024;
+// Chunks are aligned down to this many bytes.
+constexpr int64_t kChunkAlignment = 512;
+constexpr int kMaxChannels = 4;
+
+struct SchedulerState {
+  std::mutex mutex;
+  std::map<std::pair<int, int>, P2PLinkStats> link_stats;
+  // Pinned staging buffers still owned by an in-flight staged copy,
+  // parked behind the event recorded after the host-to-device leg.
+  std::vector<std::pair<Tensor, CUDAEvent>> pending_staging;
+};
+
+SchedulerState& state() {
+  static auto* s = new SchedulerState();
+  return *s;
+}
+
+void record_transfer_locked(
+    int src_dev,
+    int dst_dev,
+    int64_t direct_bytes,
+    int64_t staged_bytes) {
+  auto& stats = state().link_stats[{src_dev, dst_dev}];
+  stats.src_device = src_dev;
+  stats.dst_device = dst_dev;
+  stats.direct_bytes += direct_bytes;
+  stats.staged_bytes += staged_bytes;
+  stats.transfers += 1;
+}
+
+void sweep_staging_locked() {
+  auto& pending = state().pending_staging;
+  pending.erase(
+      std::remove_if(
+          pending.begin(),
+          pending.end(),
+          [](std::pair<Tensor, CUDAEvent>& entry) {
+            return entry.second.query();
+          }),
+      pending.end());
+}
+
+// More channels for better-connected pairs: performance rank 0 is the
+// fastest route the driver knows about (e.g. multiple NVLinks).
+int num_channels_for(int src_dev, int dst_dev, int64_t nbytes) {
+  if (nbytes < kSplitThresholdBytes) {
+    return 1;
+  }
+  const int rank = p2p_performance_rank(src_dev, dst_dev);
+  if (rank < 0) {
+    return 1;
+  }
+  return std::max(1, kMaxChannels >> std::min(rank, 2));
+}
+
+void direct_copy(
+    const Tensor& dst,
+    const Tensor& src,
+    int dst_dev,
+    int src_dev,
+    int64_t nbytes) {
+  auto src_stream = getCurrentCUDAStream(src_dev);
+  auto dst_stream = getCurrentCUDAStream(dst_dev);
+
+  CUDAEvent src_ready;
+  src_ready.record(src_stream);
+
+  const int channels = num_channels_for(src_dev, dst_dev, nbytes);
+  int64_t chunk = (nbytes + channels - 1) / channels;
+  chunk = std::max<int64_t>(
+      (chunk + kChunkAlignment - 1) / kChunkAlignment * kChunkAlignment,
+      kChunkAlignment);
+
+  auto* src_ptr = static_cast<const char*>(src.const_data_ptr());
+  auto* dst_ptr = static_cast<char*>(dst.data_ptr());
+
+  at::cuda::CUDAGuard device_guard(dst_dev);
+  int64_t offset = 0;
+  for (const auto i : c10::irange(channels)) {
+    (void)i;
+    if (offset >= nbytes) {
+      break;
+    }
+    const int64_t this_chunk = std::min(chunk, nbytes - offset);
+    auto channel_stream = getStreamFromPool(
+        /*isHighPriority=*/false, static_cast<DeviceIndex>(dst_dev));
+    src_ready.block(channel_stream);
+    C10_CUDA_CHECK(cudaMemcpyPeerAsync(
+        dst_ptr + offset,
+        dst_dev,
+        src_ptr + offset,
+        src_dev,
+        this_chunk,
+        channel_stream.stream()));
+    CUDAEvent done;
+    done.record(channel_stream);
+    // Order later work (including frees) on both tensors' streams after
+    // the transfer.
+    done.block(dst_stream);
+    done.block(src_stream);
+    offset += this_chunk;
+  }
+}
+
+void staged_copy(
+    const Tensor& dst,
+    const Tensor& src,
+    int dst_dev,
+    int src_dev,
+    int64_t nbytes) {
+  auto src_stream = getCurrentCUDAStream(src_dev);
+  auto dst_stream = getCurrentCUDAStream(dst_dev);
+
+  auto staging = at::empty(
+      {nbytes},
+      at::TensorOptions().dtype(at::kByte).pinned_memory(true));
+
+  {
+    at::cuda::CUDAGuard device_guard(src_dev);
+    C10_CUDA_CHECK(cudaMemcpyAsync(
+        staging.data_ptr(),
+        src.const_data_ptr(),
+        nbytes,
+        cudaMemcpyDeviceToHost,
+        src_stream.stream()));
+  }
+  CUDAEvent d2h_done;
+  d2h_done.record(src_stream);
+  d2h_done.block(dst_stream);
+  {
+    at::cuda::CUDAGuard device_guard(dst_dev);
+    C10_CUDA_CHECK(cudaMemcpyAsync(
+        dst.data_ptr(),
+        staging.const_data_ptr(),
+        nbytes,
+        cudaMemcpyHostToDevice,
+        dst_stream.stream()));
+  }
+  CUDAEvent h2d_done;
+  h2d_done.record(dst_stream);
+
+  std::lock_guard<std::mutex> lock(state().mutex);
+  sweep_staging_locked();
+  state().pending_staging.emplace_back(
+      std::move(staging), std::move(h2d_done));
+}
+
+} // namespace
+
+int p2p_performance_rank(int src_dev, int dst_dev) {
+  if (src_dev == dst_dev) {
+    return 0;
+  }
+  int supported = 0;
+  C10_CUDA_CHECK(cudaDeviceGetP2PAttribute(
+      &supported, cudaDevP2PAttrAccessSupported, src_dev, dst_dev));
+  if (!supported) {
+    return -1;
+  }
+  int rank = 0;
+  C10_CUDA_CHECK(cudaDeviceGetP2PAttribute(
+      &rank, cudaDevP2PAttrPerformanceRank, src_dev, dst_dev));
+  return rank;
+}
+
+void p2p_copy(const Tensor& dst, const Tensor& src) {
+  TORCH_CHECK(
+      dst.is_cuda() && src.is_cuda(),
+      "p2p_copy: both tensors must be CUDA tensors");
+  TORCH_CHECK(
+      dst.scalar_type() == src.scalar_type() && dst.sizes() == src.sizes(),
+      "p2p_copy: tensors must have identical dtype and shape");
+  TORCH_CHECK(
+      dst.is_contiguous() && src.is_contiguous(),
+      "p2p_copy: tensors must be contiguous");
+  const int dst_dev = dst.get_device();
+  const int src_dev = src.get_device();
+  TORCH_CHECK(
+      dst_dev != src_dev,
+      "p2p_copy: tensors must live on different devices");
+
+  const int64_t nbytes = src.numel() * src.element_size();
+  if (nbytes == 0) {
+    return;
+  }
+
+  const bool direct = get_p2p_access(dst_dev, src_dev) &&
+      get_p2p_access(src_dev, dst_dev);
+  if (direct) {
+    direct_copy(dst, src, dst_dev, src_dev, nbytes);
+  } else {
+    staged_copy(dst, src, dst_dev, src_dev, nbytes);
+  }
+
+  std::lock_guard<std::mutex> lock(state().mutex);
+  record_transfer_locked(
+      src_dev,
+      dst_dev,
+      direct ? nbytes : 0,
+      direct ? 0 : nbytes);
+}
+
+std::vector<P2PLinkStats> p2p_copy_stats() {
+  std::lock_guard<std::mutex> lock(state().mutex);
+  std::vector<P2PLinkStats> result;
+  result.reserve(state().link_stats.size());
+  for (const auto& entry : state().link_stats) {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+void reset_p2p_copy_stats() {
+  std::lock_guard<std::mutex> lock(state().mutex);
+  state().link_stats.clear();
+}
+
+} // namespace cuda
+} // namespace at
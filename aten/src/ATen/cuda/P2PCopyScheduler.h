@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+// Note [P2P copy scheduler]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// PeerToPeerAccess.cpp only tracks whether peer access is enabled; the
+// default copy path issues a single peer copy per transfer and ignores
+// the link topology, which leaves NVLink bandwidth on the table for
+// model-parallel activation passing. The scheduler below routes a
+// device-to-device tensor copy explicitly:
+//
+//  - when peer access is available in both directions, the transfer goes
+//    over the direct route, and large transfers are split into chunks
+//    issued on multiple pool streams of the destination device so
+//    several copy engines can run concurrently. The chunk count scales
+//    with the pair's cudaDevP2PAttrPerformanceRank, so well-connected
+//    (NVLink) pairs get more channels than PCIe pairs;
+//  - otherwise the transfer is staged through a pinned host buffer
+//    (device-to-host on the source stream, host-to-device on the
+//    destination stream), with the buffer parked until the copy is
+//    observed complete.
+//
+// Both current streams are made to wait on the transfer, so ordinary
+// stream-ordered reuse and freeing of either tensor stays safe. Per
+// device pair, byte and transfer counters are kept so utilization of
+// each link can be inspected.
+
+// Byte/transfer counters for one directed device pair.
+struct TORCH_CUDA_CPP_API P2PLinkStats {
+  int src_device = -1;
+  int dst_device = -1;
+  int64_t direct_bytes = 0;
+  int64_t staged_bytes = 0;
+  int64_t transfers = 0;
+};
+
+// Copies `src` into `dst` (both contiguous CUDA tensors of identical
+// shape and dtype on different devices) along the best available route.
+// Asynchronous with respect to the caller; ordered against the current
+// streams of both devices.
+TORCH_CUDA_CPP_API void p2p_copy(const Tensor& dst, const Tensor& src);
+
+// Performance rank of the link from `src_dev` to `dst_dev` as reported
+// by cudaDeviceGetP2PAttribute; lower is faster. Returns -1 when peer
+// access between the pair is unsupported.
+TORCH_CUDA_CPP_API int p2p_performance_rank(int src_dev, int dst_dev);
+
+// Snapshot of all per-link counters, sorted by (src, dst).
+TORCH_CUDA_CPP_API std::vector<P2PLinkStats> p2p_copy_stats();
+
+TORCH_CUDA_CPP_API void reset_p2p_copy_stats();
+
+} // namespace cuda
+} // namespace at
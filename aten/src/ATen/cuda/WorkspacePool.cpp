@@ -0,0 +1,122 @@
+#include <ATen/cuda/WorkspacePool.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAStream.h>
+#include <c10/util/env.h>
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace at {
+namespace cuda {
+
+namespace {
+
+struct WorkspaceEntry {
+  at::DataPtr buffer;
+  size_t capacity{0};
+  size_t high_watermark{0};
+  // Largest request since the last trim check; lets us shrink buffers that
+  // were sized by a one-off spike (e.g. an unusually large convolution).
+  size_t recent_max{0};
+  uint64_t requests_since_trim{0};
+};
+
+// How many requests to observe between trim checks.
+constexpr uint64_t kTrimInterval = 1024;
+
+std::mutex& pool_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// Leaky singleton so the pool outlives CUDA teardown at exit, following
+// the cuBLAS workspace map in CublasHandlePool.cpp.
+std::map<std::pair<int, void*>, WorkspaceEntry>& pool() {
+  static auto& instance = *new std::map<std::pair<int, void*>, WorkspaceEntry>;
+  return instance;
+}
+
+} // namespace
+
+bool isWorkspacePoolEnabled() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_CUDNN_WORKSPACE_POOL") == true;
+  return enabled;
+}
+
+at::DataPtr allocateWorkspace(size_t nbytes) {
+  if (!isWorkspacePoolEnabled()) {
+    return c10::cuda::CUDACachingAllocator::get()->allocate(nbytes);
+  }
+  int device = 0;
+  AT_CUDA_CHECK(c10::cuda::GetDevice(&device));
+  cudaStream_t stream = c10::cuda::getCurrentCUDAStream();
+
+  std::lock_guard<std::mutex> lock(pool_mutex());
+  auto& entry = pool()[std::make_pair(device, static_cast<void*>(stream))];
+  entry.high_watermark = std::max(entry.high_watermark, nbytes);
+  entry.recent_max = std::max(entry.recent_max, nbytes);
+
+  // Trim before (possibly) growing so we never release the buffer we are
+  // about to hand out.
+  if (++entry.requests_since_trim >= kTrimInterval) {
+    if (entry.recent_max * 2 <= entry.capacity) {
+      // shrink lazily: drop the buffer; the check below re-allocates it at
+      // the size of the current request
+      entry.buffer = at::DataPtr();
+      entry.capacity = 0;
+    }
+    entry.recent_max = nbytes;
+    entry.requests_since_trim = 0;
+  }
+
+  if (nbytes > entry.capacity) {
+    // Release before allocating so the old buffer's memory is available
+    // for the larger request.
+    entry.buffer = at::DataPtr();
+    entry.capacity = 0;
+    entry.buffer = c10::cuda::CUDACachingAllocator::get()->allocate(nbytes);
+    entry.capacity = nbytes;
+  }
+
+  // Non-owning alias; the pooled buffer stays alive in the map. Safe as
+  // long as each stream is driven from one thread at a time, the same
+  // assumption the cuBLAS per-stream workspace makes.
+  return at::DataPtr(
+      entry.buffer.get(), at::Device(at::kCUDA, static_cast<int8_t>(device)));
+}
+
+void trimWorkspacePool() {
+  std::lock_guard<std::mutex> lock(pool_mutex());
+  for (auto& kv : pool()) {
+    kv.second.buffer = at::DataPtr();
+    kv.second.capacity = 0;
+    kv.second.recent_max = 0;
+    kv.second.requests_since_trim = 0;
+  }
+}
+
+void emptyWorkspacePool() {
+  std::lock_guard<std::mutex> lock(pool_mutex());
+  pool().clear();
+}
+
+std::vector<WorkspaceStat> getWorkspacePoolStats() {
+  std::lock_guard<std::mutex> lock(pool_mutex());
+  std::vector<WorkspaceStat> stats;
+  stats.reserve(pool().size());
+  for (const auto& kv : pool()) {
+    stats.push_back(WorkspaceStat{
+        kv.first.first,
+        kv.first.second,
+        kv.second.capacity,
+        kv.second.high_watermark});
+  }
+  return stats;
+}
+
+} // namespace cuda
+} // namespace at
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Export.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace at {
+namespace cuda {
+
+// A pool of long-lived workspace buffers keyed by (device, stream), meant
+// for per-call scratch space such as cuDNN convolution workspaces. Work
+// submitted to a stream executes in order, so a single buffer per stream
+// can be handed out repeatedly without synchronization; reusing it avoids
+// the caching-allocator churn (and the synchronizing frees it can trigger
+// under memory pressure) of allocating a fresh workspace per call.
+//
+// The pool is opt-in via TORCH_CUDNN_WORKSPACE_POOL=1. When disabled,
+// allocateWorkspace simply forwards to the CUDA caching allocator and
+// returns an owning DataPtr; when enabled it returns a non-owning alias of
+// the pooled buffer, which grows to fit the largest request and is trimmed
+// back when the recent high-watermark stays well below capacity.
+
+struct WorkspaceStat {
+  int device;
+  void* stream;
+  // bytes currently held by the pooled buffer
+  size_t capacity;
+  // largest request observed since the entry was created
+  size_t high_watermark;
+};
+
+// Whether TORCH_CUDNN_WORKSPACE_POOL=1 is set.
+TORCH_CUDA_CPP_API bool isWorkspacePoolEnabled();
+
+// Get a workspace of at least `nbytes` for the current device and stream.
+// Throws c10::OutOfMemoryError like the caching allocator on failure.
+TORCH_CUDA_CPP_API at::DataPtr allocateWorkspace(size_t nbytes);
+
+// Release all pooled buffers, keeping per-stream statistics. Buffers are
+// re-allocated lazily on the next request.
+TORCH_CUDA_CPP_API void trimWorkspacePool();
+
+// Release all pooled buffers and statistics.
+TORCH_CUDA_CPP_API void emptyWorkspacePool();
+
+// Introspection: one entry per (device, stream) seen so far.
+TORCH_CUDA_CPP_API std::vector<WorkspaceStat> getWorkspacePoolStats();
+
+} // namespace cuda
+} // namespace at
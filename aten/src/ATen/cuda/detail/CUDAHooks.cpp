@@ -182,6 +182,10 @@ bool CUDAHooks::hasCuSOLVER() const {
 #endif
 }
 
+bool CUDAHooks::hasCuSPARSELt() const {
+  return AT_CUSPARSELT_ENABLED();
+}
+
 bool CUDAHooks::hasROCM() const {
   // Currently, this is same as `compiledWithMIOpen`.
   // But in future if there are ROCm builds without MIOpen,
@@ -424,6 +428,14 @@ int64_t CUDAHooks::cuFFTGetPlanCacheSize(int64_t device_index) const {
   return at::native::detail::cufft_get_plan_cache_size_impl(device_index);
 }
 
+int64_t CUDAHooks::cuFFTGetPlanCacheHits(int64_t device_index) const {
+  return at::native::detail::cufft_get_plan_cache_hits_impl(device_index);
+}
+
+int64_t CUDAHooks::cuFFTGetPlanCacheMisses(int64_t device_index) const {
+  return at::native::detail::cufft_get_plan_cache_misses_impl(device_index);
+}
+
 void CUDAHooks::cuFFTClearPlanCache(int64_t device_index) const {
   at::native::detail::cufft_clear_plan_cache_impl(device_index);
 }
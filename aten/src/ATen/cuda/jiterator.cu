@@ -12,6 +12,48 @@
 namespace at {
 namespace native {
 
+// In-process kernel caches, shared between the launch paths below and
+// PrewarmKernel so that pre-warmed kernels are found on first launch.
+static std::mutex _jiterator_mutex;
+static std::unordered_map<std::string, at::cuda::jit::NvrtcFunction> vectorized_fns;
+static std::unordered_map<std::string, at::cuda::jit::NvrtcFunction> unrolled_fns;
+
+// The cache key includes all the parameters to generate_code + vec_size + dev_idx
+static std::string vectorized_cache_key(
+    int nInputs, int nOutputs, const std::string& f,
+    const std::string& f_inputs_type_str, const std::string& compute_type_str,
+    const std::string& result_type_str,
+    const c10::SmallVector<std::string>& extra_args_types,
+    int vec_size, DeviceIndex dev_idx) {
+  std::stringstream ss;
+  ss << nInputs << "_" << nOutputs << f;
+  ss << f_inputs_type_str << compute_type_str << result_type_str;
+  ss << static_cast<int>(at::cuda::jit::BinaryFuncVariant::NoScalar);
+  ss << extra_args_types;
+  ss << vec_size;
+// DeviceIndex, e.g. int8_t, is not treated as a number by the stream, cast to int as a workaround
+  ss << static_cast<int>(dev_idx);
+  return ss.str();
+}
+
+// The cache key includes all the parameters to generate_code + dev_idx
+static std::string unrolled_cache_key(
+    int nInputs, int nOutputs, const std::string& f,
+    const std::string& f_inputs_type_str, const std::string& compute_type_str,
+    const std::string& result_type_str,
+    bool contiguous, bool dynamic_casting,
+    const c10::SmallVector<std::string>& extra_args_types,
+    DeviceIndex dev_idx) {
+  std::stringstream ss;
+  ss << nInputs << "_" << nOutputs << f;
+  ss << f_inputs_type_str << compute_type_str << result_type_str;
+  ss << contiguous << dynamic_casting;
+  ss << static_cast<int>(at::cuda::jit::BinaryFuncVariant::NoScalar);
+  ss << extra_args_types;
+  ss << dev_idx;
+  return ss.str();
+}
+
 static inline void launch_jitted_vectorized_kernel_dynamic(
   const std::string& name, TensorIteratorBase& iter,
   DeviceIndex dev_idx, int64_t N, const std::string& f, void* data_ptr,
@@ -36,20 +78,11 @@ static inline void launch_jitted_vectorized_kernel_dynamic(
   std::string result_type_str = at::cuda::jit::typeName(common_dtype);
   c10::SmallVector<std::string> extra_args_types = get_extra_args_typenames(extra_args);
 
-  // The cache key includes all the parameters to generate_code + vec_size + dev_idx
-  std::stringstream ss;
-  ss << nInputs << "_" << nOutputs << f;
-  ss << f_inputs_type_str << compute_type_str << result_type_str;
-  ss << static_cast<int>(at::cuda::jit::BinaryFuncVariant::NoScalar);
-  ss << extra_args_types;
-  ss << vec_size;
-// DeviceIndex, e.g. int8_t, is not treated as a number by the stream, cast to int as a workaround
-  ss << static_cast<int>(dev_idx);
-  const std::string cache_key = ss.str();
+  const std::string cache_key = vectorized_cache_key(
+      nInputs, nOutputs, f, f_inputs_type_str, compute_type_str,
+      result_type_str, extra_args_types, vec_size, dev_idx);
 
-  static std::mutex _jiterator_mutex;
-  static std::unordered_map<std::string, at::cuda::jit::NvrtcFunction> fns;
-  at::cuda::jit::NvrtcFunction* fn_ptr = &fns[cache_key];
+  at::cuda::jit::NvrtcFunction* fn_ptr = &vectorized_fns[cache_key];
 
   if (!fn_ptr->function) {
     const std::lock_guard<std::mutex> lock{_jiterator_mutex};
@@ -133,20 +166,11 @@ static inline void launch_jitted_unrolled_kernel_dynamic(
   std::string result_type_str = at::cuda::jit::typeName(common_dtype);
   c10::SmallVector<std::string> extra_args_types = get_extra_args_typenames(extra_args);
 
-  // The cache key includes all the parameters to generate_code + dev_idx
-  std::stringstream ss;
-  ss << nInputs << "_" << nOutputs << f;
-  ss << f_inputs_type_str << compute_type_str << result_type_str;
-  ss << contiguous << dynamic_casting;
-  ss << static_cast<int>(at::cuda::jit::BinaryFuncVariant::NoScalar);
-  ss << extra_args_types;
-  ss << dev_idx;
-  const std::string cache_key = ss.str();
-
-  static std::mutex _jiterator_mutex;
-  static std::unordered_map<std::string, at::cuda::jit::NvrtcFunction> fns;
+  const std::string cache_key = unrolled_cache_key(
+      nInputs, nOutputs, f, f_inputs_type_str, compute_type_str,
+      result_type_str, contiguous, dynamic_casting, extra_args_types, dev_idx);
 
-  at::cuda::jit::NvrtcFunction* fn_ptr = &fns[cache_key];
+  at::cuda::jit::NvrtcFunction* fn_ptr = &unrolled_fns[cache_key];
   if (!fn_ptr->function) {
     const std::lock_guard<std::mutex> lock{_jiterator_mutex};
     if (!fn_ptr->function) {
@@ -314,6 +338,67 @@ void jitted_gpu_kernel_dynamic(
   jitted_gpu_kernel_dynamic_impl(kernel_name, iter, f, needs_dynamic_casting, extra_args, return_by_ref);
 }
 
+// Compiles (or loads from the on-disk kernel cache) the kernels the launch
+// paths above would otherwise build on first use for the given input dtype,
+// and stores them in the in-process caches under the same keys the
+// launchers compute.
+static void jitted_gpu_kernel_dynamic_prewarm(
+    const std::string& kernel_name,
+    const std::string& f,
+    int nInputs,
+    int nOutputs,
+    at::ScalarType common_dtype,
+    DeviceIndex dev_idx,
+    const c10::SmallVector<std::string>& extra_args_types,
+    bool return_by_ref) {
+  std::string f_inputs_type_str = at::cuda::jit::typeName(common_dtype);
+  std::string compute_type_str = at::cuda::jit::typeName(toOpMathType(common_dtype));
+  std::string result_type_str = at::cuda::jit::typeName(common_dtype);
+
+  // Contiguous launches pick a vector width at runtime based on pointer
+  // alignment, so compile every width the launcher can choose.
+  for (int vec_size : {4, 2, 1}) {
+    const bool vectorized = vec_size > 1;
+    const std::string cache_key = vectorized_cache_key(
+        nInputs, nOutputs, f, f_inputs_type_str, compute_type_str,
+        result_type_str, extra_args_types, vec_size, dev_idx);
+    const std::lock_guard<std::mutex> lock{_jiterator_mutex};
+    at::cuda::jit::NvrtcFunction* fn_ptr = &vectorized_fns[cache_key];
+    if (fn_ptr->function) {
+      continue;
+    }
+    auto code = at::cuda::jit::generate_code(nInputs, nOutputs, f, kernel_name,
+                                             f_inputs_type_str, compute_type_str, result_type_str,
+                                             /*contiguous=*/true, /*dynamic_casting=*/false,
+                                             at::cuda::jit::BinaryFuncVariant::NoScalar,
+                                             extra_args_types,
+                                             vectorized, vec_size,
+                                             return_by_ref);
+    std::string name = vectorized ? kernel_name + "_vectorized" + std::to_string(vec_size) : kernel_name;
+    *fn_ptr = at::cuda::jit::jit_pwise_function(code, name);
+  }
+
+  // Noncontiguous inputs take the unrolled kernel instead. Dynamic-casting
+  // variants depend on the concrete input/output dtype mix at the call site
+  // and are not pre-warmed.
+  {
+    const std::string cache_key = unrolled_cache_key(
+        nInputs, nOutputs, f, f_inputs_type_str, compute_type_str,
+        result_type_str, /*contiguous=*/false, /*dynamic_casting=*/false,
+        extra_args_types, dev_idx);
+    const std::lock_guard<std::mutex> lock{_jiterator_mutex};
+    at::cuda::jit::NvrtcFunction* fn_ptr = &unrolled_fns[cache_key];
+    if (!fn_ptr->function) {
+      auto code = at::cuda::jit::generate_code(nInputs, nOutputs, f, kernel_name,
+                                               f_inputs_type_str, compute_type_str, result_type_str,
+                                               /*contiguous=*/false, /*dynamic_casting=*/false,
+                                               at::cuda::jit::BinaryFuncVariant::NoScalar,
+                                               extra_args_types, /*vectorized*/false, /*vec_size*/0, return_by_ref);
+      *fn_ptr = at::cuda::jit::jit_pwise_function(code, kernel_name);
+    }
+  }
+}
+
 } // namespace native
 
 namespace cuda {
@@ -354,6 +439,24 @@ c10::SmallVector<at::Tensor> CompileAndLaunchKernel(
   return outputs;
 }
 
+void PrewarmKernel(
+  const std::string& code_string,
+  const std::string& kernel_name,
+  const int num_inputs,
+  const int num_outputs,
+  const c10::SmallVector<at::ScalarType>& dtypes,
+  const c10::SmallVector<at::Scalar>& extra_args,
+  bool return_by_ref) {
+
+  const auto dev_idx = c10::cuda::current_device();
+  c10::SmallVector<std::string> extra_args_types = at::native::get_extra_args_typenames(extra_args);
+  for (const auto& dtype : dtypes) {
+    at::native::jitted_gpu_kernel_dynamic_prewarm(
+        kernel_name, code_string, num_inputs, num_outputs,
+        dtype, dev_idx, extra_args_types, return_by_ref);
+  }
+}
+
 }} // namespace at::cuda
 
 #endif // AT_USE_JITERATOR()
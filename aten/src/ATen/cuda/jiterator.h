@@ -21,6 +21,19 @@ TORCH_CUDA_CPP_API c10::SmallVector<at::Tensor> CompileAndLaunchKernel(
   const c10::SmallVector<at::Scalar>& extra_args,
   bool return_by_ref);
 
+// Compiles the kernels CompileAndLaunchKernel would build lazily for the
+// given input dtypes on the current device, so that the first call pays
+// neither NVRTC compilation nor, when the on-disk kernel cache is enabled,
+// anything beyond loading the cached cubin.
+TORCH_CUDA_CPP_API void PrewarmKernel(
+  const std::string& code_string,
+  const std::string& kernel_name,
+  const int num_inputs,
+  const int num_outputs,
+  const c10::SmallVector<at::ScalarType>& dtypes,
+  const c10::SmallVector<at::Scalar>& extra_args,
+  bool return_by_ref);
+
 }} // namespace at::cuda
 
 #else
@@ -35,6 +48,17 @@ TORCH_CUDA_CPP_API c10::SmallVector<at::Tensor> CompileAndLaunchKernel(
   bool return_by_ref) {
     TORCH_CHECK(false, "Jiterator is not supported");
   }
+
+TORCH_CUDA_CPP_API void PrewarmKernel(
+  const std::string& code_string,
+  const std::string& kernel_name,
+  const int num_inputs,
+  const int num_outputs,
+  const c10::SmallVector<at::ScalarType>& dtypes,
+  const c10::SmallVector<at::Scalar>& extra_args,
+  bool return_by_ref) {
+    TORCH_CHECK(false, "Jiterator is not supported");
+  }
 }} // namespace at::cuda
 
 #endif // AT_USE_JITERATOR()
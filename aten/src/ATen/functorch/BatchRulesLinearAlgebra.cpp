@@ -487,6 +487,157 @@ pinv_batch_rule(
     const c10::optional<int64_t> rtol_bdim, bool hermitian) {
   return atol_rtol_tensor_batch_rule(ATEN_FN2(linalg_pinv, atol_rtol_tensor), input, input_bdim, atol, atol_bdim, rtol, rtol_bdim, hermitian, "linalg.pinv");
 }
+
+// Batch rules for the fused scaled dot product attention kernels.
+// The fused kernels take [batch, num_heads, seq_len, head_dim] inputs, so
+// the vmap dim folds into the kernel's own batch dimension and back out of
+// the batched outputs. Auxiliary outputs (the dense-path cum_seq
+// placeholders and the philox RNG state) are never batched and pass
+// through untouched. Without these rules the fused ops hit the slow
+// per-example fallback loop, which dominates per-sample-gradient
+// workloads over transformer blocks.
+
+static Tensor fold_bdim_into_batch(
+    const Tensor& tensor, optional<int64_t> bdim, int64_t batch_size) {
+  auto tensor_ = moveBatchDimToFront(tensor, bdim);
+  tensor_ = ensure_has_bdim(tensor_, bdim.has_value(), batch_size);
+  return tensor_.flatten(0, 1);
+}
+
+static twoOutputs _scaled_dot_product_efficient_attention_batch_rule(
+    const Tensor& query, optional<int64_t> query_bdim,
+    const Tensor& key, optional<int64_t> key_bdim,
+    const Tensor& value, optional<int64_t> value_bdim,
+    bool compute_log_sumexp,
+    bool is_causal,
+    c10::optional<double> scale) {
+  const auto batch_size = get_bdim_size3(
+      query, query_bdim, key, key_bdim, value, value_bdim);
+  const auto query_ = fold_bdim_into_batch(query, query_bdim, batch_size);
+  const auto key_ = fold_bdim_into_batch(key, key_bdim, batch_size);
+  const auto value_ = fold_bdim_into_batch(value, value_bdim, batch_size);
+  const auto res = at::_scaled_dot_product_efficient_attention(
+      query_, key_, value_, compute_log_sumexp, is_causal, scale);
+  const auto output = reshape_dim_outof(0, batch_size, std::get<0>(res));
+  if (!compute_log_sumexp) {
+    // log_sumexp is an empty placeholder; don't try to unflatten it.
+    return std::make_tuple(output, 0, std::get<1>(res), nullopt);
+  }
+  return std::make_tuple(
+      output, 0, reshape_dim_outof(0, batch_size, std::get<1>(res)), 0);
+}
+
+static threeOutputs _scaled_dot_product_efficient_attention_backward_batch_rule(
+    const Tensor& grad_out, optional<int64_t> grad_out_bdim,
+    const Tensor& query, optional<int64_t> query_bdim,
+    const Tensor& key, optional<int64_t> key_bdim,
+    const Tensor& value, optional<int64_t> value_bdim,
+    const Tensor& out, optional<int64_t> out_bdim,
+    const Tensor& logsumexp, optional<int64_t> logsumexp_bdim,
+    bool is_causal,
+    bool chunk_grad_outputs,
+    c10::optional<double> scale) {
+  const auto batch_size = get_bdim_size3(
+      grad_out, grad_out_bdim, query, query_bdim, key, key_bdim);
+  const auto grad_out_ = fold_bdim_into_batch(grad_out, grad_out_bdim, batch_size);
+  const auto query_ = fold_bdim_into_batch(query, query_bdim, batch_size);
+  const auto key_ = fold_bdim_into_batch(key, key_bdim, batch_size);
+  const auto value_ = fold_bdim_into_batch(value, value_bdim, batch_size);
+  const auto out_ = fold_bdim_into_batch(out, out_bdim, batch_size);
+  const auto logsumexp_ = fold_bdim_into_batch(logsumexp, logsumexp_bdim, batch_size);
+  const auto res = at::_scaled_dot_product_efficient_attention_backward(
+      grad_out_, query_, key_, value_, out_, logsumexp_,
+      is_causal, chunk_grad_outputs, scale);
+  return std::make_tuple(
+      reshape_dim_outof(0, batch_size, std::get<0>(res)), 0,
+      reshape_dim_outof(0, batch_size, std::get<1>(res)), 0,
+      reshape_dim_outof(0, batch_size, std::get<2>(res)), 0);
+}
+
+static std::tuple<
+    Tensor, optional<int64_t>, Tensor, optional<int64_t>,
+    Tensor, optional<int64_t>, Tensor, optional<int64_t>,
+    int64_t, int64_t,
+    Tensor, optional<int64_t>, Tensor, optional<int64_t>,
+    Tensor, optional<int64_t>>
+_scaled_dot_product_flash_attention_batch_rule(
+    const Tensor& query, optional<int64_t> query_bdim,
+    const Tensor& key, optional<int64_t> key_bdim,
+    const Tensor& value, optional<int64_t> value_bdim,
+    double dropout_p,
+    bool is_causal,
+    bool return_debug_mask,
+    c10::optional<double> scale) {
+  if (dropout_p > 0) {
+    auto maybe_layer = maybeCurrentDynamicLayer();
+    RandomnessType randomness = maybe_layer->randomness();
+    check_randomness(
+        randomness,
+        query_bdim.has_value() || key_bdim.has_value() || value_bdim.has_value());
+  }
+  const auto batch_size = get_bdim_size3(
+      query, query_bdim, key, key_bdim, value, value_bdim);
+  const auto query_ = fold_bdim_into_batch(query, query_bdim, batch_size);
+  const auto key_ = fold_bdim_into_batch(key, key_bdim, batch_size);
+  const auto value_ = fold_bdim_into_batch(value, value_bdim, batch_size);
+  const auto res = at::_scaled_dot_product_flash_attention(
+      query_, key_, value_, dropout_p, is_causal, return_debug_mask, scale);
+  const auto debug_mask_bdim =
+      return_debug_mask ? optional<int64_t>(0) : nullopt;
+  return std::make_tuple(
+      reshape_dim_outof(0, batch_size, std::get<0>(res)), 0,
+      reshape_dim_outof(0, batch_size, std::get<1>(res)), 0,
+      // cum_seq_q and cum_seq_k are placeholders on the dense path.
+      std::get<2>(res), nullopt,
+      std::get<3>(res), nullopt,
+      std::get<4>(res),
+      std::get<5>(res),
+      // philox seed and offset are never batched.
+      std::get<6>(res), nullopt,
+      std::get<7>(res), nullopt,
+      return_debug_mask ? reshape_dim_outof(0, batch_size, std::get<8>(res))
+                        : std::get<8>(res),
+      debug_mask_bdim);
+}
+
+static threeOutputs _scaled_dot_product_flash_attention_backward_batch_rule(
+    const Tensor& grad_out, optional<int64_t> grad_out_bdim,
+    const Tensor& query, optional<int64_t> query_bdim,
+    const Tensor& key, optional<int64_t> key_bdim,
+    const Tensor& value, optional<int64_t> value_bdim,
+    const Tensor& out, optional<int64_t> out_bdim,
+    const Tensor& logsumexp, optional<int64_t> logsumexp_bdim,
+    const Tensor& cum_seq_q, optional<int64_t> cum_seq_q_bdim,
+    const Tensor& cum_seq_k, optional<int64_t> cum_seq_k_bdim,
+    int64_t max_q,
+    int64_t max_k,
+    double dropout_p,
+    bool is_causal,
+    const Tensor& philox_seed, optional<int64_t> philox_seed_bdim,
+    const Tensor& philox_offset, optional<int64_t> philox_offset_bdim,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      !cum_seq_q_bdim && !cum_seq_k_bdim && !philox_seed_bdim &&
+          !philox_offset_bdim,
+      "vmap: expected the auxiliary outputs of _scaled_dot_product_flash_attention "
+      "(cum_seq_q, cum_seq_k, philox_seed, philox_offset) to be unbatched");
+  const auto batch_size = get_bdim_size3(
+      grad_out, grad_out_bdim, query, query_bdim, key, key_bdim);
+  const auto grad_out_ = fold_bdim_into_batch(grad_out, grad_out_bdim, batch_size);
+  const auto query_ = fold_bdim_into_batch(query, query_bdim, batch_size);
+  const auto key_ = fold_bdim_into_batch(key, key_bdim, batch_size);
+  const auto value_ = fold_bdim_into_batch(value, value_bdim, batch_size);
+  const auto out_ = fold_bdim_into_batch(out, out_bdim, batch_size);
+  const auto logsumexp_ = fold_bdim_into_batch(logsumexp, logsumexp_bdim, batch_size);
+  const auto res = at::_scaled_dot_product_flash_attention_backward(
+      grad_out_, query_, key_, value_, out_, logsumexp_,
+      cum_seq_q, cum_seq_k, max_q, max_k, dropout_p, is_causal,
+      philox_seed, philox_offset, scale);
+  return std::make_tuple(
+      reshape_dim_outof(0, batch_size, std::get<0>(res)), 0,
+      reshape_dim_outof(0, batch_size, std::get<1>(res)), 0,
+      reshape_dim_outof(0, batch_size, std::get<2>(res)), 0);
+}
 }
 
 #define LINALG_CHECK_MATRIX_UNARY_BATCH_RULE(fn, num_out) SINGLE_ARG(\
@@ -619,6 +770,19 @@ TORCH_LIBRARY_IMPL(aten, FuncTorchBatched, m) {
 
   VMAP_SUPPORT(_linalg_check_errors, _linalg_check_errors_batch_rule);
 
+  VMAP_SUPPORT(
+      _scaled_dot_product_efficient_attention,
+      _scaled_dot_product_efficient_attention_batch_rule);
+  VMAP_SUPPORT(
+      _scaled_dot_product_efficient_attention_backward,
+      _scaled_dot_product_efficient_attention_backward_batch_rule);
+  VMAP_SUPPORT(
+      _scaled_dot_product_flash_attention,
+      _scaled_dot_product_flash_attention_batch_rule);
+  VMAP_SUPPORT(
+      _scaled_dot_product_flash_attention_backward,
+      _scaled_dot_product_flash_attention_backward_batch_rule);
+
   m.impl("vdot", vdot_decomp);
 }
 }}
@@ -19,6 +19,63 @@
 namespace at { namespace native {
 
 namespace {
+/*
+  Unblocked Cholesky factorization of a single small column-major matrix.
+  LAPACK's POTRF is heavily blocked and its call overhead dominates for tiny
+  matrices, so batches of small factorizations (Kalman filters and the like)
+  go through this direct kernel instead.
+
+  Mirrors POTRF semantics: only the `upper` triangle is read and written, and
+  `info` is set to k (1-based) when the leading minor of order k is not
+  positive definite.
+*/
+template <typename scalar_t>
+void cholesky_single_small(scalar_t* a, int64_t n, int64_t lda, bool upper, int* info) {
+  using value_t = typename c10::scalar_value_type<scalar_t>::type;
+  *info = 0;
+  for (const auto j : c10::irange(n)) {
+    value_t d = real_impl<scalar_t, value_t>(a[j * lda + j]);
+    if (upper) {
+      for (const auto k : c10::irange(j)) {
+        const auto& u_kj = a[j * lda + k];
+        d -= real_impl<scalar_t, value_t>(u_kj * conj_impl(u_kj));
+      }
+      // Matches LAPACK, which also fails on NaN here
+      if (!(d > value_t(0))) {
+        *info = j + 1;
+        return;
+      }
+      const auto djj = std::sqrt(d);
+      a[j * lda + j] = djj;
+      for (int64_t i = j + 1; i < n; i++) {
+        scalar_t s = a[i * lda + j];
+        for (const auto k : c10::irange(j)) {
+          s -= conj_impl(a[j * lda + k]) * a[i * lda + k];
+        }
+        a[i * lda + j] = s / djj;
+      }
+    } else {
+      for (const auto k : c10::irange(j)) {
+        const auto& l_jk = a[k * lda + j];
+        d -= real_impl<scalar_t, value_t>(l_jk * conj_impl(l_jk));
+      }
+      if (!(d > value_t(0))) {
+        *info = j + 1;
+        return;
+      }
+      const auto djj = std::sqrt(d);
+      a[j * lda + j] = djj;
+      for (int64_t i = j + 1; i < n; i++) {
+        scalar_t s = a[j * lda + i];
+        for (const auto k : c10::irange(j)) {
+          s -= a[k * lda + i] * conj_impl(a[k * lda + j]);
+        }
+        a[j * lda + i] = s / djj;
+      }
+    }
+  }
+}
+
 /*
   Computes the Cholesky decomposition of matrices stored in `input`.
   This is an in-place routine and the content of 'input' is overwritten with the result.
@@ -48,11 +105,28 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
   auto n = input.size(-2);
   auto lda = std::max<int64_t>(1, n);
 
-  for (const auto i : c10::irange(batch_size)) {
-    scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
-    int* info_working_ptr = &info_data[i];
-    lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
-  }
+  // LAPACK's blocking and call overhead make it a poor fit for tiny
+  // matrices; factor those directly instead.
+  const bool use_small_kernel = n <= 32;
+
+  const auto loop = [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
+      int* info_working_ptr = &info_data[i];
+      if (use_small_kernel) {
+        cholesky_single_small<scalar_t>(input_working_ptr, n, lda, upper, info_working_ptr);
+      } else {
+        lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
+      }
+    }
+  };
+  // Matrices are independent, so split the batch across threads. Same
+  // grain-size heuristic as apply_lu_factor below: hand out larger chunks
+  // as the per-matrix cost (~n^3) shrinks.
+  int64_t chunk_size_per_thread =
+      int64_t(std::min(1.0, 3200.0 / (double(n) * n * n)));
+  int64_t grain_size = chunk_size_per_thread * at::get_num_threads();
+  at::parallel_for(0, batch_size, grain_size, loop);
 #endif
 }
 
@@ -9,6 +9,8 @@
 #include <ATen/native/Unfold2d.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -26,6 +28,29 @@ namespace native {
 
 namespace {
 
+// Note [Thread-local im2col workspace]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The unfolded-copy buffer is the dominant allocation in a slow_conv2d call
+// and is discarded as soon as the GEMM consumes it. Small-batch inference
+// re-runs the same shapes call after call, so instead of allocating a fresh
+// buffer every time we keep one grow-only scratch tensor per thread and hand
+// out views of it. This is safe because the buffer never escapes a single
+// forward/backward call: every caller fully overwrites it and consumes it
+// before returning.
+static Tensor columns_workspace(
+    int64_t batch_size,
+    int64_t row,
+    int64_t col,
+    const TensorOptions& options) {
+  static thread_local Tensor workspace;
+  const int64_t required = batch_size * row * col;
+  if (!workspace.defined() || workspace.dtype() != options.dtype() ||
+      workspace.numel() < required) {
+    workspace = at::empty({required}, options);
+  }
+  return workspace.narrow(0, 0, required).view({batch_size, row, col});
+}
+
 static Tensor compute_columns2d(
     const Tensor& input,
     IntArrayRef padding,
@@ -60,7 +85,8 @@ static Tensor compute_columns2d(
         output_height * output_width : n_input_plane * kernel_height * kernel_width;
     int64_t col = is_channels_last ?
         kernel_height * kernel_width * n_input_plane : output_height * output_width;
-    columns = at::empty({batch_size, row, col}, input.options());
+    // See Note [Thread-local im2col workspace]
+    columns = columns_workspace(batch_size, row, col, input.options());
     AT_DISPATCH_ALL_TYPES_AND(kBFloat16, input.scalar_type(), "slow_conv2d_cpu", [&]{
       auto input_a = input.accessor<scalar_t, 4>();
       auto columns_a = columns.accessor<scalar_t, 3>();
@@ -283,6 +309,92 @@ static void slow_conv2d_update_output_frame(
   }
 }
 
+// Note [Conv2d forward strategy]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The forward kernel picks one of two strategies per shape:
+//
+// - Im2col: unfold the input into a column buffer and run one big GEMM.
+//   This is the general path (and the only one for channels-last, strided,
+//   or large kernels). The column buffer is recycled across calls, see
+//   Note [Thread-local im2col workspace].
+//
+// - Direct: for small stride-1 kernels in channels-first layout, skip the
+//   unfold entirely and accumulate one narrow GEMM per kernel element and
+//   output row directly out of the input ("shift + GEMM"). This avoids both
+//   the unfolded copy and the kh*kw-fold blowup of the column buffer, which
+//   dominates at batch 1.
+//
+// Routing to oneDNN happens above this kernel in the convolution backend
+// selection; by the time we are here we are the fallback and only choose
+// between the in-file strategies.
+enum class Conv2dStrategy { Im2col, Direct };
+
+static Conv2dStrategy select_conv2d_strategy(
+    const Tensor& weight,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t stride_height,
+    int64_t stride_width,
+    bool is_channels_last) {
+  if (!is_channels_last && weight.dim() == 4 &&
+      stride_height == 1 && stride_width == 1 &&
+      kernel_height <= 3 && kernel_width <= 3 &&
+      kernel_height * kernel_width > 1) {
+    return Conv2dStrategy::Direct;
+  }
+  return Conv2dStrategy::Im2col;
+}
+
+template <typename scalar_t>
+static void slow_conv2d_direct_output_frame(
+    TensorAccessor<scalar_t, 3> input,
+    TensorAccessor<scalar_t, 3> output,
+    TensorAccessor<scalar_t, 4> weight,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t pad_height,
+    int64_t pad_width,
+    int64_t n_input_plane,
+    int64_t input_height,
+    int64_t input_width,
+    int64_t n_output_plane,
+    int64_t output_height,
+    int64_t output_width) {
+  // weight comes repacked as {kh, kw, oc, ic} so that every kernel element
+  // yields a contiguous {oc, ic} matrix. For each kernel element, output rows
+  // accumulate a GEMM over the (shifted) input rows; output cells whose only
+  // contributions come from zero padding keep their preloaded bias/zero value.
+  // The caller must have initialized output (stride is 1x1 by construction).
+  for (const auto kh : c10::irange(kernel_height)) {
+    const int64_t oh_begin = std::max<int64_t>(0, pad_height - kh);
+    const int64_t oh_end =
+        std::min(output_height, input_height + pad_height - kh);
+    for (const auto kw : c10::irange(kernel_width)) {
+      const int64_t ow0 = std::max<int64_t>(0, pad_width - kw);
+      const int64_t ow1 = std::min(output_width, input_width + pad_width - kw);
+      const int64_t len = ow1 - ow0;
+      if (len <= 0) {
+        continue;
+      }
+      for (const auto oh : c10::irange(oh_begin, oh_end)) {
+        const int64_t ih = oh + kh - pad_height;
+        const int64_t iw = ow0 + kw - pad_width;
+        // As in the im2col path, gemm expects fortran order; writing
+        // C^T = B^T A^T cancels the transposes.
+        at::native::cpublas::gemm(
+            TransposeType::NoTranspose,
+            TransposeType::NoTranspose,
+            len, n_output_plane, n_input_plane,
+            static_cast<scalar_t>(1),
+            &input[0][ih][iw], input_height * input_width,
+            &weight[kh][kw][0][0], n_input_plane,
+            static_cast<scalar_t>(1),
+            &output[0][oh][ow0], output_height * output_width);
+      }
+    }
+  }
+}
+
 template <typename scalar_t>
 void slow_conv2d_backward_update_grad_input_frame(
     TensorAccessor<scalar_t, 3> grad_input,
@@ -581,13 +693,51 @@ Tensor& slow_conv2d_forward_out_cpu(
   const int64_t output_height = (input_height + 2 * pad_height - kernel_height) / stride_height + 1;
   const int64_t output_width = (input_width + 2 * pad_width - kernel_width) / stride_width + 1;
 
-  Tensor finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
   output.resize_({batch_size, n_output_plane, output_height, output_width}, memory_format);
   if (bias.defined()) {
     output.copy_(bias.reshape({-1, 1, 1}));
   }
   TORCH_CHECK(output.is_contiguous(memory_format), "slow_conv2d output tensor must be contiguous");
 
+  // See Note [Conv2d forward strategy]
+  if (select_conv2d_strategy(
+          weight_, kernel_height, kernel_width,
+          stride_height, stride_width, use_channels_last) ==
+      Conv2dStrategy::Direct) {
+    if (!bias.defined()) {
+      output.zero_();
+    }
+    const Tensor weight_packed =
+        weight_.contiguous().permute({2, 3, 0, 1}).contiguous();
+    AT_DISPATCH_ALL_TYPES_AND(kBFloat16, input.scalar_type(), "slow_conv2d_cpu", [&]{
+      auto input_a = input.accessor<scalar_t, 4>();
+      auto output_a = output.accessor<scalar_t, 4>();
+      auto weight_a = weight_packed.accessor<scalar_t, 4>();
+
+      at::parallel_for(0, batch_size, 0, [&](int64_t start, int64_t end) {
+        for (const auto t : c10::irange(start, end)) {
+          slow_conv2d_direct_output_frame(
+              input_a[t],
+              output_a[t],
+              weight_a,
+              kernel_height,
+              kernel_width,
+              pad_height,
+              pad_width,
+              n_input_plane,
+              input_height,
+              input_width,
+              n_output_plane,
+              output_height,
+              output_width);
+        }
+      });
+    });
+    return output;
+  }
+
+  Tensor finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
+
   AT_DISPATCH_ALL_TYPES_AND(kBFloat16, input.scalar_type(), "slow_conv2d_cpu", [&]{
     auto input_a = input.accessor<scalar_t, 4>();
     auto output_a = output.accessor<scalar_t, 4>();
@@ -11,6 +11,26 @@
 namespace at { namespace native {
 
 static CPUCapability compute_cpu_capability() {
+#if defined(AT_SINGLE_CPU_CAPABILITY)
+  // Single-ISA build (ATEN_SINGLE_CPU_CAPABILITY in cmake/Codegen.cmake):
+  // the sole compiled kernel variant lives in the DEFAULT slot, so there is
+  // nothing to choose - but refuse to run on hardware that lacks the
+  // selected ISA rather than dying later on an illegal instruction.
+#if defined(AT_SINGLE_CPU_CAPABILITY_AVX512)
+  TORCH_CHECK(
+      cpuinfo_initialize() && cpuinfo_has_x86_avx512vl() &&
+          cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() &&
+          cpuinfo_has_x86_fma3(),
+      "this PyTorch build compiled its cpu kernels only for AVX512 "
+      "(ATEN_SINGLE_CPU_CAPABILITY=AVX512), but this cpu does not support AVX512");
+#elif defined(AT_SINGLE_CPU_CAPABILITY_AVX2)
+  TORCH_CHECK(
+      cpuinfo_initialize() && cpuinfo_has_x86_avx2() && cpuinfo_has_x86_fma3(),
+      "this PyTorch build compiled its cpu kernels only for AVX2 "
+      "(ATEN_SINGLE_CPU_CAPABILITY=AVX2), but this cpu does not support AVX2");
+#endif
+  return CPUCapability::DEFAULT;
+#else
   auto envar = std::getenv("ATEN_CPU_CAPABILITY");
   if (envar) {
 #if defined(HAVE_VSX_CPU_DEFINITION)
@@ -67,6 +87,7 @@ static CPUCapability compute_cpu_capability() {
 #else
   return CPUCapability::DEFAULT;
 #endif
+#endif // defined(AT_SINGLE_CPU_CAPABILITY)
 }
 
 CPUCapability get_cpu_capability() {
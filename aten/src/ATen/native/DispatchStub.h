@@ -134,6 +134,20 @@ struct DispatchStub<rT (*)(Args...), T> {
 
 private:
   FnPtr get_call_ptr(DeviceType device_type) {
+    // Fast path for CPU: once capability selection has run, the chosen
+    // implementation never changes (short of an explicit override), so a
+    // single inlined relaxed load replaces the out-of-line call plus
+    // capability branch on every invocation.  The MSVC debug build leaves
+    // cpu_dispatch_ptr uninitialized (see above), so it always takes the
+    // slow path.
+#if !defined(_MSC_VER) || !defined(_DEBUG)
+    if (C10_LIKELY(device_type == DeviceType::CPU)) {
+      auto fptr = impl.cpu_dispatch_ptr.load(std::memory_order_relaxed);
+      if (C10_LIKELY(fptr != nullptr)) {
+        return reinterpret_cast<FnPtr>(fptr);
+      }
+    }
+#endif
     return reinterpret_cast<FnPtr>(
       impl.get_call_ptr(device_type
       , reinterpret_cast<void*>(DEFAULT)
@@ -160,6 +174,14 @@ public:
     return (*call_ptr)(std::forward<ArgTypes>(args)...);
   }
 
+  // Overrides the resolved CPU implementation, e.g. to pin a specific
+  // kernel variant in tests or benchmarks.  Passing nullptr resets the stub
+  // so the next invocation re-runs capability selection.
+  void set_cpu_dispatch_ptr(FnPtr fn_ptr) {
+    impl.cpu_dispatch_ptr.store(
+        reinterpret_cast<void*>(fn_ptr), std::memory_order_relaxed);
+  }
+
   void set_cuda_dispatch_ptr(FnPtr fn_ptr) {
     impl.cuda_dispatch_ptr = reinterpret_cast<void*>(fn_ptr);
   }
@@ -303,10 +325,25 @@ struct RegisterPRIVATEUSE1Dispatch {
 // NB: this macro must be used from a 'mm' file in order to dispatch a MPS kernel
 #define REGISTER_DISPATCH(name, fn) REGISTER_MPS_DISPATCH(name, fn)
 #elif defined(CPU_CAPABILITY)
+#ifdef AT_SINGLE_CPU_CAPABILITY
+// Single-ISA build (ATEN_SINGLE_CPU_CAPABILITY in cmake/Codegen.cmake): each
+// cpu kernel is compiled exactly once, with the selected ISA's flags, and
+// registers into the stub's sole remaining slot. All HAVE_*_CPU_DEFINITION
+// macros are undefined, so the table collapses to the DEFAULT pointer and
+// the stub resolves to a direct call; compute_cpu_capability() fails fast if
+// the host cpu does not support the selected ISA.
+#define REGISTER_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, DEFAULT, fn)
+// Kernels excluded from AVX512 have no implementation at all in a
+// single-ISA AVX512 build; register nullptr so the stub reports a missing
+// kernel instead of failing to link.
+#define REGISTER_NO_AVX512_DISPATCH(name)       \
+  REGISTER_ARCH_DISPATCH(name, DEFAULT, nullptr)
+#else
 #define REGISTER_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, CPU_CAPABILITY, fn)
 #define REGISTER_NO_AVX512_DISPATCH(name)       \
   REGISTER_AVX512_DISPATCH(name, nullptr)
 #endif
+#endif
 
 
 }} // namespace at::native
@@ -110,6 +110,90 @@ bool is_fast_path(const Tensor& src, const c10::optional<Tensor>& scale, Tensor&
          is_fast_path_index_select(src, output, padding_idx);
 }
 
+// The accumulation loops below gather random rows of a potentially very
+// large table and are memory latency bound, so issue software prefetches
+// for the rows a few lookups ahead while the current row is accumulated
+// (the fbgemm fast-path kernels do the same internally). Lookahead indices
+// are safe to dereference because the whole block is range-checked up
+// front (see check_indices_in_range below).
+constexpr int64_t kPrefetchDistance = 8;
+
+static inline void prefetch_embedding_row(const char* row, int64_t bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+  for (int64_t b = 0; b < bytes; b += 64) {
+    __builtin_prefetch(row + b);
+  }
+#else
+  (void)row;
+  (void)bytes;
+#endif
+}
+
+// Splits [0, numel) for at::parallel_for so that chunk boundaries coincide
+// with bag boundaries: add_indices (aka offset2bag) is non-decreasing, so
+// advancing a boundary past positions that share a bag with their
+// predecessor gives every thread an exclusive set of output rows and no
+// false sharing on the accumulators. Adjacent chunks compute the same
+// adjusted position, so the ranges still tile [0, numel) exactly.
+template <typename index_t>
+static inline int64_t align_to_bag_boundary(
+    const index_t* add_indices_data,
+    int64_t pos,
+    int64_t numel) {
+  while (pos > 0 && pos < numel &&
+         add_indices_data[pos] == add_indices_data[pos - 1]) {
+    ++pos;
+  }
+  return pos;
+}
+
+// Validates that every value in [indices, indices + n) lies in
+// [0, vocab_size). Runs as a vectorized min/max reduction so the
+// accumulation loops below do not need a branchy per-lookup check; only
+// when the reduction detects a violation do we rescan to report the
+// offending value. The scan touches the index block immediately before
+// the gather loop reads it, so the data is served from cache.
+template <typename index_t>
+static inline void check_indices_in_range(
+    const index_t* indices,
+    int64_t n,
+    int64_t vocab_size) {
+  if (n == 0) {
+    return;
+  }
+  using Vec = vec::Vectorized<index_t>;
+  index_t min_idx = indices[0];
+  index_t max_idx = indices[0];
+  int64_t i = 0;
+  if (n >= Vec::size()) {
+    Vec min_vec = Vec::loadu(indices);
+    Vec max_vec = min_vec;
+    for (i = Vec::size(); i + Vec::size() <= n; i += Vec::size()) {
+      const Vec v = Vec::loadu(indices + i);
+      min_vec = vec::minimum(min_vec, v);
+      max_vec = vec::maximum(max_vec, v);
+    }
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    index_t lanes[Vec::size()];
+    min_vec.store(lanes);
+    for (const auto lane : c10::irange(Vec::size())) {
+      min_idx = std::min(min_idx, lanes[lane]);
+    }
+    max_vec.store(lanes);
+    for (const auto lane : c10::irange(Vec::size())) {
+      max_idx = std::max(max_idx, lanes[lane]);
+    }
+  }
+  for (; i < n; i++) {
+    min_idx = std::min(min_idx, indices[i]);
+    max_idx = std::max(max_idx, indices[i]);
+  }
+  TORCH_CHECK(
+      min_idx >= 0 && static_cast<int64_t>(max_idx) < vocab_size,
+      "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
+      min_idx < 0 ? min_idx : max_idx);
+}
+
 // This function combines index_select (using select_indices as the index) and
 // index_add (using add_indices as the index), without creating an intermediary
 // tensor to hold the selected embeddings
@@ -143,14 +227,11 @@ index_select_add(
   auto output_stride0 = output.strides()[0];
   auto output_stride1 = output.strides()[1];
 
+  check_indices_in_range(select_indices_data, numel, vocab_size);
   for (const auto i : c10::irange(numel)) {
     // We can skip indices equal to padding_idx so they are not included in
     // the reduction
     auto idx = select_indices_data[i];
-    TORCH_CHECK(
-        idx >= 0 && idx < vocab_size,
-        "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-        idx);
     if (idx != padding_idx) {
       at::native::cpublas::axpy<data_t>(ddim, 1,
               src_data + src_stride0 * idx, src_stride1,
@@ -330,42 +411,57 @@ index_select_add(
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
 
-    Tensor src_fp32 = at::empty({ddim}, src.options().dtype(at::kFloat));
-    auto* src_data_fp32 = src_fp32.mutable_data_ptr<float>();
-
     // Initialize the intermediate output buffer to be 0.
     Tensor output_fp32 =
         at::zeros({output.size(0), ddim}, output.options().dtype(at::kFloat));
     auto* output_data_fp32 = output_fp32.data_ptr<float>();
 
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        // Copy src_data + src_stride0 * idx to src_data_fp32
-        for (const auto d : c10::irange(ddim)) {
-          src_data_fp32[d] = static_cast<float>(
-              (src_data + src_stride0 * idx)[d * src_stride1]);
+    // Only the first cache line of a row is worth prefetching when the
+    // table is not row-contiguous.
+    const int64_t prefetch_bytes =
+        src_stride1 == 1 ? ddim * static_cast<int64_t>(sizeof(data_t)) : 1;
+    const auto grain =
+        std::max<int64_t>(1, at::internal::GRAIN_SIZE / std::max<int64_t>(ddim, 1));
+    at::parallel_for(0, numel, grain, [&](int64_t start, int64_t end) {
+      start = align_to_bag_boundary(add_indices_data, start, numel);
+      end = align_to_bag_boundary(add_indices_data, end, numel);
+      check_indices_in_range(select_indices_data + start, end - start, vocab_size);
+      // Per-thread fp32 staging buffer for the upconverted row.
+      std::vector<float> src_fp32(ddim);
+      auto* src_data_fp32 = src_fp32.data();
+      for (const auto i : c10::irange(start, end)) {
+        if (i + kPrefetchDistance < end) {
+          const auto pf_idx = select_indices_data[i + kPrefetchDistance];
+          if (pf_idx != padding_idx) {
+            prefetch_embedding_row(
+                reinterpret_cast<const char*>(src_data + src_stride0 * pf_idx),
+                prefetch_bytes);
+          }
+        }
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        if (idx != padding_idx) {
+          // Copy src_data + src_stride0 * idx to src_data_fp32
+          for (const auto d : c10::irange(ddim)) {
+            src_data_fp32[d] = static_cast<float>(
+                (src_data + src_stride0 * idx)[d * src_stride1]);
+          }
+          at::native::cpublas::axpy<float>(
+              ddim,
+              1,
+              src_data_fp32,
+              1,
+              output_data_fp32 + ddim * add_indices_data[i],
+              1);
+
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
         }
-        at::native::cpublas::axpy<float>(
-            ddim,
-            1,
-            src_data_fp32,
-            1,
-            output_data_fp32 + ddim * add_indices_data[i],
-            1);
-
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
       }
-    }
+    });
     for (const auto i : c10::irange(output.size(0))) {
       // Convert FP32 intermediate buffer result back to 16 bit for output
       // dtype
@@ -476,28 +572,43 @@ index_select_add(const Tensor &select_indices,
     auto output_stride0 = output.strides()[0];
     auto output_stride1 = output.strides()[1];
     auto numel = add_indices.numel();
-    for (const auto i : c10::irange(numel)) {
-      // We can skip indices equal to padding_idx so they are not included in
-      // the reduction
-      auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
-      if (idx != padding_idx) {
-        at::native::cpublas::axpy<float>(
-            ddim,
-            1,
-            src_data + src_stride0 * idx,
-            src_stride1,
-            output_data + output_stride0 * add_indices_data[i],
-            output_stride1);
-      } else if (bag_size.defined()) {
-        // Decrement bag_size to reflect that the index is padded
-        // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-        bag_size_data[add_indices_data[i]]--;
+    // Only the first cache line of a row is worth prefetching when the
+    // table is not row-contiguous.
+    const int64_t prefetch_bytes =
+        src_stride1 == 1 ? ddim * static_cast<int64_t>(sizeof(float)) : 1;
+    const auto grain =
+        std::max<int64_t>(1, at::internal::GRAIN_SIZE / std::max<int64_t>(ddim, 1));
+    at::parallel_for(0, numel, grain, [&](int64_t start, int64_t end) {
+      start = align_to_bag_boundary(add_indices_data, start, numel);
+      end = align_to_bag_boundary(add_indices_data, end, numel);
+      check_indices_in_range(select_indices_data + start, end - start, vocab_size);
+      for (const auto i : c10::irange(start, end)) {
+        if (i + kPrefetchDistance < end) {
+          const auto pf_idx = select_indices_data[i + kPrefetchDistance];
+          if (pf_idx != padding_idx) {
+            prefetch_embedding_row(
+                reinterpret_cast<const char*>(src_data + src_stride0 * pf_idx),
+                prefetch_bytes);
+          }
+        }
+        // We can skip indices equal to padding_idx so they are not included in
+        // the reduction
+        auto idx = select_indices_data[i];
+        if (idx != padding_idx) {
+          at::native::cpublas::axpy<float>(
+              ddim,
+              1,
+              src_data + src_stride0 * idx,
+              src_stride1,
+              output_data + output_stride0 * add_indices_data[i],
+              output_stride1);
+        } else if (bag_size.defined()) {
+          // Decrement bag_size to reflect that the index is padded
+          // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
+          bag_size_data[add_indices_data[i]]--;
+        }
       }
-    }
+    });
   }
 }
 
@@ -539,14 +650,11 @@ index_select_scale_add(
   auto* scale_data = scale.data_ptr<data_t>();
   auto scale_stride = scale.strides()[0];
 
+  check_indices_in_range(select_indices_data, numel, vocab_size);
   for (const auto i : c10::irange(numel)) {
     // We can skip indices equal to padding_idx so they are not included in
     // the reduction
     auto idx = select_indices_data[i];
-    TORCH_CHECK(
-        idx >= 0 && idx < vocab_size,
-        "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-        idx);
     if (idx != padding_idx) {
       auto* src_base = src_data + src_stride0 * idx;
       auto* output_base = output_data + output_stride0 * add_indices_data[i];
@@ -724,14 +832,11 @@ index_select_scale_add(
         at::zeros({output.size(0), ddim}, output.options().dtype(at::kFloat));
     auto* output_data_fp32 = output_fp32.data_ptr<float>();
 
+    check_indices_in_range(select_indices_data, numel, vocab_size);
     for (const auto i : c10::irange(numel)) {
       // We can skip indices equal to padding_idx so they are not included in
       // the reduction
       auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
       if (idx != padding_idx) {
         auto* src_base = src_data + src_stride0 * idx;
         auto* output_base_fp32 = output_data_fp32 + ddim * add_indices_data[i];
@@ -858,15 +963,11 @@ index_select_scale_add(const Tensor &select_indices,
     auto scale_stride = scale.strides()[0];
     auto numel = add_indices.numel();
 
-
+    check_indices_in_range(select_indices_data, numel, vocab_size);
     for (const auto i : c10::irange(numel)) {
       // We can skip indices equal to padding_idx so they are not included in
       // the reduction
       auto idx = select_indices_data[i];
-      TORCH_CHECK(
-          idx >= 0 && idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          idx);
       if (idx != padding_idx) {
         auto* src_base = src_data + src_stride0 * idx;
         auto* output_base = output_data + output_stride0 * add_indices_data[i];
@@ -1107,13 +1208,10 @@ void embedding_bag_cpu_max_out(
     int64_t numBags = bag_size.size(0);
     std::vector<bool> bag_empty(numBags, true);
 
+    check_indices_in_range(indices_data, numIndices, vocab_size);
     for (const auto i : c10::irange(numIndices)) {
       auto bag = offset2bag_data[i];
       auto word_idx = indices_data[i];
-      TORCH_CHECK(
-          word_idx >= 0 && word_idx < vocab_size,
-          "embedding_bag: Expected idx >= 0 && idx < num_embeddings but found idx to be ",
-          word_idx);
       if (word_idx != static_cast<index_t>(padding_idx)) {
         bool is_first_for_bag = bag_empty[bag];
         for (const auto dim : c10::irange(featureSize)) {
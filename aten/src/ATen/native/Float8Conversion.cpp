@@ -0,0 +1,91 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/native/Float8Conversion.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_float8_index_select_native.h>
+#include <ATen/ops/_pack_float8_native.h>
+#include <ATen/ops/_unpack_float8_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(pack_float8_stub);
+DEFINE_DISPATCH(unpack_float8_stub);
+DEFINE_DISPATCH(float8_index_select_stub);
+
+namespace {
+
+void check_unpack_dtype(ScalarType dtype) {
+  TORCH_CHECK(
+      dtype == kFloat || dtype == kHalf || dtype == kBFloat16,
+      "float8 values can only be unpacked to float32, float16 or bfloat16, got ",
+      dtype);
+}
+
+} // namespace
+
+Tensor _pack_float8(const Tensor& self, bool e5m2) {
+  TORCH_CHECK(
+      at::isFloatingType(self.scalar_type()),
+      "_pack_float8 expects a floating point tensor, got ",
+      self.scalar_type());
+  Tensor out = at::empty(self.sizes(), self.options().dtype(kByte));
+  auto iter = TensorIteratorConfig()
+                  .add_output(out)
+                  .add_input(self)
+                  .check_all_same_dtype(false)
+                  .build();
+  pack_float8_stub(iter.device_type(), iter, e5m2);
+  return out;
+}
+
+Tensor _unpack_float8(const Tensor& self, ScalarType dtype, bool e5m2) {
+  TORCH_CHECK(
+      self.scalar_type() == kByte,
+      "_unpack_float8 expects a uint8 tensor of packed float8 values, got ",
+      self.scalar_type());
+  check_unpack_dtype(dtype);
+  Tensor out = at::empty(self.sizes(), self.options().dtype(dtype));
+  auto iter = TensorIteratorConfig()
+                  .add_output(out)
+                  .add_input(self)
+                  .check_all_same_dtype(false)
+                  .build();
+  unpack_float8_stub(iter.device_type(), iter, e5m2);
+  return out;
+}
+
+Tensor _float8_index_select(
+    const Tensor& self,
+    const Tensor& index,
+    ScalarType dtype,
+    bool e5m2) {
+  TORCH_CHECK(
+      self.scalar_type() == kByte,
+      "_float8_index_select expects a uint8 tensor of packed float8 values, got ",
+      self.scalar_type());
+  TORCH_CHECK(
+      self.dim() == 2, "_float8_index_select expects a 2-D table, got ",
+      self.dim(), "-D");
+  TORCH_CHECK(
+      index.dim() == 1 &&
+          (index.scalar_type() == kLong || index.scalar_type() == kInt),
+      "_float8_index_select expects a 1-D int or long index tensor");
+  check_unpack_dtype(dtype);
+  auto self_ = self.contiguous();
+  auto index_ = index.contiguous();
+  Tensor out =
+      at::empty({index_.numel(), self_.size(1)}, self_.options().dtype(dtype));
+  float8_index_select_stub(self_.device().type(), out, self_, index_, e5m2);
+  return out;
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,150 @@
+#pragma once
+#include <ATen/native/DispatchStub.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace at {
+class Tensor;
+struct TensorIteratorBase;
+}
+
+namespace at {
+namespace native {
+
+// Bit-level conversions between fp32 and the two common 8-bit float storage
+// formats: e4m3fn (4 exponent bits, 3 mantissa bits, no infinities, single
+// NaN encoding 0x7f, range +-448) and e5m2 (5 exponent bits, 2 mantissa
+// bits, IEEE-style infinities and NaNs, range +-57344). There is no fp8
+// ScalarType; packed values live in uint8 tensors and are produced/consumed
+// by the _pack_float8/_unpack_float8/_float8_index_select ops. Everything
+// here is header-only and host/device so the CPU and CUDA kernels share one
+// implementation (the CUDA kernel substitutes __nv_cvt intrinsics when the
+// toolkit provides them).
+namespace float8 {
+
+C10_HOST_DEVICE inline uint32_t fp32_to_bits(float f) {
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+C10_HOST_DEVICE inline float fp32_from_bits(uint32_t bits) {
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Round-to-nearest-even encode. MANT/EXP are the target mantissa/exponent
+// widths; FINITE_ONLY selects the e4m3fn convention where the all-ones
+// exponent is (mostly) a normal binade and everything unrepresentably large
+// (including infinity) encodes as the NaN pattern 0x7f.
+template <int MANT, int EXP, bool FINITE_ONLY>
+C10_HOST_DEVICE inline uint8_t fp8_from_fp32_value(float f) {
+  constexpr int kBias = (1 << (EXP - 1)) - 1;
+  constexpr int kMantShift = 23 - MANT; // fp32 mantissa bits dropped
+  // Smallest value the normal-path integer arithmetic handles; below it the
+  // result is a target denormal (or zero).
+  constexpr uint32_t kDenormThreshold = static_cast<uint32_t>(128 - kBias)
+      << 23;
+  // Adding 2^(24 - kBias - MANT) aligns a denormal-range value so that the
+  // low fp32 mantissa bits hold round(value / denormal_quantum), with the
+  // float addition performing the round-to-nearest-even. Overflow into the
+  // exponent field lands exactly on the smallest normal encoding.
+  constexpr uint32_t kDenormMagic = static_cast<uint32_t>(151 - kBias - MANT)
+      << 23;
+  // First value that rounds past the largest finite: for e4m3fn the largest
+  // finite binade is one step short of all-ones/all-ones (that's NaN), for
+  // e5m2 it is capped by the infinity binade. At and beyond this the integer
+  // rounding below would overflow the exponent field.
+  constexpr uint32_t kOverflowThreshold = FINITE_ONLY
+      ? (static_cast<uint32_t>(128 + kBias) << 23) |
+          (static_cast<uint32_t>((1 << MANT) - 1) << kMantShift)
+      : static_cast<uint32_t>(128 + kBias) << 23;
+
+  uint32_t f_bits = fp32_to_bits(f);
+  const uint8_t sign = static_cast<uint8_t>((f_bits >> 24) & 0x80);
+  f_bits &= UINT32_C(0x7fffffff);
+
+  uint8_t result;
+  if (f_bits >= kOverflowThreshold) {
+    if (FINITE_ONLY) {
+      result = 0x7f; // NaN; e4m3fn cannot represent infinity
+    } else {
+      constexpr uint8_t kInf = ((1 << EXP) - 1) << MANT;
+      result = f_bits > UINT32_C(0x7f800000) ? (kInf | (1 << (MANT - 1)))
+                                             : kInf;
+    }
+  } else if (f_bits < kDenormThreshold) {
+    const float magic = fp32_from_bits(kDenormMagic);
+    f_bits = fp32_to_bits(fp32_from_bits(f_bits) + magic);
+    result = static_cast<uint8_t>(f_bits - kDenormMagic);
+  } else {
+    const uint32_t mant_odd = (f_bits >> kMantShift) & 1;
+    f_bits += (static_cast<uint32_t>(kBias - 127) << 23) +
+        ((UINT32_C(1) << (kMantShift - 1)) - 1) + mant_odd;
+    result = static_cast<uint8_t>(f_bits >> kMantShift);
+  }
+  return result | sign;
+}
+
+template <int MANT, int EXP, bool FINITE_ONLY>
+C10_HOST_DEVICE inline float fp8_to_fp32_value(uint8_t input) {
+  constexpr int kBias = (1 << (EXP - 1)) - 1;
+  const uint32_t sign = static_cast<uint32_t>(input & 0x80) << 24;
+  uint32_t exp = (input >> MANT) & ((1 << EXP) - 1);
+  uint32_t mant = input & ((1 << MANT) - 1);
+
+  uint32_t f_bits;
+  if (exp == (1u << EXP) - 1 &&
+      (FINITE_ONLY ? mant == (1u << MANT) - 1 : true)) {
+    f_bits = UINT32_C(0x7f800000) |
+        (FINITE_ONLY ? UINT32_C(0x400000) : mant << (23 - MANT));
+  } else if (exp == 0) {
+    if (mant == 0) {
+      f_bits = 0;
+    } else {
+      // Normalize the denormal; MANT <= 3 so the loop is at most 3 steps.
+      int e = 1 - kBias;
+      while ((mant & (1u << MANT)) == 0) {
+        mant <<= 1;
+        --e;
+      }
+      mant &= (1u << MANT) - 1;
+      f_bits = (static_cast<uint32_t>(e + 127) << 23) | (mant << (23 - MANT));
+    }
+  } else {
+    f_bits = ((exp - kBias + 127) << 23) | (mant << (23 - MANT));
+  }
+  return fp32_from_bits(f_bits | sign);
+}
+
+C10_HOST_DEVICE inline uint8_t fp8e4m3fn_from_fp32_value(float f) {
+  return fp8_from_fp32_value<3, 4, true>(f);
+}
+
+C10_HOST_DEVICE inline float fp8e4m3fn_to_fp32_value(uint8_t input) {
+  return fp8_to_fp32_value<3, 4, true>(input);
+}
+
+C10_HOST_DEVICE inline uint8_t fp8e5m2_from_fp32_value(float f) {
+  return fp8_from_fp32_value<2, 5, false>(f);
+}
+
+C10_HOST_DEVICE inline float fp8e5m2_to_fp32_value(uint8_t input) {
+  return fp8_to_fp32_value<2, 5, false>(input);
+}
+
+} // namespace float8
+
+using pack_float8_fn = void (*)(TensorIteratorBase&, bool e5m2);
+using unpack_float8_fn = void (*)(TensorIteratorBase&, bool e5m2);
+using float8_index_select_fn =
+    void (*)(const Tensor& out, const Tensor& self, const Tensor& index, bool e5m2);
+
+DECLARE_DISPATCH(pack_float8_fn, pack_float8_stub);
+DECLARE_DISPATCH(unpack_float8_fn, unpack_float8_stub);
+DECLARE_DISPATCH(float8_index_select_fn, float8_index_select_stub);
+
+} // namespace native
+} // namespace at
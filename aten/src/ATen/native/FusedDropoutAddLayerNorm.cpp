@@ -0,0 +1,183 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/layer_norm.h>
+
+#include <ATen/core/Tensor.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_backward_native.h>
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/addcmul.h>
+#include <ATen/ops/arange.h>
+#include <ATen/ops/constant_pad_nd.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/native_layer_norm.h>
+#include <ATen/ops/native_layer_norm_backward.h>
+#endif
+
+#include <c10/core/MemoryFormat.h>
+
+#include <array>
+#include <tuple>
+
+namespace at {
+namespace native {
+
+// Packs a 0/1 dropout mask of logical shape {M, N} into one byte per 8
+// elements, padding each row to a whole number of bytes: bit k of byte b in
+// a row covers row element 8 * b + k. Rows are padded independently so a
+// byte never spans two layer norm rows, which also lets the CUDA kernel
+// assign whole bytes to threads. See unpack_dropout_mask for the inverse.
+Tensor pack_dropout_mask(const Tensor& mask, int64_t M, int64_t N) {
+  const int64_t bytes_per_row = (N + 7) / 8;
+  auto bits = mask.reshape({M, N}).to(kByte);
+  if (N % 8 != 0) {
+    bits = at::constant_pad_nd(bits, {0, bytes_per_row * 8 - N}, 0);
+  }
+  auto shifts = at::arange(8, bits.options());
+  // Bits within a byte are disjoint, so summing the shifted lanes is exact.
+  return bits.view({M, bytes_per_row, 8})
+      .bitwise_left_shift(shifts)
+      .sum(-1)
+      .to(kByte);
+}
+
+// Unpacks mask bits produced by pack_dropout_mask back into a 0/1 byte
+// tensor of shape {M, N}.
+Tensor unpack_dropout_mask(const Tensor& mask_bits, int64_t M, int64_t N) {
+  auto shifts = at::arange(8, mask_bits.options());
+  return mask_bits.view({M, -1, 1})
+      .bitwise_right_shift(shifts)
+      .bitwise_and(1)
+      .view({M, -1})
+      .narrow(1, 0, N);
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor>
+math_fused_dropout_add_layer_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    double eps,
+    bool train) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      p);
+  TORCH_CHECK(
+      residual.sizes().equals(input.sizes()),
+      "Expected residual to have the same shape as input, but got residual "
+      "of shape ",
+      residual.sizes(),
+      " and input of shape ",
+      input.sizes());
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+
+  Tensor y;
+  Tensor mask_bits;
+  if (train && p > 0 && input.numel() > 0) {
+    double p1m = 1. - p;
+    // Check for probability of zero to avoid divide by zero and NaN results
+    double scale = p1m == 0 ? 0. : 1. / p1m;
+    Tensor mask = at::empty_like(input, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+    mask.bernoulli_(p1m);
+    // One fused multiply-add pass over the activations.
+    y = at::addcmul(residual, input, mask, scale);
+    mask_bits = pack_dropout_mask(mask, M, N);
+  } else {
+    y = input.add(residual);
+    mask_bits = at::empty({0}, input.options().dtype(kByte));
+  }
+
+  auto outputs = at::native_layer_norm(y, normalized_shape, weight_opt, bias_opt, eps);
+  return std::make_tuple(
+      std::move(std::get<0>(outputs)),
+      std::move(y),
+      std::move(mask_bits),
+      std::move(std::get<1>(outputs)),
+      std::move(std::get<2>(outputs)));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor>
+fused_dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& dropout_add_output,
+    const Tensor& mask_bits,
+    IntArrayRef normalized_shape,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    std::array<bool, 4> output_mask) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  auto M_N = _check_layer_norm_inputs(
+      dropout_add_output, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+
+  // The gradient w.r.t. the layer norm input serves both the residual
+  // (unchanged) and the dropped-out input (masked and rescaled).
+  std::array<bool, 3> ln_mask = {
+      output_mask[0] || output_mask[1], output_mask[2], output_mask[3]};
+  auto ln_grads = at::native_layer_norm_backward(
+      grad_out,
+      dropout_add_output,
+      normalized_shape,
+      mean,
+      rstd,
+      weight_opt,
+      bias_opt,
+      ln_mask);
+  const Tensor& dy = std::get<0>(ln_grads);
+
+  Tensor grad_input;
+  Tensor grad_residual;
+  if (output_mask[1]) {
+    grad_residual = dy;
+  }
+  if (output_mask[0]) {
+    if (train && p > 0 && mask_bits.numel() > 0) {
+      double p1m = 1. - p;
+      double scale = p1m == 0 ? 0. : 1. / p1m;
+      auto mask = unpack_dropout_mask(mask_bits, M, N)
+                      .to(dy.scalar_type())
+                      .view_as(dy);
+      grad_input = dy.mul(mask).mul_(scale);
+    } else {
+      grad_input = dy;
+    }
+  }
+  return std::make_tuple(
+      std::move(grad_input),
+      std::move(grad_residual),
+      std::move(std::get<1>(ln_grads)),
+      std::move(std::get<2>(ln_grads)));
+}
+
+} // namespace native
+} // namespace at
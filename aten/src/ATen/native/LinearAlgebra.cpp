@@ -128,6 +128,8 @@
 #include <ATen/ops/zeros_like.h>
 #endif
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <numeric>
 #include <string>
@@ -1531,6 +1533,17 @@ TORCH_IMPL_FUNC(addmm_activation_out_cpu)(const Tensor& self, const Tensor& mat1
   auto b_self = expand_size(self, {mat1.sizes()[0], mat2.sizes()[1]}, "addmm_out");
   {
     at::NoNamesGuard guard;
+    // Fold the bias addition and the activation into the oneDNN matmul as
+    // post-ops when possible (the CPU analog of the cublasLt epilogue path on
+    // CUDA), instead of launching separate elementwise kernels afterwards.
+    // Like the cublasLt path, this only covers the common linear-layer form:
+    // 1-D bias with alpha == beta == 1.
+    if (self.dim() == 1 &&
+        alpha.toComplexDouble() == 1.0 && beta.toComplexDouble() == 1.0 &&
+        use_mkldnn_matmul_activation(mat1, mat2, self, result)) {
+      mkldnn_matmul_activation(mat1, mat2, self, result, use_gelu);
+      return;
+    }
     addmm_impl_cpu_(const_cast<Tensor&>(result), *b_self, mat1, mat2, beta, alpha);
     if (use_gelu) {
       at::gelu_(const_cast<Tensor&>(result));
@@ -1881,6 +1894,81 @@ static bool should_fold(const Tensor& tensor1, const Tensor& tensor2) {
   return true;
 }
 
+// Which execution path _matmul_impl takes for a given pair of inputs.
+enum class MatmulStrategy : uint8_t { DOT, MV, VEC_MM, MM, FOLD, BMM };
+
+static MatmulStrategy compute_matmul_strategy(const Tensor& tensor1, const Tensor& tensor2) {
+  const auto dim_tensor1 = tensor1.dim();
+  const auto dim_tensor2 = tensor2.dim();
+  if (dim_tensor1 == 1 && dim_tensor2 == 1) {
+    return MatmulStrategy::DOT;
+  } else if (dim_tensor1 == 2 && dim_tensor2 == 1) {
+    return MatmulStrategy::MV;
+  } else if (dim_tensor1 == 1 && dim_tensor2 == 2) {
+    return MatmulStrategy::VEC_MM;
+  } else if (dim_tensor1 == 2 && dim_tensor2 == 2) {
+    return MatmulStrategy::MM;
+  } else if (should_fold(tensor1, tensor2)) {
+    return MatmulStrategy::FOLD;
+  }
+  return MatmulStrategy::BMM;
+}
+
+// The strategy only depends on the dimensionalities, the shapes and
+// strides (through should_fold) and the requires_grad bits, and
+// workloads like transformer inference call matmul millions of times
+// with a handful of distinct shape patterns.  A small per-thread
+// direct-mapped cache keyed on exactly those inputs lets the hot shapes
+// skip the branchy re-derivation.  Entries for tensors of more than
+// kMaxDim dimensions are not cached (the key is fixed-size).
+struct MatmulStrategyCacheEntry {
+  static constexpr int64_t kMaxDim = 6;
+  // 1 word of dims/flags + sizes and strides of both tensors
+  static constexpr size_t kMaxKeyLen = 1 + 4 * kMaxDim;
+  std::array<int64_t, kMaxKeyLen> key;
+  size_t key_len = 0; // 0 marks an empty entry
+  MatmulStrategy strategy = MatmulStrategy::BMM;
+};
+
+static MatmulStrategy get_matmul_strategy(const Tensor& tensor1, const Tensor& tensor2) {
+  constexpr size_t kCacheSize = 16; // direct mapped
+  static thread_local std::array<MatmulStrategyCacheEntry, kCacheSize> cache;
+
+  const int64_t dim1 = tensor1.dim();
+  const int64_t dim2 = tensor2.dim();
+  if (dim1 > MatmulStrategyCacheEntry::kMaxDim ||
+      dim2 > MatmulStrategyCacheEntry::kMaxDim) {
+    return compute_matmul_strategy(tensor1, tensor2);
+  }
+
+  std::array<int64_t, MatmulStrategyCacheEntry::kMaxKeyLen> key;
+  size_t key_len = 0;
+  key[key_len++] = dim1 | (dim2 << 8) |
+      (static_cast<int64_t>(tensor1.requires_grad()) << 16) |
+      (static_cast<int64_t>(tensor2.requires_grad()) << 17);
+  for (const auto* t : {&tensor1, &tensor2}) {
+    for (const auto d : c10::irange(t->dim())) {
+      key[key_len++] = t->sizes()[d];
+      key[key_len++] = t->strides()[d];
+    }
+  }
+
+  uint64_t hash = 0;
+  for (const auto i : c10::irange(key_len)) {
+    hash = hash * 31 + static_cast<uint64_t>(key[i]);
+  }
+  auto& entry = cache[hash % kCacheSize];
+  if (entry.key_len == key_len &&
+      std::equal(key.begin(), key.begin() + key_len, entry.key.begin())) {
+    return entry.strategy;
+  }
+  const auto strategy = compute_matmul_strategy(tensor1, tensor2);
+  entry.key = key;
+  entry.key_len = key_len;
+  entry.strategy = strategy;
+  return strategy;
+}
+
 /*
 Matrix product of two Tensors.
 The behavior depends on the dimensionality of the Tensors as follows:
@@ -1910,17 +1998,18 @@ static Tensor _matmul_impl(
 
 
   const bool has_out = out.defined();
+  const auto strategy = get_matmul_strategy(tensor1, tensor2);
 
-  if (dim_tensor1 == 1 && dim_tensor2 == 1) {
+  if (strategy == MatmulStrategy::DOT) {
     return has_out ? at::dot_out(out, tensor1, tensor2) : tensor1.dot(tensor2);
-  } else if (dim_tensor1 == 2 && dim_tensor2 == 1) {
+  } else if (strategy == MatmulStrategy::MV) {
     return has_out ? at::mv_out(out, tensor1, tensor2) : tensor1.mv(tensor2);
-  } else if (dim_tensor1 == 1 && dim_tensor2 == 2) {
+  } else if (strategy == MatmulStrategy::VEC_MM) {
     return has_out ? at::mm_out(out, tensor1.unsqueeze(0), tensor2).squeeze_(0)
                    : tensor1.unsqueeze(0).mm(tensor2).squeeze_(0);
-  } else if (dim_tensor1 == 2 && dim_tensor2 == 2) {
+  } else if (strategy == MatmulStrategy::MM) {
     return has_out ? at::mm_out(out, tensor1, tensor2) : tensor1.mm(tensor2);
-  } else if (should_fold(tensor1, tensor2)) {
+  } else if (strategy == MatmulStrategy::FOLD) {
     // dim_tensor1 >=3 && (dim_tensor2 == 1 || dim_tensor2 == 2) ||
     // dim_tensor2 >=3 && (dim_tensor1 == 1 || dim_tensor1 == 2)
     // and at least one of the following two conditions hold
@@ -16,6 +16,7 @@
 #include <ATen/native/Normalization.h>
 #include <ATen/native/Resize.h>
 #include <ATen/native/cpu/mixed_data_type.h>
+#include <c10/core/CPUAllocator.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -147,6 +148,12 @@ std::tuple<Tensor,Tensor,Tensor> batch_norm_cpu_transform_input_template(
     return std::make_tuple(output, save_mean, save_invstd);
   }
 
+  // Everything allocated below (the invstd expression temporaries and the
+  // broadcast views' storage) dies before this function returns; output and
+  // the saved stats were allocated by the caller.  Bump-allocate the lot and
+  // release it wholesale on exit.
+  c10::WithTemporaryAllocator temporary_allocator;
+
   const int64_t ndim = input.dim();
   // Helper to convert 1d tensors to an nd tensor that broadcasts with input
   // All elements go into the channel dimension
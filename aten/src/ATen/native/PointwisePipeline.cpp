@@ -0,0 +1,72 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/PointwisePipeline.h>
+
+#include <ATen/TensorIterator.h>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(pointwise_pipeline_stub);
+
+PointwisePipeline::PointwisePipeline(const Tensor& input) : input_(input) {
+  TORCH_CHECK(
+      input_.is_cpu(), "PointwisePipeline: expected a CPU tensor, got ",
+      input_.device());
+  TORCH_CHECK(
+      at::isFloatingType(input_.scalar_type()),
+      "PointwisePipeline: expected a floating point tensor, got ",
+      input_.scalar_type());
+}
+
+PointwisePipeline& PointwisePipeline::mul(double alpha) {
+  stages_.push_back({PointwiseStageKind::MUL, alpha});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::add(double alpha) {
+  stages_.push_back({PointwiseStageKind::ADD, alpha});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::clamp(double min, double max) {
+  stages_.push_back({PointwiseStageKind::CLAMP, min, max});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::clamp_min(double min) {
+  stages_.push_back({PointwiseStageKind::CLAMP_MIN, min});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::clamp_max(double max) {
+  stages_.push_back({PointwiseStageKind::CLAMP_MAX, max});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::neg() {
+  stages_.push_back({PointwiseStageKind::NEG});
+  return *this;
+}
+
+PointwisePipeline& PointwisePipeline::abs() {
+  stages_.push_back({PointwiseStageKind::ABS});
+  return *this;
+}
+
+Tensor PointwisePipeline::run() {
+  Tensor out;
+  auto iter = TensorIterator::unary_op(out, input_);
+  pointwise_pipeline_stub(
+      iter.device_type(), iter, stages_.data(), stages_.size());
+  return iter.output();
+}
+
+Tensor& PointwisePipeline::run_out(Tensor& out) {
+  auto iter = TensorIterator::unary_op(out, input_);
+  pointwise_pipeline_stub(
+      iter.device_type(), iter, stages_.data(), stages_.size());
+  return out;
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+#include <c10/util/SmallVector.h>
+
+namespace at {
+struct TensorIteratorBase;
+
+namespace native {
+
+// PointwisePipeline: deferred execution for chains of scalar-parameterized
+// pointwise ops.  A chain like (x * a + b).clamp(0, 1) executed eagerly
+// reads and writes memory once per op; the pipeline instead records the
+// stages and, on run(), executes the whole chain in a single pass through
+// the cpu_kernel_vec machinery -- one load, a few register ops per stage,
+// one store -- which is a large win for bandwidth-bound chains.
+//
+//   auto y = PointwisePipeline(x).mul(a).add(b).clamp(0, 1).run();
+//
+// Nothing is computed until run() (or run_out()) is called.  Stages apply
+// in recording order.  CPU floating point tensors only.
+
+enum class PointwiseStageKind : uint8_t {
+  MUL, // x * alpha
+  ADD, // x + alpha
+  CLAMP, // min(max(x, alpha), beta)
+  CLAMP_MIN, // max(x, alpha)
+  CLAMP_MAX, // min(x, alpha)
+  NEG, // -x
+  ABS, // |x|
+};
+
+struct PointwiseStage {
+  PointwiseStageKind kind;
+  double alpha = 0.0;
+  double beta = 0.0;
+};
+
+class TORCH_API PointwisePipeline {
+ public:
+  explicit PointwisePipeline(const Tensor& input);
+
+  PointwisePipeline& mul(double alpha);
+  PointwisePipeline& add(double alpha);
+  PointwisePipeline& clamp(double min, double max);
+  PointwisePipeline& clamp_min(double min);
+  PointwisePipeline& clamp_max(double max);
+  PointwisePipeline& neg();
+  PointwisePipeline& abs();
+
+  // Executes the recorded chain in one fused pass.
+  Tensor run();
+  Tensor& run_out(Tensor& out);
+
+ private:
+  Tensor input_;
+  c10::SmallVector<PointwiseStage, 8> stages_;
+};
+
+using pointwise_pipeline_fn =
+    void (*)(TensorIteratorBase&, const PointwiseStage*, int64_t);
+DECLARE_DISPATCH(pointwise_pipeline_fn, pointwise_pipeline_stub);
+
+} // namespace native
+} // namespace at
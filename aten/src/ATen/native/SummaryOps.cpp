@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -18,6 +19,63 @@ namespace at { namespace native {
 ///////////////// bincount /////////////////
 namespace {
 
+/* Accumulates bin counts for a contiguous input, parallelized with per-thread
+ * privatized bin arrays merged at the end - the same scheme
+ * cpu/HistogramKernel.cpp uses. Each thread's bins are padded out to whole
+ * cache lines so neighboring threads never write to the same line.
+ *
+ * Privatization only pays off while zeroing and merging the per-thread copies
+ * (proportional to num_threads * nbins) stays small next to the binning work
+ * itself, so huge bin counts keep the serial path.
+ *
+ * `weights_p` may be null; in the unweighted case the default weight is 1.
+ */
+template <typename input_t, typename weights_t>
+void _bincount_cpu_kernel(
+    weights_t* output_p,
+    const input_t* self_p,
+    int64_t self_size,
+    const weights_t* weights_p,
+    int64_t nbins,
+    const TensorOptions& bin_options) {
+  const auto num_threads = at::get_num_threads();
+  if (num_threads == 1 || self_size < at::internal::GRAIN_SIZE ||
+      nbins > self_size / num_threads) {
+    for (const auto i : c10::irange(self_size)) {
+      output_p[self_p[i]] +=
+          weights_p ? weights_p[i] : static_cast<weights_t>(1);
+    }
+    return;
+  }
+
+  constexpr int64_t cache_line_elts =
+      std::max<int64_t>(1, 64 / sizeof(weights_t));
+  const int64_t padded_nbins =
+      (nbins + cache_line_elts - 1) / cache_line_elts * cache_line_elts;
+  // The CPU allocator aligns to 64 bytes, so with padded rows every thread's
+  // bins start on their own cache line.
+  Tensor thread_bins = at::zeros({num_threads, padded_nbins}, bin_options);
+  weights_t* thread_bins_p = thread_bins.data_ptr<weights_t>();
+
+  at::parallel_for(
+      0, self_size, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        weights_t* bins = thread_bins_p + at::get_thread_num() * padded_nbins;
+        for (const auto i : c10::irange(begin, end)) {
+          bins[self_p[i]] += weights_p ? weights_p[i] : static_cast<weights_t>(1);
+        }
+      });
+
+  at::parallel_for(
+      0, nbins, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (const auto tid : c10::irange(num_threads)) {
+          const weights_t* bins = thread_bins_p + tid * padded_nbins;
+          for (const auto bin : c10::irange(begin, end)) {
+            output_p[bin] += bins[bin];
+          }
+        }
+      });
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -51,17 +109,22 @@ Tensor _bincount_cpu_template(
         weights.options().layout_opt(),
         weights.options().device_opt(),
         weights.options().pinned_memory_opt());
-    weights_t* output_p = output.data_ptr<weights_t>();
-    const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += weights_p[i];
-    }
+    _bincount_cpu_kernel(
+        output.data_ptr<weights_t>(),
+        self_p,
+        self_size,
+        weights.data_ptr<weights_t>(),
+        nbins,
+        output.options());
   } else {
     output = at::zeros({nbins}, kLong);
-    int64_t* output_p = output.data_ptr<int64_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += 1L;
-    }
+    _bincount_cpu_kernel(
+        output.data_ptr<int64_t>(),
+        self_p,
+        self_size,
+        static_cast<const int64_t*>(nullptr),
+        nbins,
+        output.options());
   }
   return output;
 }
@@ -1927,10 +1927,37 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   auto mask_prefix_sum = at::empty(shape, self.options().dtype(at::kLong));
   auto mask_long_data = mask_long.data_ptr<int64_t>();
   auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
-  // TODO: Here can only use std::partial_sum for C++14,
-  // use std::exclusive_scan when PyTorch upgrades to C++17, which have better performance.
-  // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
-  std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  // Two-phase parallel inclusive scan: each chunk counts its masked
+  // elements, a serial pass accumulates the (few) chunk totals into
+  // per-chunk offsets, and a second parallel pass writes the in-chunk
+  // prefix sums on top of those offsets. This replaces a serial
+  // std::partial_sum over the whole mask.
+  const auto mask_numel = mask_long.numel();
+  const auto num_threads = at::get_num_threads();
+  DimVector chunk_begin(num_threads, -1);
+  DimVector chunk_count_nonzero(num_threads + 1);
+  at::parallel_for(0, mask_numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const auto tid = at::get_thread_num();
+    chunk_begin[tid] = begin;
+    int64_t count = 0;
+    for (const auto i : c10::irange(begin, end)) {
+      count += mask_long_data[i];
+    }
+    chunk_count_nonzero[tid + 1] = count;
+  });
+  for (const auto i : c10::irange(1, chunk_count_nonzero.size())) {
+    chunk_count_nonzero[i] += chunk_count_nonzero[i - 1];
+  }
+  at::parallel_for(0, mask_numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const auto tid = at::get_thread_num();
+    // Work needs to be distributed the same on both passes
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(begin == chunk_begin[tid]);
+    int64_t running = chunk_count_nonzero[tid];
+    for (const auto i : c10::irange(begin, end)) {
+      running += mask_long_data[i];
+      mask_prefix_sum_data[i] = running;
+    }
+  });
 
   auto iter = TensorIteratorConfig()
     .set_check_mem_overlap(false)  // result is intentionally zero-strided above
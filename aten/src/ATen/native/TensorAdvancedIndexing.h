@@ -82,7 +82,15 @@ static inline bool can_use_expanded_index_path(
     // this is only perf beneficial when the inner dimension, aka, `channels`
     // is big enough.
     constexpr int64_t threshold = 16;
-    if (index.numel() / index.size(0) < threshold) {
+    // For 1-D inputs the iterator kernel has nothing to parallelize over
+    // (the scatter dimension itself is squashed) and runs fully serial,
+    // so the sort-and-reduce path wins despite the narrow rows once there
+    // is enough work; the stable radix sort also fixes the accumulation
+    // order, making the result deterministic under parallelism.
+    constexpr int64_t serial_nnz_threshold = 32768; // at::internal::GRAIN_SIZE
+    const bool would_run_serial =
+        index.dim() == 1 && index.numel() >= serial_nnz_threshold;
+    if (index.numel() / index.size(0) < threshold && !would_run_serial) {
       return false;
     }
   }
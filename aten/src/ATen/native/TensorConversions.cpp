@@ -1292,12 +1292,28 @@ Tensor coo_to_sparse_csr(const Tensor& self, c10::optional<int64_t> dense_dim_op
   if (dense_dim_opt.has_value()) {
     AT_ERROR("coo_to_sparse_csr conversion does not support specifying number of dense dimensions");
   }
+  auto* self_impl = at::sparse::get_sparse_impl(self);
+  // See Note [CSR conversion cache].  Repeated conversions of an unchanged
+  // tensor (e.g. a fixed adjacency matrix multiplied every training step)
+  // reuse the cached result; a fresh wrapper around the cached components is
+  // returned so callers never alias the cache slot itself.
+  auto cached = self_impl->csr_cache();
+  if (cached.defined()) {
+    return at::native::_sparse_csr_tensor_unsafe(
+        cached.crow_indices(),
+        cached.col_indices(),
+        cached.values(),
+        cached.sizes(),
+        cached.scalar_type(),
+        c10::kSparseCsr,
+        cached.device());
+  }
   auto coalesced_self = self.coalesce();
   auto row_indices = coalesced_self.indices()[0];
   bool out_int32 = (row_indices.scalar_type() == at::kInt);
   auto crow_indices = at::_convert_indices_from_coo_to_csr(
       row_indices, self.size(0), out_int32);
-  return at::native::_sparse_csr_tensor_unsafe(
+  auto result = at::native::_sparse_csr_tensor_unsafe(
       crow_indices,
       coalesced_self.indices()[1].contiguous(),
       coalesced_self.values(),
@@ -1305,6 +1321,8 @@ Tensor coo_to_sparse_csr(const Tensor& self, c10::optional<int64_t> dense_dim_op
       coalesced_self.scalar_type(),
       c10::kSparseCsr,
       coalesced_self.device());
+  self_impl->set_csr_cache(result);
+  return result;
 }
 
 Tensor coo_to_sparse_csc(const Tensor& self, c10::optional<int64_t> dense_dim_opt) {
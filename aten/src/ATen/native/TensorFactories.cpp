@@ -12,8 +12,10 @@
 #include <ATen/TensorOperators.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/native/UnaryOps.h>
+#include <c10/core/InferenceMode.h>
 #include <c10/core/ScalarType.h>
 #include <c10/core/TensorOptions.h>
+#include <c10/core/impl/cow/COW.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 #include <c10/util/MathConstants.h>
@@ -32,6 +34,7 @@
 #include <ATen/ops/_cast_Short_native.h>
 #include <ATen/ops/_dim_arange_native.h>
 #include <ATen/ops/_efficientzerotensor_native.h>
+#include <ATen/ops/_lazy_clone_native.h>
 #include <ATen/ops/_empty_affine_quantized.h>
 #include <ATen/ops/_empty_per_channel_affine_quantized.h>
 #include <ATen/ops/arange.h>
@@ -1613,6 +1616,30 @@ Tensor clone(const Tensor& src, c10::optional<c10::MemoryFormat> optional_memory
   return self;
 }
 
+Tensor _lazy_clone(const Tensor& self) {
+  if (c10::InferenceMode::is_enabled() || self.is_inference()) {
+    // Copy-on-write materialization happens in the generated
+    // ADInplaceOrView kernels, and InferenceMode excludes that key: an
+    // in-place write to the alias (or its source) would silently land in
+    // the still-shared storage. Copy eagerly instead of creating an alias
+    // that cannot be protected.
+    return self.clone();
+  }
+  c10::StorageImpl* self_storage = self.storage().unsafeGetStorageImpl();
+  c10::intrusive_ptr<c10::StorageImpl> storage =
+      c10::impl::cow::lazy_clone_storage(*self_storage);
+  if (storage == nullptr) {
+    // The storage isn't eligible for copy-on-write (e.g. it lives on an
+    // accelerator or doesn't own its data); copy eagerly instead.
+    return self.clone();
+  }
+  auto tensor = c10::make_intrusive<c10::TensorImpl>(
+      c10::Storage(std::move(storage)), self.key_set(), self.dtype());
+  tensor->set_sizes_and_strides(
+      self.sym_sizes(), self.sym_strides(), self.sym_storage_offset());
+  return Tensor(std::move(tensor));
+}
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~ named tensor overloads ~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // In the short term, these exist.
 // In the long term, we should move DimnameList into TensorOptions to avoid
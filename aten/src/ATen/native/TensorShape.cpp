@@ -564,11 +564,13 @@ TORCH_IMPL_FUNC(cat_out_cpu)
 
   auto materialized = tensors.materialize();
 
-  // fast path for single thread when both inputs and result are contiguous and not empty
-  bool use_serial_kernel = result.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1;
+  // fast path when both inputs and result are contiguous and not empty;
+  // small outputs are copied serially, large ones are partitioned across
+  // threads inside the kernel (the "serial" stub name is historical).
+  // See cpu/CatKernel.cpp.
   ScalarType dtype = materialized[valid].get().scalar_type();
   bool serial_dtype = at::isFloatingType(dtype);
-  if (use_serial_kernel && all_contiguous && all_same_dtype && serial_dtype) {
+  if (all_contiguous && all_same_dtype && serial_dtype) {
     cat_serial_stub(kCPU, result, materialized, dim);
     return;
   }
@@ -12,6 +12,7 @@
 #include <ATen/Dispatch.h>
 #include <ATen/OpMathType.h>
 #include <ATen/core/TensorBase.h>
+#include <ATen/cpu/PrecisionMode.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/native/TensorIterator.h>
@@ -301,10 +302,12 @@ void elu_backward_kernel(TensorIteratorBase& it, const Scalar& alpha, const Scal
   }
 }
 
-// TODO(yangxm): Add another fast kernel using formula
-// y = 0.5x * (1 + tanh(sqrt(2/Pi) * (x + 0.044715x^3)))
-// and the fast tanh impl from Eigen.
 void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
+  // In fast precision mode the vectorized lanes use the fast-math
+  // polynomial tier (fast_tanh is the Eigen-style rational tanh); the
+  // scalar tail stays on the precise library calls, so lanes and tail may
+  // differ by a couple ulp.
+  const bool fast_math = at::cpu::fast_math_enabled();
   auto grain_size = at::internal::GRAIN_SIZE;
   // Numbers based on benchmarking.
   // Benchmark: benchmarks/operator_benchmarks/pt/gelu_test.py
@@ -347,8 +350,12 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
             auto x1_cube = x1 * x1 * x1;
             auto inner_vec0 = kBetaVec * (x0 + kKappaVec * x0_cube);
             auto inner_vec1 = kBetaVec * (x1 + kKappaVec * x1_cube);
-            auto res0 = kPointFiveVec * x0 * (kOneVec + inner_vec0.tanh());
-            auto res1 = kPointFiveVec * x1 * (kOneVec + inner_vec1.tanh());
+            auto tanh_vec0 =
+                fast_math ? fast_tanh(inner_vec0) : inner_vec0.tanh();
+            auto tanh_vec1 =
+                fast_math ? fast_tanh(inner_vec1) : inner_vec1.tanh();
+            auto res0 = kPointFiveVec * x0 * (kOneVec + tanh_vec0);
+            auto res1 = kPointFiveVec * x1 * (kOneVec + tanh_vec1);
             return convert_float_bfloat16(res0, res1);
           },
           grain_size);
@@ -372,7 +379,9 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
             [&](Vec x_vec) {
               auto x_cube = x_vec * x_vec * x_vec;
               auto inner_vec = kBetaVec * (x_vec + kKappaVec * x_cube);
-              return kPointFiveVec * x_vec * (kOneVec + inner_vec.tanh());
+              auto tanh_vec =
+                  fast_math ? fast_tanh(inner_vec) : inner_vec.tanh();
+              return kPointFiveVec * x_vec * (kOneVec + tanh_vec);
             },
             grain_size);
       });
@@ -391,8 +400,12 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
           [&](Vectorized<BFloat16> x) -> Vectorized<BFloat16> {
             Vectorized<float> x0, x1;
             std::tie(x0, x1) = convert_bfloat16_float(x);
-            auto res0 = x0 * kPointFiveVec * (kOneVec + (x0 * kAlphaVec).erf());
-            auto res1 = x1 * kPointFiveVec * (kOneVec + (x1 * kAlphaVec).erf());
+            auto erf_vec0 = fast_math ? fast_erf(x0 * kAlphaVec)
+                                      : (x0 * kAlphaVec).erf();
+            auto erf_vec1 = fast_math ? fast_erf(x1 * kAlphaVec)
+                                      : (x1 * kAlphaVec).erf();
+            auto res0 = x0 * kPointFiveVec * (kOneVec + erf_vec0);
+            auto res1 = x1 * kPointFiveVec * (kOneVec + erf_vec1);
             return convert_float_bfloat16(res0, res1);
           },
           grain_size);
@@ -410,8 +423,9 @@ void GeluKernelImpl(TensorIteratorBase& it, GeluType approximate) {
               return x * scalar_t(0.5) * (scalar_t(1) + std::erf(x * kAlpha));
             },
             [&](Vec x_vec) {
-              return x_vec * kPointFiveVec *
-                  (kOneVec + (x_vec * kAlphaVec).erf());
+              auto erf_vec = fast_math ? fast_erf(x_vec * kAlphaVec)
+                                       : (x_vec * kAlphaVec).erf();
+              return x_vec * kPointFiveVec * (kOneVec + erf_vec);
             },
             grain_size);
       });
@@ -1,5 +1,10 @@
 #define TORCH_ASSERT_NO_OPERATORS
+#include <ATen/Context.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/native/CPUBlas.h>
 #include <c10/util/irange.h>
 #include <c10/util/Unroll.h>
@@ -53,6 +58,56 @@ auto sum(int64_t N, Func f) {
   return partial_sums[0];
 }
 
+// c[0:m] += val * a[0:m], vectorized. This file is compiled once per CPU
+// capability, so Vectorized resolves to the widest ISA of each build
+// (AVX2/AVX512 on x86, NEON on ARM) and the dispatch stub picks the best one
+// at runtime.
+template <typename scalar_t>
+void madd_col_(int64_t m, scalar_t val, const scalar_t* a, scalar_t* c) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const Vec val_vec(val);
+  int64_t i = 0;
+  for (; i + Vec::size() <= m; i += Vec::size()) {
+    vec::fmadd(Vec::loadu(a + i), val_vec, Vec::loadu(c + i)).store(c + i);
+  }
+  for (; i < m; ++i) {
+    c[i] += a[i] * val;
+  }
+}
+
+// Dot product of two contiguous vectors, vectorized with independent partial
+// accumulators (same ILP trick as sum() above).
+template <typename scalar_t>
+scalar_t dot_(int64_t n, const scalar_t* x, const scalar_t* y) {
+  using Vec = vec::Vectorized<scalar_t>;
+  constexpr int ilp_factor = 4;
+  Vec partial_sums[ilp_factor] = {
+      Vec(scalar_t(0)), Vec(scalar_t(0)), Vec(scalar_t(0)), Vec(scalar_t(0))};
+
+  int64_t i = 0;
+  for (; i + ilp_factor * Vec::size() <= n; i += ilp_factor * Vec::size()) {
+    c10::ForcedUnroll<ilp_factor>{}([&](int k) {
+      partial_sums[k] = vec::fmadd(
+          Vec::loadu(x + i + k * Vec::size()),
+          Vec::loadu(y + i + k * Vec::size()),
+          partial_sums[k]);
+    });
+  }
+  for (; i + Vec::size() <= n; i += Vec::size()) {
+    partial_sums[0] =
+        vec::fmadd(Vec::loadu(x + i), Vec::loadu(y + i), partial_sums[0]);
+  }
+  for (int k = 1; k < ilp_factor; ++k) {
+    partial_sums[0] += partial_sums[k];
+  }
+  scalar_t result = vec::vec_reduce_all<scalar_t>(
+      [](Vec a, Vec b) { return a + b; }, partial_sums[0]);
+  for (; i < n; ++i) {
+    result += x[i] * y[i];
+  }
+  return result;
+}
+
 template <typename scalar_t, typename opmath_t>
 typename std::enable_if<std::is_same<scalar_t, opmath_t>::value, void>::type
 gemm_notrans_(
@@ -74,16 +129,7 @@ gemm_notrans_(
   for (const auto l : c10::irange(k)) {
     for (const auto j : c10::irange(n)) {
       opmath_t val = b[l + j * ldb] * alpha;
-      int64_t i_m = m / 4;
-      for (const auto i_i : c10::irange(i_m)) {
-        c[j * ldc + i_i * 4 + 0] += a[i_i * 4 + 0 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 1] += a[i_i * 4 + 1 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 2] += a[i_i * 4 + 2 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 3] += a[i_i * 4 + 3 + l * lda] * val;
-      }
-      int64_t i = i_m * 4;
-      for (; i < m; i++)
-        c[j * ldc + i] += a[i + l * lda] * val;
+      madd_col_(m, val, a + l * lda, c + j * ldc);
     }
   }
 }
@@ -132,9 +178,15 @@ void gemm_transa_(
   for (const auto i : c10::irange(m)) {
     const scalar_t *b_ = b;
     for (const auto j : c10::irange(n)) {
-      const auto dot = sum(k, [&](int64_t l) -> opmath_t {
-        return static_cast<opmath_t>(a_[l]) * static_cast<opmath_t>(b_[l]);
-      });
+      opmath_t dot;
+      if constexpr (std::is_same_v<scalar_t, opmath_t>) {
+        // Both panels are contiguous over l, so the dot vectorizes directly
+        dot = dot_(k, a_, b_);
+      } else {
+        dot = sum(k, [&](int64_t l) -> opmath_t {
+          return static_cast<opmath_t>(a_[l]) * static_cast<opmath_t>(b_[l]);
+        });
+      }
       b_ += ldb;
       if (beta == opmath_t(0)) {
         c[j*ldc+i] = alpha*dot;
@@ -167,16 +219,7 @@ gemm_transb_(
   for (const auto l : c10::irange(k)) {
     for (const auto j : c10::irange(n)) {
       opmath_t val = b[j + l * ldb] * alpha;
-      int64_t i_m = m / 4;
-      for (const auto i_i : c10::irange(i_m)) {
-        c[j * ldc + i_i * 4 + 0] += a[i_i * 4 + 0 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 1] += a[i_i * 4 + 1 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 2] += a[i_i * 4 + 2 + l * lda] * val;
-        c[j * ldc + i_i * 4 + 3] += a[i_i * 4 + 3 + l * lda] * val;
-      }
-      int64_t i = i_m * 4;
-      for (; i < m; i++)
-        c[j * ldc + i] += a[i + l * lda] * val;
+      madd_col_(m, val, a + l * lda, c + j * ldc);
     }
   }
 }
@@ -263,6 +306,39 @@ void gemm_core_(
   }
 }
 
+// Tile the gemm over blocks of columns of c. Every variant in gemm_core_
+// writes c column-major, so tasks own disjoint output and only share
+// read-only panels of a and b; at::parallel_for falls back to a serial run
+// for small problems (via the grain size) and inside parallel regions.
+template <typename scalar_t, typename opmath_t>
+void gemm_parallel_(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    opmath_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    opmath_t beta,
+    scalar_t *c, int64_t ldc) {
+  // Stride between consecutive columns of c within b, matching how each
+  // branch of gemm_core_ indexes b by j
+  int64_t b_col_stride = 1;
+  if ((transa == TransposeType::NoTranspose &&
+       transb == TransposeType::NoTranspose) ||
+      (transa == TransposeType::Transpose &&
+       transb != TransposeType::Transpose)) {
+    b_col_stride = ldb;
+  }
+
+  const int64_t work_per_col = std::max<int64_t>(m * k, 1);
+  const int64_t grain =
+      std::max<int64_t>(at::internal::GRAIN_SIZE / work_per_col, 1);
+  at::parallel_for(0, n, grain, [&](int64_t begin, int64_t end) {
+    gemm_core_(
+        transa, transb, m, end - begin, k, alpha, a, lda,
+        b + begin * b_col_stride, ldb, beta, c + begin * ldc, ldc);
+  });
+}
+
 void cpublas_gemm_impl(
     at::ScalarType type,
     TransposeType transa, TransposeType transb,
@@ -275,8 +351,23 @@ void cpublas_gemm_impl(
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(at::kHalf, at::kBFloat16,
     type, "cpublas_gemm_impl",
       [&]{
+        if constexpr (std::is_same_v<scalar_t, at::BFloat16>) {
+          // Opt-in reduced-precision math mode: accumulate in BFloat16
+          // instead of upconverting to Float. See
+          // Context::allowBF16ReductionCPU.
+          if (at::globalContext().allowBF16ReductionCPU()) {
+            gemm_parallel_(
+                transa, transb, m, n, k,
+                alpha.to<scalar_t>(),
+                static_cast<const scalar_t *>(a), lda,
+                static_cast<const scalar_t *>(b), ldb,
+                beta.to<scalar_t>(),
+                static_cast<scalar_t *>(c), ldc);
+            return;
+          }
+        }
         using opmath_t = at::opmath_type<scalar_t>;
-        gemm_core_(
+        gemm_parallel_(
             transa, transb, m, n, k,
             alpha.to<opmath_t>(),
             static_cast<const scalar_t *>(a), lda,
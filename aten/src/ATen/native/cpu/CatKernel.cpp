@@ -2,11 +2,14 @@
 #include <ATen/core/Tensor.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+
 namespace at::native {
 
 namespace {
@@ -20,6 +23,22 @@ struct InputMeta {
     , inner_size(t.sizes()[dim] * inner) {}
 };
 
+template <typename scalar_t>
+inline void copy_chunk(scalar_t* result_ptr, const scalar_t* input_ptr, int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec in_vec = Vec::loadu(input_ptr + d);
+    in_vec.store(result_ptr + d);
+  }
+  #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+  # pragma unroll
+  #endif
+  for (; d < size; d++) {
+    result_ptr[d] = input_ptr[d];
+  }
+}
+
 template <typename scalar_t>
 void cat_serial_kernel_impl(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
   TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
@@ -33,31 +52,65 @@ void cat_serial_kernel_impl(const Tensor& result, const MaterializedITensorListR
     inputs.emplace_back(tensor, dim, result.strides()[dim]);
   }
 
-  using Vec = vec::Vectorized<scalar_t>;
   scalar_t* result_ptr = result_data;
   for (const auto i : c10::irange(outer)) {
     for (const auto j : c10::irange(ninputs)) {
       int64_t local_inner = inputs[j].inner_size;
       scalar_t* input_ptr = (scalar_t*)(inputs[j].data_ptr) + i * local_inner;
-      int64_t d = 0;
-      for (; d < local_inner - (local_inner % Vec::size()); d += Vec::size()) {
-        Vec in_vec = Vec::loadu(input_ptr + d);
-        in_vec.store(result_ptr + d);
-      }
-      #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
-      # pragma unroll
-      #endif
-      for (; d < local_inner; d++) {
-        result_ptr[d] = input_ptr[d];
-      }
+      copy_chunk(result_ptr, input_ptr, local_inner);
       result_ptr += local_inner;
     }
   }
 }
 
+// Partitions the flat output across threads so that a cat of many small
+// inputs is no longer bound to one core. Each thread resolves the
+// (outer, input) pair owning the first element of its [begin, end) range
+// via the prefix sums of the per-input inner sizes, then walks the
+// following segments in output order.
+template <typename scalar_t>
+void cat_parallel_kernel_impl(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(), "dim out of range in cat_parallel_kernel_impl");
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+  int64_t ninputs = static_cast<int64_t>(tensors.size());
+  std::vector<InputMeta> inputs;
+  inputs.reserve(ninputs);
+  std::vector<int64_t> offsets(ninputs + 1, 0);
+  int64_t k = 0;
+  for (const Tensor& tensor : tensors) {
+    inputs.emplace_back(tensor, dim, result.strides()[dim]);
+    offsets[k + 1] = offsets[k] + inputs[k].inner_size;
+    k++;
+  }
+  int64_t inner_total = offsets[ninputs];
+
+  at::parallel_for_calibrated("cat_serial_cpu", 0, result.numel(), internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    int64_t i = begin / inner_total;
+    int64_t row = begin - i * inner_total;
+    int64_t j = std::upper_bound(offsets.begin(), offsets.end(), row) - offsets.begin() - 1;
+    int64_t pos = begin;
+    while (pos < end) {
+      int64_t seg_end = std::min(end, i * inner_total + offsets[j + 1]);
+      const scalar_t* input_ptr = (const scalar_t*)(inputs[j].data_ptr)
+          + i * inputs[j].inner_size + (pos - i * inner_total - offsets[j]);
+      copy_chunk(result_data + pos, input_ptr, seg_end - pos);
+      pos = seg_end;
+      if (++j == ninputs) {
+        j = 0;
+        i++;
+      }
+    }
+  });
+}
+
 void cat_serial_kernel(const Tensor& result, const MaterializedITensorListRef& tensors, int64_t dim) {
   AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, result.scalar_type(), "cat_serial_kernel", [&]() {
-    cat_serial_kernel_impl<scalar_t>(result, tensors, dim);
+    if (result.numel() >= internal::GRAIN_SIZE && at::get_num_threads() > 1) {
+      cat_parallel_kernel_impl<scalar_t>(result, tensors, dim);
+    } else {
+      cat_serial_kernel_impl<scalar_t>(result, tensors, dim);
+    }
   });
 }
 
@@ -0,0 +1,321 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/CPUBlas.h>
+#include <ATen/native/cpu/utils.h>
+#include <ATen/native/transformers/attention.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// Flash-attention style tiled CPU kernel for scaled dot product attention.
+//
+// Instead of materializing the full [B, H, q_len, kv_len] score matrix, we
+// walk the key/value sequence in blocks of kv_split_size per block of
+// q_split_size queries, keeping the score tile, the running row maxima and
+// normalizers and the (unnormalized) output accumulator in thread-local
+// buffers that are sized to stay cache-resident.  The softmax is computed
+// online: whenever a new key block raises a row's maximum, the accumulated
+// output row and normalizer are rescaled by exp(max_old - max_new) before
+// the block's contribution is added.  All accumulation happens in
+// at::opmath_type<scalar_t> (float for bf16 inputs), only the final result
+// is rounded back to scalar_t.
+template <typename scalar_t, int64_t q_split_size, int64_t kv_split_size>
+void cpu_flash_attention(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const at::Tensor& q,
+    const at::Tensor& k,
+    const at::Tensor& v,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  using accum_t = at::opmath_type<scalar_t>;
+  using Vec = vec::Vectorized<accum_t>;
+  constexpr bool need_convert = !std::is_same<scalar_t, accum_t>::value;
+
+  // Query (Batch x Num_heads x Q_seq_len x Dim_per_head)
+  //    -> (Batch x Q_seq_len x Num_heads x Dim_per_head)
+  at::Tensor query = q.transpose(1, 2);
+  at::Tensor key = k.transpose(1, 2);
+  at::Tensor value = v.transpose(1, 2);
+
+  int64_t batchSize = query.size(0);
+  int64_t qSize = query.size(1);
+  int64_t kvSize = value.size(1);
+  int64_t num_head = query.size(2);
+  int64_t headSize = query.size(3);
+
+  accum_t scaling_factor = scale.has_value()
+      ? static_cast<accum_t>(*scale)
+      : static_cast<accum_t>(1.0 / std::sqrt(static_cast<double>(headSize)));
+
+  // Strides
+  int64_t qStrideB = query.stride(0);
+  int64_t qStrideM = query.stride(1);
+  int64_t qStrideH = query.stride(2);
+  int64_t kStrideB = key.stride(0);
+  int64_t kStrideN = key.stride(1);
+  int64_t kStrideH = key.stride(2);
+  int64_t vStrideB = value.stride(0);
+  int64_t vStrideN = value.stride(1);
+  int64_t vStrideH = value.stride(2);
+  int64_t oStrideB = output.stride(0);
+  int64_t oStrideM = output.stride(1);
+  int64_t oStrideH = output.stride(2);
+  int64_t lStrideB = logsumexp.stride(0);
+  int64_t lStrideM = logsumexp.stride(1);
+  int64_t lStrideH = logsumexp.stride(2);
+
+  int64_t qSplitSize = q_split_size > qSize ? qSize : q_split_size;
+  int64_t kvSplitSize = kv_split_size > kvSize ? kvSize : kv_split_size;
+  int64_t qSlice = (qSize + qSplitSize - 1) / qSplitSize;
+  int64_t num_thread = at::get_num_threads();
+
+  // Per-thread scratch: score tile, running max/sum, output accumulator,
+  // plus conversion buffers for reduced-precision inputs.
+  int64_t size_per_thread =
+      /* qk     */ qSplitSize * kvSplitSize +
+      /* qk_max */ qSplitSize +
+      /* qk_sum */ qSplitSize +
+      /* dst    */ qSplitSize * headSize;
+  if (need_convert) {
+    size_per_thread +=
+        /* q tile */ qSplitSize * headSize +
+        /* k tile */ kvSplitSize * headSize +
+        /* v tile */ kvSplitSize * headSize;
+  }
+
+  at::Tensor buf = at::empty(
+      {num_thread, size_per_thread},
+      query.options().dtype(c10::CppTypeToScalarType<accum_t>::value));
+
+  scalar_t* q_data = query.data_ptr<scalar_t>();
+  scalar_t* k_data = key.data_ptr<scalar_t>();
+  scalar_t* v_data = value.data_ptr<scalar_t>();
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  accum_t* lse_data = logsumexp.data_ptr<accum_t>();
+  accum_t* buf_data = buf.data_ptr<accum_t>();
+
+  at::parallel_for(0, batchSize * num_head * qSlice, 1, [&](int64_t begin, int64_t end) {
+    int64_t i = 0, j = 0, kk = 0;
+    data_index_init(begin, i, batchSize, j, num_head, kk, qSlice);
+
+    accum_t* thread_buf = buf_data + at::get_thread_num() * size_per_thread;
+    accum_t* qk = thread_buf;
+    accum_t* qk_max = qk + qSplitSize * kvSplitSize;
+    accum_t* qk_sum = qk_max + qSplitSize;
+    accum_t* dst = qk_sum + qSplitSize;
+    accum_t* q_tile = nullptr;
+    accum_t* k_tile = nullptr;
+    accum_t* v_tile = nullptr;
+    if (need_convert) {
+      q_tile = dst + qSplitSize * headSize;
+      k_tile = q_tile + qSplitSize * headSize;
+      v_tile = k_tile + kvSplitSize * headSize;
+    }
+
+    for (C10_UNUSED auto z : c10::irange(begin, end)) {
+      int64_t m = kk * qSplitSize;
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+
+      // Initialize the online softmax state for this query block
+      std::fill_n(qk_max, qBlockSize, -std::numeric_limits<accum_t>::infinity());
+      std::fill_n(qk_sum, qBlockSize, static_cast<accum_t>(0));
+      std::fill_n(dst, qBlockSize * headSize, static_cast<accum_t>(0));
+
+      const scalar_t* q_block =
+          q_data + i * qStrideB + j * qStrideH + m * qStrideM;
+      int64_t q_ld = qStrideM;
+      const accum_t* q_gemm_ptr = nullptr;
+      if constexpr (need_convert) {
+        for (const auto row : c10::irange(qBlockSize)) {
+          for (const auto d : c10::irange(headSize)) {
+            q_tile[row * headSize + d] =
+                static_cast<accum_t>(q_block[row * qStrideM + d]);
+          }
+        }
+        q_gemm_ptr = q_tile;
+        q_ld = headSize;
+      } else {
+        q_gemm_ptr = q_block;
+      }
+
+      int64_t num_keys =
+          is_causal ? std::min(m + qBlockSize, kvSize) : kvSize;
+      for (int64_t n = 0; n < num_keys; n += kvSplitSize) {
+        int64_t kvBlockSize = std::min(kvSplitSize, num_keys - n);
+
+        const scalar_t* k_block =
+            k_data + i * kStrideB + j * kStrideH + n * kStrideN;
+        const scalar_t* v_block =
+            v_data + i * vStrideB + j * vStrideH + n * vStrideN;
+        int64_t k_ld = kStrideN;
+        int64_t v_ld = vStrideN;
+        const accum_t* k_gemm_ptr = nullptr;
+        const accum_t* v_gemm_ptr = nullptr;
+        if constexpr (need_convert) {
+          for (const auto row : c10::irange(kvBlockSize)) {
+            for (const auto d : c10::irange(headSize)) {
+              k_tile[row * headSize + d] =
+                  static_cast<accum_t>(k_block[row * kStrideN + d]);
+              v_tile[row * headSize + d] =
+                  static_cast<accum_t>(v_block[row * vStrideN + d]);
+            }
+          }
+          k_gemm_ptr = k_tile;
+          v_gemm_ptr = v_tile;
+          k_ld = headSize;
+          v_ld = headSize;
+        } else {
+          k_gemm_ptr = k_block;
+          v_gemm_ptr = v_block;
+        }
+
+        // qk <- scaling_factor * Q_tile @ K_tile^T
+        // Row-major [qBlockSize, kvBlockSize] expressed through the
+        // column-major BLAS interface.
+        cpublas::gemm(
+            TransposeType::Transpose,
+            TransposeType::NoTranspose,
+            kvBlockSize,
+            qBlockSize,
+            headSize,
+            scaling_factor,
+            k_gemm_ptr,
+            k_ld,
+            q_gemm_ptr,
+            q_ld,
+            static_cast<accum_t>(0),
+            qk,
+            kvBlockSize);
+
+        // Online softmax update, one query row at a time
+        for (const auto row : c10::irange(qBlockSize)) {
+          accum_t* qk_row = qk + row * kvBlockSize;
+          int64_t valid = is_causal
+              ? std::min(m + row - n + 1, kvBlockSize)
+              : kvBlockSize;
+          if (valid <= 0) {
+            // This row attends to no key in the block; zero it out so the
+            // value GEMM adds nothing.
+            std::fill_n(qk_row, kvBlockSize, static_cast<accum_t>(0));
+            continue;
+          }
+          accum_t block_max = vec::reduce_all<accum_t>(
+              [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+              qk_row,
+              valid);
+          accum_t max_old = qk_max[row];
+          accum_t max_new = std::max(max_old, block_max);
+          vec::map<accum_t>(
+              [max_new](Vec x) { return (x - Vec(max_new)).exp(); },
+              qk_row,
+              qk_row,
+              valid);
+          if (valid < kvBlockSize) {
+            std::fill_n(qk_row + valid, kvBlockSize - valid, static_cast<accum_t>(0));
+          }
+          accum_t block_sum = vec::reduce_all<accum_t>(
+              [](Vec& x, Vec& y) { return x + y; },
+              qk_row,
+              valid);
+          accum_t rescale = max_old == -std::numeric_limits<accum_t>::infinity()
+              ? static_cast<accum_t>(0)
+              : std::exp(max_old - max_new);
+          qk_sum[row] = qk_sum[row] * rescale + block_sum;
+          if (rescale != static_cast<accum_t>(1)) {
+            vec::map<accum_t>(
+                [rescale](Vec x) { return x * Vec(rescale); },
+                dst + row * headSize,
+                dst + row * headSize,
+                headSize);
+          }
+          qk_max[row] = max_new;
+        }
+
+        // dst <- dst + P_tile @ V_tile
+        cpublas::gemm(
+            TransposeType::NoTranspose,
+            TransposeType::NoTranspose,
+            headSize,
+            qBlockSize,
+            kvBlockSize,
+            static_cast<accum_t>(1),
+            v_gemm_ptr,
+            v_ld,
+            qk,
+            kvBlockSize,
+            static_cast<accum_t>(1),
+            dst,
+            headSize);
+      }
+
+      // Normalize and write back
+      for (const auto row : c10::irange(qBlockSize)) {
+        accum_t sum = qk_sum[row];
+        accum_t inv_sum = sum == static_cast<accum_t>(0)
+            ? static_cast<accum_t>(0)
+            : static_cast<accum_t>(1) / sum;
+        scalar_t* out_row =
+            out_data + i * oStrideB + j * oStrideH + (m + row) * oStrideM;
+        const accum_t* dst_row = dst + row * headSize;
+        for (const auto d : c10::irange(headSize)) {
+          out_row[d] = static_cast<scalar_t>(dst_row[d] * inv_sum);
+        }
+        lse_data[i * lStrideB + j * lStrideH + (m + row) * lStrideM] =
+            qk_max[row] + std::log(sum);
+      }
+
+      data_index_step(i, batchSize, j, num_head, kk, qSlice);
+    }
+  });
+}
+
+void flash_attention_kernel_impl(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      dropout_p == 0.0,
+      "flash_attention on CPU does not support dropout > 0");
+  auto q_seq_len = query.size(2);
+
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      kBFloat16, query.scalar_type(), "flash_attention", [&] {
+        if (q_seq_len >= 768) {
+          cpu_flash_attention<scalar_t, 256, 512>(
+              output, logsumexp, query, key, value, dropout_p, is_causal, scale);
+        } else if (q_seq_len >= 192) {
+          cpu_flash_attention<scalar_t, 64, 512>(
+              output, logsumexp, query, key, value, dropout_p, is_causal, scale);
+        } else {
+          cpu_flash_attention<scalar_t, 32, 512>(
+              output, logsumexp, query, key, value, dropout_p, is_causal, scale);
+        }
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(flash_attention_kernel, &flash_attention_kernel_impl);
+
+} // namespace at::native
@@ -0,0 +1,96 @@
+#define TORCH_ASSERT_NO_OPERATORS
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/native/Float8Conversion.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cpu/Loops.h>
+
+namespace at::native {
+namespace {
+
+using namespace float8;
+
+void pack_float8_kernel(TensorIteratorBase& iter, bool e5m2) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, iter.dtype(1), "_pack_float8", [&]() {
+        if (e5m2) {
+          cpu_kernel(iter, [](scalar_t v) -> uint8_t {
+            return fp8e5m2_from_fp32_value(static_cast<float>(v));
+          });
+        } else {
+          cpu_kernel(iter, [](scalar_t v) -> uint8_t {
+            return fp8e4m3fn_from_fp32_value(static_cast<float>(v));
+          });
+        }
+      });
+}
+
+void unpack_float8_kernel(TensorIteratorBase& iter, bool e5m2) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, iter.dtype(0), "_unpack_float8", [&]() {
+        if (e5m2) {
+          cpu_kernel(iter, [](uint8_t v) -> scalar_t {
+            return static_cast<scalar_t>(fp8e5m2_to_fp32_value(v));
+          });
+        } else {
+          cpu_kernel(iter, [](uint8_t v) -> scalar_t {
+            return static_cast<scalar_t>(fp8e4m3fn_to_fp32_value(v));
+          });
+        }
+      });
+}
+
+void float8_index_select_kernel(
+    const Tensor& out,
+    const Tensor& self,
+    const Tensor& index,
+    bool e5m2) {
+  const int64_t num_indices = index.numel();
+  const int64_t num_rows = self.size(0);
+  const int64_t row = self.size(1);
+  const uint8_t* src = self.data_ptr<uint8_t>();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, out.scalar_type(), "_float8_index_select", [&]() {
+        scalar_t* dst = out.data_ptr<scalar_t>();
+        AT_DISPATCH_INDEX_TYPES(
+            index.scalar_type(), "_float8_index_select", [&]() {
+              const index_t* idx = index.data_ptr<index_t>();
+              at::parallel_for(
+                  0,
+                  num_indices,
+                  std::max(
+                      int64_t(1), internal::GRAIN_SIZE / std::max(row, int64_t(1))),
+                  [&](int64_t begin, int64_t end) {
+                    for (const auto i : c10::irange(begin, end)) {
+                      const auto j = idx[i];
+                      TORCH_CHECK(
+                          j >= 0 && j < num_rows,
+                          "index out of range in _float8_index_select: ",
+                          j);
+                      const uint8_t* s = src + int64_t(j) * row;
+                      scalar_t* d = dst + i * row;
+                      if (e5m2) {
+                        for (const auto c : c10::irange(row)) {
+                          d[c] =
+                              static_cast<scalar_t>(fp8e5m2_to_fp32_value(s[c]));
+                        }
+                      } else {
+                        for (const auto c : c10::irange(row)) {
+                          d[c] = static_cast<scalar_t>(
+                              fp8e4m3fn_to_fp32_value(s[c]));
+                        }
+                      }
+                    }
+                  });
+            });
+      });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(pack_float8_stub, &pack_float8_kernel);
+REGISTER_DISPATCH(unpack_float8_stub, &unpack_float8_kernel);
+REGISTER_DISPATCH(float8_index_select_stub, &float8_index_select_kernel);
+
+} // namespace at::native
@@ -0,0 +1,246 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/DispatchStub.h>
+#include <ATen/native/FusedAdam.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+// Full-precision types: vectorize the flat buffers. The per-step scalars
+// (bias corrections, step size) are hoisted out of the loop and broadcast
+// into vector lanes.
+template <typename scalar_t>
+typename std::enable_if<std::is_same<scalar_t, at::opmath_type<scalar_t>>::value, void>::type
+adam_math(
+    scalar_t* param_ptr,
+    scalar_t* grad_ptr,
+    scalar_t* exp_avg_ptr,
+    scalar_t* exp_avg_sq_ptr,
+    scalar_t* max_exp_avg_sq_ptr,
+    const int64_t size,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr,
+    const double step,
+    const ADAM_MODE adam_mode
+) {
+  using Vec = at::vec::Vectorized<scalar_t>;
+  const scalar_t step_size = lr / (1 - std::pow(beta1, step));
+  const scalar_t bias_correction2_sqrt = std::sqrt(1 - std::pow(beta2, step));
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec grad_vec = Vec::loadu(grad_ptr + d);
+    if (grad_scale_ptr) {
+      grad_vec = grad_vec / Vec(scalar_t(*grad_scale_ptr));
+      grad_vec.store(grad_ptr + d);
+    }
+    if (maximize) {
+      grad_vec = grad_vec.neg();
+    }
+    Vec param_vec = Vec::loadu(param_ptr + d);
+    if (weight_decay != 0) {
+      switch (adam_mode) {
+        case ADAM_MODE::ORIGINAL:
+          grad_vec = grad_vec + param_vec * Vec(scalar_t(weight_decay));
+          break;
+        case ADAM_MODE::ADAMW:
+          param_vec = param_vec - param_vec * Vec(scalar_t(lr * weight_decay));
+          break;
+      }
+    }
+    Vec exp_avg_vec = Vec::loadu(exp_avg_ptr + d) * Vec(scalar_t(beta1)) +
+        grad_vec * Vec(scalar_t(1 - beta1));
+    Vec exp_avg_sq_vec = Vec::loadu(exp_avg_sq_ptr + d) * Vec(scalar_t(beta2)) +
+        grad_vec * grad_vec * Vec(scalar_t(1 - beta2));
+    exp_avg_vec.store(exp_avg_ptr + d);
+    exp_avg_sq_vec.store(exp_avg_sq_ptr + d);
+    Vec denom_vec;
+    if (amsgrad) {
+      Vec max_exp_avg_sq_vec =
+          at::vec::maximum(Vec::loadu(max_exp_avg_sq_ptr + d), exp_avg_sq_vec);
+      max_exp_avg_sq_vec.store(max_exp_avg_sq_ptr + d);
+      denom_vec =
+          max_exp_avg_sq_vec.sqrt() / Vec(bias_correction2_sqrt) + Vec(scalar_t(eps));
+    } else {
+      denom_vec =
+          exp_avg_sq_vec.sqrt() / Vec(bias_correction2_sqrt) + Vec(scalar_t(eps));
+    }
+    param_vec = param_vec - Vec(step_size) * exp_avg_vec / denom_vec;
+    param_vec.store(param_ptr + d);
+  }
+  for (; d < size; d++) {
+    scalar_t grad = grad_ptr[d];
+    if (grad_scale_ptr) {
+      grad /= scalar_t(*grad_scale_ptr);
+      grad_ptr[d] = grad;
+    }
+    if (maximize) {
+      grad = -grad;
+    }
+    scalar_t param = param_ptr[d];
+    if (weight_decay != 0) {
+      switch (adam_mode) {
+        case ADAM_MODE::ORIGINAL:
+          grad += param * weight_decay;
+          break;
+        case ADAM_MODE::ADAMW:
+          param -= lr * weight_decay * param;
+          break;
+      }
+    }
+    scalar_t exp_avg = exp_avg_ptr[d] * beta1 + grad * (1 - beta1);
+    scalar_t exp_avg_sq = exp_avg_sq_ptr[d] * beta2 + grad * grad * (1 - beta2);
+    exp_avg_ptr[d] = exp_avg;
+    exp_avg_sq_ptr[d] = exp_avg_sq;
+    scalar_t denom;
+    if (amsgrad) {
+      scalar_t max_exp_avg_sq = std::max(max_exp_avg_sq_ptr[d], exp_avg_sq);
+      max_exp_avg_sq_ptr[d] = max_exp_avg_sq;
+      denom = std::sqrt(max_exp_avg_sq) / bias_correction2_sqrt + eps;
+    } else {
+      denom = std::sqrt(exp_avg_sq) / bias_correction2_sqrt + eps;
+    }
+    param_ptr[d] = param - step_size * exp_avg / denom;
+  }
+}
+
+// Reduced-precision types: do the math elementwise in opmath precision.
+// Half/BFloat16 lanes would lose the moment updates to rounding, so we
+// pay the conversion per element instead of per vector.
+template <typename scalar_t>
+typename std::enable_if<!std::is_same<scalar_t, at::opmath_type<scalar_t>>::value, void>::type
+adam_math(
+    scalar_t* param_ptr,
+    scalar_t* grad_ptr,
+    scalar_t* exp_avg_ptr,
+    scalar_t* exp_avg_sq_ptr,
+    scalar_t* max_exp_avg_sq_ptr,
+    const int64_t size,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr,
+    const double step,
+    const ADAM_MODE adam_mode
+) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  const opmath_t step_size = lr / (1 - std::pow(beta1, step));
+  const opmath_t bias_correction2_sqrt = std::sqrt(1 - std::pow(beta2, step));
+  for (const auto d : c10::irange(size)) {
+    opmath_t grad = static_cast<opmath_t>(grad_ptr[d]);
+    if (grad_scale_ptr) {
+      grad /= static_cast<opmath_t>(*grad_scale_ptr);
+      grad_ptr[d] = static_cast<scalar_t>(grad);
+    }
+    if (maximize) {
+      grad = -grad;
+    }
+    opmath_t param = static_cast<opmath_t>(param_ptr[d]);
+    if (weight_decay != 0) {
+      switch (adam_mode) {
+        case ADAM_MODE::ORIGINAL:
+          grad += param * weight_decay;
+          break;
+        case ADAM_MODE::ADAMW:
+          param -= lr * weight_decay * param;
+          break;
+      }
+    }
+    opmath_t exp_avg =
+        static_cast<opmath_t>(exp_avg_ptr[d]) * beta1 + grad * (1 - beta1);
+    opmath_t exp_avg_sq =
+        static_cast<opmath_t>(exp_avg_sq_ptr[d]) * beta2 + grad * grad * (1 - beta2);
+    exp_avg_ptr[d] = static_cast<scalar_t>(exp_avg);
+    exp_avg_sq_ptr[d] = static_cast<scalar_t>(exp_avg_sq);
+    opmath_t denom;
+    if (amsgrad) {
+      opmath_t max_exp_avg_sq = std::max(
+          static_cast<opmath_t>(max_exp_avg_sq_ptr[d]), exp_avg_sq);
+      max_exp_avg_sq_ptr[d] = static_cast<scalar_t>(max_exp_avg_sq);
+      denom = std::sqrt(max_exp_avg_sq) / bias_correction2_sqrt + eps;
+    } else {
+      denom = std::sqrt(exp_avg_sq) / bias_correction2_sqrt + eps;
+    }
+    param_ptr[d] = static_cast<scalar_t>(param - step_size * exp_avg / denom);
+  }
+}
+
+void fused_adam_kernel(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    const at::Tensor& state_step,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr,
+    const ADAM_MODE adam_mode
+) {
+  TORCH_CHECK(
+      param.is_contiguous() && grad.is_contiguous() &&
+          exp_avg.is_contiguous() && exp_avg_sq.is_contiguous() &&
+          (!amsgrad || max_exp_avg_sq.is_contiguous()),
+      "fused adam requires contiguous tensors");
+  const double step = state_step.item<float>();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, param.scalar_type(), "fused_adam_kernel_cpu", [&] {
+        scalar_t* param_ptr = param.data_ptr<scalar_t>();
+        scalar_t* grad_ptr = grad.data_ptr<scalar_t>();
+        scalar_t* exp_avg_ptr = exp_avg.data_ptr<scalar_t>();
+        scalar_t* exp_avg_sq_ptr = exp_avg_sq.data_ptr<scalar_t>();
+        scalar_t* max_exp_avg_sq_ptr =
+            amsgrad ? max_exp_avg_sq.data_ptr<scalar_t>() : nullptr;
+        at::parallel_for(
+            0,
+            param.numel(),
+            at::internal::GRAIN_SIZE,
+            [&](int64_t begin, int64_t end) {
+              adam_math<scalar_t>(
+                  param_ptr + begin,
+                  grad_ptr + begin,
+                  exp_avg_ptr + begin,
+                  exp_avg_sq_ptr + begin,
+                  amsgrad ? max_exp_avg_sq_ptr + begin : nullptr,
+                  end - begin,
+                  lr,
+                  beta1,
+                  beta2,
+                  weight_decay,
+                  eps,
+                  amsgrad,
+                  maximize,
+                  grad_scale_ptr,
+                  step,
+                  adam_mode);
+            });
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(fused_adam_stub, &fused_adam_kernel);
+
+}} // namespace at::native
@@ -1,7 +1,9 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/native/IndexKernel.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 
 #include <ATen/Context.h>
@@ -20,9 +22,155 @@ namespace {
 
 using namespace vec;
 
+// Checked scalar gather over contiguous int64 indices, with software
+// prefetch of the gather targets: embedding-style index reads are memory
+// latency bound, so having loads for upcoming rows in flight is most of
+// the win. Also serves as the tail/error path of the vectorized gather
+// below (it throws on the first out-of-range index, like Indexer::get).
+template <typename scalar_t>
+void gather_scalar_checked(
+    char* dst,
+    const char* src,
+    const int64_t* idx,
+    int64_t n,
+    int64_t dim_size,
+    int64_t stride_bytes) {
+  constexpr int64_t kPrefetchDistance = 16;
+  for (const auto i : c10::irange(n)) {
+    if (i + kPrefetchDistance < n) {
+      int64_t v = idx[i + kPrefetchDistance];
+      if (v >= -dim_size && v < dim_size) {
+        if (v < 0) {
+          v += dim_size;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(src + v * stride_bytes);
+#endif
+      }
+    }
+    int64_t value = idx[i];
+    TORCH_CHECK_INDEX(
+        value >= -dim_size && value < dim_size,
+        "index ", value, " is out of bounds for dimension ", 0, " with size ", dim_size);
+    if (value < 0) {
+      value += dim_size;
+    }
+    std::memcpy(dst + i * sizeof(scalar_t), src + value * stride_bytes, sizeof(scalar_t));
+  }
+}
+
+#if defined(CPU_CAPABILITY_AVX512)
+// Hardware-gather version for 4/8-byte elements: normalize and range-check
+// eight indices at a time, then fetch the elements with a single vgather.
+// Out-of-range indices drop to the scalar path, which throws.
+template <typename scalar_t>
+void vectorized_gather(
+    char* dst,
+    const char* src,
+    const int64_t* idx,
+    int64_t n,
+    int64_t dim_size,
+    int64_t stride_bytes) {
+  static_assert(
+      sizeof(scalar_t) == 4 || sizeof(scalar_t) == 8,
+      "vectorized_gather handles 4/8-byte elements only");
+  constexpr int64_t kPrefetchDistance = 64;
+  const __m512i vzero = _mm512_setzero_si512();
+  const __m512i vsize = _mm512_set1_epi64(dim_size);
+  const __m512i vstride = _mm512_set1_epi64(stride_bytes);
+  int64_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int64_t pf = i + kPrefetchDistance;
+    const int64_t pf_end = std::min(pf + 8, n);
+    for (; pf < pf_end; pf++) {
+      int64_t v = idx[pf];
+      if (v >= -dim_size && v < dim_size) {
+        if (v < 0) {
+          v += dim_size;
+        }
+        _mm_prefetch(src + v * stride_bytes, _MM_HINT_T0);
+      }
+    }
+    __m512i vidx =
+        _mm512_loadu_si512(reinterpret_cast<const void*>(idx + i));
+    __mmask8 negative = _mm512_cmplt_epi64_mask(vidx, vzero);
+    vidx = _mm512_mask_add_epi64(vidx, negative, vidx, vsize);
+    __mmask8 in_range = _mm512_cmple_epi64_mask(vzero, vidx) &
+        _mm512_cmplt_epi64_mask(vidx, vsize);
+    if (C10_UNLIKELY(in_range != 0xFF)) {
+      break; // the scalar loop below reports the bad index
+    }
+    __m512i voffset = _mm512_mullo_epi64(vidx, vstride);
+    if (sizeof(scalar_t) == 4) {
+      __m256i gathered = _mm512_i64gather_epi32(
+          voffset, reinterpret_cast<const void*>(src), 1);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(dst + i * sizeof(scalar_t)), gathered);
+    } else {
+      __m512i gathered = _mm512_i64gather_epi64(
+          voffset, reinterpret_cast<const void*>(src), 1);
+      _mm512_storeu_si512(
+          reinterpret_cast<void*>(dst + i * sizeof(scalar_t)), gathered);
+    }
+  }
+  gather_scalar_checked<scalar_t>(
+      dst + i * sizeof(scalar_t), src, idx + i, n - i, dim_size, stride_bytes);
+}
+#endif
+
+// Specialization of cpu_index_kernel for the single-advanced-index gather
+// (e.g. embedding lookups): the inner loop reads contiguous int64 indices
+// and copies one 4/8-byte element per index, so it can use hardware gather
+// where available and prefetch the indexed rows everywhere else.
+template <typename scalar_t>
+void cpu_index_gather_kernel(
+    TensorIteratorBase& iter,
+    int64_t dim_size,
+    int64_t stride_bytes) {
+  // grain size chosen to match cpu_index_kernel
+  const int index_parallel_grain_size = 3000;
+  auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+    char* dst = data[0];
+    const char* src = data[1];
+    const char* idx = data[2];
+    if (strides[0] == static_cast<int64_t>(sizeof(scalar_t)) &&
+        strides[1] == 0 && strides[2] == static_cast<int64_t>(sizeof(int64_t))) {
+#if defined(CPU_CAPABILITY_AVX512)
+      vectorized_gather<scalar_t>(
+          dst, src, reinterpret_cast<const int64_t*>(idx), n, dim_size, stride_bytes);
+#else
+      gather_scalar_checked<scalar_t>(
+          dst, src, reinterpret_cast<const int64_t*>(idx), n, dim_size, stride_bytes);
+#endif
+      return;
+    }
+    // Strided chunk (or constant index): plain checked loop, as in
+    // cpu_index_kernel.
+    for (const auto i : c10::irange(n)) {
+      int64_t value = *reinterpret_cast<const int64_t*>(idx + i * strides[2]);
+      TORCH_CHECK_INDEX(
+          value >= -dim_size && value < dim_size,
+          "index ", value, " is out of bounds for dimension ", 0, " with size ", dim_size);
+      if (value < 0) {
+        value += dim_size;
+      }
+      std::memcpy(
+          dst + i * strides[0],
+          src + i * strides[1] + value * stride_bytes,
+          sizeof(scalar_t));
+    }
+  };
+  iter.for_each(loop, index_parallel_grain_size);
+}
+
 void index_kernel(TensorIteratorBase& iter, IntArrayRef index_size, IntArrayRef index_stride) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(kComplexHalf, kHalf, kBool, kBFloat16,
     iter.dtype(), "index_cpu", [&] {
+    if ((sizeof(scalar_t) == 4 || sizeof(scalar_t) == 8) &&
+        index_size.size() == 1 && iter.ntensors() == 3) {
+      cpu_index_gather_kernel<scalar_t>(iter, index_size[0], index_stride[0]);
+      return;
+    }
     cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
       *(scalar_t*)dst = *(scalar_t*)(src + offset);
     });
@@ -0,0 +1,104 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/PointwisePipeline.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cpu/Loops.h>
+#include <c10/util/BFloat16-math.h>
+
+#include <algorithm>
+
+namespace at::native {
+
+inline namespace CPU_CAPABILITY {
+
+template <typename scalar_t>
+scalar_t apply_stages(scalar_t x, const PointwiseStage* stages, int64_t nstages) {
+  for (int64_t i = 0; i < nstages; i++) {
+    const auto alpha = static_cast<scalar_t>(stages[i].alpha);
+    switch (stages[i].kind) {
+      case PointwiseStageKind::MUL:
+        x = x * alpha;
+        break;
+      case PointwiseStageKind::ADD:
+        x = x + alpha;
+        break;
+      case PointwiseStageKind::CLAMP:
+        x = std::min(
+            std::max(x, alpha), static_cast<scalar_t>(stages[i].beta));
+        break;
+      case PointwiseStageKind::CLAMP_MIN:
+        x = std::max(x, alpha);
+        break;
+      case PointwiseStageKind::CLAMP_MAX:
+        x = std::min(x, alpha);
+        break;
+      case PointwiseStageKind::NEG:
+        x = -x;
+        break;
+      case PointwiseStageKind::ABS:
+        x = std::abs(x);
+        break;
+    }
+  }
+  return x;
+}
+
+template <typename Vec, typename scalar_t>
+Vec apply_stages_vec(Vec x, const PointwiseStage* stages, int64_t nstages) {
+  for (int64_t i = 0; i < nstages; i++) {
+    const Vec alpha(static_cast<scalar_t>(stages[i].alpha));
+    switch (stages[i].kind) {
+      case PointwiseStageKind::MUL:
+        x = x * alpha;
+        break;
+      case PointwiseStageKind::ADD:
+        x = x + alpha;
+        break;
+      case PointwiseStageKind::CLAMP:
+        x = vec::minimum(
+            vec::maximum(x, alpha),
+            Vec(static_cast<scalar_t>(stages[i].beta)));
+        break;
+      case PointwiseStageKind::CLAMP_MIN:
+        x = vec::maximum(x, alpha);
+        break;
+      case PointwiseStageKind::CLAMP_MAX:
+        x = vec::minimum(x, alpha);
+        break;
+      case PointwiseStageKind::NEG:
+        x = x.neg();
+        break;
+      case PointwiseStageKind::ABS:
+        x = x.abs();
+        break;
+    }
+  }
+  return x;
+}
+
+static void pointwise_pipeline_kernel(
+    TensorIteratorBase& iter,
+    const PointwiseStage* stages,
+    int64_t nstages) {
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      kBFloat16, iter.common_dtype(), "pointwise_pipeline_cpu", [&]() {
+        using Vec = Vectorized<scalar_t>;
+        cpu_kernel_vec(
+            iter,
+            [=](scalar_t x) -> scalar_t {
+              return apply_stages(x, stages, nstages);
+            },
+            [=](Vec x) -> Vec {
+              return apply_stages_vec<Vec, scalar_t>(x, stages, nstages);
+            });
+      });
+}
+
+} // namespace CPU_CAPABILITY
+
+REGISTER_DISPATCH(
+    pointwise_pipeline_stub, &CPU_CAPABILITY::pointwise_pipeline_kernel);
+
+} // namespace at::native
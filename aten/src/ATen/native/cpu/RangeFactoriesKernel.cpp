@@ -24,7 +24,7 @@ static void arange_kernel(TensorIterator& iter, const Scalar& scalar_start, cons
     auto start = scalar_start.to<accscalar_t>();
     auto steps = scalar_steps.to<accscalar_t>();
     auto step = scalar_step.to<accscalar_t>();
-    at::parallel_for(0, steps, internal::GRAIN_SIZE, [&](int64_t p_begin, int64_t p_end) {
+    at::parallel_for_calibrated("arange_cpu", 0, steps, internal::GRAIN_SIZE, [&](int64_t p_begin, int64_t p_end) {
       int64_t idx(p_begin);
       TensorIterator it(iter);
       cpu_serial_kernel_vec(
@@ -51,7 +51,7 @@ static void linspace_kernel(TensorIterator& iter, const Scalar& scalar_start, co
     // Cast `end` and `start` to `step_t`, since range can be larger than scalar_t for integral types
     const step_t step = (static_cast<step_t>(end) - static_cast<step_t>(start)) / (steps - 1);
     int64_t halfway = steps / 2;
-    at::parallel_for(0, steps, internal::GRAIN_SIZE, [&](int64_t p_begin, int64_t p_end) {
+    at::parallel_for_calibrated("linspace_cpu", 0, steps, internal::GRAIN_SIZE, [&](int64_t p_begin, int64_t p_end) {
       int64_t idx(p_begin);
       TensorIterator it(iter);
       // Remove vectorization implementation, due to the precision issue between integer and double.
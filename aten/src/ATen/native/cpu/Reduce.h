@@ -115,6 +115,53 @@ static inline void vectorized_outer_reduction(char** data, int64_t inner_stride,
   });
 }
 
+// computes the reduction out = op(out, in) for reductions over dim 0 whose
+// input is not contiguous in either iterated dimension. Strided scalar loops
+// serialize on a single accumulator; instead, gather small tiles into a
+// contiguous on-stack buffer (a blocked transpose) and run the vectorized
+// reduction with independent accumulators over each tile column.
+template <typename func_t, typename vec_func_t>
+static inline void tiled_strided_reduction(char** data, const int64_t* strides, int64_t size0, int64_t size1, func_t op, vec_func_t vop) {
+  VEC_LOOP_HEADER(func_t, data)
+  // 8 columns of 128 elements keep the tile within 8KB of stack for double
+  // while giving the vector loop long enough contiguous runs.
+  constexpr int64_t kTileRows = 128;
+  constexpr int64_t kTileCols = 8;
+  const int64_t in_stride0 = strides[1];
+  const int64_t out_stride1 = strides[2];
+  const int64_t in_stride1 = strides[3];
+  char* out_base = data[0];
+  const char* in_base = data[1];
+
+  alignas(64) scalar_t tile[kTileCols][kTileRows];
+
+  for (int64_t j0 = 0; j0 < size1; j0 += kTileCols) {
+    const int64_t tile_cols = std::min(kTileCols, size1 - j0);
+    for (int64_t i0 = 0; i0 < size0; i0 += kTileRows) {
+      const int64_t tile_rows = std::min(kTileRows, size0 - i0);
+      // gather: tile column j holds input elements i0..i0+tile_rows for
+      // output j0+j, made contiguous for the vector loop below
+      for (const auto i : c10::irange(tile_rows)) {
+        const char* row = in_base + (i0 + i) * in_stride0 + j0 * in_stride1;
+        for (const auto j : c10::irange(tile_cols)) {
+          tile[j][i] = c10::load<scalar_t>(row + j * in_stride1);
+        }
+      }
+      for (const auto j : c10::irange(tile_cols)) {
+        char* out_ptr_j = out_base + (j0 + j) * out_stride1;
+        char* ptrs[2] = { out_ptr_j, reinterpret_cast<char*>(tile[j]) };
+        const int64_t count = tile_rows / (4 * Vec::size());
+        if (count > 0) {
+          vectorized_reduction(ptrs, count, 4 * Vec::size() * sizeof(scalar_t), op, vop, /*reduce=*/true);
+        }
+        char* tail_ptrs[3] = { out_ptr_j, out_ptr_j, reinterpret_cast<char*>(tile[j]) };
+        int64_t tail_strides[3] = { 0, 0, sizeof(scalar_t) };
+        basic_loop(tail_ptrs, tail_strides, count * 4 * Vec::size(), tile_rows, op);
+      }
+    }
+  }
+}
+
 template<typename traits, typename res_t>
 static void set_result(const int index, const res_t result, const TensorIteratorBase &iter, const int num_outputs) {
   // static_assert(std::is_same<res_t, typename traits::arg2_t>::value, "data types must match");
@@ -272,6 +319,10 @@ void binary_kernel_reduce_vec(TensorIteratorBase& iter, func_t op, vec_func_t vo
       // input and output are contiguous in dim 1
       int64_t inner_stride = strides[1]; // stride of input in dim 0
       vectorized_outer_reduction(data, inner_stride, size0, size1, op, vop);
+    } else if (strides[0] == 0) {
+      // reduction over dim 0 with an input that is contiguous in neither
+      // dimension: gather tiles so the reduction itself stays vectorized
+      tiled_strided_reduction(data, strides, size0, size1, op, vop);
     } else {
       UNARY_OUTER_LOOP(data, outer_strides, size1, [&] {
         char* ptrs[3] = { data[0], data[0], data[1] };
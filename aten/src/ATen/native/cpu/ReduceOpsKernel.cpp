@@ -13,6 +13,7 @@
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/cpu/Reduce.h>
 #include <ATen/native/cpu/LogAddExp.h>
+#include <ATen/native/cpu/ValueIndexReduce.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -407,6 +408,16 @@ static void argmax_kernel_impl(TensorIterator &iter) {
         int64_t* result_data = (int64_t*)result_data_bytes;
         scalar_t* self_data = (scalar_t*)self_data_bytes;
 
+        if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+          // Vectorized single-pass max+index over the contiguous lastdim.
+          if (size > 0 && value_index_reduction_is_exact<scalar_t>(size)) {
+            result_data[0] =
+                vectorized_value_index_reduction<scalar_t, /*is_max=*/true>(
+                    self_data, size)
+                    .second;
+            return;
+          }
+        }
         arg_t acc = arg_t(lower_bound<scalar_t>(), 0);
         for (int64_t i = 0; i < size; i++) {
           acc = op.reduce(acc, self_data[i], i);
@@ -431,6 +442,16 @@ static void argmin_kernel_impl(TensorIterator &iter) {
         int64_t* result_data = (int64_t*)result_data_bytes;
         scalar_t* self_data = (scalar_t*)self_data_bytes;
 
+        if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+          // Vectorized single-pass min+index over the contiguous lastdim.
+          if (size > 0 && value_index_reduction_is_exact<scalar_t>(size)) {
+            result_data[0] =
+                vectorized_value_index_reduction<scalar_t, /*is_max=*/false>(
+                    self_data, size)
+                    .second;
+            return;
+          }
+        }
         arg_t acc = arg_t(upper_bound<scalar_t>(), 0);
         for (int64_t i = 0; i < size; i++) {
           acc = op.reduce(acc, self_data[i], i);
@@ -1,4 +1,9 @@
 #define TORCH_ASSERT_NO_OPERATORS
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include <ATen/native/Sorting.h>
 #include <ATen/core/TensorBase.h>
 #include <ATen/Dispatch.h>
@@ -65,6 +70,108 @@ void _dim_apply(
   );
 }
 
+// Maximum row length handled by the bitonic sorting-network path below.
+constexpr int64_t kSmallSortMaxSize = 128;
+
+// Strict ordering used by the sorting network: same NaN handling as
+// KeyValueCompAsc/KeyValueCompDesc, plus an index tie-break. The tie-break
+// makes the order total, so the network's output matches a stable sort and
+// padding elements (which carry out-of-range indices) always land last.
+template <typename scalar_t, bool descending>
+inline bool small_sort_less(scalar_t av, int64_t ai, scalar_t bv, int64_t bi) {
+  bool key_lt, key_gt;
+  if (descending) {
+    key_lt = (_isnan<scalar_t>(av) && !_isnan<scalar_t>(bv)) || (av > bv);
+    key_gt = (_isnan<scalar_t>(bv) && !_isnan<scalar_t>(av)) || (bv > av);
+  } else {
+    key_lt = (!_isnan<scalar_t>(av) && _isnan<scalar_t>(bv)) || (av < bv);
+    key_gt = (!_isnan<scalar_t>(bv) && _isnan<scalar_t>(av)) || (bv < av);
+  }
+  return key_lt || (!key_gt && ai < bi);
+}
+
+// Bitonic sort over a power-of-two sized buffer. Every compare-exchange is
+// data-independent and written with conditional moves rather than branches:
+// for the tiny rows this path serves (e.g. beam-search candidate lists),
+// std::sort spends most of its time in branch mispredictions, while this
+// loop compiles to cmov/vectorized selects.
+template <typename scalar_t, bool descending>
+void bitonic_sort_small(scalar_t* vals, int64_t* idxs, int64_t n_padded) {
+  for (int64_t k = 2; k <= n_padded; k *= 2) {
+    for (int64_t j = k / 2; j > 0; j /= 2) {
+      for (const auto i : c10::irange(n_padded)) {
+        const int64_t l = i ^ j;
+        if (l > i) {
+          const bool up = (i & k) == 0;
+          const scalar_t av = vals[i];
+          const scalar_t bv = vals[l];
+          const int64_t ai = idxs[i];
+          const int64_t bi = idxs[l];
+          const bool do_swap = up
+              ? small_sort_less<scalar_t, descending>(bv, bi, av, ai)
+              : small_sort_less<scalar_t, descending>(av, ai, bv, bi);
+          vals[i] = do_swap ? bv : av;
+          vals[l] = do_swap ? av : bv;
+          idxs[i] = do_swap ? bi : ai;
+          idxs[l] = do_swap ? ai : bi;
+        }
+      }
+    }
+  }
+}
+
+template <typename scalar_t>
+void sort_small_row(
+    scalar_t* values, int64_t values_stride,
+    int64_t* indices, int64_t indices_stride,
+    int64_t dim_size, bool descending) {
+  scalar_t vals[kSmallSortMaxSize];
+  int64_t idxs[kSmallSortMaxSize];
+
+  int64_t n_padded = 1;
+  while (n_padded < dim_size) {
+    n_padded *= 2;
+  }
+
+  for (const auto i : c10::irange(dim_size)) {
+    vals[i] = values[i * values_stride];
+    idxs[i] = indices[i * indices_stride];
+  }
+  // Padding keys sort last: they are the extreme value in the requested
+  // direction (NaN for ascending floating types, since NaNs sort last
+  // there) and ties against real extremes are broken by the out-of-range
+  // index.
+  scalar_t pad_value;
+  if (descending) {
+    // -inf rather than lowest(): real -inf values must not sort after the
+    // padding.
+    if (std::numeric_limits<scalar_t>::has_infinity) {
+      pad_value = scalar_t(-std::numeric_limits<scalar_t>::infinity());
+    } else {
+      pad_value = std::numeric_limits<scalar_t>::lowest();
+    }
+  } else if (std::numeric_limits<scalar_t>::has_quiet_NaN) {
+    pad_value = std::numeric_limits<scalar_t>::quiet_NaN();
+  } else {
+    pad_value = std::numeric_limits<scalar_t>::max();
+  }
+  for (int64_t i = dim_size; i < n_padded; ++i) {
+    vals[i] = pad_value;
+    idxs[i] = dim_size + i;
+  }
+
+  if (descending) {
+    bitonic_sort_small<scalar_t, /*descending=*/true>(vals, idxs, n_padded);
+  } else {
+    bitonic_sort_small<scalar_t, /*descending=*/false>(vals, idxs, n_padded);
+  }
+
+  for (const auto i : c10::irange(dim_size)) {
+    values[i * values_stride] = vals[i];
+    indices[i * indices_stride] = idxs[i];
+  }
+}
+
 template <typename scalar_t>
 struct KeyValueCompAsc {
   template <typename LHS, typename RHS>
@@ -83,6 +190,196 @@ struct KeyValueCompDesc {
   }
 };
 
+// Note [Parallel MSB radix sort]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A 1-D sort is a single row to _dim_apply, so the comparison path above
+// runs it on one thread; for a few hundred million keys that is tens of
+// seconds in std::stable_sort. Large contiguous 1-D sorts of integral,
+// float and double keys instead take a radix path:
+//
+//   1. keys are mapped to unsigned integers whose natural order matches
+//      the requested sort order (sign-bit flip for signed integers, the
+//      usual float-as-ordered-int transform for floating types, with NaN
+//      canonicalized to the last key);
+//   2. the range is cut into per-thread chunks; each chunk histograms the
+//      most significant byte, a serial scan over the (bucket, chunk)
+//      counts assigns every chunk a private write cursor per bucket, and
+//      a second parallel pass scatters value/index pairs into a scratch
+//      buffer. The chunk-ordered cursors make the partition stable;
+//   3. each of the 256 buckets is finished independently in parallel with
+//      std::stable_sort and the existing key/value comparators, then the
+//      result is copied back.
+//
+// The output is always stable, so the path serves stable=true as well.
+
+constexpr int64_t kRadixSortMinSize = 1 << 16;
+constexpr int kRadixSortBuckets = 256;
+
+template <typename scalar_t>
+struct RadixSortKey {
+  using type = std::make_unsigned_t<scalar_t>;
+};
+template <>
+struct RadixSortKey<float> {
+  using type = uint32_t;
+};
+template <>
+struct RadixSortKey<double> {
+  using type = uint64_t;
+};
+
+template <typename scalar_t>
+inline typename RadixSortKey<scalar_t>::type radix_ordered_key(scalar_t v) {
+  using key_t = typename RadixSortKey<scalar_t>::type;
+  constexpr key_t sign_bit = key_t(1) << (sizeof(key_t) * 8 - 1);
+  if constexpr (std::is_integral<scalar_t>::value) {
+    key_t u = static_cast<key_t>(v);
+    if (std::is_signed<scalar_t>::value) {
+      u ^= sign_bit;
+    }
+    return u;
+  } else {
+    if (_isnan<scalar_t>(v)) {
+      // All NaNs collapse to the greatest key; the comparators below treat
+      // NaNs as equal, so stability is preserved.
+      return std::numeric_limits<key_t>::max();
+    }
+    key_t u;
+    std::memcpy(&u, &v, sizeof(u));
+    if (v == scalar_t(0)) {
+      // -0.0 compares equal to 0.0; give both the same key so they stay
+      // in one bucket and keep their relative order.
+      u = 0;
+    }
+    return (u & sign_bit) ? static_cast<key_t>(~u)
+                          : static_cast<key_t>(u | sign_bit);
+  }
+}
+
+template <typename scalar_t, bool descending>
+void radix_sort_1d(scalar_t* values, int64_t* indices, int64_t n) {
+  using key_t = typename RadixSortKey<scalar_t>::type;
+  constexpr int shift = (sizeof(key_t) - 1) * 8;
+  const auto bucket_of = [](scalar_t v) -> int {
+    key_t key = radix_ordered_key<scalar_t>(v);
+    if (descending) {
+      key = static_cast<key_t>(~key);
+    }
+    return static_cast<int>(key >> shift);
+  };
+
+  const int64_t num_chunks = std::max<int64_t>(
+      1,
+      std::min<int64_t>(
+          at::get_num_threads(), n / at::internal::GRAIN_SIZE));
+  const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+  // Per-(chunk, bucket) counts, then per-(chunk, bucket) write cursors.
+  std::vector<int64_t> counts(num_chunks * kRadixSortBuckets, 0);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto chunk : c10::irange(cbegin, cend)) {
+      int64_t* local = counts.data() + chunk * kRadixSortBuckets;
+      const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+      for (int64_t i = chunk * chunk_size; i < end; ++i) {
+        local[bucket_of(values[i])]++;
+      }
+    }
+  });
+
+  std::vector<int64_t> bucket_begin(kRadixSortBuckets + 1, 0);
+  int64_t running = 0;
+  for (const auto b : c10::irange(kRadixSortBuckets)) {
+    bucket_begin[b] = running;
+    for (const auto chunk : c10::irange(num_chunks)) {
+      int64_t& cursor = counts[chunk * kRadixSortBuckets + b];
+      const int64_t count = cursor;
+      cursor = running;
+      running += count;
+    }
+  }
+  bucket_begin[kRadixSortBuckets] = running;
+
+  // Scatter into scratch buffers. new[] rather than std::vector: the
+  // buffers are fully overwritten, so zero-initialization would just be
+  // an extra pass over up to gigabytes of memory.
+  std::unique_ptr<scalar_t[]> tmp_values(new scalar_t[n]);
+  std::unique_ptr<int64_t[]> tmp_indices(new int64_t[n]);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t cbegin, int64_t cend) {
+    for (const auto chunk : c10::irange(cbegin, cend)) {
+      int64_t* cursors = counts.data() + chunk * kRadixSortBuckets;
+      const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+      for (int64_t i = chunk * chunk_size; i < end; ++i) {
+        const int64_t pos = cursors[bucket_of(values[i])]++;
+        tmp_values[pos] = values[i];
+        tmp_indices[pos] = indices[i];
+      }
+    }
+  });
+
+  at::parallel_for(0, kRadixSortBuckets, 1, [&](int64_t bbegin, int64_t bend) {
+    for (const auto b : c10::irange(bbegin, bend)) {
+      const int64_t begin = bucket_begin[b];
+      const int64_t size = bucket_begin[b + 1] - begin;
+      if (size > 1 && sizeof(key_t) > 1) {
+        auto values_accessor =
+            StridedRandomAccessor<scalar_t>(tmp_values.get() + begin, 1);
+        auto indices_accessor =
+            StridedRandomAccessor<int64_t>(tmp_indices.get() + begin, 1);
+        auto composite_accessor = CompositeRandomAccessorCPU<
+            decltype(values_accessor), decltype(indices_accessor)
+        >(values_accessor, indices_accessor);
+        if (descending) {
+          std::stable_sort(composite_accessor, composite_accessor + size,
+            KeyValueCompDesc<scalar_t>());
+        } else {
+          std::stable_sort(composite_accessor, composite_accessor + size,
+            KeyValueCompAsc<scalar_t>());
+        }
+      }
+      std::copy(
+          tmp_values.get() + begin,
+          tmp_values.get() + begin + size,
+          values + begin);
+      std::copy(
+          tmp_indices.get() + begin,
+          tmp_indices.get() + begin + size,
+          indices + begin);
+    }
+  });
+}
+
+// Takes the radix path for large contiguous single-row sorts; returns
+// false to fall back to the comparison path.
+static bool try_radix_sort_1d(
+    const TensorBase& values,
+    const TensorBase& indices,
+    int64_t dim,
+    bool descending) {
+  const int64_t n = values.size(dim);
+  if (n < kRadixSortMinSize || values.numel() != n ||
+      values.stride(dim) != 1 || indices.stride(dim) != 1 ||
+      in_parallel_region()) {
+    return false;
+  }
+  const auto dtype = values.scalar_type();
+  if (!(isIntegralType(dtype, /*includeBool=*/false) ||
+        dtype == ScalarType::Float || dtype == ScalarType::Double)) {
+    return false;
+  }
+  AT_DISPATCH_ALL_TYPES(dtype, "radix_sort_cpu", [&] {
+    auto* values_data = values.data_ptr<scalar_t>();
+    auto* indices_data = indices.data_ptr<int64_t>();
+    if (descending) {
+      radix_sort_1d<scalar_t, /*descending=*/true>(
+          values_data, indices_data, n);
+    } else {
+      radix_sort_1d<scalar_t, /*descending=*/false>(
+          values_data, indices_data, n);
+    }
+  });
+  return true;
+}
+
 static void sort_kernel(
     const TensorBase& self,
     const TensorBase& values,
@@ -97,6 +394,10 @@ static void sort_kernel(
     // https://github.com/pytorch/pytorch/issues/91420
     return;
   }
+  // See Note [Parallel MSB radix sort].
+  if (try_radix_sort_1d(values, indices, dim, descending)) {
+    return;
+  }
   _dim_apply(
     values, indices, dim,
     "sort_cpu", [&](
@@ -105,6 +406,15 @@ static void sort_kernel(
       int64_t dim_size
     ) {
       using scalar_t = typename std::remove_pointer<decltype(values)>::type;
+      if (dim_size <= kSmallSortMaxSize) {
+        // The index tie-break makes the network's order total, so this path
+        // also satisfies stable=true.
+        sort_small_row<scalar_t>(
+            values, values_dim_stride,
+            indices, indices_dim_stride,
+            dim_size, descending);
+        return;
+      }
       auto values_accessor = StridedRandomAccessor<scalar_t>(
         values, values_dim_stride);
       auto indices_accessor = StridedRandomAccessor<int64_t>(
@@ -19,6 +19,7 @@
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/Resize.h>
 #include <ATen/native/cpu/Loops.h>
+#include <ATen/native/cpu/ValueIndexReduce.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -110,6 +111,17 @@ static void min_kernel_impl(
     compare_base_kernel<scalar_t>(result, indice, self, dim, keepdim, [&] (
       scalar_t* result_data, int64_t* indice_data,
       const scalar_t* self_data, auto self_dim_stride) {
+        if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+          // Vectorized single-pass min+index over the contiguous innermost dim.
+          if (self_dim_stride == 1 &&
+              value_index_reduction_is_exact<scalar_t>(self_dim_size)) {
+            auto value_index = vectorized_value_index_reduction<scalar_t, /*is_max=*/false>(
+                self_data, self_dim_size);
+            *result_data = value_index.first;
+            *indice_data = value_index.second;
+            return;
+          }
+        }
         using value_t = typename c10::scalar_value_type<scalar_t>::type;
         value_t (*zabs_)(scalar_t) = zabs<scalar_t, value_t>;
         scalar_t min_number = c10::load(self_data);
@@ -143,6 +155,17 @@ static void max_kernel_impl(
     compare_base_kernel<scalar_t>(result, indice, self, dim, keepdim, [&] (
       scalar_t* result_data, int64_t* indice_data,
       const scalar_t* self_data, auto self_dim_stride) {
+        if constexpr (std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>) {
+          // Vectorized single-pass max+index over the contiguous innermost dim.
+          if (self_dim_stride == 1 &&
+              value_index_reduction_is_exact<scalar_t>(self_dim_size)) {
+            auto value_index = vectorized_value_index_reduction<scalar_t, /*is_max=*/true>(
+                self_data, self_dim_size);
+            *result_data = value_index.first;
+            *indice_data = value_index.second;
+            return;
+          }
+        }
         using value_t = typename c10::scalar_value_type<scalar_t>::type;
         value_t (*zabs_)(scalar_t) = zabs<scalar_t, value_t>;
         scalar_t max_number = c10::load(self_data);
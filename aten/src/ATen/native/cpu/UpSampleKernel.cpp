@@ -455,6 +455,57 @@ void cpu_upsample_generic(at::TensorIterator& iter)
   iter.for_each(loop);
 }
 
+// Note [Channels-last upsample row tables]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The channels-last kernels used to recompute the source index (and, for the
+// linear case, the interpolation lambdas) for every output pixel of every
+// image in the batch. The tables below are instead computed once per axis and
+// per call -- one entry per output coordinate, with source offsets pre-scaled
+// to element strides -- and shared read-only across all worker threads, so
+// the hot loops reduce to table lookups around the vectorized channel math.
+
+template <nearest_idx_fn_t nearest_idx_fn>
+std::vector<int64_t> build_nearest_offset_table(
+    int64_t output_size,
+    int64_t input_size,
+    c10::optional<double> scale,
+    int64_t stride) {
+  std::vector<int64_t> table(output_size);
+  for (const auto o : c10::irange(output_size)) {
+    table[o] = nearest_idx_fn(o, input_size, output_size, scale) * stride;
+  }
+  return table;
+}
+
+// One output line's worth of bilinear source data: the two contributing input
+// offsets (in elements) along an axis and their interpolation weights.
+template <typename opmath_t>
+struct InterpLine {
+  int64_t offset0;
+  int64_t offset1;
+  opmath_t lambda0;
+  opmath_t lambda1;
+};
+
+template <typename opmath_t>
+std::vector<InterpLine<opmath_t>> build_linear_line_table(
+    int64_t output_size,
+    int64_t input_size,
+    opmath_t scale,
+    bool align_corners,
+    int64_t stride) {
+  std::vector<InterpLine<opmath_t>> table(output_size);
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t i0, i1;
+  opmath_t l0, l1;
+  for (const auto o : c10::irange(output_size)) {
+    compute_source_index_and_lambda(
+        i0, i1, l0, l1, scale, o, input_size, output_size, align_corners);
+    table[o] = {i0 * stride, i1 * stride, l0, l1};
+  }
+  return table;
+}
+
 template <typename scalar_t, typename scale_type, nearest_idx_fn_t nearest_idx_fn>
 void cpu_upsample_nearest_channels_last(
     const Tensor& output_,
@@ -499,6 +550,22 @@ void cpu_upsample_nearest_channels_last(
     }
   };
 
+  // See Note [Channels-last upsample row tables]
+  std::vector<int64_t> id_offsets, ih_offsets, iw_offsets;
+  if (ndim == 4) {
+    ih_offsets = build_nearest_offset_table<nearest_idx_fn>(
+        output_height, input_height, scales[0], input_width * channels);
+    iw_offsets = build_nearest_offset_table<nearest_idx_fn>(
+        output_width, input_width, scales[1], channels);
+  } else {
+    id_offsets = build_nearest_offset_table<nearest_idx_fn>(
+        output_depth, input_depth, scales[0], input_height * input_width * channels);
+    ih_offsets = build_nearest_offset_table<nearest_idx_fn>(
+        output_height, input_height, scales[1], input_width * channels);
+    iw_offsets = build_nearest_offset_table<nearest_idx_fn>(
+        output_width, input_width, scales[2], channels);
+  }
+
   auto loop2d = [&](int64_t begin, int64_t end) {
     int64_t n = 0;
     int64_t oh = 0;
@@ -506,11 +573,9 @@ void cpu_upsample_nearest_channels_last(
     data_index_init(begin, n, num_batches, oh, output_height, ow, output_width);
 
     for (const auto i : c10::irange(begin, end)) {
-      int64_t ih = nearest_idx_fn(oh, input_height, output_height, scales[0]);
-      int64_t iw = nearest_idx_fn(ow, input_width, output_width, scales[1]);
       scalar_t* output_ptr = output_data + i * channels;
       scalar_t* input_ptr = input_data + n * input_height * input_width * channels +
-          ih * input_width * channels + iw * channels;
+          ih_offsets[oh] + iw_offsets[ow];
       copy(output_ptr, input_ptr, channels);
       data_index_step(n, num_batches, oh, output_height, ow, output_width);
     }
@@ -524,13 +589,9 @@ void cpu_upsample_nearest_channels_last(
     data_index_init(begin, n, num_batches, od, output_depth, oh, output_height, ow, output_width);
 
     for (const auto i : c10::irange(begin, end)) {
-      int64_t id = nearest_idx_fn(od, input_depth, output_depth, scales[0]);
-      int64_t ih = nearest_idx_fn(oh, input_height, output_height, scales[1]);
-      int64_t iw = nearest_idx_fn(ow, input_width, output_width, scales[2]);
       scalar_t* output_ptr = output_data + i * channels;
       scalar_t* input_ptr = input_data + n * input_depth * input_height * input_width * channels +
-          id * input_height * input_width * channels +
-          ih * input_width * channels + iw * channels;
+          id_offsets[od] + ih_offsets[oh] + iw_offsets[ow];
       copy(output_ptr, input_ptr, channels);
       data_index_step(n, num_batches, od, output_depth, oh, output_height, ow, output_width);
     }
@@ -595,38 +656,51 @@ void cpu_upsample_linear_channels_last(
 
   using opmath_t = at::opmath_type<scalar_t>;
   using Vec = vec::Vectorized<scalar_t>;
-  auto loop2d = [&](int64_t begin, int64_t end) {
+
+  // See Note [Channels-last upsample row tables]
+  std::vector<InterpLine<opmath_t>> d_lines, h_lines, w_lines;
+  if (ndim == 4) {
     const auto height_scale = area_pixel_compute_scale<opmath_t>(
         input_height, output_height, align_corners, scales[0]);
     const auto width_scale = area_pixel_compute_scale<opmath_t>(
         input_width, output_width, align_corners, scales[1]);
+    h_lines = build_linear_line_table(
+        output_height, input_height, height_scale, align_corners, input_width * channels);
+    w_lines = build_linear_line_table(
+        output_width, input_width, width_scale, align_corners, channels);
+  } else {
+    const auto depth_scale = area_pixel_compute_scale<opmath_t>(
+        input_depth, output_depth, align_corners, scales[0]);
+    const auto height_scale = area_pixel_compute_scale<opmath_t>(
+        input_height, output_height, align_corners, scales[1]);
+    const auto width_scale = area_pixel_compute_scale<opmath_t>(
+        input_width, output_width, align_corners, scales[2]);
+    d_lines = build_linear_line_table(
+        output_depth, input_depth, depth_scale, align_corners, input_height * input_width * channels);
+    h_lines = build_linear_line_table(
+        output_height, input_height, height_scale, align_corners, input_width * channels);
+    w_lines = build_linear_line_table(
+        output_width, input_width, width_scale, align_corners, channels);
+  }
 
-    auto input_indexr = [=](int64_t n, int64_t h, int64_t w) {
-      return input_data + n * input_height * input_width * channels +
-          h * input_width * channels + w * channels;
-    };
-
-    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    int64_t ih0, ih1, iw0, iw1;
-    opmath_t h0lambda, h1lambda, w0lambda, w1lambda;
+  auto loop2d = [&](int64_t begin, int64_t end) {
     for (const auto n : c10::irange(begin, end)) {
+      const scalar_t* in = input_data + n * input_height * input_width * channels;
       for (const auto oh : c10::irange(output_height)) {
-        compute_source_index_and_lambda(
-            ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
+        const auto& hl = h_lines[oh];
         for (const auto ow : c10::irange(output_width)) {
-          compute_source_index_and_lambda(
-              iw0, iw1, w0lambda, w1lambda, width_scale, ow, input_width, output_width, align_corners);
+          const auto& wl = w_lines[ow];
 
           scalar_t* out = output_data + n * output_slice_size +
               oh * output_width * channels + ow * channels;
-          scalar_t* i00 = input_indexr(n, ih0, iw0);
-          scalar_t* i01 = input_indexr(n, ih0, iw1);
-          scalar_t* i10 = input_indexr(n, ih1, iw0);
-          scalar_t* i11 = input_indexr(n, ih1, iw1);
-          opmath_t w00 = h0lambda * w0lambda;
-          opmath_t w01 = h0lambda * w1lambda;
-          opmath_t w10 = h1lambda * w0lambda;
-          opmath_t w11 = h1lambda * w1lambda;
+          const scalar_t* i00 = in + hl.offset0 + wl.offset0;
+          const scalar_t* i01 = in + hl.offset0 + wl.offset1;
+          const scalar_t* i10 = in + hl.offset1 + wl.offset0;
+          const scalar_t* i11 = in + hl.offset1 + wl.offset1;
+          opmath_t w00 = hl.lambda0 * wl.lambda0;
+          opmath_t w01 = hl.lambda0 * wl.lambda1;
+          opmath_t w10 = hl.lambda1 * wl.lambda0;
+          opmath_t w11 = hl.lambda1 * wl.lambda1;
 
           int64_t size = channels;
           int64_t d = 0;
@@ -643,52 +717,39 @@ void cpu_upsample_linear_channels_last(
   };
 
   auto loop3d = [&](int64_t begin, int64_t end) {
-    const auto depth_scale = area_pixel_compute_scale<opmath_t>(
-        input_depth, output_depth, align_corners, scales[0]);
-    const auto height_scale = area_pixel_compute_scale<opmath_t>(
-        input_height, output_height, align_corners, scales[1]);
-    const auto width_scale = area_pixel_compute_scale<opmath_t>(
-        input_width, output_width, align_corners, scales[2]);
-
-    auto input_indexr = [=](int64_t n, int64_t d, int64_t h, int64_t w) {
-      return input_data + n * input_depth * input_height * input_width * channels +
-          d * input_height * input_width * channels +
-          h * input_width * channels + w * channels;
-    };
-
-    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    int64_t id0, id1, ih0, ih1, iw0, iw1;
-    opmath_t d0lambda, d1lambda, h0lambda, h1lambda, w0lambda, w1lambda;
     for (const auto n : c10::irange(begin, end)) {
+      const scalar_t* in = input_data +
+          n * input_depth * input_height * input_width * channels;
       for (const auto od : c10::irange(output_depth)) {
-        compute_source_index_and_lambda(
-            id0, id1, d0lambda, d1lambda, depth_scale, od, input_depth, output_depth, align_corners);
+        const auto& dl = d_lines[od];
         for (const auto oh : c10::irange(output_height)) {
-          compute_source_index_and_lambda(
-              ih0, ih1, h0lambda, h1lambda, height_scale, oh, input_height, output_height, align_corners);
+          const auto& hl = h_lines[oh];
+          const opmath_t w0h0 = dl.lambda0 * hl.lambda0;
+          const opmath_t w0h1 = dl.lambda0 * hl.lambda1;
+          const opmath_t w1h0 = dl.lambda1 * hl.lambda0;
+          const opmath_t w1h1 = dl.lambda1 * hl.lambda1;
           for (const auto ow : c10::irange(output_width)) {
-            compute_source_index_and_lambda(
-                iw0, iw1, w0lambda, w1lambda, width_scale, ow, input_width, output_width, align_corners);
+            const auto& wl = w_lines[ow];
 
             scalar_t* out = output_data + n * output_slice_size +
                 od * output_height * output_width * channels +
                 oh * output_width * channels + ow * channels;
-            scalar_t* i000 = input_indexr(n, id0, ih0, iw0);
-            scalar_t* i001 = input_indexr(n, id0, ih0, iw1);
-            scalar_t* i010 = input_indexr(n, id0, ih1, iw0);
-            scalar_t* i011 = input_indexr(n, id0, ih1, iw1);
-            scalar_t* i100 = input_indexr(n, id1, ih0, iw0);
-            scalar_t* i101 = input_indexr(n, id1, ih0, iw1);
-            scalar_t* i110 = input_indexr(n, id1, ih1, iw0);
-            scalar_t* i111 = input_indexr(n, id1, ih1, iw1);
-            opmath_t w000 = d0lambda * h0lambda * w0lambda;
-            opmath_t w001 = d0lambda * h0lambda * w1lambda;
-            opmath_t w010 = d0lambda * h1lambda * w0lambda;
-            opmath_t w011 = d0lambda * h1lambda * w1lambda;
-            opmath_t w100 = d1lambda * h0lambda * w0lambda;
-            opmath_t w101 = d1lambda * h0lambda * w1lambda;
-            opmath_t w110 = d1lambda * h1lambda * w0lambda;
-            opmath_t w111 = d1lambda * h1lambda * w1lambda;
+            const scalar_t* i000 = in + dl.offset0 + hl.offset0 + wl.offset0;
+            const scalar_t* i001 = in + dl.offset0 + hl.offset0 + wl.offset1;
+            const scalar_t* i010 = in + dl.offset0 + hl.offset1 + wl.offset0;
+            const scalar_t* i011 = in + dl.offset0 + hl.offset1 + wl.offset1;
+            const scalar_t* i100 = in + dl.offset1 + hl.offset0 + wl.offset0;
+            const scalar_t* i101 = in + dl.offset1 + hl.offset0 + wl.offset1;
+            const scalar_t* i110 = in + dl.offset1 + hl.offset1 + wl.offset0;
+            const scalar_t* i111 = in + dl.offset1 + hl.offset1 + wl.offset1;
+            opmath_t w000 = w0h0 * wl.lambda0;
+            opmath_t w001 = w0h0 * wl.lambda1;
+            opmath_t w010 = w0h1 * wl.lambda0;
+            opmath_t w011 = w0h1 * wl.lambda1;
+            opmath_t w100 = w1h0 * wl.lambda0;
+            opmath_t w101 = w1h0 * wl.lambda1;
+            opmath_t w110 = w1h1 * wl.lambda0;
+            opmath_t w111 = w1h1 * wl.lambda1;
 
             int64_t size = channels;
             int64_t d = 0;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <ATen/NumericUtils.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace at { namespace native {
+inline namespace CPU_CAPABILITY {
+
+// Whether the single-pass vectorized value+index reduction below can
+// represent every index in [0, size) exactly in a lane of scalar_t.
+// Indices are tracked in a vector of the value type so that one blend
+// updates them together with the running extrema.
+template <typename scalar_t>
+inline bool value_index_reduction_is_exact(int64_t size) {
+  if (std::is_same<scalar_t, double>::value) {
+    return true;
+  }
+  if (std::is_same<scalar_t, float>::value) {
+    return size <= (int64_t(1) << 24);
+  }
+  return false;
+}
+
+// Single-pass max (or min) with index over a contiguous run. Keeps a
+// vector of running extrema and a vector of their indices, blending both
+// on each compare, then combines the lanes. Semantics match the scalar
+// loops in TensorCompareKernel.cpp and ArgMaxOps/ArgMinOps: NaN wins over
+// any value and the first occurrence wins ties. Callers must check
+// value_index_reduction_is_exact() first.
+template <typename scalar_t, bool is_max>
+inline std::pair<scalar_t, int64_t> vectorized_value_index_reduction(
+    const scalar_t* data,
+    int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const int64_t kVecSize = Vec::size();
+  scalar_t best = data[0];
+  int64_t best_idx = 0;
+  int64_t i = 0;
+  if (size >= 2 * kVecSize) {
+    Vec best_vec = Vec::loadu(data);
+    Vec idx_vec = Vec::arange(scalar_t(0), scalar_t(1));
+    for (i = kVecSize; i + kVecSize <= size; i += kVecSize) {
+      const Vec values = Vec::loadu(data + i);
+      // Take the new value if it beats the running one, or if it is NaN
+      // and the running one is not; a lane that already holds NaN keeps
+      // it (and thus its earliest NaN index).
+      const Vec is_new_nan = values != values;
+      const Vec is_best_ok = best_vec == best_vec;
+      const Vec mask = is_max
+          ? ((values > best_vec) | (is_new_nan & is_best_ok))
+          : ((values < best_vec) | (is_new_nan & is_best_ok));
+      best_vec = Vec::blendv(best_vec, values, mask);
+      idx_vec = Vec::blendv(
+          idx_vec, Vec::arange(scalar_t(i), scalar_t(1)), mask);
+    }
+    // Combine the lanes. Each lane holds the first occurrence of its own
+    // extremum (or first NaN), so taking the smallest index on ties (and
+    // among NaN lanes) recovers the global first occurrence.
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    scalar_t values_buf[Vec::size()];
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+    scalar_t index_buf[Vec::size()];
+    best_vec.store(values_buf);
+    idx_vec.store(index_buf);
+    best = values_buf[0];
+    best_idx = static_cast<int64_t>(index_buf[0]);
+    for (const auto lane : c10::irange(int64_t(1), kVecSize)) {
+      const scalar_t value = values_buf[lane];
+      const auto index = static_cast<int64_t>(index_buf[lane]);
+      bool take = false;
+      if (_isnan(best)) {
+        take = _isnan(value) && index < best_idx;
+      } else if (_isnan(value)) {
+        take = true;
+      } else if (is_max ? (value > best) : (value < best)) {
+        take = true;
+      } else if (value == best && index < best_idx) {
+        take = true;
+      }
+      if (take) {
+        best = value;
+        best_idx = index;
+      }
+    }
+  }
+  // Scalar tail (and the whole run when it is too short to vectorize).
+  // Tail indices are larger than anything accumulated so far, so only a
+  // strict improvement (or the first NaN) may take over.
+  for (; i < size; i++) {
+    const scalar_t value = data[i];
+    if (_isnan(best)) {
+      break;
+    }
+    if (_isnan(value) || (is_max ? (value > best) : (value < best))) {
+      best = value;
+      best_idx = i;
+    }
+  }
+  return std::make_pair(best, best_idx);
+}
+
+} // namespace CPU_CAPABILITY
+}} // namespace at::native
@@ -571,21 +571,53 @@ void LayerNormBackwardKernelImplInternal(
 
   // Second path of dgamma/dbeta
   if (buffer_data != nullptr) {
-    parallel_for(0, N, 1, [&](int64_t start, int64_t end) {
-      for (const auto j : c10::irange(start, end)) {
-        T_ACC dgamma_v = T_ACC(0);
-        T_ACC dbeta_v = T_ACC(0);
+    // Column-blocked reduction: each task owns a contiguous block of columns
+    // and walks the per-thread partial rows with vectorized accumulation, so
+    // every access within a row is sequential instead of strided by N. The
+    // partials are widened to T_ACC per block before accumulating, which also
+    // keeps the reduced-precision path vectorized.
+    constexpr int64_t kColBlockSize = 256;
+    const int64_t num_blocks = divup(N, kColBlockSize);
+    parallel_for(0, num_blocks, 1, [&](int64_t block_start, int64_t block_end) {
+      using Vec = vec::Vectorized<T_ACC>;
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+      T_ACC acc_dgamma[kColBlockSize];
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+      T_ACC acc_dbeta[kColBlockSize];
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+      T_ACC row[kColBlockSize];
+      for (const auto block : c10::irange(block_start, block_end)) {
+        const int64_t jb = block * kColBlockSize;
+        const int64_t len = std::min(kColBlockSize, N - jb);
+        std::fill(acc_dgamma, acc_dgamma + len, T_ACC(0));
+        std::fill(acc_dbeta, acc_dbeta + len, T_ACC(0));
         for (const auto i : c10::irange(num_threads)) {
-          dgamma_v += buffer_data[i * N + j];
-          dbeta_v += buffer_data[num_threads * N + i * N + j];
+          if (!dgamma_null) {
+            vec::convert(buffer_data + i * N + jb, row, len);
+            vec::map2<T_ACC>(
+                [](Vec acc, Vec v) { return acc + v; },
+                acc_dgamma,
+                acc_dgamma,
+                row,
+                len);
+          }
+          if (!dbeta_null) {
+            vec::convert(buffer_data + num_threads * N + i * N + jb, row, len);
+            vec::map2<T_ACC>(
+                [](Vec acc, Vec v) { return acc + v; },
+                acc_dbeta,
+                acc_dbeta,
+                row,
+                len);
+          }
         }
         if (!dgamma_null) {
           // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-          dgamma_data[j] = dgamma_v;
+          vec::convert(acc_dgamma, dgamma_data + jb, len);
         }
         if (!dbeta_null) {
           // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
-          dbeta_data[j] = dbeta_v;
+          vec::convert(acc_dbeta, dbeta_data + jb, len);
         }
       }
     });
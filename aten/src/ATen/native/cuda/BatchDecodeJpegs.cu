@@ -0,0 +1,269 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAConfig.h>
+#include <c10/core/ScalarType.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_batch_decode_jpegs_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#if AT_NVJPEG_ENABLED()
+#include <nvjpeg.h>
+#endif
+
+namespace at::native {
+
+#if !AT_NVJPEG_ENABLED()
+
+Tensor batch_decode_jpegs_cuda(
+    TensorList data,
+    IntArrayRef output_size,
+    c10::optional<ArrayRef<double>> mean,
+    c10::optional<ArrayRef<double>> std) {
+  TORCH_CHECK(
+      false, "_batch_decode_jpegs: PyTorch was built without nvJPEG support");
+}
+
+#else // AT_NVJPEG_ENABLED
+
+namespace {
+
+#define NVJPEG_CHECK(expr)                               \
+  do {                                                   \
+    const nvjpegStatus_t __err = (expr);                 \
+    TORCH_CHECK(                                         \
+        __err == NVJPEG_STATUS_SUCCESS,                  \
+        "nvJPEG failure: error #",                       \
+        static_cast<int>(__err),                         \
+        " when calling `" #expr "`");                    \
+  } while (0)
+
+// Decoded images and all nvJPEG scratch memory are stream-ordered through the
+// caching allocator, so the decode stage composes with the rest of the CUDA
+// pipeline without extra synchronization.
+int dev_malloc(void** p, size_t s) {
+  try {
+    *p = c10::cuda::CUDACachingAllocator::raw_alloc(s);
+  } catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+int dev_free(void* p) {
+  c10::cuda::CUDACachingAllocator::raw_delete(p);
+  return 0;
+}
+
+nvjpegHandle_t getNvjpegHandle() {
+  static nvjpegHandle_t handle = []() {
+    nvjpegDevAllocator_t dev_allocator = {&dev_malloc, &dev_free};
+    nvjpegHandle_t h = nullptr;
+    NVJPEG_CHECK(nvjpegCreateEx(
+        NVJPEG_BACKEND_DEFAULT,
+        &dev_allocator,
+        /*pinned_allocator=*/nullptr,
+        /*flags=*/0,
+        &h));
+    return h;
+  }();
+  return handle;
+}
+
+// One thread per output pixel: bilinear sample from the decoded interleaved
+// RGB image, then scale to [0, 1] and normalize per channel. Combining the
+// three steps avoids materializing a resized uint8 intermediate.
+__global__ void resize_normalize_kernel(
+    const uint8_t* __restrict__ in,
+    int in_h,
+    int in_w,
+    float* __restrict__ out,
+    int out_h,
+    int out_w,
+    float mean0,
+    float mean1,
+    float mean2,
+    float inv_std0,
+    float inv_std1,
+    float inv_std2) {
+  const int index = blockIdx.x * blockDim.x + threadIdx.x;
+  if (index >= out_h * out_w) {
+    return;
+  }
+  const int oy = index / out_w;
+  const int ox = index % out_w;
+
+  // align_corners=false source coordinates, clamped to the image.
+  const float scale_y = static_cast<float>(in_h) / out_h;
+  const float scale_x = static_cast<float>(in_w) / out_w;
+  const float sy = fminf(
+      fmaxf((oy + 0.5f) * scale_y - 0.5f, 0.f), static_cast<float>(in_h - 1));
+  const float sx = fminf(
+      fmaxf((ox + 0.5f) * scale_x - 0.5f, 0.f), static_cast<float>(in_w - 1));
+
+  const int y0 = static_cast<int>(sy);
+  const int x0 = static_cast<int>(sx);
+  const int y1 = min(y0 + 1, in_h - 1);
+  const int x1 = min(x0 + 1, in_w - 1);
+  const float wy = sy - y0;
+  const float wx = sx - x0;
+
+  const float mean[3] = {mean0, mean1, mean2};
+  const float inv_std[3] = {inv_std0, inv_std1, inv_std2};
+#pragma unroll
+  for (int c = 0; c < 3; ++c) {
+    const float v00 = in[(y0 * in_w + x0) * 3 + c];
+    const float v01 = in[(y0 * in_w + x1) * 3 + c];
+    const float v10 = in[(y1 * in_w + x0) * 3 + c];
+    const float v11 = in[(y1 * in_w + x1) * 3 + c];
+    const float v = (v00 * (1.f - wx) + v01 * wx) * (1.f - wy) +
+        (v10 * (1.f - wx) + v11 * wx) * wy;
+    out[(c * out_h + oy) * out_w + ox] = (v * (1.f / 255.f) - mean[c]) * inv_std[c];
+  }
+}
+
+} // namespace
+
+Tensor batch_decode_jpegs_cuda(
+    TensorList data,
+    IntArrayRef output_size,
+    c10::optional<ArrayRef<double>> mean,
+    c10::optional<ArrayRef<double>> std) {
+  const int64_t batch_size = data.size();
+  TORCH_CHECK(batch_size > 0, "_batch_decode_jpegs: expected a non-empty batch");
+  TORCH_CHECK(
+      output_size.size() == 2 && output_size[0] > 0 && output_size[1] > 0,
+      "_batch_decode_jpegs: output_size must be two positive dimensions");
+  TORCH_CHECK(
+      !mean.has_value() || mean->size() == 3,
+      "_batch_decode_jpegs: mean must have 3 values");
+  TORCH_CHECK(
+      !std.has_value() || std->size() == 3,
+      "_batch_decode_jpegs: std must have 3 values");
+  for (const auto i : c10::irange(batch_size)) {
+    const auto& t = data[i];
+    TORCH_CHECK(
+        t.device().is_cpu() && t.scalar_type() == kByte && t.dim() == 1 &&
+            t.numel() > 0 && t.is_contiguous(),
+        "_batch_decode_jpegs: data[",
+        i,
+        "] must be a non-empty contiguous 1-d CPU uint8 tensor");
+  }
+
+  const int out_h = static_cast<int>(output_size[0]);
+  const int out_w = static_cast<int>(output_size[1]);
+  const auto stream = at::cuda::getCurrentCUDAStream();
+  nvjpegHandle_t handle = getNvjpegHandle();
+
+  // The batched decode API is stateful (initialize, then decode), so calls
+  // are serialized on one long-lived state; this also keeps the state alive
+  // while previously queued decodes are still in flight on the stream.
+  static std::mutex decode_mutex;
+  static nvjpegJpegState_t state = [&]() {
+    nvjpegJpegState_t s = nullptr;
+    NVJPEG_CHECK(nvjpegJpegStateCreate(handle, &s));
+    return s;
+  }();
+  const std::lock_guard<std::mutex> lock(decode_mutex);
+
+  std::vector<const unsigned char*> bitstreams(batch_size);
+  std::vector<size_t> lengths(batch_size);
+  std::vector<Tensor> decoded(batch_size);
+  std::vector<nvjpegImage_t> images(batch_size);
+  std::vector<std::pair<int, int>> shapes(batch_size);
+
+  for (const auto i : c10::irange(batch_size)) {
+    bitstreams[i] = data[i].const_data_ptr<uint8_t>();
+    lengths[i] = data[i].numel();
+
+    int components = 0;
+    nvjpegChromaSubsampling_t subsampling;
+    int widths[NVJPEG_MAX_COMPONENT];
+    int heights[NVJPEG_MAX_COMPONENT];
+    NVJPEG_CHECK(nvjpegGetImageInfo(
+        handle, bitstreams[i], lengths[i], &components, &subsampling, widths,
+        heights));
+    const int in_h = heights[0];
+    const int in_w = widths[0];
+    TORCH_CHECK(
+        in_h > 0 && in_w > 0,
+        "_batch_decode_jpegs: data[", i, "] has invalid dimensions");
+    shapes[i] = {in_h, in_w};
+
+    // Interleaved RGB scratch image; freed stream-ordered when the tensor
+    // goes out of scope after the resize kernel is queued.
+    decoded[i] = at::empty(
+        {in_h, in_w, 3},
+        data[i].options().dtype(kByte).device(kCUDA));
+    std::memset(&images[i], 0, sizeof(nvjpegImage_t));
+    images[i].channel[0] = decoded[i].mutable_data_ptr<uint8_t>();
+    images[i].pitch[0] = static_cast<size_t>(in_w) * 3;
+  }
+
+  NVJPEG_CHECK(nvjpegDecodeBatchedInitialize(
+      handle,
+      state,
+      static_cast<int>(batch_size),
+      /*max_cpu_threads=*/1,
+      NVJPEG_OUTPUT_RGBI));
+  NVJPEG_CHECK(nvjpegDecodeBatched(
+      handle,
+      state,
+      bitstreams.data(),
+      lengths.data(),
+      images.data(),
+      stream.stream()));
+
+  auto out = at::empty(
+      {batch_size, 3, out_h, out_w},
+      data[0].options().dtype(kFloat).device(kCUDA));
+
+  const double* mean_vals = mean.has_value() ? mean->data() : nullptr;
+  const double* std_vals = std.has_value() ? std->data() : nullptr;
+  const float mean0 = mean_vals ? static_cast<float>(mean_vals[0]) : 0.f;
+  const float mean1 = mean_vals ? static_cast<float>(mean_vals[1]) : 0.f;
+  const float mean2 = mean_vals ? static_cast<float>(mean_vals[2]) : 0.f;
+  const float inv_std0 = std_vals ? 1.f / static_cast<float>(std_vals[0]) : 1.f;
+  const float inv_std1 = std_vals ? 1.f / static_cast<float>(std_vals[1]) : 1.f;
+  const float inv_std2 = std_vals ? 1.f / static_cast<float>(std_vals[2]) : 1.f;
+
+  const int threads = 256;
+  const int blocks = (out_h * out_w + threads - 1) / threads;
+  for (const auto i : c10::irange(batch_size)) {
+    resize_normalize_kernel<<<blocks, threads, 0, stream.stream()>>>(
+        decoded[i].const_data_ptr<uint8_t>(),
+        shapes[i].first,
+        shapes[i].second,
+        out.mutable_data_ptr<float>() + i * 3 * out_h * out_w,
+        out_h,
+        out_w,
+        mean0,
+        mean1,
+        mean2,
+        inv_std0,
+        inv_std1,
+        inv_std2);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  }
+
+  return out;
+}
+
+#undef NVJPEG_CHECK
+
+#endif // AT_NVJPEG_ENABLED
+
+} // namespace at::native
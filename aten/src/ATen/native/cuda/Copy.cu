@@ -8,6 +8,7 @@
 #include <ATen/cuda/PeerToPeerAccess.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
+#include <ATen/native/cuda/Copy.h>
 #include <ATen/native/cuda/Loops.cuh>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -17,8 +18,11 @@
 #endif
 
 #include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
 #include <c10/cuda/CUDAStream.h>
 
+#include <memory>
+
 namespace at::native {
 
 void neg_kernel_cuda(TensorIteratorBase &iter);
@@ -269,4 +273,70 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
 
 REGISTER_DISPATCH(copy_stub, &copy_kernel_cuda);
 
+namespace {
+
+struct AsyncCopyContext {
+  c10::intrusive_ptr<c10::ivalue::Future> future;
+  Tensor dst;
+};
+
+// Runs on a CUDA driver thread once the copy has completed on the device.
+// Note: CUDA API calls are not allowed from host callbacks; the future is
+// constructed without devices so markCompleted stays on the CPU path.
+void complete_async_copy(void* raw) {
+  std::unique_ptr<AsyncCopyContext> ctx(static_cast<AsyncCopyContext*>(raw));
+  ctx->future->markCompleted(c10::IValue(std::move(ctx->dst)));
+}
+
+} // anonymous namespace
+
+c10::intrusive_ptr<c10::ivalue::Future> async_copy_to_host(const Tensor& src) {
+  TORCH_CHECK(
+      src.is_cuda(),
+      "async_copy_to_host expects a CUDA tensor, but got a tensor on ",
+      src.device());
+
+  auto future =
+      c10::make_intrusive<c10::ivalue::Future>(c10::TensorType::get());
+
+  const auto device = src.device();
+  CUDAGuard device_guard(device);
+
+  // Stage the readback on a side stream that waits on the current stream, so
+  // the copy (and the host callback, which blocks its stream) never
+  // serializes work the caller enqueues next.
+  CUDAStream copy_stream =
+      getStreamFromPool(/*isHighPriority=*/false, device.index());
+  CUDAEvent src_ready;
+  src_ready.record(getCurrentCUDAStream(device.index()));
+  src_ready.block(copy_stream);
+
+  Tensor dst;
+  {
+    c10::cuda::CUDAStreamGuard stream_guard(copy_stream);
+    dst = at::empty_like(
+        src,
+        src.options().device(kCPU).pinned_memory(true),
+        LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+    dst.copy_(src, /*non_blocking=*/true);
+    // The side stream now reads src's memory; keep the caching allocator
+    // from handing it out before the copy completes. (The pinned dst is
+    // protected by the CachingHostAllocator_recordEvent call in the copy.)
+    c10::cuda::CUDACachingAllocator::recordStream(
+        src.storage().data_ptr(), copy_stream);
+  }
+
+  auto ctx = std::make_unique<AsyncCopyContext>();
+  ctx->future = future;
+  ctx->dst = std::move(dst);
+  const auto err =
+      cudaLaunchHostFunc(copy_stream, complete_async_copy, ctx.get());
+  if (err == cudaSuccess) {
+    // Ownership passed to the callback.
+    ctx.release();
+  }
+  AT_CUDA_CHECK(err);
+  return future;
+}
+
 } // namespace at::native
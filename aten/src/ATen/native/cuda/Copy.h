@@ -1,10 +1,24 @@
 #pragma once
 
+#include <ATen/core/ivalue.h>
+
 namespace at {
+class Tensor;
 struct TensorIteratorBase;
 
 namespace native {
 
 void direct_copy_kernel_cuda(TensorIteratorBase &iter);
 
+// Asynchronously copies a CUDA tensor to a pinned host tensor allocated from
+// the caching host allocator, returning a Future that a CUDA host callback
+// completes with the destination tensor once the copy has finished on the
+// device. The copy is staged on a side stream that waits on the current
+// stream, so readback (e.g. of losses and metrics) overlaps with whatever the
+// caller enqueues next. The caller never needs to synchronize a stream; any
+// callbacks attached to the Future run on a CUDA driver thread and must not
+// issue CUDA work themselves.
+TORCH_CUDA_CU_API c10::intrusive_ptr<c10::ivalue::Future> async_copy_to_host(
+    const Tensor& src);
+
 }}  // namespace at::native
@@ -127,12 +127,9 @@ void distribution_nullary_kernel(at::TensorIteratorBase& iter,
   auto counter_offset = std::get<0>(execution_policy);
   auto grid = std::get<1>(execution_policy);
   auto block = std::get<2>(execution_policy);
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs =
+      gen->reserve_philox_cuda_state(counter_offset);
 
   if (!iter.can_use_32bit_indexing()) {
     for (auto& sub_iter : iter.with_32bit_indexing()) {
@@ -624,12 +621,8 @@ void bernoulli_tensor_cuda_kernel(
 
 template<typename RNG>
 void bernoulli_kernel(const TensorBase &self, const TensorBase &p_, RNG gen) {
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(10);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs = gen->reserve_philox_cuda_state(10);
   TORCH_CHECK(at::isFloatingType(p_.scalar_type()), "expected probabilities tensor to have floating type, got ", p_.scalar_type());
   // cast probabilities tensor to double for double `self` tensor, and to `float` for everything else
   const auto p_type = self.dtype() == at::kDouble ? at::kDouble : at::kFloat;
@@ -148,12 +148,8 @@ void launch_dirichlet_kernel(at::TensorIteratorBase &iter) {
 
 void launch_poisson_cuda_kernel(
     const TensorBase &ret, const TensorBase &lambda, CUDAGeneratorImpl *gen) {
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(20);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs = gen->reserve_philox_cuda_state(20);
   AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::Half, at::ScalarType::BFloat16, ret.scalar_type(), "poisson_cuda", [&] {
     poisson_cuda_kernel<scalar_t>(ret, lambda, rng_engine_inputs);
   });
@@ -161,12 +157,8 @@ void launch_poisson_cuda_kernel(
 
 void launch_binomial_cuda_kernel(
     TensorIteratorBase &iter, CUDAGeneratorImpl *gen) {
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(42);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs = gen->reserve_philox_cuda_state(42);
   AT_DISPATCH_FLOATING_TYPES_AND_HALF(iter.input_dtype(), "binomial_cuda", [&] {
     binomial_cuda_kernel<scalar_t>(iter, rng_engine_inputs);
   });
@@ -174,12 +166,8 @@ void launch_binomial_cuda_kernel(
 
 void launch_gamma_kernel(
     const TensorBase &ret, const TensorBase &alpha, CUDAGeneratorImpl *gen) {
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(10);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs = gen->reserve_philox_cuda_state(10);
   AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::Half, at::ScalarType::BFloat16, ret.scalar_type(), "gamma_cuda", [&] {
      gamma_cuda_kernel<scalar_t>(ret, alpha, rng_engine_inputs);
    });
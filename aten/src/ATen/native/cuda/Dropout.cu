@@ -349,12 +349,9 @@ dropout_cuda(CUDAGeneratorImpl* gen, const Tensor& self, double p){
   grid.x = std::min((unsigned int)at::cuda::getCurrentDeviceProperties()->multiProcessorCount * blocks_per_sm, grid.x);
 //number of times random will be generated per thread, to offset philox counter in thc random state
   int64_t counter_offset = ((nelem - 1)/(block_size*grid.x*UNROLL)+1)*UNROLL;
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs =
+      gen->reserve_philox_cuda_state(counter_offset);
   if (cuda::detail::canUse32BitIndexMath(self)){
     launcher<unsigned int, mask_t>(
         self, ret, mask, p, nelem, rng_engine_inputs, grid, dim_block);
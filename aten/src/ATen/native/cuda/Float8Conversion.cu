@@ -0,0 +1,141 @@
+#define TORCH_ASSERT_NO_OPERATORS
+#include <ATen/Dispatch.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/native/Float8Conversion.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cuda/Loops.cuh>
+
+// cuda_fp8.h ships the hardware fp8 conversion intrinsics starting with
+// CUDA 11.8; older toolkits fall back to the shared bit-twiddling helpers,
+// which produce identical results (round-to-nearest-even, no saturation).
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11080
+#include <cuda_fp8.h>
+#define AT_CUDA_HAS_FP8_INTRINSICS() 1
+#else
+#define AT_CUDA_HAS_FP8_INTRINSICS() 0
+#endif
+
+namespace at {
+namespace native {
+namespace {
+
+using namespace at::native::float8;
+
+template <bool E5M2>
+__device__ __forceinline__ uint8_t fp8_encode(float v) {
+#if AT_CUDA_HAS_FP8_INTRINSICS()
+  return static_cast<uint8_t>(__nv_cvt_float_to_fp8(
+      v, __NV_NOSAT, E5M2 ? __NV_E5M2 : __NV_E4M3));
+#else
+  return E5M2 ? fp8e5m2_from_fp32_value(v) : fp8e4m3fn_from_fp32_value(v);
+#endif
+}
+
+template <bool E5M2>
+__device__ __forceinline__ float fp8_decode(uint8_t v) {
+#if AT_CUDA_HAS_FP8_INTRINSICS()
+  return __half2float(__half(
+      __nv_cvt_fp8_to_halfraw(v, E5M2 ? __NV_E5M2 : __NV_E4M3)));
+#else
+  return E5M2 ? fp8e5m2_to_fp32_value(v) : fp8e4m3fn_to_fp32_value(v);
+#endif
+}
+
+void pack_float8_kernel_cuda(TensorIteratorBase& iter, bool e5m2) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, iter.dtype(1), "_pack_float8_cuda", [&]() {
+        if (e5m2) {
+          gpu_kernel(iter, [] GPU_LAMBDA(scalar_t v) -> uint8_t {
+            return fp8_encode<true>(static_cast<float>(v));
+          });
+        } else {
+          gpu_kernel(iter, [] GPU_LAMBDA(scalar_t v) -> uint8_t {
+            return fp8_encode<false>(static_cast<float>(v));
+          });
+        }
+      });
+}
+
+void unpack_float8_kernel_cuda(TensorIteratorBase& iter, bool e5m2) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, iter.dtype(0), "_unpack_float8_cuda", [&]() {
+        if (e5m2) {
+          gpu_kernel(iter, [] GPU_LAMBDA(uint8_t v) -> scalar_t {
+            return static_cast<scalar_t>(fp8_decode<true>(v));
+          });
+        } else {
+          gpu_kernel(iter, [] GPU_LAMBDA(uint8_t v) -> scalar_t {
+            return static_cast<scalar_t>(fp8_decode<false>(v));
+          });
+        }
+      });
+}
+
+template <typename scalar_t, typename index_t, bool E5M2>
+__global__ void float8_index_select_cuda_kernel(
+    scalar_t* dst,
+    const uint8_t* src,
+    const index_t* idx,
+    int64_t num_indices,
+    int64_t num_rows,
+    int64_t row) {
+  const int64_t total = num_indices * row;
+  for (int64_t linear = blockIdx.x * blockDim.x + threadIdx.x; linear < total;
+       linear += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    const int64_t i = linear / row;
+    const int64_t c = linear - i * row;
+    const index_t j = idx[i];
+    CUDA_KERNEL_ASSERT(j >= 0 && j < num_rows);
+    dst[linear] =
+        static_cast<scalar_t>(fp8_decode<E5M2>(src[int64_t(j) * row + c]));
+  }
+}
+
+void float8_index_select_kernel_cuda(
+    const Tensor& out,
+    const Tensor& self,
+    const Tensor& index,
+    bool e5m2) {
+  const int64_t num_indices = index.numel();
+  const int64_t num_rows = self.size(0);
+  const int64_t row = self.size(1);
+  const int64_t total = num_indices * row;
+  if (total == 0) {
+    return;
+  }
+  const uint8_t* src = self.data_ptr<uint8_t>();
+  auto stream = at::cuda::getCurrentCUDAStream();
+  const int64_t threads = 256;
+  const int64_t blocks = std::min(
+      (total + threads - 1) / threads,
+      static_cast<int64_t>(
+          at::cuda::getCurrentDeviceProperties()->multiProcessorCount) * 8);
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, out.scalar_type(), "_float8_index_select_cuda", [&]() {
+        scalar_t* dst = out.data_ptr<scalar_t>();
+        AT_DISPATCH_INDEX_TYPES(
+            index.scalar_type(), "_float8_index_select_cuda", [&]() {
+              const index_t* idx = index.data_ptr<index_t>();
+              if (e5m2) {
+                float8_index_select_cuda_kernel<scalar_t, index_t, true>
+                    <<<blocks, threads, 0, stream>>>(
+                        dst, src, idx, num_indices, num_rows, row);
+              } else {
+                float8_index_select_cuda_kernel<scalar_t, index_t, false>
+                    <<<blocks, threads, 0, stream>>>(
+                        dst, src, idx, num_indices, num_rows, row);
+              }
+              C10_CUDA_KERNEL_LAUNCH_CHECK();
+            });
+      });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(pack_float8_stub, &pack_float8_kernel_cuda);
+REGISTER_DISPATCH(unpack_float8_stub, &unpack_float8_kernel_cuda);
+REGISTER_DISPATCH(float8_index_select_stub, &float8_index_select_kernel_cuda);
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,120 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/Dispatch.h>
+#include <ATen/TypeDefault.h>
+#include <ATen/native/cuda/fused_adam_utils.cuh>
+#include <ATen/native/cuda/MultiTensorApply.cuh>
+#include <c10/util/Exception.h>
+#include <vector>
+
+namespace at::native {
+
+namespace {
+
+void check_master_weights_restrictions(
+    at::TensorList params,
+    at::TensorList master_params,
+    at::ArrayRef<at::TensorList> fp32_state_lists
+) {
+  TORCH_CHECK(
+      params[0].scalar_type() == at::kHalf || params[0].scalar_type() == at::kBFloat16,
+      "params must be fp16 or bf16 when master weights are used, got ", params[0].scalar_type());
+  for (const auto& l : fp32_state_lists) {
+    TORCH_CHECK(l.size() == params.size(), "tensor list sizes must match");
+  }
+  for (size_t i = 0; i < params.size(); i++) {
+    TORCH_CHECK(
+        params[i].scalar_type() == params[0].scalar_type() && params[i].layout() == at::kStrided,
+        "params must share one fp16/bf16 dtype and be strided");
+    TORCH_CHECK(
+        master_params[i].scalar_type() == at::kFloat,
+        "master_params must be fp32, got ", master_params[i].scalar_type());
+    for (const auto& l : fp32_state_lists) {
+      TORCH_CHECK(
+          l[i].scalar_type() == at::kFloat && l[i].numel() == params[i].numel(),
+          "optimizer states must be fp32 and match params' numel");
+    }
+  }
+}
+
+} // anonymous namespace
+
+// Single-pass mixed-precision Adam: the fp32 master params drive the update
+// math and the fp16/bf16 params are refreshed from them in the same kernel,
+// instead of a fused step on the master copy followed by a `_foreach_copy_`
+// style downcast pass over every parameter.
+void _fused_adam_with_master_weights_kernel_cuda_(
+    at::TensorList params,
+    at::TensorList master_params,
+    at::TensorList grads,
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs,
+    at::TensorList state_steps,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const c10::optional<at::Tensor>& grad_scale,
+    const c10::optional<at::Tensor>& found_inf
+) {
+  TORCH_CHECK(
+      grads.size() == params.size() && master_params.size() == params.size(),
+      "tensor list sizes must match");
+  TORCH_CHECK(
+      at::native::check_fast_path_restrictions({params, grads}),
+      "params and grads must have same dtype, device, and layout");
+
+  float* grad_scale_ptr = grad_scale.has_value() ? grad_scale->data_ptr<float>() : nullptr;
+  float* found_inf_ptr = found_inf.has_value() ? found_inf->data_ptr<float>() : nullptr;
+
+  if (amsgrad) {
+    check_master_weights_restrictions(
+        params, master_params, {master_params, exp_avgs, exp_avg_sqs, max_exp_avg_sqs});
+    std::vector<std::vector<at::Tensor>> tensor_lists{
+      params.vec(), grads.vec(), exp_avgs.vec(), exp_avg_sqs.vec(), max_exp_avg_sqs.vec(), master_params.vec() };
+    AT_DISPATCH_REDUCED_FLOATING_TYPES(params[0].scalar_type(),
+        "fused_adam_with_master_weights_kernel_cuda", [&]() {
+          multi_tensor_apply_for_fused_optimizer<6>(
+              tensor_lists,
+              state_steps,
+              FusedAdamMasterWeightsMathFunctor<scalar_t, 6>(),
+              lr,
+              beta1,
+              beta2,
+              weight_decay,
+              eps,
+              maximize,
+              /* amsgrad */true,
+              grad_scale_ptr,
+              found_inf_ptr,
+              ADAM_MODE::ORIGINAL);
+          });
+  } else {
+    check_master_weights_restrictions(
+        params, master_params, {master_params, exp_avgs, exp_avg_sqs});
+    std::vector<std::vector<at::Tensor>> tensor_lists{
+      params.vec(), grads.vec(), exp_avgs.vec(), exp_avg_sqs.vec(), master_params.vec() };
+    AT_DISPATCH_REDUCED_FLOATING_TYPES(params[0].scalar_type(),
+        "fused_adam_with_master_weights_kernel_cuda", [&]() {
+          multi_tensor_apply_for_fused_optimizer<5>(
+              tensor_lists,
+              state_steps,
+              FusedAdamMasterWeightsMathFunctor<scalar_t, 5>(),
+              lr,
+              beta1,
+              beta2,
+              weight_decay,
+              eps,
+              maximize,
+              /* amsgrad */false,
+              grad_scale_ptr,
+              found_inf_ptr,
+              ADAM_MODE::ORIGINAL);
+          });
+  }
+}
+
+} // namespace at::native
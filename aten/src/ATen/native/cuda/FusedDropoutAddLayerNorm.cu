@@ -0,0 +1,271 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/layer_norm.h>
+
+#include <type_traits>
+#include <vector>
+
+#include <thrust/tuple.h>
+
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/cuda/CUDAMathCompat.h>
+#include <c10/util/irange.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_dropout_add_layer_norm_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like_native.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// One block per layer norm row. A single pass over the row applies dropout
+// to X, adds the residual, writes the layer norm input Y and the packed
+// dropout mask, and accumulates Welford moments; after a block reduction
+// the row is normalized from Y (still hot in cache). Compared to separate
+// dropout, add and layer_norm launches this reads the activation once
+// instead of three times and stores the mask at one bit per element.
+//
+// Each thread owns whole bytes of the row's bitmask (8 consecutive
+// elements), so no two threads ever write the same byte.
+template <typename T, typename T_ACC>
+__global__ void FusedDropoutAddLayerNormCUDAKernel(
+    int64_t N,
+    int64_t bytes_per_row,
+    float keep_p,
+    T_ACC scale,
+    T_ACC eps,
+    PhiloxCudaState philox_args,
+    const T* X,
+    const T* R,
+    const T* gamma,
+    const T* beta,
+    T* Y,
+    uint8_t* mask_bits,
+    T* out,
+    T_ACC* mean,
+    T_ACC* rstd) {
+  using WelfordType = WelfordData<T_ACC, int64_t>;
+  using WelfordOp =
+      WelfordOps<T_ACC, T_ACC, int64_t, thrust::pair<T_ACC, T_ACC>>;
+
+  __shared__
+      typename std::aligned_storage<sizeof(WelfordType), alignof(WelfordType)>::
+          type val_shared[C10_WARP_SIZE];
+  WelfordType* val_shared_ptr = reinterpret_cast<WelfordType*>(val_shared);
+  __shared__ T_ACC s_mean;
+  __shared__ T_ACC s_rstd;
+
+  const int64_t i = blockIdx.x;
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      i * blockDim.x + threadIdx.x,
+      std::get<1>(seeds),
+      &state);
+
+  WelfordOp welford_op = {/*correction=*/0, /*take_sqrt=*/false};
+  WelfordType val(0, 0, 0, 0);
+
+  for (int64_t b = threadIdx.x; b < bytes_per_row; b += blockDim.x) {
+    const float4 u0 = curand_uniform4(&state);
+    const float4 u1 = curand_uniform4(&state);
+    const float u[8] = {u0.x, u0.y, u0.z, u0.w, u1.x, u1.y, u1.z, u1.w};
+    const int64_t j0 = b * 8;
+    uint8_t byte = 0;
+#pragma unroll
+    for (int k = 0; k < 8; ++k) {
+      const int64_t j = j0 + k;
+      if (j < N) {
+        const bool keep = u[k] < keep_p;
+        const int64_t index = i * N + j;
+        const T_ACC x =
+            keep ? static_cast<T_ACC>(X[index]) * scale : T_ACC(0);
+        const T_ACC y = x + static_cast<T_ACC>(R[index]);
+        Y[index] = y;
+        byte |= static_cast<uint8_t>(keep) << k;
+        val = welford_op.reduce(val, y, index);
+      }
+    }
+    mask_bits[i * bytes_per_row + b] = byte;
+  }
+
+  val = cuda_utils::BlockReduce(
+      val,
+      welford_op,
+      /*identity_element=*/WelfordType(0, 0, 0, 0),
+      val_shared_ptr);
+
+  if (threadIdx.x == 0) {
+    T_ACC m1;
+    T_ACC m2;
+    thrust::tie(m2, m1) = welford_op.project(val);
+    s_mean = m1;
+    s_rstd = c10::cuda::compat::rsqrt(m2 + eps);
+    mean[i] = s_mean;
+    rstd[i] = s_rstd;
+  }
+  __syncthreads();
+
+  const T_ACC row_mean = s_mean;
+  const T_ACC row_rstd = s_rstd;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    const T_ACC gamma_v =
+        gamma == nullptr ? T_ACC(1) : static_cast<T_ACC>(gamma[j]);
+    const T_ACC beta_v =
+        beta == nullptr ? T_ACC(0) : static_cast<T_ACC>(beta[j]);
+    out[index] =
+        (static_cast<T_ACC>(Y[index]) - row_mean) * row_rstd * gamma_v +
+        beta_v;
+  }
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor>
+fused_dropout_add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    double eps,
+    bool train) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      p);
+  TORCH_CHECK(
+      residual.sizes().equals(input.sizes()),
+      "Expected residual to have the same shape as input, but got residual "
+      "of shape ",
+      residual.sizes(),
+      " and input of shape ",
+      input.sizes());
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+
+  // The fused kernel only pays off when dropout actually runs; otherwise
+  // the dropout-free composite path already does a plain add + layer_norm.
+  if (!train || p == 0 || input.numel() == 0) {
+    return math_fused_dropout_add_layer_norm(
+        input, residual, normalized_shape, weight_opt, bias_opt, p, eps, train);
+  }
+  TORCH_CHECK(
+      M <= at::cuda::getCurrentDeviceProperties()->maxGridSize[0],
+      "M should be less than maximum CUDA grid size, file a support request "
+      "to support bigger batches");
+
+  auto X = input.expect_contiguous();
+  auto R = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor out = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  const int64_t bytes_per_row = (N + 7) / 8;
+  Tensor mask_bits =
+      at::empty({M, bytes_per_row}, X->options().dtype(kByte));
+  auto acc_type = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor mean = at::empty({M}, X->options().dtype(acc_type));
+  Tensor rstd = at::empty({M}, X->options().dtype(acc_type));
+
+  const double p1m = 1. - p;
+  const double scale = p1m == 0 ? 0. : 1. / p1m;
+
+  auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+      c10::nullopt, cuda::detail::getDefaultCUDAGenerator());
+  // Each thread draws 8 uniforms per mask byte it owns.
+  const int64_t counter_offset =
+      ((bytes_per_row + cuda_utils::kCUDABlockReduceNumThreads - 1) /
+       cuda_utils::kCUDABlockReduceNumThreads) *
+      8;
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs =
+      gen->reserve_philox_cuda_state(counter_offset);
+
+  cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::ScalarType::Half,
+      at::ScalarType::BFloat16,
+      input.scalar_type(),
+      "fused_dropout_add_layer_norm_cuda",
+      [&]() {
+        using acc_t = acc_type<scalar_t, true>;
+        FusedDropoutAddLayerNormCUDAKernel<scalar_t, acc_t>
+            <<<M, cuda_utils::kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+                N,
+                bytes_per_row,
+                static_cast<float>(p1m),
+                static_cast<acc_t>(scale),
+                static_cast<acc_t>(eps),
+                rng_engine_inputs,
+                X->const_data_ptr<scalar_t>(),
+                R->const_data_ptr<scalar_t>(),
+                gamma->defined() ? gamma->const_data_ptr<scalar_t>() : nullptr,
+                beta->defined() ? beta->const_data_ptr<scalar_t>() : nullptr,
+                Y.mutable_data_ptr<scalar_t>(),
+                mask_bits.mutable_data_ptr<uint8_t>(),
+                out.mutable_data_ptr<scalar_t>(),
+                mean.mutable_data_ptr<acc_t>(),
+                rstd.mutable_data_ptr<acc_t>());
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+
+  const auto input_shape = input.sizes();
+  const size_t axis = input.dim() - normalized_shape.size();
+  std::vector<int64_t> stat_shape;
+  for (const auto idx : c10::irange(axis)) {
+    stat_shape.push_back(input_shape[idx]);
+  }
+  for (const auto C10_UNUSED idx : c10::irange(axis, input.dim())) {
+    stat_shape.push_back(1);
+  }
+  mean = mean.view(stat_shape);
+  rstd = rstd.view(stat_shape);
+
+  return std::make_tuple(
+      std::move(out),
+      std::move(Y),
+      std::move(mask_bits),
+      std::move(mean),
+      std::move(rstd));
+}
+
+} // namespace at::native
@@ -428,14 +428,13 @@ void multinomial_with_replacement_kernel_impl(
         int grid_y=std::min<int>(numDist, at::cuda::getCurrentDeviceProperties()->maxGridSize[1]);
         dim3 grid((n_sample-1)/block.x+1, grid_y);
         {
-          // See Note [Acquire lock when using random generators]
-          std::lock_guard<std::mutex> lock(gen->mutex_);
-
           // each thread generates a single sample for (numdist/numblocks.y) distributions, however, since we have to use
           // curand_uniform4 (See Note [Register spilling in curand call for CUDA < 10]),
           // offset is 4 times that.
           auto offset = ((numDist-1)/grid.y+1)*4;
-          rng_engine_inputs = gen->philox_cuda_state(offset);
+          // Eager-mode reservation is lock-free; see
+          // Note [CUDA Graph-safe RNG states]
+          rng_engine_inputs = gen->reserve_philox_cuda_state(offset);
         }
         // Sample with replacement
 
@@ -3,18 +3,25 @@
 #include <assert.h>
 #include <ATen/core/Array.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
 #include <ATen/cuda/DeviceUtils.cuh>
+#include <ATen/cuda/KernelLaunchTuner.h>
 #include <ATen/cuda/detail/OffsetCalculator.cuh>
 #include <ATen/detail/FunctionTraits.h>
 #include <ATen/native/TensorIterator.h>
+#include <ATen/record_function.h>
 #include <ATen/native/cuda/thread_constants.h>
 #include <ATen/native/cuda/MemoryAccess.cuh>
 #include <ATen/OpMathType.h>
 #include <c10/macros/Macros.h>
 #include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGraphsC10Utils.h>
 #include <functional>
 #include <iosfwd>
+#include <limits>
+#include <sstream>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 #include <thrust/pair.h>
 
@@ -218,6 +225,19 @@ struct ReduceConfig {
 
 std::ostream& operator<<(std::ostream& out, const ReduceConfig& config);
 
+// Surfaces the chosen launch configuration as a profiler event so config
+// decisions (e.g. Note [Sliver reduction split policy] or a tuned split
+// factor) can be verified from a trace instead of by recompiling with
+// debug output. No-op unless profiling callbacks are installed.
+inline void record_reduce_config(const ReduceConfig& config) {
+  if (C10_UNLIKELY(at::hasCallbacks())) {
+    std::ostringstream ss;
+    ss << config;
+    RECORD_FUNCTION(
+        "cuda_reduce_config", std::vector<c10::IValue>({ss.str()}));
+  }
+}
+
 template<int nt, int output_vec_size, typename R>
 C10_LAUNCH_BOUNDS_2(nt, 4)
 __global__ void reduce_kernel(R reduction) {
@@ -996,7 +1016,7 @@ int get_output_vec_size(const TensorIterator &iter) {
 }
 
 template<typename arg_t, typename scalar_t, int vt0>
-ReduceConfig setReduceConfig(const TensorIterator& iter){
+ReduceConfig setReduceConfig(const TensorIterator& iter, int ctas_per_output_override = -1){
   // Start by assuming that each thread handles a single output and all
   // the inputs for that output.
   int64_t num_outputs = iter.num_output_elements();
@@ -1122,6 +1142,36 @@ ReduceConfig setReduceConfig(const TensorIterator& iter){
     // a large number of values to deal with. But we don't want values_per_thread to be larger than
     // max_values_per_thread
     config.ctas_per_output = std::max(std::min<int>(ctas_per_output1, ctas_per_output2), ctas_per_output3);
+    // Note [Sliver reduction split policy]
+    // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // "Sliver" shapes -- a handful of outputs each reducing millions of
+    // elements (e.g. [4, 10M] reduced over dim 1) -- get almost no block
+    // parallelism from their outputs, so capping the input split at one wave
+    // of blocks (ctas_per_output1) leaves every thread with a very long
+    // serial accumulation while the tree stage stays negligible. Classify
+    // such shapes by how badly the output grid underfills the device and let
+    // them split the input further, up to kSliverWaves waves of blocks, so
+    // values_per_thread approaches min_values_per_thread. The existing
+    // two-stage global reduction absorbs the extra partials: the final block
+    // per output reduces them cooperatively, so its cost grows only
+    // marginally with the split.
+    enum class ReduceShapeClass { Balanced, Sliver };
+    constexpr int kSliverWaves = 4;
+    const auto shape_class =
+        (grid * 8 <= target_grid_size && inputs_per_output >= (1 << 20))
+        ? ReduceShapeClass::Sliver
+        : ReduceShapeClass::Balanced;
+    if (shape_class == ReduceShapeClass::Sliver) {
+      config.ctas_per_output = std::max(
+          config.ctas_per_output,
+          std::min<int>(ctas_per_output2, kSliverWaves * ctas_per_output1));
+    }
+    if (ctas_per_output_override > 0) {
+      // A tuned (or candidate) split factor from the kernel launch tuner
+      // replaces the heuristic one. The guard above already established
+      // that splitting the input across thread-blocks is legal here.
+      config.ctas_per_output = ctas_per_output_override;
+    }
     if (config.ctas_per_output > 1) {
       config.input_mult[2] = config.split_input(config.ctas_per_output);
     }
@@ -1129,9 +1179,69 @@ ReduceConfig setReduceConfig(const TensorIterator& iter){
   return config;
 };
 
+// Database key for the launch tuner. Problem sizes are bucketed to powers
+// of two so one measurement covers a whole shape class rather than a
+// single exact shape; the functor type distinguishes different reductions
+// instantiated from the same template.
+template <typename ops_t>
+inline std::string reduce_tuning_key(const TensorIterator& iter) {
+  auto bucket = [](int64_t n) {
+    int64_t b = 0;
+    while (n > 1) {
+      n >>= 1;
+      b++;
+    }
+    return b;
+  };
+  int64_t num_outputs = iter.num_output_elements();
+  std::ostringstream key;
+  key << "reduce:" << typeid(ops_t).name() << ':' << iter.input_dtype() << ':'
+      << iter.ndim() << ':' << iter.num_reduce_dims() << ":o"
+      << bucket(num_outputs) << ":r" << bucket(iter.numel() / num_outputs);
+  return key.str();
+}
+
+// Benchmarks a few input split factors around the heuristic choice and
+// returns the fastest. `run(candidate)` must enqueue the full reduction on
+// the current stream; the caller re-runs the winner afterwards, so output
+// written by losing candidates is overwritten.
+template <typename launch_t>
+inline int tune_ctas_per_output(int heuristic, const launch_t& run) {
+  const int candidates[] = {
+      1, heuristic / 2, heuristic, heuristic * 2, heuristic * 4};
+  auto stream = at::cuda::getCurrentCUDAStream();
+  float best_time = std::numeric_limits<float>::infinity();
+  int best = heuristic;
+  int prev = 0;
+  for (const int candidate : candidates) {
+    // The list is sorted ascending, so skipping repeats of the previous
+    // entry dedupes it (e.g. heuristic / 2 == 1 for heuristic == 2).
+    if (candidate < 1 || candidate == prev) {
+      continue;
+    }
+    prev = candidate;
+    at::cuda::CUDAEvent start(cudaEventDefault);
+    at::cuda::CUDAEvent stop(cudaEventDefault);
+    // Untimed warmup run so lazy allocations and instruction cache misses
+    // do not penalize whichever candidate happens to go first.
+    run(candidate);
+    start.record(stream);
+    run(candidate);
+    stop.record(stream);
+    stop.synchronize();
+    const float ms = start.elapsed_time(stop);
+    if (ms < best_time) {
+      best_time = ms;
+      best = candidate;
+    }
+  }
+  return best;
+}
+
 template <typename scalar_t, typename out_scalar_t, int vt0=4, typename ops_t, typename ident_t=double>
 inline void gpu_reduce_kernel(TensorIterator& iter, const ops_t& ops, ident_t ident=0,
-                              AccumulationBuffer* acc_buf_ptr=nullptr, int64_t base_idx=0) {
+                              AccumulationBuffer* acc_buf_ptr=nullptr, int64_t base_idx=0,
+                              int ctas_per_output_override=-1) {
   AT_ASSERT(iter.numel() > 0 && iter.ntensors() - iter.noutputs() == 1 && iter.noutputs() >= 1);
 
   using traits = function_traits<decltype(&ops_t::reduce)>;
@@ -1198,7 +1308,29 @@ inline void gpu_reduce_kernel(TensorIterator& iter, const ops_t& ops, ident_t id
   }
   char* acc_data = acc_buf_ptr->get_acc_slice(out_data);
 
-  ReduceConfig config = setReduceConfig<arg_t, scalar_t, vt0>(iter);
+  ReduceConfig config = setReduceConfig<arg_t, scalar_t, vt0>(iter, ctas_per_output_override);
+
+  if (ctas_per_output_override < 0 && config.should_global_reduce() &&
+      !iter.should_accumulate() && at::cuda::isKernelTuningEnabled() &&
+      c10::cuda::currentStreamCaptureStatusMayInitCtx() ==
+          c10::cuda::CaptureStatus::None) {
+    // Benchmark-and-persist mode: the heuristic split factor above is the
+    // starting point, not the answer. Only non-accumulating reductions are
+    // tuned -- candidate runs repeat the launch and must be idempotent.
+    const std::string key = reduce_tuning_key<ops_t>(iter);
+    auto tuned = at::cuda::lookupTunedValue(key);
+    if (!tuned.has_value()) {
+      tuned = tune_ctas_per_output(config.ctas_per_output, [&](int candidate) {
+        gpu_reduce_kernel<scalar_t, out_scalar_t, vt0>(
+            iter, ops, ident, acc_buf_ptr, base_idx, candidate);
+      });
+      at::cuda::recordTunedValue(key, *tuned);
+    }
+    gpu_reduce_kernel<scalar_t, out_scalar_t, vt0>(
+        iter, ops, ident, acc_buf_ptr, base_idx, static_cast<int>(*tuned));
+    return;
+  }
+
   at::DataPtr buffer;
   at::DataPtr semaphores;
   if (config.should_global_reduce()) {
@@ -1230,6 +1362,7 @@ inline void gpu_reduce_kernel(TensorIterator& iter, const ops_t& ops, ident_t id
   reduce.accumulate = iter.should_accumulate();
   reduce.final_output = iter.is_final_output();
 
+  record_reduce_config(config);
   launch_reduce_kernel<mnt_wrapper<scalar_t>::MAX_NUM_THREADS>(config, reduce);
 }
 
@@ -1348,6 +1481,7 @@ inline void jitted_gpu_reduce_kernel(TensorIterator& iter, const std::string& fu
   static std::vector<std::array<at::cuda::jit::NvrtcFunction, 3>> fn_cache(c10::cuda::device_count());
   auto &cache = fn_cache[iter.device().index()];
 
+  record_reduce_config(config);
   launch_jitted_reduce_kernel(
       jiterator_mutex, cache, desc, vt0, config, &reduce);
 }
@@ -88,12 +88,9 @@ inline void _rrelu_with_noise_cuda_train(
 
   auto gen = get_generator_or_default<CUDAGeneratorImpl>(
       generator, cuda::detail::getDefaultCUDAGenerator());
-  PhiloxCudaState rng_engine_inputs;
-  {
-    // See Note [Acquire lock when using random generators]
-    std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
-  }
+  // Eager-mode reservation is lock-free; see Note [CUDA Graph-safe RNG states]
+  PhiloxCudaState rng_engine_inputs =
+      gen->reserve_philox_cuda_state(counter_offset);
 
   const scalar_t* input_data = input.const_data_ptr<scalar_t>();
   scalar_t* noise_data = noise.mutable_data_ptr<scalar_t>();
@@ -720,8 +720,22 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
       dim3 grid(outer_size);
       AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::Half, at::ScalarType::BFloat16, input.scalar_type(), "host_softmax", [&] {
         using accscalar_t = acc_type<scalar_t, true>;
+        /* The warp-level kernel owns each row with a single warp, which is
+         * the right call when there are enough rows to fill the machine but
+         * leaves most SMs idle for decoder-style calls (a handful of rows,
+         * e.g. batched generation with one attention row per sequence) while
+         * that warp serially iterates over dim_size / warp_size chunks. When
+         * there are too few rows to occupy the SMs and rows are wide enough
+         * to share, the block-per-row kernel below has lower latency, so
+         * keep the warp kernel for the throughput case only.
+         */
+        const bool use_warp_kernel =
+            dim_size <= 1024 && dim_size * sizeof(scalar_t) <= 4096 &&
+            !(outer_size <
+                  at::cuda::getCurrentDeviceProperties()->multiProcessorCount &&
+              dim_size > 4 * at::cuda::warp_size());
         if (!half_to_float) {
-          if (dim_size <= 1024 && dim_size*sizeof(scalar_t) <= 4096) {
+          if (use_warp_kernel) {
             auto output_ptr = output.mutable_data_ptr<scalar_t>();
             auto input_ptr = input.const_data_ptr<scalar_t>();
             int64_t remaining = outer_size;
@@ -742,7 +756,7 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
             C10_CUDA_KERNEL_LAUNCH_CHECK();
           }
         } else {
-          if (dim_size <= 1024 && dim_size*sizeof(scalar_t) <= 4096) {
+          if (use_warp_kernel) {
             auto output_ptr = output.mutable_data_ptr<accscalar_t>();
             auto input_ptr = input.const_data_ptr<scalar_t>();
             int64_t remaining = outer_size;
@@ -10,7 +10,9 @@
 #include <ATen/native/SpectralOpsUtils.h>
 #include <ATen/native/cuda/CuFFTUtils.h>
 #include <ATen/native/cuda/CuFFTPlanCache.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -176,6 +178,22 @@ int64_t cufft_get_plan_cache_size_impl(int64_t device_index) {
   return cufft_get_plan_cache(device_index).size();
 }
 
+int64_t cufft_get_plan_cache_hits_impl(int64_t device_index) {
+  TORCH_CHECK(0 <= device_index && device_index < at::detail::getCUDAHooks().getNumGPUs(),
+    "cufft_get_plan_cache_hits: expected 0 <= device_index < ",
+    at::detail::getCUDAHooks().getNumGPUs(), "], but got device_index=",
+    device_index);
+  return cufft_get_plan_cache(device_index).hits();
+}
+
+int64_t cufft_get_plan_cache_misses_impl(int64_t device_index) {
+  TORCH_CHECK(0 <= device_index && device_index < at::detail::getCUDAHooks().getNumGPUs(),
+    "cufft_get_plan_cache_misses: expected 0 <= device_index < ",
+    at::detail::getCUDAHooks().getNumGPUs(), "], but got device_index=",
+    device_index);
+  return cufft_get_plan_cache(device_index).misses();
+}
+
 void cufft_clear_plan_cache_impl(int64_t device_index) {
   TORCH_CHECK(0 <= device_index && device_index < at::detail::getCUDAHooks().getNumGPUs(),
     "cufft_clear_plan_cache: expected 0 <= device_index < ",
@@ -206,6 +224,72 @@ bool has_large_prime_factor(int64_t n) {
   return n != 1;
 }
 
+// Whether TORCH_CUFFT_BUCKET_BATCH_SIZES=1 is set. When enabled, _exec_fft
+// decomposes batches into power-of-two chunks so that workloads with varying
+// batch counts hit at most log2(batch) distinct plans per signal shape
+// instead of one per exact batch count, at the cost of extra kernel launches
+// for non-power-of-two batches.
+static bool cufft_bucket_batch_sizes() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_CUFFT_BUCKET_BATCH_SIZES") == true;
+  return enabled;
+}
+
+// Plan (from the cache when possible) and execute a single batched transform.
+// `input` must already be collapsed to (batch, signal...) layout and `out`
+// must be a contiguously-strided buffer with a matching batch size;
+// signal_size[0] is the batch count.
+static void _exec_fft_plan(const Tensor& out, Tensor input,
+                           IntArrayRef signal_size, CuFFTTransformType fft_type,
+                           ScalarType value_type, bool forward) {
+  CuFFTParams Params(input.strides(), out.strides(), signal_size, fft_type, value_type);
+  CuFFTParamsLRUCache& plan_cache = cufft_get_plan_cache(input.device().index());
+  std::unique_lock<std::mutex> guard(plan_cache.mutex, std::defer_lock);
+  c10::optional<CuFFTConfig> uncached_plan;
+  const CuFFTConfig * config = nullptr;
+
+  // Workaround for gh-63152, gh-58724
+  // Bluestein plans in CUDA 11.1 (cufft 10.3) cannot be re-used
+  // Bluestein's algorithm is only used when a size has large prime factors,
+  // sizes with only small prime factors can still be cached
+  bool use_caching = true;
+#ifdef CUFFT_VERSION
+  if (10300 <= CUFFT_VERSION && CUFFT_VERSION < 10400) {
+    // Only cache plans for transforms with small prime factors
+    use_caching = std::none_of(
+        signal_size.begin() + 1, signal_size.end(), [](int64_t dim_size) {
+      return has_large_prime_factor(dim_size);
+    });
+  }
+#endif
+
+  if (use_caching && plan_cache.max_size() > 0) {
+    guard.lock();
+    if (plan_cache.max_size() > 0) {  // check again after acquiring the lock
+      config = &plan_cache.lookup(Params);
+    }
+  }
+
+  if (config == nullptr) {
+    uncached_plan.emplace(Params);
+    config = &uncached_plan.value();
+  }
+
+  auto & plan = config->plan();
+
+  if (config->should_clone_input()) {
+    input = input.clone(MemoryFormat::Contiguous);
+  }
+
+  // prepare cufft for execution
+  CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
+  auto workspace = at::empty({ config->workspace_size() }, at::device(at::kCUDA).dtype(at::kByte));
+  CUFFT_CHECK(cufftSetWorkArea(plan, workspace.mutable_data_ptr()));
+
+  // execute transform plan
+  exec_cufft_plan(*config, input.data_ptr(), out.data_ptr(), forward);
+}
+
 // Execute a general fft operation (can be c2c, onesided r2c or onesided c2r)
 static const Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
                          IntArrayRef dim, bool forward) {
@@ -259,53 +343,29 @@ static const Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_
   // Create the transform plan (either from cache or locally)
   const auto value_type = c10::toRealValueType(input.scalar_type());
   auto fft_type = GetCuFFTTransformType(input.is_complex(), out.is_complex());
-  CuFFTParams Params(input.strides(), out.strides(), signal_size, fft_type, value_type);
-  CuFFTParamsLRUCache& plan_cache = cufft_get_plan_cache(input.device().index());
-  std::unique_lock<std::mutex> guard(plan_cache.mutex, std::defer_lock);
-  c10::optional<CuFFTConfig> uncached_plan;
-  const CuFFTConfig * config = nullptr;
-
-  // Workaround for gh-63152, gh-58724
-  // Bluestein plans in CUDA 11.1 (cufft 10.3) cannot be re-used
-  // Bluestein's algorithm is only used when a size has large prime factors,
-  // sizes with only small prime factors can still be cached
-  bool use_caching = true;
-#ifdef CUFFT_VERSION
-  if (10300 <= CUFFT_VERSION && CUFFT_VERSION < 10400) {
-    // Only cache plans for transforms with small prime factors
-    use_caching = std::none_of(
-        signal_size.begin() + 1, signal_size.end(), [](int64_t dim_size) {
-      return has_large_prime_factor(dim_size);
-    });
-  }
-#endif
 
-  if (use_caching && plan_cache.max_size() > 0) {
-    guard.lock();
-    if (plan_cache.max_size() > 0) {  // check again after acquiring the lock
-      config = &plan_cache.lookup(Params);
+  if (cufft_bucket_batch_sizes() && batch_size > 1 &&
+      !is_pow_of_two(batch_size)) {
+    // Size-class bucketing: run the batch as a sequence of power-of-two
+    // chunks, largest first. Every chunk is a narrowed slice of the same
+    // buffers, so it shares the layout (and hence the cuFFT embedding) its
+    // chunk-sized plan was built with, and the results are exact.
+    int64_t start = 0;
+    int64_t remaining = batch_size;
+    DimVector chunk_signal_size(signal_size.begin(), signal_size.end());
+    while (remaining > 0) {
+      const int64_t chunk = int64_t(1)
+          << c10::llvm::Log2_64(static_cast<uint64_t>(remaining));
+      chunk_signal_size[0] = chunk;
+      _exec_fft_plan(out.narrow(0, start, chunk), input.narrow(0, start, chunk),
+                     chunk_signal_size, fft_type, value_type, forward);
+      start += chunk;
+      remaining -= chunk;
     }
+  } else {
+    _exec_fft_plan(out, input, signal_size, fft_type, value_type, forward);
   }
 
-  if (config == nullptr) {
-    uncached_plan.emplace(Params);
-    config = &uncached_plan.value();
-  }
-
-  auto & plan = config->plan();
-
-  if (config->should_clone_input()) {
-    input = input.clone(MemoryFormat::Contiguous);
-  }
-
-  // prepare cufft for execution
-  CUFFT_CHECK(cufftSetStream(plan, at::cuda::getCurrentCUDAStream()));
-  auto workspace = at::empty({ config->workspace_size() }, at::device(at::kCUDA).dtype(at::kByte));
-  CUFFT_CHECK(cufftSetWorkArea(plan, workspace.mutable_data_ptr()));
-
-  // execute transform plan
-  exec_cufft_plan(*config, input.data_ptr(), out.data_ptr(), forward);
-
   // Inplace reshaping to original batch shape and inverting the dimension permutation
   DimVector out_strides(ndim);
   int64_t batch_numel = 1;
@@ -213,6 +213,233 @@ void launch(
 }
 } // namespace sbtopk
 
+#if !defined(USE_ROCM)
+namespace wstopk { // warp_select_topk, for small k (beam search style workloads)
+
+// One warp scans one slice in a single pass, keeping the top candidates in
+// registers. Each lane owns kSlots (key, index) pairs in a lane-strided
+// arrangement: global rank r lives in slot r / warpSize of lane r % warpSize.
+// The first QueueSlots slots per lane form a warp-wide sorted queue of the
+// best QueueSlots * warpSize elements seen so far; the remaining slots buffer
+// candidates that beat the current k-th best. When any lane's buffer fills
+// up, the whole arrangement is sorted with a warp-level bitonic network
+// (register shuffles only) and the buffer is pruned. Keys are the radix
+// conversions from TopKTypeConfig, bit-flipped for `largest == false` so the
+// network always sorts descending; ties prefer the smaller input index, and
+// empty slots carry an invalid index so they lose against any real element.
+
+constexpr int WARP_SELECT_WARP_SIZE = 32;
+constexpr int WARP_SELECT_SLOTS = 4; // per lane; queue + buffer, power of two
+constexpr int WARP_SELECT_MAX_K =
+    WARP_SELECT_SLOTS / 2 * WARP_SELECT_WARP_SIZE; // half the slots hold the queue
+constexpr int WARP_SELECT_WARPS_PER_BLOCK = 8;
+
+// Returns true if (ka, ia) ranks strictly before (kb, ib).
+template <typename Bitwise, typename IndexType>
+__device__ __forceinline__ bool rankedBefore(
+    Bitwise ka, IndexType ia, Bitwise kb, IndexType ib) {
+  return ka > kb || (ka == kb && ia < ib);
+}
+
+// Bitonic sort of the full lane-strided arrangement, best element first.
+template <typename Bitwise, typename IndexType, int Slots>
+__device__ __forceinline__ void warpBitonicSort(
+    Bitwise (&key)[Slots], IndexType (&idx)[Slots], int lane) {
+  constexpr int N = Slots * WARP_SELECT_WARP_SIZE;
+  for (int size = 2; size <= N; size *= 2) {
+    for (int stride = size / 2; stride > 0; stride /= 2) {
+      if (stride >= WARP_SELECT_WARP_SIZE) {
+        // Partner lives in another slot of the same lane.
+        const int slot_stride = stride / WARP_SELECT_WARP_SIZE;
+        #pragma unroll
+        for (int s = 0; s < Slots; ++s) {
+          const int partner = s ^ slot_stride;
+          if (partner > s) {
+            const int rank = s * WARP_SELECT_WARP_SIZE + lane;
+            const bool best_first = (rank & size) == 0;
+            if (rankedBefore(key[partner], idx[partner], key[s], idx[s]) ==
+                best_first) {
+              Bitwise tk = key[s]; key[s] = key[partner]; key[partner] = tk;
+              IndexType ti = idx[s]; idx[s] = idx[partner]; idx[partner] = ti;
+            }
+          }
+        }
+      } else {
+        // Partner lives in the same slot of lane ^ stride.
+        #pragma unroll
+        for (int s = 0; s < Slots; ++s) {
+          const Bitwise other_key = WARP_SHFL_XOR(key[s], stride);
+          const IndexType other_idx = WARP_SHFL_XOR(idx[s], stride);
+          const int low_rank = s * WARP_SELECT_WARP_SIZE + (lane & ~stride);
+          const bool best_first = (low_rank & size) == 0;
+          const bool is_low = (lane & stride) == 0;
+          // The low-rank side keeps the better element iff best_first.
+          if (rankedBefore(other_key, other_idx, key[s], idx[s]) ==
+              (is_low == best_first)) {
+            key[s] = other_key;
+            idx[s] = other_idx;
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename T, typename IndexType, int Dim, int QueueSlots>
+C10_LAUNCH_BOUNDS_1(WARP_SELECT_WARP_SIZE * WARP_SELECT_WARPS_PER_BLOCK)
+__global__ void warpSelectTopK(at::cuda::detail::TensorInfo<T, IndexType> input,
+                               IndexType inputSliceSize,
+                               IndexType outputSliceSize, // aka `k`
+                               bool largest,
+
+                               IndexType numInputSlices,
+                               IndexType inputWithinSliceStride,
+
+                               at::cuda::detail::TensorInfo<T, IndexType> topK,
+                               IndexType topKWithinSliceStride,
+
+                               at::cuda::detail::TensorInfo<int64_t, IndexType> indices,
+                               IndexType indicesWithinSliceStride) {
+  using Bitwise = typename TopKTypeConfig<T>::RadixType;
+  constexpr int kSlots = WARP_SELECT_SLOTS;
+  constexpr int kBufferSlots = kSlots - QueueSlots;
+  constexpr IndexType kInvalidIdx = std::numeric_limits<IndexType>::max();
+
+  IndexType slice = getLinearBlockId<IndexType>() * blockDim.y + threadIdx.y;
+  if (slice >= numInputSlices) {
+    return;
+  }
+  const int lane = threadIdx.x;
+
+  IndexType sliceStartIndex =
+    at::cuda::detail::IndexToOffset<T, IndexType, Dim>::get(slice, input);
+  IndexType topKSliceStartIndex =
+    at::cuda::detail::IndexToOffset<T, IndexType, Dim>::get(slice, topK);
+  IndexType indicesSliceStartIndex =
+    at::cuda::detail::IndexToOffset<int64_t, IndexType, Dim>::get(slice, indices);
+
+  T* inputSliceStart = &input.data[sliceStartIndex];
+  T* topKSliceStart = &topK.data[topKSliceStartIndex];
+  int64_t* indicesSliceStart = &indices.data[indicesSliceStartIndex];
+
+  Bitwise key[kSlots];
+  IndexType idx[kSlots];
+  #pragma unroll
+  for (int s = 0; s < kSlots; ++s) {
+    key[s] = 0;
+    idx[s] = kInvalidIdx;
+  }
+
+  // Current k-th best element; invalid until the queue holds k candidates.
+  const int kthSlot = (outputSliceSize - 1) / WARP_SELECT_WARP_SIZE;
+  const int kthLane = (outputSliceSize - 1) % WARP_SELECT_WARP_SIZE;
+  Bitwise kthKey = 0;
+  IndexType kthIdx = kInvalidIdx;
+
+  int bufCount = 0;
+  const IndexType numIterations =
+      round_up(inputSliceSize, (IndexType)WARP_SELECT_WARP_SIZE);
+  for (IndexType i = lane; i < numIterations; i += WARP_SELECT_WARP_SIZE) {
+    bool hasCandidate = false;
+    Bitwise candidate = 0;
+    if (i < inputSliceSize) {
+      Bitwise converted = TopKTypeConfig<T>::convert(
+          doLdg(&inputSliceStart[i * inputWithinSliceStride]));
+      candidate = largest ? converted : ~converted;
+      // Streaming indices only grow, so anything tying the current k-th
+      // best would rank after it and can be dropped immediately.
+      hasCandidate = (kthIdx == kInvalidIdx) || (candidate > kthKey);
+    }
+    if (hasCandidate) {
+      #pragma unroll
+      for (int s = QueueSlots; s < kSlots; ++s) {
+        if (s == QueueSlots + bufCount) {
+          key[s] = candidate;
+          idx[s] = i;
+        }
+      }
+      ++bufCount;
+    }
+    if (__any_sync(0xffffffff, bufCount == kBufferSlots)) {
+      warpBitonicSort<Bitwise, IndexType, kSlots>(key, idx, lane);
+      // Everything ranked below the queue is pruned; survivors between k
+      // and the queue end stay as candidates for later displacement.
+      #pragma unroll
+      for (int s = QueueSlots; s < kSlots; ++s) {
+        key[s] = 0;
+        idx[s] = kInvalidIdx;
+      }
+      bufCount = 0;
+      Bitwise myKthKey = 0;
+      IndexType myKthIdx = kInvalidIdx;
+      #pragma unroll
+      for (int s = 0; s < QueueSlots; ++s) {
+        if (s == kthSlot) {
+          myKthKey = key[s];
+          myKthIdx = idx[s];
+        }
+      }
+      kthKey = WARP_SHFL(myKthKey, kthLane);
+      kthIdx = WARP_SHFL(myKthIdx, kthLane);
+    }
+  }
+
+  warpBitonicSort<Bitwise, IndexType, kSlots>(key, idx, lane);
+
+  // Ranks [0, k) hold the result in sorted order.
+  #pragma unroll
+  for (int s = 0; s < QueueSlots; ++s) {
+    const IndexType rank = s * WARP_SELECT_WARP_SIZE + lane;
+    if (rank < outputSliceSize) {
+      topKSliceStart[rank * topKWithinSliceStride] =
+          TopKTypeConfig<T>::deconvert(largest ? key[s] : ~key[s]);
+      indicesSliceStart[rank * indicesWithinSliceStride] = idx[s];
+    }
+  }
+}
+
+template <typename T, typename IndexType, int Dim>
+void launch(
+    at::cuda::detail::TensorInfo<T, IndexType> input,
+    IndexType inputSliceSize,
+    IndexType outputSliceSize, // aka `k`
+    bool largest,
+
+    IndexType numInputSlices,
+    IndexType inputWithinSliceStride,
+
+    at::cuda::detail::TensorInfo<T, IndexType> topK,
+    IndexType topKWithinSliceStride,
+
+    at::cuda::detail::TensorInfo<int64_t, IndexType> indices,
+    IndexType indicesWithinSliceStride) {
+
+    dim3 grid;
+    TORCH_INTERNAL_ASSERT(
+        getGridFromTiles(
+            at::ceil_div((int64_t)numInputSlices, (int64_t)WARP_SELECT_WARPS_PER_BLOCK), grid),
+        "Too many slices for topk");
+    dim3 block(WARP_SELECT_WARP_SIZE, WARP_SELECT_WARPS_PER_BLOCK);
+    auto stream = c10::cuda::getCurrentCUDAStream();
+    if (outputSliceSize <= WARP_SELECT_WARP_SIZE) {
+      warpSelectTopK<T, IndexType, Dim, /* QueueSlots= */1><<<grid, block, 0, stream>>>(
+          input, inputSliceSize, outputSliceSize, largest,
+          numInputSlices, inputWithinSliceStride,
+          topK, topKWithinSliceStride,
+          indices, indicesWithinSliceStride);
+    } else {
+      warpSelectTopK<T, IndexType, Dim, /* QueueSlots= */2><<<grid, block, 0, stream>>>(
+          input, inputSliceSize, outputSliceSize, largest,
+          numInputSlices, inputWithinSliceStride,
+          topK, topKWithinSliceStride,
+          indices, indicesWithinSliceStride);
+    }
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+}
+
+} // namespace wstopk
+#endif
+
 namespace mbtopk { // multi_block_topk
 
 // Assumptions:
@@ -770,6 +997,22 @@ void launch(
 
 } // namespace mbtopk
 
+bool should_use_warp_select(int64_t num_slices, int64_t slice_size, int64_t k) {
+#if defined(USE_ROCM)
+  // The warp-select kernel assumes 32-wide warps and __*_sync intrinsics.
+  return false;
+#else
+  // For small k a single warp per slice beats radix select: one pass over
+  // the input with the candidate queue held in registers, versus multiple
+  // counting passes. Typical winner is beam-search decoding, k = 4..64 over
+  // vocab-sized slices. Below ~1k elements per slice the radix single-block
+  // kernel is already cheap enough.
+  return k <= wstopk::WARP_SELECT_MAX_K && slice_size >= 1024 &&
+      num_slices <= std::numeric_limits<uint32_t>::max() &&
+      slice_size <= std::numeric_limits<uint32_t>::max();
+#endif
+}
+
 bool should_use_multiblock(int64_t num_slices, int64_t slice_size) {
   if (num_slices > std::numeric_limits<uint32_t>::max() ||
       slice_size > std::numeric_limits<uint32_t>::max()) return false;
@@ -816,12 +1059,23 @@ void launch_gather_topk_kernel(
       indicesInfo,                                                      \
       static_cast<INDEX_T>(indicesInfo.strides[collapseIndicesDim]));
 
+#if !defined(USE_ROCM)
+#define RUN_MB(INDEX_T, DIM)                                            \
+  if (should_use_warp_select(numInputSlices, sliceSize, k)) {           \
+    RUN_K(INDEX_T, DIM, wstopk::launch);                                \
+  } else if (should_use_multiblock(numInputSlices, sliceSize)) {        \
+    RUN_K(INDEX_T, DIM, mbtopk::launch);                                \
+  } else {                                                              \
+    RUN_K(INDEX_T, DIM, sbtopk::launch);                                \
+  }
+#else
 #define RUN_MB(INDEX_T, DIM)                                            \
   if (should_use_multiblock(numInputSlices, sliceSize)) {               \
     RUN_K(INDEX_T, DIM, mbtopk::launch);                                \
   } else {                                                              \
     RUN_K(INDEX_T, DIM, sbtopk::launch);                                \
   }
+#endif
 
 #define RUN_DIM(INDEX_T)                        \
   if (allDims == 1) {                           \
@@ -79,25 +79,27 @@ __global__ void flip_cuda_kernel(
   out_tensor[linear_index] = in_tensor[dst_offset];
 }
 
-template <typename scalar_t>
+// index_t is uint32_t when the tensor fits in 32-bit index math (see the
+// launch below); the narrower div/mod noticeably helps this bandwidth-bound
+// kernel. Unsigned so the first-out-of-range linear index, which can exceed
+// the signed maximum in the last block, stays well defined.
+template <typename scalar_t, typename index_t>
 C10_LAUNCH_BOUNDS_1(cuda::getApplyBlockSize())
 __global__ void roll_cuda_kernel(
     const scalar_t* in_tensor,
     scalar_t* out_tensor,
-    int64_t N,
-    int64_t roll_dim,
-    int64_t start,
-    int64_t size,
-    int64_t stride,
-    int64_t total_dims) {
-  int64_t linear_index = blockIdx.x * blockDim.x + threadIdx.x;
+    index_t N,
+    index_t start,
+    index_t size,
+    index_t stride) {
+  index_t linear_index = blockIdx.x * blockDim.x + threadIdx.x;
   if (linear_index >= N) {
     return;
   }
   // roll dim idx is the index of linear_index along the rolling dimension.
-  int64_t roll_dim_idx = linear_index % (stride * size) / stride;
+  index_t roll_dim_idx = linear_index % (stride * size) / stride;
   // index into the source data to find appropriate value.
-  int64_t source_idx = 0;
+  index_t source_idx = 0;
   if( roll_dim_idx >= (size - start) ) {
     source_idx = linear_index - ((size - start) * stride);
   } else {
@@ -132,19 +134,22 @@ Tensor roll_cuda(const Tensor& self, IntArrayRef shifts, IntArrayRef dims) {
   dim3 dim_grid;
   TORCH_CHECK(cuda::getApplyGrid(N, dim_grid, in_tensor.get_device()), "unable to get dim grid");
 
-  auto total_dims = in_tensor.dim();
-
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(
       at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
       at::ScalarType::ComplexHalf,
       in_tensor.scalar_type(), "roll_cuda",
       [&] {
-        roll_cuda_kernel<<<dim_grid, dim_block, 0, at::cuda::getCurrentCUDAStream()>>>(
-          in_tensor.const_data_ptr<scalar_t>(), out_tensor.mutable_data_ptr<scalar_t>(), N,
-          dim, start,
-          size,
-          in_tensor.stride(dim),
-          total_dims);
+        if (cuda::detail::canUse32BitIndexMath(in_tensor)) {
+          roll_cuda_kernel<scalar_t, uint32_t>
+            <<<dim_grid, dim_block, 0, at::cuda::getCurrentCUDAStream()>>>(
+              in_tensor.const_data_ptr<scalar_t>(), out_tensor.mutable_data_ptr<scalar_t>(),
+              N, start, size, in_tensor.stride(dim));
+        } else {
+          roll_cuda_kernel<scalar_t, uint64_t>
+            <<<dim_grid, dim_block, 0, at::cuda::getCurrentCUDAStream()>>>(
+              in_tensor.const_data_ptr<scalar_t>(), out_tensor.mutable_data_ptr<scalar_t>(),
+              N, start, size, in_tensor.stride(dim));
+        }
         C10_CUDA_KERNEL_LAUNCH_CHECK();
       });
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <ATen/core/Tensor.h>
+#include <ATen/native/FusedAdam.h>
 #include <ATen/native/cuda/MultiTensorApply.cuh>
 #include <ATen/native/cuda/ForeachFunctors.cuh>
 #include <ATen/native/cuda/Pow.cuh>
@@ -7,11 +8,6 @@
 
 namespace at { namespace native {
 
-enum class ADAM_MODE: uint8_t {
-  ORIGINAL = 0,
-  ADAMW = 1
-};
-
 namespace {
 
 constexpr uint8_t kParamIdx = 0;
@@ -166,6 +162,98 @@ struct FusedAdamMathFunctor {
         }
     }
 };
+
+// Mixed-precision Adam. `params` and `grads` hold the low precision
+// (fp16/bf16) model copies while the moments and the master params in the
+// last list position are fp32. The fp32 master copy is the source of truth
+// for the update math; the low precision param is refreshed from it in the
+// same pass, so the optimizer reads and writes each buffer exactly once.
+// Since the lists mix element sizes the kILP register-blocking path above
+// doesn't apply; a plain strided loop is used instead.
+template <typename scalar_type, int depth>
+struct FusedAdamMasterWeightsMathFunctor {
+    static_assert(depth == 5 || depth == 6, "depth of 5 for Adam, depth of 6 for Adam with AMSGrad.");
+    using opmath_t = at::opmath_type<scalar_type>;
+    C10_DEVICE __forceinline__ void operator()(
+            int chunk_size,
+            FusedOptimizerTensorListMetadata<depth>& tl,
+            const double lr,
+            const double beta1,
+            const double beta2,
+            const double weight_decay,
+            const double eps,
+            const bool maximize,
+            const bool amsgrad,
+            const float* grad_scale_ptr,
+            const float* found_inf_ptr,
+            const ADAM_MODE adam_mode
+  ) {
+        int tensor_loc = tl.block_to_tensor[blockIdx.x];
+        int chunk_idx = tl.block_to_chunk[blockIdx.x];
+        int n = tl.numel_for_tensor[tensor_loc] - chunk_idx * chunk_size;
+        if (n > chunk_size) {
+            n = chunk_size;
+        }
+
+        if (found_inf_ptr && *found_inf_ptr == 1) {
+            return;
+        }
+        auto *step_count = reinterpret_cast<const float*>(tl.state_steps_addresses[tensor_loc]);
+        const auto offset = static_cast<int64_t>(chunk_idx) * chunk_size;
+
+        auto* param = (scalar_type*)tl.addresses[kParamIdx][tensor_loc] + offset;
+        auto* grad = (scalar_type*)tl.addresses[kGradIdx][tensor_loc] + offset;
+        auto* exp_avg = (opmath_t*)tl.addresses[kExpAvgIdx][tensor_loc] + offset;
+        auto* exp_avg_sq = (opmath_t*)tl.addresses[kExpAvgSqIdx][tensor_loc] + offset;
+        opmath_t* max_exp_avg_sq = nullptr;
+        if (amsgrad) {
+            max_exp_avg_sq = (opmath_t*)tl.addresses[kMaxExpAvgSqIdx][tensor_loc] + offset;
+        }
+        auto* master_param = (opmath_t*)tl.addresses[depth - 1][tensor_loc] + offset;
+
+        const opmath_t bias_correction1 = 1 - at::native::pow_(beta1, *step_count);
+        const opmath_t step_size = lr / bias_correction1;
+        const opmath_t bias_correction2 = 1 - at::native::pow_(beta2, *step_count);
+        const opmath_t bias_correction2_sqrt = std::sqrt(bias_correction2);
+
+        for (int i = threadIdx.x; i < n; i += blockDim.x) {
+            opmath_t param_ = master_param[i];
+            opmath_t grad_ = static_cast<opmath_t>(grad[i]);
+            if (grad_scale_ptr) {
+                grad_ /= (static_cast<double>(*grad_scale_ptr));
+                grad[i] = static_cast<scalar_type>(grad_);
+            }
+            if (maximize) {
+                grad_ = -grad_;
+            }
+            if (weight_decay != 0) {
+                switch (adam_mode) {
+                  case ADAM_MODE::ORIGINAL:
+                    grad_ += param_ * weight_decay;
+                    break;
+                  case ADAM_MODE::ADAMW:
+                    param_ -= lr * weight_decay * param_;
+                    break;
+                }
+            }
+            const opmath_t exp_avg_ = exp_avg[i] * beta1 + grad_ * (1 - beta1);
+            const opmath_t exp_avg_sq_ = exp_avg_sq[i] * beta2 + grad_ * grad_ * (1 - beta2);
+            exp_avg[i] = exp_avg_;
+            exp_avg_sq[i] = exp_avg_sq_;
+            opmath_t denom;
+            if (amsgrad) {
+                const opmath_t max_exp_avg_sq_ = std::max(max_exp_avg_sq[i], exp_avg_sq_);
+                max_exp_avg_sq[i] = max_exp_avg_sq_;
+                denom = (std::sqrt(max_exp_avg_sq_) / bias_correction2_sqrt) + eps;
+            } else {
+                denom = (std::sqrt(exp_avg_sq_) / bias_correction2_sqrt) + eps;
+            }
+            param_ -= step_size * exp_avg_ / denom;
+            master_param[i] = param_;
+            param[i] = static_cast<scalar_type>(param_);
+        }
+    }
+};
 } // namespace
 
 }} // namespace at::native
@@ -17,8 +17,11 @@
 #include <limits>
 #include <vector>
 #include <ATen/Config.h>
+#include <ATen/Context.h>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/cuda/Exceptions.h>
+#include <ATen/cuda/WorkspacePool.h>
 #include <ATen/native/cudnn/ConvShared.h>
 
 #include <ATen/cudnn/Types.h>
@@ -28,6 +31,10 @@
 #include <ATen/TensorUtils.h>
 #include <c10/util/irange.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <iterator>
 #include <sstream>
@@ -104,6 +111,22 @@ std::ostream& operator<<(std::ostream & out, const ConvolutionArgs& args) {
 //
 // ---------------------------------------------------------------------
 
+// Note [Persistent benchmark cache]
+// When TORCH_CUDNN_BENCHMARK_CACHE_PATH is set, the benchmark caches are
+// loaded from that file before the first algorithm lookup and written back
+// (via a temp file + atomic rename) at process exit, so a fleet of identical
+// processes only pays for cudnnFind once. Both ConvolutionParams and the
+// cudnn*AlgoPerf_t results are PODs, so entries are stored as raw records.
+// The file header records the cuDNN version and a fingerprint of the visible
+// devices; any mismatch (library upgrade, different hardware, struct layout
+// change) invalidates the whole file: it is ignored on load and overwritten
+// on exit. Workspace sizes from loaded entries are re-validated by the
+// existing try/realloc logic in try_all, so a bogus entry degrades to a
+// re-search rather than a failure. The writer caps the file at
+// kBenchmarkCacheMaxEntries per cache to bound its size.
+constexpr uint64_t kBenchmarkCacheMagic = 0x5054434e4e424301ULL;
+constexpr uint64_t kBenchmarkCacheMaxEntries = 10000;
+
 // TODO: Use something less heavy duty than a big honking mutex
 template <typename T>
 struct BenchmarkCache {
@@ -124,12 +147,158 @@ struct BenchmarkCache {
     std::lock_guard<std::mutex> guard(mutex);
     map[params] = results;
   }
+
+  // Raw-record serialization for the persistent cache; see
+  // Note [Persistent benchmark cache].
+  void serialize(std::ostream& out) {
+    std::lock_guard<std::mutex> guard(mutex);
+    const uint64_t entry_size = sizeof(T);
+    const uint64_t count =
+        std::min<uint64_t>(map.size(), kBenchmarkCacheMaxEntries);
+    out.write(reinterpret_cast<const char*>(&entry_size), sizeof(entry_size));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    uint64_t written = 0;
+    for (const auto& kv : map) {
+      if (written == count) {
+        break;
+      }
+      out.write(reinterpret_cast<const char*>(&kv.first), sizeof(ConvolutionParams));
+      out.write(reinterpret_cast<const char*>(&kv.second), sizeof(T));
+      written++;
+    }
+  }
+
+  bool deserialize(std::istream& in) {
+    uint64_t entry_size = 0;
+    uint64_t count = 0;
+    in.read(reinterpret_cast<char*>(&entry_size), sizeof(entry_size));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!in || entry_size != sizeof(T) || count > kBenchmarkCacheMaxEntries) {
+      return false;
+    }
+    std::lock_guard<std::mutex> guard(mutex);
+    for (const auto i : c10::irange(count)) {
+      (void)i;
+      ConvolutionParams params;
+      T result;
+      in.read(reinterpret_cast<char*>(&params), sizeof(ConvolutionParams));
+      in.read(reinterpret_cast<char*>(&result), sizeof(T));
+      if (!in) {
+        return false;
+      }
+      // Results produced in this process win over loaded ones.
+      map.emplace(params, result);
+    }
+    return true;
+  }
 };
 
 BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
 BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos;
 BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos;
 
+std::string benchmark_cache_path() {
+  const char* path = getenv("TORCH_CUDNN_BENCHMARK_CACHE_PATH");
+  return path != nullptr ? std::string(path) : std::string();
+}
+
+// Stashed at load time so the atexit writer does not need to query devices
+// after the CUDA context may already be torn down.
+uint64_t benchmark_cache_fingerprint = 0;
+
+uint64_t compute_device_fingerprint() {
+  // FNV-1a over the visible devices' identity; a different device set gets a
+  // different fingerprint and therefore a fresh cache file.
+  uint64_t h = 14695981039346656037ULL;
+  auto mix = [&h](const void* data, size_t len) {
+    const auto* p = static_cast<const unsigned char*>(data);
+    for (const auto i : c10::irange(len)) {
+      h ^= p[i];
+      h *= 1099511628211ULL;
+    }
+  };
+  const auto num_gpus = at::cuda::device_count();
+  mix(&num_gpus, sizeof(num_gpus));
+  for (const auto i : c10::irange(num_gpus)) {
+    const cudaDeviceProp* prop = at::cuda::getDeviceProperties(i);
+    mix(prop->name, strlen(prop->name));
+    mix(&prop->major, sizeof(prop->major));
+    mix(&prop->minor, sizeof(prop->minor));
+    mix(&prop->multiProcessorCount, sizeof(prop->multiProcessorCount));
+  }
+  return h;
+}
+
+void write_benchmark_cache_header(std::ostream& out) {
+  const uint64_t cudnn_version = cudnnGetVersion();
+  const uint64_t params_size = sizeof(ConvolutionParams);
+  out.write(reinterpret_cast<const char*>(&kBenchmarkCacheMagic), sizeof(kBenchmarkCacheMagic));
+  out.write(reinterpret_cast<const char*>(&cudnn_version), sizeof(cudnn_version));
+  out.write(reinterpret_cast<const char*>(&params_size), sizeof(params_size));
+  out.write(reinterpret_cast<const char*>(&benchmark_cache_fingerprint), sizeof(benchmark_cache_fingerprint));
+}
+
+bool check_benchmark_cache_header(std::istream& in) {
+  uint64_t magic = 0;
+  uint64_t cudnn_version = 0;
+  uint64_t params_size = 0;
+  uint64_t fingerprint = 0;
+  in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  in.read(reinterpret_cast<char*>(&cudnn_version), sizeof(cudnn_version));
+  in.read(reinterpret_cast<char*>(&params_size), sizeof(params_size));
+  in.read(reinterpret_cast<char*>(&fingerprint), sizeof(fingerprint));
+  return in &&
+      magic == kBenchmarkCacheMagic &&
+      cudnn_version == cudnnGetVersion() &&
+      params_size == sizeof(ConvolutionParams) &&
+      fingerprint == benchmark_cache_fingerprint;
+}
+
+void save_benchmark_caches() {
+  const auto path = benchmark_cache_path();
+  if (path.empty()) {
+    return;
+  }
+  // Write to a temp file and rename so concurrent readers never observe a
+  // torn file; with racing writers the last rename wins.
+  const auto tmp_path = path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      return;
+    }
+    write_benchmark_cache_header(out);
+    fwd_algos.serialize(out);
+    bwd_data_algos.serialize(out);
+    bwd_filter_algos.serialize(out);
+    if (!out) {
+      return;
+    }
+  }
+  std::rename(tmp_path.c_str(), path.c_str());
+}
+
+void load_benchmark_caches() {
+  const auto path = benchmark_cache_path();
+  if (path.empty()) {
+    return;
+  }
+  benchmark_cache_fingerprint = compute_device_fingerprint();
+  // Register the writer even when there is nothing to read yet, so the first
+  // process seeds the file for the rest of the fleet.
+  std::atexit(save_benchmark_caches);
+  std::ifstream in(path, std::ios::binary);
+  if (!in || !check_benchmark_cache_header(in)) {
+    // Missing or stale file (different cuDNN build or devices): start empty.
+    return;
+  }
+  fwd_algos.deserialize(in) &&
+      bwd_data_algos.deserialize(in) &&
+      bwd_filter_algos.deserialize(in);
+}
+
+std::once_flag benchmark_cache_load_flag;
+
 // TODO: Stop manually allocating CUDA memory; allocate an ATen byte
 // tensor instead.
 struct Workspace {
@@ -506,6 +675,11 @@ public:
   void try_all(std::function<void (const perf_t &perf)> f) {
     bool only_use_default = args.params.deterministic && !benchmark;
 
+    if (benchmark) {
+      // See Note [Persistent benchmark cache].
+      std::call_once(benchmark_cache_load_flag, load_benchmark_caches);
+    }
+
     auto& cache = search::cache();
     perf_t algoPerf;
     if (!only_use_default && cache.find(args.params, &algoPerf)) {
@@ -515,6 +689,32 @@ public:
       } catch (c10::OutOfMemoryError &e) {
         cudaGetLastError(); // clear CUDA error
       }
+      if (at::globalContext().pinnedKernelSelections()) {
+        // See Note [Pinned kernel selections] in ATen/Context.h. Retry the
+        // cached algorithm after releasing cached blocks instead of falling
+        // through to a re-benchmark, which under memory pressure could land
+        // on (and cache) a different algorithm.
+        c10::cuda::CUDACachingAllocator::emptyCache();
+        try {
+          f(algoPerf);
+          return;
+        } catch (c10::OutOfMemoryError &e) {
+          cudaGetLastError(); // clear CUDA error
+        }
+        // Last resort: run the default algorithm this once without caching
+        // it, so the pinned choice resumes when the pressure subsides.
+        for (auto &defaultPerf : onlyDefaultAlgorithm(args)) {
+          try {
+            f(defaultPerf);
+            return;
+          } catch (c10::OutOfMemoryError &e) {
+            cudaGetLastError(); // clear CUDA error
+          } catch (c10::CuDNNError &e) {
+            cudaGetLastError(); // clear CUDA error
+          }
+        }
+        TORCH_CHECK(false, "Unable to run the pinned cuDNN algorithm (or the default fallback) for this convolution");
+      }
     }
 
     auto perfResults = only_use_default ? onlyDefaultAlgorithm(args) : search::findAlgorithms(args, benchmark);
@@ -533,12 +733,12 @@ public:
   }
 };
 
-inline Tensor allocate_workspace(size_t size, const Tensor &other) {
+inline at::DataPtr allocate_workspace(size_t size) {
   // Sometimes cuDNN returns a workspace size > 2^63, this could makes the allocation of
   // workspace fail with some 64bit indexing error instead of an OOM error. In such case,
   // we manually fail with OOM.
   TORCH_CHECK_WITH(OutOfMemoryError, size < 1_TiB, "Not enough memory for workspace!");
-  return at::empty({static_cast<int64_t>(size)}, other.options().dtype(kByte));
+  return at::cuda::allocateWorkspace(size);
 }
 
 // NOTE [ raw_cudnn_convolution_forward_out ]
@@ -649,7 +849,7 @@ void raw_cudnn_convolution_forward_out_32bit(
   // matter.  (This applies to raw_cudnn_convolution_backward_input as well.)
   AlgoIterator<cudnnConvolutionFwdAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionFwdAlgoPerf_t &fwdAlgPerf){
-      Tensor workspace = allocate_workspace(fwdAlgPerf.memory, input);
+      auto workspace = allocate_workspace(fwdAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -664,7 +864,7 @@ void raw_cudnn_convolution_forward_out_32bit(
           args.handle,
           &one, args.idesc.desc(), input.data_ptr(),
           args.wdesc.desc(), weight.data_ptr(),
-          args.cdesc.desc(), fwdAlgPerf.algo, workspace.data_ptr(), fwdAlgPerf.memory,
+          args.cdesc.desc(), fwdAlgPerf.algo, workspace.get(), fwdAlgPerf.memory,
           &zero, args.odesc.desc(), output.data_ptr()),
         args, "Forward algorithm: ", static_cast<int>(fwdAlgPerf.algo), "\n");
       }
@@ -708,7 +908,7 @@ void raw_cudnn_convolution_backward_input_out_32bit(
 
   AlgoIterator<cudnnConvolutionBwdDataAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionBwdDataAlgoPerf_t &bwdDataAlgPerf){
-      Tensor workspace = allocate_workspace(bwdDataAlgPerf.memory, grad_output);
+      auto workspace = allocate_workspace(bwdDataAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -723,7 +923,7 @@ void raw_cudnn_convolution_backward_input_out_32bit(
           args.handle,
           &one, args.wdesc.desc(), weight.data_ptr(),
           args.odesc.desc(), grad_output.data_ptr(),
-          args.cdesc.desc(), bwdDataAlgPerf.algo, workspace.data_ptr(), bwdDataAlgPerf.memory,
+          args.cdesc.desc(), bwdDataAlgPerf.algo, workspace.get(), bwdDataAlgPerf.memory,
           &zero, args.idesc.desc(), grad_input.data_ptr()),
         args,
         "Additional pointer addresses: \n",
@@ -771,7 +971,7 @@ void raw_cudnn_convolution_backward_weight_out_32bit(
 
   AlgoIterator<cudnnConvolutionBwdFilterAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionBwdFilterAlgoPerf_t &bwdFilterAlgPerf){
-      Tensor workspace = allocate_workspace(bwdFilterAlgPerf.memory, input);
+      auto workspace = allocate_workspace(bwdFilterAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -786,7 +986,7 @@ void raw_cudnn_convolution_backward_weight_out_32bit(
           args.handle,
           &one, args.idesc.desc(), input.data_ptr(),
           args.odesc.desc(), grad_output.data_ptr(),
-          args.cdesc.desc(), bwdFilterAlgPerf.algo, workspace.data_ptr(), bwdFilterAlgPerf.memory,
+          args.cdesc.desc(), bwdFilterAlgPerf.algo, workspace.get(), bwdFilterAlgPerf.memory,
           &zero, args.wdesc.desc(), grad_weight.data_ptr()),
         args,
         "Additional pointer addresses: \n",
@@ -910,7 +1110,7 @@ void raw_cudnn_convolution_add_relu_out_v7(
 
   AlgoIterator<cudnnConvolutionFwdAlgoPerf_t>(args, benchmark)
       .try_all([&](const cudnnConvolutionFwdAlgoPerf_t& fwdAlgPerf) {
-        Tensor workspace = allocate_workspace(fwdAlgPerf.memory, input);
+        auto workspace = allocate_workspace(fwdAlgPerf.memory);
 
         // update convDesc mathType since cudnn 7.4+ now requires both algo +
         // mathType to figure out whether to use Tensor core kernels or not See
@@ -934,7 +1134,7 @@ void raw_cudnn_convolution_add_relu_out_v7(
                 weight.data_ptr(),
                 args.cdesc.desc(),
                 fwdAlgPerf.algo,
-                workspace.data_ptr(),
+                workspace.get(),
                 fwdAlgPerf.memory,
                 &alpha_,
                 zdesc.desc(),
@@ -24,6 +24,7 @@ C10_DIAGNOSTIC_POP()
 #include <ATen/native/ConvUtils.h>
 #include <ATen/native/cudnn/ConvShared.h>
 #include <ATen/native/utils/ParamsHash.h>
+#include <ATen/cuda/WorkspacePool.h>
 #include <ATen/cudnn/Handle.h>
 #include <ATen/TensorUtils.h>
 
@@ -213,7 +214,7 @@ void setCacheKeyFused(CacheKeyFused& key, const Tensor& y, const Tensor& x, cons
 void run_conv_plan(cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const cudnn_frontend::ExecutionPlan& plan) {
   c10::DeviceGuard g(x.options().device());
   auto workspace_size = plan.getWorkspaceSize();
-  auto workspace_ptr = c10::cuda::CUDACachingAllocator::get()->allocate(workspace_size);
+  auto workspace_ptr = at::cuda::allocateWorkspace(workspace_size);
   void *data_ptrs[] = {x.data_ptr(), y.data_ptr(), w.data_ptr()};
   int64_t uids[] = {'x', 'y', 'w'};
   auto variantPack = cudnn_frontend::VariantPackBuilder()
@@ -227,7 +228,7 @@ void run_conv_plan(cudnnHandle_t handle, const Tensor& x, const Tensor& y, const
 void run_conv_plan_fused(cudnnHandle_t handle, const Tensor& x, const Tensor& y, const Tensor& w, const Tensor& z, const Tensor& b, const cudnn_frontend::ExecutionPlan& plan) {
   c10::DeviceGuard g(x.options().device());
   auto workspace_size = plan.getWorkspaceSize();
-  auto workspace_ptr = c10::cuda::CUDACachingAllocator::get()->allocate(workspace_size);
+  auto workspace_ptr = at::cuda::allocateWorkspace(workspace_size);
   void *data_ptrs[] = {x.data_ptr(), y.data_ptr(), w.data_ptr(), z.data_ptr(), b.data_ptr()};
   int64_t uids[] = {'x', 'y', 'w', 'z', 'b'};
   auto variantPack = cudnn_frontend::VariantPackBuilder()
@@ -383,7 +384,7 @@ void generate_and_filter_plans(const cudnnHandle_t handle, cudnn_frontend::Opera
   bool remove_invalid = false;
   while (max_workspace_size) {
     try {
-      workspace_ptr = c10::cuda::CUDACachingAllocator::get()->allocate(max_workspace_size);
+      workspace_ptr = at::cuda::allocateWorkspace(max_workspace_size);
       break;
     } catch (c10::OutOfMemoryError &e) {
       max_workspace_size /= 2;
@@ -72,6 +72,13 @@ void layer_norm_cpu_out(
     int64_t M,
     int64_t N);
 
+// Bitmask helpers for _fused_dropout_add_layer_norm; defined in
+// FusedDropoutAddLayerNorm.cpp. The packed layout is one byte per 8 row
+// elements with each row padded to a whole byte, so mask_bits has shape
+// {M, (N + 7) / 8}.
+Tensor pack_dropout_mask(const Tensor& mask, int64_t M, int64_t N);
+Tensor unpack_dropout_mask(const Tensor& mask_bits, int64_t M, int64_t N);
+
 using forward_fn = void (*)(
     const Tensor& /* X */,
     const Tensor& /* gamma */,
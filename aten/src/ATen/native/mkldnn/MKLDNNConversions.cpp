@@ -6,6 +6,8 @@
 #include <ATen/native/utils/ParamUtils.h>
 #include <torch/library.h>
 
+#include <cstring>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -78,37 +80,18 @@ Tensor dense_to_mkldnn(const Tensor& cpu_tensor, c10::optional<ScalarType> dtype
   return mkldnn_tensor;
 }
 
-// Mkldnn tensor has special non-public format for conv2d weights
-// (dense_to_mkldnn only converts dense tensor to mkldnn tensor with
-// public format). Ideep conv kernel will do implicit reorder if the
-// weight is not already in this optimized format. By the time I'm
-// writing this note, we are seeing ~20% perf cost of doing the
-// on-the-fly reorder.
-Tensor mkldnn_reorder_conv2d_weight(
-    const Tensor& self,
+namespace {
+
+ideep::tensor::desc get_conv2d_expected_weights_desc(
+    const ideep::tensor& w,
     IntArrayRef padding,
     IntArrayRef stride,
     IntArrayRef dilation,
     int64_t groups,
     c10::OptionalArrayRef<int64_t> input_size) {
-  if (self.scalar_type() == ScalarType::BFloat16) {
-    TORCH_CHECK(mkldnn_bf16_device_check(),
-        "mkldnn_reorder_conv2d_weight: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
-  }
   const auto padding_expanded = expand_param_if_needed(padding, "padding", 2);
   const auto stride_expanded = expand_param_if_needed(stride, "stride", 2);
   const auto dilation_expanded = expand_param_if_needed(dilation, "dilation", 2);
-  auto w = itensor_from_mkldnn(self);
-
-  // Legacy mkldnn conv2d jitted module may contain a 5-d weight with an extra
-  // dimension when groups > 1, having dimension [g, o/g, i, h, w] instead of
-  // [o, i, h, w]. Ideally we should reorder the weight back in serialization.
-  // For backward compatibility, we squash the first two dims (g * o/g) back to
-  // its original form.
-  if (w.ndims() == 5) {
-    auto wdims = w.get_dims();
-    w.reshape({wdims[0] * wdims[1], wdims[2], wdims[3], wdims[4]});
-  }
 
   ideep::dims src_dims = ideep::dims();
   bool is_channels_last = false;
@@ -118,7 +101,7 @@ Tensor mkldnn_reorder_conv2d_weight(
     is_channels_last = true;
   }
 
-  auto desc = ideep::convolution_forward::expected_weights_desc(
+  return ideep::convolution_forward::expected_weights_desc(
       w.get_dims(),
       w.get_data_type(),
       stride_expanded,
@@ -132,6 +115,41 @@ Tensor mkldnn_reorder_conv2d_weight(
       src_dims,
       ideep::attr_t(),
       is_channels_last);
+}
+
+} // namespace
+
+// Mkldnn tensor has special non-public format for conv2d weights
+// (dense_to_mkldnn only converts dense tensor to mkldnn tensor with
+// public format). Ideep conv kernel will do implicit reorder if the
+// weight is not already in this optimized format. By the time I'm
+// writing this note, we are seeing ~20% perf cost of doing the
+// on-the-fly reorder.
+Tensor mkldnn_reorder_conv2d_weight(
+    const Tensor& self,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups,
+    c10::OptionalArrayRef<int64_t> input_size) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "mkldnn_reorder_conv2d_weight: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+  auto w = itensor_from_mkldnn(self);
+
+  // Legacy mkldnn conv2d jitted module may contain a 5-d weight with an extra
+  // dimension when groups > 1, having dimension [g, o/g, i, h, w] instead of
+  // [o, i, h, w]. Ideally we should reorder the weight back in serialization.
+  // For backward compatibility, we squash the first two dims (g * o/g) back to
+  // its original form.
+  if (w.ndims() == 5) {
+    auto wdims = w.get_dims();
+    w.reshape({wdims[0] * wdims[1], wdims[2], wdims[3], wdims[4]});
+  }
+
+  auto desc = get_conv2d_expected_weights_desc(
+      w, padding, stride, dilation, groups, input_size);
   ideep::tensor result;
   result.init(desc);
   result.feed_from(w);
@@ -140,6 +158,60 @@ Tensor mkldnn_reorder_conv2d_weight(
                                  self.options().device_opt());
 }
 
+// Serialize the payload of a prepacked (blocked) mkldnn weight as a plain
+// uint8 tensor so it can be stored in a model file. The blocked layout itself
+// is not serialized: it is recomputed at load time from the conv parameters,
+// which is only valid on a runtime whose fingerprint matches the one recorded
+// at save time (see mkldnn_weight_pack_fingerprint).
+Tensor mkldnn_export_weight_pack(const Tensor& self) {
+  TORCH_CHECK(self.is_mkldnn(),
+      "_export_weight_pack expects an mkldnn tensor input");
+  ideep::tensor& w = itensor_from_mkldnn(self);
+  const auto nbytes = w.get_desc().get_size();
+  Tensor blob = at::empty(
+      {static_cast<int64_t>(nbytes)},
+      self.options().layout(c10::kStrided).dtype(ScalarType::Byte));
+  std::memcpy(blob.data_ptr(), w.get_data_handle(), nbytes);
+  return blob;
+}
+
+// Rebuild a prepacked conv2d weight from a blob produced by
+// mkldnn_export_weight_pack. The blob is adopted without a reorder only when
+// the recorded fingerprint matches the current runtime and the recomputed
+// descriptor has the same size; a stale pack (different oneDNN build or ISA)
+// falls back to reordering `self` from scratch.
+Tensor mkldnn_rehydrate_conv2d_weight_pack(
+    const Tensor& self,
+    const Tensor& blob,
+    c10::string_view fingerprint,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups,
+    c10::OptionalArrayRef<int64_t> input_size) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "_rehydrate_conv2d_weight_pack: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+  auto w = itensor_from_mkldnn(self);
+  auto desc = get_conv2d_expected_weights_desc(
+      w, padding, stride, dilation, groups, input_size);
+
+  ideep::tensor result;
+  result.init(desc);
+  if (fingerprint == mkldnn_weight_pack_fingerprint() &&
+      blob.scalar_type() == ScalarType::Byte &&
+      blob.is_contiguous() &&
+      static_cast<size_t>(blob.numel()) == desc.get_size()) {
+    std::memcpy(result.get_data_handle(), blob.data_ptr(), desc.get_size());
+  } else {
+    result.feed_from(w);
+  }
+
+  return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()),
+                                 self.options().device_opt());
+}
+
 Tensor mkldnn_reorder_conv3d_weight(
     const Tensor& self,
     IntArrayRef padding,
@@ -172,6 +244,49 @@ Tensor mkldnn_reorder_conv3d_weight(
   return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
 }
 
+// Conv3d analogue of mkldnn_rehydrate_conv2d_weight_pack.
+Tensor mkldnn_rehydrate_conv3d_weight_pack(
+    const Tensor& self,
+    const Tensor& blob,
+    c10::string_view fingerprint,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "_rehydrate_conv3d_weight_pack: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+  const auto padding_expanded = expand_param_if_needed(padding, "padding", 3);
+  const auto stride_expanded = expand_param_if_needed(stride, "stride", 3);
+  const auto dilation_expanded = expand_param_if_needed(dilation, "dilation", 3);
+  auto w = itensor_from_mkldnn(self);
+
+  auto desc =
+      ideep::convolution_forward::expected_weights_desc(
+          w.get_dims(),
+          w.get_data_type(),
+          stride_expanded,
+          padding_expanded,
+          padding_expanded,
+          dilation_expanded,
+          groups,
+          ideep::algorithm::convolution_direct);
+
+  ideep::tensor result;
+  result.init(desc);
+  if (fingerprint == mkldnn_weight_pack_fingerprint() &&
+      blob.scalar_type() == ScalarType::Byte &&
+      blob.is_contiguous() &&
+      static_cast<size_t>(blob.numel()) == desc.get_size()) {
+    std::memcpy(result.get_data_handle(), blob.data_ptr(), desc.get_size());
+  } else {
+    result.feed_from(w);
+  }
+
+  return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
+}
+
 Tensor mkldnn_reorder_linear_weight(
     const Tensor& self,
     c10::optional<int64_t> batch_size_opt) {
@@ -299,6 +414,15 @@ TORCH_LIBRARY_IMPL(mkldnn, MkldnnCPU, m) {
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn::_reorder_linear_weight"),
       TORCH_FN(mkldnn_reorder_linear_weight));
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_export_weight_pack"),
+      TORCH_FN(mkldnn_export_weight_pack));
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_rehydrate_conv2d_weight_pack"),
+      TORCH_FN(mkldnn_rehydrate_conv2d_weight_pack));
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_rehydrate_conv3d_weight_pack"),
+      TORCH_FN(mkldnn_rehydrate_conv3d_weight_pack));
 }
 
 #else
@@ -25,6 +25,23 @@ bool use_mkldnn_bf16_matmul(
   return false;
 }
 
+void mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result,
+    bool use_gelu) {
+  TORCH_CHECK(false, "mkldnn_matmul_activation: ATen not compiled with MKLDNN support");
+}
+
+bool use_mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result) {
+  return false;
+}
+
 bool mkldnn_bf16_gemm(
     TransposeType transa, TransposeType transb,
     int64_t m, int64_t n, int64_t k,
@@ -262,6 +279,73 @@ bool use_mkldnn_bf16_matmul(
   }
 }
 
+void mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result,
+    bool use_gelu) {
+  TORCH_CHECK(mat1.dim() == 2 && mat2.dim() == 2 && result.dim() == 2,
+      "mkldnn_matmul_activation: expected 2-D mat1, mat2 and result");
+  TORCH_CHECK(bias.dim() == 1 && bias.size(0) == mat2.size(1),
+      "mkldnn_matmul_activation: bias must be 1-D with mat2.size(1) elements");
+  TORCH_CHECK(result.is_contiguous(),
+      "mkldnn_matmul_activation: result must be contiguous");
+
+  auto is_mkldnn_optimized_format = [&](const Tensor& t) {
+    if (t.is_contiguous()) return true;
+    const auto strides = t.strides();
+    return strides[0] == 1 && strides[1] == t.sizes()[0];
+  };
+
+  // Mkldnn only optimized for contiguous or transposed format now
+  Tensor mat1_ = is_mkldnn_optimized_format(mat1) ? mat1 : mat1.contiguous();
+  Tensor mat2_ = is_mkldnn_optimized_format(mat2) ? mat2 : mat2.contiguous();
+
+  const ideep::tensor x = itensor_view_from_dense(mat1_);
+  const ideep::tensor w = itensor_view_from_dense(mat2_);
+  // oneDNN wants the bias carrying an explicit broadcast dimension.
+  const ideep::tensor b(
+      {/*sizes=*/{1, bias.size(0)},
+       get_mkldnn_dtype(bias.scalar_type()),
+       /*strides=*/{bias.size(0), 1}},
+      bias.data_ptr());
+  ideep::tensor y = itensor_view_from_dense(result);
+
+  // Fold bias + activation into the matmul primitive as post-ops instead of
+  // launching separate elementwise kernels afterwards. erf is aten's default
+  // (non-approximate) gelu.
+  auto op_attr = use_gelu
+      ? ideep::attr_t::fuse_gelu(1.0, 0.f, 0.f, dnnl::algorithm::eltwise_gelu_erf)
+      : ideep::attr_t::fuse_relu(1.0, 0.f);
+
+  ideep::matmul_forward::compute(x, w, b, y, 1.0f, 1.0f,
+      ideep::scale_t(), ideep::scale_t(), ideep::scale_t(), op_attr);
+  if (y.get_data_handle() != result.data_ptr()){
+    // ideep will query onednn expect format of output
+    // if given output format is not expected, ideep will re-init an output buffer
+    // under this case, we need copy the re-inited buffer back to given buffer
+    ideep::tensor public_y = itensor_view_from_dense(result);
+    y.reorder_to(public_y);
+  }
+}
+
+bool use_mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result) {
+  return (
+      use_mkldnn_bf16_matmul(mat1, mat2, result) &&
+      mat1.dim() == 2 &&
+      mat2.dim() == 2 &&
+      bias.dim() == 1 &&
+      bias.size(0) == mat2.size(1) &&
+      bias.scalar_type() == mat1.scalar_type() &&
+      bias.is_contiguous() &&
+      result.is_contiguous());
+}
+
 } // namespace native
 } // namespace at
 
@@ -19,6 +19,26 @@ bool use_mkldnn_bf16_matmul(
     const Tensor& mat2,
     const Tensor& result_opt);
 
+// result = activation(gemm(mat1, mat2) + bias), with the bias addition and the
+// activation (GELU when use_gelu, otherwise ReLU) folded into the oneDNN matmul
+// primitive as post-ops. This is the CPU analog of the cublasLt epilogue path
+// used by _addmm_activation on CUDA and saves a separate pass over the output.
+TORCH_API void mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result,
+    bool use_gelu);
+
+// Whether _addmm_activation can take the fused path above. bias must be a
+// contiguous 1-D tensor matching the output columns; scaling is handled by the
+// caller (the fused path only covers alpha == beta == 1).
+bool use_mkldnn_matmul_activation(
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Tensor& bias,
+    const Tensor& result);
+
 // Try running mkldnn optimized gemm, or returns false if naive gemm would be faster
 bool mkldnn_bf16_gemm(
     TransposeType transa, TransposeType transb,
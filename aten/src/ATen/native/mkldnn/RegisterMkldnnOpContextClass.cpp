@@ -57,7 +57,14 @@ TORCH_LIBRARY(mkldnn, m) {
       "mkldnn::_reorder_convolution_transpose_weight(Tensor self, int[2] padding=0, int[2] output_padding=0, int[2] stride=1, int[2] dilation=1, int groups=1, int[]? input_size=None) -> Tensor Y"));
   m.def(TORCH_SELECTIVE_SCHEMA(
       "mkldnn::_reorder_linear_weight(Tensor self, int? batch_size=None) -> Tensor Y"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn::_export_weight_pack(Tensor self) -> Tensor"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn::_rehydrate_conv2d_weight_pack(Tensor self, Tensor blob, str fingerprint, int[2] padding=0, int[2] stride=1, int[2] dilation=1, int groups=1, int[]? input_size=None) -> Tensor Y"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "mkldnn::_rehydrate_conv3d_weight_pack(Tensor self, Tensor blob, str fingerprint, int[3] padding=0, int[3] stride=1, int[3] dilation=1, int groups=1) -> Tensor Y"));
   m.def("_is_mkldnn_bf16_supported", &is_mkldnn_bf16_supported);
+  m.def("_weight_pack_fingerprint", &mkldnn_weight_pack_fingerprint);
 }
 
 TORCH_LIBRARY(mkldnn_prepacked, m) {
@@ -3,6 +3,8 @@
 #include <ATen/native/Pool.h>
 #include <c10/util/irange.h>
 
+#include <sstream>
+
 namespace at { namespace native {
 
 std::vector<int64_t> pool_output_sizes(
@@ -80,6 +82,7 @@ void check_mkldnn_binary_fusion_inputs(
 }
 
 #if AT_MKLDNN_ENABLED()
+#include <dnnl.hpp>
 
 #define ATTR_FUNC(NAME)                              \
   [](torch::List<c10::optional<at::Scalar>> scalars, \
@@ -176,5 +179,15 @@ const std::map<c10::string_view, ideep::algorithm>& fusion_binary_alg_map() {
   return fusion_attr_map;
 };
 
+std::string mkldnn_weight_pack_fingerprint() {
+  // The blocked layout chosen by expected_weights_desc depends on the oneDNN
+  // build and the ISA it dispatches to at runtime, so both key the blob.
+  const dnnl_version_t* ver = dnnl_version();
+  std::ostringstream ss;
+  ss << "dnnl:" << ver->major << "." << ver->minor << "." << ver->patch
+     << ":isa:" << static_cast<int>(dnnl_get_effective_cpu_isa());
+  return ss.str();
+}
+
 #endif // AT_MKLDNN_ENABLED()
 }}
@@ -66,6 +66,11 @@ const std::map<c10::string_view, ideep::algorithm>& fusion_unary_alg_map();
 
 const std::map<c10::string_view, ideep::algorithm>& fusion_binary_alg_map();
 
+// Fingerprint of the oneDNN build and the effective CPU ISA. Serialized
+// prepacked (blocked) weight blobs are only adopted when this matches the
+// runtime that produced them; see mkldnn::_rehydrate_conv2d_weight_pack.
+std::string mkldnn_weight_pack_fingerprint();
+
 #endif // AT_MKLDNN_ENABLED()
 };
 
@@ -122,6 +122,41 @@ Tensor NestedTensor_times_Tensor_plus_Tensor_addmm(
       std::move(result_buffer), std::move(new_sizes));
 }
 
+Tensor NestedTensor_ffn(
+    const Tensor& input,
+    const Tensor& weight1,
+    const Tensor& bias1,
+    const Tensor& weight2,
+    const Tensor& bias2,
+    bool use_gelu) {
+  check_nested_tensor_matrix_constraints(input, weight1, c10::string_view{"Linear"});
+  TORCH_CHECK(
+      weight2.dim() == 2 && weight2.size(1) == weight1.size(0),
+      "_nested_ffn: Expected weight2 to be 2d with weight2.size(1) == weight1.size(0),"
+      " but got weight2 dim: ",
+      weight2.dim(),
+      " and weight1.size(0) = ",
+      weight1.size(0));
+  auto* nt_input = get_nested_tensor_impl(input);
+  const Tensor& input_buffer = nt_input->get_buffer();
+  // Both matmuls run on the packed [total_tokens, dim] view of the buffer, so
+  // variable-length batches never materialize padding. The activation is fused
+  // into the epilogue of the first matmul.
+  Tensor hidden = at::_addmm_activation(
+      bias1,
+      input_buffer.reshape({-1, weight1.size(1)}),
+      weight1.t(),
+      1,
+      1,
+      use_gelu);
+  Tensor result_buffer = at::addmm(bias2, hidden, weight2.t());
+  result_buffer = result_buffer.reshape({-1});
+  Tensor new_sizes = nt_input->get_nested_sizes().clone();
+  // Now the last entry in every row of new_sizes should be weight2.size(0).
+  new_sizes.index_put_({at::indexing::Slice(), -1}, weight2.size(0));
+  return wrap_buffer(std::move(result_buffer), std::move(new_sizes));
+}
+
 Tensor NestedTensor_add_NestedTensor_in_place(
     const Tensor& self,
     const Tensor& other) {
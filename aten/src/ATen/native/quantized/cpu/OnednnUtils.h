@@ -149,6 +149,8 @@ enum PostOps {
   Relu,
   LeakyRelu,
   Tanh,
+  Gelu,
+  AddRelu,
 };
 
 struct PackedLinearWeightsOnednn : public LinearPackedParamsBase {
@@ -191,6 +193,18 @@ struct PackedLinearWeightsOnednn : public LinearPackedParamsBase {
       double output_scale,
       int64_t output_zero_point);
 
+  at::Tensor apply_gelu(
+      at::Tensor input,
+      double output_scale,
+      int64_t output_zero_point,
+      c10::string_view approximate);
+
+  at::Tensor apply_add_relu(
+      at::Tensor input,
+      at::Tensor accum,
+      double output_scale,
+      int64_t output_zero_point);
+
   std::tuple<at::Tensor, c10::optional<at::Tensor>> unpack() override;
 
   c10::optional<at::Tensor> bias() override {
@@ -210,7 +224,8 @@ struct PackedLinearWeightsOnednn : public LinearPackedParamsBase {
       at::Tensor input,
       double output_scale,
       int64_t output_zero_point,
-      torch::List<at::Scalar> post_op_args = torch::List<at::Scalar>());
+      torch::List<at::Scalar> post_op_args = torch::List<at::Scalar>(),
+      c10::optional<at::Tensor> accum = c10::nullopt);
 
   template <bool ReluFused>
   at::Tensor apply_dynamic_impl(at::Tensor input, bool reduce_range=false);
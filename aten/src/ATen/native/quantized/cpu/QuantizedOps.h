@@ -217,6 +217,15 @@ using qnormalize_nhwc_fn = void (*)(
 using qprelu_fn = void (*)(Tensor& /*out*/, const Tensor& /*qx*/,
                            const Tensor& /*qw*/);
 
+// Weight-only int4 GEMM: the weight is packed two nibbles per byte with
+// per-group affine parameters and dequantized on the fly inside the kernel.
+using int4pack_mm_fn = void (*)(
+    Tensor& /*out*/,
+    const Tensor& /*input*/,
+    const Tensor& /*packed_weight*/,
+    int64_t /*group_size*/,
+    const Tensor& /*scales_and_zeros*/);
+
 DECLARE_DISPATCH(qadaptive_avg_pool2d_fn, qadaptive_avg_pool2d_nhwc_stub);
 DECLARE_DISPATCH(qadaptive_avg_pool3d_fn, qadaptive_avg_pool3d_ndhwc_stub);
 DECLARE_DISPATCH(qadd_scalar_fn, qadd_scalar_relu_stub);
@@ -253,6 +262,7 @@ DECLARE_DISPATCH(qupsample_bilinear2d_fn, qupsample_bilinear2d_nhwc_stub);
 DECLARE_DISPATCH(qmean_inner_dim_fn, qmean_inner_dim_stub);
 DECLARE_DISPATCH(qstd_inner_dim_fn, qstd_inner_dim_stub);
 DECLARE_DISPATCH(qprelu_fn, qprelu_stub);
+DECLARE_DISPATCH(int4pack_mm_fn, int4pack_mm_stub);
 
 } // namespace native
 } // namespace at
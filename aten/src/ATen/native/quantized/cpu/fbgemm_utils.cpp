@@ -20,6 +20,12 @@
 #include <c10/util/irange.h>
 #include <torch/custom_class.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -369,6 +375,145 @@ Tensor ConvertConvWeightsToChannelLastTensor<3>(
   }
 }
 
+namespace {
+
+// See Note [Dequantized weight LRU cache] in fbgemm_utils.h.
+class DequantizedWeightCache {
+ public:
+  static DequantizedWeightCache& get() {
+    static DequantizedWeightCache cache;
+    return cache;
+  }
+
+  Tensor lookup(
+      const void* key,
+      int64_t weight_bytes,
+      const std::function<Tensor()>& materialize) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (budget_bytes_ <= 0 || weight_bytes > budget_bytes_) {
+        return Tensor();
+      }
+      auto it = index_.find(key);
+      if (it != index_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->weight;
+      }
+    }
+    // Dequantize outside the lock; concurrent callers may race to
+    // materialize the same weight, in which case the first insert wins.
+    Tensor weight = materialize();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return it->second->weight;
+    }
+    if (budget_bytes_ <= 0 || weight_bytes > budget_bytes_) {
+      // The budget shrank while we were dequantizing; the fp32 copy is
+      // still valid for this one call.
+      return weight;
+    }
+    evictDownTo(budget_bytes_ - weight_bytes);
+    lru_.push_front(Entry{key, weight, weight_bytes});
+    index_[key] = lru_.begin();
+    cached_bytes_ += weight_bytes;
+    return weight;
+  }
+
+  void erase(const void* key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return;
+    }
+    cached_bytes_ -= it->second->bytes;
+    lru_.erase(it->second);
+    index_.erase(it);
+  }
+
+  void setBudget(int64_t budget_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_bytes_ = std::max<int64_t>(budget_bytes, 0);
+    evictDownTo(budget_bytes_);
+  }
+
+  int64_t budget() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_bytes_;
+  }
+
+  int64_t cachedBytes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    index_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  DequantizedWeightCache() {
+    const char* env = std::getenv("TORCH_FP16_DEQUANT_CACHE_BYTES");
+    if (env != nullptr) {
+      budget_bytes_ = std::max<int64_t>(std::strtoll(env, nullptr, 10), 0);
+    }
+  }
+
+  struct Entry {
+    const void* key;
+    Tensor weight;
+    int64_t bytes;
+  };
+
+  void evictDownTo(int64_t target_bytes) {
+    while (cached_bytes_ > target_bytes && !lru_.empty()) {
+      cached_bytes_ -= lru_.back().bytes;
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+  }
+
+  std::mutex mutex_;
+  int64_t budget_bytes_{0};
+  int64_t cached_bytes_{0};
+  // Front of the list is the most recently used entry.
+  std::list<Entry> lru_;
+  std::unordered_map<const void*, std::list<Entry>::iterator> index_;
+};
+
+} // namespace
+
+Tensor DequantizedWeightCacheLookup(
+    const void* key,
+    int64_t weight_bytes,
+    const std::function<Tensor()>& materialize) {
+  return DequantizedWeightCache::get().lookup(key, weight_bytes, materialize);
+}
+
+void DequantizedWeightCacheErase(const void* key) {
+  DequantizedWeightCache::get().erase(key);
+}
+
+void SetDequantizedWeightCacheBudget(int64_t budget_bytes) {
+  DequantizedWeightCache::get().setBudget(budget_bytes);
+}
+
+int64_t GetDequantizedWeightCacheBudget() {
+  return DequantizedWeightCache::get().budget();
+}
+
+int64_t GetDequantizedWeightCacheBytes() {
+  return DequantizedWeightCache::get().cachedBytes();
+}
+
+void ClearDequantizedWeightCache() {
+  DequantizedWeightCache::get().clear();
+}
+
 } // namespace fbgemm_utils
 } // namespace native
 } // namespace at
@@ -6,6 +6,8 @@
 #include <c10/core/QScheme.h>
 #include <c10/util/irange.h>
 
+#include <functional>
+
 #ifdef USE_FBGEMM
 #include <fbgemm/Fbgemm.h>
 #include <fbgemm/FbgemmFP16.h>
@@ -113,6 +115,10 @@ struct TORCH_API PackedLinearWeightFp16 : public LinearPackedParamsBase {
       c10::optional<at::Tensor> bias)
       : w(std::move(w)), bias_(std::move(bias)) {}
 
+  // Drops this layer's entry from the dequantized-weight cache, if any.
+  // See Note [Dequantized weight LRU cache].
+  ~PackedLinearWeightFp16() override;
+
   std::unique_ptr<fbgemm::PackedGemmMatrixFP16> w;
   c10::optional<at::Tensor> bias_;
 
@@ -346,6 +352,40 @@ Tensor ConvertConvWeightsToChannelLastTensor(
     const at::Tensor& src,
     int groups,
     bool transpose);
+
+// Note [Dequantized weight LRU cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The fp16 dynamic linear path converts the packed half-precision weight
+// to fp32 inside the GEMM on every call. For inference setups that stream
+// a large model layer by layer, that conversion dominates the cost of the
+// hot layers. The cache below keeps the fp32 form of the most recently
+// used weights, keyed by the packed-params object, under a global byte
+// budget; cold layers are evicted in LRU order and stay in their compact
+// fp16 form. The cache is disabled by default (budget of zero) and can be
+// enabled either with SetDequantizedWeightCacheBudget or by setting the
+// TORCH_FP16_DEQUANT_CACHE_BYTES environment variable.
+
+// Returns the cached fp32 weight for `key`, materializing and inserting
+// it when absent. Returns an undefined tensor when the cache is disabled
+// or the weight does not fit in the budget; `weight_bytes` is checked
+// before `materialize` is invoked so oversized weights cost nothing.
+TORCH_API Tensor DequantizedWeightCacheLookup(
+    const void* key,
+    int64_t weight_bytes,
+    const std::function<Tensor()>& materialize);
+
+// Removes the entry for `key`, if present.
+TORCH_API void DequantizedWeightCacheErase(const void* key);
+
+// Sets the byte budget, evicting entries as needed. Zero disables the
+// cache and drops all entries.
+TORCH_API void SetDequantizedWeightCacheBudget(int64_t budget_bytes);
+TORCH_API int64_t GetDequantizedWeightCacheBudget();
+
+// Bytes currently held by cached fp32 weights.
+TORCH_API int64_t GetDequantizedWeightCacheBytes();
+
+TORCH_API void ClearDequantizedWeightCache();
 } // namespace fbgemm_utils
 } // namespace native
 } // namespace at
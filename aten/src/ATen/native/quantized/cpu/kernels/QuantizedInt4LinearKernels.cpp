@@ -0,0 +1,101 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/quantized/cpu/QuantizedOps.h>
+#include <c10/util/irange.h>
+
+#include <vector>
+
+namespace at {
+namespace native {
+namespace {
+
+inline float dot_f32(const float* a, const float* b, int64_t len) {
+  using Vec = vec::Vectorized<float>;
+  Vec sum_vec = Vec(0.f);
+  int64_t d = 0;
+  for (; d + Vec::size() <= len; d += Vec::size()) {
+    sum_vec = vec::fmadd(Vec::loadu(a + d), Vec::loadu(b + d), sum_vec);
+  }
+  float sum =
+      vec::vec_reduce_all<float>([](Vec x, Vec y) { return x + y; }, sum_vec);
+  for (; d < len; d++) {
+    sum += a[d] * b[d];
+  }
+  return sum;
+}
+
+template <typename scalar_t>
+void int4pack_mm_impl(
+    Tensor& out,
+    const Tensor& input,
+    const Tensor& packed,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  const int64_t M = input.size(0);
+  const int64_t K = input.size(1);
+  const int64_t N = packed.size(0);
+  const int64_t groups = K / group_size;
+
+  // The kernel is bound by streaming the weight bytes, so reduced-precision
+  // activations are widened to fp32 once up front and reused for every
+  // weight row.
+  Tensor input_f =
+      input.scalar_type() == kFloat ? input : input.to(kFloat);
+  const float* a_data = input_f.data_ptr<float>();
+  const uint8_t* w_data = packed.data_ptr<uint8_t>();
+  const float* sz_data = scales_and_zeros.data_ptr<float>();
+  scalar_t* out_data = out.data_ptr<scalar_t>();
+
+  at::parallel_for(0, N, 1, [&](int64_t begin, int64_t end) {
+    // One group of weights is dequantized into this hot buffer and consumed
+    // by all M activation rows before the next group's bytes are touched.
+    std::vector<float> dequant(group_size);
+    std::vector<float> acc(M);
+    for (const auto n : c10::irange(begin, end)) {
+      const uint8_t* w_row = w_data + n * (K / 2);
+      const float* sz_row = sz_data + n * groups * 2;
+      std::fill(acc.begin(), acc.end(), 0.f);
+      for (const auto g : c10::irange(groups)) {
+        const float scale = sz_row[2 * g];
+        const float zero = sz_row[2 * g + 1];
+        const uint8_t* w_group = w_row + g * group_size / 2;
+        for (const auto j : c10::irange(group_size / 2)) {
+          const uint8_t byte = w_group[j];
+          dequant[2 * j] = static_cast<float>(byte & 0xF) * scale + zero;
+          dequant[2 * j + 1] = static_cast<float>(byte >> 4) * scale + zero;
+        }
+        const float* a_group = a_data + g * group_size;
+        for (const auto m : c10::irange(M)) {
+          acc[m] += dot_f32(a_group + m * K, dequant.data(), group_size);
+        }
+      }
+      for (const auto m : c10::irange(M)) {
+        out_data[m * N + n] = static_cast<scalar_t>(acc[m]);
+      }
+    }
+  });
+}
+
+void int4pack_mm_kernel(
+    Tensor& out,
+    const Tensor& input,
+    const Tensor& packed,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kBFloat16, kHalf, input.scalar_type(), "int4pack_mm_cpu", [&] {
+        int4pack_mm_impl<scalar_t>(
+            out, input, packed, group_size, scales_and_zeros);
+      });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(int4pack_mm_stub, &int4pack_mm_kernel);
+
+} // namespace native
+} // namespace at
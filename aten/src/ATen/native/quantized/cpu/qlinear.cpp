@@ -9,6 +9,7 @@
 #include <ATen/native/quantized/cpu/XnnpackUtils.h>
 #include <ATen/native/quantized/cpu/OnednnUtils.h>
 #include <ATen/native/quantized/cpu/QuantUtils.h>
+#include <ATen/quantized/Quantizer.h>
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #include <torch/library.h>
 
@@ -782,7 +783,8 @@ at::Tensor PackedLinearWeightsOnednn::apply_impl(
     at::Tensor input,
     double output_scale,
     int64_t output_zero_point,
-    torch::List<at::Scalar> post_op_args) {
+    torch::List<at::Scalar> post_op_args,
+    c10::optional<at::Tensor> accum) {
   const int64_t dim = input.dim();
   TORCH_CHECK(
       dim != 0,
@@ -803,6 +805,15 @@ at::Tensor PackedLinearWeightsOnednn::apply_impl(
     op_attr = ideep::attr_t::fuse_relu(/*scale=*/1.0f, /*alpha=*/post_op_args.get(0).to<double>());
   } else if (post_op == Tanh) {
     op_attr = ideep::attr_t::fuse_tanh();
+  } else if (post_op == Gelu) {
+    const auto gelu_type = post_op_args.get(0).to<int64_t>() == 0
+        ? dnnl::algorithm::eltwise_gelu_erf
+        : dnnl::algorithm::eltwise_gelu_tanh;
+    op_attr = ideep::attr_t::fuse_gelu(1.0, 0.f, 0.f, gelu_type);
+  } else if (post_op == AddRelu) {
+    // Just tells we have these post op, the actual value such as scale and
+    // zero point will be setted later.
+    op_attr = ideep::attr_t::residual_with_sum_zero_point();
   }
   ideep::tensor x(input_desc, input_contig->data_ptr<c10::quint8>());
   auto dst_dims = {M, N};
@@ -815,18 +826,46 @@ at::Tensor PackedLinearWeightsOnednn::apply_impl(
   const ideep::zero_point_t& src_zero_point = ideep::zero_point_t(1, input_zero_point);
   const ideep::zero_point_t& dst_zero_point = ideep::zero_point_t(1, output_zero_point);
   // Compute: Use ideep::matmul_forward to support asymmetric quantization
-  // Allocate output Tensor
-  at::Tensor output = at::_empty_affine_quantized(
-      dst_dims,
-      at::device(c10::kCPU).dtype(c10::kQUInt8),
-      output_scale,
-      output_zero_point);
-  if (output.numel() == 0) {
-    return output;
+  // Allocate output Tensor; when fused with sum, the accum tensor is updated
+  // in place and also serves as the output (see the conv add path in
+  // qconv.cpp).
+  bool has_accum = accum.has_value();
+  float sum_scale = 1.0;
+  int32_t sum_zero_point = 0;
+  at::Tensor output;
+  at::Tensor accum_contig;
+  ideep::tensor y;
+  if (has_accum) {
+    TORCH_CHECK(accum.value().scalar_type() == c10::ScalarType::QUInt8,
+        "qlinear (ONEDNN): data type of accum should be QUint8.");
+    sum_scale = accum.value().q_scale();
+    sum_zero_point = accum.value().q_zero_point();
+    accum_contig = accum.value().contiguous();
+    TORCH_CHECK(accum_contig.numel() == M * N,
+        "qlinear (ONEDNN): accum tensor should have ", M * N,
+        " elements, but got ", accum_contig.numel());
+    if (accum_contig.numel() == 0) {
+      return accum_contig;
+    }
+    auto dst_desc = ideep::tensor::desc(dst_dims, input_data_type);
+    y.init(dst_desc, accum_contig.data_ptr());
+    // The scale and zero point of the values being summed ride on the dst
+    // tensor; the true output scale and zero point go into the primitive.
+    y.set_scale(ideep::scale_t(1, 1.0 / sum_scale));
+    y.set_zero_point(ideep::zero_point_t(1, sum_zero_point));
+  } else {
+    output = at::_empty_affine_quantized(
+        dst_dims,
+        at::device(c10::kCPU).dtype(c10::kQUInt8),
+        output_scale,
+        output_zero_point);
+    if (output.numel() == 0) {
+      return output;
+    }
+    y = ideep::tensor({dst_dims, ideep::tensor::data_type::u8,
+                       {output.strides().cbegin(), output.strides().cend()}},
+                      output.data_ptr());
   }
-  ideep::tensor y({dst_dims, ideep::tensor::data_type::u8,
-                   {output.strides().cbegin(), output.strides().cend()}},
-                  output.data_ptr());
   bool with_bias = bias_.has_value();
   if (with_bias) {
     // Bias might be modified outside (e.g. by quantization bias correction).
@@ -840,7 +879,7 @@ at::Tensor PackedLinearWeightsOnednn::apply_impl(
   // and won't be updated afterwards.
   int num_threads = at::get_num_threads();
   PrimitiveCacheKey cache_key = std::make_tuple(
-      input_scale, input_zero_point, input_dims, output_scale, output_zero_point, num_threads, /*accum scale*/1.0, /*accum zero point*/0);
+      input_scale, input_zero_point, input_dims, output_scale, output_zero_point, num_threads, sum_scale, sum_zero_point);
   c10::call_once(*cache_initialized_flag, [&](){
       LinearParams params;
       ideep::matmul_forward::prepare</*is_dynamic=*/false>(
@@ -861,6 +900,15 @@ at::Tensor PackedLinearWeightsOnednn::apply_impl(
   }
   auto out_sizes = input.sizes().vec();
   out_sizes.back() = N;
+  if (has_accum) {
+    // The accum tensor was accumulated into in place; it now holds the
+    // output, so it takes on the output scale and zero point.
+    set_quantizer_(accum_contig, at::make_per_tensor_affine_quantizer(
+        output_scale, output_zero_point, accum_contig.scalar_type()));
+    if (accum_contig.sizes().vec() == out_sizes)
+      return accum_contig;
+    return accum_contig.reshape(out_sizes);
+  }
   if (output.sizes().vec() == out_sizes)
     return output;
   return output.reshape(out_sizes);
@@ -901,6 +949,30 @@ at::Tensor PackedLinearWeightsOnednn:: apply_tanh(
       std::move(input), output_scale, output_zero_point);
 }
 
+at::Tensor PackedLinearWeightsOnednn:: apply_gelu(
+    at::Tensor input,
+    double output_scale,
+    int64_t output_zero_point,
+    c10::string_view approximate) {
+  TORCH_CHECK(
+      approximate == "none" || approximate == "tanh",
+      "qlinear_gelu (ONEDNN): unsupported gelu approximation: ", approximate);
+  torch::List<at::Scalar> post_op_args =
+      {at::Scalar(static_cast<int64_t>(approximate == "tanh"))};
+  return apply_impl<Gelu>(
+      std::move(input), output_scale, output_zero_point, post_op_args);
+}
+
+at::Tensor PackedLinearWeightsOnednn:: apply_add_relu(
+    at::Tensor input,
+    at::Tensor accum,
+    double output_scale,
+    int64_t output_zero_point) {
+  return apply_impl<AddRelu>(
+      std::move(input), output_scale, output_zero_point,
+      torch::List<at::Scalar>(), std::move(accum));
+}
+
 #endif // #if AT_MKLDNN_ENABLED()
 
 namespace at {
@@ -969,6 +1041,50 @@ class QLinearTanhInt8 final {
   }
 };
 
+class QLinearGeluInt8 final {
+ public:
+  static at::Tensor run(
+      at::Tensor input,
+      const c10::intrusive_ptr<LinearPackedParamsBase>& packed_weight,
+      double output_scale,
+      int64_t output_zero_point,
+      c10::string_view approximate) {
+    auto& ctx = at::globalContext();
+#if AT_MKLDNN_ENABLED()
+    if (ctx.qEngine() == at::QEngine::ONEDNN) {
+      return dynamic_cast<PackedLinearWeightsOnednn*>(packed_weight.get())->apply_gelu(
+          std::move(input), output_scale, output_zero_point, approximate);
+    }
+#endif
+    TORCH_CHECK(
+        false,
+        "Didn't find engine for operation quantized::linear_gelu ",
+        toString(ctx.qEngine()));
+  }
+};
+
+class QLinearAddReluInt8 final {
+ public:
+  static at::Tensor run(
+      at::Tensor input,
+      at::Tensor accum,
+      const c10::intrusive_ptr<LinearPackedParamsBase>& packed_weight,
+      double output_scale,
+      int64_t output_zero_point) {
+    auto& ctx = at::globalContext();
+#if AT_MKLDNN_ENABLED()
+    if (ctx.qEngine() == at::QEngine::ONEDNN) {
+      return dynamic_cast<PackedLinearWeightsOnednn*>(packed_weight.get())->apply_add_relu(
+          std::move(input), std::move(accum), output_scale, output_zero_point);
+    }
+#endif
+    TORCH_CHECK(
+        false,
+        "Didn't find engine for operation quantized::linear_add_relu ",
+        toString(ctx.qEngine()));
+  }
+};
+
 template <bool ReluFused>
 class QLinearInt8FusedQDQ final {
  public:
@@ -993,6 +1109,8 @@ TORCH_LIBRARY_IMPL(quantized, QuantizedCPU, m) {
   m.impl(TORCH_SELECTIVE_NAME("quantized::linear_relu"), TORCH_FN(QLinearInt8<true>::run));
   m.impl(TORCH_SELECTIVE_NAME("quantized::linear_leaky_relu"), TORCH_FN(QLinearLeakyReluInt8::run));
   m.impl(TORCH_SELECTIVE_NAME("quantized::linear_tanh"), TORCH_FN(QLinearTanhInt8::run));
+  m.impl(TORCH_SELECTIVE_NAME("quantized::linear_gelu"), TORCH_FN(QLinearGeluInt8::run));
+  m.impl(TORCH_SELECTIVE_NAME("quantized::linear_add_relu"), TORCH_FN(QLinearAddReluInt8::run));
 }
 
 TORCH_LIBRARY_IMPL(_quantized, QuantizedCPU, m) {
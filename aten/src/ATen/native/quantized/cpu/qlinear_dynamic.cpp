@@ -16,6 +16,7 @@
 #include <ATen/ops/_empty_affine_quantized.h>
 #include <ATen/ops/aminmax.h>
 #include <ATen/ops/empty.h>
+#include <ATen/ops/mm.h>
 #include <ATen/ops/quantize_per_tensor.h>
 #endif
 
@@ -423,21 +424,36 @@ at::Tensor& PackedLinearWeightFp16::apply_dynamic_impl(
   // Resize output Tensor
   output.resize_(output_sizes);
 
-  int num_tasks = at::get_num_threads();
-  at::parallel_for(0, num_tasks, 1, [&](int64_t begin, int64_t end) {
-    for (const auto task_id : c10::irange(begin, end)) {
-      // Call the fp16 gemm interface
-      fbgemm::cblas_gemm_compute(
-          /*transa=*/fbgemm::matrix_op_t::NoTranspose,
-          /*m=*/static_cast<int>(M),
-          /*A=*/input_ptr,
-          /*Bp=*/packed_weight_fp16,
-          /*beta=*/0.0f,
-          /*C=*/output.data_ptr<float>(),
-          /*thread_id=*/static_cast<int>(task_id),
-          /*num_threads=*/num_tasks);
-    }
-  });
+  // Hot layers can serve from the dequantized-weight cache (see Note
+  // [Dequantized weight LRU cache] in fbgemm_utils.h): the fp32 copy is
+  // reused across calls and fed to a plain fp32 GEMM, skipping the
+  // per-call half->float conversion done inside cblas_gemm_compute.
+  const int64_t K = packed_weight_fp16.numRows();
+  const at::Tensor dequantized_weight =
+      at::native::fbgemm_utils::DequantizedWeightCacheLookup(
+          this, N * K * static_cast<int64_t>(sizeof(float)), [&] {
+            return std::get<0>(unpack()).contiguous();
+          });
+  if (dequantized_weight.defined()) {
+    auto output_2d = output.view({M, N});
+    at::mm_out(output_2d, input_contig.view({M, K}), dequantized_weight.t());
+  } else {
+    int num_tasks = at::get_num_threads();
+    at::parallel_for(0, num_tasks, 1, [&](int64_t begin, int64_t end) {
+      for (const auto task_id : c10::irange(begin, end)) {
+        // Call the fp16 gemm interface
+        fbgemm::cblas_gemm_compute(
+            /*transa=*/fbgemm::matrix_op_t::NoTranspose,
+            /*m=*/static_cast<int>(M),
+            /*A=*/input_ptr,
+            /*Bp=*/packed_weight_fp16,
+            /*beta=*/0.0f,
+            /*C=*/output.data_ptr<float>(),
+            /*thread_id=*/static_cast<int>(task_id),
+            /*num_threads=*/num_tasks);
+      }
+    });
+  }
 
   // Add bias term
   if (bias_.has_value()) {
@@ -482,6 +498,10 @@ void PackedLinearWeightFp16::set_bias(c10::optional<at::Tensor> bias) {
   bias_ = std::move(bias);
 }
 
+PackedLinearWeightFp16::~PackedLinearWeightFp16() {
+  at::native::fbgemm_utils::DequantizedWeightCacheErase(this);
+}
+
 #endif // USE_FBGEMM
 
 #if AT_MKLDNN_ENABLED()
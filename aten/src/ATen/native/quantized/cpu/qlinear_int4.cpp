@@ -0,0 +1,147 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/quantized/cpu/QuantizedOps.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_convert_weight_to_int4pack_native.h>
+#include <ATen/ops/_weight_int4pack_mm_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(int4pack_mm_stub);
+
+// Quantizes a floating-point weight [N, K] to 4 bits with per-group affine
+// parameters and packs it two values per byte (even k in the low nibble).
+// Each group of `group_size` consecutive elements along K shares one
+// (scale, zero) pair, stored as fp32 in a [N, K / group_size, 2] tensor, so
+// w ~= q * scale + zero with q in [0, 15].
+std::tuple<Tensor, Tensor> _convert_weight_to_int4pack_cpu(
+    const Tensor& self,
+    int64_t group_size) {
+  TORCH_CHECK(
+      self.dim() == 2, "_convert_weight_to_int4pack: expected a 2-d weight");
+  TORCH_CHECK(
+      self.scalar_type() == kFloat || self.scalar_type() == kBFloat16 ||
+          self.scalar_type() == kHalf,
+      "_convert_weight_to_int4pack: expected a floating point weight, got ",
+      self.scalar_type());
+  const int64_t N = self.size(0);
+  const int64_t K = self.size(1);
+  TORCH_CHECK(
+      group_size >= 2 && group_size % 2 == 0,
+      "_convert_weight_to_int4pack: group_size must be even and >= 2, got ",
+      group_size);
+  TORCH_CHECK(
+      K > 0 && K % group_size == 0,
+      "_convert_weight_to_int4pack: K (",
+      K,
+      ") must be a positive multiple of group_size (",
+      group_size,
+      ")");
+
+  const Tensor weight = self.to(kFloat).contiguous();
+  const int64_t groups = K / group_size;
+  Tensor packed = at::empty({N, K / 2}, self.options().dtype(kByte));
+  Tensor scales_and_zeros =
+      at::empty({N, groups, 2}, self.options().dtype(kFloat));
+
+  const float* w_data = weight.data_ptr<float>();
+  uint8_t* packed_data = packed.data_ptr<uint8_t>();
+  float* sz_data = scales_and_zeros.data_ptr<float>();
+
+  at::parallel_for(0, N, 1, [&](int64_t begin, int64_t end) {
+    for (const auto n : c10::irange(begin, end)) {
+      const float* w_row = w_data + n * K;
+      uint8_t* packed_row = packed_data + n * (K / 2);
+      float* sz_row = sz_data + n * groups * 2;
+      for (const auto g : c10::irange(groups)) {
+        const float* w_group = w_row + g * group_size;
+        const auto minmax =
+            std::minmax_element(w_group, w_group + group_size);
+        const float zero = *minmax.first;
+        float scale = (*minmax.second - zero) / 15.0f;
+        if (scale == 0.0f) {
+          // Constant group; any scale reproduces it exactly via the zero.
+          scale = 1.0f;
+        }
+        sz_row[2 * g] = scale;
+        sz_row[2 * g + 1] = zero;
+        const float inv_scale = 1.0f / scale;
+        uint8_t* packed_group = packed_row + g * group_size / 2;
+        for (const auto j : c10::irange(group_size / 2)) {
+          auto quantize = [&](float v) -> uint8_t {
+            const auto q = std::lrintf((v - zero) * inv_scale);
+            return static_cast<uint8_t>(std::min<long>(std::max<long>(q, 0), 15));
+          };
+          packed_group[j] = quantize(w_group[2 * j]) |
+              (quantize(w_group[2 * j + 1]) << 4);
+        }
+      }
+    }
+  });
+
+  return std::make_tuple(std::move(packed), std::move(scales_and_zeros));
+}
+
+// out = self @ dequantize(mat2).t() with the dequantization fused into the
+// GEMM so only the 4-bit weight bytes cross the memory bus. `mat2` and
+// `scales_and_zeros` are the outputs of _convert_weight_to_int4pack.
+Tensor _weight_int4pack_mm_cpu(
+    const Tensor& self,
+    const Tensor& mat2,
+    int64_t group_size,
+    const Tensor& scales_and_zeros) {
+  TORCH_CHECK(
+      self.dim() == 2, "_weight_int4pack_mm: expected a 2-d input");
+  TORCH_CHECK(
+      self.scalar_type() == kFloat || self.scalar_type() == kBFloat16 ||
+          self.scalar_type() == kHalf,
+      "_weight_int4pack_mm: expected a floating point input, got ",
+      self.scalar_type());
+  const int64_t M = self.size(0);
+  const int64_t K = self.size(1);
+  TORCH_CHECK(
+      group_size >= 2 && K > 0 && K % group_size == 0,
+      "_weight_int4pack_mm: K (",
+      K,
+      ") must be a positive multiple of group_size (",
+      group_size,
+      ")");
+  TORCH_CHECK(
+      mat2.scalar_type() == kByte && mat2.dim() == 2 &&
+          mat2.size(1) == K / 2,
+      "_weight_int4pack_mm: mat2 must be a uint8 [N, K / 2] packed weight");
+  const int64_t N = mat2.size(0);
+  TORCH_CHECK(
+      scales_and_zeros.scalar_type() == kFloat &&
+          scales_and_zeros.sizes() ==
+              IntArrayRef({N, K / group_size, 2}),
+      "_weight_int4pack_mm: scales_and_zeros must be fp32 of shape [",
+      N,
+      ", ",
+      K / group_size,
+      ", 2]");
+
+  auto input = self.contiguous();
+  auto packed = mat2.contiguous();
+  auto sz = scales_and_zeros.contiguous();
+  auto output = at::empty({M, N}, self.options());
+  int4pack_mm_stub(kCPU, output, input, packed, group_size, sz);
+  return output;
+}
+
+} // namespace native
+} // namespace at
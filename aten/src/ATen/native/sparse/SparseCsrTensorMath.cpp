@@ -5,6 +5,7 @@
 #include <ATen/SparseCsrTensorUtils.h>
 #include <ATen/core/Tensor.h>
 #include <ATen/core/grad_mode.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/mkl/Sparse.h>
 #include <ATen/native/BinaryOps.h>
 #include <ATen/native/CPUBlas.h>
@@ -529,6 +530,7 @@ void addmm_out_sparse_csr_native_cpu(
   auto csr = sparse.crow_indices();
   auto col_indices = sparse.col_indices();
   auto values = sparse.values();
+  int64_t nnz = values.numel();
 
   scalar_t cast_alpha = alpha.to<scalar_t>();
   r.mul_(beta);
@@ -545,25 +547,60 @@ void addmm_out_sparse_csr_native_cpu(
         int64_t dense_stride1 = dense.stride(1);
         int64_t r_stride0 = r.stride(0);
         int64_t r_stride1 = r.stride(1);
+        bool contiguous_rows = dense_stride1 == 1 && r_stride1 == 1;
+
+        // Partitioning rows uniformly leaves one thread with most of the
+        // work when nnz is concentrated in a few rows (e.g. power-law
+        // graphs), so partition by nnz instead: chunk boundaries are found
+        // by binary searching the crow_indices prefix sums for evenly
+        // spaced nnz targets.
+        const int64_t num_chunks = std::min<int64_t>(
+            std::max<int64_t>(at::get_num_threads(), 1),
+            std::max<int64_t>(dim_i, 1));
+        const index_t* csr_data = csr.data_ptr<index_t>();
+        std::vector<int64_t> chunk_rows(num_chunks + 1, dim_i);
+        chunk_rows[0] = 0;
+        for (const auto c : c10::irange(int64_t{1}, num_chunks)) {
+          const auto target = static_cast<index_t>(nnz * c / num_chunks);
+          chunk_rows[c] =
+              std::upper_bound(csr_data, csr_data + dim_i + 1, target) -
+              csr_data - 1;
+        }
 
         at::parallel_for(
-            0,
-            dim_i,
-            internal::GRAIN_SIZE,
-            [&](int64_t irow_start, int64_t irow_end) {
-              for (index_t h = irow_start; h < irow_end; ++h) {
-                index_t i_start = csr_accessor[h];
-                index_t i_end = csr_accessor[h + 1];
-                for (index_t i = i_start; i < i_end; i++) {
-                  scalar_t val = values_accessor[i];
-                  index_t col = col_indices_accessor[i];
-                  at::native::cpublas::axpy<scalar_t>(
-                      dim_k,
-                      cast_alpha * val,
-                      dense_ptr + col * dense_stride0,
-                      dense_stride1,
-                      r_ptr + h * r_stride0,
-                      r_stride1);
+            0, num_chunks, 1, [&](int64_t chunk_start, int64_t chunk_end) {
+              for (const auto c : c10::irange(chunk_start, chunk_end)) {
+                for (int64_t h = chunk_rows[c]; h < chunk_rows[c + 1]; ++h) {
+                  index_t i_start = csr_accessor[h];
+                  index_t i_end = csr_accessor[h + 1];
+                  scalar_t* r_row = r_ptr + h * r_stride0;
+                  for (index_t i = i_start; i < i_end; i++) {
+                    scalar_t val = cast_alpha * values_accessor[i];
+                    index_t col = col_indices_accessor[i];
+                    const scalar_t* dense_row =
+                        dense_ptr + col * dense_stride0;
+                    if (contiguous_rows) {
+                      using Vec = at::vec::Vectorized<scalar_t>;
+                      const Vec val_vec(val);
+                      int64_t k = 0;
+                      for (; k <= dim_k - Vec::size(); k += Vec::size()) {
+                        auto out_vec = Vec::loadu(r_row + k) +
+                            val_vec * Vec::loadu(dense_row + k);
+                        out_vec.store(r_row + k);
+                      }
+                      for (; k < dim_k; ++k) {
+                        r_row[k] += val * dense_row[k];
+                      }
+                    } else {
+                      at::native::cpublas::axpy<scalar_t>(
+                          dim_k,
+                          val,
+                          dense_row,
+                          dense_stride1,
+                          r_row,
+                          r_stride1);
+                    }
+                  }
                 }
               }
             });
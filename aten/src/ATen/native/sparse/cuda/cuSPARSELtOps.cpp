@@ -0,0 +1,303 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAConfig.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/Exceptions.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/util/Exception.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_cslt_compress_native.h>
+#include <ATen/ops/_cslt_sparse_mm_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+#if AT_CUSPARSELT_ENABLED()
+#include <cusparseLt.h>
+#endif
+
+namespace at {
+namespace native {
+
+#if AT_CUSPARSELT_ENABLED()
+
+namespace {
+
+// cuSPARSELt handle, shared by all calls; created lazily on first use and
+// intentionally never destroyed (same lifetime policy as the cusparse/cublas
+// handles owned by CUDAContext).
+cusparseLtHandle_t handle;
+bool handle_initialized = false;
+
+// The compressed buffer holds the kept values plus the 2:4 selection
+// metadata. For 16-bit and 32-bit element types that is numel/2 values and
+// numel/16 elements worth of metadata, i.e. 9/16 of the dense payload; for
+// 8-bit types the metadata is relatively larger, 10/16.
+int64_t compression_factor_for(at::ScalarType type) {
+  return type == at::ScalarType::Char ? 10 : 9;
+}
+
+cudaDataType cuda_type_for(at::ScalarType type) {
+  switch (type) {
+    case at::ScalarType::Char:
+      return CUDA_R_8I;
+    case at::ScalarType::Half:
+      return CUDA_R_16F;
+    case at::ScalarType::BFloat16:
+      return CUDA_R_16BF;
+    case at::ScalarType::Float:
+      return CUDA_R_32F;
+    default:
+      TORCH_CHECK(
+          false,
+          "cuSPARSELt only supports int8, fp16, bf16 and fp32 inputs, got ",
+          type);
+  }
+}
+
+} // namespace
+
+Tensor _cslt_compress(const Tensor& sparse_input) {
+  TORCH_CHECK(
+      sparse_input.dim() == 2, "_cslt_compress: input must be a 2-D matrix");
+  TORCH_CHECK(
+      sparse_input.is_contiguous(),
+      "_cslt_compress: input must be contiguous (row-major)");
+  TORCH_CHECK(
+      sparse_input.size(1) % 16 == 0,
+      "_cslt_compress: number of columns must be a multiple of 16, got ",
+      sparse_input.size(1));
+  if (!handle_initialized) {
+    TORCH_CUDASPARSE_CHECK(cusparseLtInit(&handle));
+    handle_initialized = true;
+  }
+
+  cudaDataType type = cuda_type_for(sparse_input.scalar_type());
+  auto compression_factor = compression_factor_for(sparse_input.scalar_type());
+
+  // The compressed tensor is an opaque flat buffer of the input dtype; only
+  // _cslt_sparse_mm knows how to interpret it.
+  auto compressed_tensor =
+      sparse_input.new_empty(sparse_input.numel() * compression_factor / 16);
+
+  cusparseLtMatDescriptor_t sparse_input_descriptor;
+  TORCH_CUDASPARSE_CHECK(cusparseLtStructuredDescriptorInit(
+      &handle,
+      &sparse_input_descriptor,
+      sparse_input.size(0),
+      sparse_input.size(1),
+      sparse_input.size(1),
+      16,
+      type,
+      CUSPARSE_ORDER_ROW,
+      CUSPARSELT_SPARSITY_50_PERCENT));
+
+  // compress the original dense matrix
+  size_t compressed_size, compressed_buffer_size;
+  TORCH_CUDASPARSE_CHECK(cusparseLtSpMMACompressedSize2(
+      &handle,
+      &sparse_input_descriptor,
+      &compressed_size,
+      &compressed_buffer_size));
+
+  auto& allocator = *::c10::cuda::CUDACachingAllocator::get();
+  auto compressedBufferPtr = allocator.allocate(compressed_buffer_size);
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+
+  TORCH_CUDASPARSE_CHECK(cusparseLtSpMMACompress2(
+      &handle,
+      &sparse_input_descriptor,
+      true,
+      CUSPARSE_OPERATION_NON_TRANSPOSE,
+      sparse_input.data_ptr(),
+      compressed_tensor.data_ptr(),
+      compressedBufferPtr.get(),
+      stream));
+
+  TORCH_CUDASPARSE_CHECK(
+      cusparseLtMatDescriptorDestroy(&sparse_input_descriptor));
+  return compressed_tensor;
+}
+
+Tensor _cslt_sparse_mm(
+    const Tensor& compressed_A,
+    const Tensor& dense_B,
+    const c10::optional<Tensor>& bias_opt,
+    bool transpose_result) {
+  TORCH_CHECK(
+      dense_B.dim() == 2, "_cslt_sparse_mm: dense_B must be a 2-D matrix");
+  TORCH_CHECK(
+      compressed_A.scalar_type() == dense_B.scalar_type(),
+      "_cslt_sparse_mm: operand dtypes must match, got ",
+      compressed_A.scalar_type(),
+      " and ",
+      dense_B.scalar_type());
+  if (!handle_initialized) {
+    TORCH_CUDASPARSE_CHECK(cusparseLtInit(&handle));
+    handle_initialized = true;
+  }
+
+  cudaDataType input_type = cuda_type_for(compressed_A.scalar_type());
+  cusparseComputeType compute_type;
+  switch (compressed_A.scalar_type()) {
+    case at::ScalarType::Char:
+      compute_type = CUSPARSE_COMPUTE_32I;
+      break;
+    case at::ScalarType::Half:
+    case at::ScalarType::BFloat16:
+      compute_type = CUSPARSE_COMPUTE_16F;
+      break;
+    case at::ScalarType::Float:
+      compute_type = CUSPARSE_COMPUTE_TF32;
+      break;
+    default:
+      TORCH_CHECK(
+          false,
+          "_cslt_sparse_mm: unsupported dtype ",
+          compressed_A.scalar_type());
+  }
+  auto compression_factor = compression_factor_for(compressed_A.scalar_type());
+
+  // Recover the shape of the original dense A from the opaque buffer size
+  int64_t k = dense_B.size(0);
+  int64_t n = dense_B.size(1);
+  int64_t m = (compressed_A.numel() * 16 / compression_factor) / k;
+
+  cusparseLtMatDescriptor_t sparse_input_descriptor;
+  TORCH_CUDASPARSE_CHECK(cusparseLtStructuredDescriptorInit(
+      &handle,
+      &sparse_input_descriptor,
+      m,
+      k,
+      k,
+      16,
+      input_type,
+      CUSPARSE_ORDER_ROW,
+      CUSPARSELT_SPARSITY_50_PERCENT));
+
+  // A column-major dense_B is handled as a transposed row-major operand
+  // instead of being materialized contiguous
+  const bool dense_row_major = dense_B.is_contiguous();
+  cusparseLtMatDescriptor_t dense_input_descriptor;
+  TORCH_CUDASPARSE_CHECK(cusparseLtDenseDescriptorInit(
+      &handle,
+      &dense_input_descriptor,
+      dense_row_major ? k : n,
+      dense_row_major ? n : k,
+      dense_row_major ? n : k,
+      16,
+      input_type,
+      CUSPARSE_ORDER_ROW));
+
+  auto res = transpose_result
+      ? at::empty({n, m}, dense_B.options())
+      : at::empty({m, n}, dense_B.options());
+
+  cusparseLtMatDescriptor_t res_descriptor;
+  TORCH_CUDASPARSE_CHECK(cusparseLtDenseDescriptorInit(
+      &handle,
+      &res_descriptor,
+      m,
+      n,
+      transpose_result ? m : n,
+      16,
+      input_type,
+      transpose_result ? CUSPARSE_ORDER_COL : CUSPARSE_ORDER_ROW));
+
+  cusparseLtMatmulDescriptor_t matmul;
+  TORCH_CUDASPARSE_CHECK(cusparseLtMatmulDescriptorInit(
+      &handle,
+      &matmul,
+      CUSPARSE_OPERATION_NON_TRANSPOSE,
+      dense_row_major ? CUSPARSE_OPERATION_NON_TRANSPOSE
+                      : CUSPARSE_OPERATION_TRANSPOSE,
+      &sparse_input_descriptor,
+      &dense_input_descriptor,
+      &res_descriptor,
+      &res_descriptor,
+      compute_type));
+
+  if (bias_opt.has_value()) {
+    auto& bias = bias_opt.value();
+    TORCH_CHECK(
+        bias.numel() == m,
+        "_cslt_sparse_mm: bias must have ",
+        m,
+        " elements, got ",
+        bias.numel());
+    void* dBias = bias.data_ptr();
+    TORCH_CUDASPARSE_CHECK(cusparseLtMatmulDescSetAttribute(
+        &handle,
+        &matmul,
+        CUSPARSELT_MATMUL_BIAS_POINTER,
+        &dBias,
+        sizeof(dBias)));
+  }
+
+  cusparseLtMatmulAlgSelection_t alg_sel;
+  TORCH_CUDASPARSE_CHECK(cusparseLtMatmulAlgSelectionInit(
+      &handle, &alg_sel, &matmul, CUSPARSELT_MATMUL_ALG_DEFAULT));
+
+  cusparseLtMatmulPlan_t plan;
+  TORCH_CUDASPARSE_CHECK(
+      cusparseLtMatmulPlanInit(&handle, &plan, &matmul, &alg_sel));
+
+  size_t workspace_size;
+  TORCH_CUDASPARSE_CHECK(
+      cusparseLtMatmulGetWorkspace(&handle, &plan, &workspace_size));
+  auto& allocator = *::c10::cuda::CUDACachingAllocator::get();
+  auto workspacePtr = allocator.allocate(workspace_size);
+
+  float alpha = 1.0;
+  float beta = 0.0;
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  TORCH_CUDASPARSE_CHECK(cusparseLtMatmul(
+      &handle,
+      &plan,
+      &alpha,
+      compressed_A.data_ptr(),
+      dense_B.data_ptr(),
+      &beta,
+      res.data_ptr(),
+      res.data_ptr(),
+      workspacePtr.get(),
+      &stream,
+      1));
+
+  TORCH_CUDASPARSE_CHECK(
+      cusparseLtMatDescriptorDestroy(&sparse_input_descriptor));
+  TORCH_CUDASPARSE_CHECK(
+      cusparseLtMatDescriptorDestroy(&dense_input_descriptor));
+  TORCH_CUDASPARSE_CHECK(cusparseLtMatDescriptorDestroy(&res_descriptor));
+  TORCH_CUDASPARSE_CHECK(cusparseLtMatmulPlanDestroy(&plan));
+
+  return res;
+}
+
+#else // !AT_CUSPARSELT_ENABLED()
+
+Tensor _cslt_compress(const Tensor& sparse_input) {
+  TORCH_CHECK(
+      false,
+      "_cslt_compress: PyTorch was not built with cuSPARSELt support; "
+      "check at::hasCuSPARSELt() and fall back to dense matmul.");
+}
+
+Tensor _cslt_sparse_mm(
+    const Tensor& compressed_A,
+    const Tensor& dense_B,
+    const c10::optional<Tensor>& bias_opt,
+    bool transpose_result) {
+  TORCH_CHECK(
+      false,
+      "_cslt_sparse_mm: PyTorch was not built with cuSPARSELt support; "
+      "check at::hasCuSPARSELt() and fall back to dense matmul.");
+}
+
+#endif // AT_CUSPARSELT_ENABLED()
+
+} // namespace native
+} // namespace at
@@ -5,6 +5,8 @@
 #include <ATen/Dispatch.h>
 #include <ATen/native/DispatchStub.h>
 #include <ATen/NestedTensorImpl.h>
+#include <ATen/OpMathType.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorIndexing.h>
 #include <ATen/cpu/vec/vec256/vec256.h>
@@ -21,7 +23,9 @@
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_scaled_dot_product_flash_attention_native.h>
 #include <ATen/ops/cat.h>
+#include <ATen/ops/empty.h>
 #endif
 
 #include <ATen/native/nested/NestedTensorTransformerFunctions.h>
@@ -30,7 +34,8 @@ namespace at {
 namespace native {
 
 DEFINE_DISPATCH(_fused_sdp_choice_stub);
-REGISTER_NO_CPU_DISPATCH(_fused_sdp_choice_stub);
+
+DEFINE_DISPATCH(flash_attention_kernel);
 
 namespace {
 
@@ -483,11 +488,74 @@ std::tuple<Tensor, Tensor> native_multi_head_attention_cpu(
   return std::make_tuple(std::move(proj), std::move(qkt));
 }
 
+namespace {
+
+// Constraints of the fused CPU flash attention kernel
+// (see cpu/FlashAttentionKernel.cpp): dense 4-D [B, H, S, D] inputs with a
+// contiguous head dimension, fp32/fp64/bf16, no dropout and no explicit
+// mask, and no backward (the kernel is forward-only).
+bool can_use_cpu_flash_attention(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    const c10::optional<Tensor>& attn_mask,
+    double dropout_p) {
+  if (attn_mask.has_value() || dropout_p != 0.0) {
+    return false;
+  }
+  if (query.is_nested() || key.is_nested() || value.is_nested()) {
+    return false;
+  }
+  const auto dtype = query.scalar_type();
+  if (dtype != at::kFloat && dtype != at::kDouble && dtype != at::kBFloat16) {
+    return false;
+  }
+  if (key.scalar_type() != dtype || value.scalar_type() != dtype) {
+    return false;
+  }
+  if (query.dim() != 4 || key.dim() != 4 || value.dim() != 4) {
+    return false;
+  }
+  // The kernel walks key/value with the query's batch and head counts and
+  // key with value's sequence length, so broadcastable-but-unequal inputs
+  // (valid through the math fallback) must stay out of the fused path.
+  if (query.size(0) != key.size(0) || query.size(0) != value.size(0)) {
+    return false;
+  }
+  if (query.size(1) != key.size(1) || query.size(1) != value.size(1)) {
+    return false;
+  }
+  if (key.size(2) != value.size(2)) {
+    return false;
+  }
+  if (query.size(3) != key.size(3) || query.size(3) != value.size(3)) {
+    return false;
+  }
+  if (query.numel() == 0 || key.numel() == 0 || value.numel() == 0) {
+    return false;
+  }
+  if (query.stride(3) != 1 || key.stride(3) != 1 || value.stride(3) != 1) {
+    return false;
+  }
+  if (at::GradMode::is_enabled() &&
+      (query.requires_grad() || key.requires_grad() || value.requires_grad())) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
 int64_t _fused_sdp_choice_cpp(const Tensor& query_, const Tensor& key, const Tensor& value,
         const c10::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal, c10::optional<double> scale){
+  if (can_use_cpu_flash_attention(query_, key, value, attn_mask_, dropout_p)) {
+    return static_cast<int64_t>(sdp::SDPBackend::flash_attention);
+  }
   return static_cast<int64_t>(sdp::SDPBackend::math);
 }
 
+REGISTER_ALL_CPU_DISPATCH(_fused_sdp_choice_stub, &_fused_sdp_choice_cpp);
+
 int64_t _fused_sdp_choice_meta(
     const Tensor& query_,
     const Tensor& key,
@@ -599,7 +667,8 @@ Tensor scaled_dot_product_attention(
     c10::optional<double> scale) {
   validate_sdpa_input(query_, key, value, attn_mask_, dropout_p, is_causal, scale);
   int64_t choice_int = static_cast<int64_t>(sdp::SDPBackend::math);
-  if (query_.device().type() == DeviceType::CUDA){
+  if (query_.device().type() == DeviceType::CUDA ||
+      query_.device().type() == DeviceType::CPU) {
     choice_int = _fused_sdp_choice_stub(query_.device().type(),
       query_, key, value, attn_mask_, dropout_p, is_causal, scale);
   }
@@ -636,6 +705,64 @@ Tensor scaled_dot_product_attention(
   }
 }
 
+std::tuple<Tensor, Tensor, Tensor, Tensor, int64_t, int64_t, Tensor, Tensor, Tensor>
+_scaled_dot_product_flash_attention_cpu(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    double dropout_p,
+    bool is_causal,
+    bool return_debug_mask,
+    c10::optional<double> scale) {
+  const auto dtype = query.scalar_type();
+  int64_t batchSize = query.size(0);
+  int64_t num_head = query.size(1);
+  int64_t qSize = query.size(2);
+  int64_t kvSize = key.size(2);
+  int64_t headSize = query.size(3);
+
+  TORCH_CHECK(
+      dtype == ScalarType::Float || dtype == ScalarType::Double ||
+          dtype == ScalarType::BFloat16,
+      "scaled_dot_product_flash_attention on CPU expects float, double or bfloat16, got ",
+      dtype);
+  TORCH_CHECK(
+      dropout_p == 0.0,
+      "scaled_dot_product_flash_attention on CPU does not support dropout > 0, got ",
+      dropout_p);
+  TORCH_CHECK(
+      key.size(3) == headSize && value.size(3) == headSize,
+      "scaled_dot_product_flash_attention on CPU expects q/k/v to have the same head size");
+  TORCH_CHECK(
+      !return_debug_mask,
+      "scaled_dot_product_flash_attention on CPU does not produce a debug attention mask");
+
+  // The kernel writes output in [B, S, H, D] order so the head dimension
+  // stays contiguous; transpose the view back afterwards.
+  at::Tensor output =
+      at::empty({batchSize, qSize, num_head, headSize}, query.options());
+  const auto accumulate_dtype = at::toOpMathType(dtype);
+  at::Tensor logsumexp = at::empty(
+      {batchSize, qSize, num_head}, query.options().dtype(accumulate_dtype));
+
+  flash_attention_kernel(
+      kCPU, output, logsumexp, query, key, value, dropout_p, is_causal, scale);
+
+  output = output.transpose(1, 2);
+  logsumexp = logsumexp.transpose(1, 2);
+
+  return std::make_tuple(
+      std::move(output),
+      std::move(logsumexp),
+      Tensor(),
+      Tensor(),
+      qSize,
+      kvSize,
+      Tensor(),
+      Tensor(),
+      Tensor());
+}
+
 std::tuple<Tensor, Tensor> _scaled_dot_product_attention_math(
         const Tensor& query_, const Tensor& key, const Tensor& value,
         const c10::optional<Tensor>& attn_mask_, double dropout_p, bool is_causal,
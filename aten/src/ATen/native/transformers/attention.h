@@ -13,6 +13,13 @@ using fused_sdp_choice_fn = int64_t (*)(const Tensor& query_, const Tensor& key,
 
 DECLARE_DISPATCH(fused_sdp_choice_fn, _fused_sdp_choice_stub);
 
+using flash_attention_fn = void (*)(
+    const Tensor& output, const Tensor& logsumexp,
+    const Tensor& query, const Tensor& key, const Tensor& value,
+    double dropout_p, bool is_causal, c10::optional<double> scale);
+
+DECLARE_DISPATCH(flash_attention_fn, flash_attention_kernel);
+
 TORCH_API Tensor bmm_nt(const Tensor& a, const Tensor& b);
 TORCH_API Tensor masked_softmax(
     Tensor& attn_scores,
@@ -883,10 +883,10 @@ std::tuple<at::Tensor, at::Tensor> _efficient_attention_forward(
         at::get_generator_or_default<at::CUDAGeneratorImpl>(
             c10::nullopt, at::cuda::detail::getDefaultCUDAGenerator());
 
-    std::lock_guard<std::mutex> lock(gen->mutex_);
     // if using dropout, we produce 1 random number for each element of the
-    // attention tensor
-    rng_engine_inputs = gen->philox_cuda_state(B * num_heads * M * N);
+    // attention tensor; eager-mode reservation is lock-free
+    // (see Note [CUDA Graph-safe RNG states])
+    rng_engine_inputs = gen->reserve_philox_cuda_state(B * num_heads * M * N);
   }
 
   cudaDeviceProp* p = at::cuda::getDeviceProperties(query.device().index());
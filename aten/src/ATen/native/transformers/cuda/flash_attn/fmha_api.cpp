@@ -326,9 +326,10 @@ mha_fwd(const at::Tensor &q,         // total_q x num_heads x head_size, total_q
     at::Tensor seed_t, offset_t;
     if (is_dropout) {
 
-        // See Note [Acquire lock when using random generators]
-        std::lock_guard<std::mutex> lock(gen->mutex_);
-        at::PhiloxCudaState philox_state = gen->philox_cuda_state(counter_offset);
+        // Reservation handles its own locking; see
+        // Note [CUDA Graph-safe RNG states]
+        at::PhiloxCudaState philox_state =
+            gen->reserve_philox_cuda_state(counter_offset);
         if (at::cuda::currentStreamCaptureStatus() == at::cuda::CaptureStatus::None) {
           auto [seed, offset] = at::cuda::philox::unpack(philox_state);
           seed_t = at::scalar_tensor(at::Scalar(static_cast<int64_t>(seed)), at::dtype(at::kLong));
@@ -0,0 +1,212 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGeneratorImpl.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <ATen/native/transformers/fused_embedding.h>
+#include <ATen/ceil_div.h>
+#include <c10/cuda/CUDAMathCompat.h>
+#include <c10/macros/Macros.h>
+#include <curand_kernel.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_embedding_layer_norm_dropout_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/zeros.h>
+#endif
+
+namespace at {
+namespace native {
+
+namespace {
+
+constexpr int kFusedEmbeddingBlockSize = 256;
+
+// One block per output row: gather the token embedding, add the positional
+// embedding, layer-normalize and apply dropout in a single pass over global
+// memory. The row statistics use a two-pass sum/sum-of-squares reduction in
+// the accumulation type; the second pass re-reads the (cached) embedding rows
+// instead of staging the intermediate sum in global memory, which is the
+// whole point of the fusion.
+template <typename scalar_t, typename index_t>
+C10_LAUNCH_BOUNDS_1(kFusedEmbeddingBlockSize)
+__global__ void fused_embedding_layer_norm_dropout_kernel(
+    const scalar_t* __restrict__ weight,
+    const index_t* __restrict__ indices,
+    const scalar_t* __restrict__ pos_weight,
+    const scalar_t* __restrict__ gamma,
+    const scalar_t* __restrict__ beta,
+    scalar_t* __restrict__ out,
+    bool* __restrict__ mask,
+    int64_t dim,
+    int64_t seq_len,
+    int64_t num_embeddings,
+    at::acc_type<scalar_t, true> eps,
+    float keep_p,
+    bool apply_dropout,
+    PhiloxCudaState philox_args) {
+  using accscalar_t = at::acc_type<scalar_t, true>;
+
+  const int64_t row = blockIdx.x;
+  const index_t token = indices[row];
+  CUDA_KERNEL_ASSERT(token >= 0 && token < num_embeddings);
+
+  const scalar_t* w = weight + token * dim;
+  const scalar_t* pw = pos_weight + (row % seq_len) * dim;
+  scalar_t* out_row = out + row * dim;
+  bool* mask_row = mask + row * dim;
+
+  accscalar_t sum = 0;
+  accscalar_t sum_sq = 0;
+  for (int64_t d = threadIdx.x; d < dim; d += blockDim.x) {
+    const accscalar_t x = accscalar_t(w[d]) + accscalar_t(pw[d]);
+    sum += x;
+    sum_sq += x * x;
+  }
+
+  __shared__ accscalar_t shared[C10_WARP_SIZE];
+  sum = cuda_utils::BlockReduceSum(sum, shared);
+  __syncthreads();
+  sum_sq = cuda_utils::BlockReduceSum(sum_sq, shared);
+
+  __shared__ accscalar_t s_mean;
+  __shared__ accscalar_t s_rstd;
+  if (threadIdx.x == 0) {
+    const accscalar_t mean = sum / dim;
+    accscalar_t var = sum_sq / dim - mean * mean;
+    var = var < accscalar_t(0) ? accscalar_t(0) : var;
+    s_mean = mean;
+    s_rstd = c10::cuda::compat::rsqrt(var + eps);
+  }
+  __syncthreads();
+  const accscalar_t mean = s_mean;
+  const accscalar_t rstd = s_rstd;
+
+  curandStatePhilox4_32_10_t state;
+  if (apply_dropout) {
+    auto seeds = at::cuda::philox::unpack(philox_args);
+    curand_init(
+        std::get<0>(seeds),
+        row * blockDim.x + threadIdx.x,
+        std::get<1>(seeds),
+        &state);
+  }
+  const accscalar_t scale = accscalar_t(1) / accscalar_t(keep_p);
+
+  float4 rand;
+  int rand_remaining = 0;
+  for (int64_t d = threadIdx.x; d < dim; d += blockDim.x) {
+    const accscalar_t x = accscalar_t(w[d]) + accscalar_t(pw[d]);
+    accscalar_t y = (x - mean) * rstd;
+    if (gamma != nullptr) {
+      y *= accscalar_t(gamma[d]);
+    }
+    if (beta != nullptr) {
+      y += accscalar_t(beta[d]);
+    }
+    bool keep = true;
+    if (apply_dropout) {
+      if (rand_remaining == 0) {
+        rand = curand_uniform4(&state);
+        rand_remaining = 4;
+      }
+      keep = (&rand.x)[4 - rand_remaining] < keep_p;
+      --rand_remaining;
+      y = keep ? y * scale : accscalar_t(0);
+    }
+    out_row[d] = scalar_t(y);
+    mask_row[d] = keep;
+  }
+}
+
+} // namespace
+
+std::tuple<Tensor, Tensor> fused_embedding_layer_norm_dropout_cuda(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double eps,
+    double p,
+    bool train) {
+  check_fused_embedding_inputs(weight, indices, pos_weight, gamma_opt, beta_opt, p);
+
+  const int64_t dim = weight.size(1);
+  auto out_sizes = indices.sizes().vec();
+  out_sizes.push_back(dim);
+
+  Tensor output = at::empty(out_sizes, weight.options());
+  Tensor mask = at::empty(out_sizes, weight.options().dtype(kBool));
+  const bool apply_dropout = train && p > 0;
+  if (apply_dropout && p == 1) {
+    return std::make_tuple(
+        at::zeros(out_sizes, weight.options()), mask.fill_(false));
+  }
+
+  const int64_t num_rows = indices.numel();
+  if (num_rows == 0 || dim == 0) {
+    return std::make_tuple(std::move(output), std::move(mask));
+  }
+
+  auto weight_c = weight.contiguous();
+  auto indices_c = indices.contiguous();
+  auto pos_weight_c = pos_weight.contiguous();
+  const Tensor& gamma = gamma_opt.has_value() ? *gamma_opt : Tensor();
+  const Tensor& beta = beta_opt.has_value() ? *beta_opt : Tensor();
+  auto gamma_c = gamma.defined() ? gamma.contiguous() : gamma;
+  auto beta_c = beta.defined() ? beta.contiguous() : beta;
+
+  PhiloxCudaState rng_engine_inputs;
+  if (apply_dropout) {
+    auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+        c10::nullopt, cuda::detail::getDefaultCUDAGenerator());
+    // Each thread draws ceil(its element count / 4) float4s.
+    const int64_t counter_offset =
+        (at::ceil_div(dim, (int64_t)kFusedEmbeddingBlockSize) + 3) / 4 * 4;
+    // Eager-mode reservation is lock-free; see
+    // Note [CUDA Graph-safe RNG states]
+    rng_engine_inputs = gen->reserve_philox_cuda_state(counter_offset);
+  }
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  dim3 grid(num_rows);
+  dim3 block(kFusedEmbeddingBlockSize);
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, weight.scalar_type(), "fused_embedding_layer_norm_dropout_cuda", [&] {
+        using accscalar_t = at::acc_type<scalar_t, true>;
+        AT_DISPATCH_INDEX_TYPES(
+            indices_c.scalar_type(), "fused_embedding_layer_norm_dropout_cuda", [&] {
+              fused_embedding_layer_norm_dropout_kernel<scalar_t, index_t>
+                  <<<grid, block, 0, stream>>>(
+                      weight_c.data_ptr<scalar_t>(),
+                      indices_c.data_ptr<index_t>(),
+                      pos_weight_c.data_ptr<scalar_t>(),
+                      gamma_c.defined() ? gamma_c.data_ptr<scalar_t>() : nullptr,
+                      beta_c.defined() ? beta_c.data_ptr<scalar_t>() : nullptr,
+                      output.data_ptr<scalar_t>(),
+                      mask.data_ptr<bool>(),
+                      dim,
+                      indices.size(-1),
+                      weight.size(0),
+                      accscalar_t(eps),
+                      float(1 - p),
+                      apply_dropout,
+                      rng_engine_inputs);
+              C10_CUDA_KERNEL_LAUNCH_CHECK();
+            });
+      });
+
+  return std::make_tuple(std::move(output), std::move(mask));
+}
+
+} // namespace native
+} // namespace at
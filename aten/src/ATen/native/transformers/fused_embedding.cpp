@@ -0,0 +1,188 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/transformers/fused_embedding.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_fused_embedding_layer_norm_dropout_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/zeros.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace at {
+
+namespace native {
+
+void check_fused_embedding_inputs(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const c10::optional<Tensor>& gamma,
+    const c10::optional<Tensor>& beta,
+    double p) {
+  TORCH_CHECK(
+      weight.dim() == 2,
+      "_fused_embedding_layer_norm_dropout: weight must be 2-D, got ",
+      weight.dim(),
+      "-D");
+  TORCH_CHECK(
+      pos_weight.dim() == 2,
+      "_fused_embedding_layer_norm_dropout: pos_weight must be 2-D, got ",
+      pos_weight.dim(),
+      "-D");
+  TORCH_CHECK(
+      pos_weight.size(1) == weight.size(1),
+      "_fused_embedding_layer_norm_dropout: pos_weight embedding dim ",
+      pos_weight.size(1),
+      " does not match weight embedding dim ",
+      weight.size(1));
+  TORCH_CHECK(
+      pos_weight.scalar_type() == weight.scalar_type(),
+      "_fused_embedding_layer_norm_dropout: pos_weight dtype must match weight");
+  TORCH_CHECK(
+      indices.dim() >= 1,
+      "_fused_embedding_layer_norm_dropout: indices must have at least 1 dimension");
+  TORCH_CHECK(
+      indices.scalar_type() == kInt || indices.scalar_type() == kLong,
+      "_fused_embedding_layer_norm_dropout: expected indices to be int or long, got ",
+      indices.scalar_type());
+  TORCH_CHECK(
+      indices.size(-1) <= pos_weight.size(0),
+      "_fused_embedding_layer_norm_dropout: sequence length ",
+      indices.size(-1),
+      " exceeds pos_weight rows ",
+      pos_weight.size(0));
+  if (gamma.has_value() && gamma->defined()) {
+    TORCH_CHECK(
+        gamma->dim() == 1 && gamma->size(0) == weight.size(1),
+        "_fused_embedding_layer_norm_dropout: gamma must be 1-D of size ",
+        weight.size(1));
+  }
+  if (beta.has_value() && beta->defined()) {
+    TORCH_CHECK(
+        beta->dim() == 1 && beta->size(0) == weight.size(1),
+        "_fused_embedding_layer_norm_dropout: beta must be 1-D of size ",
+        weight.size(1));
+  }
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "_fused_embedding_layer_norm_dropout: dropout probability has to be between 0 and 1, but got ",
+      p);
+}
+
+std::tuple<Tensor, Tensor> fused_embedding_layer_norm_dropout_cpu(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const c10::optional<Tensor>& gamma_opt,
+    const c10::optional<Tensor>& beta_opt,
+    double eps,
+    double p,
+    bool train) {
+  check_fused_embedding_inputs(weight, indices, pos_weight, gamma_opt, beta_opt, p);
+
+  const int64_t dim = weight.size(1);
+  auto out_sizes = indices.sizes().vec();
+  out_sizes.push_back(dim);
+
+  Tensor output = at::empty(out_sizes, weight.options());
+  Tensor mask = at::empty(out_sizes, weight.options().dtype(kBool));
+  const bool apply_dropout = train && p > 0;
+  if (apply_dropout && p == 1) {
+    // Everything is dropped; skip the normalization entirely.
+    return std::make_tuple(
+        at::zeros(out_sizes, weight.options()), mask.fill_(false));
+  }
+  if (apply_dropout) {
+    mask.bernoulli_(1 - p);
+  } else {
+    mask.fill_(true);
+  }
+
+  auto weight_c = weight.contiguous();
+  auto indices_c = indices.contiguous();
+  auto pos_weight_c = pos_weight.contiguous();
+  const Tensor& gamma = gamma_opt.has_value() ? *gamma_opt : Tensor();
+  const Tensor& beta = beta_opt.has_value() ? *beta_opt : Tensor();
+  auto gamma_c = gamma.defined() ? gamma.contiguous() : gamma;
+  auto beta_c = beta.defined() ? beta.contiguous() : beta;
+
+  const int64_t num_rows = indices_c.numel();
+  const int64_t seq_len = indices.size(-1);
+  const int64_t num_embeddings = weight.size(0);
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, weight.scalar_type(), "fused_embedding_layer_norm_dropout_cpu", [&] {
+        using accscalar_t = at::acc_type<scalar_t, false>;
+        const scalar_t* weight_data = weight_c.data_ptr<scalar_t>();
+        const scalar_t* pos_data = pos_weight_c.data_ptr<scalar_t>();
+        const scalar_t* gamma_data =
+            gamma_c.defined() ? gamma_c.data_ptr<scalar_t>() : nullptr;
+        const scalar_t* beta_data =
+            beta_c.defined() ? beta_c.data_ptr<scalar_t>() : nullptr;
+        scalar_t* out_data = output.data_ptr<scalar_t>();
+        const bool* mask_data = mask.data_ptr<bool>();
+        const accscalar_t scale =
+            apply_dropout ? accscalar_t(1) / (accscalar_t(1) - accscalar_t(p))
+                          : accscalar_t(1);
+        AT_DISPATCH_INDEX_TYPES(
+            indices_c.scalar_type(), "fused_embedding_layer_norm_dropout_cpu", [&] {
+              const index_t* indices_data = indices_c.data_ptr<index_t>();
+              at::parallel_for(0, num_rows, 1, [&](int64_t begin, int64_t end) {
+                for (int64_t row = begin; row < end; ++row) {
+                  const index_t token = indices_data[row];
+                  TORCH_CHECK(
+                      token >= 0 && token < num_embeddings,
+                      "_fused_embedding_layer_norm_dropout: index out of range, got ",
+                      token);
+                  const scalar_t* w = weight_data + token * dim;
+                  const scalar_t* pw = pos_data + (row % seq_len) * dim;
+                  scalar_t* out = out_data + row * dim;
+                  const bool* m = mask_data + row * dim;
+                  accscalar_t sum = 0;
+                  accscalar_t sum_sq = 0;
+                  for (int64_t d = 0; d < dim; ++d) {
+                    const accscalar_t x =
+                        accscalar_t(w[d]) + accscalar_t(pw[d]);
+                    sum += x;
+                    sum_sq += x * x;
+                  }
+                  const accscalar_t mean = sum / dim;
+                  const accscalar_t var =
+                      std::max(sum_sq / dim - mean * mean, accscalar_t(0));
+                  const accscalar_t rstd =
+                      accscalar_t(1) / std::sqrt(var + accscalar_t(eps));
+                  for (int64_t d = 0; d < dim; ++d) {
+                    const accscalar_t x =
+                        accscalar_t(w[d]) + accscalar_t(pw[d]);
+                    accscalar_t y = (x - mean) * rstd;
+                    if (gamma_data != nullptr) {
+                      y *= accscalar_t(gamma_data[d]);
+                    }
+                    if (beta_data != nullptr) {
+                      y += accscalar_t(beta_data[d]);
+                    }
+                    if (apply_dropout) {
+                      y = m[d] ? y * scale : accscalar_t(0);
+                    }
+                    out[d] = scalar_t(y);
+                  }
+                }
+              });
+            });
+      });
+
+  return std::make_tuple(std::move(output), std::move(mask));
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+
+namespace at {
+namespace native {
+
+// Shared argument validation for the CPU and CUDA implementations of
+// _fused_embedding_layer_norm_dropout.
+void check_fused_embedding_inputs(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const c10::optional<Tensor>& gamma,
+    const c10::optional<Tensor>& beta,
+    double p);
+
+} // namespace native
+} // namespace at
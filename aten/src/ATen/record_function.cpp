@@ -2,9 +2,13 @@
 #include <ATen/core/dispatch/Dispatcher.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/ThreadLocal.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/llvmMathExtras.h>
 #include <c10/util/overloaded.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <random>
 
@@ -700,6 +704,211 @@ void set_record_function_seed_for_testing(uint32_t seed) {
   LocalCallbackManager::get().seed(seed);
 }
 
+// ============================================================================
+// == Operator latency histograms =============================================
+// ============================================================================
+// Note [Operator latency histograms]
+// Kineto tracing records every event and is too expensive to leave enabled in
+// production, while sampling callbacks cannot answer tail latency questions.
+// The histogram observer splits the difference: each observed op costs one
+// steady_clock read in the start and end callbacks plus a single relaxed
+// atomic increment into a log-linear (HDR-style) histogram, and all
+// percentile math is deferred to snapshot time. Histograms are keyed by op
+// name and shared by all recording threads; each thread additionally caches
+// name -> histogram pointers so the hot path only takes the registry mutex
+// the first time it sees an op.
+
+namespace {
+
+class OpLatencyHistogram {
+ public:
+  // Eight sub-buckets per power of two keeps the relative error of a
+  // reported percentile below ~6%.
+  static constexpr uint64_t kSubBucketBits = 3;
+  static constexpr uint64_t kSubBucketMask = (1ULL << kSubBucketBits) - 1;
+  // Enough for every 64 bit nanosecond value; see bucketFor.
+  static constexpr size_t kNumBuckets = 512;
+
+  void record(uint64_t ns) {
+    buckets_[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  OperatorLatencyStats snapshot() const {
+    std::array<uint64_t, kNumBuckets> counts{};
+    uint64_t total = 0;
+    for (const auto i : c10::irange(kNumBuckets)) {
+      counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    OperatorLatencyStats stats;
+    stats.count = total;
+    if (total > 0) {
+      stats.p50_us = percentileUs(counts, total, 0.50);
+      stats.p90_us = percentileUs(counts, total, 0.90);
+      stats.p99_us = percentileUs(counts, total, 0.99);
+    }
+    return stats;
+  }
+
+  void reset() {
+    for (auto& bucket : buckets_) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  // Maps a nanosecond value to its log-linear bucket: values below
+  // 2^kSubBucketBits are stored exactly, larger values keep kSubBucketBits
+  // bits of mantissa below the leading bit.
+  static size_t bucketFor(uint64_t ns) {
+    const uint64_t msb = c10::llvm::Log2_64(ns | 1);
+    if (msb < kSubBucketBits) {
+      return static_cast<size_t>(ns);
+    }
+    const uint64_t sub = (ns >> (msb - kSubBucketBits)) & kSubBucketMask;
+    return static_cast<size_t>(
+        ((msb - kSubBucketBits + 1) << kSubBucketBits) | sub);
+  }
+
+  // Midpoint of a bucket, inverse of bucketFor.
+  static double bucketMidpointNs(size_t idx) {
+    if (idx < (1ULL << (kSubBucketBits + 1))) {
+      return static_cast<double>(idx);
+    }
+    const uint64_t msb = (idx >> kSubBucketBits) + kSubBucketBits - 1;
+    const uint64_t lo = ((1ULL << kSubBucketBits) | (idx & kSubBucketMask))
+        << (msb - kSubBucketBits);
+    return static_cast<double>(lo) +
+        0.5 * static_cast<double>(1ULL << (msb - kSubBucketBits));
+  }
+
+  static double percentileUs(
+      const std::array<uint64_t, kNumBuckets>& counts,
+      uint64_t total,
+      double q) {
+    const auto target = static_cast<uint64_t>(
+        std::ceil(q * static_cast<double>(total)));
+    uint64_t cumulative = 0;
+    for (const auto i : c10::irange(kNumBuckets)) {
+      cumulative += counts[i];
+      if (cumulative >= target) {
+        return bucketMidpointNs(i) / 1000.0;
+      }
+    }
+    return bucketMidpointNs(kNumBuckets - 1) / 1000.0;
+  }
+
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+};
+
+class OpLatencyRegistry {
+ public:
+  static OpLatencyRegistry& get() {
+    static OpLatencyRegistry registry;
+    return registry;
+  }
+
+  // Histograms are never erased, only reset, so the returned pointer stays
+  // valid and may be cached by the calling thread.
+  OpLatencyHistogram* histogramFor(const char* name) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& slot = histograms_[std::string(name)];
+    if (!slot) {
+      slot = std::make_unique<OpLatencyHistogram>();
+    }
+    return slot.get();
+  }
+
+  std::unordered_map<std::string, OperatorLatencyStats> snapshot() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    std::unordered_map<std::string, OperatorLatencyStats> result;
+    for (const auto& entry : histograms_) {
+      auto stats = entry.second->snapshot();
+      if (stats.count > 0) {
+        result.emplace(entry.first, stats);
+      }
+    }
+    return result;
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto& entry : histograms_) {
+      entry.second->reset();
+    }
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<OpLatencyHistogram>>
+      histograms_;
+};
+
+OpLatencyHistogram* localHistogramFor(const char* name) {
+  static thread_local ska::flat_hash_map<std::string, OpLatencyHistogram*>
+      cache;
+  auto& slot = cache[std::string(name)];
+  if (C10_UNLIKELY(slot == nullptr)) {
+    slot = OpLatencyRegistry::get().histogramFor(name);
+  }
+  return slot;
+}
+
+struct OpLatencyObserverContext : public ObserverContext {
+  std::chrono::steady_clock::time_point start_time_;
+  OpLatencyHistogram* histogram_{nullptr};
+};
+
+std::unique_ptr<ObserverContext> onOpLatencyStart(const RecordFunction& fn) {
+  auto ctx = std::make_unique<OpLatencyObserverContext>();
+  ctx->histogram_ = localHistogramFor(fn.name());
+  ctx->start_time_ = std::chrono::steady_clock::now();
+  return ctx;
+}
+
+void onOpLatencyEnd(const RecordFunction& fn, ObserverContext* ctx_ptr) {
+  const auto end_time = std::chrono::steady_clock::now();
+  auto* ctx = static_cast<OpLatencyObserverContext*>(ctx_ptr);
+  if (ctx == nullptr || ctx->histogram_ == nullptr) {
+    return;
+  }
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      end_time - ctx->start_time_)
+                      .count();
+  ctx->histogram_->record(static_cast<uint64_t>(std::max<int64_t>(ns, 0)));
+}
+
+thread_local CallbackHandle op_latency_callback_handle_ =
+    INVALID_CALLBACK_HANDLE;
+
+} // namespace
+
+void enableOperatorLatencyHistograms(bool enable) {
+  if (enable) {
+    if (op_latency_callback_handle_ == INVALID_CALLBACK_HANDLE) {
+      op_latency_callback_handle_ = addThreadLocalCallback(
+          RecordFunctionCallback(&onOpLatencyStart, &onOpLatencyEnd)
+              .scopes({RecordScope::FUNCTION}));
+    }
+  } else if (op_latency_callback_handle_ != INVALID_CALLBACK_HANDLE) {
+    removeCallback(op_latency_callback_handle_);
+    op_latency_callback_handle_ = INVALID_CALLBACK_HANDLE;
+  }
+}
+
+bool operatorLatencyHistogramsEnabled() {
+  return op_latency_callback_handle_ != INVALID_CALLBACK_HANDLE;
+}
+
+std::unordered_map<std::string, OperatorLatencyStats>
+getOperatorLatencyStats() {
+  return OpLatencyRegistry::get().snapshot();
+}
+
+void clearOperatorLatencyStats() {
+  OpLatencyRegistry::get().reset();
+}
+
 /* static */
 uint64_t RecordFunction::currentThreadId() {
   if (!current_thread_id_) {
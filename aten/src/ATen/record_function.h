@@ -11,6 +11,8 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace c10 {
 class TORCH_API OperatorHandle;
@@ -726,4 +728,41 @@ TORCH_API void set_record_function_tls_(const RecordFunctionTLS& tls);
 
 TORCH_API void set_record_function_seed_for_testing(uint32_t seed);
 
+// Aggregated latency snapshot for a single op, produced by
+// getOperatorLatencyStats; see Note [Operator latency histograms].
+struct TORCH_API OperatorLatencyStats {
+  uint64_t count{0};
+  double p50_us{0.0};
+  double p90_us{0.0};
+  double p99_us{0.0};
+};
+
+/**
+ * enableOperatorLatencyHistograms toggles the built-in per-operator latency
+ * histogram observer for the current thread (propagated across JIT
+ * continuations and async tasks like any thread local callback). Samples
+ * from all recording threads are aggregated into a single process-wide set
+ * of histograms keyed by op name.
+ */
+TORCH_API void enableOperatorLatencyHistograms(bool enable = true);
+
+/**
+ * operatorLatencyHistogramsEnabled returns whether the latency histogram
+ * observer is enabled on the current thread
+ */
+TORCH_API bool operatorLatencyHistogramsEnabled();
+
+/**
+ * getOperatorLatencyStats returns per-op count and latency percentiles
+ * accumulated since the last clearOperatorLatencyStats call; ops without
+ * samples are omitted
+ */
+TORCH_API std::unordered_map<std::string, OperatorLatencyStats>
+getOperatorLatencyStats();
+
+/**
+ * clearOperatorLatencyStats resets all accumulated latency histograms
+ */
+TORCH_API void clearOperatorLatencyStats();
+
 } // namespace at
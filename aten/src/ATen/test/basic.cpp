@@ -4,6 +4,7 @@
 #include <ATen/core/Reduction.h>
 #include <torch/cuda.h>
 #include <ATen/test/test_assert.h>
+#include <c10/core/InferenceMode.h>
 #include <c10/util/irange.h>
 #include <c10/util/CallOnce.h>
 
@@ -17,6 +18,7 @@ struct THFloatTensor;
 #include <sstream>
 #include <thread>
 #include <mutex>
+#include <vector>
 
 #define ASSERT_EQ_RESOLVED(X, Y) \
   {                              \
@@ -519,3 +521,63 @@ TEST(BasicTest, BasicStdTestCPU) {
   t3.join();
   t4.join();
 }
+
+TEST(BasicTest, ContentFingerprintCache) {
+  auto tensor = at::ones({4, 4});
+  auto* impl = tensor.unsafeGetTensorImpl();
+
+  // No fingerprint has been recorded yet.
+  ASSERT_FALSE(impl->content_fingerprint().has_value());
+
+  impl->set_content_fingerprint(0xDEADBEEFULL);
+  ASSERT_TRUE(impl->content_fingerprint().has_value());
+  ASSERT_EQ(*impl->content_fingerprint(), 0xDEADBEEFULL);
+
+  // Any in-place write bumps the version counter and invalidates the cache.
+  tensor.add_(1);
+  ASSERT_FALSE(impl->content_fingerprint().has_value());
+  impl->set_content_fingerprint(0xFEEDULL);
+  ASSERT_EQ(*impl->content_fingerprint(), 0xFEEDULL);
+
+  // Writing through a view invalidates the base's fingerprint too, since
+  // views share the base's version counter.
+  auto view = tensor.select(0, 0);
+  view.zero_();
+  ASSERT_FALSE(impl->content_fingerprint().has_value());
+
+  // Inference tensors have no version counter, so nothing is cached.
+  c10::InferenceMode guard;
+  auto inference_tensor = at::ones({4});
+  auto* inference_impl = inference_tensor.unsafeGetTensorImpl();
+  inference_impl->set_content_fingerprint(0x1234ULL);
+  ASSERT_FALSE(inference_impl->content_fingerprint().has_value());
+}
+
+TEST(BasicTest, MaskedSelectParallelPrefixSum) {
+  // Large enough to take the parallel (prefix-sum) masked_select path.
+  const int64_t numel = 100001;
+  auto self = at::randn({numel});
+  auto mask = self.gt(0.5);
+
+  auto selected = at::masked_select(self, mask);
+
+  std::vector<float> expected;
+  auto self_data = self.data_ptr<float>();
+  auto mask_data = mask.data_ptr<bool>();
+  for (const auto i : c10::irange(numel)) {
+    if (mask_data[i]) {
+      expected.push_back(self_data[i]);
+    }
+  }
+  ASSERT_EQ(selected.numel(), static_cast<int64_t>(expected.size()));
+  auto selected_data = selected.data_ptr<float>();
+  for (const auto i : c10::irange(selected.numel())) {
+    ASSERT_EQ(selected_data[i], expected[i]);
+  }
+
+  // Non-contiguous inputs also go through the parallel kernel.
+  auto self_2d = self.narrow(0, 0, 100000).view({400, 250}).t();
+  auto mask_2d = self_2d.gt(0.5);
+  ASSERT_TRUE(at::masked_select(self_2d, mask_2d)
+                  .equal(at::masked_select(self_2d.contiguous(), mask_2d.contiguous())));
+}
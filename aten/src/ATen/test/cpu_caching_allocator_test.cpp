@@ -41,6 +41,25 @@ TEST(CPUCachingAllocatorTest, check_alloc_inside_free_outside) {
   a.reset();
 }
 
+TEST(CPUCachingAllocatorTest, check_size_class_reuse) {
+  c10::CPUCachingAllocator caching_allocator;
+  void* ptr = caching_allocator.allocate(2000);
+  caching_allocator.free(ptr);
+  // 2000 and 2048 round up to the same power-of-two size class, so the
+  // cached block is reused even though the byte counts differ.
+  void* reused_ptr = caching_allocator.allocate(2048);
+  ASSERT_TRUE(ptr == reused_ptr);
+  caching_allocator.free(reused_ptr);
+}
+
+TEST(CPUCachingAllocatorTest, check_max_blocks_per_size_class) {
+  const size_t prev_max_blocks =
+      c10::CPUCachingAllocator::GetMaxBlocksPerSizeClass();
+  c10::CPUCachingAllocator::SetMaxBlocksPerSizeClass(4);
+  ASSERT_EQ(c10::CPUCachingAllocator::GetMaxBlocksPerSizeClass(), 4);
+  c10::CPUCachingAllocator::SetMaxBlocksPerSizeClass(prev_max_blocks);
+}
+
 int main(int argc, char* argv[]) {
 // At the moment caching allocator is only exposed to mobile cpu allocator.
 #ifdef C10_MOBILE
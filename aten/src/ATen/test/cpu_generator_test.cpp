@@ -5,6 +5,8 @@
 #include <ATen/CPUGeneratorImpl.h>
 #include <ATen/core/PhiloxRNGEngine.h>
 #include <c10/util/irange.h>
+#include <algorithm>
+#include <array>
 #include <thread>
 #include <limits>
 #include <random>
@@ -134,6 +136,42 @@ TEST(CPUGeneratorImpl, TestRNGForking) {
   ASSERT_EQ(target_value.sum().item<double>(), forked_value.sum().item<double>());
 }
 
+TEST(CPUGeneratorImpl, TestPhiloxEngineInputsReservation) {
+  // Test Description:
+  // Check that philox_engine_inputs hands out disjoint, 4-aligned
+  // counter ranges to concurrent callers without the generator mutex
+  auto gen = at::detail::createCPUGenerator();
+  auto cpu_gen = check_generator<CPUGeneratorImpl>(gen);
+  cpu_gen->set_current_seed(123);
+  constexpr int num_threads = 4;
+  constexpr int reservations_per_thread = 100;
+  constexpr uint64_t increment = 10; // rounds up to 12
+  std::array<std::array<uint64_t, reservations_per_thread>, num_threads> offsets;
+  auto thread_func = [&](int tid) {
+    for (const auto i : c10::irange(reservations_per_thread)) {
+      auto inputs = cpu_gen->philox_engine_inputs(increment);
+      ASSERT_EQ(inputs.first, 123);
+      offsets[tid][i] = inputs.second;
+    }
+  };
+  std::vector<std::thread> threads;
+  for (const auto tid : c10::irange(num_threads)) {
+    threads.emplace_back(thread_func, tid);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  std::vector<uint64_t> all_offsets;
+  for (const auto& per_thread : offsets) {
+    all_offsets.insert(all_offsets.end(), per_thread.begin(), per_thread.end());
+  }
+  std::sort(all_offsets.begin(), all_offsets.end());
+  for (const auto i : c10::irange(all_offsets.size())) {
+    ASSERT_EQ(all_offsets[i], i * 12);
+  }
+  ASSERT_EQ(cpu_gen->philox_offset_per_thread(), num_threads * reservations_per_thread * 12);
+}
+
 /**
  * Philox CPU Engine Tests
  */
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/DeferredLaunchBatcher.h>
+#include <c10/cuda/CUDAStream.h>
+
+TEST(DeferredLaunchTest, BatchesAndFlushesSegments) {
+  if (!at::cuda::is_available()) {
+    return;
+  }
+  // Captures require a non-default stream.
+  at::cuda::CUDAStream stream = at::cuda::getStreamFromPool();
+  at::cuda::CUDAStreamGuard guard(stream);
+
+  auto input = at::ones({64}, at::device(at::kCUDA));
+  at::cuda::DeferredLaunchBatcher batcher(/*flush_threshold=*/4);
+
+  ASSERT_FALSE(batcher.is_active());
+  ASSERT_EQ(at::cuda::DeferredLaunchBatcher::current(), nullptr);
+
+  batcher.begin();
+  ASSERT_TRUE(batcher.is_active());
+  ASSERT_EQ(at::cuda::DeferredLaunchBatcher::current(), &batcher);
+
+  // 10 ops with threshold 4: two segments auto-submitted by note_op, the
+  // remaining two ops submitted by the final flush.
+  for (int i = 0; i < 10; i++) {
+    input.add_(1);
+    batcher.note_op();
+    ASSERT_TRUE(batcher.is_active());
+  }
+  batcher.flush();
+  ASSERT_FALSE(batcher.is_active());
+  ASSERT_EQ(at::cuda::DeferredLaunchBatcher::current(), nullptr);
+  // flush() when inactive is a harmless no-op.
+  batcher.flush();
+
+  ASSERT_TRUE(input.cpu().equal(at::full({64}, 11.0)));
+
+  // A batcher is reusable for subsequent segments.
+  batcher.begin();
+  input.mul_(2);
+  batcher.note_op();
+  batcher.flush();
+  ASSERT_TRUE(input.cpu().equal(at::full({64}, 22.0)));
+}
+
+TEST(DeferredLaunchTest, ThreadLocalWrappers) {
+  if (!at::cuda::is_available()) {
+    return;
+  }
+  at::cuda::CUDAStream stream = at::cuda::getStreamFromPool();
+  at::cuda::CUDAStreamGuard guard(stream);
+
+  auto input = at::zeros({8}, at::device(at::kCUDA));
+
+  ASSERT_FALSE(at::cuda::deferredLaunchBatchActive());
+  // note/flush without an active batch are no-ops.
+  at::cuda::noteDeferredLaunchOp();
+  at::cuda::flushDeferredLaunchBatch();
+
+  at::cuda::beginDeferredLaunchBatch(/*flush_threshold=*/16);
+  ASSERT_TRUE(at::cuda::deferredLaunchBatchActive());
+  input.add_(3);
+  at::cuda::noteDeferredLaunchOp();
+  at::cuda::flushDeferredLaunchBatch();
+  ASSERT_FALSE(at::cuda::deferredLaunchBatchActive());
+
+  ASSERT_TRUE(input.cpu().equal(at::full({8}, 3.0)));
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/P2PCopyScheduler.h>
+#include <c10/cuda/CUDAFunctions.h>
+
+TEST(P2PCopyTest, CopiesAcrossDevicesWithStats) {
+  if (!at::cuda::is_available() || c10::cuda::device_count() < 2) {
+    return;
+  }
+  at::cuda::reset_p2p_copy_stats();
+
+  // Large enough to exercise the multi-channel split on direct routes.
+  auto src = at::randn({6 * 1024 * 1024}, at::device({at::kCUDA, 0}));
+  auto dst = at::empty({6 * 1024 * 1024}, at::device({at::kCUDA, 1}));
+  at::cuda::p2p_copy(dst, src);
+  c10::cuda::device_synchronize();
+  ASSERT_TRUE(dst.cpu().equal(src.cpu()));
+
+  const int64_t nbytes = src.numel() * src.element_size();
+  const auto stats = at::cuda::p2p_copy_stats();
+  ASSERT_EQ(stats.size(), 1u);
+  ASSERT_EQ(stats[0].src_device, 0);
+  ASSERT_EQ(stats[0].dst_device, 1);
+  ASSERT_EQ(stats[0].transfers, 1);
+  ASSERT_EQ(stats[0].direct_bytes + stats[0].staged_bytes, nbytes);
+
+  // The reverse direction is tracked as a separate link.
+  auto back = at::empty_like(src);
+  at::cuda::p2p_copy(back, dst);
+  c10::cuda::device_synchronize();
+  ASSERT_TRUE(back.cpu().equal(src.cpu()));
+  ASSERT_EQ(at::cuda::p2p_copy_stats().size(), 2u);
+
+  at::cuda::reset_p2p_copy_stats();
+  ASSERT_TRUE(at::cuda::p2p_copy_stats().empty());
+}
+
+TEST(P2PCopyTest, RejectsMismatchedArguments) {
+  if (!at::cuda::is_available() || c10::cuda::device_count() < 2) {
+    return;
+  }
+  auto src = at::randn({16}, at::device({at::kCUDA, 0}));
+  auto same_device = at::empty({16}, at::device({at::kCUDA, 0}));
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  ASSERT_ANY_THROW(at::cuda::p2p_copy(same_device, src));
+  auto wrong_shape = at::empty({8}, at::device({at::kCUDA, 1}));
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  ASSERT_ANY_THROW(at::cuda::p2p_copy(wrong_shape, src));
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/native/PointwisePipeline.h>
+
+using at::native::PointwisePipeline;
+
+TEST(PointwisePipelineTest, MatchesEagerChain) {
+  auto x = at::randn({128, 33});
+  auto expected = (x * 2.5 + 1.0).clamp(0.0, 1.0);
+  auto actual = PointwisePipeline(x).mul(2.5).add(1.0).clamp(0.0, 1.0).run();
+  ASSERT_TRUE(actual.equal(expected));
+}
+
+TEST(PointwisePipelineTest, AllStages) {
+  auto x = at::randn({1000});
+  auto expected =
+      (-((x.abs() * 0.5).clamp_min(0.1).clamp_max(0.9))) + 3.0;
+  auto actual =
+      PointwisePipeline(x).abs().mul(0.5).clamp_min(0.1).clamp_max(0.9).neg().add(
+          3.0).run();
+  ASSERT_TRUE(actual.equal(expected));
+}
+
+TEST(PointwisePipelineTest, EmptyPipelineCopies) {
+  auto x = at::randn({17});
+  auto y = PointwisePipeline(x).run();
+  ASSERT_TRUE(y.equal(x));
+  ASSERT_NE(y.data_ptr(), x.data_ptr());
+}
+
+TEST(PointwisePipelineTest, RunOut) {
+  auto x = at::randn({64}, at::kDouble);
+  auto out = at::empty({64}, at::kDouble);
+  PointwisePipeline(x).mul(-1.0).run_out(out);
+  ASSERT_TRUE(out.equal(-x));
+}
+
+TEST(PointwisePipelineTest, RejectsNonFloating) {
+  auto x = at::ones({4}, at::kInt);
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_ANY_THROW(PointwisePipeline{x});
+}
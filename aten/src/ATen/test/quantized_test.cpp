@@ -13,6 +13,9 @@
 #include <c10/core/ScalarType.h>
 #include <c10/util/irange.h>
 #include <ATen/quantized/Quantizer.h>
+#ifdef USE_FBGEMM
+#include <ATen/native/quantized/cpu/fbgemm_utils.h>
+#endif
 
 using namespace at;
 #ifndef ATEN_CPU_STATIC_DISPATCH
@@ -351,4 +354,93 @@ TEST(TestQTensor, TestArmVectorizedQuantizeDequantize) {
 }
 #endif // (__ARM_NEON__) || defined(__aarch64__)
 
+#ifdef USE_FBGEMM
+TEST(TestQTensor, DequantizedWeightCacheLRU) {
+  namespace cache = at::native::fbgemm_utils;
+  cache::ClearDequantizedWeightCache();
+  cache::SetDequantizedWeightCacheBudget(0);
+
+  int materialized = 0;
+  auto make = [&]() {
+    ++materialized;
+    return at::ones({4});
+  };
+  const char keys[4] = {};
+
+  // Disabled cache: nothing is materialized or stored.
+  ASSERT_FALSE(
+      cache::DequantizedWeightCacheLookup(&keys[0], 16, make).defined());
+  ASSERT_EQ(materialized, 0);
+
+  cache::SetDequantizedWeightCacheBudget(32);
+
+  // Miss materializes, hit does not.
+  ASSERT_TRUE(
+      cache::DequantizedWeightCacheLookup(&keys[0], 16, make).defined());
+  ASSERT_EQ(materialized, 1);
+  ASSERT_TRUE(
+      cache::DequantizedWeightCacheLookup(&keys[0], 16, make).defined());
+  ASSERT_EQ(materialized, 1);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 16);
+
+  // Second entry fills the budget; inserting a third evicts the least
+  // recently used one (keys[0], untouched since keys[1] went in).
+  cache::DequantizedWeightCacheLookup(&keys[1], 16, make);
+  ASSERT_EQ(materialized, 2);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 32);
+  cache::DequantizedWeightCacheLookup(&keys[2], 16, make);
+  ASSERT_EQ(materialized, 3);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 32);
+  cache::DequantizedWeightCacheLookup(&keys[0], 16, make);
+  ASSERT_EQ(materialized, 4);
+
+  // A weight over the whole budget is rejected before materializing.
+  ASSERT_FALSE(
+      cache::DequantizedWeightCacheLookup(&keys[3], 64, make).defined());
+  ASSERT_EQ(materialized, 4);
+
+  // Erase and budget shrink both release bytes.
+  cache::DequantizedWeightCacheErase(&keys[0]);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 16);
+  cache::SetDequantizedWeightCacheBudget(8);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 0);
+
+  cache::SetDequantizedWeightCacheBudget(0);
+  cache::ClearDequantizedWeightCache();
+}
+
+TEST(TestQTensor, DequantizedWeightCacheDynamicLinearFp16) {
+  if (!fbgemm::fbgemmSupportedCPU()) {
+    return;
+  }
+  namespace cache = at::native::fbgemm_utils;
+  cache::ClearDequantizedWeightCache();
+  cache::SetDequantizedWeightCacheBudget(0);
+
+  const Tensor weight = at::randn({8, 16});
+  const Tensor bias = at::randn({8});
+  const Tensor input = at::randn({4, 16});
+  auto packed = PackedLinearWeightFp16::prepack(weight, bias);
+
+  const Tensor expected = packed->apply_dynamic(input);
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 0);
+
+  cache::SetDequantizedWeightCacheBudget(1 << 20);
+  // First call populates the cache, second one is served from it; both
+  // must agree with the uncached fp16 path.
+  const Tensor populate = packed->apply_dynamic(input);
+  ASSERT_GT(cache::GetDequantizedWeightCacheBytes(), 0);
+  const Tensor hit = packed->apply_dynamic(input);
+  ASSERT_TRUE(at::allclose(expected, populate, /*rtol=*/1e-4, /*atol=*/1e-4));
+  ASSERT_TRUE(at::allclose(expected, hit, /*rtol=*/1e-4, /*atol=*/1e-4));
+
+  // Destroying the packed params drops their cache entry.
+  packed.reset();
+  ASSERT_EQ(cache::GetDequantizedWeightCacheBytes(), 0);
+
+  cache::SetDequantizedWeightCacheBudget(0);
+  cache::ClearDequantizedWeightCache();
+}
+#endif // USE_FBGEMM
+
 #endif // ATEN_CPU_STATIC_DISPATCH
@@ -2,6 +2,7 @@
 #include <thread>
 
 #include <ATen/ATen.h>
+#include <ATen/DataMovementAccounting.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
 
@@ -217,6 +218,41 @@ TEST(TensorIteratorTest, FailNonPromotingBinaryOp) {
   ASSERT_ANY_THROW(config.build());
 }
 
+TEST(TensorIteratorTest, DataMovementAccounting) {
+  auto x = at::randn({4, 4});
+  auto y = at::randn({4, 4});
+  at::DataMovementAccountingGuard guard;
+  auto z = x.add(y);
+  const auto& stats = guard.stats();
+  EXPECT_GE(stats.operator_calls, 1u);
+  // add reads both 64-byte float inputs and writes one 64-byte output.
+  EXPECT_GE(stats.bytes_read, 2u * 16 * sizeof(float));
+  EXPECT_GE(stats.bytes_written, 16 * sizeof(float));
+}
+
+TEST(TensorIteratorTest, DataMovementAccountingNested) {
+  auto x = at::randn({8});
+  at::DataMovementAccountingGuard outer;
+  auto before = outer.stats();
+  EXPECT_EQ(before.operator_calls, 0u);
+  {
+    at::DataMovementAccountingGuard inner;
+    x.mul(2.0);
+    EXPECT_GE(inner.stats().operator_calls, 1u);
+    // While the inner guard is active, the outer guard sees nothing.
+    EXPECT_EQ(outer.stats().operator_calls, 0u);
+  }
+  // The inner guard's totals fold into the outer guard on destruction.
+  EXPECT_GE(outer.stats().operator_calls, 1u);
+  EXPECT_GT(outer.stats().bytes_read, 0u);
+}
+
+TEST(TensorIteratorTest, DataMovementAccountingDisabled) {
+  // Without a guard, recording is a no-op rather than an error.
+  EXPECT_FALSE(at::DataMovementAccountingGuard::enabled());
+  at::DataMovementAccountingGuard::record(1, 1);
+}
+
 #define MULTIPLE_OUTPUTS_TEST_ITER_FOR_TYPE(ctype,name)                                             \
 TEST(TensorIteratorTest, CpuKernelMultipleOutputs_##name) {                                         \
   auto in1 = random_tensor_for_type(k##name);                                                       \
@@ -107,6 +107,34 @@ TEST(TestParallel, Exceptions) {
     std::runtime_error);
 }
 
+TEST(TestParallel, CalibratedGrainRecording) {
+  // A near-free probe clamps to the upper bound, an expensive probe to the
+  // lower one; both must land in the table reported by get_parallel_info().
+  auto cheap = at::internal::record_probed_grain("test_cheap", 4096, 1);
+  auto costly = at::internal::record_probed_grain("test_costly", 4096, 1LL << 40);
+  ASSERT_GT(cheap, costly);
+  ASSERT_GT(costly, 0);
+
+  auto info = at::get_parallel_info();
+  ASSERT_NE(info.find("test_cheap="), std::string::npos);
+  ASSERT_NE(info.find("test_costly="), std::string::npos);
+}
+
+TEST(TestParallel, ParallelForCalibratedCoversRange) {
+  // Every element must be visited exactly once, whether or not the probe
+  // path is taken (TORCH_GRAIN_CALIBRATION is environment-controlled).
+  std::vector<int> visits(10000, 0);
+  at::parallel_for_calibrated(
+      "test_cover", 0, 10000, 100, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          visits[i]++;
+        }
+      });
+  for (auto v : visits) {
+    ASSERT_EQ(v, 1);
+  }
+}
+
 TEST(TestParallel, IntraOpLaunchFuture) {
   int v1 = 0;
   int v2 = 0;
@@ -1031,6 +1031,31 @@ namespace {
         AssertVectorized<vcomplex>(NAME_INFO(complex imag), expected3, actual3).check();
         AssertVectorized<vcomplex>(NAME_INFO(complex conj), expected4, actual4).check();
     }
+    TEST(FastMathTests, FastExpTanhErfFloat) {
+        // The fast-math tier may trade 1-2 ulp against the precise ops; it
+        // must stay within these bounds on the ranges activation kernels
+        // feed it, and saturate sanely outside.
+        CACHE_ALIGN float out[vfloat::size()];
+        for (float x = -20.f; x <= 20.f; x += 0.00971f) {
+            vfloat v(x);
+            at::vec::fast_exp(v).store(out);
+            ASSERT_NEAR(out[0], std::exp(x), std::abs(std::exp(x)) * 1e-6)
+                << "fast_exp at " << x;
+            at::vec::fast_tanh(v).store(out);
+            ASSERT_NEAR(out[0], std::tanh(x), 1e-6) << "fast_tanh at " << x;
+            at::vec::fast_erf(v).store(out);
+            ASSERT_NEAR(out[0], std::erf(x), 1e-5) << "fast_erf at " << x;
+        }
+        at::vec::fast_exp(vfloat(1000.f)).store(out);
+        ASSERT_GT(out[0], 1e38f) << "fast_exp should not overflow to garbage";
+        at::vec::fast_exp(vfloat(-1000.f)).store(out);
+        ASSERT_GE(out[0], 0.f);
+        ASSERT_LT(out[0], 1e-37f);
+        at::vec::fast_tanh(vfloat(50.f)).store(out);
+        ASSERT_NEAR(out[0], 1.f, 1e-6);
+        at::vec::fast_tanh(vfloat(-50.f)).store(out);
+        ASSERT_NEAR(out[0], -1.f, 1e-6);
+    }
     TYPED_TEST(QuantizationTests, Quantize) {
         using vec = TypeParam;
         using underlying = ValueType<vec>;
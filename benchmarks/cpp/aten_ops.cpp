@@ -0,0 +1,168 @@
+// Kernel-level benchmarks for the hot ATen CPU paths: TensorIterator
+// elementwise loops, reductions, GEMM and copies. Runs without any Python
+// overhead so kernel regressions are visible directly.
+//
+// Emit machine-readable results with
+//   aten_ops_bench --benchmark_format=json --benchmark_out=results.json
+// and gate builds with benchmarks/cpp/compare_benchmarks.py.
+#include <ATen/ATen.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+
+namespace {
+
+// ---[ TensorIterator: elementwise
+
+void BM_add_contiguous(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  auto a = at::randn({numel});
+  auto b = at::randn({numel});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::add(a, b));
+  }
+  state.SetItemsProcessed(state.iterations() * numel);
+}
+
+void BM_add_strided(benchmark::State& state) {
+  // Transposed operands force TensorIterator off the contiguous fast path.
+  const int64_t n = state.range(0);
+  auto a = at::randn({n, n}).t();
+  auto b = at::randn({n, n}).t();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::add(a, b));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_add_broadcast(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  auto a = at::randn({n, n});
+  auto b = at::randn({n});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::add(a, b));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_mul_scalar(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  auto a = at::randn({numel});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::mul(a, 2.0));
+  }
+  state.SetItemsProcessed(state.iterations() * numel);
+}
+
+// ---[ Reductions
+
+void BM_sum_all(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  auto a = at::randn({numel});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::sum(a));
+  }
+  state.SetItemsProcessed(state.iterations() * numel);
+}
+
+void BM_sum_inner_dim(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  auto a = at::randn({n, n});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::sum(a, /*dim=*/1));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+void BM_sum_outer_dim(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  auto a = at::randn({n, n});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::sum(a, /*dim=*/0));
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// ---[ GEMM
+
+void BM_mm(benchmark::State& state) {
+  const int64_t m = state.range(0);
+  const int64_t k = state.range(1);
+  const int64_t n = state.range(2);
+  auto a = at::randn({m, k});
+  auto b = at::randn({k, n});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::mm(a, b));
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * m * k * n);
+}
+
+void BM_bmm(benchmark::State& state) {
+  const int64_t batch = state.range(0);
+  const int64_t n = state.range(1);
+  auto a = at::randn({batch, n, n});
+  auto b = at::randn({batch, n, n});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(at::bmm(a, b));
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * batch * n * n * n);
+}
+
+// ---[ Copies
+
+void BM_copy_contiguous(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  auto src = at::randn({numel});
+  auto dst = at::empty({numel});
+  for (auto _ : state) {
+    dst.copy_(src);
+  }
+  state.SetBytesProcessed(
+      state.iterations() * numel * static_cast<int64_t>(sizeof(float)));
+}
+
+void BM_copy_transposed(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  auto src = at::randn({n, n}).t();
+  auto dst = at::empty({n, n});
+  for (auto _ : state) {
+    dst.copy_(src);
+  }
+  state.SetBytesProcessed(
+      state.iterations() * n * n * static_cast<int64_t>(sizeof(float)));
+}
+
+void BM_copy_cast(benchmark::State& state) {
+  const int64_t numel = state.range(0);
+  auto src = at::randn({numel});
+  auto dst = at::empty({numel}, at::kHalf);
+  for (auto _ : state) {
+    dst.copy_(src);
+  }
+  state.SetBytesProcessed(
+      state.iterations() * numel * static_cast<int64_t>(sizeof(float)));
+}
+
+BENCHMARK(BM_add_contiguous)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_add_strided)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_add_broadcast)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_mul_scalar)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_sum_all)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_sum_inner_dim)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_sum_outer_dim)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_mm)
+    ->Args({64, 64, 64})
+    ->Args({256, 256, 256})
+    ->Args({1024, 1024, 1024})
+    ->Args({1, 4096, 4096}); // decode-style skinny GEMM
+BENCHMARK(BM_bmm)->Args({16, 64})->Args({16, 256});
+BENCHMARK(BM_copy_contiguous)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_copy_transposed)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK(BM_copy_cast)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+
+} // namespace
+
+int main(int argc, char** argv) {
+  c10::InferenceMode guard;
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
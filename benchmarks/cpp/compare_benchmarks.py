@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON result files and gate on regressions.
+
+Typical use with aten_ops_bench:
+
+    aten_ops_bench --benchmark_format=json --benchmark_out=baseline.json
+    # ... apply a change, rebuild ...
+    aten_ops_bench --benchmark_format=json --benchmark_out=contender.json
+    python benchmarks/cpp/compare_benchmarks.py baseline.json contender.json
+
+Exits non-zero when any benchmark present in both files slowed down by more
+than --threshold (relative real_time), so it can gate CI or internal builds.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for bench in data.get("benchmarks", []):
+        # Skip aggregate rows (mean/median/stddev) emitted with --benchmark_repetitions.
+        if bench.get("run_type") == "aggregate":
+            continue
+        results[bench["name"]] = bench["real_time"]
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="JSON results for the baseline build")
+    parser.add_argument("contender", help="JSON results for the new build")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown that counts as a regression (default: 0.05)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    contender = load_results(args.contender)
+
+    common = sorted(set(baseline) & set(contender))
+    if not common:
+        print("no common benchmarks between the two files", file=sys.stderr)
+        return 1
+
+    regressions = []
+    name_width = max(len(name) for name in common)
+    print(f"{'benchmark':<{name_width}}  {'baseline':>12}  {'contender':>12}  {'delta':>8}")
+    for name in common:
+        base = baseline[name]
+        cont = contender[name]
+        delta = (cont - base) / base if base else 0.0
+        marker = ""
+        if delta > args.threshold:
+            regressions.append((name, delta))
+            marker = "  <-- regression"
+        print(f"{name:<{name_width}}  {base:>12.1f}  {cont:>12.1f}  {delta:>+7.1%}{marker}")
+
+    only_base = set(baseline) - set(contender)
+    only_cont = set(contender) - set(baseline)
+    if only_base:
+        print(f"\nmissing from contender: {', '.join(sorted(only_base))}")
+    if only_cont:
+        print(f"new in contender: {', '.join(sorted(only_cont))}")
+
+    if regressions:
+        print(
+            f"\n{len(regressions)} benchmark(s) regressed more than "
+            f"{args.threshold:.0%}",
+            file=sys.stderr,
+        )
+        return 1
+    print(f"\nno regressions above {args.threshold:.0%}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+#
+# Measure TCPStore server throughput and rendezvous latency.
+#
+# Two phases:
+#   a) rendezvous: `--world-size` client processes connect to one server,
+#      publish their key, and wait() for everyone else's. This is the store
+#      traffic pattern of job start and is dominated by the server's event
+#      loop and wait-wakeup handling.
+#   b) throughput: a single client issues `--num-ops` set/get pairs so that
+#      per-request overhead can be compared across server implementations.
+#
+# Example:
+#   python benchmark.py --world-size 1024
+#
+
+import argparse
+import multiprocessing as mp
+import time
+from datetime import timedelta
+
+from torch.distributed import TCPStore
+
+
+def rendezvous_worker(rank, world_size, host, port, start_event, timeout):
+    store = TCPStore(
+        host,
+        port,
+        world_size,
+        is_master=False,
+        timeout=timedelta(seconds=timeout),
+        wait_for_workers=False,
+    )
+    start_event.wait()
+    store.set(f"rank{rank}", b"ok")
+    store.wait([f"rank{r}" for r in range(world_size)])
+
+
+def run_rendezvous(args, host, port):
+    start_event = mp.Event()
+    workers = [
+        mp.Process(
+            target=rendezvous_worker,
+            args=(rank, args.world_size, host, port, start_event, args.timeout),
+        )
+        for rank in range(args.world_size)
+    ]
+    for worker in workers:
+        worker.start()
+
+    # Time only the set/wait storm, not process spawn and connect.
+    start = time.perf_counter()
+    start_event.set()
+    for worker in workers:
+        worker.join()
+    elapsed = time.perf_counter() - start
+
+    failed = sum(worker.exitcode != 0 for worker in workers)
+    if failed:
+        raise RuntimeError(f"{failed} rendezvous workers failed")
+    print(f"rendezvous: {args.world_size} ranks in {elapsed:.3f}s")
+
+
+def run_throughput(args, host, port):
+    store = TCPStore(
+        host,
+        port,
+        args.world_size,
+        is_master=False,
+        timeout=timedelta(seconds=args.timeout),
+        wait_for_workers=False,
+    )
+    payload = b"x" * args.value_size
+
+    start = time.perf_counter()
+    for i in range(args.num_ops):
+        store.set(f"bench{i % 128}", payload)
+        store.get(f"bench{i % 128}")
+    elapsed = time.perf_counter() - start
+
+    ops = 2 * args.num_ops
+    print(
+        f"throughput: {ops} ops in {elapsed:.3f}s "
+        f"({ops / elapsed:.0f} ops/s, value size {args.value_size})"
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="TCPStore benchmark")
+    parser.add_argument("--world-size", type=int, default=128)
+    parser.add_argument("--num-ops", type=int, default=10000)
+    parser.add_argument("--value-size", type=int, default=64)
+    parser.add_argument("--timeout", type=int, default=300)
+    parser.add_argument("--port", type=int, default=0)
+    args = parser.parse_args()
+
+    host = "127.0.0.1"
+    server = TCPStore(
+        host,
+        args.port,
+        args.world_size,
+        is_master=True,
+        timeout=timedelta(seconds=args.timeout),
+        wait_for_workers=False,
+    )
+    port = server.port
+
+    run_throughput(args, host, port)
+    run_rendezvous(args, host, port)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2016-present, Facebook, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "c10/cuda/CUDAAllocatorTrace.h"
+#include "c10/cuda/CUDACachingAllocator.h"
+#include "c10/cuda/CUDAStream.h"
+#include "c10/util/Flags.h"
+#include "caffe2/core/init.h"
+#include "caffe2/core/logging.h"
+
+C10_DEFINE_string(trace, "", "Path to an allocator trace produced by "
+    "c10::cuda::CUDACachingAllocator::startAllocatorTraceDump.");
+C10_DEFINE_string(alloc_conf, "", "Allocator settings to replay against, in "
+    "PYTORCH_CUDA_ALLOC_CONF syntax (e.g. 'max_split_size_mb:128').");
+C10_DEFINE_int(device, 0, "CUDA device to replay the trace on.");
+
+namespace {
+
+using c10::cuda::CUDACachingAllocator::AllocatorTraceRecord;
+using c10::cuda::CUDACachingAllocator::TraceEntry;
+
+const char* action_name(uint8_t action) {
+  switch (static_cast<TraceEntry::Action>(action)) {
+    case TraceEntry::ALLOC:
+      return "ALLOC";
+    case TraceEntry::FREE_REQUESTED:
+      return "FREE_REQUESTED";
+    case TraceEntry::FREE_COMPLETED:
+      return "FREE_COMPLETED";
+    case TraceEntry::SEGMENT_ALLOC:
+      return "SEGMENT_ALLOC";
+    case TraceEntry::SEGMENT_FREE:
+      return "SEGMENT_FREE";
+    case TraceEntry::SEGMENT_MAP:
+      return "SEGMENT_MAP";
+    case TraceEntry::SEGMENT_UNMAP:
+      return "SEGMENT_UNMAP";
+    case TraceEntry::SNAPSHOT:
+      return "SNAPSHOT";
+    case TraceEntry::OOM:
+      return "OOM";
+  }
+  return "UNKNOWN";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  caffe2::GlobalInit(&argc, &argv);
+  c10::SetUsageMessage(
+      "Replays a captured CUDA caching allocator trace against the live "
+      "allocator and reports peak/fragmentation stats, so allocator policies "
+      "can be tuned offline without re-running the original workload.");
+
+  CAFFE_ENFORCE(!FLAGS_trace.empty(), "--trace is required");
+
+  namespace alloc = c10::cuda::CUDACachingAllocator;
+
+  if (!FLAGS_alloc_conf.empty()) {
+    alloc::setAllocatorSettings(FLAGS_alloc_conf);
+  }
+  C10_CUDA_CHECK(cudaSetDevice(FLAGS_device));
+  alloc::init(FLAGS_device + 1);
+
+  FILE* file = fopen(FLAGS_trace.c_str(), "rb");
+  CAFFE_ENFORCE(file != nullptr, "Could not open trace file ", FLAGS_trace);
+  char magic[alloc::kAllocatorTraceMagicLen];
+  CAFFE_ENFORCE(
+      fread(magic, sizeof(magic), 1, file) == 1 &&
+          memcmp(magic, alloc::kAllocatorTraceMagic, sizeof(magic)) == 0,
+      "Not an allocator trace file: ",
+      FLAGS_trace);
+
+  // Map the dense stream ids from the trace onto live streams. Id 0 is the
+  // first stream the traced workload touched (typically the default stream);
+  // every further id gets its own stream from the pool so that cross-stream
+  // allocation patterns keep their block-reuse constraints during replay.
+  std::vector<cudaStream_t> streams;
+  streams.push_back(c10::cuda::getDefaultCUDAStream(FLAGS_device).stream());
+
+  // Live pointer for each traced address. Frees for addresses we never saw
+  // allocated (blocks predating the capture) are counted and skipped.
+  std::unordered_map<int64_t, void*> live;
+
+  size_t num_records = 0;
+  size_t num_allocs = 0;
+  size_t num_frees = 0;
+  size_t num_unmatched_frees = 0;
+  size_t num_ooms = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  AllocatorTraceRecord record;
+  while (fread(&record, sizeof(record), 1, file) == 1) {
+    ++num_records;
+    switch (static_cast<TraceEntry::Action>(record.action)) {
+      case TraceEntry::ALLOC: {
+        while (record.stream_id >= streams.size()) {
+          streams.push_back(
+              c10::cuda::getStreamFromPool(false, FLAGS_device).stream());
+        }
+        try {
+          live[record.addr] = alloc::raw_alloc_with_stream(
+              record.size, streams[record.stream_id]);
+        } catch (const c10::Error&) {
+          // The replay device is smaller than the capture device (or the
+          // allocator variant fragments harder); record and carry on.
+          ++num_ooms;
+          break;
+        }
+        ++num_allocs;
+        break;
+      }
+      case TraceEntry::FREE_REQUESTED: {
+        auto it = live.find(record.addr);
+        if (it == live.end()) {
+          ++num_unmatched_frees;
+          break;
+        }
+        alloc::raw_delete(it->second);
+        live.erase(it);
+        ++num_frees;
+        break;
+      }
+      default:
+        // Segment events, snapshots and OOMs are outcomes of allocator
+        // policy, not inputs to it; the replayed allocator produces its own.
+        break;
+    }
+  }
+  fclose(file);
+
+  const auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start);
+
+  const auto stats = alloc::getDeviceStats(FLAGS_device);
+  const auto agg = static_cast<size_t>(alloc::StatType::AGGREGATE);
+  const int64_t peak_allocated = stats.allocated_bytes[agg].peak;
+  const int64_t peak_reserved = stats.reserved_bytes[agg].peak;
+
+  LOG(INFO) << "Replayed " << num_records << " records in " << elapsed.count()
+            << " s (" << num_allocs << " allocs, " << num_frees << " frees, "
+            << num_unmatched_frees << " unmatched frees, " << num_ooms
+            << " replay OOMs)";
+  LOG(INFO) << "Peak allocated: " << alloc::format_size(peak_allocated);
+  LOG(INFO) << "Peak reserved:  " << alloc::format_size(peak_reserved);
+  if (peak_reserved > 0) {
+    LOG(INFO) << "Peak fragmentation overhead: "
+              << 100.0 * (1.0 - static_cast<double>(peak_allocated) /
+                                    static_cast<double>(peak_reserved))
+              << "%";
+  }
+  LOG(INFO) << "cudaMalloc retries: " << stats.num_alloc_retries
+            << ", allocator OOMs: " << stats.num_ooms;
+
+  // Leave the device clean in case this runs under a leak checker.
+  for (auto& kv : live) {
+    alloc::raw_delete(kv.second);
+  }
+  alloc::emptyCache();
+  return 0;
+}
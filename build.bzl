@@ -33,6 +33,7 @@ def define_targets(rules):
         name = "caffe2_serialize",
         srcs = [
             "caffe2/serialize/file_adapter.cc",
+            "caffe2/serialize/mmap_adapter.cc",
             "caffe2/serialize/inline_container.cc",
             "caffe2/serialize/istream_adapter.cc",
             "caffe2/serialize/read_adapter_interface.cc",
@@ -142,6 +142,9 @@ libtorch_profiler_sources = [
     "torch/csrc/profiler/standalone/execution_graph_observer.cpp",
     "torch/csrc/profiler/standalone/itt_observer.cpp",
     "torch/csrc/profiler/standalone/nvtx_observer.cpp",
+    "torch/csrc/profiler/standalone/sampling_profiler.cpp",
+    "torch/csrc/profiler/standalone/shm_track_observer.cpp",
+    "torch/csrc/profiler/standalone/trace_stream_observer.cpp",
     "torch/csrc/profiler/stubs/base.cpp",
     "torch/csrc/profiler/orchestration/vulkan.cpp",
     "torch/csrc/profiler/perf.cpp",
@@ -167,6 +170,7 @@ core_trainer_sources = [
     "torch/csrc/autograd/functions/utils.cpp",
     "torch/csrc/autograd/input_buffer.cpp",
     "torch/csrc/autograd/record_function_ops.cpp",
+    "torch/csrc/autograd/cpu_offload_saved_variable_hooks.cpp",
     "torch/csrc/autograd/saved_variable.cpp",
     "torch/csrc/autograd/variable.cpp",
     "torch/csrc/autograd/utils/warnings.cpp",
@@ -214,6 +218,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/frontend/builtin_functions.cpp",
     "torch/csrc/jit/frontend/versioned_symbols.cpp",
     "torch/csrc/jit/frontend/canonicalize_modified_loop.cpp",
+    "torch/csrc/jit/frontend/compilation_cache.cpp",
     "torch/csrc/jit/frontend/convert_to_ssa.cpp",
     "torch/csrc/jit/frontend/exit_transforms.cpp",
     "torch/csrc/jit/frontend/inline_loop_condition.cpp",
@@ -248,6 +253,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/passes/batch_mm.cpp",
     "torch/csrc/jit/passes/canonicalize.cpp",
     "torch/csrc/jit/passes/canonicalize_graph_fuser_ops.cpp",
+    "torch/csrc/jit/passes/channels_last_propagation.cpp",
     "torch/csrc/jit/passes/clear_profiling.cpp",
     "torch/csrc/jit/passes/clear_undefinedness.cpp",
     "torch/csrc/jit/passes/common_subexpression_elimination.cpp",
@@ -285,10 +291,12 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/passes/lower_grad_of.cpp",
     "torch/csrc/jit/passes/lower_tuples.cpp",
     "torch/csrc/jit/passes/normalize_ops.cpp",
+    "torch/csrc/jit/passes/parallelize_branches.cpp",
     "torch/csrc/jit/passes/peephole_dict_idioms.cpp",
     "torch/csrc/jit/passes/peephole_list_idioms.cpp",
     "torch/csrc/jit/passes/value_refinement_utils.cpp",
     "torch/csrc/jit/passes/peephole_alias_sensitive.cpp",
+    "torch/csrc/jit/passes/pass_instrumentation.cpp",
     "torch/csrc/jit/passes/pass_manager.cpp",
     "torch/csrc/jit/passes/peephole.cpp",
     "torch/csrc/jit/passes/peephole_non_tensor.cpp",
@@ -299,6 +307,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/passes/fold_conv_bn.cpp",
     "torch/csrc/jit/passes/fold_linear_bn.cpp",
     "torch/csrc/jit/passes/dbr_quantization/remove_redundant_aliases.cpp",
+    "torch/csrc/jit/passes/frozen_auto_layout.cpp",
     "torch/csrc/jit/passes/frozen_concat_linear.cpp",
     "torch/csrc/jit/passes/frozen_conv_add_relu_fusion.cpp",
     "torch/csrc/jit/passes/frozen_conv_folding.cpp",
@@ -346,6 +355,7 @@ core_sources_full_mobile_no_backend_interface_xplat = [
     "torch/csrc/jit/runtime/interpreter.cpp",
     "torch/csrc/jit/runtime/logging.cpp",
     "torch/csrc/jit/runtime/simple_graph_executor_impl.cpp",
+    "torch/csrc/jit/runtime/plan_serialization.cpp",
     "torch/csrc/jit/runtime/profiling_graph_executor_impl.cpp",
     "torch/csrc/jit/runtime/profiling_record.cpp",
     "torch/csrc/jit/runtime/script_profile.cpp",
@@ -993,6 +1003,7 @@ aten_cpu_source_non_codegen_list = [
     "aten/src/ATen/ParallelNativeTBB.cpp",
     "aten/src/ATen/ParallelOpenMP.cpp",
     "aten/src/ATen/ParallelThreadPoolNative.cpp",
+    "aten/src/ATen/PreForkInit.cpp",
     "aten/src/ATen/PythonTorchFunctionTLS.cpp",
     "aten/src/ATen/ThreadLocalPythonObjects.cpp",
     "aten/src/ATen/ScalarOps.cpp",
@@ -1044,6 +1055,7 @@ aten_cpu_source_non_codegen_list = [
     "aten/src/ATen/core/tensor_type.cpp",
     "aten/src/ATen/core/union_type.cpp",
     "aten/src/ATen/cpu/FlushDenormal.cpp",
+    "aten/src/ATen/cpu/PrecisionMode.cpp",
     "aten/src/ATen/detail/CPUGuardImpl.cpp",
     "aten/src/ATen/metal/Context.cpp",
     "aten/src/ATen/native/AutogradComposite.cpp",
@@ -1128,6 +1140,7 @@ aten_native_source_codegen_list = [
     "aten/src/ATen/native/cpu/MultinomialKernel.cpp",
     "aten/src/ATen/native/cpu/PixelShuffleKernel.cpp",
     "aten/src/ATen/native/cpu/PointwiseOpsKernel.cpp",
+    "aten/src/ATen/native/cpu/PointwisePipelineKernel.cpp",
     "aten/src/ATen/native/cpu/PowKernel.cpp",
     "aten/src/ATen/native/cpu/RangeFactoriesKernel.cpp",
     "aten/src/ATen/native/cpu/ReduceAllOpsKernel.cpp",
@@ -1155,6 +1168,7 @@ aten_native_source_codegen_list = [
     "aten/src/ATen/native/cpu/SampledAddmmKernel.cpp",
     "aten/src/ATen/native/cpu/SpmmReduceKernel.cpp",
     "aten/src/ATen/native/cpu/SparseFactories.cpp",
+    "aten/src/ATen/native/quantized/cpu/kernels/QuantizedInt4LinearKernels.cpp",
     "aten/src/ATen/native/quantized/cpu/kernels/QuantizedOpKernels.cpp",
 ]
 
@@ -1191,6 +1205,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/quantized/cpu/qhardsigmoid.cpp",
     "aten/src/ATen/native/quantized/cpu/qhardswish.cpp",
     "aten/src/ATen/native/quantized/cpu/qlinear.cpp",
+    "aten/src/ATen/native/quantized/cpu/qlinear_int4.cpp",
     "aten/src/ATen/native/quantized/cpu/qlinear_dynamic.cpp",
     "aten/src/ATen/native/quantized/cpu/qconv_dynamic.cpp",
     "aten/src/ATen/native/quantized/cpu/qlinear_prepack.cpp",
@@ -1298,6 +1313,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/PackedSequence.cpp",
     "aten/src/ATen/native/PixelShuffle.cpp",
     "aten/src/ATen/native/PointwiseOps.cpp",
+    "aten/src/ATen/native/PointwisePipeline.cpp",
     "aten/src/ATen/native/Pooling.cpp",
     "aten/src/ATen/native/Pow.cpp",
     "aten/src/ATen/native/QuantizedLinear.cpp",
@@ -1376,6 +1392,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/sparse/SparseBinaryOpIntersectionKernel.cpp",
     "aten/src/ATen/native/sparse/FlattenIndicesKernel.cpp",
     "aten/src/ATen/native/transformers/attention.cpp",
+    "aten/src/ATen/native/transformers/fused_embedding.cpp",
     "aten/src/ATen/native/transformers/transformer.cpp",
     "aten/src/ATen/native/xnnpack/Activation.cpp",
     "aten/src/ATen/native/xnnpack/ChannelShuffle.cpp",
@@ -1419,6 +1436,7 @@ aten_cuda_cu_source_list = [
     "aten/src/ATen/native/cuda/TensorTopK.cpp",
     "aten/src/ATen/native/cuda/jit_utils.cpp",
     "aten/src/ATen/native/nested/cuda/NestedTensorTransformerFunctions.cpp",
+    "aten/src/ATen/native/sparse/cuda/cuSPARSELtOps.cpp",
     "aten/src/ATen/native/sparse/cuda/SparseBlas.cpp",
     "aten/src/ATen/native/sparse/cuda/SparseBlasImpl.cpp",
     "aten/src/ATen/native/sparse/cuda/SparseBlasLegacy.cpp",
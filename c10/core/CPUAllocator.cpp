@@ -7,6 +7,12 @@
 #include <c10/mobile/CPUProfilingAllocator.h>
 #include <c10/util/Logging.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
 // TODO: rename flag to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -15,9 +21,191 @@ C10_DEFINE_bool(
 
 namespace c10 {
 
+namespace {
+
+// Opt-in thread-local arena for small CPU allocations, enabled with
+// TORCH_CPU_SMALL_ALLOC_ARENA=1.  Workloads that allocate thousands of tiny
+// tensors per step (e.g. transformer decode loops) otherwise pay a
+// posix_memalign/free round trip per tensor.  Blocks up to
+// kSmallAllocThreshold bytes are rounded up to a power-of-two size class and
+// recycled through a per-thread free list instead of being returned to the
+// system.
+//
+// Every arena allocation carries a gAlignment-sized header holding the
+// rounded block size, so the deleter can route a pointer back to its size
+// class without a lookup table; freeing on a different thread than the one
+// that allocated simply migrates the block to the freeing thread's lists.
+constexpr size_t kSmallAllocThreshold = 4096;
+constexpr size_t kMinSmallAlloc = gAlignment;
+constexpr size_t kNumSizeClasses = 7; // 64B .. 4KB, power-of-two steps
+constexpr size_t kMaxBlocksPerClass = 64;
+
+bool small_alloc_arena_enabled() {
+  static bool enabled = []() {
+    auto env = getenv("TORCH_CPU_SMALL_ALLOC_ARENA");
+    return env && env[0] == '1' && env[1] == '\0';
+  }();
+  return enabled;
+}
+
+size_t size_class_index(size_t rounded) {
+  size_t idx = 0;
+  for (size_t sz = kMinSmallAlloc; sz < rounded; sz <<= 1) {
+    ++idx;
+  }
+  return idx;
+}
+
+struct SmallAllocArena {
+  std::array<std::vector<void*>, kNumSizeClasses> free_lists;
+
+  ~SmallAllocArena() {
+    for (auto& list : free_lists) {
+      for (void* data : list) {
+        free_cpu(static_cast<uint8_t*>(data) - gAlignment);
+      }
+    }
+  }
+
+  // Returns the user pointer (header already initialized), or nullptr if
+  // the size class is empty.
+  void* try_allocate(size_t rounded) {
+    auto& list = free_lists[size_class_index(rounded)];
+    if (list.empty()) {
+      return nullptr;
+    }
+    void* data = list.back();
+    list.pop_back();
+    return data;
+  }
+
+  // Takes ownership of the block; returns false if the free list is full
+  // and the caller should release the block to the system.
+  bool recycle(void* data, size_t rounded) {
+    auto& list = free_lists[size_class_index(rounded)];
+    if (list.size() >= kMaxBlocksPerClass) {
+      return false;
+    }
+    list.push_back(data);
+    return true;
+  }
+};
+
+SmallAllocArena& small_alloc_arena() {
+  static thread_local SmallAllocArena arena;
+  return arena;
+}
+
+size_t round_up_size_class(size_t nbytes) {
+  size_t rounded = kMinSmallAlloc;
+  while (rounded < nbytes) {
+    rounded <<= 1;
+  }
+  return rounded;
+}
+
+// When the arena is enabled every allocation (small or not) carries the
+// size header, so a single deleter can tell recyclable blocks apart from
+// large ones.
+void* arena_alloc(size_t nbytes) {
+  const bool small = nbytes <= kSmallAllocThreshold;
+  const size_t rounded = small ? round_up_size_class(nbytes) : nbytes;
+  if (small) {
+    if (void* data = small_alloc_arena().try_allocate(rounded)) {
+      return data;
+    }
+  }
+  void* base = c10::alloc_cpu(gAlignment + rounded);
+  *static_cast<size_t*>(base) = rounded;
+  return static_cast<uint8_t*>(base) + gAlignment;
+}
+
+void arena_free(void* data) {
+  void* base = static_cast<uint8_t*>(data) - gAlignment;
+  const size_t rounded = *static_cast<size_t*>(base);
+  if (rounded <= kSmallAllocThreshold &&
+      small_alloc_arena().recycle(data, rounded)) {
+    return;
+  }
+  free_cpu(base);
+}
+
+// Slab size for WithTemporaryAllocator arenas.  Big enough that typical
+// composite-op scopes fit in one slab, small enough that an escaped
+// tensor pinning a slab is not a disaster.
+constexpr size_t kTemporarySlabBytes = size_t(1) << 20; // 1 MiB
+
+} // namespace
+
+// Backing store for WithTemporaryAllocator (see CPUAllocator.h).  The
+// arena is reference counted: the guard holds one reference and every
+// live allocation holds one, so the slabs are freed wholesale by
+// whichever of "guard exits" and "last allocation dies" happens second.
+// Slabs are only appended on the owning thread while the guard is in
+// scope; deleters running on other threads never touch them, they just
+// drop a reference.
+struct TemporaryAllocArena {
+  // +1 for the guard itself
+  std::atomic<size_t> outstanding{1};
+  std::vector<void*> slabs;
+  size_t offset = 0; // bump position within slabs.back()
+  size_t capacity = 0; // usable bytes of slabs.back()
+
+  ~TemporaryAllocArena() {
+    for (void* slab : slabs) {
+      free_cpu(slab);
+    }
+  }
+
+  void* allocate(size_t nbytes) {
+    // Every block carries a gAlignment-sized header pointing back at
+    // its arena so that a single shared deleter can route the free
+    // (the same trick the small alloc arena above plays with sizes).
+    const size_t needed =
+        gAlignment + ((nbytes + gAlignment - 1) & ~(gAlignment - 1));
+    if (needed > capacity - offset) {
+      const size_t slab_bytes = std::max(needed, kTemporarySlabBytes);
+      slabs.push_back(c10::alloc_cpu(slab_bytes));
+      offset = 0;
+      capacity = slab_bytes;
+    }
+    uint8_t* base = static_cast<uint8_t*>(slabs.back()) + offset;
+    offset += needed;
+    *reinterpret_cast<TemporaryAllocArena**>(base) = this;
+    outstanding.fetch_add(1, std::memory_order_relaxed);
+    return base + gAlignment;
+  }
+
+  static void release(TemporaryAllocArena* arena) {
+    if (arena->outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete arena;
+    }
+  }
+};
+
+namespace {
+thread_local TemporaryAllocArena* temporary_arena_ptr{nullptr};
+} // namespace
+
+WithTemporaryAllocator::WithTemporaryAllocator() : prev_(temporary_arena_ptr) {
+  arena_ = new TemporaryAllocArena();
+  temporary_arena_ptr = arena_;
+}
+
+WithTemporaryAllocator::~WithTemporaryAllocator() {
+  temporary_arena_ptr = prev_;
+  TemporaryAllocArena::release(arena_);
+}
+
 struct C10_API DefaultCPUAllocator final : at::Allocator {
   DefaultCPUAllocator() = default;
   at::DataPtr allocate(size_t nbytes) const override {
+    if (C10_UNLIKELY(temporary_arena_ptr != nullptr)) {
+      return temporary_allocate(nbytes);
+    }
+    if (C10_UNLIKELY(small_alloc_arena_enabled())) {
+      return arena_allocate(nbytes);
+    }
     void* data = nullptr;
     try {
       data = c10::alloc_cpu(nbytes);
@@ -29,6 +217,42 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
     return {data, data, &ReportAndDelete, at::Device(at::DeviceType::CPU)};
   }
 
+  static at::DataPtr arena_allocate(size_t nbytes) {
+    if (nbytes == 0) {
+      return {
+          nullptr, nullptr, &ArenaReportAndDelete, at::Device(at::DeviceType::CPU)};
+    }
+    void* data = nullptr;
+    try {
+      data = arena_alloc(nbytes);
+    } catch (c10::Error& e) {
+      profiledCPUMemoryReporter().OutOfMemory(nbytes);
+      throw e;
+    }
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {data, data, &ArenaReportAndDelete, at::Device(at::DeviceType::CPU)};
+  }
+
+  static at::DataPtr temporary_allocate(size_t nbytes) {
+    if (nbytes == 0) {
+      return {
+          nullptr,
+          nullptr,
+          &TemporaryReportAndDelete,
+          at::Device(at::DeviceType::CPU)};
+    }
+    void* data = nullptr;
+    try {
+      data = temporary_arena_ptr->allocate(nbytes);
+    } catch (c10::Error& e) {
+      profiledCPUMemoryReporter().OutOfMemory(nbytes);
+      throw e;
+    }
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {
+        data, data, &TemporaryReportAndDelete, at::Device(at::DeviceType::CPU)};
+  }
+
   static void ReportAndDelete(void* ptr) {
     if (!ptr) {
       return;
@@ -37,7 +261,31 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
     free_cpu(ptr);
   }
 
+  static void ArenaReportAndDelete(void* ptr) {
+    if (!ptr) {
+      return;
+    }
+    profiledCPUMemoryReporter().Delete(ptr);
+    arena_free(ptr);
+  }
+
+  static void TemporaryReportAndDelete(void* ptr) {
+    if (!ptr) {
+      return;
+    }
+    profiledCPUMemoryReporter().Delete(ptr);
+    auto* arena = *reinterpret_cast<TemporaryAllocArena**>(
+        static_cast<uint8_t*>(ptr) - gAlignment);
+    TemporaryAllocArena::release(arena);
+  }
+
   at::DeleterFnPtr raw_deleter() const override {
+    if (C10_UNLIKELY(temporary_arena_ptr != nullptr)) {
+      return &TemporaryReportAndDelete;
+    }
+    if (C10_UNLIKELY(small_alloc_arena_enabled())) {
+      return &ArenaReportAndDelete;
+    }
     return &ReportAndDelete;
   }
 };
@@ -47,6 +47,44 @@ C10_API at::Allocator* GetDefaultCPUAllocator();
 // Get the Default Mobile CPU Allocator
 C10_API at::Allocator* GetDefaultMobileCPUAllocator();
 
+// Defined in CPUAllocator.cpp.
+struct TemporaryAllocArena;
+
+// Scoped bump allocator for short-lived intermediates.  While a
+// WithTemporaryAllocator guard is alive, CPU allocations made on this
+// thread are carved out of large arena slabs with a pointer bump, and
+// freeing an allocation costs a single atomic decrement instead of a
+// trip through the system allocator.  The slabs themselves are released
+// wholesale once the guard has been destroyed and the last allocation
+// made under it has died.  This is aimed at composite kernels that
+// build up (and promptly drop) many small intermediates per call:
+//
+//   {
+//     c10::WithTemporaryAllocator temporary_allocator;
+//     ... compute with short-lived tensors ...
+//   }  // slabs returned to the system here
+//
+// Tensors that escape the scope stay valid -- they keep their arena
+// alive until they die -- but they pin the slab they live in, so the
+// guard should only cover regions whose allocations are expected to be
+// dropped within the scope.  Guards nest; the inner guard's arena wins
+// until it exits.  Memory inside a slab is never recycled, so this is
+// unsuitable for long-running scopes.  Only the non-mobile default CPU
+// allocator consults the guard; it is inert on mobile builds and for
+// other device types.
+class C10_API WithTemporaryAllocator {
+ public:
+  WithTemporaryAllocator();
+  ~WithTemporaryAllocator();
+  WithTemporaryAllocator(const WithTemporaryAllocator&) = delete;
+  WithTemporaryAllocator& operator=(const WithTemporaryAllocator&) = delete;
+
+ private:
+  TemporaryAllocArena* arena_;
+  // arena of the enclosing guard (if any), restored on exit
+  TemporaryAllocArena* prev_;
+};
+
 // The CPUCachingAllocator is experimental and might disappear in the future.
 // The only place that uses it is in StaticRuntime.
 // Set the CPU Caching Allocator
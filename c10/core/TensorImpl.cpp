@@ -75,6 +75,62 @@ void TensorImpl::_set_fw_grad(
 
 TensorImpl::~TensorImpl() = default;
 
+namespace {
+
+// Per-thread freelist backing TensorImpl::operator new/delete.  Free
+// blocks form an intrusive singly-linked list threaded through the
+// blocks themselves, so the hot path is a couple of pointer moves and
+// the thread_local state is trivially destructible -- a TensorImpl
+// destroyed during thread shutdown (e.g. one owned by another
+// thread_local) can still be freed safely after the reaper below has
+// drained the list and closed it.
+thread_local void* tensor_impl_free_list = nullptr;
+thread_local size_t tensor_impl_free_list_size = 0;
+thread_local bool tensor_impl_free_list_closed = false;
+constexpr size_t kTensorImplFreeListMaxSize = 256;
+
+struct TensorImplFreeListReaper {
+  ~TensorImplFreeListReaper() {
+    tensor_impl_free_list_closed = true;
+    while (tensor_impl_free_list != nullptr) {
+      void* next = *static_cast<void**>(tensor_impl_free_list);
+      ::operator delete(tensor_impl_free_list);
+      tensor_impl_free_list = next;
+    }
+    tensor_impl_free_list_size = 0;
+  }
+};
+
+} // namespace
+
+static_assert(
+    alignof(TensorImpl) <= alignof(std::max_align_t),
+    "TensorImpl freelist blocks use default-aligned storage");
+
+void* TensorImpl::operator new(std::size_t nbytes) {
+  if (nbytes == sizeof(TensorImpl) && tensor_impl_free_list != nullptr) {
+    void* block = tensor_impl_free_list;
+    tensor_impl_free_list = *static_cast<void**>(block);
+    tensor_impl_free_list_size--;
+    return block;
+  }
+  return ::operator new(nbytes);
+}
+
+void TensorImpl::operator delete(void* ptr, std::size_t nbytes) {
+  if (nbytes == sizeof(TensorImpl) && !tensor_impl_free_list_closed &&
+      tensor_impl_free_list_size < kTensorImplFreeListMaxSize) {
+    // The reaper is instantiated on the first pooled free, so it is
+    // destroyed before the trivially destructible list state above.
+    static thread_local TensorImplFreeListReaper reaper;
+    *static_cast<void**>(ptr) = tensor_impl_free_list;
+    tensor_impl_free_list = ptr;
+    tensor_impl_free_list_size++;
+    return;
+  }
+  ::operator delete(ptr);
+}
+
 TensorImpl::TensorImpl(
     Storage&& storage,
     DispatchKeySet key_set,
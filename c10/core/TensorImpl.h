@@ -238,6 +238,14 @@ struct C10_API ExtraMeta {
   std::unique_ptr<c10::NamedTensorMetaInterface> named_tensor_meta_ = nullptr;
   intrusive_ptr<c10::BackendMeta> backend_meta_ = nullptr;
   c10::optional<std::string> custom_data_ptr_error_msg_ = c10::nullopt;
+  // Cached content fingerprint, valid only while the tensor's version
+  // counter still reads `content_fingerprint_version_`. See
+  // TensorImpl::content_fingerprint(). Deliberately not propagated by the
+  // copy constructor / clone(): the cache is keyed to a particular impl's
+  // version stream, and a shallow copy may diverge from it.
+  uint64_t content_fingerprint_ = 0;
+  uint32_t content_fingerprint_version_ = 0;
+  bool has_content_fingerprint_ = false;
 
   ExtraMeta() = default;
   ExtraMeta(const ExtraMeta& other) {
@@ -560,6 +568,15 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   TensorImpl(TensorImpl&&) = delete;
   TensorImpl& operator=(TensorImpl&&) = delete;
 
+  // TensorImpls are created and destroyed at very high rates by view
+  // creation (as_strided/select/slice make one per call), so blocks of
+  // exactly sizeof(TensorImpl) are recycled through a small per-thread
+  // freelist instead of hitting the global allocator every time.
+  // Subclass allocations have a different size and fall through to
+  // ::operator new/delete unchanged.
+  static void* operator new(std::size_t nbytes);
+  static void operator delete(void* ptr, std::size_t nbytes);
+
   /**
    * Release (decref) storage, and any other external allocations.  This
    * override is for `intrusive_ptr_target` and is used to implement weak
@@ -2078,6 +2095,39 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     version_counter_.bump();
   }
 
+  /**
+   * Return the content fingerprint recorded by set_content_fingerprint(),
+   * or nullopt if none was recorded at the tensor's current version. This
+   * is only the O(1) validity check; computing the fingerprint itself
+   * (e.g. by hashing the tensor's bytes with c10::util::xxh64) is the
+   * caller's responsibility.
+   */
+  c10::optional<uint64_t> content_fingerprint() const {
+    if (!version_counter_.enabled() || !extra_meta_ ||
+        !extra_meta_->has_content_fingerprint_ ||
+        extra_meta_->content_fingerprint_version_ !=
+            version_counter_.current_version()) {
+      return c10::nullopt;
+    }
+    return extra_meta_->content_fingerprint_;
+  }
+
+  /**
+   * Cache a content fingerprint for the tensor's current version. The cache
+   * is invalidated by any subsequent version bump (i.e. any in-place
+   * write). Inference tensors have no version counter, so a cached
+   * fingerprint could never be invalidated; for them this is a no-op.
+   */
+  void set_content_fingerprint(uint64_t fingerprint) {
+    if (!version_counter_.enabled()) {
+      return;
+    }
+    auto& extra_meta = get_extra_meta();
+    extra_meta.content_fingerprint_ = fingerprint;
+    extra_meta.content_fingerprint_version_ = version_counter_.current_version();
+    extra_meta.has_content_fingerprint_ = true;
+  }
+
   impl::PyObjectSlot* pyobj_slot() {
     return &pyobj_slot_;
   }
@@ -3188,6 +3238,13 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
     return true;
   }
 
+  // Extra bytes occupied by sizes_and_strides_ when the inline capacity
+  // is raised above the default of 5 (see SizesAndStrides.h).
+  static constexpr size_t sizes_and_strides_extra_bytes =
+      C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE > 5
+      ? (C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE - 5) * 2 * sizeof(int64_t)
+      : 0;
+
  public:
   // Compile-time check that TensorImpl field sizes are as expected
   //
@@ -3207,7 +3264,8 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
 #if UINTPTR_MAX == 0xFFFFFFFF
   // This is a 32-bit system
   static constexpr bool check_sizes() {
-    constexpr size_t tsize = 20 * sizeof(int64_t);
+    constexpr size_t tsize =
+        20 * sizeof(int64_t) + sizes_and_strides_extra_bytes;
 
     // clang-format off
     are_equal<sizeof(storage_),            4,  FieldNameEnum::storage_>();
@@ -3215,7 +3273,7 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
     are_equal<sizeof(extra_meta_),         4,  FieldNameEnum::extra_meta_>();
     are_equal<sizeof(version_counter_),    4,  FieldNameEnum::version_counter_>();
     are_equal<sizeof(pyobj_slot_),    8,  FieldNameEnum::pyobj_slot_>();
-    is_le<sizeof(sizes_and_strides_),     88, FieldNameEnum::sizes_and_strides_>();
+    is_le<sizeof(sizes_and_strides_),     88 + sizes_and_strides_extra_bytes, FieldNameEnum::sizes_and_strides_>();
     are_equal<sizeof(storage_offset_),     8,  FieldNameEnum::storage_offset_>();
     are_equal<sizeof(numel_),              8,  FieldNameEnum::numel_>();
     are_equal<sizeof(data_type_),          2,  FieldNameEnum::data_type_>();
@@ -3229,7 +3287,8 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
 #else
   // This is a 64-bit system
   static constexpr bool check_sizes() {
-    constexpr size_t tsize = 26 * sizeof(int64_t);
+    constexpr size_t tsize =
+        26 * sizeof(int64_t) + sizes_and_strides_extra_bytes;
 
     // clang-format off
     are_equal<sizeof(storage_),            8,  FieldNameEnum::storage_>();
@@ -3240,7 +3299,11 @@ class C10_TensorImpl_Size_Check_Dummy_Class : private TensorImpl {
     is_le<sizeof(extra_meta_),            16,  FieldNameEnum::extra_meta_>();
     are_equal<sizeof(version_counter_),    8,  FieldNameEnum::version_counter_>();
     are_equal<sizeof(pyobj_slot_),   16,  FieldNameEnum::pyobj_slot_>();
+#if C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE == 5
     are_equal<sizeof(sizes_and_strides_), 88,  FieldNameEnum::sizes_and_strides_>();
+#else
+    is_le<sizeof(sizes_and_strides_),     88 + sizes_and_strides_extra_bytes, FieldNameEnum::sizes_and_strides_>();
+#endif
     are_equal<sizeof(storage_offset_),     8,  FieldNameEnum::storage_offset_>();
     are_equal<sizeof(numel_),              8,  FieldNameEnum::numel_>();
     are_equal<sizeof(data_type_),          2,  FieldNameEnum::data_type_>();
@@ -18,7 +18,13 @@ thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
 
 #if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 LocalDispatchKeySet tls_local_dispatch_key_set() {
-  return raw_local_dispatch_key_set;
+  auto& tls = raw_local_dispatch_key_set;
+  if (C10_UNLIKELY(tls.cache_generation_ != tls.generation_ + 1)) {
+    tls.refresh_cache();
+  }
+  return LocalDispatchKeySet(
+      DispatchKeySet(DispatchKeySet::RAW, tls.cached_included_),
+      DispatchKeySet(DispatchKeySet::RAW, tls.cached_excluded_));
 }
 #endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 
@@ -34,6 +34,20 @@ struct C10_API PODLocalDispatchKeySet {
   uint64_t included_;
   uint64_t excluded_;
 
+  // Versioned cache of the composed (post-XOR) key sets. The raw fields
+  // above must encode the default state as zero (see Note [TLS
+  // Initialization]), so reading them costs an XOR against the default sets
+  // on every dispatch. tls_local_dispatch_key_set() instead serves the
+  // cached values below and refills them only when generation_ says the raw
+  // state changed. generation_ is bumped by every setter (and therefore by
+  // every guard construction/destruction); the cache is valid iff
+  // cache_generation_ == generation_ + 1, which makes the zero-initialized
+  // TLS state read as "invalid".
+  uint64_t cached_included_;
+  uint64_t cached_excluded_;
+  uint64_t generation_;
+  uint64_t cache_generation_;
+
   // See Note [TLS Initialization]
   DispatchKeySet included() const {
     return DispatchKeySet(DispatchKeySet::RAW, included_) ^
@@ -46,9 +60,17 @@ struct C10_API PODLocalDispatchKeySet {
 
   void set_included(DispatchKeySet x) {
     included_ = (x ^ c10::default_included_set).raw_repr();
+    ++generation_;
   }
   void set_excluded(DispatchKeySet x) {
     excluded_ = (x ^ c10::default_excluded_set).raw_repr();
+    ++generation_;
+  }
+
+  void refresh_cache() {
+    cached_included_ = included().raw_repr();
+    cached_excluded_ = excluded().raw_repr();
+    cache_generation_ = generation_ + 1;
   }
 };
 static_assert(
@@ -58,6 +80,8 @@ static_assert(
 struct C10_API LocalDispatchKeySet {
   /* implicit */ LocalDispatchKeySet(PODLocalDispatchKeySet x)
       : included_(x.included()), excluded_(x.excluded()) {}
+  LocalDispatchKeySet(DispatchKeySet included, DispatchKeySet excluded)
+      : included_(included), excluded_(excluded) {}
   DispatchKeySet included_;
   DispatchKeySet excluded_;
 };
@@ -72,7 +96,13 @@ extern C10_API thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
 inline C10_API LocalDispatchKeySet tls_local_dispatch_key_set() {
   // Don't let people fiddle with the thread_local directly just
   // because they include this header.
-  return raw_local_dispatch_key_set;
+  auto& tls = raw_local_dispatch_key_set;
+  if (C10_UNLIKELY(tls.cache_generation_ != tls.generation_ + 1)) {
+    tls.refresh_cache();
+  }
+  return LocalDispatchKeySet(
+      DispatchKeySet(DispatchKeySet::RAW, tls.cached_included_),
+      DispatchKeySet(DispatchKeySet::RAW, tls.cached_excluded_));
 }
 #endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 
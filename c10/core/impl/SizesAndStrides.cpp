@@ -1,8 +1,26 @@
 #include <c10/core/impl/SizesAndStrides.h>
 
+#include <atomic>
+
 namespace c10 {
 namespace impl {
 
+namespace {
+// Relaxed ordering throughout: this is a monotonically increasing
+// diagnostic counter, not a synchronization point.
+std::atomic<uint64_t> outOfLineAllocations{0};
+} // namespace
+
+uint64_t sizesAndStridesOutOfLineAllocations() noexcept {
+  return outOfLineAllocations.load(std::memory_order_relaxed);
+}
+
+namespace detail {
+void bumpOutOfLineSizesAndStrides() noexcept {
+  outOfLineAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace detail
+
 void SizesAndStrides::resizeSlowPath(
     const size_t newSize,
     const size_t oldSize) {
@@ -49,6 +67,7 @@ void SizesAndStrides::resizeSlowPath(
         memset(&tempStorage[newSize + oldSize], 0, bytesToZero);
       }
       outOfLineStorage_ = tempStorage;
+      detail::bumpOutOfLineSizesAndStrides();
     } else {
       const bool isGrowing = oldSize < newSize;
       if (isGrowing) {
@@ -7,11 +7,31 @@
 #include <c10/util/ArrayRef.h>
 #include <c10/util/SmallVector.h>
 
+// Number of dimensions stored inline before SizesAndStrides falls back
+// to a heap allocation. The default of 5 covers the common case; builds
+// dominated by higher-rank tensors (e.g. 6-D video batches) can raise it
+// via the C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE CMake cache variable (see
+// c10/CMakeLists.txt), which defines the macro PUBLICly on the c10 target.
+// The value changes the layout of TensorImpl, so it must be consistent
+// across everything linked against c10. Use
+// sizesAndStridesOutOfLineAllocations() below to decide whether raising
+// it is worth the extra bytes per TensorImpl.
+#ifndef C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE
 #define C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE 5
+#endif
 
 namespace c10 {
 namespace impl {
 
+// Lifetime count of SizesAndStrides instances that fell out of the inline
+// representation (i.e. grew past C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE
+// dims and heap-allocated their metadata).
+C10_API uint64_t sizesAndStridesOutOfLineAllocations() noexcept;
+
+namespace detail {
+C10_API void bumpOutOfLineSizesAndStrides() noexcept;
+} // namespace detail
+
 // Packed container for TensorImpl sizes and strides.
 // This design improves on the previous approach of using a pair of
 // c10::SmallVector<int64_t, 5> by specializing for the operations we
@@ -19,8 +39,9 @@ namespace impl {
 // the number of strides. The memory layout is as follows:
 //
 // 1 size_t for the size
-// 5 eightbytes of inline sizes and 5 eightbytes of inline strides, OR pointer
-// to out-of-line array
+// 5 eightbytes of inline sizes and 5 eightbytes of inline strides
+// (or more, if C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE is raised), OR
+// pointer to out-of-line array
 class C10_API SizesAndStrides {
  public:
   // TODO: different iterator types for sizes & strides to prevent
@@ -282,6 +303,7 @@ class C10_API SizesAndStrides {
     TORCH_CHECK(
         outOfLineStorage_,
         "Could not allocate memory for Tensor SizesAndStrides!");
+    detail::bumpOutOfLineSizesAndStrides();
   }
 
   void resizeOutOfLineStorage(size_t newSize) {
@@ -6,6 +6,12 @@
 #include <c10/util/irange.h>
 #include <c10/util/numa.h>
 
+#include <atomic>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#endif
+
 // TODO: rename flags to C10
 C10_DEFINE_bool(
     caffe2_cpu_allocator_do_zero_fill,
@@ -17,6 +23,18 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_use_thp,
+    false,
+    "If set, back large CPU allocations with transparent huge pages "
+    "(madvise(MADV_HUGEPAGE)) on Linux");
+
+C10_DEFINE_int64(
+    caffe2_cpu_allocator_thp_threshold,
+    1 << 24, // 16 MiB
+    "Minimum allocation size in bytes eligible for transparent huge page "
+    "backing when --caffe2_cpu_allocator_use_thp is set");
+
 namespace c10 {
 
 namespace {
@@ -41,8 +59,38 @@ void memset_junk(void* data, size_t num) {
   }
 }
 
+// Preferred NUMA node for allocations made by this thread; negative means
+// "use the node of the CPU we are currently running on".
+thread_local int preferred_numa_node = -1;
+
+// Huge-page coverage counters; see GetCPUHugePagesStats().
+std::atomic<uint64_t> total_allocations{0};
+std::atomic<uint64_t> total_allocated_bytes{0};
+std::atomic<uint64_t> huge_page_allocations{0};
+std::atomic<uint64_t> huge_page_bytes{0};
+
+#if defined(__linux__) && !defined(__ANDROID__) && defined(MADV_HUGEPAGE)
+// Transparent huge pages operate at this granularity on all currently
+// supported Linux configurations.
+constexpr size_t gHugePageSize = 2 * 1024 * 1024;
+
+bool use_huge_pages_for(size_t nbytes) {
+  return FLAGS_caffe2_cpu_allocator_use_thp &&
+      FLAGS_caffe2_cpu_allocator_thp_threshold >= 0 &&
+      nbytes >= static_cast<size_t>(FLAGS_caffe2_cpu_allocator_thp_threshold);
+}
+#endif
+
 } // namespace
 
+void SetAllocNUMANode(int numa_node_id) {
+  preferred_numa_node = numa_node_id;
+}
+
+int GetAllocNUMANode() {
+  return preferred_numa_node;
+}
+
 void* alloc_cpu(size_t nbytes) {
   if (nbytes == 0) {
     return nullptr;
@@ -71,7 +119,15 @@ void* alloc_cpu(size_t nbytes) {
       nbytes,
       " bytes.");
 #else
-  int err = posix_memalign(&data, gAlignment, nbytes);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Align huge-page-eligible allocations to the huge page size; an
+  // unaligned region would leave its head and tail on regular pages.
+  const bool use_huge_pages = use_huge_pages_for(nbytes);
+  const size_t alignment = use_huge_pages ? gHugePageSize : gAlignment;
+#else
+  constexpr size_t alignment = gAlignment;
+#endif
+  int err = posix_memalign(&data, alignment, nbytes);
   CAFFE_ENFORCE(
       err == 0,
       "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
@@ -81,10 +137,25 @@ void* alloc_cpu(size_t nbytes) {
       " (",
       strerror(err),
       ")");
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (use_huge_pages) {
+    // Advisory only: the kernel coalesces the region into huge pages on
+    // fault when it can; on failure (or with THP disabled system-wide) the
+    // allocation silently stays on regular pages.
+    if (madvise(data, nbytes, MADV_HUGEPAGE) == 0) {
+      huge_page_allocations.fetch_add(1, std::memory_order_relaxed);
+      huge_page_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+    }
+  }
+#endif
 #endif
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  // move data to the thread's preferred NUMA node, if set, or else to the
+  // node the thread is currently running on
+  NUMAMove(
+      data,
+      nbytes,
+      preferred_numa_node >= 0 ? preferred_numa_node : GetCurrentNUMANode());
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
@@ -95,9 +166,30 @@ void* alloc_cpu(size_t nbytes) {
     memset_junk(data, nbytes);
   }
 
+  total_allocations.fetch_add(1, std::memory_order_relaxed);
+  total_allocated_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+
   return data;
 }
 
+void SetCPUAllocatorUseHugePages(bool enable) {
+  FLAGS_caffe2_cpu_allocator_use_thp = enable;
+}
+
+bool GetCPUAllocatorUseHugePages() {
+  return FLAGS_caffe2_cpu_allocator_use_thp;
+}
+
+CPUHugePagesStats GetCPUHugePagesStats() {
+  CPUHugePagesStats stats;
+  stats.total_allocations = total_allocations.load(std::memory_order_relaxed);
+  stats.total_bytes = total_allocated_bytes.load(std::memory_order_relaxed);
+  stats.huge_page_allocations =
+      huge_page_allocations.load(std::memory_order_relaxed);
+  stats.huge_page_bytes = huge_page_bytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void free_cpu(void* data) {
 #ifdef _MSC_VER
   _aligned_free(data);
@@ -3,10 +3,59 @@
 #include <c10/macros/Export.h>
 
 #include <cstddef>
+#include <cstdint>
 
 namespace c10 {
 
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
 
+/**
+ * Set the preferred NUMA node for CPU allocations made by the calling
+ * thread. By default (or when numa_node_id is negative) allocations are
+ * placed on the node of the CPU the thread happens to run on; an explicit
+ * node keeps allocations local even when the allocating thread migrates.
+ * Only takes effect when NUMA support is enabled (see c10/util/numa.h).
+ */
+C10_API void SetAllocNUMANode(int numa_node_id);
+
+/**
+ * Get the preferred NUMA node for CPU allocations made by the calling
+ * thread, or -1 if no preference has been set.
+ */
+C10_API int GetAllocNUMANode();
+
+/**
+ * Enable or disable transparent huge page backing for large CPU
+ * allocations (Linux only). When enabled, allocations of at least
+ * --caffe2_cpu_allocator_thp_threshold bytes are aligned to the huge page
+ * size and advised with madvise(MADV_HUGEPAGE), so the kernel can back
+ * them with 2MiB pages and cut TLB misses on large randomly-accessed
+ * buffers such as embedding tables. Advisory only: the allocation
+ * silently stays on regular pages when huge pages are unavailable.
+ * Equivalent to the --caffe2_cpu_allocator_use_thp flag.
+ */
+C10_API void SetCPUAllocatorUseHugePages(bool enable);
+
+/**
+ * Whether transparent huge page backing for large CPU allocations is
+ * enabled.
+ */
+C10_API bool GetCPUAllocatorUseHugePages();
+
+/**
+ * Cumulative huge-page coverage statistics for alloc_cpu(), for judging
+ * how much of the traffic actually receives huge page backing.
+ */
+struct CPUHugePagesStats {
+  // All allocations served by alloc_cpu() since process start.
+  uint64_t total_allocations;
+  uint64_t total_bytes;
+  // The subset successfully advised with MADV_HUGEPAGE.
+  uint64_t huge_page_allocations;
+  uint64_t huge_page_bytes;
+};
+
+C10_API CPUHugePagesStats GetCPUHugePagesStats();
+
 } // namespace c10
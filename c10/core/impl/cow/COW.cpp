@@ -0,0 +1,138 @@
+#include <c10/core/impl/cow/COW.h>
+
+#include <c10/core/Allocator.h>
+#include <c10/core/StorageImpl.h>
+#include <c10/core/impl/cow/context.h>
+#include <c10/core/impl/cow/deleter.h>
+#include <c10/util/Exception.h>
+
+#include <cstring>
+#include <memory>
+#include <variant>
+
+namespace c10::impl::cow {
+
+namespace {
+
+// Wraps a copy-on-write context into a DataPtr aliasing the given data.
+auto make_cow_data_ptr(const at::DataPtr& data_ptr, cow::Context& ctx)
+    -> at::DataPtr {
+  return at::DataPtr(
+      data_ptr.get(), &ctx, cow::delete_context, data_ptr.device());
+}
+
+} // namespace
+
+auto is_cow_data_ptr(const c10::DataPtr& data_ptr) -> bool {
+  return data_ptr.get_deleter() == cow::delete_context;
+}
+
+auto has_simple_data_ptr(const c10::StorageImpl& storage) -> bool {
+  const c10::DataPtr& data_ptr = storage.data_ptr();
+  return data_ptr.get_context() == data_ptr.get() && data_ptr.get() != nullptr;
+}
+
+namespace {
+
+auto lazy_clone_storage_impl(StorageImpl& storage, bool allow_owning_context)
+    -> c10::intrusive_ptr<StorageImpl> {
+  const at::DataPtr& data_ptr = storage.data_ptr();
+
+  // Materialization copies through the allocator with memcpy, so only
+  // CPU storages that can reallocate are eligible.
+  if (storage.device_type() != DeviceType::CPU ||
+      storage.allocator() == nullptr) {
+    return nullptr;
+  }
+
+  // There are three cases we can lazily clone:
+  //
+  // 1) the storage is already copy-on-write: bump the context's
+  //    refcount and alias it. Note [contexts cannot vanish]: holding a
+  //    reference to the storage means holding a reference to the
+  //    context, so a plain refcount bump suffices; see README.md.
+  //
+  // 2) the storage holds its data through a simple DataPtr: convert it
+  //    to copy-on-write in place by wrapping the original
+  //    context/deleter pair in a cow::Context, then alias that.
+  //
+  // 3) the caller asserts (allow_owning_context) that the DataPtr owns
+  //    its allocation through its context, e.g. a mapped shared-memory
+  //    allocation; the context/deleter pair is wrapped the same way.
+  //
+  // Anything else (e.g. a non-owning DataPtr made by from_blob) is not
+  // safe to alias lazily; the caller must copy eagerly.
+  cow::Context* ctx = nullptr;
+  if (is_cow_data_ptr(data_ptr)) {
+    ctx = data_ptr.cast_context<cow::Context>(cow::delete_context);
+    ctx->increment_refcount();
+  } else if (
+      has_simple_data_ptr(storage) ||
+      (allow_owning_context && data_ptr.get() != nullptr &&
+       data_ptr.get_context() != nullptr)) {
+    // Lazy-clone is logically a read: the user contract (see README.md)
+    // guarantees no write races with this conversion.
+    ctx = new cow::Context(storage.mutable_data_ptr().move_context());
+    storage.set_data_ptr_noswap(make_cow_data_ptr(data_ptr, *ctx));
+    ctx->increment_refcount();
+  } else {
+    return nullptr;
+  }
+
+  auto new_storage = c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      storage.sym_nbytes(),
+      make_cow_data_ptr(storage.data_ptr(), *ctx),
+      storage.allocator(),
+      /*resizable=*/false);
+  return new_storage;
+}
+
+} // namespace
+
+auto lazy_clone_storage(StorageImpl& storage)
+    -> c10::intrusive_ptr<StorageImpl> {
+  return lazy_clone_storage_impl(storage, /*allow_owning_context=*/false);
+}
+
+auto lazy_clone_owning_storage(StorageImpl& storage)
+    -> c10::intrusive_ptr<StorageImpl> {
+  return lazy_clone_storage_impl(storage, /*allow_owning_context=*/true);
+}
+
+auto materialize_cow_storage(StorageImpl& storage) -> void {
+  at::DataPtr& data_ptr = storage.mutable_data_ptr();
+
+  auto* ctx = data_ptr.cast_context<cow::Context>(cow::delete_context);
+  TORCH_INTERNAL_ASSERT(ctx != nullptr);
+
+  auto result = ctx->decrement_refcount();
+
+  if (std::holds_alternative<cow::Context::LastReference>(result)) {
+    // This is the only reference to the data: steal it back. The
+    // context has already waited for any pending copies, so it is safe
+    // to take ownership without copying.
+    std::unique_ptr<void, DeleterFnPtr> data =
+        std::get<cow::Context::LastReference>(std::move(result));
+    // For a simple DataPtr the stolen context is the data itself; for an
+    // owning-context wrap (see lazy_clone_owning_storage) it is the
+    // original context object, so only non-nullness can be asserted.
+    TORCH_INTERNAL_ASSERT(data.get() != nullptr);
+    DeleterFnPtr deleter = data.get_deleter();
+    void* original_ctx = data.release();
+    storage.set_data_ptr_noswap(
+        at::DataPtr(data_ptr.get(), original_ctx, deleter, data_ptr.device()));
+  } else {
+    TORCH_INTERNAL_ASSERT(
+        std::holds_alternative<cow::Context::NotLastReference>(result));
+    // We hold the shared lock while copying so that the last reference
+    // cannot steal the data out from under us mid-copy.
+    auto lock = std::get<cow::Context::NotLastReference>(std::move(result));
+    const size_t nbytes = storage.nbytes();
+    at::DataPtr copy = storage.allocator()->allocate(nbytes);
+    std::memcpy(copy.get(), data_ptr.get(), nbytes);
+    storage.set_data_ptr_noswap(std::move(copy));
+  }
+}
+
+} // namespace c10::impl::cow
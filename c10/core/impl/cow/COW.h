@@ -0,0 +1,63 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+#include <c10/util/intrusive_ptr.h>
+
+namespace c10 {
+struct StorageImpl;
+class DataPtr;
+} // namespace c10
+
+namespace c10::impl::cow {
+
+/// Is the given DataPtr a copy-on-write alias, i.e. does it hold its
+/// data through a cow::Context?
+C10_API auto is_cow_data_ptr(const c10::DataPtr& data_ptr) -> bool;
+
+/// Does the storage own its data through a simple DataPtr, i.e. one
+/// whose context is the data itself? Such a DataPtr can be wrapped in
+/// a copy-on-write context.
+C10_API auto has_simple_data_ptr(const c10::StorageImpl& storage) -> bool;
+
+/// Creates a copy-on-write alias of the given storage: a new
+/// StorageImpl sharing the data allocation through a cow::Context,
+/// making the clone O(1) regardless of the allocation size. Converts
+/// the original storage to copy-on-write in place first if necessary.
+///
+/// Returns nullptr if the storage is not eligible for lazy cloning:
+/// it must live on CPU (materialization copies with memcpy), have an
+/// allocator to materialize from, and either already be copy-on-write
+/// or own its data through a simple DataPtr. Callers should fall back
+/// to an eager copy in that case.
+///
+/// Note that writes to a copy-on-write storage only preserve the
+/// values of its aliases if they materialize the storage first (see
+/// materialize_cow_storage below). Writes dispatched through the
+/// ADInplaceOrView layer do this automatically; code that writes
+/// through a raw data pointer must call it by hand. The same applies
+/// to in-place ops run under c10::InferenceMode, which excludes the
+/// ADInplaceOrView key: _lazy_clone refuses to create new aliases
+/// there (it copies eagerly), but a caller who mutates a pre-existing
+/// copy-on-write tensor inside InferenceMode must materialize first.
+C10_API auto lazy_clone_storage(StorageImpl& storage)
+    -> c10::intrusive_ptr<StorageImpl>;
+
+/// Like lazy_clone_storage, but additionally accepts CPU storages that
+/// own their data through a DataPtr with a distinct context, e.g. a
+/// mapped shared-memory allocation. The caller must guarantee that the
+/// DataPtr truly owns its allocation — that running the context's
+/// deleter is what releases the data — which c10 cannot verify here.
+/// Wrapping a non-owning DataPtr (such as one made by from_blob) would
+/// let aliases outlive the data; never pass one.
+C10_API auto lazy_clone_owning_storage(StorageImpl& storage)
+    -> c10::intrusive_ptr<StorageImpl>;
+
+/// Gives the storage its own copy of the data it shares through a
+/// copy-on-write context, so that it may be written to freely. If this
+/// is the last reference to the context, the data is stolen back
+/// without copying.
+///
+/// Requires: storage is copy-on-write (see is_cow_data_ptr).
+C10_API auto materialize_cow_storage(StorageImpl& storage) -> void;
+
+} // namespace c10::impl::cow
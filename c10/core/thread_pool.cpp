@@ -58,6 +58,10 @@ bool ThreadPool::inThreadPool() const {
 }
 
 void ThreadPool::run(std::function<void()> func) {
+  run(std::move(func), TaskPriority::High);
+}
+
+void ThreadPool::run(std::function<void()> func, TaskPriority priority) {
   if (threads_.empty()) {
     throw std::runtime_error("No threads to run a task");
   }
@@ -65,11 +69,16 @@ void ThreadPool::run(std::function<void()> func) {
 
   // Set task and signal condition variable so that a worker thread will
   // wake up and use the task.
-  tasks_.emplace(std::move(func));
+  tasks_[static_cast<size_t>(priority)].emplace(std::move(func));
   complete_ = false;
   condition_.notify_one();
 }
 
+size_t ThreadPool::queuedTasks(TaskPriority priority) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return tasks_[static_cast<size_t>(priority)].size();
+}
+
 void ThreadPool::waitWorkComplete() {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_.wait(lock, [&]() { return complete_; });
@@ -80,7 +89,7 @@ void ThreadPool::main_loop(std::size_t index) {
   while (running_) {
     // Wait on condition variable while the task is empty and
     // the pool is still running.
-    condition_.wait(lock, [&]() { return !tasks_.empty() || !running_; });
+    condition_.wait(lock, [&]() { return !tasks_empty() || !running_; });
     // If pool is no longer running, break out of loop.
     if (!running_) {
       break;
@@ -92,8 +101,18 @@ void ThreadPool::main_loop(std::size_t index) {
     // useful in the event that the function contains
     // shared_ptr arguments bound via bind.
     {
-      task_element_t tasks = std::move(tasks_.front());
-      tasks_.pop();
+      // Drain lanes in priority order; a Low task only runs when no High
+      // task is waiting, but no thread is ever reserved for High work
+      // (work-conserving).
+      auto* lane = &tasks_.front();
+      for (auto& q : tasks_) {
+        if (!q.empty()) {
+          lane = &q;
+          break;
+        }
+      }
+      task_element_t tasks = std::move(lane->front());
+      lane->pop();
       // Decrement count, indicating thread is no longer available.
       --available_;
 
@@ -125,7 +144,7 @@ void ThreadPool::main_loop(std::size_t index) {
 
     // Increment count, indicating thread is available.
     ++available_;
-    if (tasks_.empty() && available_ == total_) {
+    if (tasks_empty() && available_ == total_) {
       complete_ = true;
       completed_.notify_one();
     }
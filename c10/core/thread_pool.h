@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -18,11 +19,32 @@ C10_CLANG_DIAGNOSTIC_IGNORE("-Wshorten-64-to-32")
 
 namespace c10 {
 
+// Priority lane of an inter-op task. Workers always drain High before Low,
+// but any worker takes Low work when no High work is queued, so background
+// tasks can't starve as long as the pool keeps up.
+enum class TaskPriority : uint8_t {
+  High = 0,
+  Low = 1,
+};
+
+constexpr size_t kNumTaskPriorities = 2;
+
 // TODO: move this to C10 and make it C10_API
 class C10_API TaskThreadPoolBase {
  public:
   virtual void run(std::function<void()> func) = 0;
 
+  // Priority-unaware pools treat every task as High.
+  virtual void run(std::function<void()> func, TaskPriority /*priority*/) {
+    run(std::move(func));
+  }
+
+  // Number of tasks currently queued (not yet picked up by a worker) in the
+  // given priority lane. Pools without lanes report everything as High.
+  virtual size_t queuedTasks(TaskPriority /*priority*/) const {
+    return 0;
+  }
+
   virtual size_t size() const = 0;
 
   /**
@@ -59,7 +81,8 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
         : run_with_id(true), no_id(nullptr), with_id(std::move(f)) {}
   };
 
-  std::queue<task_element_t> tasks_;
+  // One FIFO queue per priority lane; workers scan lanes in order.
+  std::array<std::queue<task_element_t>, kNumTaskPriorities> tasks_;
   std::vector<std::thread> threads_;
   mutable std::mutex mutex_;
   std::condition_variable condition_;
@@ -88,13 +111,18 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
   void run(std::function<void()> func) override;
 
+  void run(std::function<void()> func, TaskPriority priority) override;
+
+  size_t queuedTasks(TaskPriority priority) const override;
+
   template <typename Task>
   void runTaskWithID(Task task) {
     std::unique_lock<std::mutex> lock(mutex_);
 
     // Set task and signal condition variable so that a worker thread will
     // wake up and use the task.
-    tasks_.emplace(static_cast<std::function<void(std::size_t)>>(task));
+    tasks_[static_cast<size_t>(TaskPriority::High)].emplace(
+        static_cast<std::function<void(std::size_t)>>(task));
     complete_ = false;
     condition_.notify_one();
   }
@@ -105,6 +133,16 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
  private:
   // @brief Entry point for pool threads.
   void main_loop(std::size_t index);
+
+  // Requires mutex_ to be held.
+  bool tasks_empty() const {
+    for (const auto& lane : tasks_) {
+      if (!lane.empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
 class C10_API TaskThreadPool : public c10::ThreadPool {
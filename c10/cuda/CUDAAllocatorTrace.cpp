@@ -0,0 +1,108 @@
+#include <c10/cuda/CUDAAllocatorTrace.h>
+
+#include <c10/util/Exception.h>
+
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace c10 {
+namespace cuda {
+namespace CUDACachingAllocator {
+
+namespace {
+
+// All state behind one mutex. The tracker below runs with the device
+// allocator's lock held, so it only does an in-memory id lookup and a
+// buffered fwrite - no allocator re-entry, no GIL.
+struct TraceDumpState {
+  std::mutex mutex;
+  FILE* file{nullptr};
+  std::unordered_map<cudaStream_t, uint32_t> stream_ids;
+  bool tracker_attached{false};
+};
+
+TraceDumpState& state() {
+  static TraceDumpState s;
+  return s;
+}
+
+void dump_entry(int device, const TraceEntry& te) {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (s.file == nullptr) {
+    return;
+  }
+  auto it = s.stream_ids.find(te.stream_);
+  if (it == s.stream_ids.end()) {
+    it = s.stream_ids
+             .emplace(te.stream_, static_cast<uint32_t>(s.stream_ids.size()))
+             .first;
+  }
+  AllocatorTraceRecord record{};
+  record.action = static_cast<uint8_t>(te.action_);
+  record.device = static_cast<uint8_t>(device);
+  record.stream_id = it->second;
+  record.addr = te.addr_;
+  record.size = te.size_;
+  fwrite(&record, sizeof(record), 1, s.file);
+}
+
+} // namespace
+
+void startAllocatorTraceDump(const std::string& path) {
+  auto& s = state();
+
+  // Note on lock ordering: dump_entry runs with the device allocator's lock
+  // held and then takes s.mutex, so nothing below may call into the
+  // allocator while holding s.mutex.
+  // Trace events are only emitted while history recording is enabled; turn
+  // it on with a minimal ring buffer unless the caller (e.g. the profiler)
+  // already configured it.
+  if (!isHistoryEnabled()) {
+    recordHistory(
+        /*enabled=*/true,
+        /*context_recorder=*/nullptr,
+        /*alloc_trace_max_entries=*/1,
+        /*alloc_trace_record_context=*/false);
+  }
+
+  // Trackers cannot be detached, so attach once and let dump_entry drop
+  // events while no dump is active.
+  bool need_attach = false;
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    TORCH_CHECK(
+        s.file == nullptr,
+        "startAllocatorTraceDump: a trace dump is already in progress");
+    if (!s.tracker_attached) {
+      s.tracker_attached = true;
+      need_attach = true;
+    }
+  }
+  if (need_attach) {
+    attachAllocatorTraceTracker(dump_entry);
+  }
+
+  FILE* file = fopen(path.c_str(), "wb");
+  TORCH_CHECK(
+      file != nullptr, "startAllocatorTraceDump: could not open ", path);
+  fwrite(kAllocatorTraceMagic, kAllocatorTraceMagicLen, 1, file);
+
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.stream_ids.clear();
+  s.file = file;
+}
+
+void stopAllocatorTraceDump() {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (s.file != nullptr) {
+    fclose(s.file);
+    s.file = nullptr;
+  }
+}
+
+} // namespace CUDACachingAllocator
+} // namespace cuda
+} // namespace c10
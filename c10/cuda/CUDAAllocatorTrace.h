@@ -0,0 +1,59 @@
+#pragma once
+
+#include <c10/cuda/CUDACachingAllocator.h>
+
+#include <cstdint>
+#include <string>
+
+namespace c10 {
+namespace cuda {
+namespace CUDACachingAllocator {
+
+// Compact binary dump of the allocator trace, for offline replay and
+// allocation-pattern benchmarking (see binaries/allocator_trace_replay.cc).
+//
+// File format, all fields little-endian:
+//   8 bytes   magic "C10ATRC1" (the trailing '1' is the format version)
+//   then a stream of fixed-size 24-byte records:
+//     uint8_t  action     TraceEntry::Action
+//     uint8_t  device
+//     uint16_t (reserved, zero)
+//     uint32_t stream_id  dense id assigned per distinct cudaStream_t in
+//                         order of first appearance; 0 is always the first
+//                         stream seen (typically the default stream)
+//     int64_t  addr       TraceEntry::addr_
+//     int64_t  size       TraceEntry::size_
+//
+// Records are appended in the order the allocator emits them, so a replay
+// that walks the file re-executes the workload's exact alloc/free/stream
+// interleaving.
+constexpr size_t kAllocatorTraceMagicLen = 8;
+constexpr const char* kAllocatorTraceMagic = "C10ATRC1";
+
+struct AllocatorTraceRecord {
+  uint8_t action;
+  uint8_t device;
+  uint16_t reserved;
+  uint32_t stream_id;
+  int64_t addr;
+  int64_t size;
+};
+
+static_assert(
+    sizeof(AllocatorTraceRecord) == 24,
+    "AllocatorTraceRecord is written to disk as-is and must stay packed");
+
+// Starts dumping every allocator trace event to `path`. Enables
+// recordHistory (with a minimal ring buffer) if the caller has not already
+// done so, since trace events are only generated while history recording is
+// on; an already-enabled history configuration is left untouched.
+C10_CUDA_API void startAllocatorTraceDump(const std::string& path);
+
+// Stops dumping and flushes/closes the file. History recording is left in
+// whatever state it is in. May be called again after another
+// startAllocatorTraceDump.
+C10_CUDA_API void stopAllocatorTraceDump();
+
+} // namespace CUDACachingAllocator
+} // namespace cuda
+} // namespace c10
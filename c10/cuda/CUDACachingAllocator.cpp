@@ -1,5 +1,6 @@
 #include <c10/cuda/CUDACachingAllocator.h>
 
+#include <c10/core/Storage.h>
 #include <c10/core/impl/GPUTrace.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
@@ -726,6 +727,12 @@ struct PrivatePool {
   // cudaMalloc_count drop to zero, we can delete this PrivatePool from
   // graph_pools.
   int cudaMalloc_count;
+  // For user-created pools (see Note [Per-stream user pools]): the pool's
+  // name, an optional cap on reserved bytes (0 means uncapped), and per-pool
+  // stats. Graph pools leave these at their defaults.
+  std::string name;
+  size_t memory_cap = 0;
+  PoolStats stats;
   // Instead of maintaining private BlockPools here, I could stuff all blocks
   // (private or no) into the top-level large_blocks and small_blocks, and
   // distinguish private blocks by adding a "pool id" check above the stream
@@ -1178,6 +1185,17 @@ static std::string reportProcessMemoryInfo(int device) {
 
 namespace Native {
 
+// An allocation that defragment() may migrate into another segment.  The
+// fields are a stable snapshot of the owning Block taken under the device
+// allocator's lock; `segment_base` identifies the segment the allocation
+// must be moved out of.
+struct DefragCandidate {
+  void* ptr;
+  size_t requested_size;
+  cudaStream_t stream;
+  void* segment_base;
+};
+
 class DeviceCachingAllocator {
  private:
   // lock around all operations
@@ -1245,9 +1263,19 @@ class DeviceCachingAllocator {
   // rather than the global memory.
   ska::flat_hash_map<cudaStream_t, MempoolId_t> stream_to_pool_map;
 
+  // See Note [Per-stream user pools]. Maps a stream to the user pool its
+  // allocations are routed into (attachPoolToStream), and a pool name to its
+  // id so repeated createUserPool calls with the same name share one pool.
+  ska::flat_hash_map<cudaStream_t, MempoolId_t> user_stream_to_pool_map;
+  ska::flat_hash_map<std::string, MempoolId_t> user_pool_names;
+
   // XXX - maybe we should generalize and have multiple events
   std::vector<OutOfMemoryObserver> oom_observers_;
 
+  // Invoked from record_trace, i.e. with `mutex` held; the device index is
+  // bound in by NativeCachingAllocator when the tracker is attached.
+  std::vector<std::function<void(const TraceEntry&)>> trace_trackers_;
+
  public:
   DeviceCachingAllocator()
       : large_blocks(/*is_small=*/false),
@@ -1304,6 +1332,11 @@ class DeviceCachingAllocator {
     oom_observers_.emplace_back(std::move(observer));
   }
 
+  void attachAllocatorTraceTracker(std::function<void(const TraceEntry&)> tracker) {
+    std::unique_lock<std::recursive_mutex> lock(mutex);
+    trace_trackers_.emplace_back(std::move(tracker));
+  }
+
   // Must be called outside of `mutex` or deadlocks are possible with Python
   std::shared_ptr<GatheredContext> maybeGatherContext() {
     CreateContextFn context_recorder = context_recorder_.load();
@@ -1567,6 +1600,12 @@ class DeviceCachingAllocator {
     });
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, 1);
+    if (pool->owner_PrivatePool) {
+      update_stat(pool->owner_PrivatePool->stats.allocations, 1);
+      update_stat(
+          pool->owner_PrivatePool->stats.allocated_bytes,
+          static_cast<std::int64_t>(block->size));
+    }
 
     c10::reportMemoryUsageToProfiler(
         block->ptr,
@@ -1605,6 +1644,12 @@ class DeviceCachingAllocator {
     }
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, -1);
+    if (block->pool->owner_PrivatePool) {
+      update_stat(block->pool->owner_PrivatePool->stats.allocations, -1);
+      update_stat(
+          block->pool->owner_PrivatePool->stats.allocated_bytes,
+          -static_cast<std::int64_t>(block->size));
+    }
 
     if (!block->stream_uses.empty()) {
       if (C10_UNLIKELY(captures_underway)) {
@@ -1673,6 +1718,56 @@ class DeviceCachingAllocator {
     release_cached_blocks();
   }
 
+  /** collects allocations that defragment() may migrate **/
+  // A segment qualifies when at most half of it is allocated and every
+  // allocated block in it is movable: its pointer is in `movable` (i.e. a
+  // relocation callback is registered for it), and it has no outstanding
+  // events and no cross-stream uses.  Expandable segments are skipped
+  // because they reclaim slack in place by unmapping, and private (CUDA
+  // graph) pools are skipped because replay depends on stable addresses.
+  std::vector<DefragCandidate> getDefragCandidates(
+      const std::unordered_set<void*>& movable) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    std::vector<DefragCandidate> result;
+    for (const Block* const head_block : get_all_blocks()) {
+      if (head_block->prev != nullptr || head_block->expandable_segment_ ||
+          head_block->pool->owner_PrivatePool != nullptr) {
+        continue;
+      }
+      size_t segment_size = 0;
+      size_t allocated_size = 0;
+      bool all_movable = true;
+      for (const Block* block = head_block; block != nullptr;
+           block = block->next) {
+        segment_size += block->size;
+        if (block->allocated) {
+          allocated_size += block->size;
+          all_movable = all_movable && movable.count(block->ptr) != 0 &&
+              block->event_count == 0 && block->stream_uses.empty();
+        } else if (block->event_count > 0 || !block->stream_uses.empty()) {
+          // A pending free; the segment can't be released until the event
+          // clears, so don't bother emptying it now.
+          all_movable = false;
+        }
+      }
+      if (!all_movable || allocated_size == 0 ||
+          allocated_size * 2 > segment_size) {
+        continue;
+      }
+      for (const Block* block = head_block; block != nullptr;
+           block = block->next) {
+        if (block->allocated) {
+          result.push_back(DefragCandidate{
+              block->ptr,
+              std::max(block->requested_size, static_cast<size_t>(1)),
+              block->stream,
+              head_block->ptr});
+        }
+      }
+    }
+    return result;
+  }
+
   /** Retrieves size of largest unused block held by the memory cache **/
   void cacheInfo(size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -2158,6 +2253,78 @@ class DeviceCachingAllocator {
     }
   }
 
+  // Note [Per-stream user pools]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // By default all streams on a device share the same BlockPools, so a
+  // latency-critical stream's allocations interleave with bulk work and its
+  // tail latency depends on everyone else's free-list behavior. A user pool
+  // is a PrivatePool (the same structure CUDA graphs use) that is not tied to
+  // capture: createUserPool makes (or finds) a named pool, and
+  // attachPoolToStream routes every subsequent allocation on a stream into
+  // it. Because the pool's BlockPools are private, the bound stream never
+  // contends with default-pool fragmentation, and its reserved segments are
+  // never given back to satisfy other streams' allocations (release_cached
+  // machinery only frees a user pool's segments after releasePool). Each pool
+  // carries its own PoolStats and an optional cap on reserved bytes, so a
+  // runaway consumer inside the pool OOMs against its cap instead of starving
+  // the rest of the device.
+  //
+  // Lifetime mirrors graph pools: createUserPool takes the initial use_count
+  // reference and releasePool drops it. Streams should be detached
+  // (detachPoolFromStream) before the pool is released.
+
+  MempoolId_t createUserPool(const std::string& pool_name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = user_pool_names.find(pool_name);
+    if (it != user_pool_names.end()) {
+      return it->second;
+    }
+    // Like graph_pool_handle(), user pool ids set only the second value. The
+    // top bit partitions them from graph_pool_handle's uuids so the two
+    // counters cannot collide.
+    static std::atomic<CaptureId_t> user_pool_uuid{1};
+    MempoolId_t mempool_id{
+        0, (static_cast<CaptureId_t>(1) << 63) | user_pool_uuid++};
+    auto pool = std::make_unique<PrivatePool>();
+    pool->name = pool_name;
+    graph_pools.emplace(mempool_id, std::move(pool));
+    user_pool_names.emplace(pool_name, mempool_id);
+    return mempool_id;
+  }
+
+  void attachPoolToStream(cudaStream_t stream, MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(it != graph_pools.end(), "Could not find pool of id");
+    TORCH_CHECK(
+        it->second->use_count > 0,
+        "Cannot attach a stream to a pool that has been released");
+    user_stream_to_pool_map[stream] = mempool_id;
+  }
+
+  void detachPoolFromStream(cudaStream_t stream) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = user_stream_to_pool_map.find(stream);
+    TORCH_CHECK(
+        it != user_stream_to_pool_map.end(),
+        "Stream is not attached to a user pool");
+    user_stream_to_pool_map.erase(it);
+  }
+
+  void setPoolMemoryCap(MempoolId_t mempool_id, size_t cap_bytes) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(it != graph_pools.end(), "Could not find pool of id");
+    it->second->memory_cap = cap_bytes;
+  }
+
+  PoolStats getPoolStats(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(it != graph_pools.end(), "Could not find pool of id");
+    return it->second->stats;
+  }
+
   void addPeerAccess(int dev_to_access) {
     if (std::find(
             devices_with_peer_access_.begin(),
@@ -2494,6 +2661,22 @@ class DeviceCachingAllocator {
       }
     }
 #endif
+    // User pools bound via attachPoolToStream (see Note [Per-stream user
+    // pools]). Checked after the capture path so capturing a bound stream
+    // still routes into the capture's pool; the empty() test keeps the
+    // common (no user pools) case cheap.
+    if (C10_UNLIKELY(!user_stream_to_pool_map.empty())) {
+      auto it0 = user_stream_to_pool_map.find(stream);
+      if (it0 != user_stream_to_pool_map.end()) {
+        auto it1 = graph_pools.find(it0->second);
+        TORCH_INTERNAL_ASSERT(it1 != graph_pools.end());
+        if (size <= kSmallSize) {
+          return it1->second->small_blocks;
+        } else {
+          return it1->second->large_blocks;
+        }
+      }
+    }
     if (size <= kSmallSize) {
       return small_blocks;
     } else {
@@ -2675,6 +2858,16 @@ class DeviceCachingAllocator {
         total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
       return false;
+    } else if (
+        p.pool->owner_PrivatePool && p.pool->owner_PrivatePool->memory_cap &&
+        static_cast<size_t>(
+            p.pool->owner_PrivatePool->stats.reserved_bytes.current) +
+                size >
+            p.pool->owner_PrivatePool->memory_cap) {
+      // The pool has a cap on reserved bytes (see Note [Per-stream user
+      // pools]) and growing it would exceed the cap.
+      p.err = cudaErrorMemoryAllocation;
+      return false;
     } else if (
         CachingAllocatorConfig::expandable_segments() &&
         // our checkpointing logic for private pools doesn't support
@@ -2711,8 +2904,12 @@ class DeviceCachingAllocator {
     }
 
     if (p.pool->owner_PrivatePool) {
-      // The block is for a CUDA graph's PrivatePool.
+      // The block is for a CUDA graph's or a user's PrivatePool.
       p.pool->owner_PrivatePool->cudaMalloc_count++;
+      update_stat(p.pool->owner_PrivatePool->stats.segments, 1);
+      update_stat(
+          p.pool->owner_PrivatePool->stats.reserved_bytes,
+          static_cast<std::int64_t>(size));
     }
 
     total_allocated_memory += size;
@@ -2802,6 +2999,9 @@ class DeviceCachingAllocator {
       release_blocks(it->second->small_blocks);
       release_blocks(it->second->large_blocks);
       if (it->second->cudaMalloc_count == 0) {
+        if (!it->second->name.empty()) {
+          user_pool_names.erase(it->second->name);
+        }
         auto erase_count = graph_pools.erase(it->first);
         TORCH_INTERNAL_ASSERT(erase_count == 1);
         it = graph_pools_freeable.erase(it);
@@ -2836,9 +3036,14 @@ class DeviceCachingAllocator {
 
     auto* pool = block->pool;
     if (pool->owner_PrivatePool) {
-      // The cudaFreed block belonged to a CUDA graph's PrivatePool.
+      // The cudaFreed block belonged to a CUDA graph's or a user's
+      // PrivatePool.
       TORCH_INTERNAL_ASSERT(pool->owner_PrivatePool->cudaMalloc_count > 0);
       pool->owner_PrivatePool->cudaMalloc_count--;
+      update_stat(pool->owner_PrivatePool->stats.segments, -1);
+      update_stat(
+          pool->owner_PrivatePool->stats.reserved_bytes,
+          -static_cast<std::int64_t>(block->size));
     }
 
     StatTypes stat_types = get_stat_types_for_pool(*pool);
@@ -3071,6 +3276,9 @@ class DeviceCachingAllocator {
         size,
         stream,
         alloc_trace_record_context_ ? std::move(context) : nullptr);
+    for (const auto& cb : trace_trackers_) {
+      cb(te);
+    }
     if (alloc_trace->size() < alloc_trace_max_entries_) {
       alloc_trace->emplace_back(te);
     } else {
@@ -3108,6 +3316,15 @@ class NativeCachingAllocator : public CUDAAllocator {
   // allocated blocks by device pointer
   ska::flat_hash_map<void*, Block*> allocated_blocks;
 
+  // Relocation callbacks for defragment(), by device pointer.  Guarded by
+  // relocation_mutex, which is never held while calling into a
+  // DeviceCachingAllocator.  has_relocation_callbacks mirrors whether the
+  // map is non-empty so free() can skip taking the lock in the common case
+  // where defragmentation is unused.
+  std::mutex relocation_mutex;
+  ska::flat_hash_map<void*, RelocationCallback> relocation_callbacks;
+  std::atomic<bool> has_relocation_callbacks{false};
+
   void add_allocated_block(Block* block) {
     std::lock_guard<std::mutex> lock(mutex);
     allocated_blocks[block->ptr] = block;
@@ -3168,6 +3385,13 @@ class NativeCachingAllocator : public CUDAAllocator {
     if (!block) {
       TORCH_CHECK(false, "invalid device pointer: ", ptr);
     }
+    if (C10_UNLIKELY(has_relocation_callbacks.load(std::memory_order_relaxed))) {
+      // Relocation registrations follow the allocation's lifetime.
+      std::lock_guard<std::mutex> lock(relocation_mutex);
+      relocation_callbacks.erase(ptr);
+      has_relocation_callbacks.store(
+          !relocation_callbacks.empty(), std::memory_order_relaxed);
+    }
     const c10::impl::PyInterpreter* interp = c10::impl::GPUTrace::get_trace();
     if (C10_UNLIKELY(interp)) {
       (*interp)->trace_gpu_memory_deallocation(
@@ -3225,11 +3449,134 @@ class NativeCachingAllocator : public CUDAAllocator {
     device_allocator[device]->attachOutOfMemoryObserver(std::move(observer));
   }
 
+  void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) override {
+    // Trackers fire on every device; attach after init() so all the
+    // per-device allocators exist.
+    TORCH_CHECK(
+        initialized(),
+        "attachAllocatorTraceTracker called before the allocator was "
+        "initialized: did you call init?");
+    for (const auto i : c10::irange(device_allocator.size())) {
+      device_allocator[i]->attachAllocatorTraceTracker(
+          [i, tracker](const TraceEntry& te) {
+            tracker(static_cast<int>(i), te);
+          });
+    }
+  }
+
   void emptyCache() override {
     for (auto& da : device_allocator)
       da->emptyCache();
   }
 
+  bool registerRelocationCallback(void* ptr, RelocationCallback cb) override {
+    if (get_allocated_block(ptr) == nullptr) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(relocation_mutex);
+    relocation_callbacks[ptr] = std::move(cb);
+    has_relocation_callbacks.store(true, std::memory_order_relaxed);
+    return true;
+  }
+
+  void unregisterRelocationCallback(void* ptr) override {
+    std::lock_guard<std::mutex> lock(relocation_mutex);
+    relocation_callbacks.erase(ptr);
+    has_relocation_callbacks.store(
+        !relocation_callbacks.empty(), std::memory_order_relaxed);
+  }
+
+  size_t defragment(int device) override {
+    assertValidDevice(device);
+    C10_CUDA_CHECK(c10::cuda::SetDevice(device));
+    // The caller guarantees a quiescent point; the synchronize makes every
+    // pending use of the blocks about to be moved visible, so copies
+    // ordered on the allocation stream are sufficient afterwards.
+    C10_CUDA_CHECK(cudaDeviceSynchronize());
+
+    std::unordered_set<void*> movable;
+    {
+      std::lock_guard<std::mutex> lock(relocation_mutex);
+      movable.reserve(relocation_callbacks.size());
+      for (const auto& entry : relocation_callbacks) {
+        movable.insert(entry.first);
+      }
+    }
+    const size_t reserved_before =
+        device_allocator[device]
+            ->getStats()
+            .reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+            .current;
+
+    for (const auto& candidate :
+         device_allocator[device]->getDefragCandidates(movable)) {
+      // Re-validate: the owner may have dropped the allocation (or its
+      // registration) since the candidate list was taken.
+      Block* block = get_allocated_block(candidate.ptr);
+      if (block == nullptr) {
+        continue;
+      }
+      RelocationCallback callback;
+      {
+        std::lock_guard<std::mutex> lock(relocation_mutex);
+        auto it = relocation_callbacks.find(candidate.ptr);
+        if (it == relocation_callbacks.end()) {
+          continue;
+        }
+        callback = std::move(it->second);
+        relocation_callbacks.erase(it);
+      }
+      void* new_ptr = nullptr;
+      try {
+        malloc(&new_ptr, device, candidate.requested_size, candidate.stream);
+      } catch (const OutOfMemoryError&) {
+        // No room to stage the copy; leave the remaining blocks in place.
+        std::lock_guard<std::mutex> lock(relocation_mutex);
+        relocation_callbacks[candidate.ptr] = std::move(callback);
+        break;
+      }
+      Block* new_block = get_allocated_block(new_ptr);
+      TORCH_INTERNAL_ASSERT(new_block != nullptr);
+      if (!new_block->expandable_segment_ &&
+          device_allocator[device]->getBaseAllocation(new_block, nullptr) ==
+              candidate.segment_base) {
+        // Best-fit placed the staging block back into the segment being
+        // emptied; moving within the segment can't release it, so skip.
+        free(new_ptr);
+        std::lock_guard<std::mutex> lock(relocation_mutex);
+        relocation_callbacks[candidate.ptr] = std::move(callback);
+        continue;
+      }
+      C10_CUDA_CHECK(cudaMemcpyAsync(
+          new_ptr,
+          candidate.ptr,
+          candidate.requested_size,
+          cudaMemcpyDeviceToDevice,
+          candidate.stream));
+      // The callback repoints the owner at new_ptr and frees the old
+      // allocation through the allocator, which drops any stale state.
+      callback(candidate.ptr, new_ptr, candidate.requested_size);
+      if (get_allocated_block(new_ptr) != nullptr) {
+        // Move the registration along with the allocation so repeated
+        // defragment() calls keep working.
+        std::lock_guard<std::mutex> lock(relocation_mutex);
+        relocation_callbacks[new_ptr] = std::move(callback);
+        has_relocation_callbacks.store(true, std::memory_order_relaxed);
+      }
+    }
+
+    // cudaFree implicitly synchronizes, so the pending copies complete
+    // before the emptied segments are handed back to the driver.
+    device_allocator[device]->emptyCache();
+    const size_t reserved_after =
+        device_allocator[device]
+            ->getStats()
+            .reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+            .current;
+    return reserved_before > reserved_after ? reserved_before - reserved_after
+                                            : 0;
+  }
+
   void* getBaseAllocation(void* ptr, size_t* outSize) override {
     Block* block = get_allocated_block(ptr);
     if (!block) {
@@ -3392,6 +3739,39 @@ class NativeCachingAllocator : public CUDAAllocator {
     device_allocator[device]->releasePool(std::move(mempool_id));
   }
 
+  // User pool interactions (see Note [Per-stream user pools])
+  MempoolId_t createUserPool(int device, const std::string& pool_name)
+      override {
+    assertValidDevice(device);
+    return device_allocator[device]->createUserPool(pool_name);
+  }
+
+  void attachPoolToStream(
+      int device,
+      cudaStream_t stream,
+      MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    device_allocator[device]->attachPoolToStream(
+        stream, std::move(mempool_id));
+  }
+
+  void detachPoolFromStream(int device, cudaStream_t stream) override {
+    assertValidDevice(device);
+    device_allocator[device]->detachPoolFromStream(stream);
+  }
+
+  void setPoolMemoryCap(int device, MempoolId_t mempool_id, size_t cap_bytes)
+      override {
+    assertValidDevice(device);
+    device_allocator[device]->setPoolMemoryCap(
+        std::move(mempool_id), cap_bytes);
+  }
+
+  PoolStats getPoolStats(int device, MempoolId_t mempool_id) override {
+    assertValidDevice(device);
+    return device_allocator[device]->getPoolStats(std::move(mempool_id));
+  }
+
   void* raw_alloc(size_t nbytes) override {
     if (nbytes == 0) {
       return nullptr;
@@ -3524,6 +3904,33 @@ void setAllocatorSettings(const std::string& env) {
   CachingAllocatorConfig::instance().parseArgs(env.c_str());
 }
 
+bool markStorageRelocatable(const c10::Storage& storage) {
+  const at::DataPtr& data_ptr = storage.data_ptr();
+  void* ptr = data_ptr.get();
+  if (ptr == nullptr || data_ptr.get_deleter() != get()->raw_deleter()) {
+    // Empty storage, or memory this allocator doesn't own (IPC-shared,
+    // custom DataPtr, ...): nothing defragment() could safely move.
+    return false;
+  }
+  c10::weak_intrusive_ptr<StorageImpl> weak_storage =
+      storage.getWeakStorageImpl();
+  return get()->registerRelocationCallback(
+      ptr, [weak_storage](void* old_ptr, void* new_ptr, size_t /*size*/) {
+        auto storage_impl = weak_storage.lock();
+        if (!storage_impl || storage_impl->data() != old_ptr) {
+          // The storage died or was repointed concurrently (which a proper
+          // quiescent point rules out); drop the staging copy.
+          raw_delete(new_ptr);
+          return;
+        }
+        at::DataPtr new_data_ptr(
+            new_ptr, new_ptr, get()->raw_deleter(), storage_impl->device());
+        // Swapping in the new DataPtr destroys the old one, which frees the
+        // old block through the allocator.
+        storage_impl->set_data_ptr(std::move(new_data_ptr));
+      });
+}
+
 // Size pretty-printer
 std::string format_size(uint64_t size) {
   std::ostringstream os;
@@ -11,9 +11,12 @@
 #include <mutex>
 #include <set>
 #include <unordered_set>
+#include <utility>
 
 namespace c10 {
 
+struct Storage;
+
 // Caching allocator will execute every registered callback if it unable to find
 // block inside of already allocated area.
 class C10_CUDA_API FreeMemoryCallback {
@@ -99,6 +102,21 @@ struct DeviceStats {
   int64_t max_split_size = 0;
 };
 
+// Struct containing memory allocator summary statistics for a single user
+// pool (see createUserPool). Unlike DeviceStats these are not broken down by
+// small/large pool; a user pool is already a deliberately narrow slice of the
+// device.
+struct PoolStats {
+  // COUNT: allocations currently handed out from this pool
+  Stat allocations;
+  // COUNT: number of live cudaMalloc segments owned by this pool
+  Stat segments;
+  // SUM: bytes allocated from this pool
+  Stat allocated_bytes;
+  // SUM: bytes reserved for this pool (both free and used)
+  Stat reserved_bytes;
+};
+
 typedef std::shared_ptr<GatheredContext> (*CreateContextFn)(void);
 
 struct History {
@@ -196,6 +214,25 @@ using OutOfMemoryObserver = std::function<void(
     int64_t device_total,
     int64_t device_free)>;
 
+// Invoked for every TraceEntry (alloc, free, segment map/unmap, ...) recorded
+// while recordHistory is enabled - the same events that fill the ring buffer
+// returned in SnapshotInfo::device_traces. Trackers are called with the device
+// allocator's lock held, so they must be cheap and must not call back into the
+// allocator or acquire the GIL. Stack/correlation info attached by the
+// context recorder (e.g. the profiler's) is available via
+// TraceEntry::context_.
+using AllocatorTraceTracker = std::function<void(int device, const TraceEntry&)>;
+
+// Callback registered for an allocation that defragment() is allowed to
+// move.  It is invoked after the allocator has queued a stream-ordered copy
+// of `size` bytes from `old_ptr` into `new_ptr` on the allocation's stream.
+// The callee must repoint whatever owns `old_ptr` (typically the owning
+// StorageImpl's DataPtr) at `new_ptr` and release `old_ptr` through the
+// allocator as usual; once the callback returns, the old address must no
+// longer be referenced.
+using RelocationCallback =
+    std::function<void(void* old_ptr, void* new_ptr, size_t size)>;
+
 class CUDAAllocator : public Allocator {
  public:
   virtual void* raw_alloc(size_t nbytes) = 0;
@@ -229,6 +266,50 @@ class CUDAAllocator : public Allocator {
         " does not yet support checkPoolLiveAllocations. "
         "If you need it, please file an issue describing your use case.");
   }
+  // Named user pools: like graph pools, but bound to streams outside of
+  // capture so latency-critical streams can be isolated from other work.
+  // See Note [Per-stream user pools].
+  virtual MempoolId_t createUserPool(int device, const std::string& pool_name) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support createUserPool. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void attachPoolToStream(
+      int device,
+      cudaStream_t stream,
+      MempoolId_t mempool_id) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support attachPoolToStream. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void detachPoolFromStream(int device, cudaStream_t stream) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support detachPoolFromStream. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void setPoolMemoryCap(
+      int device,
+      MempoolId_t mempool_id,
+      size_t cap_bytes) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support setPoolMemoryCap. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual PoolStats getPoolStats(int device, MempoolId_t mempool_id) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support getPoolStats. "
+        "If you need it, please file an issue describing your use case.");
+  }
   virtual std::shared_ptr<void> getIpcDevPtr(std::string handle) = 0;
   virtual bool isHistoryEnabled() {
     TORCH_CHECK(
@@ -243,6 +324,39 @@ class CUDAAllocator : public Allocator {
       size_t alloc_trace_max_entries,
       bool alloc_trace_record_context) = 0;
   virtual void attachOutOfMemoryObserver(OutOfMemoryObserver observer) = 0;
+  virtual void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) = 0;
+
+  // Defragmentation support.  registerRelocationCallback marks `ptr` as
+  // movable by defragment(); it returns false if `ptr` was not allocated by
+  // this allocator.  The registration follows the allocation: it is dropped
+  // when the allocation is freed and transferred to the new address when
+  // defragment() moves it.
+  virtual bool registerRelocationCallback(void* ptr, RelocationCallback cb) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support relocation callbacks. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  virtual void unregisterRelocationCallback(void* ptr) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support relocation callbacks. "
+        "If you need it, please file an issue describing your use case.");
+  }
+  // Compacts the device's memory by migrating movable allocations out of
+  // sparsely used segments and returning the emptied, cached segments to
+  // the driver.  May only be called at a quiescent point: no kernels in
+  // flight that use allocator memory, and no concurrent allocations.
+  // Returns the number of reserved bytes released back to CUDA.
+  virtual size_t defragment(int device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support defragment. "
+        "If you need it, please file an issue describing your use case.");
+  }
 
   virtual void enablePeerAccess(int dev, int dev_to_access) = 0;
 
@@ -362,6 +476,33 @@ inline void endAllocateStreamToPool(int device, cudaStream_t stream) {
   return get()->endAllocateStreamToPool(device, stream);
 }
 
+// User pool interactions (see Note [Per-stream user pools])
+inline MempoolId_t createUserPool(int device, const std::string& pool_name) {
+  return get()->createUserPool(device, pool_name);
+}
+
+inline void attachPoolToStream(
+    int device,
+    cudaStream_t stream,
+    MempoolId_t mempool_id) {
+  return get()->attachPoolToStream(device, stream, mempool_id);
+}
+
+inline void detachPoolFromStream(int device, cudaStream_t stream) {
+  return get()->detachPoolFromStream(device, stream);
+}
+
+inline void setPoolMemoryCap(
+    int device,
+    MempoolId_t mempool_id,
+    size_t cap_bytes) {
+  return get()->setPoolMemoryCap(device, mempool_id, cap_bytes);
+}
+
+inline PoolStats getPoolStats(int device, MempoolId_t mempool_id) {
+  return get()->getPoolStats(device, mempool_id);
+}
+
 inline void recordHistory(
     bool enabled,
     CreateContextFn context_recorder,
@@ -390,9 +531,31 @@ inline void attachOutOfMemoryObserver(OutOfMemoryObserver observer) {
   return get()->attachOutOfMemoryObserver(observer);
 }
 
+inline void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) {
+  return get()->attachAllocatorTraceTracker(std::move(tracker));
+}
+
 inline void releasePool(int device, MempoolId_t mempool_id) {
   return get()->releasePool(device, mempool_id);
 }
+
+inline bool registerRelocationCallback(void* ptr, RelocationCallback cb) {
+  return get()->registerRelocationCallback(ptr, std::move(cb));
+}
+
+inline void unregisterRelocationCallback(void* ptr) {
+  return get()->unregisterRelocationCallback(ptr);
+}
+
+inline size_t defragment(int device) {
+  return get()->defragment(device);
+}
+
+// Convenience wrapper for the common owner: registers a relocation callback
+// that repoints `storage`'s DataPtr when defragment() moves its allocation.
+// Returns false if the storage's memory was not allocated by the native
+// caching allocator.
+C10_CUDA_API bool markStorageRelocatable(const c10::Storage& storage);
 // Not part of CUDA_ALLOCATOR_BACKEND_INTERFACE
 inline std::shared_ptr<void> getIpcDevPtr(std::string handle) {
   return get()->getIpcDevPtr(handle);
@@ -12,6 +12,8 @@ def define_targets(rules):
     rules.cc_test(
         name = "test",
         srcs = [
+            "impl/CUDADefragTest.cpp",
+            "impl/CUDAUserPoolTest.cpp",
             "impl/CUDATest.cpp",
         ],
         target_compatible_with = rules.requires_cuda_enabled(),
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/Storage.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+
+#include <cuda_runtime.h>
+
+#include <vector>
+
+namespace {
+
+// 2MB allocations land in the large pool, which carves them out of 20MB
+// segments; keeping one block per segment alive produces the sparse
+// segments that defragment() targets.
+constexpr size_t kBlockSize = 2 * 1024 * 1024;
+constexpr int kBlocksTotal = 30;
+constexpr int kKeepEvery = 10;
+
+} // namespace
+
+TEST(CUDADefragTest, MigratesAndReclaims) {
+  if (c10::cuda::device_count() == 0) {
+    GTEST_SKIP() << "No CUDA devices";
+  }
+  c10::cuda::CUDACachingAllocator::init(c10::cuda::device_count());
+  auto* allocator = c10::cuda::CUDACachingAllocator::get();
+
+  // Fill several segments, then free all but one block per segment.
+  std::vector<c10::Storage> all;
+  for (int i = 0; i < kBlocksTotal; ++i) {
+    all.emplace_back(
+        c10::Storage::use_byte_size_t(),
+        kBlockSize,
+        allocator->allocate(kBlockSize),
+        /*allocator=*/nullptr,
+        /*resizable=*/false);
+  }
+  std::vector<c10::Storage> survivors;
+  std::vector<std::vector<char>> expected;
+  for (int i = 0; i < kBlocksTotal; ++i) {
+    if (i % kKeepEvery != 0) {
+      continue;
+    }
+    std::vector<char> host(kBlockSize, static_cast<char>(i + 1));
+    C10_CUDA_CHECK(cudaMemcpy(
+        all[i].mutable_data(), host.data(), kBlockSize, cudaMemcpyHostToDevice));
+    ASSERT_TRUE(
+        c10::cuda::CUDACachingAllocator::markStorageRelocatable(all[i]));
+    survivors.push_back(all[i]);
+    expected.push_back(std::move(host));
+  }
+  all.clear();
+
+  C10_CUDA_CHECK(cudaDeviceSynchronize());
+  const size_t reclaimed = c10::cuda::CUDACachingAllocator::defragment(0);
+  // Migration must empty at least one of the sparse segments.
+  EXPECT_GT(reclaimed, 0u);
+
+  // The survivors' contents must be intact at their (possibly new)
+  // addresses.
+  for (size_t i = 0; i < survivors.size(); ++i) {
+    std::vector<char> host(kBlockSize);
+    C10_CUDA_CHECK(cudaMemcpy(
+        host.data(), survivors[i].data(), kBlockSize, cudaMemcpyDeviceToHost));
+    EXPECT_EQ(host, expected[i]);
+  }
+}
+
+TEST(CUDADefragTest, UnregisteredAllocationsStayPut) {
+  if (c10::cuda::device_count() == 0) {
+    GTEST_SKIP() << "No CUDA devices";
+  }
+  c10::cuda::CUDACachingAllocator::init(c10::cuda::device_count());
+  auto* allocator = c10::cuda::CUDACachingAllocator::get();
+
+  c10::Storage storage(
+      c10::Storage::use_byte_size_t(),
+      kBlockSize,
+      allocator->allocate(kBlockSize),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+  void* ptr = storage.mutable_data();
+
+  C10_CUDA_CHECK(cudaDeviceSynchronize());
+  c10::cuda::CUDACachingAllocator::defragment(0);
+  // Without a relocation callback the allocation must not move.
+  EXPECT_EQ(storage.data(), ptr);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/Storage.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <cuda_runtime.h>
+
+namespace {
+
+// Large enough to land in the large pool and be reserved 1:1 (>= 10MB
+// allocations are rounded to themselves rather than carved from 20MB
+// segments), which makes the reserved-bytes cap predictable.
+constexpr size_t kBlockSize = 32 * 1024 * 1024;
+
+c10::Storage allocate_storage(size_t size) {
+  return c10::Storage(
+      c10::Storage::use_byte_size_t(),
+      size,
+      c10::cuda::CUDACachingAllocator::get()->allocate(size),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+}
+
+} // namespace
+
+TEST(CUDAUserPoolTest, IsolatesStatsAndEnforcesCap) {
+  if (c10::cuda::device_count() == 0) {
+    GTEST_SKIP() << "No CUDA devices";
+  }
+  c10::cuda::CUDACachingAllocator::init(c10::cuda::device_count());
+
+  const auto pool_id =
+      c10::cuda::CUDACachingAllocator::createUserPool(0, "serving");
+  // Creating the same name again must return the same pool.
+  ASSERT_EQ(
+      c10::cuda::CUDACachingAllocator::createUserPool(0, "serving"), pool_id);
+
+  const auto stream = c10::cuda::getCurrentCUDAStream(0).stream();
+  c10::cuda::CUDACachingAllocator::attachPoolToStream(0, stream, pool_id);
+  c10::cuda::CUDACachingAllocator::setPoolMemoryCap(
+      0, pool_id, 2 * kBlockSize + kBlockSize / 2);
+
+  {
+    auto first = allocate_storage(kBlockSize);
+    auto second = allocate_storage(kBlockSize);
+
+    auto stats = c10::cuda::CUDACachingAllocator::getPoolStats(0, pool_id);
+    EXPECT_EQ(stats.allocations.current, 2);
+    EXPECT_GE(
+        stats.allocated_bytes.current, static_cast<int64_t>(2 * kBlockSize));
+    EXPECT_GE(
+        stats.reserved_bytes.current, static_cast<int64_t>(2 * kBlockSize));
+
+    // A third block would push reserved bytes past the pool's cap.
+    EXPECT_THROW(allocate_storage(kBlockSize), c10::OutOfMemoryError);
+  }
+
+  // The blocks are freed back to the pool: nothing allocated, but segments
+  // stay reserved for the pool.
+  auto stats = c10::cuda::CUDACachingAllocator::getPoolStats(0, pool_id);
+  EXPECT_EQ(stats.allocations.current, 0);
+  EXPECT_GE(
+      stats.reserved_bytes.current, static_cast<int64_t>(2 * kBlockSize));
+
+  // Detached streams go back to the default pools.
+  c10::cuda::CUDACachingAllocator::detachPoolFromStream(0, stream);
+  {
+    auto outside = allocate_storage(kBlockSize);
+    auto after = c10::cuda::CUDACachingAllocator::getPoolStats(0, pool_id);
+    EXPECT_EQ(after.allocations.current, 0);
+    EXPECT_EQ(after.reserved_bytes.current, stats.reserved_bytes.current);
+  }
+
+  // Releasing the pool allows emptyCache to return its segments; the pool
+  // (and its name) are then gone.
+  c10::cuda::CUDACachingAllocator::releasePool(0, pool_id);
+  c10::cuda::CUDACachingAllocator::emptyCache();
+  EXPECT_THROW(
+      c10::cuda::CUDACachingAllocator::getPoolStats(0, pool_id), c10::Error);
+}
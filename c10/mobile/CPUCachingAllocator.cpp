@@ -1,22 +1,130 @@
 #include <c10/mobile/CPUCachingAllocator.h>
 
 #include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
 
 namespace c10 {
 
 namespace {
 thread_local CPUCachingAllocator* caching_allocator_ptr{nullptr};
-} // namespace
 
-std::mutex CPUCachingAllocator::mutex_;
-ska::flat_hash_map<void*, size_t> CPUCachingAllocator::allocation_map_;
+// Size classes double from 64 bytes (the alignment of alloc_cpu) up to
+// 1 MiB; anything larger, and zero-byte requests, go through the exact
+// size-keyed available_map_.
+constexpr size_t kMinSizeClassLog2 = 6;
+constexpr size_t kMaxSizeClassLog2 = 20;
+constexpr size_t kNumSizeClasses = kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+// Both the allocation map and the reclaim tier are split over this many
+// independently locked shards so that concurrent inference threads do not
+// serialize on a single mutex.
+constexpr size_t kNumShards = 8;
+
+std::atomic<size_t> max_blocks_per_size_class{16};
+
+// Pointer -> requested-size map of live allocations, sharded by pointer.
+// Replaces the former single static map behind a single static mutex.
+struct AllocationMapShard {
+  std::mutex mutex;
+  ska::flat_hash_map<void*, size_t> map;
+};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<AllocationMapShard, kNumShards> allocation_map_shards;
+
+// Middle cache tier: blocks spilled from per-thread free lists, available
+// to all threads. Sharded like the allocation map.
+struct ReclaimShard {
+  std::mutex mutex;
+  std::array<c10::SmallVector<void*, 16>, kNumSizeClasses> lists;
+};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<ReclaimShard, kNumShards> reclaim_shards;
+
+size_t shard_of(const void* ptr) {
+  // alloc_cpu returns 64-byte aligned memory, so skip the always-zero low
+  // bits before taking the modulus.
+  return (reinterpret_cast<uintptr_t>(ptr) >> 6) % kNumShards;
+}
+
+// Returns kNumSizeClasses for sizes the class tiers do not handle.
+size_t size_class_of(const size_t bytes) {
+  if (bytes == 0 || bytes > (static_cast<size_t>(1) << kMaxSizeClassLog2)) {
+    return kNumSizeClasses;
+  }
+  const size_t log2 = llvm::Log2_64_Ceil(bytes);
+  return log2 <= kMinSizeClassLog2 ? 0 : log2 - kMinSizeClassLog2;
+}
+
+size_t size_class_bytes(const size_t size_class) {
+  return static_cast<size_t>(1) << (size_class + kMinSizeClassLog2);
+}
+
+AllocationMapShard& allocation_shard_of(const void* ptr) {
+  return allocation_map_shards[shard_of(ptr)];
+}
+
+void record_allocation(void* ptr, const size_t bytes) {
+  AllocationMapShard& shard = allocation_shard_of(ptr);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  shard.map[ptr] = bytes;
+}
+
+// Returns the recorded size of ptr, or 0 if this allocator does not own it.
+// Zero-byte allocations map to a nullptr entry and never reach here.
+size_t lookup_allocation(void* ptr) {
+  AllocationMapShard& shard = allocation_shard_of(ptr);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  const auto& it = shard.map.find(ptr);
+  return it == shard.map.end() ? 0 : it->second;
+}
+
+// Returns a cached block to the OS: removes it from the allocation map and
+// frees the memory. Must not be called with any shard mutex held.
+void release_block(void* ptr) {
+  {
+    AllocationMapShard& shard = allocation_shard_of(ptr);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.map.erase(ptr);
+  }
+  c10::free_cpu(ptr);
+}
+
+// Fast cache tier: per-thread free lists, one per size class. Pushing and
+// popping here takes no lock. On thread exit cached blocks are returned to
+// the OS rather than handed to the reclaim tier, so a short-lived thread
+// cannot strand memory.
+struct ThreadLocalFreeLists {
+  std::array<c10::SmallVector<void*, 16>, kNumSizeClasses> lists;
+  // Home reclaim shard for spills and the first probe on a miss; derived
+  // from the TLS address so threads spread over shards.
+  size_t home_shard;
+
+  ThreadLocalFreeLists() : home_shard(shard_of(this)) {}
+
+  ~ThreadLocalFreeLists() {
+    for (auto& list : lists) {
+      for (const auto ptr : list) {
+        release_block(ptr);
+      }
+    }
+  }
+};
+
+ThreadLocalFreeLists& thread_local_free_lists() {
+  static thread_local ThreadLocalFreeLists lists;
+  return lists;
+}
+} // namespace
 
 inline void* CPUCachingAllocator::allocate_and_cache(const size_t bytes) {
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   void* ptr;
   try {
     ptr = c10::alloc_cpu(bytes);
-  } catch (c10::Error& e) {
+  } catch (c10::Error&) {
     // If allocation fails, try freeing cached available blocks.
     // For now free all available cached blocks.
     free_cached();
@@ -26,17 +134,42 @@ inline void* CPUCachingAllocator::allocate_and_cache(const size_t bytes) {
     // Try again.
     ptr = c10::alloc_cpu(bytes);
   }
-  allocation_map_[ptr] = bytes;
+  record_allocation(ptr, bytes);
   return ptr;
 }
 
 void* CPUCachingAllocator::allocate(const size_t bytes) {
-  std::lock_guard<std::mutex> guard(mutex_);
-  const auto& it = available_map_.find(bytes);
-  if (it == available_map_.end() || it->second.empty()) {
-    return allocate_and_cache(bytes);
+  const size_t size_class = size_class_of(bytes);
+  if (size_class < kNumSizeClasses) {
+    // Lock-free fast path: reuse a block this thread freed earlier.
+    auto& list = thread_local_free_lists().lists[size_class];
+    if (!list.empty()) {
+      return list.pop_back_val();
+    }
+    // Probe the home reclaim shard and one neighbor for blocks spilled by
+    // other threads; probing all shards would reintroduce the very
+    // contention the sharding avoids.
+    const size_t home = thread_local_free_lists().home_shard;
+    for (size_t probe = 0; probe < 2; ++probe) {
+      ReclaimShard& shard = reclaim_shards[(home + probe) % kNumShards];
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      auto& shard_list = shard.lists[size_class];
+      if (!shard_list.empty()) {
+        return shard_list.pop_back_val();
+      }
+    }
+    // Allocate the full class size so any same-class request can reuse
+    // this block without a size lookup.
+    return allocate_and_cache(size_class_bytes(size_class));
   }
-  return it->second.pop_back_val();
+  {
+    std::lock_guard<std::mutex> guard(available_mutex_);
+    const auto& it = available_map_.find(bytes);
+    if (it != available_map_.end() && !it->second.empty()) {
+      return it->second.pop_back_val();
+    }
+  }
+  return allocate_and_cache(bytes);
 }
 
 void CPUCachingAllocator::free(void* ptr) {
@@ -44,19 +177,45 @@ void CPUCachingAllocator::free(void* ptr) {
   // the cases such as quantization code freeing original weights
   // on mobile, will not quite work, as we likely will hold
   // onto that memory.
-  // NB: We can also enable max memory cached for better memory
-  // management such that free will actually free the memory if
-  // we are nearing or above the watermark.
-  std::lock_guard<std::mutex> guard(mutex_);
   // If this allocation was done before caching allocator was enabled
   // then free regularly
-  const auto& it = allocation_map_.find(ptr);
-  if (it == allocation_map_.end()) {
+  const size_t alloc_size = lookup_allocation(ptr);
+  if (alloc_size == 0 && ptr != nullptr) {
     c10::free_cpu(ptr);
     return;
   }
-  const size_t alloc_size = it->second;
-  available_map_[alloc_size].push_back(ptr);
+  const size_t size_class = size_class_of(alloc_size);
+  if (size_class >= kNumSizeClasses) {
+    std::lock_guard<std::mutex> guard(available_mutex_);
+    available_map_[alloc_size].push_back(ptr);
+    return;
+  }
+  auto& list = thread_local_free_lists().lists[size_class];
+  list.push_back(ptr);
+  const size_t cap = max_blocks_per_size_class.load(std::memory_order_relaxed);
+  if (list.size() <= cap) {
+    return;
+  }
+  // Over the per-thread cap: spill half of the list to the home reclaim
+  // shard so other threads can reuse the blocks, and return anything over
+  // the shard's own cap to the OS to respect the memory budget.
+  c10::SmallVector<void*, 16> overflow;
+  {
+    ReclaimShard& shard = reclaim_shards[thread_local_free_lists().home_shard];
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto& shard_list = shard.lists[size_class];
+    const size_t shard_cap = cap * 4;
+    for (size_t spill = (list.size() + 1) / 2; spill > 0; --spill) {
+      if (shard_list.size() < shard_cap) {
+        shard_list.push_back(list.pop_back_val());
+      } else {
+        overflow.push_back(list.pop_back_val());
+      }
+    }
+  }
+  for (const auto overflow_ptr : overflow) {
+    release_block(overflow_ptr);
+  }
 }
 
 void CPUCachingAllocator::record_free(void* ptr) {
@@ -69,23 +228,57 @@ void CPUCachingAllocator::record_free(void* ptr) {
   // If the memory is freed in some other way, then we will likely
   // have undefined behavior or page fault. But this can be
   // the case without caching allocator as well.
-  std::lock_guard<std::mutex> guard(mutex_);
-  const auto& it = allocation_map_.find(ptr);
-  if (it != allocation_map_.end()) {
-    allocation_map_.erase(it);
+  AllocationMapShard& shard = allocation_shard_of(ptr);
+  std::lock_guard<std::mutex> guard(shard.mutex);
+  const auto& it = shard.map.find(ptr);
+  if (it != shard.map.end()) {
+    shard.map.erase(it);
   }
 }
 
+void CPUCachingAllocator::SetMaxBlocksPerSizeClass(size_t max_blocks) {
+  max_blocks_per_size_class.store(max_blocks, std::memory_order_relaxed);
+}
+
+size_t CPUCachingAllocator::GetMaxBlocksPerSizeClass() {
+  return max_blocks_per_size_class.load(std::memory_order_relaxed);
+}
+
 void CPUCachingAllocator::free_cached() {
-  for (const auto& it : available_map_) {
-    for (const auto ptr : it.second) {
-      c10::free_cpu(ptr);
-      // When cached memory is return to OS, it must be removed
-      // from allocation_map.
-      allocation_map_.erase(ptr);
+  // Called on destruction and when an allocation fails: return every cached
+  // block to the OS. The OOM-retry path in allocate_and_cache needs real
+  // recovery, so all tiers are drained, including the shared ones and the
+  // calling thread's free lists. Each tier is unlinked under its own lock
+  // and the memory freed afterwards; release_block takes shard locks
+  // itself.
+  c10::SmallVector<void*, 16> to_release;
+  {
+    std::lock_guard<std::mutex> guard(available_mutex_);
+    for (const auto& it : available_map_) {
+      for (const auto ptr : it.second) {
+        to_release.push_back(ptr);
+      }
+    }
+    available_map_.clear();
+  }
+  for (auto& shard : reclaim_shards) {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    for (auto& list : shard.lists) {
+      for (const auto ptr : list) {
+        to_release.push_back(ptr);
+      }
+      list.clear();
     }
   }
-  available_map_.clear();
+  for (auto& list : thread_local_free_lists().lists) {
+    for (const auto ptr : list) {
+      to_release.push_back(ptr);
+    }
+    list.clear();
+  }
+  for (const auto ptr : to_release) {
+    release_block(ptr);
+  }
 }
 
 CPUCachingAllocator::~CPUCachingAllocator() {
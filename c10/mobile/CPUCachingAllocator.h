@@ -46,8 +46,11 @@ class C10_API CPUCachingAllocator {
   /*
    * What it does:
    * Caches all the allocations carried out by this allocator.
-   * Cache key is the size of the allocation.
-   * If requested size is found in the cache returns the cached pointer.
+   * Allocations up to 1 MiB are rounded up to power-of-two size classes
+   * and cached in per-thread free lists backed by a sharded global reclaim
+   * tier: a cache hit on the freeing thread takes no lock at all, and the
+   * remaining paths lock a single shard instead of a global mutex. Larger
+   * allocations are keyed exactly by size in available_map_ as before.
    * What it does not do:
    * No speculative allocation for any future allocations.
    */
@@ -58,28 +61,43 @@ class C10_API CPUCachingAllocator {
  protected:
   // Invariants.
   // 1. If memory is ever allocated via this allocator then
-  //    the pointer will exist in allocation_map_, unless the allocator
+  //    the pointer will exist in the allocation map, unless the allocator
   //    returned the memory to OS via free_cached.
   //  1.1. Therefore even when the said memory is "freed" via this
   //       allocator (and thus cached), it will continue to stay
-  //       in allocation_map_. Furthermore it will also exist in
-  //       available_map_. Thus an allocated memory pointer can be in both
-  //       allocation_map_ and available_map_ simultaneously.
-  // 2. Memory pointer maybe removed from allocation_map_, when it
+  //       in the allocation map. Furthermore it will also exist in
+  //       exactly one cache tier: a per-thread free list, the shared
+  //       reclaim tier or available_map_. Thus an allocated memory
+  //       pointer can be in both the allocation map and a cache tier
+  //       simultaneously.
+  // 2. Memory pointer maybe removed from the allocation map, when it
   //    is freed outside of the scope of this allocator, but was allocated
   //    by this allocator.
-  // 3. Available map only contains that memory which was allocated
+  // 3. Cache tiers only contain that memory which was allocated
   //    by this allocator and subsequently freed by this allocator.
   // As a result of above invariants, allocated memory ptr cannot be in
-  // available_map_ unless it is in allocation_map_ as well.
+  // a cache tier unless it is in the allocation map as well.
+  //
+  // The allocation map and the size-class tiers are global state shared by
+  // all instances (as the predecessor, a single map behind a single static
+  // mutex, was); they live in the translation unit, with the map split
+  // over independently locked shards keyed by pointer. A block cached by
+  // one instance may satisfy another instance's request, which is safe
+  // because block lifetime is tracked by the allocation map rather than by
+  // the instance. Only the exact-size overflow cache below is per
+  // instance.
   ska::flat_hash_map<size_t, c10::SmallVector<void*, 16>> available_map_;
-  static ska::flat_hash_map<void*, size_t> allocation_map_;
-  // Since allocation_map, which is a global instance, is mutated/read via
-  // all public APIs we need a global mutex.
-  static std::mutex mutex_;
+  std::mutex available_mutex_;
 
  public:
   static void record_free(void* ptr);
+  // Caps how many cached blocks each thread may keep per size class; the
+  // shared reclaim tier holds up to four times this per shard and class,
+  // and blocks beyond that are returned to the OS on free. Lower it to
+  // respect a tight on-device memory budget, at the cost of more round
+  // trips to the system allocator. Takes effect for subsequent frees.
+  static void SetMaxBlocksPerSizeClass(size_t max_blocks);
+  static size_t GetMaxBlocksPerSizeClass();
   virtual ~CPUCachingAllocator();
   // Checks the cache to see if allocation of size bytes can be found.
   // If so return cached memory, else
@@ -0,0 +1,54 @@
+#include <c10/core/impl/LocalDispatchKeySet.h>
+
+#include <gtest/gtest.h>
+
+using c10::DispatchKey;
+using c10::DispatchKeySet;
+
+// tls_local_dispatch_key_set() serves a versioned cache of the composed key
+// sets; these tests pin down that every mutation path invalidates it.
+
+TEST(LocalDispatchKeySetTest, CacheTracksGuards) {
+  const auto base = c10::impl::tls_local_dispatch_key_set();
+  {
+    c10::impl::IncludeDispatchKeyGuard include(DispatchKey::AutocastCPU);
+    EXPECT_TRUE(c10::impl::tls_local_dispatch_key_set().included_.has(
+        DispatchKey::AutocastCPU));
+    {
+      c10::impl::ExcludeDispatchKeyGuard exclude(DispatchKey::AutocastCPU);
+      const auto tls = c10::impl::tls_local_dispatch_key_set();
+      EXPECT_TRUE(tls.included_.has(DispatchKey::AutocastCPU));
+      EXPECT_TRUE(tls.excluded_.has(DispatchKey::AutocastCPU));
+    }
+    EXPECT_FALSE(c10::impl::tls_local_dispatch_key_set().excluded_.has(
+        DispatchKey::AutocastCPU));
+  }
+  const auto restored = c10::impl::tls_local_dispatch_key_set();
+  EXPECT_EQ(restored.included_, base.included_);
+  EXPECT_EQ(restored.excluded_, base.excluded_);
+}
+
+TEST(LocalDispatchKeySetTest, CacheTracksNonRAIISetters) {
+  const bool prev =
+      c10::impl::tls_is_dispatch_key_included(DispatchKey::AutocastCPU);
+  c10::impl::tls_set_dispatch_key_included(DispatchKey::AutocastCPU, true);
+  EXPECT_TRUE(c10::impl::tls_local_dispatch_key_set().included_.has(
+      DispatchKey::AutocastCPU));
+  c10::impl::tls_set_dispatch_key_included(DispatchKey::AutocastCPU, false);
+  EXPECT_FALSE(c10::impl::tls_local_dispatch_key_set().included_.has(
+      DispatchKey::AutocastCPU));
+  c10::impl::tls_set_dispatch_key_included(DispatchKey::AutocastCPU, prev);
+}
+
+TEST(LocalDispatchKeySetTest, CacheTracksForcedState) {
+  const auto base = c10::impl::tls_local_dispatch_key_set();
+  {
+    c10::impl::ForceDispatchKeyGuard force(c10::impl::LocalDispatchKeySet(
+        base.included_.add(DispatchKey::AutocastCPU), base.excluded_));
+    EXPECT_TRUE(c10::impl::tls_local_dispatch_key_set().included_.has(
+        DispatchKey::AutocastCPU));
+  }
+  const auto restored = c10::impl::tls_local_dispatch_key_set();
+  EXPECT_EQ(restored.included_, base.included_);
+  EXPECT_EQ(restored.excluded_, base.excluded_);
+}
@@ -418,3 +418,25 @@ TEST(SizesAndStridesTest, MoveAssignmentSelf) {
   selfMove(big, big);
   checkBig(big);
 }
+
+TEST(SizesAndStridesTest, OutOfLineAllocationCounter) {
+  const auto baseline = sizesAndStridesOutOfLineAllocations();
+
+  // Staying inline doesn't count.
+  SizesAndStrides sz;
+  sz.resize(C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE);
+  EXPECT_EQ(sizesAndStridesOutOfLineAllocations(), baseline);
+
+  // Growing past the inline capacity counts once.
+  sz.resize(C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE + 1);
+  EXPECT_EQ(sizesAndStridesOutOfLineAllocations(), baseline + 1);
+
+  // Growing an already out-of-line container is a realloc, not a new
+  // fall-out.
+  sz.resize(C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE + 3);
+  EXPECT_EQ(sizesAndStridesOutOfLineAllocations(), baseline + 1);
+
+  // Copying an out-of-line container allocates again.
+  SizesAndStrides copy(sz);
+  EXPECT_EQ(sizesAndStridesOutOfLineAllocations(), baseline + 2);
+}
@@ -0,0 +1,90 @@
+#include <c10/core/impl/cow/COW.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/StorageImpl.h>
+#include <c10/core/impl/cow/context.h>
+#include <c10/util/intrusive_ptr.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace c10::impl {
+namespace {
+
+auto new_storage(std::size_t nbytes) -> c10::intrusive_ptr<StorageImpl> {
+  return c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      nbytes,
+      GetCPUAllocator(),
+      /*resizable=*/false);
+}
+
+TEST(CowTest, has_simple_data_ptr) {
+  auto storage = new_storage(16);
+  ASSERT_THAT(cow::has_simple_data_ptr(*storage), testing::IsTrue());
+
+  // A non-owning DataPtr (no context) is not simple.
+  auto external = c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      16,
+      at::DataPtr(storage->mutable_data(), DeviceType::CPU),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+  ASSERT_THAT(cow::has_simple_data_ptr(*external), testing::IsFalse());
+}
+
+TEST(CowTest, lazy_clone_storage_shares_data) {
+  auto storage = new_storage(16);
+  std::memset(storage->mutable_data(), 0xab, 16);
+
+  auto copy = cow::lazy_clone_storage(*storage);
+  ASSERT_THAT(copy, testing::NotNull());
+
+  // Both storages are now copy-on-write and alias the same allocation.
+  ASSERT_THAT(cow::is_cow_data_ptr(storage->data_ptr()), testing::IsTrue());
+  ASSERT_THAT(cow::is_cow_data_ptr(copy->data_ptr()), testing::IsTrue());
+  ASSERT_THAT(copy->data(), testing::Eq(storage->data()));
+
+  // Cloning a storage that is already copy-on-write also works.
+  auto second_copy = cow::lazy_clone_storage(*storage);
+  ASSERT_THAT(second_copy, testing::NotNull());
+  ASSERT_THAT(second_copy->data(), testing::Eq(storage->data()));
+}
+
+TEST(CowTest, lazy_clone_storage_refuses_external_data) {
+  int data = 0;
+  auto storage = c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      sizeof(data),
+      at::DataPtr(&data, DeviceType::CPU),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+  ASSERT_THAT(cow::lazy_clone_storage(*storage), testing::IsNull());
+}
+
+TEST(CowTest, materialize_copies_then_steals) {
+  auto storage = new_storage(16);
+  std::memset(storage->mutable_data(), 0xab, 16);
+  const void* original_data = storage->data();
+
+  auto copy = cow::lazy_clone_storage(*storage);
+  ASSERT_THAT(copy, testing::NotNull());
+
+  // Materializing the copy while the original still holds a reference
+  // gives the copy its own allocation with the same bytes.
+  cow::materialize_cow_storage(*copy);
+  ASSERT_THAT(cow::is_cow_data_ptr(copy->data_ptr()), testing::IsFalse());
+  ASSERT_THAT(copy->data(), testing::Ne(original_data));
+  ASSERT_THAT(std::memcmp(copy->data(), original_data, 16), testing::Eq(0));
+
+  // Materializing the last reference steals the data without copying.
+  cow::materialize_cow_storage(*storage);
+  ASSERT_THAT(cow::is_cow_data_ptr(storage->data_ptr()), testing::IsFalse());
+  ASSERT_THAT(storage->data(), testing::Eq(original_data));
+}
+
+} // namespace
+} // namespace c10::impl
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/thread_pool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(ThreadPoolTest, HighPriorityTasksOvertakeLowPriorityTasks) {
+  c10::ThreadPool pool(/*pool_size=*/1);
+
+  std::mutex gate_mutex;
+  std::condition_variable gate_cv;
+  bool release = false;
+
+  std::mutex order_mutex;
+  std::vector<int> order;
+
+  // Occupy the only worker so subsequently queued tasks stay queued.
+  pool.run([&]() {
+    std::unique_lock<std::mutex> lock(gate_mutex);
+    gate_cv.wait(lock, [&]() { return release; });
+  });
+  while (pool.numAvailable() != 0) {
+    std::this_thread::yield();
+  }
+
+  pool.run(
+      [&]() {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(2);
+      },
+      c10::TaskPriority::Low);
+  pool.run(
+      [&]() {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(1);
+      },
+      c10::TaskPriority::High);
+
+  EXPECT_EQ(pool.queuedTasks(c10::TaskPriority::High), 1);
+  EXPECT_EQ(pool.queuedTasks(c10::TaskPriority::Low), 1);
+
+  {
+    std::lock_guard<std::mutex> lock(gate_mutex);
+    release = true;
+  }
+  gate_cv.notify_all();
+  pool.waitWorkComplete();
+
+  // The High task was submitted last but must run first.
+  EXPECT_EQ(order, (std::vector<int>{1, 2}));
+  EXPECT_EQ(pool.queuedTasks(c10::TaskPriority::High), 0);
+  EXPECT_EQ(pool.queuedTasks(c10::TaskPriority::Low), 0);
+}
+
+TEST(ThreadPoolTest, LowPriorityTasksRunWhenNoHighWorkIsQueued) {
+  c10::ThreadPool pool(/*pool_size=*/2);
+  std::atomic<int> count{0};
+  for (int i = 0; i < 8; ++i) {
+    pool.run([&]() { ++count; }, c10::TaskPriority::Low);
+  }
+  pool.waitWorkComplete();
+  EXPECT_EQ(count, 8);
+}
+
+} // namespace
@@ -0,0 +1,49 @@
+#include <c10/util/xxh64.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+uint64_t hash_str(const char* s, uint64_t seed) {
+  return c10::util::xxh64(s, std::strlen(s), seed);
+}
+
+} // namespace
+
+TEST(xxh64_test, ReferenceVectors) {
+  // Digests taken from the reference XXH64 implementation.
+  EXPECT_EQ(hash_str("", 0), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(hash_str("a", 0), 0xD24EC4F1A98C6E5BULL);
+  EXPECT_EQ(hash_str("abc", 0), 0x44BC2CF5AD770999ULL);
+}
+
+TEST(xxh64_test, SeedChangesDigest) {
+  EXPECT_NE(hash_str("abc", 0), hash_str("abc", 1));
+  EXPECT_NE(hash_str("", 0), hash_str("", 1));
+}
+
+TEST(xxh64_test, CoversAllTailPaths) {
+  // Lengths chosen to exercise the 32-byte stripe loop, the 8-byte and
+  // 4-byte tails, and the final byte loop, in every combination.
+  std::vector<uint8_t> data(97);
+  std::iota(data.begin(), data.end(), 0);
+  uint64_t previous = 0;
+  for (size_t len = 0; len <= data.size(); ++len) {
+    const uint64_t digest = c10::util::xxh64(data.data(), len, 0);
+    // Each added byte must change the digest (true for this input; XXH64
+    // digests of prefixes are pairwise distinct here).
+    EXPECT_NE(digest, previous) << "len=" << len;
+    // Digests are position-sensitive, not just content-sensitive.
+    if (len >= 2) {
+      std::vector<uint8_t> swapped(data.begin(), data.begin() + len);
+      std::swap(swapped[0], swapped[len - 1]);
+      EXPECT_NE(digest, c10::util::xxh64(swapped.data(), len, 0))
+          << "len=" << len;
+    }
+    previous = digest;
+  }
+}
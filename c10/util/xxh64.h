@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace c10 {
+namespace util {
+
+// A small, dependency-free implementation of the XXH64 hash (Yann Collet's
+// xxHash, BSD 2-clause). Produces bit-identical digests to the reference
+// XXH64(data, len, seed) on little-endian targets. It exists for cheap
+// content fingerprinting (see TensorImpl::content_fingerprint()) where a
+// cryptographic hash would be overkill and an extra third-party dependency
+// is not warranted.
+
+namespace detail {
+
+constexpr uint64_t kXXH64Prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kXXH64Prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kXXH64Prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kXXH64Prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kXXH64Prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t xxh64_rotl(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t xxh64_read64(const uint8_t* p) {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint32_t xxh64_read32(const uint8_t* p) {
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+  acc += input * kXXH64Prime2;
+  acc = xxh64_rotl(acc, 31);
+  acc *= kXXH64Prime1;
+  return acc;
+}
+
+inline uint64_t xxh64_merge_round(uint64_t acc, uint64_t val) {
+  acc ^= xxh64_round(0, val);
+  acc = acc * kXXH64Prime1 + kXXH64Prime4;
+  return acc;
+}
+
+} // namespace detail
+
+inline uint64_t xxh64(const void* input, size_t len, uint64_t seed) {
+  using namespace detail;
+  const uint8_t* p = static_cast<const uint8_t*>(input);
+  const uint8_t* const end = p + len;
+  uint64_t h;
+
+  if (len >= 32) {
+    uint64_t v1 = seed + kXXH64Prime1 + kXXH64Prime2;
+    uint64_t v2 = seed + kXXH64Prime2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - kXXH64Prime1;
+    do {
+      v1 = xxh64_round(v1, xxh64_read64(p));
+      v2 = xxh64_round(v2, xxh64_read64(p + 8));
+      v3 = xxh64_round(v3, xxh64_read64(p + 16));
+      v4 = xxh64_round(v4, xxh64_read64(p + 24));
+      p += 32;
+    } while (p <= end - 32);
+    h = xxh64_rotl(v1, 1) + xxh64_rotl(v2, 7) + xxh64_rotl(v3, 12) +
+        xxh64_rotl(v4, 18);
+    h = xxh64_merge_round(h, v1);
+    h = xxh64_merge_round(h, v2);
+    h = xxh64_merge_round(h, v3);
+    h = xxh64_merge_round(h, v4);
+  } else {
+    h = seed + kXXH64Prime5;
+  }
+
+  h += static_cast<uint64_t>(len);
+
+  while (p + 8 <= end) {
+    h ^= xxh64_round(0, xxh64_read64(p));
+    h = xxh64_rotl(h, 27) * kXXH64Prime1 + kXXH64Prime4;
+    p += 8;
+  }
+  if (p + 4 <= end) {
+    h ^= static_cast<uint64_t>(xxh64_read32(p)) * kXXH64Prime1;
+    h = xxh64_rotl(h, 23) * kXXH64Prime2 + kXXH64Prime3;
+    p += 4;
+  }
+  while (p < end) {
+    h ^= (*p) * kXXH64Prime5;
+    h = xxh64_rotl(h, 11) * kXXH64Prime1;
+    p++;
+  }
+
+  h ^= h >> 33;
+  h *= kXXH64Prime2;
+  h ^= h >> 29;
+  h *= kXXH64Prime3;
+  h ^= h >> 32;
+  return h;
+}
+
+} // namespace util
+} // namespace c10
@@ -1,14 +1,68 @@
 #include "miniz.h"
-#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 #include "caffe2/serialize/crc_alt.h"
 
+#if defined(USE_EXTERNAL_MZCRC)
+
+namespace {
+
+// Minimum bytes each worker thread must have before a CRC is split across
+// threads. Checkpoint tensor records routinely run to gigabytes, and a
+// single-threaded pass over them leaves the writer CRC-bound; below this
+// size the spawn/join overhead outweighs the parallelism.
+constexpr size_t kCrcParallelMinBytesPerThread = size_t(1) << 24; // 16 MiB
+
+uint32_t crc32_parallel(const uint8_t* data, size_t length, uint32_t crc) {
+  size_t max_threads =
+      std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  size_t num_workers =
+      std::min(length / kCrcParallelMinBytesPerThread, max_threads);
+  if (num_workers < 2) {
+    return crc32_fast(data, length, crc);
+  }
+
+  size_t span = length / num_workers;
+  size_t remainder = length % num_workers;
+  std::vector<uint32_t> partial(num_workers);
+  std::vector<size_t> span_lengths(num_workers);
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  size_t offset = 0;
+  for (size_t w = 0; w < num_workers; ++w) {
+    size_t len = span + (w < remainder ? 1 : 0);
+    span_lengths[w] = len;
+    workers.emplace_back([&partial, w, data, offset, len]() {
+      partial[w] = crc32_fast(data + offset, len, 0);
+    });
+    offset += len;
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  // crc(prev, A|B) == combine(crc(prev, A), crc(0, B), len(B))
+  uint32_t result = crc32_combine(crc, partial[0], span_lengths[0]);
+  for (size_t w = 1; w < num_workers; ++w) {
+    result = crc32_combine(result, partial[w], span_lengths[w]);
+  }
+  return result;
+}
+
+} // namespace
+
 extern "C" {
 // See: miniz.h
-#if defined(USE_EXTERNAL_MZCRC)
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8* ptr, size_t buf_len) {
+  if (buf_len >= 2 * kCrcParallelMinBytesPerThread) {
+    return crc32_parallel(ptr, buf_len, static_cast<uint32_t>(crc));
+  }
   auto z = crc32_fast(ptr, buf_len, crc);
   return z;
 };
-#endif
 }
+
+#endif // USE_EXTERNAL_MZCRC
@@ -3,6 +3,9 @@
 #include <cerrno>
 #include <cstdio>
 #include <string>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
 #include "caffe2/core/common.h"
 
 namespace caffe2 {
@@ -62,6 +65,7 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
   // user requested to read beyond the end of the file, we clamp to just the
   // end of the file.
   n = std::min(static_cast<size_t>(size_ - pos), n);
+#if defined(_WIN32)
 #if defined(_MSC_VER)
   const int fseek_ret = _fseeki64(file_.fp_, pos, SEEK_SET);
 #else
@@ -74,6 +78,43 @@ size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
     ", context: ",
     what);
   return fread(buf, 1, n, file_.fp_);
+#else
+  // pread(2) takes an explicit offset and leaves no seek position behind,
+  // so concurrent read() calls on the same adapter are safe (see
+  // supportsConcurrentReads()).
+  const int fd = fileno(file_.fp_);
+  size_t total_read = 0;
+  while (total_read < n) {
+    const ssize_t read_ret = ::pread(
+        fd,
+        static_cast<char*>(buf) + total_read,
+        n - total_read,
+        pos + total_read);
+    if (read_ret == -1 && errno == EINTR) {
+      continue;
+    }
+    TORCH_CHECK(
+        read_ret != -1,
+        "pread failed because of errno ",
+        errno,
+        ", context: ",
+        what);
+    if (read_ret == 0) {
+      break;
+    }
+    total_read += read_ret;
+  }
+  return total_read;
+#endif
+}
+
+bool FileAdapter::supportsConcurrentReads() const {
+#if defined(_WIN32)
+  // The Windows path seeks the shared FILE*.
+  return false;
+#else
+  return true;
+#endif
 }
 
 FileAdapter::~FileAdapter() = default;
@@ -111,10 +111,46 @@ class TORCH_API PyTorchStreamReader final {
       size_t n,
       size_t chunk_size,
       const std::function<void(void*, const void*, size_t)>& memcpy_func);
+  // Like getRecord(name, dst, n), but holds the archive lock only while
+  // resolving the record's metadata; the bulk payload read goes straight
+  // to the adapter outside the lock, so several records can be read at
+  // once from different threads when supportsConcurrentReads() is true.
+  // Compressed records and serial-only adapters silently fall back to the
+  // locked extraction path.
+  size_t getRecordConcurrently(const std::string& name, void* dst, size_t n);
+  // True when the underlying adapter allows getRecordConcurrently() to
+  // actually overlap reads (positional, stateless reads; see
+  // ReadAdapterInterface::supportsConcurrentReads()).
+  bool supportsConcurrentReads() const {
+    return in_->supportsConcurrentReads();
+  }
   size_t getRecordOffset(const std::string& name);
   bool hasRecord(const std::string& name);
   std::vector<std::string> getAllRecords();
 
+  // Chunked records (see writeChunkedRecord). Each chunk is an ordinary
+  // archive record, so individual chunks can be located and read without
+  // touching the rest of the payload.
+  struct ChunkedRecordInfo {
+    uint64_t total_size = 0;
+    // Uncompressed bytes per chunk; the last chunk may be shorter.
+    uint64_t chunk_size = 0;
+    uint64_t num_chunks = 0;
+    bool compressed = false;
+  };
+  // True when name was written with writeChunkedRecord.
+  bool hasChunkedRecord(const std::string& name);
+  // Reads and validates the chunk index of a chunked record.
+  ChunkedRecordInfo getChunkedRecordInfo(const std::string& name);
+  // Reads the chunk_idx-th chunk of a chunked record into dst; n must match
+  // the chunk's uncompressed size (info.chunk_size except possibly for the
+  // last chunk). Only this chunk's bytes are read and decoded.
+  size_t readChunkedRecordChunk(
+      const std::string& name,
+      uint64_t chunk_idx,
+      void* dst,
+      size_t n);
+
   ~PyTorchStreamReader();
   uint64_t version() const {
     return version_;
@@ -132,6 +168,7 @@ class TORCH_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordPayloadOffset(uint64_t local_header_ofs);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -158,6 +195,32 @@ class TORCH_API PyTorchStreamWriter final {
       const void* data,
       size_t size,
       bool compress = false);
+  // Chunked variant: the record payload is pulled from read_func in bounded
+  // pieces instead of being required to exist as one contiguous buffer.
+  // read_func(pos, buf, n) must fill buf with n bytes of the record starting
+  // at offset pos and return the number of bytes produced; returning fewer
+  // than n bytes aborts the write. Useful when a record is assembled from
+  // several mapped shards that are never materialized as a single allocation.
+  // (A record that already lives in one buffer should use the overload above,
+  // which hands the caller's pointer to the output function directly.)
+  void writeRecord(
+      const std::string& name,
+      uint64_t size,
+      const std::function<size_t(uint64_t pos, void* buf, size_t n)>& read_func,
+      bool compress = false);
+  // Splits the record into fixed-size chunks, each stored as its own
+  // archive record (optionally compressed), preceded by a small chunk
+  // index record. Readers can then fetch any byte range of the record by
+  // reading only the chunks that overlap it (see
+  // PyTorchStreamReader::readChunkedRecordChunk and LazyChunkedRecord),
+  // which makes partial loads of huge records, such as frozen embedding
+  // tables, proportional to the range requested rather than to the record.
+  void writeChunkedRecord(
+      const std::string& name,
+      const void* data,
+      size_t size,
+      size_t chunk_size,
+      bool compress = false);
   void writeEndOfFile();
 
   const std::unordered_set<std::string>& getAllWrittenRecords();
@@ -200,6 +263,44 @@ class TORCH_API PyTorchStreamWriter final {
       size_t n);
 };
 
+// Lazily decoded view of a chunked record. Chunks are fetched and decoded
+// from the archive on first touch and memoized individually, so reading a
+// row range of a huge record only ever materializes the chunks that range
+// overlaps. releaseDecodedChunks() drops the memoized chunks again, which
+// lets callers run a memory-capped cold tier by periodically releasing
+// records that have not been touched recently. Thread-safe.
+class TORCH_API LazyChunkedRecord final {
+ public:
+  LazyChunkedRecord(
+      std::shared_ptr<PyTorchStreamReader> reader,
+      std::string name);
+
+  uint64_t size() const {
+    return info_.total_size;
+  }
+  const PyTorchStreamReader::ChunkedRecordInfo& info() const {
+    return info_;
+  }
+  // Copies [offset, offset + n) of the record into dst, decoding only the
+  // chunks that overlap the range.
+  void read(uint64_t offset, void* dst, uint64_t n);
+  // Frees all decoded chunks; subsequent reads decode from the archive
+  // again.
+  void releaseDecodedChunks();
+  uint64_t decodedChunks() const;
+
+ private:
+  // Decodes chunk chunk_idx if it is not resident; mutex_ must be held.
+  void ensureChunk(uint64_t chunk_idx);
+
+  std::shared_ptr<PyTorchStreamReader> reader_;
+  std::string name_;
+  PyTorchStreamReader::ChunkedRecordInfo info_;
+  std::vector<at::DataPtr> chunks_;
+  uint64_t num_decoded_ = 0;
+  mutable std::mutex mutex_;
+};
+
 namespace detail {
 // Writer-specific constants
 constexpr uint64_t kFieldAlignment = 64;
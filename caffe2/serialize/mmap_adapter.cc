@@ -0,0 +1,91 @@
+#include "caffe2/serialize/mmap_adapter.h"
+
+#include <c10/util/Exception.h>
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace caffe2 {
+namespace serialize {
+
+#ifndef _WIN32
+
+MmapReadAdapter::MmapReadAdapter(const std::string& file_name) {
+  int fd = open(file_name.c_str(), O_RDONLY);
+  TORCH_CHECK(
+      fd != -1, "open file for memory mapping failed: ", file_name,
+      ", error: ", strerror(errno));
+  struct stat st {};
+  if (fstat(fd, &st) == -1) {
+    auto msg = std::string(strerror(errno));
+    close(fd);
+    TORCH_CHECK(false, "stat failed for ", file_name, ", error: ", msg);
+  }
+  size_ = st.st_size;
+  // A zero-length mapping is invalid; leave data_ null and let read()
+  // reject any access.
+  if (size_ != 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      auto msg = std::string(strerror(errno));
+      close(fd);
+      TORCH_CHECK(false, "mmap failed for ", file_name, ", error: ", msg);
+    }
+    data_ = data;
+  }
+  // The mapping keeps its own reference to the underlying file.
+  close(fd);
+}
+
+size_t MmapReadAdapter::size() const {
+  return size_;
+}
+
+size_t MmapReadAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
+    const {
+  TORCH_CHECK(
+      pos <= size_, "read out of bounds: ", what, " at position ", pos,
+      " with archive size ", size_);
+  n = std::min(n, static_cast<size_t>(size_ - pos));
+  memcpy(buf, static_cast<const char*>(data_) + pos, n);
+  return n;
+}
+
+MmapReadAdapter::~MmapReadAdapter() {
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+#else // _WIN32
+
+MmapReadAdapter::MmapReadAdapter(const std::string& file_name) {
+  TORCH_CHECK(
+      false, "MmapReadAdapter is not supported on this platform (reading ",
+      file_name, ")");
+}
+
+size_t MmapReadAdapter::size() const {
+  return 0;
+}
+
+size_t MmapReadAdapter::read(
+    uint64_t pos,
+    void* buf,
+    size_t n,
+    const char* what) const {
+  return 0;
+}
+
+MmapReadAdapter::~MmapReadAdapter() = default;
+
+#endif // _WIN32
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+
+#include <c10/macros/Macros.h>
+
+#include "caffe2/serialize/read_adapter_interface.h"
+
+namespace caffe2 {
+namespace serialize {
+
+// A ReadAdapterInterface backed by a read-only memory mapping of the whole
+// file.  Because the full archive is resident for the lifetime of the
+// adapter, PyTorchStreamReader can hand out pointers into the mapping for
+// aligned, uncompressed records (see PyTorchStreamReader::getRecord) instead
+// of copying them into freshly allocated buffers.  Only supported on POSIX
+// platforms; the constructor throws elsewhere.
+class TORCH_API MmapReadAdapter final : public ReadAdapterInterface {
+ public:
+  C10_DISABLE_COPY_AND_ASSIGN(MmapReadAdapter);
+  explicit MmapReadAdapter(const std::string& file_name);
+  size_t size() const override;
+  size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
+      const override;
+  const void* base() const override {
+    return data_;
+  }
+  // read() is a plain memcpy out of the mapping, so concurrent calls are
+  // safe.
+  bool supportsConcurrentReads() const override {
+    return true;
+  }
+  ~MmapReadAdapter() override;
+
+ private:
+  void* data_ = nullptr;
+  uint64_t size_ = 0;
+};
+
+} // namespace serialize
+} // namespace caffe2
@@ -16,6 +16,22 @@ class TORCH_API ReadAdapterInterface {
   virtual size_t size() const = 0;
   virtual size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
       const = 0;
+  // If the entire input is resident in memory for the lifetime of the
+  // adapter (e.g. memory mapped), returns a pointer to byte 0; otherwise
+  // nullptr.  A non-null base enables zero-copy record access in
+  // PyTorchStreamReader.
+  virtual const void* base() const {
+    return nullptr;
+  }
+  // True if read() may be called from several threads at the same time.
+  // Adapters that keep a seek position or other mutable state behind the
+  // const interface (e.g. IStreamAdapter) must leave this false; adapters
+  // whose reads are positional and stateless (memory mapped, pread-based)
+  // can override it to unlock concurrent record reads in
+  // PyTorchStreamReader.
+  virtual bool supportsConcurrentReads() const {
+    return false;
+  }
   virtual ~ReadAdapterInterface();
 };
 
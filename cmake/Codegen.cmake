@@ -253,7 +253,9 @@ if(INTERN_BUILD_ATEN_OPS)
   list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}")
 
   if(CXX_AVX512_FOUND)
-    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX512_CPU_DEFINITION")
+    if(NOT ATEN_SINGLE_CPU_CAPABILITY)
+      set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX512_CPU_DEFINITION")
+    endif()
     list(APPEND CPU_CAPABILITY_NAMES "AVX512")
     if(MSVC)
       list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}/arch:AVX512")
@@ -263,7 +265,9 @@ if(INTERN_BUILD_ATEN_OPS)
   endif(CXX_AVX512_FOUND)
 
   if(CXX_AVX2_FOUND)
-    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX2_CPU_DEFINITION")
+    if(NOT ATEN_SINGLE_CPU_CAPABILITY)
+      set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX2_CPU_DEFINITION")
+    endif()
 
     # Some versions of GCC pessimistically split unaligned load and store
     # instructions when using the default tuning. This is a bad choice on
@@ -296,17 +300,40 @@ if(INTERN_BUILD_ATEN_OPS)
   endif(CXX_AVX2_FOUND)
 
   if(CXX_VSX_FOUND)
-    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_VSX_CPU_DEFINITION")
+    if(NOT ATEN_SINGLE_CPU_CAPABILITY)
+      SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_VSX_CPU_DEFINITION")
+    endif()
     LIST(APPEND CPU_CAPABILITY_NAMES "VSX")
     LIST(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}  ${CXX_VSX_FLAGS}")
   endif(CXX_VSX_FOUND)
 
   if(CXX_ZVECTOR_FOUND)
-    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_ZVECTOR_CPU_DEFINITION")
+    if(NOT ATEN_SINGLE_CPU_CAPABILITY)
+      SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_ZVECTOR_CPU_DEFINITION")
+    endif()
     LIST(APPEND CPU_CAPABILITY_NAMES "ZVECTOR")
     LIST(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}  ${CXX_ZVECTOR_FLAGS}")
   endif(CXX_ZVECTOR_FOUND)
 
+  if(ATEN_SINGLE_CPU_CAPABILITY)
+    # Single-ISA build: compile exactly one copy of each cpu kernel. The
+    # HAVE_*_CPU_DEFINITION macros stay undefined so DispatchStub keeps only
+    # its DEFAULT slot, which the selected ISA registers into (see
+    # REGISTER_DISPATCH in aten/src/ATen/native/DispatchStub.h), and a
+    # runtime check fails fast if the host cpu lacks the selected ISA.
+    list(FIND CPU_CAPABILITY_NAMES "${ATEN_SINGLE_CPU_CAPABILITY}" _single_capability_idx)
+    if(_single_capability_idx EQUAL -1)
+      message(FATAL_ERROR
+        "ATEN_SINGLE_CPU_CAPABILITY is set to '${ATEN_SINGLE_CPU_CAPABILITY}' "
+        "but the available capabilities are: ${CPU_CAPABILITY_NAMES}")
+    endif()
+    list(GET CPU_CAPABILITY_FLAGS ${_single_capability_idx} _single_capability_flags)
+    set(CPU_CAPABILITY_NAMES "${ATEN_SINGLE_CPU_CAPABILITY}")
+    set(CPU_CAPABILITY_FLAGS "${_single_capability_flags}")
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DAT_SINGLE_CPU_CAPABILITY -DAT_SINGLE_CPU_CAPABILITY_${ATEN_SINGLE_CPU_CAPABILITY}")
+    message("-- ATen cpu kernels will be compiled only for ${ATEN_SINGLE_CPU_CAPABILITY}")
+  endif()
+
   list(LENGTH CPU_CAPABILITY_NAMES NUM_CPU_CAPABILITY_NAMES)
   math(EXPR NUM_CPU_CAPABILITY_NAMES "${NUM_CPU_CAPABILITY_NAMES}-1")
 
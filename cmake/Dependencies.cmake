@@ -694,7 +694,9 @@ endif()
 
 
 # ---[ Googletest and benchmark
-if(BUILD_TEST OR BUILD_MOBILE_BENCHMARK OR BUILD_MOBILE_TEST)
+if(BUILD_TEST OR BUILD_MOBILE_BENCHMARK OR BUILD_MOBILE_TEST
+   OR BUILD_CPP_BENCHMARKS OR BUILD_STATIC_RUNTIME_BENCHMARK
+   OR BUILD_TENSOREXPR_BENCHMARK)
   # Preserve build options.
   set(TEMP_BUILD_SHARED_LIBS ${BUILD_SHARED_LIBS})
 
@@ -1687,6 +1689,25 @@ if(NOT INTERN_BUILD_MOBILE)
     caffe2_update_option(USE_MAGMA OFF)
   endif()
 
+  if(USE_CUSPARSELT)
+    find_package(CUSPARSELT)
+    if(CUSPARSELT_FOUND)
+      message(STATUS "Compiling with cuSPARSELt support")
+      add_library(torch::cusparselt INTERFACE IMPORTED)
+      set_property(
+        TARGET torch::cusparselt PROPERTY INTERFACE_INCLUDE_DIRECTORIES
+        ${CUSPARSELT_INCLUDE_PATH})
+      set_property(
+        TARGET torch::cusparselt PROPERTY INTERFACE_LINK_LIBRARIES
+        ${CUSPARSELT_LIBRARY_PATH})
+    else()
+      message(WARNING
+        "Not compiling with cuSPARSELt. Suppress this warning with "
+        "-DUSE_CUSPARSELT=OFF.")
+      caffe2_update_option(USE_CUSPARSELT OFF)
+    endif()
+  endif()
+
   # ARM specific flags
   find_package(ARM)
   if(ASIMD_FOUND)
@@ -0,0 +1,34 @@
+# - Find cuSPARSELt library
+# This module finds an installed NVIDIA cuSPARSELt library, the structured
+# (2:4) sparsity companion to cuSPARSE.
+#
+# The library is searched in the CUDA toolkit directories by default. To use
+# a different installation set the environment variable CUSPARSELT_ROOT_DIR
+# before running cmake.
+#
+# This module sets the following variables:
+#  CUSPARSELT_FOUND - set to true if the cuSPARSELt library is found
+#  CUSPARSELT_LIBRARY_PATH - path to the cuSPARSELt library
+#  CUSPARSELT_INCLUDE_PATH - include directory containing cusparseLt.h
+
+if(CUSPARSELT_FOUND)
+  return()
+endif()
+
+include(FindPackageHandleStandardArgs)
+
+find_path(CUSPARSELT_INCLUDE_PATH cusparseLt.h
+  HINTS $ENV{CUSPARSELT_ROOT_DIR} ${CUDA_TOOLKIT_ROOT_DIR}
+  PATH_SUFFIXES include
+  DOC "The directory where cusparseLt.h resides")
+
+find_library(CUSPARSELT_LIBRARY_PATH cusparseLt
+  HINTS $ENV{CUSPARSELT_ROOT_DIR} ${CUDA_TOOLKIT_ROOT_DIR}
+  PATH_SUFFIXES lib lib64
+  DOC "The cuSPARSELt library")
+
+find_package_handle_standard_args(CUSPARSELT
+  FOUND_VAR CUSPARSELT_FOUND
+  REQUIRED_VARS CUSPARSELT_INCLUDE_PATH CUSPARSELT_LIBRARY_PATH)
+
+mark_as_advanced(CUSPARSELT_INCLUDE_PATH CUSPARSELT_LIBRARY_PATH)
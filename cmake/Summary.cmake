@@ -58,6 +58,9 @@ function(caffe2_print_configuration_summary)
   endif()
   message(STATUS "  INTERN_BUILD_MOBILE   : ${INTERN_BUILD_MOBILE}")
   message(STATUS "  TRACING_BASED         : ${TRACING_BASED}")
+  if(ATEN_SINGLE_CPU_CAPABILITY)
+    message(STATUS "  ATEN_SINGLE_CPU_CAPABILITY : ${ATEN_SINGLE_CPU_CAPABILITY}")
+  endif()
 
   message(STATUS "  USE_BLAS              : ${USE_BLAS}")
   if(${USE_BLAS})
@@ -100,6 +103,8 @@ function(caffe2_print_configuration_summary)
     message(STATUS "    CUDA flags          : ${CMAKE_CUDA_FLAGS}")
     message(STATUS "    CUDA host compiler  : ${CMAKE_CUDA_HOST_COMPILER}")
     message(STATUS "    CUDA --device-c     : ${CUDA_SEPARABLE_COMPILATION}")
+    message(STATUS "    USE_CUSPARSELT      : ${USE_CUSPARSELT}")
+    message(STATUS "    USE_NVJPEG          : ${USE_NVJPEG}")
     message(STATUS "    USE_TENSORRT        : ${USE_TENSORRT}")
     if(${USE_TENSORRT})
       message(STATUS "      TensorRT runtime library: ${TENSORRT_LIBRARY}")
@@ -291,6 +291,20 @@ else()
         CUDA::cufft)
 endif()
 
+# nvjpeg
+if(USE_NVJPEG)
+    add_library(caffe2::nvjpeg INTERFACE IMPORTED)
+    if(CAFFE2_STATIC_LINK_CUDA AND NOT WIN32)
+        set_property(
+            TARGET caffe2::nvjpeg PROPERTY INTERFACE_LINK_LIBRARIES
+            CUDA::nvjpeg_static)
+    else()
+        set_property(
+            TARGET caffe2::nvjpeg PROPERTY INTERFACE_LINK_LIBRARIES
+            CUDA::nvjpeg)
+    endif()
+endif()
+
 # TensorRT
 if(CAFFE2_USE_TENSORRT)
   add_library(caffe2::tensorrt UNKNOWN IMPORTED)
@@ -16,6 +16,7 @@
 #include <limits>
 #include <mutex>
 #include <numeric>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -2321,3 +2322,69 @@ TEST(DataLoaderTest, CustomPreprocessPolicy) {
     }
   }
 }
+
+TEST(DataLoaderTest, TensorBatchPipelineProducesBatchesInOrder) {
+  const int64_t sample_count = 103;
+  const size_t batch_size = 10;
+  auto data = torch::arange(sample_count * 3, torch::kFloat).view({sample_count, 3});
+  auto targets = torch::arange(sample_count, torch::kLong);
+  std::vector<int64_t> indices(sample_count);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), std::mt19937(7));
+
+  torch::data::TensorBatchPipeline pipeline(
+      {data, targets},
+      indices,
+      torch::data::TensorBatchPipelineOptions(batch_size).workers(4));
+  ASSERT_EQ(pipeline.batch_count(), 11);
+  ASSERT_EQ(pipeline.column_count(), 2);
+
+  size_t batch_index = 0;
+  size_t seen = 0;
+  while (auto batch = pipeline.next()) {
+    ASSERT_EQ(batch->size(), 2);
+    const auto begin = batch_index * batch_size;
+    const auto end = std::min<size_t>(indices.size(), begin + batch_size);
+    ASSERT_EQ(batch->at(0).size(0), static_cast<int64_t>(end - begin));
+    for (const auto i : c10::irange(begin, end)) {
+      const auto row = static_cast<int64_t>(i - begin);
+      ASSERT_TRUE(
+          batch->at(0)[row].equal(data[indices[i]]));
+      ASSERT_EQ(batch->at(1)[row].item<int64_t>(), indices[i]);
+    }
+    seen += end - begin;
+    ++batch_index;
+  }
+  ASSERT_EQ(batch_index, pipeline.batch_count());
+  ASSERT_EQ(seen, indices.size());
+  // Exhausted pipelines keep returning nullopt.
+  ASSERT_FALSE(pipeline.next().has_value());
+}
+
+TEST(DataLoaderTest, TensorBatchPipelineRespectsDropLastAndZeroWorkers) {
+  auto data = torch::arange(25, torch::kFloat);
+  std::vector<int64_t> indices(25);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  torch::data::TensorBatchPipeline pipeline(
+      {data},
+      indices,
+      torch::data::TensorBatchPipelineOptions(10).workers(0).drop_last(true));
+  ASSERT_EQ(pipeline.batch_count(), 2);
+  size_t batches = 0;
+  while (auto batch = pipeline.next()) {
+    ASSERT_EQ(batch->at(0).size(0), 10);
+    ++batches;
+  }
+  ASSERT_EQ(batches, 2);
+}
+
+TEST(DataLoaderTest, TensorBatchPipelinePropagatesWorkerExceptions) {
+  auto data = torch::arange(10, torch::kFloat);
+  // Out-of-range index: index_select in the worker thread will throw.
+  std::vector<int64_t> indices = {0, 1, 100};
+  torch::data::TensorBatchPipeline pipeline(
+      {data}, indices, torch::data::TensorBatchPipelineOptions(3).workers(2));
+  ASSERT_THROWS_WITH(
+      pipeline.next(), "Caught exception in DataLoader worker thread");
+}
@@ -6,9 +6,13 @@
 #include <test/cpp/api/support.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace torch::nn;
 
@@ -872,3 +876,62 @@ TEST_F(NNUtilsTest, PadSequence) {
     ASSERT_TRUE(padded.allclose(expected.transpose(0, 1)));
   }
 }
+
+TEST_F(NNUtilsTest, BatchingQueue) {
+  torch::manual_seed(0);
+  Linear model(8, 4);
+
+  std::atomic<int64_t> forward_calls{0};
+  torch::nn::utils::BatchingQueue queue(
+      [&](torch::Tensor batch) {
+        forward_calls++;
+        return model->forward(batch);
+      },
+      torch::nn::utils::BatchingQueueOptions().max_batch_size(16).timeout(
+          std::chrono::milliseconds(20)));
+
+  constexpr int64_t num_threads = 4;
+  constexpr int64_t samples_per_thread = 32;
+  std::vector<torch::Tensor> samples;
+  for (const auto i : c10::irange(num_threads * samples_per_thread)) {
+    (void)i;
+    samples.push_back(torch::randn(8));
+  }
+
+  std::vector<c10::intrusive_ptr<torch::nn::utils::BatchingQueue::Future>>
+      futures(samples.size());
+  std::vector<std::thread> producers;
+  for (const auto t : c10::irange(num_threads)) {
+    producers.emplace_back([&, t] {
+      for (const auto i : c10::irange(samples_per_thread)) {
+        const auto index = t * samples_per_thread + i;
+        futures[index] = queue.submit(samples[index]);
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  // Every sample's future holds exactly the row the plain forward produces,
+  // and batching actually coalesced submissions (fewer forwards than samples).
+  for (const auto i : c10::irange(samples.size())) {
+    futures[i]->wait();
+    auto result = futures[i]->value().toTensor();
+    auto expected = model->forward(samples[i].unsqueeze(0)).squeeze(0);
+    ASSERT_TRUE(result.allclose(expected));
+  }
+  ASSERT_LT(forward_calls.load(), static_cast<int64_t>(samples.size()));
+}
+
+TEST_F(NNUtilsTest, BatchingQueueForwardError) {
+  torch::nn::utils::BatchingQueue queue(
+      [](torch::Tensor) -> torch::Tensor {
+        throw std::runtime_error("model exploded");
+      },
+      torch::nn::utils::BatchingQueueOptions().max_batch_size(2).timeout(
+          std::chrono::milliseconds(1)));
+  auto future = queue.submit(torch::ones(3));
+  future->wait();
+  ASSERT_TRUE(future->hasError());
+}
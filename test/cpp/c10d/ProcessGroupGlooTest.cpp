@@ -637,6 +637,37 @@ void testSend(const std::string& path) {
   EXPECT_TRUE(sendCompleted);
 }
 
+void testEventDrivenSendRecv(const std::string& path) {
+  // Route send/recv completion through the process-wide completion poller,
+  // see Note [Event-driven send/recv completion] in ProcessGroupGloo.cpp.
+  ASSERT_EQ(setenv("TORCH_GLOO_EVENT_DRIVEN_WAIT", "1", 1), 0);
+  const auto size = 2;
+  auto tests = CollectiveTest::initialize(path, size);
+
+  constexpr uint64_t tag = 0x1234;
+  std::vector<at::Tensor> sendTensors = {at::ones({16, 16})};
+  std::vector<at::Tensor> recvTensors = {at::zeros({16, 16})};
+
+  std::thread recvThread([&]() {
+    auto& pg = tests[1].getProcessGroup();
+    auto recvWork = pg.recv(recvTensors, /*srcRank=*/0, tag);
+    recvWork->wait();
+    EXPECT_EQ(recvWork->sourceRank(), 0);
+  });
+
+  auto& pg = tests[0].getProcessGroup();
+  auto sendWork = pg.send(sendTensors, /*dstRank=*/1, tag);
+  const bool sendCompleted = sendWork->wait();
+  recvThread.join();
+
+  EXPECT_TRUE(sendCompleted);
+  auto data = recvTensors[0].data_ptr<float>();
+  for (const auto i : c10::irange(recvTensors[0].numel())) {
+    EXPECT_EQ(data[i], 1.0f);
+  }
+  ASSERT_EQ(unsetenv("TORCH_GLOO_EVENT_DRIVEN_WAIT"), 0);
+}
+
 void testRecv(const std::string& path) {
   const auto size = 2;
   auto tests = CollectiveTest::initialize(path, size);
@@ -788,6 +819,13 @@ TEST(ProcessGroupGlooTest, testRecv) {
   }
 }
 
+TEST(ProcessGroupGlooTest, testEventDrivenSendRecv) {
+  {
+    TemporaryFile file;
+    testEventDrivenSendRecv(file.path);
+  }
+}
+
 TEST(ProcessGroupGlooTest, testStoreSetGet) {
   TemporaryFile file;
   testStoreSetGet(file.path);
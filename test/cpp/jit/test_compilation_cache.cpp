@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <c10/util/tempfile.h>
+#include <torch/csrc/jit/api/compilation_unit.h>
+#include <torch/csrc/jit/frontend/compilation_cache.h>
+#include <torch/csrc/jit/frontend/resolver.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+const auto source = R"JIT(
+def cached_fn(x: int, y: int) -> int:
+    return x + y * 2
+)JIT";
+
+int64_t runCachedFn(CompilationUnit& cu) {
+  auto& fn = cu.get_function("cached_fn");
+  Stack stack;
+  push(stack, 3, 4);
+  fn.run(stack);
+  return stack.at(0).toInt();
+}
+
+} // namespace
+
+TEST(CompilationCacheTest, RoundTripsFreeFunctions) {
+  auto dir = c10::try_make_tempdir();
+  if (!dir.has_value()) {
+    GTEST_SKIP() << "could not create a temporary directory";
+  }
+  setFrontendCompilationCacheDir(dir->name);
+
+  const auto before = getFrontendCompilationCacheStats();
+
+  // First compilation misses the cache and publishes an artifact.
+  CompilationUnit cu1;
+  cu1.define(c10::nullopt, source, nativeResolver(), nullptr);
+  EXPECT_EQ(runCachedFn(cu1), 11);
+  auto after_store = getFrontendCompilationCacheStats();
+  EXPECT_EQ(after_store.misses, before.misses + 1);
+  EXPECT_EQ(after_store.stores, before.stores + 1);
+
+  // Identical source is served from the cache and behaves the same.
+  CompilationUnit cu2;
+  cu2.define(c10::nullopt, source, nativeResolver(), nullptr);
+  EXPECT_EQ(runCachedFn(cu2), 11);
+  auto after_hit = getFrontendCompilationCacheStats();
+  EXPECT_EQ(after_hit.hits, after_store.hits + 1);
+  EXPECT_EQ(after_hit.stores, after_store.stores);
+
+  setFrontendCompilationCacheDir("");
+}
+
+TEST(CompilationCacheTest, DisabledCacheIsUntouched) {
+  setFrontendCompilationCacheDir("");
+  const auto before = getFrontendCompilationCacheStats();
+  CompilationUnit cu;
+  cu.define(c10::nullopt, source, nativeResolver(), nullptr);
+  EXPECT_EQ(runCachedFn(cu), 11);
+  const auto after = getFrontendCompilationCacheStats();
+  EXPECT_EQ(after.hits, before.hits);
+  EXPECT_EQ(after.misses, before.misses);
+  EXPECT_EQ(after.stores, before.stores);
+}
+
+} // namespace jit
+} // namespace torch
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "test/cpp/jit/test_utils.h"
+#include "torch/csrc/jit/ir/irparser.h"
+#include "torch/csrc/jit/passes/utils/subgraph_utils.h"
 #include "torch/csrc/jit/runtime/graph_executor.h"
+#include "torch/csrc/jit/runtime/plan_serialization.h"
+#include "torch/csrc/jit/runtime/profiling_graph_executor_impl.h"
 #include "torch/jit.h"
 #include "torch/script.h"
 #include "torch/torch.h"
@@ -68,5 +74,141 @@ TEST(GraphExecutorTest, runAsync_executor) {
   ASSERT_TRUE(asyncCounter > 0);
 }
 
+TEST(GraphExecutorTest, TieredExecutionPromotesByCallCount) {
+  EnableProfilingGuard pg;
+  bool old_mode = getTieredExecutionMode();
+  getTieredExecutionMode() = true;
+  size_t old_profile_at = getTierProfileThreshold();
+  size_t old_optimize_at = getTierOptimizeThreshold();
+  size_t old_hot_rate = getTierHotCallsPerSecond();
+  getTierProfileThreshold() = 3;
+  getTierOptimizeThreshold() = 5;
+  // Effectively disable rate-based promotion so the call-count tiers are
+  // what this test observes.
+  getTierHotCallsPerSecond() = std::numeric_limits<size_t>::max();
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::mul(%a, %b)
+  return (%c))IR",
+      graph.get());
+
+  auto a = at::rand({2, 2});
+  auto b = at::rand({2, 2});
+  auto expected = a * b;
+
+  GraphExecutor executor(graph, "tiered_test");
+  // Calls 1-2 stay in the interpret-only tier, calls 3-4 profile, and the
+  // fifth call finds the profiling record ready and optimizes.
+  for (size_t call = 1; call <= 5; ++call) {
+    auto stack = createStack({a, b});
+    executor.run(stack);
+    ASSERT_TRUE(almostEqual(stack[0].toTensor(), expected));
+    if (call < 5) {
+      ASSERT_FALSE(executor.isOptimized()) << "call " << call;
+    }
+  }
+  ASSERT_TRUE(executor.isOptimized());
+
+  getTieredExecutionMode() = old_mode;
+  getTierProfileThreshold() = old_profile_at;
+  getTierOptimizeThreshold() = old_optimize_at;
+  getTierHotCallsPerSecond() = old_hot_rate;
+}
+
+TEST(GraphExecutorTest, WarmStartPlanRoundTrip) {
+  EnableProfilingGuard pg;
+  static const auto source = R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::mul(%a, %b)
+  %one : int = prim::Constant[value=1]()
+  %d : Tensor = aten::add(%c, %b, %one)
+  return (%d))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(source, graph.get());
+
+  auto a = at::rand({2, 2});
+  auto b = at::rand({2, 2});
+  auto expected = a * b + b;
+
+  // Drive the executor past profiling to its optimized plan.
+  GraphExecutor executor(graph, "warm_start_test");
+  for (size_t i = 0; i < getNumProfiledRuns() + 2; ++i) {
+    auto stack = createStack({a, b});
+    executor.run(stack);
+    ASSERT_TRUE(almostEqual(stack[0].toTensor(), expected));
+  }
+  ASSERT_TRUE(executor.isOptimized());
+  std::string payload = executor.serializeWarmStartPlan();
+  ASSERT_FALSE(payload.empty());
+
+  // A fresh executor for the same graph accepts the payload and skips
+  // profiling entirely.
+  GraphExecutor warm(graph->copy(), "warm_start_test");
+  ASSERT_FALSE(warm.isOptimized());
+  ASSERT_TRUE(warm.loadWarmStartPlan(payload));
+  ASSERT_TRUE(warm.isOptimized());
+  auto stack = createStack({a, b});
+  warm.run(stack);
+  ASSERT_TRUE(almostEqual(stack[0].toTensor(), expected));
+
+  // A different graph must reject the payload via the fingerprint.
+  auto other = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::mul(%a, %b)
+  return (%c))IR",
+      other.get());
+  GraphExecutor mismatched(other, "warm_start_test");
+  ASSERT_FALSE(mismatched.loadWarmStartPlan(payload));
+  ASSERT_FALSE(mismatched.isOptimized());
+
+  // Garbage payloads are a miss, not an error.
+  ASSERT_FALSE(warm.loadWarmStartPlan("not a warm start payload"));
+}
+
+TEST(GraphExecutorTest, WarmStartPlanSerializesSubgraphs) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %c : Tensor = aten::mul(%a, %b)
+  %d : Tensor = aten::mul(%c, %b)
+  return (%d))IR",
+      graph.get());
+
+  // Wrap each mul in its own fusion-group-style node so the serialized text
+  // carries two `with prim::TensorExprGroup_<i> = graph(...)` trailers.
+  std::vector<Node*> muls;
+  for (Node* n : graph->nodes()) {
+    if (n->kind() == aten::mul) {
+      muls.push_back(n);
+    }
+  }
+  ASSERT_EQ(muls.size(), 2);
+  for (Node* n : muls) {
+    SubgraphUtils::createSingletonSubgraph(n, prim::TensorExprGroup);
+  }
+  ASSERT_TRUE(isSerializablePlanGraph(*graph));
+
+  const std::string text = serializePlanGraph(graph);
+  auto reparsed = parsePlanGraph(text);
+
+  size_t groups = 0;
+  for (Node* n : reparsed->nodes()) {
+    if (n->kind() == prim::TensorExprGroup) {
+      ASSERT_TRUE(n->hasAttribute(attr::Subgraph));
+      ASSERT_EQ(n->g(attr::Subgraph)->nodes().begin()->kind(), aten::mul);
+      groups++;
+    }
+  }
+  ASSERT_EQ(groups, 2);
+  // Serialization should be a fixed point of the round trip.
+  ASSERT_EQ(serializePlanGraph(reparsed), text);
+}
+
 } // namespace jit
 } // namespace torch
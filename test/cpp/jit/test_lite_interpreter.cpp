@@ -114,6 +114,39 @@ TEST(LiteInterpreterTest, MethodInvocation) { // NOLINT (use =delete in gtest)
   }
 }
 
+TEST(LiteInterpreterTest, LazyMethodParsing) {
+  Module m("m");
+  m.register_parameter("foo", torch::ones({}), false);
+  m.define(R"(
+    def add_it(self, x):
+      return self.foo + x
+    def sub_it(self, x):
+      return x - self.foo
+  )");
+
+  std::stringstream ss;
+  m._save_for_mobile(ss);
+  ExtraFilesMap extra_files;
+  mobile::Module bc = _load_for_mobile(
+      ss,
+      c10::nullopt,
+      extra_files,
+      kDefaultMobileLoadOptions | MobileModuleLoadOptions::LAZY_METHOD_PARSING);
+
+  // Nothing is parsed until a method is looked up.
+  AT_ASSERT(bc.compilation_unit().methods().empty());
+
+  auto minput = 5 * torch::ones({});
+  auto ref = m.run_method("add_it", minput);
+  auto res = bc.run_method("add_it", minput);
+  AT_ASSERT(res.toTensor().item<float>() == ref.toTensor().item<float>());
+  AT_ASSERT(bc.compilation_unit().methods().size() == 1);
+
+  // get_methods() materializes any methods that are still pending.
+  AT_ASSERT(bc.get_methods().size() == 2);
+  AT_ASSERT(bc.find_method("sub_it").has_value());
+}
+
 TEST(LiteInterpreterTest, Conv) {
   auto s = std::getenv("PYTORCH_TEST_WITH_TSAN");
   if (s && strcmp(s, "1") == 0)
@@ -336,6 +336,47 @@ TEST(ModuleAPITest, DeepCopyPreservesAliasing) {
   ASSERT_TRUE(copied_attr3.isAliasOf(copied_attr4));
 }
 
+TEST(ModuleAPITest, RepeatedDeepCopy) {
+  // Repeated deepcopies of the same type replay a cached clone plan
+  // (see Note [Compiled clone plans]); they must still observe attribute
+  // mutations made between copies and preserve aliasing.
+  auto cu = std::make_shared<CompilationUnit>();
+  auto cls = ClassType::create("foo.bar", cu, true);
+  auto int_attr = "int_attr";
+  auto tensor_attr = "tensor_attr";
+  auto alias_attr = "alias_attr";
+  auto list_attr = "list_attr";
+  cls->addAttribute(int_attr, IntType::get());
+  cls->addAttribute(tensor_attr, TensorType::get());
+  cls->addAttribute(alias_attr, TensorType::get());
+  cls->addAttribute(list_attr, ListType::ofTensors());
+  Module m(cu, cls);
+  auto t = at::rand(5);
+  m.setattr(int_attr, IValue(1));
+  m.setattr(tensor_attr, t);
+  m.setattr(alias_attr, t.view(-1));
+  m.setattr(list_attr, c10::List<at::Tensor>({at::rand(5)}));
+
+  // First copy records the plan, second replays it.
+  Module m2 = m.deepcopy();
+  m.setattr(int_attr, IValue(2));
+  Module m3 = m.deepcopy();
+
+  ASSERT_EQ(m2.attr(int_attr).toInt(), 1);
+  ASSERT_EQ(m3.attr(int_attr).toInt(), 2);
+  ASSERT_TRUE(!IValue(m3._ivalue()).overlaps(IValue(m._ivalue())));
+  ASSERT_TRUE(m3.attr(tensor_attr).isAliasOf(m3.attr(alias_attr)));
+  ASSERT_TRUE(m.attr(tensor_attr).toTensor().equal(
+      m3.attr(tensor_attr).toTensor()));
+
+  // A structural change (list grows) must not be hidden by the cached plan.
+  c10::List<at::Tensor> bigger({at::rand(5), at::rand(5)});
+  m.setattr(list_attr, bigger);
+  Module m4 = m.deepcopy();
+  ASSERT_EQ(m4.attr(list_attr).toList().size(), 2);
+  ASSERT_TRUE(!IValue(m4._ivalue()).overlaps(IValue(m._ivalue())));
+}
+
 TEST(ModuleAPITest, Constants) {
   auto cu = std::make_shared<CompilationUnit>();
   auto cls = ClassType::create("foo.bar", cu, true);
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/pass_instrumentation.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+std::shared_ptr<Graph> graphWithDeadCode() {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Tensor, %b : Tensor):
+  %dead : Tensor = aten::mul(%a, %b)
+  %live : Tensor = aten::add(%a, %b)
+  return (%live))IR",
+      graph.get());
+  return graph;
+}
+
+} // namespace
+
+TEST(PassInstrumentationTest, RecordsTimingAndNodeDeltas) {
+  clearPassInstrumentation();
+  setPassInstrumentationEnabled(true);
+
+  auto graph = graphWithDeadCode();
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
+
+  const auto events = getPassInstrumentationEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].pass_name, "EliminateDeadCode");
+  EXPECT_EQ(events[0].nodes_before, 2);
+  EXPECT_EQ(events[0].nodes_after, 1);
+  EXPECT_GE(events[0].duration_us, 0);
+  // The second run had nothing left to remove.
+  EXPECT_EQ(events[1].nodes_before, 1);
+  EXPECT_EQ(events[1].nodes_after, 1);
+
+  const auto summaries = getPassInstrumentationSummaries();
+  ASSERT_EQ(summaries.size(), 1);
+  EXPECT_EQ(summaries[0].pass_name, "EliminateDeadCode");
+  EXPECT_EQ(summaries[0].runs, 2);
+  EXPECT_EQ(summaries[0].total_node_delta, -1);
+  EXPECT_GE(summaries[0].total_us, 0);
+
+  const auto trace = dumpPassInstrumentationTrace();
+  EXPECT_NE(trace.find("\"name\":\"EliminateDeadCode\""), std::string::npos);
+  EXPECT_NE(trace.find("\"nodes_before\":2"), std::string::npos);
+
+  setPassInstrumentationEnabled(false);
+  clearPassInstrumentation();
+}
+
+TEST(PassInstrumentationTest, DisabledRecordsNothing) {
+  clearPassInstrumentation();
+  ASSERT_FALSE(passInstrumentationEnabled());
+
+  auto graph = graphWithDeadCode();
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
+
+  EXPECT_TRUE(getPassInstrumentationEvents().empty());
+  EXPECT_EQ(dumpPassInstrumentationTrace(), "[]");
+}
+
+} // namespace jit
+} // namespace torch
@@ -59,6 +59,25 @@ TEST(IrTest, BasicTest) {
   EXPECT_TRUE(leafptr != nullptr);
 }
 
+TEST(IrTest, BaseNodeHashIsStructural) {
+  // See Note [Incremental graph hashing]: the base Node combines the cached
+  // operand hashes at construction, so nodes with structurally equal inputs
+  // hash equal while any differing leaf changes the root hash.
+  NodePtr leaf1 = MakeNode<TestLeafNode>(1);
+  NodePtr leaf2 = MakeNode<TestLeafNode>(1);
+  NodePtr other = MakeNode<TestLeafNode>(2);
+
+  auto make_root = [](const NodePtr& a, const NodePtr& b) {
+    std::vector<Value> operands{Value(a), Value(b)};
+    return std::make_shared<Node>(
+        OpKind::Get("ltc::test_root"), OpList(operands), /*num_outputs=*/1);
+  };
+  NodePtr root1 = make_root(leaf1, leaf2);
+  EXPECT_EQ(root1->hash(), make_root(leaf1, leaf2)->hash());
+  EXPECT_EQ(root1->hash(), make_root(leaf2, leaf1)->hash());
+  EXPECT_NE(root1->hash(), make_root(leaf1, other)->hash());
+}
+
 TEST(IrTest, MetaDataTest) {
   bool restore_FLAGS_torch_lazy_ir_debug = FLAGS_torch_lazy_ir_debug;
   FLAGS_torch_lazy_ir_debug = false;
@@ -80,5 +80,27 @@ TEST(ShapeTest, Ostream) {
   EXPECT_EQ(shape.to_string(), ss.str());
 }
 
+TEST(ShapeTest, HashWithSymbolicDims) {
+  const std::vector<bool> symbolic{false, true, false};
+  auto a = Shape(c10::ScalarType::Float, {8, 128, 512})
+               .with_symbolic_dims(symbolic);
+  auto b = Shape(c10::ScalarType::Float, {8, 256, 512})
+               .with_symbolic_dims(symbolic);
+  auto c = Shape(c10::ScalarType::Float, {8, 128, 1024})
+               .with_symbolic_dims(symbolic);
+
+  // Shapes differing only in a symbolic dim share the dynamic cache key...
+  EXPECT_EQ(a.hash(/*bakeInSizes=*/false), b.hash(/*bakeInSizes=*/false));
+  // ...but a differing static dim still changes it.
+  EXPECT_NE(a.hash(/*bakeInSizes=*/false), c.hash(/*bakeInSizes=*/false));
+  // The fully baked hash used for shape caching keeps concrete extents.
+  EXPECT_NE(a.hash(/*bakeInSizes=*/true), b.hash(/*bakeInSizes=*/true));
+
+  // Without symbolic dim info the dynamic key stays rank based.
+  auto d = Shape(c10::ScalarType::Float, {8, 128, 512});
+  auto e = Shape(c10::ScalarType::Float, {1, 2, 3});
+  EXPECT_EQ(d.hash(/*bakeInSizes=*/false), e.hash(/*bakeInSizes=*/false));
+}
+
 } // namespace lazy
 } // namespace torch
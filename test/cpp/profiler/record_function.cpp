@@ -303,3 +303,45 @@ TEST(RecordFunctionTest, MultipleCallbacks) {
   at::clearCallbacks();
   ASSERT_FALSE(at::hasCallbacks());
 }
+
+// Test the built-in per-op latency histogram observer.
+TEST(RecordFunctionTest, OperatorLatencyHistograms) {
+  at::clearCallbacks();
+  ASSERT_FALSE(at::hasCallbacks());
+  at::clearOperatorLatencyStats();
+
+  ASSERT_FALSE(at::operatorLatencyHistogramsEnabled());
+  at::enableOperatorLatencyHistograms();
+  ASSERT_TRUE(at::operatorLatencyHistogramsEnabled());
+
+  constexpr int kNumCalls = 25;
+  for (const auto i : c10::irange(kNumCalls)) {
+    (void)i;
+    RECORD_FUNCTION("latency_test_op", {});
+  }
+
+  // The observer only watches RecordScope::FUNCTION.
+  { RECORD_USER_SCOPE("latency_test_user_scope"); }
+
+  at::enableOperatorLatencyHistograms(false);
+  ASSERT_FALSE(at::operatorLatencyHistogramsEnabled());
+
+  // Samples recorded while disabled must not show up.
+  { RECORD_FUNCTION("latency_test_op", {}); }
+
+  auto stats = at::getOperatorLatencyStats();
+  auto it = stats.find("latency_test_op");
+  ASSERT_NE(it, stats.end());
+  EXPECT_EQ(it->second.count, kNumCalls);
+  EXPECT_GT(it->second.p50_us, 0.0);
+  EXPECT_LE(it->second.p50_us, it->second.p90_us);
+  EXPECT_LE(it->second.p90_us, it->second.p99_us);
+  EXPECT_EQ(stats.count("latency_test_user_scope"), 0);
+
+  at::clearOperatorLatencyStats();
+  stats = at::getOperatorLatencyStats();
+  EXPECT_EQ(stats.count("latency_test_op"), 0);
+
+  at::clearCallbacks();
+  ASSERT_FALSE(at::hasCallbacks());
+}
@@ -8,6 +8,7 @@ import os
 import random
 import sys
 import tempfile
+import threading
 from functools import reduce
 from itertools import groupby
 
@@ -508,6 +509,30 @@ class ProcessGroupGlooTest(MultiProcessTestCase):
     def test_allreduce_basics_cuda_using_work_api(self):
         self._test_allreduce_basics_using_work_api(lambda t: t.clone().cuda())
 
+    @requires_gloo()
+    def test_work_completion_callback(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        pg = self._create_process_group_gloo(
+            store, self.rank, self.world_size, self.opts()
+        )
+
+        # Callback is delivered from the backend's completion thread without
+        # the main thread polling or waiting on the work.
+        done = threading.Event()
+        tensor = torch.tensor([self.rank + 1.0])
+        work = pg.allreduce([tensor])
+        work._register_completion_callback(done.set)
+        self.assertTrue(done.wait(timeout=30))
+        self.assertEqual(
+            torch.tensor([float(self.world_size * (self.world_size + 1) / 2)]),
+            tensor,
+        )
+
+        # Registering on already-completed work runs the callback inline.
+        late = threading.Event()
+        work._register_completion_callback(late.set)
+        self.assertTrue(late.is_set())
+
     def _test_allreduce_stress(self, inputs):
         store = c10d.FileStore(self.file_name, self.world_size)
         pg = self._create_process_group_gloo(
@@ -521,6 +521,41 @@ class ProcessGroupNCCLTest(MultiProcessTestCase):
         # Verification
         self.assertEqual(torch.arange(self.world_size), output_t)
 
+    @requires_nccl()
+    @skip_but_pass_in_sandcastle_if(torch.cuda.device_count() < 2, "NCCL test requires 2+ GPUs")
+    def test_allgather_streamed(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        pg = self._create_process_group_nccl(store, self.opts())
+        local_device_id = self.rank_to_GPU[self.rank][0]
+
+        num_chunks = 4
+        inputs = [
+            torch.tensor([self.rank + 10 * i]).cuda(local_device_id)
+            for i in range(num_chunks)
+        ]
+        outputs = [
+            torch.empty((self.world_size,), dtype=t.dtype).cuda(local_device_id)
+            for t in inputs
+        ]
+
+        works = pg.allgather_streamed(outputs, inputs)
+        self.assertEqual(len(works), num_chunks)
+
+        # consume chunk by chunk, as a sharded forward pass would
+        for i, work in enumerate(works):
+            work.wait()
+            self.assertEqual(torch.arange(self.world_size) + 10 * i, outputs[i])
+
+        # mismatched chunk shape is rejected up front
+        with self.assertRaisesRegex(
+            RuntimeError,
+            "output tensor size must be equal to world_size times input tensor size",
+        ):
+            bad_output = torch.empty((self.world_size + 1,), dtype=inputs[0].dtype).cuda(
+                local_device_id
+            )
+            pg.allgather_streamed([bad_output], [inputs[0]])
+
     @requires_nccl()
     @skip_but_pass_in_sandcastle_if(torch.cuda.device_count() < 2, "NCCL test requires 2+ GPUs")
     def test_allgather_base_basics(self):
@@ -1056,6 +1091,39 @@ class ProcessGroupNCCLTest(MultiProcessTestCase):
 
         self.assertIsInstance(cm.exception, RuntimeError)
 
+    @requires_nccl()
+    @skip_but_pass_in_sandcastle_if(torch.cuda.device_count() < 2, "NCCL test requires 2+ GPUs")
+    def test_eager_connect(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        pg = self._create_process_group_nccl(store, self.opts())
+        device = self.rank_to_GPU[self.rank][0]
+
+        # Synchronous eager init: the first collective reuses the cached
+        # communicator instead of paying the handshake.
+        backend = pg._get_backend(torch.device(device))
+        backend._eager_connect([torch.device(device)])
+
+        t = torch.full((10, 10), self.rank + 1.0, device=device)
+        dist.all_reduce(t)
+        self.assertEqual(t, torch.full_like(t, 3.0))
+
+    @requires_nccl()
+    @skip_but_pass_in_sandcastle_if(torch.cuda.device_count() < 2, "NCCL test requires 2+ GPUs")
+    def test_eager_connect_async(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        pg = self._create_process_group_nccl(store, self.opts())
+        device = self.rank_to_GPU[self.rank][0]
+
+        # The handshake overlaps with setup work (e.g. model loading) and
+        # must be joined before the first collective.
+        backend = pg._get_backend(torch.device(device))
+        backend._eager_connect([torch.device(device)], async_op=True)
+        model = torch.nn.Linear(10, 10).to(device)
+        backend._wait_for_eager_connect()
+
+        t = model(torch.ones(10, 10, device=device)).sum()
+        dist.all_reduce(t)
+
     @requires_nccl()
     @skip_but_pass_in_sandcastle_if(torch.cuda.device_count() < 2, "NCCL test requires 2+ GPUs")
     def test_abort_pg(self):
@@ -2165,14 +2233,17 @@ class DistributedDataParallelTest(
 
     def _test_builtin_ddp_comm_hooks_nccl(self, gradient_as_bucket_view=False):
         """
-        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE and FP16_COMPRESS
-        can give the same result with the case of no hook registered.
+        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE,
+        FP16_COMPRESS and POWER_SGD can give the same result with the case of no hook
+        registered. POWER_SGD runs vanilla allreduce here since the iteration count
+        stays below its default start_powerSGD_iter.
         """
         process_group = self._get_process_group()
 
         for comm_hook_type in [
             dist.BuiltinCommHookType.ALLREDUCE,
             dist.BuiltinCommHookType.FP16_COMPRESS,
+            dist.BuiltinCommHookType.POWER_SGD,
         ]:
             # Get GPU model with the built-in communication hook.
             gpu_model = self._gpu_model_with_builtin_ddp_comm_hook(
@@ -11,6 +11,7 @@ from typing import Any, Tuple
 # Make the helper files in test/ importable
 pytorch_test_dir = os.path.dirname(os.path.dirname(os.path.realpath(__file__)))
 sys.path.append(pytorch_test_dir)
+from torch.testing import FileCheck
 from torch.testing._internal.jit_utils import JitTestCase, _inline_everything
 from typing import List
 from torch import Tensor
@@ -199,6 +200,36 @@ class TestAsync(JitTestCase):
         self.assertEqual(y2, foo2(x1, x2))
         self.assertEqual(y3, foo3(x1, x2, x3))
 
+    def test_parallelize_branches_pass(self):
+        @torch.jit.script
+        def two_branches(x, y):
+            a = torch.neg(x)
+            b = torch.relu(a)
+            c = torch.neg(y)
+            d = torch.relu(c)
+            return b + d
+
+        x = torch.rand(10, 10)
+        y = torch.rand(10, 10)
+        expected = torch.relu(torch.neg(x)) + torch.relu(torch.neg(y))
+
+        self.assertTrue(torch._C._jit_pass_parallelize_branches(two_branches.graph))
+        FileCheck().check_count("prim::fork", 2, exactly=True) \
+                   .check_count("aten::wait", 2, exactly=True) \
+                   .run(two_branches.graph)
+        self.assertEqual(two_branches(x, y), expected)
+
+        # a single dependency chain has nothing to overlap and is left alone
+        @torch.jit.script
+        def chain(x):
+            a = torch.neg(x)
+            b = torch.relu(a)
+            c = torch.neg(b)
+            return torch.relu(c)
+
+        self.assertFalse(torch._C._jit_pass_parallelize_branches(chain.graph))
+        FileCheck().check_not("prim::fork").run(chain.graph)
+
     def test_async_kwargs(self):
         def foo(x1, x2):
             return 2 * x1 + x2
@@ -2575,6 +2575,70 @@ class TestFrozenOptimizations(JitTestCase):
         test_weight = torch.rand([30, 20])
         self.check_linear_optimizations_2(mod_eager, 1, 1, "transpose_frozen_linear", (test_val, test_weight))
 
+    def test_linear_auto_layout(self):
+        class ModLinear(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.bias = torch.nn.Parameter(torch.rand(30))
+                self.weight = torch.nn.Parameter(torch.rand([30, 20]))
+
+            def forward(self, x):
+                return torch._C._nn.linear(x, self.weight, self.bias)
+
+        mod_eager = ModLinear().eval()
+        test_val = torch.rand([50, 20])
+
+        script_mod = torch.jit.script(mod_eager)
+        # no-ops with non-const params
+        self.run_pass("auto_layout_frozen_linear", script_mod.graph)
+        FileCheck().check_count("aten::linear", 1, exactly=True).run(script_mod.graph)
+
+        script_mod = torch.jit.freeze(script_mod)
+        # which layout wins is machine dependent; whichever form the pass
+        # keeps must compute the same values
+        self.run_pass("auto_layout_frozen_linear", script_mod.graph)
+        self.assertEqual(mod_eager(test_val), script_mod(test_val))
+
+    def test_propagate_channels_last(self):
+        class Net(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.conv1 = nn.Conv2d(3, 8, 3)
+                self.conv2 = nn.Conv2d(8, 8, 3)
+
+            def forward(self, x):
+                return self.conv2(torch.relu(self.conv1(x)))
+
+        mod = Net().eval()
+        x = torch.rand(1, 3, 16, 16)
+        # trace to get shape information; the pass only converts activations
+        # it knows to be 4-d
+        traced = torch.jit.trace(mod, (x,))
+        self.run_pass("propagate_channels_last", traced.graph)
+        # one conversion on entry, one back to contiguous on exit; the relu
+        # between the convolutions stays inside the channels-last region
+        FileCheck().check_count("aten::contiguous", 2, exactly=True).run(traced.graph)
+        out = traced(x)
+        self.assertEqual(mod(x), out)
+        self.assertTrue(out.is_contiguous())
+
+    def test_propagate_channels_last_unprofitable(self):
+        class Net(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.conv = nn.Conv2d(3, 8, 3)
+
+            def forward(self, x):
+                return self.conv(x)
+
+        mod = Net().eval()
+        x = torch.rand(1, 3, 16, 16)
+        traced = torch.jit.trace(mod, (x,))
+        # a lone convolution saves two copies but also costs two conversions;
+        # the cost model must leave it alone
+        self.run_pass("propagate_channels_last", traced.graph)
+        FileCheck().check_not("aten::contiguous").run(traced.graph)
+
     def check_linear_optimizations_2(self, eager_mod, orig_linears, new_linears, opt_pass, test_vals):
         # TODO: merge with check_linear_optimizations once both diffs land
         mod_to_device = eager_mod
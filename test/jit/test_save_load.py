@@ -738,6 +738,48 @@ class TestSaveLoad(JitTestCase):
         loaded_output = loaded_ts(inp)
         self.assertEqual(ts_output, loaded_output)
 
+    def test_storage_deduplication(self):
+        """
+        With storage deduplication enabled, loading the same weights twice
+        shares one allocation, and mutation of one copy does not leak into
+        the other.
+        """
+
+        class Model(torch.nn.Module):
+            def __init__(self):
+                super().__init__()
+                self.linear = torch.nn.Linear(8, 8)
+
+            def forward(self, x):
+                return self.linear(x)
+
+        buffer = io.BytesIO()
+        torch.jit.save(torch.jit.script(Model()), buffer)
+
+        prev = torch._C._jit_get_storage_deduplication()
+        torch._C._jit_set_storage_deduplication(True)
+        try:
+            buffer.seek(0)
+            first = torch.jit.load(buffer)
+            buffer.seek(0)
+            second = torch.jit.load(buffer)
+
+            self.assertEqual(
+                first.linear.weight.data_ptr(), second.linear.weight.data_ptr()
+            )
+
+            # Mutating one module's weights materializes its own copy.
+            expected = first.linear.weight.detach().clone()
+            with torch.no_grad():
+                second.linear.weight.add_(1)
+            self.assertNotEqual(
+                first.linear.weight.data_ptr(), second.linear.weight.data_ptr()
+            )
+            self.assertEqual(first.linear.weight.detach(), expected)
+            self.assertEqual(second.linear.weight.detach(), expected + 1)
+        finally:
+            torch._C._jit_set_storage_deduplication(prev)
+
 
 def script_module_to_buffer(script_module):
     module_buffer = io.BytesIO(
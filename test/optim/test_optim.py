@@ -696,8 +696,8 @@ class TestOptim(TestCase):
                         actual = actual[0]
                     self.assertEqual(st_p_state[k], actual)
 
-    def _test_derived_optimizers(self, optimizer_pairs_with_flags, flag):
-        if not torch.cuda.is_available():
+    def _test_derived_optimizers(self, optimizer_pairs_with_flags, flag, device="cuda"):
+        if device == "cuda" and not torch.cuda.is_available():
             return
         assert flag in ("foreach", "fused")
 
@@ -705,7 +705,6 @@ class TestOptim(TestCase):
         # params interacting with the small eps value, because that's right
         # after rho_t becomes greater than 5 in step 6.
         kIterations = 7
-        device = "cuda"
         for optimizer_constructor, params in optimizer_pairs_with_flags:
             res, state = [], []
             for flag_value in (False, True):
@@ -857,6 +856,18 @@ class TestOptim(TestCase):
         ))
         self._test_derived_optimizers(optimizer_pairs_with_flags, "fused")
 
+    def test_fused_optimizers_cpu(self):
+        optimizer_pairs_with_flags = tuple(itertools.product(
+            (optim.Adam, optim.AdamW),
+            (
+                dict(weight_decay=1., amsgrad=False),
+                dict(weight_decay=1., amsgrad=True),
+                dict(weight_decay=0., amsgrad=False),
+                dict(weight_decay=0., amsgrad=True),
+            ),
+        ))
+        self._test_derived_optimizers(optimizer_pairs_with_flags, "fused", device="cpu")
+
     @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
     def test_fused_optimizers_with_varying_tensors(self):
         optimizer_pairs_with_flags = tuple(itertools.product(
@@ -2,6 +2,9 @@
 import functools
 import gc
 import itertools as it
+import json
+import os
+import tempfile
 import textwrap
 from typing import Callable, Dict, Iterator, List, Optional, Tuple
 
@@ -1552,6 +1555,57 @@ class TestMemoryProfilerE2E(TestCase):
             destroy                    GRADIENT                    17(v0)            2 kB
             destroy                    GRADIENT                    13(v0)         1024 kB""")
 
+    def test_memory_timeline_raw_export(self) -> None:
+        model = torch.nn.Sequential(
+            torch.nn.Linear(64, 128, bias=True),
+            torch.nn.ReLU(),
+            torch.nn.Linear(128, 128, bias=False),
+        )
+
+        with profile() as prof:
+            x = torch.ones((256, 64))
+            model(x).sum().backward()
+
+        memory_profile = prof._memory_profile()
+
+        # Every allocation observed by the data flow graph gets a merged
+        # Python + C++ stack; with_stack=True means the python_tracer frames
+        # (e.g. `nn.Module: Linear_0`) are interleaved with the op names.
+        stacks = memory_profile.allocation_stacks
+        self.assertGreater(len(stacks), 0)
+        for stack in stacks.values():
+            self.assertTrue(all(isinstance(frame, str) for frame in stack))
+        self.assertTrue(
+            any("nn.Module: Linear" in frame for s in stacks.values() for frame in s),
+            stacks.values(),
+        )
+
+        mem_tl = _memory_profiler.MemoryProfileTimeline(memory_profile)
+        with tempfile.NamedTemporaryFile(suffix=".json", delete=False) as f:
+            path = f.name
+        try:
+            mem_tl.export_memory_timeline_raw(path, "cpu")
+            with open(path) as f:
+                raw = json.load(f)
+        finally:
+            os.remove(path)
+
+        self.assertEqual(set(raw.keys()), {"elements", "stacks"})
+        self.assertGreater(len(raw["elements"]), 0)
+        for t, action, numbytes, category, stack_id in raw["elements"]:
+            self.assertIn(
+                action, [a.value for a in _memory_profiler.Action])
+            self.assertGreater(numbytes, 0)
+            self.assertTrue(
+                category == -1
+                or category in [c.value for c in _memory_profiler.Category])
+            self.assertTrue(-1 <= stack_id < len(raw["stacks"]))
+
+        # Creations carry a stack; preexisting tensors do not.
+        create = _memory_profiler.Action.CREATE.value
+        self.assertTrue(
+            any(e[4] >= 0 for e in raw["elements"] if e[1] == create))
+
 
 if __name__ == "__main__":
     run_tests()
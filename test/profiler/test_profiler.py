@@ -8,6 +8,7 @@ import re
 import tempfile
 import textwrap
 import threading
+import time
 import unittest
 from unittest.mock import patch
 import weakref
@@ -520,6 +521,30 @@ class TestExecutionGraph(TestCase):
 @instantiate_parametrized_tests
 class TestProfiler(TestCase):
 
+    def test_sampling_profiler(self):
+        self.assertFalse(torch._C._profiler._sampling_profiler_enabled())
+        self.assertTrue(torch._C._profiler._enable_sampling_profiler(hz=1000.0))
+        try:
+            self.assertTrue(torch._C._profiler._sampling_profiler_enabled())
+            x = torch.randn(256, 256)
+            end = time.time() + 0.5
+            while time.time() < end:
+                with torch.autograd.profiler.record_function("sampled_region"):
+                    torch.mm(x, x)
+        finally:
+            folded = torch._C._profiler._disable_sampling_profiler()
+        self.assertFalse(torch._C._profiler._sampling_profiler_enabled())
+        # Collapsed flame graph format: "frame;frame count" per line. Half a
+        # second of busy looping at 1kHz is ample time to catch a sample.
+        self.assertTrue(len(folded) > 0)
+        for line in folded.splitlines():
+            stack, _, count = line.rpartition(" ")
+            self.assertTrue(stack)
+            self.assertTrue(int(count) > 0)
+        self.assertIn("sampled_region", folded)
+        # Disabling again is a no-op.
+        self.assertEqual(torch._C._profiler._disable_sampling_profiler(), "")
+
     @unittest.skipIf(TEST_WITH_CROSSREF, "crossref intercepts calls and changes the callsite.")
     def test_source(self):
         """Checks that source code attribution works for eager, TS and autograd mode
@@ -1402,6 +1402,25 @@ class TestStaticQuantizedModule(QuantizationTestCase):
                     batch_size, in_features, out_features, use_bias,
                     per_channel)
 
+    @skipIfNoONEDNN
+    def test_linear_gelu(self):
+        """test API functionality for nn.intrinsic.quantized.linear_gelu"""
+        with override_quantized_engine('onednn'):
+            options = itertools.product(
+                [1, 5],  # batch size
+                [16, 32],  # in_features
+                [4, 8],  # out_features
+                [True, False],  # use_bias
+                [True, False],  # per_channel
+                ['none', 'tanh'])  # approximate
+            for (batch_size, in_features, out_features, use_bias,
+                 per_channel, approximate) in options:
+                self._test_linear_api_impl(
+                    nniq.LinearGelu, 'QuantizedLinearGelu',
+                    torch.ops.quantized.linear_gelu,
+                    batch_size, in_features, out_features, use_bias,
+                    per_channel, approximate=approximate)
+
 class TestDynamicQuantizedModule(QuantizationTestCase):
     def _test_qconv_impl(self, q_mod, dq_mod, dim, dtype, bias):
         in_channels = 3
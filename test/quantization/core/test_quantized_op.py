@@ -3654,6 +3654,8 @@ class TestQuantizedLinear(TestCase):
                 qlinear = torch.ops.quantized.linear_relu
             elif post_op == 'leaky_relu':
                 qlinear = torch.ops.quantized.linear_leaky_relu
+            elif post_op == 'gelu':
+                qlinear = torch.ops.quantized.linear_gelu
             else:
                 qlinear = torch.ops.quantized.linear
             if use_multi_dim_input:
@@ -3759,6 +3761,8 @@ class TestQuantizedLinear(TestCase):
                 Y_fp32_ref[Y_fp32_ref < 0.0] = 0.0
             elif post_op == 'leaky_relu':
                 Y_fp32_ref = F.leaky_relu(Y_fp32_ref, **post_op_kwargs)
+            elif post_op == 'gelu':
+                Y_fp32_ref = F.gelu(Y_fp32_ref, **post_op_kwargs)
             Y_q_ref2 = torch.quantize_per_tensor(
                 Y_fp32_ref, Y_scale, Y_zp, dtype)
             # Assert equal
@@ -4129,6 +4133,59 @@ class TestQuantizedLinear(TestCase):
                                         use_bias, post_op, use_multi_dim_input,
                                         use_channelwise)
 
+    @skipIfNoONEDNN
+    def test_qlinear_gelu(self):
+        with override_quantized_engine('onednn'):
+            batch_size_list = [1, 4]
+            input_channels_list = [16, 32]
+            output_channels_list = [4, 8]
+            use_bias_list = [True, False]
+            use_multi_dim_input_list = [True, False]
+            use_channelwise_list = [True, False]
+            approximate_list = ['none', 'tanh']
+            post_op = 'gelu'
+            cases = itertools.product(batch_size_list, input_channels_list,
+                                      output_channels_list, use_bias_list,
+                                      use_multi_dim_input_list,
+                                      use_channelwise_list, approximate_list)
+            for batch_size, input_channels, output_channels, use_bias,\
+                    use_multi_dim_input, use_channelwise, approximate in cases:
+                self._test_qlinear_impl(batch_size, input_channels, output_channels,
+                                        use_bias, post_op, use_multi_dim_input,
+                                        use_channelwise, approximate=approximate)
+
+    @skipIfNoONEDNN
+    def test_qlinear_add_relu(self):
+        with override_quantized_engine('onednn'):
+            batch_size_list = [1, 4]
+            input_channels_list = [16, 32]
+            output_channels_list = [4, 8]
+            use_bias_list = [True, False]
+            cases = itertools.product(batch_size_list, input_channels_list,
+                                      output_channels_list, use_bias_list)
+            for batch_size, input_channels, output_channels, use_bias in cases:
+                X = torch.randn(batch_size, input_channels)
+                X_q = torch.quantize_per_tensor(X, 0.05, 10, torch.quint8)
+                W = torch.randn(output_channels, input_channels)
+                W_q = torch.quantize_per_tensor(W, 0.02, 0, torch.qint8)
+                b = torch.randn(output_channels) if use_bias else None
+                accum = torch.randn(batch_size, output_channels)
+                accum_q = torch.quantize_per_tensor(accum, 0.05, 5, torch.quint8)
+                Y_scale, Y_zp = 0.07, 2
+                W_prepack = torch.ops.quantized.linear_prepack(W_q, b)
+                # The op accumulates into the accum tensor in place, so the
+                # reference is computed first.
+                Y_fp32_ref = F.linear(X_q.dequantize(), W_q.dequantize(), b)
+                Y_fp32_ref += accum_q.dequantize()
+                Y_fp32_ref = F.relu(Y_fp32_ref)
+                Y_q_ref = torch.quantize_per_tensor(
+                    Y_fp32_ref, Y_scale, Y_zp, torch.quint8)
+                Y_q = torch.ops.quantized.linear_add_relu(
+                    X_q, accum_q, W_prepack, Y_scale, Y_zp)
+                np.testing.assert_array_almost_equal(
+                    Y_q_ref.int_repr().numpy(), Y_q.int_repr().numpy(),
+                    decimal=0)
+
 @unittest.skipIf(IS_MACOS, "Known test failure on Mac.")
 class TestQuantizedEmbeddingOps(TestCase):
 
@@ -4293,6 +4293,44 @@ Done""")
                     out.backward()
             self.assertIn('MyFunc.apply', str(w[0].message))
 
+    def test_sampled_anomaly_detect_nonfinite(self):
+        size = 10
+
+        class MyFunc(Function):
+            @staticmethod
+            def forward(ctx, inp):
+                return inp.sum(0, keepdim=True)
+
+            @staticmethod
+            def backward(ctx, gO):
+                gI = gO.clone().expand(size)
+                gI[0] = 0
+                gI[0] /= 0  # Generate a nan
+                return gI
+
+        # A clean backward under sampled anomaly mode must not raise.
+        inp = torch.rand(size, requires_grad=True)
+        with torch.autograd.set_sampled_anomaly(True):
+            (inp * 2).sum().backward()
+        self.assertFalse(torch._C._is_sampled_anomaly_enabled())
+
+        inp = torch.rand(size, requires_grad=True)
+        out = MyFunc.apply(inp)
+        with self.assertRaisesRegex(
+                RuntimeError,
+                r"Function 'MyFuncBackward' returned non-finite values in its "
+                r"0th output \(detected by sampled anomaly mode\)\."):
+            with torch.autograd.set_sampled_anomaly(True):
+                out.backward()
+
+        # The failure report lists recently executed nodes on the thread.
+        inp = torch.rand(size, requires_grad=True)
+        out = MyFunc.apply(inp)
+        with self.assertRaisesRegex(
+                RuntimeError, "Recently executed nodes on this thread"):
+            with torch.autograd.set_sampled_anomaly(True):
+                out.backward()
+
     def test_calculate_shape_util(self):
         out = torch.randn(10, 5, requires_grad=True)
         grad = torch.randn(5, 10, requires_grad=True)
@@ -7927,6 +7965,36 @@ for shape in [(1,), ()]:
                 x = torch.sparse_coo_tensor(torch.tensor([[1, 1]]).long(), torch.tensor([1., 1.]), requires_grad=True)
                 test(lambda: x, cuda, pin_memory)
 
+    def test_graph_save_on_cpu_native(self):
+        def test(get_input, cuda):
+            with torch.autograd.graph.save_on_cpu_native():
+                a = get_input()
+                if cuda:
+                    a = a.cuda().detach().requires_grad_()
+                y = a * a
+                y.sum().backward()
+                self.assertEqual(a.grad, 2 * a)
+
+        # the context manager restores the previous state on exit
+        self.assertFalse(torch._C._autograd._saved_tensors_cpu_offload_is_enabled())
+        for cuda in [False] + ([True] if torch.cuda.is_available() else []):
+            test(lambda: torch.randn(5, requires_grad=True), cuda)
+            test(lambda: torch.randn(5, requires_grad=True, dtype=torch.double), cuda)
+        self.assertFalse(torch._C._autograd._saved_tensors_cpu_offload_is_enabled())
+
+        # explicit Python hooks take precedence over the native offload mode
+        pack_count = [0]
+
+        def pack(x):
+            pack_count[0] += 1
+            return x
+
+        with torch.autograd.graph.save_on_cpu_native():
+            with torch.autograd.graph.saved_tensors_hooks(pack, lambda x: x):
+                a = torch.randn(5, requires_grad=True)
+                y = a * a
+        self.assertEqual(pack_count[0], 2)
+
     @unittest.skipIf(not TEST_CUDA, "test requires CUDA")
     def test_graph_save_on_cpu_cuda(self):
         def f(x):
@@ -7959,6 +8027,39 @@ for shape in [(1,), ()]:
             memory_with_hooks = torch.cuda.memory_allocated()
             self.assertEqual(memory_with_hooks, memory_without_grad)
 
+    def test_grad_accumulation_many_consumers(self):
+        # exercises InputBuffer's deferred, batched accumulation path
+        def run(create_graph):
+            x = torch.randn(5, requires_grad=True)
+            y = x * 1
+            out = sum(y * i for i in range(1, 6))
+            out.sum().backward(create_graph=create_graph)
+            self.assertEqual(x.grad, torch.full((5,), 15.0))
+
+        run(create_graph=False)
+        x = torch.randn(5, requires_grad=True)
+        y = x * 1
+        out = sum(y * i for i in range(1, 6))
+        grad, = torch.autograd.grad(out.sum(), x, create_graph=True)
+        self.assertEqual(grad, torch.full((5,), 15.0))
+
+    def test_backward_same_graph_repeatedly(self):
+        # repeated backwards over one graph replay the engine's cached
+        # execution schedule; fresh graphs and different outputs must not
+        x = torch.randn(5, requires_grad=True)
+        y = (x * x).sum()
+        for _ in range(3):
+            x.grad = None
+            y.backward(retain_graph=True)
+            self.assertEqual(x.grad, 2 * x)
+
+        z = x * x
+        out = z.sum()
+        g1, = torch.autograd.grad(out, x, retain_graph=True)
+        g2, = torch.autograd.grad(out, z, retain_graph=True)
+        self.assertEqual(g1, 2 * x)
+        self.assertEqual(g2, torch.ones_like(z))
+
     def test_multi_grad_hooks(self):
         t1 = torch.rand(2, requires_grad=True)
         t2 = torch.rand(2, requires_grad=True)
@@ -1479,6 +1479,51 @@ class TestCuda(TestCase):
         self.assertNotEqual(t.data_ptr(), ptr, msg='allocation re-used too soon')
         self.assertEqual(list(gpu_tensor), [1])
 
+    def test_async_copy_to_host(self):
+        cycles_per_ms = get_cycles_per_ms()
+
+        src = torch.ones(1024, device='cuda')
+        # the copy must order after everything already enqueued on the
+        # current stream, without the caller ever synchronizing
+        torch.cuda._sleep(int(50 * cycles_per_ms))
+        src.add_(1)
+        fut = torch._C._cuda_asyncCopyToHost(src)
+        dst = fut.wait()
+        self.assertEqual(dst.device.type, 'cpu')
+        self.assertTrue(dst.is_pinned())
+        self.assertEqual(dst, torch.full((1024,), 2.0))
+
+        # non-contiguous sources round-trip through a contiguous staging copy
+        src = torch.randn(8, 8, device='cuda').t()
+        dst = torch._C._cuda_asyncCopyToHost(src).wait()
+        self.assertEqual(dst, src.cpu())
+
+    def test_host_memory_stats(self):
+        t = torch.empty(1024, dtype=torch.uint8).pin_memory()
+        stats = torch.cuda.host_memory_stats()
+        self.assertGreaterEqual(stats['allocated_bytes'], 1024)
+        self.assertTrue(any(cls['block_size'] >= 1024 and cls['allocated_blocks'] > 0
+                            for cls in stats['size_classes']))
+
+        del t
+        stats = torch.cuda.host_memory_stats()
+        self.assertGreaterEqual(stats['cached_bytes'], 1024)
+
+        # trimming with a zero idle threshold releases every cached block
+        torch._C._cuda_hostAllocatorTrim(0.0)
+        stats = torch.cuda.host_memory_stats()
+        self.assertEqual(stats['cached_bytes'], 0)
+
+        # with a tiny per-class cap, freed blocks bypass the cache entirely
+        torch._C._cuda_hostAllocatorSetCacheLimit(1)
+        try:
+            t = torch.empty(1024, dtype=torch.uint8).pin_memory()
+            del t
+            stats = torch.cuda.host_memory_stats()
+            self.assertEqual(stats['cached_bytes'], 0)
+        finally:
+            torch._C._cuda_hostAllocatorSetCacheLimit(0)
+
     @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
     def test_caching_pinned_memory_multi_gpu(self):
         # checks that the events preventing pinned memory from being re-used
@@ -1839,6 +1884,30 @@ except RuntimeError as e:
         torch.cuda.synchronize()
         self.assertEqual(y[0, 0, 0, 2**31 - 2], expected)
 
+    def test_prefetcher(self):
+        prefetcher = torch._C._CudaPrefetcher(torch.device("cuda"), 2)
+        sources = [torch.randn(64, 64) for _ in range(5)]
+        results = []
+        for src in sources:
+            prefetcher.put(src)
+            results.append(prefetcher.get())
+        for src, result in zip(sources, results):
+            self.assertEqual(result.device.type, "cuda")
+            self.assertEqual(result.cpu(), src)
+
+        # depth bounds the queue, but puts beyond it must still succeed
+        for src in sources:
+            prefetcher.put(src)
+        self.assertLessEqual(prefetcher.size(), 5)
+        for src in sources:
+            self.assertEqual(prefetcher.get().cpu(), src)
+        self.assertEqual(prefetcher.size(), 0)
+
+        with self.assertRaisesRegex(RuntimeError, "no pending transfer"):
+            prefetcher.get()
+        with self.assertRaisesRegex(RuntimeError, "expects a CPU tensor"):
+            prefetcher.put(torch.randn(2, device="cuda"))
+
     # this might create a reference cycle on self...
     def _make_multiply_in_stream(self):
         class MultiplyInStream(torch.autograd.Function):
@@ -4285,6 +4354,55 @@ exit(2)
             model_graphed({"x": real_inputs[0]}), model_control({"x": real_inputs[0]})
         )
 
+    @unittest.skipIf((not TEST_GRAPH), "CUDA >= 11.0 or ROCM >= 5.3 required for graphs")
+    def test_graph_make_graphed_inference_callable(self):
+        torch.manual_seed(5)
+        torch.cuda.manual_seed(5)
+
+        N, D_in, H, D_out = 64, 512, 256, 128
+
+        model = torch.nn.Sequential(
+            torch.nn.Linear(D_in, H), torch.nn.ReLU(), torch.nn.Linear(H, D_out)
+        ).cuda().eval()
+
+        x = torch.randn(N, D_in, device="cuda")
+        graphed_model = torch.cuda.make_graphed_inference_callable(model, (x,))
+
+        real_inputs = [torch.rand_like(x) for _ in range(10)]
+        with torch.no_grad():
+            for data in real_inputs:
+                out_graphed = graphed_model(data)
+                # Outputs live in placeholder storage and are overwritten by the
+                # next replay, so compare before the next step.
+                self.assertEqual(out_graphed, model(data))
+                self.assertFalse(out_graphed.requires_grad)
+
+            # Passing the placeholder itself should skip the copy and still replay.
+            x.copy_(real_inputs[0])
+            self.assertEqual(graphed_model(x), model(real_inputs[0]))
+
+    @unittest.skipIf((not TEST_GRAPH), "CUDA >= 11.0 or ROCM >= 5.3 required for graphs")
+    def test_graph_make_graphed_step(self):
+        params = [torch.ones(i + 4, i + 4, device="cuda") for i in range(4)]
+        grads = [torch.full_like(p, 0.5) for p in params]
+        params_control = [p.clone() for p in params]
+
+        def step():
+            torch._foreach_add_(params, grads, alpha=-0.1)
+            torch._foreach_mul_(params, 0.99)
+
+        graphed_step = torch.cuda.make_graphed_step(step, num_warmup_iters=2)
+
+        # 2 warmup calls + 1 capture call + 3 replays, one update each.
+        steps = 6
+        for _ in range(steps):
+            graphed_step()
+        for _ in range(steps):
+            torch._foreach_add_(params_control, grads, alpha=-0.1)
+            torch._foreach_mul_(params_control, 0.99)
+        for p, pc in zip(params, params_control):
+            self.assertEqual(p, pc)
+
     def _test_graphed_optimizer(self, steps_warmup, steps_train, optimizer_ctor, kwargs):
         for actually_do_graphs in (True, False):
             params = [
@@ -5042,6 +5160,25 @@ class TestCudaComm(TestCase):
         finally:
             torch.cuda.memory._record_memory_history(None)
 
+    @unittest.skipIf(TEST_CUDAMALLOCASYNC, "snapshot not supported by CUDAMallocAsync")
+    def test_memory_snapshot_diff(self):
+        torch.cuda.memory.empty_cache()
+        before = torch.cuda.memory._snapshot()
+        # large enough to force a new segment rather than reuse of a cached one
+        x = torch.rand(40 * 1024 * 1024, device='cuda')
+        after = torch.cuda.memory._snapshot()
+
+        diff = torch.cuda.memory._snapshot_diff(before, after)
+        self.assertTrue(len(diff['segments_added']) > 0)
+        self.assertEqual(diff['segments_removed'], [])
+        self.assertTrue(diff['delta']['allocated'] >= x.numel() * x.element_size())
+
+        del x
+        torch.cuda.memory.empty_cache()
+        diff = torch.cuda.memory._snapshot_diff(after, torch.cuda.memory._snapshot())
+        self.assertTrue(len(diff['segments_removed']) > 0)
+        self.assertTrue(diff['delta']['allocated'] < 0)
+
     @unittest.skipIf(not IS_LINUX, "linux only cpp unwinding")
     def test_direct_traceback(self):
         from torch._C._profiler import gather_traceback, symbolize_tracebacks
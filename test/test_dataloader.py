@@ -29,6 +29,7 @@ from torch.utils.data import (
     _utils
 )
 from torch.utils.data._utils import MP_STATUS_CHECK_INTERVAL
+from torch.utils.data._utils.shm_ring import SharedMemoryRing
 from torch.utils.data.dataset import random_split
 from torch.utils.data.datapipes.iter import IterableWrapper
 from torch._utils import ExceptionWrapper
@@ -2779,5 +2780,125 @@ class TestConvAfterFork(TestCase):
             self.assertEqual(x.shape, (1, 1, 1, 23999))
 
 
+def _shm_ring_producer(ring, num_batches):
+    for i in range(num_batches):
+        ring.put([torch.full((4, 3), float(i)), torch.arange(4, dtype=torch.int64) + i])
+
+
+class TestSharedMemoryRing(TestCase):
+    def test_same_process_roundtrip(self):
+        ring = SharedMemoryRing([((2, 2), torch.float32), ((3,), torch.int64)], num_slots=2)
+        self.assertEqual(ring.num_slots, 2)
+
+        # Empty ring: get() times out and yields None.
+        with ring.get(timeout=0.01) as batch:
+            self.assertIsNone(batch)
+
+        self.assertTrue(ring.put([torch.ones(2, 2), torch.arange(3)]))
+        self.assertTrue(ring.put([torch.zeros(2, 2), torch.arange(3) + 1]))
+        # Full ring: put() times out.
+        self.assertFalse(ring.put([torch.ones(2, 2), torch.arange(3)], timeout=0.01))
+
+        with ring.get() as (a, b):
+            self.assertEqual(a, torch.ones(2, 2))
+            self.assertEqual(b, torch.arange(3))
+        # Releasing the slot makes room again.
+        self.assertTrue(ring.put([torch.full((2, 2), 2.0), torch.arange(3) + 2]))
+
+    def test_spec_mismatch(self):
+        ring = SharedMemoryRing([((2, 2), torch.float32)], num_slots=1)
+        with self.assertRaisesRegex(ValueError, "expected 1 tensors"):
+            ring.put([torch.ones(2, 2), torch.ones(2, 2)])
+        with self.assertRaisesRegex(ValueError, "does not match the ring spec"):
+            ring.put([torch.ones(2, 3)])
+        with self.assertRaisesRegex(ValueError, "does not match the ring spec"):
+            ring.put([torch.ones(2, 2, dtype=torch.float64)])
+
+    @unittest.skipIf(IS_WINDOWS, "Needs fork")
+    def test_cross_process_transfer(self):
+        num_batches = 20
+        ring = SharedMemoryRing([((4, 3), torch.float32), ((4,), torch.int64)], num_slots=3)
+        producer = mp.Process(target=_shm_ring_producer, args=(ring, num_batches))
+        producer.start()
+        try:
+            for i in range(num_batches):
+                with ring.get(timeout=JOIN_TIMEOUT) as batch:
+                    self.assertIsNotNone(batch)
+                    values, indices = batch
+                    self.assertEqual(values, torch.full((4, 3), float(i)))
+                    self.assertEqual(indices, torch.arange(4, dtype=torch.int64) + i)
+        finally:
+            producer.join(JOIN_TIMEOUT)
+        self.assertEqual(producer.exitcode, 0)
+
+
+class _SharedTableDataset(Dataset):
+    def __init__(self):
+        from torch.utils.data import mark_shareable
+        self.table = mark_shareable(torch.arange(32, dtype=torch.float64))
+        self.metadata = {'nested': [self.table]}
+
+    def __len__(self):
+        return 4
+
+    def __getitem__(self, idx):
+        # Mutating the shared table from a worker must not be visible to
+        # the parent or to sibling workers (copy-on-write protection).
+        self.table += 1
+        return self.table[idx].clone()
+
+
+class TestSharedMarkedTensors(TestCase):
+    def test_mark_shareable_type_check(self):
+        from torch.utils.data import mark_shareable
+        with self.assertRaisesRegex(TypeError, "expects a Tensor"):
+            mark_shareable([torch.ones(2)])
+        t = torch.ones(2)
+        self.assertIs(mark_shareable(t), t)
+
+    def test_share_marked_tensors_traversal(self):
+        from torch.utils.data import mark_shareable
+        from torch.utils.data._utils import shared_memory
+        marked = mark_shareable(torch.arange(8, dtype=torch.float32))
+        unmarked = torch.arange(8, dtype=torch.float32)
+        holder = _SharedTableDataset.__new__(_SharedTableDataset)
+        holder.table = marked
+        holder.metadata = {'nested': [marked], 'other': (unmarked,)}
+        # The marked tensor is reachable twice but shared once.
+        self.assertEqual(shared_memory.share_marked_tensors(holder), 1)
+        self.assertTrue(marked.is_shared())
+        self.assertFalse(unmarked.is_shared())
+
+    def test_protect_shared_tensors_copy_on_write(self):
+        from torch.utils.data import mark_shareable
+        from torch.utils.data._utils import shared_memory
+        t = mark_shareable(torch.arange(16, dtype=torch.float32))
+        holder = _SharedTableDataset.__new__(_SharedTableDataset)
+        holder.table = t
+        holder.metadata = {}
+        shared_memory.share_marked_tensors(holder)
+        orig = t.clone()
+        self.assertEqual(shared_memory.protect_shared_tensors(holder), 1)
+        guard = shared_memory._cow_guards[-1]
+        # The write materializes a private copy; the shared mapping that
+        # other processes see (still referenced by the guard) is unchanged.
+        t.add_(1)
+        self.assertEqual(t, orig + 1)
+        shared_view = torch.empty(0, dtype=torch.float32)
+        shared_view.set_(guard)
+        self.assertEqual(shared_view, orig)
+
+    @unittest.skipIf(IS_WINDOWS, "Needs fork")
+    def test_worker_mutation_is_private(self):
+        dataset = _SharedTableDataset()
+        expected = dataset.table.clone()
+        loader = DataLoader(dataset, batch_size=None, num_workers=2,
+                            multiprocessing_context='fork')
+        list(loader)
+        # Workers incremented their copies; the parent's table is intact.
+        self.assertTrue(dataset.table.is_shared())
+        self.assertEqual(dataset.table, expected)
+
+
 if __name__ == '__main__':
     run_tests()
@@ -159,6 +159,20 @@ class TestPythonJiterator(TestCase):
         for i in range(num_outputs):
             self.assertEqual(expected[i], result[i])
 
+    @parametrize("dtype", [torch.float32, torch.float16])
+    def test_prewarm(self, dtype):
+        code_string = "template <typename T> T my_prewarmed_kernel(T x, T y, T alpha) { return x + alpha * y; }"
+        jitted_fn = create_jit_fn(code_string, alpha=1.0)
+        jitted_fn.prewarm(dtype)
+
+        a = torch.rand(3, device='cuda').type(dtype)
+        b = torch.rand(3, device='cuda').type(dtype)
+
+        expected = a + 2.0 * b
+        result = jitted_fn(a, b, alpha=2.0)
+
+        self.assertEqual(expected, result)
+
     @parametrize("code_string", [
         "template <typename T> T my _kernel(T x) { return x; }",
         "template <typename T> Tmy_kernel(T x) { return x; }",
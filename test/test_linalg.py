@@ -5703,6 +5703,34 @@ scipy_lobpcg  | {:10.2e}  | {:10.2e}  | {:6} | N/A
                                r"Expected result.size\(0\) to be 17 but got 16",
                                lambda: torch._int_mm(genf_int(17, 8), genf_int(8, 32), out=genf_int(16, 31).int()))
 
+    @onlyCPU
+    @parametrize("m", [1, 7])
+    @parametrize("group_size", [32, 64])
+    @dtypes(torch.float32, torch.bfloat16)
+    def test__weight_int4pack_mm(self, device, dtype, m, group_size):
+        n, k = 24, 128
+        a = torch.rand((m, k), dtype=dtype, device=device)
+        w = torch.rand((n, k), dtype=dtype, device=device) * 2 - 1
+
+        packed, scales_and_zeros = torch._convert_weight_to_int4pack(w, group_size)
+        self.assertEqual(packed.dtype, torch.uint8)
+        self.assertEqual(packed.shape, (n, k // 2))
+        self.assertEqual(scales_and_zeros.shape, (n, k // group_size, 2))
+
+        # reconstruct the dequantized weight the kernel sees and compare
+        # against a plain matmul with it
+        q = torch.stack([packed & 0xF, packed >> 4], dim=-1).reshape(n, k)
+        scales = scales_and_zeros[:, :, 0].repeat_interleave(group_size, dim=1)
+        zeros = scales_and_zeros[:, :, 1].repeat_interleave(group_size, dim=1)
+        w_dq = q.float() * scales + zeros
+        # 4-bit quantization itself must stay within a scale step
+        self.assertEqual(w_dq, w.float(), atol=(1.0 / 15) + 1e-6, rtol=0)
+
+        res = torch._weight_int4pack_mm(a, packed, group_size, scales_and_zeros)
+        self.assertEqual(res.dtype, dtype)
+        ref = torch.mm(a.float(), w_dq.t()).to(dtype)
+        self.assertEqual(res, ref, atol=3e-2, rtol=3e-2)
+
     @slowTest
     @onlyNativeDeviceTypes
     # bfloat16 doesn't have sufficient precision to pass this test
@@ -247,6 +247,34 @@ class TestMkldnn(TestCase):
     def test_conv3d(self):
         self._test_conv_base(dim=3)
 
+    def test_conv_weight_pack_rehydrate(self):
+        conv_module = {2: torch.nn.Conv2d, 3: torch.nn.Conv3d}
+        rehydrate_op = {2: torch.ops.mkldnn._rehydrate_conv2d_weight_pack,
+                        3: torch.ops.mkldnn._rehydrate_conv3d_weight_pack}
+        for dim in [2, 3]:
+            conv = conv_module[dim](in_channels=4,
+                                    out_channels=8,
+                                    kernel_size=3,
+                                    stride=2,
+                                    padding=1).float()
+            mkldnn_conv = mkldnn_utils.to_mkldnn(copy.deepcopy(conv))
+            packed_weight = mkldnn_conv.weight
+            blob = torch.ops.mkldnn._export_weight_pack(packed_weight)
+            self.assertEqual(blob.dtype, torch.uint8)
+            fingerprint = torch.ops.mkldnn._weight_pack_fingerprint()
+            # matching fingerprint: blob is adopted without a reorder
+            rehydrated = rehydrate_op[dim](
+                conv.weight.to_mkldnn(), blob, fingerprint,
+                mkldnn_conv.padding, mkldnn_conv.stride,
+                mkldnn_conv.dilation, mkldnn_conv.groups)
+            self.assertEqual(rehydrated.to_dense(), packed_weight.to_dense())
+            # stale fingerprint: falls back to a fresh reorder
+            rehydrated = rehydrate_op[dim](
+                conv.weight.to_mkldnn(), blob, "stale-fingerprint",
+                mkldnn_conv.padding, mkldnn_conv.stride,
+                mkldnn_conv.dilation, mkldnn_conv.groups)
+            self.assertEqual(rehydrated.to_dense(), packed_weight.to_dense())
+
     @unittest.skipIf(IS_WINDOWS, "Limit support for bf16 path")
     def _test_conv_bf16_base(self, dim):
         conv_module = {1: torch.nn.Conv1d, 2: torch.nn.Conv2d, 3: torch.nn.Conv3d}
@@ -1203,6 +1231,26 @@ class TestMkldnn(TestCase):
                                        msg,
                                        lambda: mkldnn_linear_bf16(x_bf16.to_mkldnn()))
 
+    def test_prepacked_linear(self):
+        in_features = torch.randint(3, 10, (1,)).item()
+        out_features = torch.randint(3, 100, (1,)).item()
+        x = torch.randn(3, in_features, dtype=torch.float32) * 10
+
+        for bias in [True, False]:
+            for batch_size in [None, 3]:
+                linear = torch.nn.Linear(in_features, out_features, bias=bias).float()
+                prepacked_linear = mkldnn_utils.prepack_linear(
+                    copy.deepcopy(linear), batch_size=batch_size)
+                # Inputs and outputs stay dense.
+                self.assertEqual(linear(x), prepacked_linear(x))
+                if batch_size is None:
+                    # Inputs with more than 2 dimensions are flattened like in linear.
+                    x3d = torch.randn(2, 3, in_features, dtype=torch.float32)
+                    self.assertEqual(linear(x3d), prepacked_linear(x3d))
+
+                self._test_serialization(prepacked_linear, (x,))
+                self._test_tracing(prepacked_linear, (x,))
+
     def test_softmax(self):
         x = torch.randn(3, 4, 5, dtype=torch.float32) * 10
         for dim in range(x.ndim):
@@ -624,6 +624,34 @@ if __name__ == "__main__":
             self.assertEqual(list(tensor), [4, 4, 4, 4])
         p.join()
 
+    @staticmethod
+    def _test_cuda_ipc_pool_child(endpoint, c2p):
+        for _ in range(10):
+            c2p.put(endpoint.recv(timeout=30).cpu())
+
+    @unittest.skipIf(NO_MULTIPROCESSING_SPAWN, "Disabled for environments that \
+                     don't support multiprocessing with spawn start method")
+    @unittest.skipIf(not TEST_CUDA_IPC, 'CUDA IPC not available')
+    def test_cuda_ipc_pool(self):
+        from torch.multiprocessing._cuda_ipc_pool import CudaIPCPool
+
+        pool = CudaIPCPool('cuda:0', slot_bytes=4096, num_slots=4)
+        ctx = mp.get_context('spawn')
+        c2p = ctx.SimpleQueue()
+        p = ctx.Process(
+            target=TestMultiprocessing._test_cuda_ipc_pool_child,
+            args=(pool.endpoint(), c2p))
+        p.start()
+
+        sent = []
+        for i in range(10):
+            t = torch.randn(16, 8, device='cuda') + i
+            sent.append(t.cpu())
+            pool.send(t, timeout=30)
+        for i in range(10):
+            self.assertEqual(c2p.get(), sent[i])
+        p.join()
+
     @staticmethod
     def _test_event_multiprocess_child(event, p2c, c2p):
         c2p.put(0)  # notify parent child is ready
@@ -1715,6 +1715,30 @@ class TestNestedTensorDeviceType(TestCase):
             lambda: torch.nn.functional.linear(nt_noncontiguous, weight)
         )
 
+    @dtypes(torch.float, torch.double)
+    def test_nested_ffn(self, device, dtype):
+        nt = torch.nested.nested_tensor([torch.randn(1, 4, device=device, dtype=dtype),
+                                         torch.randn(2, 4, device=device, dtype=dtype),
+                                         torch.randn(3, 4, device=device, dtype=dtype)])
+        weight1 = torch.randn(8, 4, device=device, dtype=dtype)
+        bias1 = torch.randn(8, device=device, dtype=dtype)
+        weight2 = torch.randn(4, 8, device=device, dtype=dtype)
+        bias2 = torch.randn(4, device=device, dtype=dtype)
+        for use_gelu in (True, False):
+            actual = torch._nested_ffn(nt, weight1, bias1, weight2, bias2, use_gelu)
+            activation = torch.nn.functional.gelu if use_gelu else torch.nn.functional.relu
+            expected = torch.nested.nested_tensor([
+                torch.functional.F.linear(
+                    activation(torch.functional.F.linear(t, weight1, bias1)),
+                    weight2, bias2)
+                for t in nt.unbind()])
+            self.assertEqual(actual, expected)
+
+        # mismatched inner weight shape
+        bad_weight2 = torch.randn(4, 6, device=device, dtype=dtype)
+        with self.assertRaisesRegex(RuntimeError, r"weight2.size\(1\) == weight1.size\(0\)"):
+            torch._nested_ffn(nt, weight1, bias1, bad_weight2, bias2)
+
     @dtypes(torch.float, torch.float16, torch.double)
     def test_transpose(self, device, dtype):
         nt = random_nt(device, dtype, 4, (4, 4))
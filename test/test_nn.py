@@ -7207,6 +7207,64 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
 
             self.assertEqual(grads1, grads2, rtol=rtol, atol=atol)
 
+    def test_fused_dropout_add_layer_norm(self):
+        def check(device):
+            x = torch.randn(4, 16, device=device)
+            res = torch.randn(4, 16, device=device)
+            weight = torch.randn(16, device=device)
+            bias = torch.randn(16, device=device)
+
+            # Eval mode matches the unfused composition and returns no mask.
+            out, y, mask_bits, mean, rstd = torch._fused_dropout_add_layer_norm(
+                x, res, [16], weight, bias, 0.5, 1e-5, False)
+            self.assertEqual(y, x + res)
+            self.assertEqual(mask_bits.numel(), 0)
+            self.assertEqual(out, F.layer_norm(x + res, [16], weight, bias, 1e-5))
+
+            # Training mode: reconstruct the reference from the returned
+            # bitmask (one byte per 8 row elements, bit k covers element
+            # 8 * b + k).
+            p = 0.5
+            out, y, mask_bits, mean, rstd = torch._fused_dropout_add_layer_norm(
+                x, res, [16], weight, bias, p, 1e-5, True)
+            self.assertEqual(mask_bits.shape, torch.Size([4, 2]))
+            shifts = torch.arange(8, device=device, dtype=torch.uint8)
+            mask = (mask_bits.unsqueeze(-1) >> shifts).bitwise_and(1).reshape(4, 16).to(x.dtype)
+            y_ref = x * mask / (1 - p) + res
+            self.assertEqual(y, y_ref)
+            self.assertEqual(out, F.layer_norm(y_ref, [16], weight, bias, 1e-5))
+
+        check('cpu')
+        if TEST_CUDA:
+            check('cuda')
+
+    def test_fused_dropout_add_layer_norm_backward(self):
+        x = torch.randn(4, 16, requires_grad=True)
+        res = torch.randn(4, 16, requires_grad=True)
+        weight = torch.randn(16, requires_grad=True)
+        bias = torch.randn(16, requires_grad=True)
+        p = 0.3
+
+        out, y, mask_bits, _, _ = torch._fused_dropout_add_layer_norm(
+            x, res, [16], weight, bias, p, 1e-5, True)
+        grad_out = torch.randn_like(out)
+        gx, gres, gw, gb = torch.autograd.grad(out, [x, res, weight, bias], grad_out)
+
+        # Reference: the same composition replayed with the mask the fused
+        # op drew.
+        shifts = torch.arange(8, dtype=torch.uint8)
+        mask = (mask_bits.unsqueeze(-1) >> shifts).bitwise_and(1).reshape(4, 16).to(x.dtype)
+        x_ref = x.detach().requires_grad_()
+        res_ref = res.detach().requires_grad_()
+        w_ref = weight.detach().requires_grad_()
+        b_ref = bias.detach().requires_grad_()
+        out_ref = F.layer_norm(x_ref * mask / (1 - p) + res_ref, [16], w_ref, b_ref, 1e-5)
+        out_ref.backward(grad_out)
+        self.assertEqual(gx, x_ref.grad)
+        self.assertEqual(gres, res_ref.grad)
+        self.assertEqual(gw, w_ref.grad)
+        self.assertEqual(gb, b_ref.grad)
+
     def test_padding_list(self):
         # Padding can be a list, or tuple (regression test for gh-54452)
         x = torch.randn(4, 8, 32, 32)
@@ -253,6 +253,40 @@ class TestNumPyInterop(TestCase):
         x.strides = (3,)
         self.assertRaises(ValueError, lambda: torch.from_numpy(x))
 
+    def test_from_numpy_consume(self, device) -> None:
+        # stealing an owned buffer: zero-copy, and the tensor stays valid
+        # after the array is dropped
+        array = np.arange(16, dtype=np.float64)
+        tensor = torch._from_numpy_consume(array)
+        self.assertEqual(tensor.data_ptr(), array.ctypes.data)
+        # reads through the stolen-from array remain valid
+        self.assertFalse(array.flags["OWNDATA"])
+        self.assertEqual(array[3], 3.0)
+        del array
+        tensor += 1
+        self.assertEqual(tensor, torch.arange(16, dtype=torch.float64) + 1)
+
+        # Fortran-ordered input is accepted without a copy and stays
+        # non-contiguous
+        array = np.asfortranarray(np.arange(12, dtype=np.float32).reshape(3, 4))
+        tensor = torch._from_numpy_consume(array)
+        self.assertEqual(tensor.data_ptr(), array.ctypes.data)
+        self.assertFalse(tensor.is_contiguous())
+        self.assertEqual(tensor, torch.arange(12, dtype=torch.float32).view(3, 4))
+
+        # a view transfers its base object's reference, not the view wrapper
+        base = np.arange(10, dtype=np.float64)
+        view = base[2:]
+        tensor = torch._from_numpy_consume(view)
+        self.assertEqual(tensor.data_ptr(), view.ctypes.data)
+        del view
+        self.assertEqual(tensor, torch.arange(2, 10, dtype=torch.float64))
+
+        # non-writable arrays cannot be consumed
+        array = np.arange(4, dtype=np.float64)
+        array.flags.writeable = False
+        self.assertRaises(ValueError, lambda: torch._from_numpy_consume(array))
+
     @skipMeta
     def test_from_list_of_ndarray_warning(self, device):
         warning_msg = r"Creating a tensor from a list of numpy.ndarrays is extremely slow"
@@ -1107,6 +1107,42 @@ class TestDisabledTorchFunction(TestCase):
         self.assertEqual(torch.nn.functional.linear(inp, t1, t2), "called")
         self.assertEqual(torch.nn.functional.linear(inp, t2, t1), "called")
 
+class TestTorchFunctionOverrideGeneration(TestCase):
+    def test_subclass_instance_bumps_generation(self):
+        gen = torch._C._torch_function_override_generation()
+
+        class Latching(torch.Tensor):
+            @classmethod
+            def __torch_function__(cls, func, types, args=(), kwargs=None):
+                kwargs = kwargs or {}
+                return super().__torch_function__(func, types, args, kwargs)
+
+        # Merely defining the subclass does not count as an override.
+        self.assertEqual(torch._C._torch_function_override_generation(), gen)
+        t = torch.ones(2).as_subclass(Latching)
+        self.assertGreater(torch._C._torch_function_override_generation(), gen)
+        # Dispatch still works with the fast path latched off.
+        self.assertIsInstance(t + 1, Latching)
+
+    def test_disabled_subclass_does_not_bump_generation(self):
+        # nn.Parameter opts out of __torch_function__, so it keeps the
+        # fast path alive.
+        gen = torch._C._torch_function_override_generation()
+        torch.nn.Parameter(torch.rand(2, 2))
+        self.assertEqual(torch._C._torch_function_override_generation(), gen)
+
+    def test_mode_push_bumps_generation(self):
+        gen = torch._C._torch_function_override_generation()
+
+        class Noop(TorchFunctionMode):
+            def __torch_function__(self, func, types, args=(), kwargs=None):
+                kwargs = kwargs or {}
+                return func(*args, **kwargs)
+
+        with Noop():
+            self.assertGreater(
+                torch._C._torch_function_override_generation(), gen)
+
 class TestResolveName(TestCase):
     def test_resolve_name(self):
         for cs in get_overridable_functions().values():
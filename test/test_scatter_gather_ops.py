@@ -317,6 +317,19 @@ class TestScatterGather(TestCase):
         helper([50, 8, 7], 100)
         helper([50, 3, 4, 5], 100)
 
+        # 1-D inputs with a large index take the sort-and-reduce path
+        # (the iterator kernel would run serially); small ones do not
+        helper([50], 100)
+        helper([50], 40000)
+
+        # the sort-and-reduce result should match a serial reference
+        if dtype == torch.float64:
+            idx = torch.randint(0, 50, (40000,), device=device)
+            src = torch.randn(40000, device=device, dtype=dtype)
+            out = torch.zeros(50, device=device, dtype=dtype).scatter_add(0, idx, src)
+            ref = torch.zeros(50, device=device, dtype=dtype).index_put_((idx,), src, accumulate=True)
+            self.assertEqual(out, ref)
+
     @onlyCPU
     @dtypes(torch.float32, torch.float64, torch.bfloat16)
     def test_gather_expanded_index(self, device, dtype):
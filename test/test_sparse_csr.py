@@ -1287,6 +1287,28 @@ class TestSparseCSR(TestCase):
         values = torch.tensor([2, 1, 6, 4, 10, 3, 5, 9, 8, 7], dtype=dtype, device=device)
         self.assertEqual(csr.values(), values)
 
+    @skipMeta
+    @coalescedonoff
+    @dtypes(torch.double)
+    def test_coo_to_csr_conversion_cache(self, device, dtype, coalesced):
+        # Repeated conversions of an unchanged COO tensor hit a cache on
+        # SparseTensorImpl; make sure the cached result stays consistent and
+        # that mutation invalidates it.
+        size = (5, 5)
+        sparse_dim = 2
+        nnz = 10
+        sparse_coo, _, _ = self.genSparseTensor(size, sparse_dim, nnz, coalesced, device, dtype)
+        dense = sparse_coo.to_dense()
+        csr1 = sparse_coo.to_sparse_csr()
+        csr2 = sparse_coo.to_sparse_csr()
+        self.assertEqual(csr1.to_dense(), dense)
+        self.assertEqual(csr2.to_dense(), dense)
+
+        # In-place mutation of the COO tensor must not be served stale results.
+        sparse_coo.mul_(2)
+        csr3 = sparse_coo.to_sparse_csr()
+        self.assertEqual(csr3.to_dense(), 2 * dense)
+
     @parametrize("blocksize", [2, 4])
     @dtypes((torch.double, torch.int32), (torch.double, torch.int64))
     @unittest.skipIf(not TEST_SCIPY, "SciPy not found")
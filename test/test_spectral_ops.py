@@ -834,6 +834,22 @@ class TestFFT(TestCase):
         with self.assertRaisesRegex(RuntimeError, r"read-only property"):
             torch.backends.cuda.cufft_plan_cache.size = -1
 
+        # hit/miss counters are cumulative and survive clear()
+        torch.backends.cuda.cufft_plan_cache.clear()
+        hits = torch.backends.cuda.cufft_plan_cache.hits
+        misses = torch.backends.cuda.cufft_plan_cache.misses
+        x = torch.randn(4, 56, device=devices[0], dtype=dtype)
+        torch.fft.fft(x)
+        torch.fft.fft(x)
+        self.assertGreater(torch.backends.cuda.cufft_plan_cache.hits, hits)
+        self.assertGreater(torch.backends.cuda.cufft_plan_cache.misses, misses)
+
+        with self.assertRaisesRegex(RuntimeError, r"read-only property"):
+            torch.backends.cuda.cufft_plan_cache.hits = 0
+
+        with self.assertRaisesRegex(RuntimeError, r"read-only property"):
+            torch.backends.cuda.cufft_plan_cache.misses = 0
+
         with self.assertRaisesRegex(RuntimeError, r"but got device with index"):
             torch.backends.cuda.cufft_plan_cache[torch.cuda.device_count() + 10]
 
@@ -3086,6 +3086,41 @@ else:
         # should retain permutation after densification
         self.assertTrue(y.stride() == (1, 4))
 
+    @onlyCPU
+    def test_lazy_clone(self, device):
+        x = torch.randn(10, device=device)
+        y = x._lazy_clone()
+        # The clone shares x's allocation until one of them is written to.
+        self.assertEqual(x.data_ptr(), y.data_ptr())
+        self.assertEqual(x, y)
+
+        x_orig = x.clone()
+        y.add_(1)
+        # The write materialized y's own copy and left x untouched.
+        self.assertNotEqual(x.data_ptr(), y.data_ptr())
+        self.assertEqual(x, x_orig)
+        self.assertEqual(y, x_orig + 1)
+
+        # Writing the original must not be visible through a live clone.
+        z = x._lazy_clone()
+        x.mul_(2)
+        self.assertEqual(z, x_orig)
+        self.assertEqual(x, x_orig * 2)
+
+    @onlyCPU
+    def test_lazy_clone_inference_mode(self, device):
+        # InferenceMode skips the ADInplaceOrView kernels that materialize
+        # copy-on-write storages on write, so _lazy_clone must copy eagerly
+        # there instead of creating an unprotectable alias.
+        with torch.inference_mode():
+            x = torch.randn(10, device=device)
+            y = x._lazy_clone()
+            self.assertNotEqual(x.data_ptr(), y.data_ptr())
+            x_orig = x.clone()
+            y.add_(1)
+            self.assertEqual(x, x_orig)
+            self.assertEqual(y, x_orig + 1)
+
     # FIXME: move to elementwise ternary test suite
     @dtypesIfCUDA(*set(get_all_math_dtypes('cuda')))
     @dtypes(*set(get_all_math_dtypes('cpu')))
@@ -3406,6 +3441,47 @@ else:
             out = source.index_select(0, idx)
             self.assertEqual(out.item(), source.item())
 
+    @onlyNativeDeviceTypes
+    def test_float8_pack_unpack(self, device):
+        for e5m2 in (False, True):
+            sign = torch.randint(0, 2, (256,), device=device) * 2 - 1
+            x = sign * (torch.rand(256, device=device) * 200 + 1)
+            packed = torch._pack_float8(x, e5m2)
+            self.assertEqual(packed.dtype, torch.uint8)
+            self.assertEqual(packed.shape, x.shape)
+            out = torch._unpack_float8(packed, torch.float32, e5m2)
+            # unpacked values are exactly representable, so they repack losslessly
+            self.assertEqual(torch._pack_float8(out, e5m2), packed)
+            # relative error bounded by half an ulp of the 2/3-bit mantissa
+            rel = (out - x).abs() / x.abs()
+            self.assertLessEqual(rel.max().item(), 2**-3 if e5m2 else 2**-4)
+            # fp16 and fp32 unpack agree (all fp8 values fit in fp16)
+            self.assertEqual(
+                torch._unpack_float8(packed, torch.float16, e5m2).float(), out)
+
+        special = torch.tensor([float('inf'), float('-inf'), float('nan'), 0., -0.],
+                               device=device)
+        # e5m2 has infinities and NaNs
+        out = torch._unpack_float8(torch._pack_float8(special, True), torch.float32, True)
+        self.assertEqual(out[:2], special[:2])
+        self.assertTrue(out[2].isnan())
+        self.assertEqual(out[3:], special[3:])
+        # e4m3fn has no infinities; out-of-range values become NaN
+        out = torch._unpack_float8(torch._pack_float8(special, False), torch.float32, False)
+        self.assertTrue(out[:3].isnan().all())
+        self.assertEqual(out[3:], special[3:])
+
+    @onlyNativeDeviceTypes
+    def test_float8_index_select(self, device):
+        for e5m2 in (False, True):
+            for idx_type in (torch.int32, torch.int64):
+                table = torch.randn(50, 16, device=device)
+                packed = torch._pack_float8(table, e5m2)
+                idx = torch.randint(0, 50, (20,), dtype=idx_type, device=device)
+                out = torch._float8_index_select(packed, idx, torch.float32, e5m2)
+                ref = torch._unpack_float8(packed, torch.float32, e5m2).index_select(0, idx)
+                self.assertEqual(out, ref)
+
     # FIXME: find a test suite for the take operator
     @dtypes(*all_types_and_complex_and(torch.half, torch.bool, torch.bfloat16))
     def test_take(self, device, dtype):
@@ -7467,6 +7543,18 @@ tensor([[[1.+1.j, 1.+1.j, 1.+1.j,  ..., 1.+1.j, 1.+1.j, 1.+1.j],
         # We can't usefully test the output; just make sure this doesn't crash
         torch.__config__.show()
 
+    def test_pin_kernel_selections(self):
+        self.assertFalse(torch.backends.kernel_selections_pinned())
+        try:
+            torch.backends.pin_kernel_selections()
+            self.assertTrue(torch.backends.kernel_selections_pinned())
+            torch.backends.pin_kernel_selections(False)
+            self.assertFalse(torch.backends.kernel_selections_pinned())
+        finally:
+            torch._C._set_kernel_selections_pinned(False)
+        with self.assertRaisesRegex(RuntimeError, 'expects a bool'):
+            torch._C._set_kernel_selections_pinned(1)
+
     @unittest.skipIf(IS_FBCODE, "CXX_FLAGS is only for OSS build.")
     def test_cxx_flags(self):
         torch.__config__._cxx_flags()
@@ -7482,6 +7570,24 @@ tensor([[[1.+1.j, 1.+1.j, 1.+1.j,  ..., 1.+1.j, 1.+1.j, 1.+1.j],
         # should be torchscriptable
         torch.jit.script(torch.backends.cpu.get_cpu_capability)
 
+    def test_cpu_allow_bf16_reduced_precision_reduction(self):
+        prev = torch.backends.cpu.get_allow_bf16_reduced_precision_reduction()
+        try:
+            torch.backends.cpu.set_allow_bf16_reduced_precision_reduction(True)
+            self.assertTrue(
+                torch.backends.cpu.get_allow_bf16_reduced_precision_reduction())
+            # bf16 matmul must still be reasonably close to the fp32
+            # reference under reduced-precision accumulation.
+            a = torch.randn(32, 32, dtype=torch.bfloat16)
+            b = torch.randn(32, 32, dtype=torch.bfloat16)
+            ref = (a.float() @ b.float()).to(torch.bfloat16)
+            self.assertEqual(a @ b, ref, atol=0.2, rtol=0.1)
+            torch.backends.cpu.set_allow_bf16_reduced_precision_reduction(False)
+            self.assertFalse(
+                torch.backends.cpu.get_allow_bf16_reduced_precision_reduction())
+        finally:
+            torch.backends.cpu.set_allow_bf16_reduced_precision_reduction(prev)
+
     @slowTest
     def test_slow_test(self):
         # Just a smoketest to make sure our slowTest decorator works.
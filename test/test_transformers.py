@@ -1086,6 +1086,54 @@ class TestTransformers(NNTestCase):
 
         torch.jit.script(mha)
 
+    @parametrize("dtype", [torch.float32, torch.float64])
+    def test_fused_embedding_layer_norm_dropout(self, device, dtype):
+        vocab, seq_len, batch, dim = 50, 12, 4, 64
+        weight = torch.randn(vocab, dim, device=device, dtype=dtype)
+        pos_weight = torch.randn(seq_len, dim, device=device, dtype=dtype)
+        gamma = torch.randn(dim, device=device, dtype=dtype)
+        beta = torch.randn(dim, device=device, dtype=dtype)
+        indices = torch.randint(vocab, (batch, seq_len), device=device)
+
+        def reference(p, train):
+            embedded = weight[indices] + pos_weight
+            normed = torch.nn.functional.layer_norm(embedded, (dim,), gamma, beta, eps=1e-5)
+            return normed
+
+        # Eval / p=0: exact match against the composite ops.
+        for train, p in [(False, 0.5), (True, 0.0)]:
+            out, mask = torch._fused_embedding_layer_norm_dropout(
+                weight, indices, pos_weight, gamma, beta, 1e-5, p, train)
+            self.assertEqual(out, reference(p, train))
+            self.assertTrue(mask.all())
+            self.assertEqual(mask.shape, out.shape)
+
+        # Training: dropped positions are zero, kept positions are the
+        # normalized values rescaled by 1 / (1 - p).
+        p = 0.5
+        out, mask = torch._fused_embedding_layer_norm_dropout(
+            weight, indices, pos_weight, gamma, beta, 1e-5, p, True)
+        ref = reference(p, True)
+        self.assertEqual(out, ref * mask * (1 / (1 - p)))
+
+        # p=1 drops everything.
+        out, mask = torch._fused_embedding_layer_norm_dropout(
+            weight, indices, pos_weight, gamma, beta, 1e-5, 1.0, True)
+        self.assertEqual(out, torch.zeros_like(out))
+        self.assertFalse(mask.any())
+
+        # Optional gamma/beta and out-of-range indices.
+        out, _ = torch._fused_embedding_layer_norm_dropout(
+            weight, indices, pos_weight, None, None, 1e-5, 0.0, False)
+        embedded = weight[indices] + pos_weight
+        self.assertEqual(
+            out, torch.nn.functional.layer_norm(embedded, (dim,), eps=1e-5))
+        if device == "cpu":
+            bad = torch.full((batch, seq_len), vocab, device=device, dtype=torch.long)
+            with self.assertRaisesRegex(RuntimeError, "index out of range"):
+                torch._fused_embedding_layer_norm_dropout(
+                    weight, bad, pos_weight, gamma, beta, 1e-5, 0.0, False)
+
 
 class TestSDPAFailureModes(NNTestCase):
     """ Used to test the failure modes of scaled_dot_product_attention
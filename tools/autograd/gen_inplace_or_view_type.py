@@ -475,6 +475,16 @@ def emit_inplace_or_view_body(fn: NativeFunctionWithDifferentiabilityInfo) -> Li
     # Note that this calls the slow, dispatching variants of manual_cpp_binding ops.
     # We could probably work harder to ensure that the fast variants are called instead, but the perf benefit would be minimal.
     if modifies_arguments(f):  # inplace op
+        # Copy-on-write storages must materialize (get their own data
+        # allocation) before we write through them, so that lazy clones
+        # keep their values. See c10/core/impl/cow/COW.h.
+        for a in f.func.schema_order_arguments():
+            if (
+                a.annotation is not None
+                and a.annotation.is_write
+                and a.type.is_tensor_like()
+            ):
+                inplace_view_body.append(f"materialize_cow({a.name});")
         inplace_view_body.append(
             INPLACE_REDISPATCH.substitute(
                 unambiguous_name=f.func.name.unambiguous_name(),
@@ -399,6 +399,9 @@ def gen_pyi(
                 )
             ],
             "from_numpy": ["def from_numpy(ndarray) -> Tensor: ..."],
+            "_from_numpy_consume": [
+                "def _from_numpy_consume(ndarray) -> Tensor: ..."
+            ],
             "frombuffer": [
                 "def frombuffer({}) -> Tensor: ...".format(
                     ", ".join(
@@ -0,0 +1,98 @@
+# Owner(s): ["module: codegen"]
+
+import unittest
+from typing import Any, List
+
+import yaml
+
+from torchgen.gen_static_shape_kernels import (
+    gen_static_shape_kernels,
+    parse_manifest,
+)
+from torchgen.yaml_utils import YamlLoader
+
+
+class TestGenStaticShapeKernels(unittest.TestCase):
+    def parse(self, manifest_str: str) -> List[Any]:
+        return parse_manifest(yaml.load(manifest_str, Loader=YamlLoader))
+
+    def test_basic_binary_op(self) -> None:
+        entries = self.parse(
+            """\
+- op: add.Tensor
+  dtype: float32
+  shape: [8, 128]
+"""
+        )
+        generated = gen_static_shape_kernels(entries)
+        self.assertIn("constexpr int64_t spec0_sizes[] = {8, 128};", generated)
+        self.assertIn("const auto alpha_v = alpha.to<scalar_t>();", generated)
+        self.assertIn("i < 1024", generated)
+        self.assertIn("return at::cpu::add(self, other, alpha);", generated)
+        self.assertIn('m.impl("add.Tensor", &specialized_add_Tensor);', generated)
+
+    def test_multiple_shapes_share_one_registration(self) -> None:
+        entries = self.parse(
+            """\
+- op: relu
+  dtype: float32
+  shape: [16]
+- op: relu
+  dtype: float64
+  shape: [4, 4]
+"""
+        )
+        generated = gen_static_shape_kernels(entries)
+        # one wrapper with both guarded blocks, registered once
+        self.assertEqual(generated.count('m.impl("relu"'), 1)
+        self.assertIn("at::kFloat", generated)
+        self.assertIn("at::kDouble", generated)
+        self.assertIn("constexpr int64_t spec0_sizes[] = {16};", generated)
+        self.assertIn("constexpr int64_t spec1_sizes[] = {4, 4};", generated)
+
+    def test_unsupported_op_rejected(self) -> None:
+        with self.assertRaisesRegex(AssertionError, "cannot be shape-specialized"):
+            self.parse(
+                """\
+- op: conv2d
+  dtype: float32
+  shape: [1, 3, 224, 224]
+"""
+            )
+
+    def test_unsupported_dtype_rejected(self) -> None:
+        with self.assertRaisesRegex(AssertionError, "cannot be shape-specialized"):
+            self.parse(
+                """\
+- op: relu
+  dtype: int8
+  shape: [16]
+"""
+            )
+
+    def test_bad_shape_rejected(self) -> None:
+        with self.assertRaisesRegex(AssertionError, "positive ints"):
+            self.parse(
+                """\
+- op: relu
+  dtype: float32
+  shape: [0]
+"""
+            )
+
+    def test_duplicate_entry_rejected(self) -> None:
+        with self.assertRaisesRegex(AssertionError, "duplicate"):
+            self.parse(
+                """\
+- op: relu
+  dtype: float32
+  shape: [16]
+- op: relu
+  dtype: float32
+  shape: [16]
+"""
+            )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -21,8 +21,10 @@ __all__ = [
     'LinearBn1d',
     'LinearLeakyReLU',
     'LinearTanh',
+    'LinearGelu',
     'ConvAdd2d',
     'ConvAddReLU2d',
+    'LinearAddReLU',
 ]
 
 # We are exposing all subpackages to the end-user.
@@ -14,8 +14,10 @@ from .fused import BNReLU3d
 from .fused import LinearBn1d
 from .fused import LinearLeakyReLU
 from .fused import LinearTanh
+from .fused import LinearGelu
 from .fused import ConvAdd2d
 from .fused import ConvAddReLU2d
+from .fused import LinearAddReLU
 
 __all__ = [
     'ConvBn1d',
@@ -33,6 +35,8 @@ __all__ = [
     'LinearBn1d',
     'LinearLeakyReLU',
     'LinearTanh',
+    'LinearGelu',
     'ConvAdd2d',
     'ConvAddReLU2d',
+    'LinearAddReLU',
 ]
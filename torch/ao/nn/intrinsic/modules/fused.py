@@ -4,7 +4,8 @@ from torch.nn.utils.parametrize import type_before_parametrizations
 
 __all__ = ['ConvReLU1d', 'ConvReLU2d', 'ConvReLU3d', 'LinearReLU', 'ConvBn1d', 'ConvBn2d',
            'ConvBnReLU1d', 'ConvBnReLU2d', 'ConvBn3d', 'ConvBnReLU3d', 'BNReLU2d', 'BNReLU3d',
-           'LinearBn1d', 'LinearLeakyReLU', 'LinearTanh', 'ConvAdd2d', 'ConvAddReLU2d']
+           'LinearBn1d', 'LinearLeakyReLU', 'LinearTanh', 'LinearGelu', 'ConvAdd2d', 'ConvAddReLU2d',
+           'LinearAddReLU']
 
 # Used for identifying intrinsic modules used in quantization
 class _FusedModule(torch.nn.Sequential):
@@ -146,6 +147,15 @@ class LinearTanh(_FusedModule):
                 type(linear), type(tanh))
         super().__init__(linear, tanh)
 
+class LinearGelu(_FusedModule):
+    r"""This is a sequential container which calls the Linear and GELU modules.
+    During quantization this will be replaced with the corresponding fused module."""
+    def __init__(self, linear, gelu):
+        assert type(linear) == Linear and type(gelu) == torch.nn.GELU, \
+            'Incorrect types for input modules{}{}'.format(
+                type(linear), type(gelu))
+        super().__init__(linear, gelu)
+
 class ConvAdd2d(_FusedModule):
     r"""This is a sequential container which calls the Conv2d modules with extra Add.
     During quantization this will be replaced with the corresponding fused module."""
@@ -166,3 +176,14 @@ class ConvAddReLU2d(_FusedModule):
 
     def forward(self, x1, x2):
         return self.relu(self.add(self[0](x1), x2))
+
+class LinearAddReLU(_FusedModule):
+    r"""This is a sequential container which calls the Linear, add, Relu.
+    During quantization this will be replaced with the corresponding fused module."""
+    def __init__(self, linear, add, relu):
+        super().__init__(linear)
+        self.add = add
+        self.relu = relu
+
+    def forward(self, x1, x2):
+        return self.relu(self.add(self[0](x1), x2))
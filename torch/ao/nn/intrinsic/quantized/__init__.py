@@ -9,6 +9,8 @@ __all__ = [
     'LinearReLU',
     'LinearLeakyReLU',
     'LinearTanh',
+    'LinearGelu',
+    'LinearAddReLU',
     'ConvAdd2d',
     'ConvAddReLU2d',
 ]
@@ -1,4 +1,4 @@
-from .linear_relu import LinearReLU, LinearLeakyReLU, LinearTanh
+from .linear_relu import LinearReLU, LinearLeakyReLU, LinearTanh, LinearGelu, LinearAddReLU
 from .conv_relu import ConvReLU1d, ConvReLU2d, ConvReLU3d
 from .bn_relu import BNReLU2d, BNReLU3d
 from .conv_add import ConvAdd2d, ConvAddReLU2d
@@ -12,6 +12,8 @@ __all__ = [
     'BNReLU3d',
     'LinearLeakyReLU',
     'LinearTanh',
+    'LinearGelu',
+    'LinearAddReLU',
     'ConvAdd2d',
     'ConvAddReLU2d',
 ]
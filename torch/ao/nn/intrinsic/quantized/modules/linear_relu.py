@@ -7,6 +7,8 @@ __all__ = [
     "LinearReLU",
     "LinearLeakyReLU",
     "LinearTanh",
+    "LinearGelu",
+    "LinearAddReLU",
 ]
 
 class LinearReLU(nnq.Linear):
@@ -175,3 +177,124 @@ class LinearTanh(nnq.Linear):
         qlinear_tanh.scale = float(output_scale)
         qlinear_tanh.zero_point = int(output_zero_point)
         return qlinear_tanh
+
+class LinearGelu(nnq.Linear):
+    r"""
+    For onednn backend only
+    A LinearGelu module fused from Linear and GELU modules
+    We adopt the same interface as :class:`torch.ao.nn.quantized.Linear`.
+    Attributes:
+        Same as torch.ao.nn.quantized.Linear
+        + approximate
+    Examples::
+        >>> # xdoctest: +SKIP
+        >>> m = nn.intrinsic.LinearGelu(20, 30)
+        >>> input = torch.randn(128, 20)
+        >>> output = m(input)
+        >>> print(output.size())
+        torch.Size([128, 30])
+    """
+    _FLOAT_MODULE = nni.LinearGelu
+
+    def __init__(self, in_features, out_features, approximate='none', bias=True, dtype=torch.qint8):
+        super().__init__(in_features, out_features, bias, dtype)
+        self.approximate = approximate
+
+    def forward(self, x: torch.Tensor) -> torch.Tensor:
+        return torch.ops.quantized.linear_gelu(
+            x, self._packed_params._packed_params, self.scale, self.zero_point, self.approximate)
+
+    def _get_name(self):
+        return 'QuantizedLinearGelu'
+
+    @classmethod
+    def from_float(cls, mod):
+        assert type(mod) == nni.LinearGelu, 'Input float module should be LinearGelu'
+        assert hasattr(mod, 'qconfig'), 'Input float module must have qconfig defined'
+        activation_post_process = mod.activation_post_process
+        gelu = mod[1]
+        mod = mod[0]
+        weight_post_process = mod.qconfig.weight()
+        weight_post_process(mod.weight)
+        dtype = weight_post_process.dtype
+        act_scale, act_zp = activation_post_process.calculate_qparams()  # type: ignore[union-attr,operator]
+        assert dtype == torch.qint8, 'Weight observer must have dtype torch.qint8'
+        qweight = _quantize_weight(mod.weight.float(), weight_post_process)
+        qlinear_gelu = cls(
+            mod.in_features,
+            mod.out_features,
+            gelu.approximate,
+            dtype=dtype)
+        qlinear_gelu.set_weight_bias(qweight, mod.bias)
+        qlinear_gelu.scale = float(act_scale)
+        qlinear_gelu.zero_point = int(act_zp)
+        return qlinear_gelu
+
+    @classmethod
+    def from_reference(cls, ref_mod, output_scale, output_zero_point):
+        linear = ref_mod[0]
+        gelu = ref_mod[1]
+        qlinear_gelu = cls(
+            linear.in_features,
+            linear.out_features,
+            gelu.approximate)
+        qweight = linear.get_quantized_weight()
+        qlinear_gelu.set_weight_bias(qweight, linear.bias)
+        qlinear_gelu.scale = float(output_scale)
+        qlinear_gelu.zero_point = int(output_zero_point)
+        return qlinear_gelu
+
+class LinearAddReLU(nnq.Linear):
+    r"""
+    For onednn backend only
+    A LinearAddReLU module fused from Linear, Add and ReLU modules
+    The extra input is accumulated into the linear output and the sum is
+    requantized after the ReLU.
+    We adopt the same interface as :class:`torch.ao.nn.quantized.Linear`.
+    Attributes:
+        Same as torch.ao.nn.quantized.Linear
+    """
+    _FLOAT_MODULE = nni.LinearAddReLU
+
+    def __init__(self, in_features, out_features, bias=True, dtype=torch.qint8):
+        super().__init__(in_features, out_features, bias, dtype)
+
+    def forward(self, x: torch.Tensor, extra_input: torch.Tensor) -> torch.Tensor:
+        return torch.ops.quantized.linear_add_relu(
+            x, extra_input, self._packed_params._packed_params, self.scale, self.zero_point)
+
+    def _get_name(self):
+        return 'QuantizedLinearAddReLU'
+
+    @classmethod
+    def from_float(cls, mod):
+        assert type(mod) == nni.LinearAddReLU, 'Input float module should be LinearAddReLU'
+        assert hasattr(mod, 'qconfig'), 'Input float module must have qconfig defined'
+        activation_post_process = mod.activation_post_process
+        mod = mod[0]
+        weight_post_process = mod.qconfig.weight()
+        weight_post_process(mod.weight)
+        dtype = weight_post_process.dtype
+        act_scale, act_zp = activation_post_process.calculate_qparams()  # type: ignore[union-attr,operator]
+        assert dtype == torch.qint8, 'Weight observer must have dtype torch.qint8'
+        qweight = _quantize_weight(mod.weight.float(), weight_post_process)
+        qlinear_add_relu = cls(
+            mod.in_features,
+            mod.out_features,
+            dtype=dtype)
+        qlinear_add_relu.set_weight_bias(qweight, mod.bias)
+        qlinear_add_relu.scale = float(act_scale)
+        qlinear_add_relu.zero_point = int(act_zp)
+        return qlinear_add_relu
+
+    @classmethod
+    def from_reference(cls, ref_mod, output_scale, output_zero_point):
+        linear = ref_mod[0]
+        qlinear_add_relu = cls(
+            linear.in_features,
+            linear.out_features)
+        qweight = linear.get_quantized_weight()
+        qlinear_add_relu.set_weight_bias(qweight, linear.bias)
+        qlinear_add_relu.scale = float(output_scale)
+        qlinear_add_relu.zero_point = int(output_zero_point)
+        return qlinear_add_relu
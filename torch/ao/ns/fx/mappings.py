@@ -629,8 +629,10 @@ def get_node_type_to_io_type_map() -> Dict[str, Set[NSNodeTargetType]]:
         nniqd.LinearReLU,
         nni.LinearLeakyReLU,
         nni.LinearTanh,
+        nni.LinearGelu,
         nni.ConvAdd2d,
         nni.ConvAddReLU2d,
+        nni.LinearAddReLU,
     }
 
     MODS_IO_TYPE_INT8: Set[NSNodeTargetType] = {
@@ -663,8 +665,10 @@ def get_node_type_to_io_type_map() -> Dict[str, Set[NSNodeTargetType]]:
         nniq.LinearReLU,
         nniq.LinearLeakyReLU,
         nniq.LinearTanh,
+        nniq.LinearGelu,
         nniq.ConvAdd2d,
         nniq.ConvAddReLU2d,
+        nniq.LinearAddReLU,
     }
 
     MODS_IO_TYPE_FP32_OR_INT8: Set[NSNodeTargetType] = {
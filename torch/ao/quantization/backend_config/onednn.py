@@ -504,6 +504,87 @@ _add_eltwise_fusion_configs(linear_configs, nn.Linear, F.linear,
                             _sequential_wrapper2(nni.LinearTanh),
                             nni.LinearTanh, observation_type, nnqr.Linear)
 
+# Configs for linear + gelu fusion
+_add_eltwise_fusion_configs(linear_configs, nn.Linear, F.linear,
+                            nn.GELU, F.gelu, linear_dtype_configs,
+                            _sequential_wrapper2(nni.LinearGelu),
+                            nni.LinearGelu, observation_type, nnqr.Linear)
+
+# (1) Linear + Add + ReLU
+
+# linear   Y
+#   \   /
+#    add
+#     \
+#     relu
+
+def _fuse_linear_add_relu_left(is_qat, relu, add_pattern):
+    add, linear, _ = add_pattern
+    return nni.LinearAddReLU(linear, add, relu)
+
+def _linear_add_relu_root_node_getter_left(pattern):
+    relu, add_pattern = pattern
+    _, linear, _ = add_pattern
+    return linear
+
+def _linear_add_relu_extra_inputs_getter_left(pattern):
+    """ get inputs pattern for extra inputs, inputs for root node
+    are assumed to be copied over from root node to the fused node
+    """
+    relu, add_pattern = pattern
+    _, linear, extra_input = add_pattern
+    return [extra_input]
+
+#  Y   linear
+#   \   /
+#    add
+#     \
+#     relu
+
+def _fuse_linear_add_relu_right(is_qat, relu, add_pattern):
+    add, _, linear = add_pattern
+    return nni.LinearAddReLU(linear, add, relu)
+
+def _linear_add_relu_root_node_getter_right(pattern):
+    relu, add_pattern = pattern
+    _, _, linear = add_pattern
+    return linear
+
+def _linear_add_relu_extra_inputs_getter_right(pattern):
+    """ get inputs pattern for extra inputs, inputs for root node
+    are assumed to be copied over from root node to the fused node
+    """
+    relu, add_pattern = pattern
+    _, extra_input, _ = add_pattern
+    return [extra_input]
+
+for add_op in [torch.add, operator.add]:
+    linear_configs.append(
+        BackendPatternConfig()
+            ._set_pattern_complex_format((nn.ReLU, (add_op, nn.Linear, MatchAllNode)))  # noqa: E131
+            .set_observation_type(observation_type)
+            .set_dtype_configs(linear_dtype_configs)
+            .set_fuser_method(_fuse_linear_add_relu_left)
+            ._set_root_node_getter(_linear_add_relu_root_node_getter_left)
+            ._set_extra_inputs_getter(_linear_add_relu_extra_inputs_getter_left)
+            .set_fused_module(nni.LinearAddReLU))
+    linear_configs.append(
+        BackendPatternConfig()
+            ._set_pattern_complex_format((nn.ReLU, (add_op, MatchAllNode, nn.Linear)))  # noqa: E131
+            .set_observation_type(observation_type)
+            .set_dtype_configs(linear_dtype_configs)
+            .set_fuser_method(_fuse_linear_add_relu_right)
+            ._set_root_node_getter(_linear_add_relu_root_node_getter_right)
+            ._set_extra_inputs_getter(_linear_add_relu_extra_inputs_getter_right)
+            .set_fused_module(nni.LinearAddReLU))
+
+linear_configs.append(
+    BackendPatternConfig(nni.LinearAddReLU)
+        .set_observation_type(observation_type)  # noqa: E131
+        .set_dtype_configs(linear_dtype_configs)
+        .set_root_module(nn.Linear)
+        .set_reference_quantized_module(nnqr.Linear))
+
 # ===========================
 # |  CONFIGS FOR OTHER OPS  |
 # ===========================
@@ -268,6 +268,7 @@ STATIC_LOWER_FUSED_MODULE_MAP: Dict[Type[nn.Module], Tuple[Type[nn.Module], Type
     # registration and lowering functions for different backends in the future.
     nni.LinearLeakyReLU: (nnqr.Linear, nniq.LinearLeakyReLU),
     nni.LinearTanh: (nnqr.Linear, nniq.LinearTanh),
+    nni.LinearGelu: (nnqr.Linear, nniq.LinearGelu),
     nni.ConvReLU1d: (nnqr.Conv1d, nniq.ConvReLU1d),
     nni.ConvReLU2d: (nnqr.Conv2d, nniq.ConvReLU2d),
     nni.ConvReLU3d: (nnqr.Conv3d, nniq.ConvReLU3d),
@@ -281,6 +282,7 @@ STATIC_LOWER_FUSED_MODULE_MAP: Dict[Type[nn.Module], Tuple[Type[nn.Module], Type
 STATIC_LOWER_FUSED_MODULE_TWO_INPUTS_MAP: Dict[Type[nn.Module], Tuple[Type[nn.Module], Type[WeightedQuantizedModule]]] = {
     nni.ConvAdd2d: (nnqr.Conv2d, nniq.ConvAdd2d),
     nni.ConvAddReLU2d: (nnqr.Conv2d, nniq.ConvAddReLU2d),
+    nni.LinearAddReLU: (nnqr.Linear, nniq.LinearAddReLU),
 }
 
 # Mapping from fused module class to a 2-tuple of:
@@ -114,6 +114,8 @@ DEFAULT_STATIC_QUANT_MODULE_MAPPINGS : Dict[Callable, Any] = {
     nni.LinearReLU: nniq.LinearReLU,
     nni.LinearLeakyReLU: nniq.LinearLeakyReLU,
     nni.LinearTanh: nniq.LinearTanh,
+    nni.LinearGelu: nniq.LinearGelu,
+    nni.LinearAddReLU: nniq.LinearAddReLU,
     nniqat.ConvBn1d: nnq.Conv1d,
     nniqat.ConvBn2d: nnq.Conv2d,
     nniqat.ConvBn3d: nnq.Conv3d,
@@ -3,7 +3,7 @@ import warnings
 
 from typing import Any
 
-__all__ = ["detect_anomaly", "set_detect_anomaly"]
+__all__ = ["detect_anomaly", "set_detect_anomaly", "set_sampled_anomaly"]
 
 
 class detect_anomaly:
@@ -115,3 +115,38 @@ class set_detect_anomaly:
 
     def __exit__(self, *args: Any) -> None:
         torch.set_anomaly_enabled(self.prev, self.prev_check_nan)
+
+
+class set_sampled_anomaly:
+    r"""Context-manager that sets sampled anomaly detection on or off.
+
+    Unlike :class:`detect_anomaly`, which fully reduces every backward node
+    output and records forward tracebacks, sampled anomaly detection only
+    probes a small fixed number of elements per output for NaN/inf and keeps
+    a short per-thread history of recently executed backward nodes. Its
+    per-node cost is bounded and independent of tensor size, so it is cheap
+    enough to leave enabled outside of debugging sessions.
+
+    When a sampled element is non-finite, the raised error names the failing
+    node and lists the nodes recently executed on the same engine thread.
+    Because only a subset of elements is inspected (and only CPU
+    floating-point outputs are sampled), a non-finite value may go
+    undetected; use :class:`detect_anomaly` for an exhaustive check.
+
+    It can be used as a context-manager or as a function.
+
+    Args:
+        mode (bool): Flag whether to enable sampled anomaly detection
+                     (``True``), or disable (``False``).
+
+    """
+
+    def __init__(self, mode: bool) -> None:
+        self.prev = torch._C._is_sampled_anomaly_enabled()
+        torch._C._set_sampled_anomaly_enabled(mode)
+
+    def __enter__(self) -> None:
+        pass
+
+    def __exit__(self, *args: Any) -> None:
+        torch._C._set_sampled_anomaly_enabled(self.prev)
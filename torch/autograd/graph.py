@@ -10,6 +10,7 @@ import abc
 __all__ = [
     "saved_tensors_hooks",
     "save_on_cpu",
+    "save_on_cpu_native",
     "disable_saved_tensors_hooks",
     "register_multi_grad_hook",
     "allow_mutation_on_saved_tensors",
@@ -278,6 +279,37 @@ class save_on_cpu(saved_tensors_hooks):
         super().__init__(pack_to_cpu, unpack_from_cpu)
 
 
+class save_on_cpu_native:
+    """Context-manager like :class:`save_on_cpu`, implemented entirely in C++.
+
+    Tensors saved by the forward pass are copied asynchronously to pinned host
+    memory on a side stream (so the copy overlaps the rest of the forward
+    pass), and copied back with a non-blocking transfer when unpacked during
+    backward. Unlike :class:`save_on_cpu`, no Python round trip is made per
+    saved tensor, so the per-tensor overhead stays negligible even for models
+    with thousands of saved activations.
+
+    Tensors already on CPU, and sparse tensors, are stored as-is.
+
+    Example::
+
+        >>> # xdoctest: +REQUIRES(env:TORCH_DOCTEST_CUDA)
+        >>> # xdoctest: +REQUIRES(env:TORCH_DOCTEST_AUTOGRAD)
+        >>> a = torch.randn(5, requires_grad=True, device="cuda")
+        >>> with torch.autograd.graph.save_on_cpu_native():
+        ...     y = a * a  # a is saved to pinned host memory
+        >>> y.sum().backward()  # a is copied back to the GPU for backward
+    """
+
+    def __enter__(self):
+        self.prev = torch._C._autograd._saved_tensors_cpu_offload_is_enabled()
+        torch._C._autograd._saved_tensors_cpu_offload_set_enabled(True)
+        return self
+
+    def __exit__(self, *args: Any):
+        torch._C._autograd._saved_tensors_cpu_offload_set_enabled(self.prev)
+
+
 @contextlib.contextmanager
 def disable_saved_tensors_hooks(error_message):
     """Context-manager that disables the saved tensors default hooks feature.
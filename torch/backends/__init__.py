@@ -45,3 +45,21 @@ class PropModule(types.ModuleType):
 
     def __getattr__(self, attr):
         return self.m.__getattribute__(attr)
+
+
+def pin_kernel_selections(pin: bool = True):
+    r"""Freezes (or unfreezes) runtime-selected algorithm choices, such as
+    cached cuDNN benchmark results, so they are replayed instead of being
+    re-selected when conditions (e.g. memory pressure) change mid-run.
+    See Note [Pinned kernel selections] in ATen/Context.h.
+    """
+    import torch
+    torch._C._set_kernel_selections_pinned(pin)
+
+
+def kernel_selections_pinned() -> bool:
+    r"""Returns whether runtime-selected algorithm choices are currently
+    pinned. See :func:`pin_kernel_selections`.
+    """
+    import torch
+    return torch._C._get_kernel_selections_pinned()
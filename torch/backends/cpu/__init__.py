@@ -1,6 +1,10 @@
 import torch
 
-__all__ = ["get_cpu_capability", ]
+__all__ = [
+    "get_cpu_capability",
+    "get_allow_bf16_reduced_precision_reduction",
+    "set_allow_bf16_reduced_precision_reduction",
+]
 
 
 def get_cpu_capability() -> str:
@@ -15,3 +19,22 @@ def get_cpu_capability() -> str:
     - "AVX512"
     """
     return torch._C._get_cpu_capability()
+
+
+def get_allow_bf16_reduced_precision_reduction() -> bool:
+    r"""Returns whether CPU GEMMs may accumulate ``bfloat16`` inputs in
+    reduced precision instead of upconverting to ``float32``.
+    """
+    return torch._C._get_cpu_allow_bf16_reduced_precision_reduction()
+
+
+def set_allow_bf16_reduced_precision_reduction(enabled: bool) -> None:
+    r"""Sets whether CPU GEMMs may accumulate ``bfloat16`` inputs in reduced
+    precision instead of upconverting to ``float32``.
+
+    Off by default. Opting in trades accuracy for less accumulator traffic
+    on throughput-bound workloads; it only affects PyTorch's own fallback
+    GEMM kernels, as BLAS and oneDNN manage their own accumulation
+    precision.
+    """
+    torch._C._set_cpu_allow_bf16_reduced_precision_reduction(enabled)
@@ -37,8 +37,8 @@ class cuFFTPlanCacheAttrContextProp:
 class cuFFTPlanCache:
     r"""
     Represents a specific plan cache for a specific `device_index`. The
-    attributes `size` and `max_size`, and method `clear`, can fetch and/ or
-    change properties of the C++ cuFFT plan cache.
+    attributes `size`, `max_size`, `hits` and `misses`, and method `clear`,
+    can fetch and/ or change properties of the C++ cuFFT plan cache.
     """
     def __init__(self, device_index):
         self.device_index = device_index
@@ -51,6 +51,16 @@ class cuFFTPlanCache:
     max_size = cuFFTPlanCacheAttrContextProp(torch._cufft_get_plan_cache_max_size,
                                              torch._cufft_set_plan_cache_max_size)
 
+    hits = cuFFTPlanCacheAttrContextProp(
+        torch._cufft_get_plan_cache_hits,
+        '.hits is a read-only property showing the cumulative number of plan '
+        'cache hits since process start.')
+
+    misses = cuFFTPlanCacheAttrContextProp(
+        torch._cufft_get_plan_cache_misses,
+        '.misses is a read-only property showing the cumulative number of plan '
+        'cache misses since process start.')
+
     def clear(self):
         return torch._cufft_clear_plan_cache(self.device_index)
 
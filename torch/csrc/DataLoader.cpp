@@ -1,5 +1,8 @@
 #include <torch/csrc/DataLoader.h>
 
+#include <torch/csrc/utils/pybind.h>
+#include <torch/data/tensor_pipeline.h>
+
 // Together with `torch/utils/data/_utils/signal_handling.py`, the following
 // is an effort to do our best to provide some error message to users when a
 // worker dies due to error / critical signals.
@@ -253,6 +256,50 @@ static PyObject* THPModule_errorIfAnyWorkerFails(
 
 #endif
 
+namespace torch {
+namespace data {
+
+void initDataLoaderBindings(PyObject* module) {
+  auto m = py::handle(module).cast<py::module>();
+  py::class_<TensorBatchPipeline, std::shared_ptr<TensorBatchPipeline>>(
+      m, "_TensorBatchPipeline")
+      .def(
+          py::init([](std::vector<at::Tensor> columns,
+                      std::vector<int64_t> indices,
+                      size_t batch_size,
+                      size_t workers,
+                      size_t prefetch_factor,
+                      bool drop_last,
+                      bool pin_memory) {
+            return std::make_shared<TensorBatchPipeline>(
+                std::move(columns),
+                std::move(indices),
+                TensorBatchPipelineOptions(batch_size)
+                    .workers(workers)
+                    .prefetch_factor(prefetch_factor)
+                    .drop_last(drop_last)
+                    .pin_memory(pin_memory));
+          }),
+          py::arg("columns"),
+          py::arg("indices"),
+          py::arg("batch_size"),
+          py::arg("workers") = 2,
+          py::arg("prefetch_factor") = 2,
+          py::arg("drop_last") = false,
+          py::arg("pin_memory") = false)
+      // Batch assembly and the wait for the next batch happen without the
+      // GIL; only the conversion of the returned tensors touches Python.
+      .def(
+          "next",
+          &TensorBatchPipeline::next,
+          py::call_guard<py::gil_scoped_release>())
+      .def("batch_count", &TensorBatchPipeline::batch_count)
+      .def("column_count", &TensorBatchPipeline::column_count);
+}
+
+} // namespace data
+} // namespace torch
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays)
 PyMethodDef DataLoaderMethods[] = {
     {"_set_worker_signal_handlers",
@@ -4,3 +4,11 @@
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays)
 extern PyMethodDef DataLoaderMethods[];
+
+namespace torch {
+namespace data {
+
+void initDataLoaderBindings(PyObject* module);
+
+} // namespace data
+} // namespace torch
@@ -1,6 +1,7 @@
 #include <torch/csrc/Device.h>
 
 #include <torch/csrc/Exceptions.h>
+#include <torch/csrc/utils/disable_torch_function.h>
 #include <torch/csrc/utils/object_ptr.h>
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/utils/python_arg_parser.h>
@@ -173,6 +174,8 @@ PyObject* THPDevice_enter(PyObject* self, PyObject* noargs) {
   HANDLE_TH_ERRORS
   py::object mode = py::module::import("torch.utils._device")
                         .attr("DeviceContext")(py::handle(self));
+  // See Note [Torch function override fast path]
+  torch::note_torch_function_override();
   at::impl::PythonTorchFunctionTLS::push_onto_stack(
       std::make_shared<c10::SafePyObject>(
           mode.release().ptr(), getPyInterpreter()));
@@ -17,9 +17,13 @@
 #include <ATen/dlpack.h>
 #include <ATen/native/ConvUtils.h>
 #include <c10/core/DispatchKeySet.h>
+#include <c10/core/impl/SizesAndStrides.h>
+#include <c10/core/impl/alloc_cpu.h>
 #include <c10/util/Backtrace.h>
+#include <c10/util/numa.h>
 #include <c10/util/Logging.h>
 #include <c10/util/irange.h>
+#include <c10/util/xxh64.h>
 #include <libshm.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -738,6 +742,23 @@ PyObject* THPModule_benchmarkCuDNN(PyObject* _unused, PyObject* noargs) {
   Py_RETURN_FALSE;
 }
 
+PyObject* THPModule_setPinnedKernelSelections(PyObject* _unused, PyObject* arg) {
+  THPUtils_assert(
+      PyBool_Check(arg),
+      "set_kernel_selections_pinned expects a bool, "
+      "but got %s",
+      THPUtils_typename(arg));
+  at::globalContext().setPinnedKernelSelections(arg == Py_True);
+  Py_RETURN_NONE;
+}
+
+PyObject* THPModule_pinnedKernelSelections(PyObject* _unused, PyObject* noargs) {
+  if (at::globalContext().pinnedKernelSelections()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
 PyObject* THPModule_setAllowTF32CuBLAS(PyObject* _unused, PyObject* arg) {
   THPUtils_assert(
       PyBool_Check(arg),
@@ -797,6 +818,23 @@ PyObject* THPModule_allowBF16ReductionCuBLAS(
   Py_RETURN_FALSE;
 }
 
+PyObject* THPModule_setAllowBF16ReductionCPU(PyObject* _unused, PyObject* arg) {
+  THPUtils_assert(
+      PyBool_Check(arg),
+      "set_allow_bf16_reduction_cpu expects a bool, "
+      "but got %s",
+      THPUtils_typename(arg));
+  at::globalContext().setAllowBF16ReductionCPU(arg == Py_True);
+  Py_RETURN_NONE;
+}
+
+PyObject* THPModule_allowBF16ReductionCPU(PyObject* _unused, PyObject* noargs) {
+  if (at::globalContext().allowBF16ReductionCPU()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
 PyObject* THPModule_setFlushDenormal(PyObject* _unused, PyObject* arg) {
   THPUtils_assert(
       PyBool_Check(arg),
@@ -1101,6 +1139,14 @@ static PyMethodDef TorchMethods[] = {
     {"_set_cudnn_allow_tf32", THPModule_setAllowTF32CuDNN, METH_O, nullptr},
     {"_get_cudnn_benchmark", THPModule_benchmarkCuDNN, METH_NOARGS, nullptr},
     {"_set_cudnn_benchmark", THPModule_setBenchmarkCuDNN, METH_O, nullptr},
+    {"_get_kernel_selections_pinned",
+     THPModule_pinnedKernelSelections,
+     METH_NOARGS,
+     nullptr},
+    {"_set_kernel_selections_pinned",
+     THPModule_setPinnedKernelSelections,
+     METH_O,
+     nullptr},
     {"_get_cudnn_deterministic",
      THPModule_deterministicCuDNN,
      METH_NOARGS,
@@ -1151,6 +1197,14 @@ static PyMethodDef TorchMethods[] = {
      THPModule_setAllowBF16ReductionCuBLAS,
      METH_O,
      nullptr},
+    {"_get_cpu_allow_bf16_reduced_precision_reduction",
+     THPModule_allowBF16ReductionCPU,
+     METH_NOARGS,
+     nullptr},
+    {"_set_cpu_allow_bf16_reduced_precision_reduction",
+     THPModule_setAllowBF16ReductionCPU,
+     METH_O,
+     nullptr},
     {"_vmapmode_increment_nesting",
      THPModule_vmapmode_increment_nesting,
      METH_NOARGS,
@@ -1235,6 +1289,10 @@ static PyMethodDef TorchMethods[] = {
      (PyCFunction)(void (*)(void))THPModule_has_torch_function_variadic,
      METH_FASTCALL,
      nullptr},
+    {"_torch_function_override_generation",
+     THPModule_torch_function_override_generation,
+     METH_NOARGS,
+     nullptr},
     {nullptr, nullptr, 0, nullptr}};
 
 void THCPStream_init(PyObject* module);
@@ -1344,6 +1402,7 @@ PyObject* initModule() {
   torch::autograd::initEnumTag(module);
   torch::jit::initJITBindings(module);
   torch::monitor::initMonitorBindings(module);
+  torch::data::initDataLoaderBindings(module);
   torch::impl::dispatch::initDispatchBindings(module);
   torch::dynamo::initDynamoBindings(module);
   torch::functorch::impl::initFuncTorchBindings(module);
@@ -1419,6 +1478,69 @@ PyObject* initModule() {
   py_module.def("_demangle", &c10::demangle);
   py_module.def("_log_api_usage_once", &LogAPIUsageOnceFromPython);
 
+  py_module.def("_numa_enabled", []() { return c10::IsNUMAEnabled(); });
+  py_module.def("_numa_num_nodes", []() { return c10::GetNumNUMANodes(); });
+  py_module.def("_set_alloc_numa_node", [](int numa_node_id) {
+    c10::SetAllocNUMANode(numa_node_id);
+  });
+  py_module.def("_get_alloc_numa_node", []() {
+    return c10::GetAllocNUMANode();
+  });
+  py_module.def("_numa_move_tensor", [](const at::Tensor& tensor, int numa_node_id) {
+    TORCH_CHECK(
+        tensor.device().is_cpu(),
+        "_numa_move_tensor expects a CPU tensor, got ",
+        tensor.device());
+    TORCH_CHECK(tensor.has_storage(), "_numa_move_tensor expects a tensor with storage");
+    const auto& storage = tensor.storage();
+    if (storage.nbytes() > 0) {
+      c10::NUMAMove(storage.mutable_data(), storage.nbytes(), numa_node_id);
+    }
+  });
+
+  py_module.def("_sizes_and_strides_out_of_line_allocations", []() {
+    return c10::impl::sizesAndStridesOutOfLineAllocations();
+  });
+
+  py_module.def(
+      "_content_fingerprint",
+      [](const at::Tensor& tensor) -> uint64_t {
+        auto* impl = tensor.unsafeGetTensorImpl();
+        if (auto cached = impl->content_fingerprint()) {
+          return *cached;
+        }
+        TORCH_CHECK(
+            tensor.layout() == at::kStrided,
+            "_content_fingerprint expects a strided tensor, got layout ",
+            tensor.layout());
+        // Hash the logical bytes: materialize a contiguous CPU copy when the
+        // tensor isn't one already, so that views with identical content hash
+        // identically. Seed with dtype and sizes so that reinterpretations of
+        // the same buffer get distinct fingerprints.
+        at::Tensor src = tensor.detach();
+        const bool versioned = impl->version_counter().enabled();
+        const uint32_t version_before =
+            versioned ? impl->version_counter().current_version() : 0;
+        if (!src.device().is_cpu() || !src.is_contiguous()) {
+          src = src.to(at::kCPU).contiguous();
+        }
+        auto sizes = src.sizes();
+        uint64_t seed = c10::util::xxh64(
+            sizes.data(),
+            sizes.size() * sizeof(int64_t),
+            static_cast<uint64_t>(src.scalar_type()));
+        const uint64_t fingerprint = c10::util::xxh64(
+            src.data_ptr(), src.numel() * src.element_size(), seed);
+        // Only cache if the tensor wasn't mutated while we hashed (the GIL
+        // is released here, so another thread may have written in place).
+        if (versioned &&
+            impl->version_counter().current_version() == version_before) {
+          impl->set_content_fingerprint(fingerprint);
+        }
+        return fingerprint;
+      },
+      py::call_guard<py::gil_scoped_release>());
+
   py_module.def("vitals_enabled", &at::vitals::torchVitalEnabled);
   py_module.def(
       "set_vital",
@@ -5,6 +5,7 @@
 #include <structmember.h>
 
 #include <c10/core/CPUAllocator.h>
+#include <c10/core/impl/cow/COW.h>
 #include <libshm.h>
 #include <torch/csrc/CudaIPCTypes.h>
 #include <torch/csrc/Device.h>
@@ -631,6 +632,37 @@ PyObject* THPStorage_sharedFd(PyObject* self, PyObject* noargs) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject* THPStorage_newCowAlias(PyObject* self, PyObject* noargs) {
+  HANDLE_TH_ERRORS
+  THPStorage_assertNotNull(self);
+  const auto& storage = THPStorage_Unpack(self);
+  THPUtils_assert(
+      storage.device_type() == at::kCPU,
+      "_new_cow_alias_cpu: only CPU storages are supported");
+  // Only shared-memory mappings are known to own their data through the
+  // DataPtr context; everything else must take the regular lazy-clone
+  // path, which verifies ownership itself.
+  THPUtils_assert(
+      c10::impl::cow::is_cow_data_ptr(storage.data_ptr()) ||
+          at::MapAllocator::fromDataPtr(storage.data_ptr()) ||
+          THManagedMapAllocator::fromDataPtr(storage.data_ptr()),
+      "_new_cow_alias_cpu: storage is not in shared memory; call share_memory_() first");
+  auto* impl = storage.unsafeGetStorageImpl();
+  if (impl->allocator() == nullptr) {
+    // Shared-memory storages carry no allocator, but materializing a
+    // write needs one to produce the private copy.
+    impl->set_allocator(c10::GetCPUAllocator());
+  }
+  auto alias = c10::impl::cow::lazy_clone_owning_storage(*impl);
+  THPUtils_assert(
+      alias, "_new_cow_alias_cpu: could not create a copy-on-write alias");
+  return THPStorage_NewWithStorage(
+      THPStorageClass,
+      std::move(alias),
+      c10::impl::PyInterpreterStatus::TAGGED_BY_US);
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THPStorage_isShared(PyObject* self, PyObject* noargs) {
   const auto& storage = THPStorage_Unpack(self);
   if (storage.device_type() == at::kCUDA) {
@@ -683,6 +715,7 @@ static PyMethodDef THPStorage_sharingMethods[] = {
     {"_shared_decref", THPStorage_sharedDecref, METH_NOARGS, nullptr},
     {"_shared_incref", THPStorage_sharedIncref, METH_NOARGS, nullptr},
     {"_get_shared_fd", THPStorage_sharedFd, METH_NOARGS, nullptr},
+    {"_new_cow_alias_cpu", THPStorage_newCowAlias, METH_NOARGS, nullptr},
     {"is_shared", THPStorage_isShared, METH_NOARGS, nullptr},
     {nullptr}};
 
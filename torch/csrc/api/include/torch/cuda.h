@@ -1,9 +1,13 @@
 #pragma once
 
+#include <ATen/core/Tensor.h>
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
 #include <torch/csrc/Export.h>
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 
 namespace torch {
 namespace cuda {
@@ -26,5 +30,62 @@ void TORCH_API manual_seed_all(uint64_t seed);
 /// Waits for all kernels in all streams on a CUDA device to complete.
 void TORCH_API synchronize(int64_t device_index = -1);
 
+/// Double-buffered, stream-aware host-to-device prefetcher.
+///
+/// Owns a dedicated copy stream and an N-deep queue of in-flight transfers
+/// so that host-to-device copies overlap with compute on the caller's
+/// stream:
+///
+///   torch::cuda::Prefetcher prefetcher(torch::kCUDA);
+///   prefetcher.put(first_batch);
+///   for (...) {
+///     prefetcher.put(next_batch);
+///     auto batch = prefetcher.get(); // ready on the current stream
+///     ...compute on batch...
+///   }
+///
+/// `put` stages the CPU tensor through pinned memory and enqueues an
+/// asynchronous copy on the copy stream. `get` returns device tensors in
+/// FIFO order after making the caller's current stream wait on the copy
+/// event and registering the use with the caching allocator
+/// (`record_stream`), so the returned tensor is safe to consume immediately
+/// and its memory is not reused while the consumer's stream still needs it.
+class TORCH_API Prefetcher {
+ public:
+  /// `depth` bounds the number of in-flight transfers; `put` waits for the
+  /// oldest copy to finish once the queue is full.
+  explicit Prefetcher(at::Device device, size_t depth = 2);
+
+  Prefetcher(const Prefetcher&) = delete;
+  Prefetcher& operator=(const Prefetcher&) = delete;
+
+  /// Enqueues an asynchronous copy of `source` (a CPU tensor) to the target
+  /// device on the prefetcher's copy stream and returns without waiting for
+  /// it. `source` is staged through pinned memory unless already pinned.
+  void put(const at::Tensor& source);
+
+  /// Returns the device copy of the least recently `put` tensor. The
+  /// caller's current stream is ordered after the copy, so no host
+  /// synchronization occurs.
+  at::Tensor get();
+
+  /// Number of transfers that have been `put` but not yet retrieved.
+  size_t size() const noexcept {
+    return queue_.size();
+  }
+
+ private:
+  struct InFlight {
+    at::Tensor staged; // pinned host staging, kept alive until retrieval
+    at::Tensor result;
+    c10::Event event;
+  };
+
+  at::Device device_;
+  size_t depth_;
+  c10::Stream copy_stream_;
+  std::deque<InFlight> queue_;
+};
+
 } // namespace cuda
 } // namespace torch
@@ -3,6 +3,7 @@
 #include <torch/data/dataloader.h>
 #include <torch/data/datasets.h>
 #include <torch/data/samplers.h>
+#include <torch/data/tensor_pipeline.h>
 #include <torch/data/transforms.h>
 
 // Some "exports".
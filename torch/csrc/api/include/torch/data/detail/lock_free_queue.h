@@ -0,0 +1,119 @@
+#pragma once
+
+#include <c10/util/Exception.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// A bounded, lock-free MPMC queue.
+///
+/// This is Dmitry Vyukov's bounded MPMC queue: every slot carries a sequence
+/// counter that producers and consumers use to claim it with a single
+/// compare-exchange, so neither `try_push` nor `try_pop` ever takes a lock.
+/// Both operations are non-blocking and simply return `false` when the queue
+/// is full (respectively empty); callers decide how to wait.
+///
+/// Like `Queue`, this data structure is written specifically for use with the
+/// `DataLoader` machinery (see `TensorBatchPipeline`) and is not intended as
+/// a general-purpose queue. In particular, the capacity is fixed at
+/// construction and rounded up to a power of two.
+template <typename T>
+class LockFreeQueue {
+ public:
+  explicit LockFreeQueue(size_t capacity) {
+    TORCH_CHECK(capacity > 0, "LockFreeQueue capacity must be positive");
+    size_t rounded_capacity = 2;
+    while (rounded_capacity < capacity) {
+      rounded_capacity *= 2;
+    }
+    mask_ = rounded_capacity - 1;
+    slots_ = std::make_unique<Slot[]>(rounded_capacity);
+    for (size_t index = 0; index < rounded_capacity; ++index) {
+      slots_[index].sequence.store(index, std::memory_order_relaxed);
+    }
+  }
+
+  LockFreeQueue(const LockFreeQueue&) = delete;
+  LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+  /// Attempts to push `value` to the back of the queue. Returns false (and
+  /// leaves `value` untouched) if the queue is full; `value` is moved from
+  /// only when the push succeeds.
+  bool try_push(T& value) {
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<intptr_t>(sequence) -
+          static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (enqueue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        // The slot one full lap behind us has not been consumed yet.
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value = std::move(value);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Attempts to pop the element at the front of the queue into `value`.
+  /// Returns false if the queue is empty.
+  bool try_pop(T& value) {
+    size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<intptr_t>(sequence) -
+          static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (dequeue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(slot->value);
+    slot->sequence.store(position + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Returns the actual (rounded up) capacity of the queue.
+  size_t capacity() const noexcept {
+    return mask_ + 1;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence{0};
+    T value;
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_ = 0;
+  // Producers and consumers advance independent counters, so place them on
+  // separate cache lines to avoid false sharing.
+  alignas(64) std::atomic<size_t> enqueue_position_{0};
+  alignas(64) std::atomic<size_t> dequeue_position_{0};
+};
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/data/detail/lock_free_queue.h>
+#include <torch/data/detail/sequencers.h>
+#include <torch/data/worker_exception.h>
+#include <torch/types.h>
+
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+
+/// Options to configure a `TensorBatchPipeline`.
+struct TensorBatchPipelineOptions {
+  TensorBatchPipelineOptions() = default;
+  /* implicit */ TensorBatchPipelineOptions(size_t batch_size)
+      : batch_size_(batch_size) {}
+
+  /// The size of each batch to assemble.
+  TORCH_ARG(size_t, batch_size) = 1;
+
+  /// The number of worker threads to launch. If zero, the calling thread will
+  /// synchronously assemble batches inside `next()`.
+  TORCH_ARG(size_t, workers) = 2;
+
+  /// How many batches each worker may run ahead of the consumer. The total
+  /// run-ahead window is `workers * prefetch_factor` batches.
+  TORCH_ARG(size_t, prefetch_factor) = 2;
+
+  /// Whether to omit the last batch if it contains less than `batch_size`
+  /// examples.
+  TORCH_ARG(bool, drop_last) = false;
+
+  /// Whether to copy assembled batches into pinned (page-locked) memory.
+  TORCH_ARG(bool, pin_memory) = false;
+};
+
+/// A native pipeline executor for map-style datasets of tensors.
+///
+/// The dataset is given as one tensor per column, where sample `i` of a
+/// column is `column[i]` (the layout `torch::data::datasets::TensorDataset`
+/// and the Python `TensorDataset` use). Given an epoch's index order, worker
+/// threads claim batch numbers off an atomic counter, assemble each batch
+/// with a single `index_select` per column and hand completed batches to the
+/// consumer through a bounded lock-free queue; `next()` returns them in
+/// deterministic batch order. This is the fast path behind the Python
+/// `DataLoader` (exposed as `torch._C._TensorBatchPipeline`): no Python code
+/// and no interpreter lock on the batch assembly path.
+///
+/// All methods except `next()` are safe to call from any thread; `next()`
+/// must be called from one thread at a time.
+class TensorBatchPipeline {
+ public:
+  TensorBatchPipeline(
+      std::vector<Tensor> columns,
+      std::vector<int64_t> indices,
+      TensorBatchPipelineOptions options)
+      : columns_(std::move(columns)),
+        indices_(std::move(indices)),
+        options_(std::move(options)),
+        queue_(std::max<size_t>(
+            options_.workers() * options_.prefetch_factor(),
+            1)) {
+    TORCH_CHECK(
+        !columns_.empty(), "TensorBatchPipeline requires at least one column");
+    TORCH_CHECK(options_.batch_size() > 0, "batch_size must be positive");
+    for (const auto& column : columns_) {
+      TORCH_CHECK(
+          column.dim() > 0 &&
+              column.size(0) == columns_.front().size(0),
+          "All columns must have the same size in dimension 0, but got ",
+          column.sizes(),
+          " vs ",
+          columns_.front().sizes());
+    }
+    const size_t sample_count = indices_.size();
+    const size_t batch_size = options_.batch_size();
+    batch_count_ = options_.drop_last()
+        ? sample_count / batch_size
+        : (sample_count + batch_size - 1) / batch_size;
+    if (options_.workers() > 0 && batch_count_ > 0) {
+      // Workers may only run `window_` batches ahead of the consumer; this
+      // both bounds memory use and guarantees the `OrderedSequencer` below
+      // never sees two in-flight batches that collide in its fixed buffer.
+      window_ = queue_.capacity() + options_.workers();
+      sequencer_ = std::make_unique<
+          detail::sequencers::OrderedSequencer<Result>>(window_);
+      for (const auto w : c10::irange(options_.workers())) {
+        (void)w;
+        workers_.emplace_back([this] { this->worker_thread(); });
+      }
+    }
+  }
+
+  TensorBatchPipeline(const TensorBatchPipeline&) = delete;
+  TensorBatchPipeline& operator=(const TensorBatchPipeline&) = delete;
+
+  ~TensorBatchPipeline() {
+    shutdown_.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /// Returns the next batch (one tensor per column), or `nullopt` once the
+  /// epoch is exhausted. Rethrows any exception raised in a worker thread,
+  /// wrapped in a `WorkerException`.
+  optional<std::vector<Tensor>> next() {
+    if (returned_.load(std::memory_order_relaxed) == batch_count_) {
+      return nullopt;
+    }
+    if (options_.workers() == 0) {
+      auto batch =
+          assemble_batch(returned_.load(std::memory_order_relaxed));
+      returned_.fetch_add(1, std::memory_order_release);
+      return batch;
+    }
+    auto result = sequencer_->next([this] { return pop_result(); });
+    AT_ASSERT(result.has_value());
+    returned_.fetch_add(1, std::memory_order_release);
+    if (result->exception) {
+      throw WorkerException(result->exception);
+    }
+    return std::move(result->batch);
+  }
+
+  /// The number of batches this pipeline will produce.
+  size_t batch_count() const noexcept {
+    return batch_count_;
+  }
+
+  /// The number of columns in each batch.
+  size_t column_count() const noexcept {
+    return columns_.size();
+  }
+
+ private:
+  struct Result {
+    size_t sequence_number = 0;
+    std::vector<Tensor> batch;
+    std::exception_ptr exception;
+  };
+
+  std::vector<Tensor> assemble_batch(size_t batch_index) const {
+    const size_t batch_size = options_.batch_size();
+    const size_t begin = batch_index * batch_size;
+    const size_t end = std::min(indices_.size(), begin + batch_size);
+    // Non-owning view into our own index storage; `indices_` outlives all
+    // worker threads.
+    Tensor index = torch::from_blob(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<int64_t*>(indices_.data() + begin),
+        {static_cast<int64_t>(end - begin)},
+        torch::kInt64);
+    std::vector<Tensor> batch;
+    batch.reserve(columns_.size());
+    for (const auto& column : columns_) {
+      auto tensor = column.index_select(0, index);
+      if (options_.pin_memory()) {
+        tensor = tensor.pin_memory();
+      }
+      batch.push_back(std::move(tensor));
+    }
+    return batch;
+  }
+
+  void worker_thread() {
+    while (true) {
+      const size_t job = next_job_.fetch_add(1, std::memory_order_relaxed);
+      if (job >= batch_count_) {
+        break;
+      }
+      // Stay within the run-ahead window of the consumer.
+      while (job >= returned_.load(std::memory_order_acquire) + window_) {
+        if (shutdown_.load(std::memory_order_relaxed)) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+      Result result;
+      result.sequence_number = job;
+      try {
+        result.batch = assemble_batch(job);
+      } catch (...) {
+        result.exception = std::current_exception();
+      }
+      while (!queue_.try_push(result)) {
+        if (shutdown_.load(std::memory_order_relaxed)) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  optional<Result> pop_result() {
+    Result result;
+    // As long as batches remain outstanding, some worker is guaranteed to
+    // eventually push, so spinning here cannot deadlock.
+    while (!queue_.try_pop(result)) {
+      std::this_thread::yield();
+    }
+    return result;
+  }
+
+  std::vector<Tensor> columns_;
+  std::vector<int64_t> indices_;
+  TensorBatchPipelineOptions options_;
+  size_t batch_count_ = 0;
+  size_t window_ = 0;
+  std::atomic<size_t> next_job_{0};
+  std::atomic<size_t> returned_{0};
+  std::atomic<bool> shutdown_{false};
+  detail::LockFreeQueue<Result> queue_;
+  std::unique_ptr<detail::sequencers::OrderedSequencer<Result>> sequencer_;
+  std::vector<std::thread> workers_;
+};
+
+} // namespace data
+} // namespace torch
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <ATen/core/ivalue.h>
+#include <ATen/core/jit_type.h>
+#include <torch/arg.h>
+#include <torch/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+/// Options to configure a `BatchingQueue`.
+struct BatchingQueueOptions {
+  BatchingQueueOptions() = default;
+  /* implicit */ BatchingQueueOptions(size_t max_batch_size)
+      : max_batch_size_(max_batch_size) {}
+
+  /// The number of samples at which a batch is dispatched immediately,
+  /// without waiting for the timeout.
+  TORCH_ARG(size_t, max_batch_size) = 8;
+
+  /// How long the dispatcher keeps collecting further samples after the first
+  /// sample of a batch arrived. This bounds the latency a sample can pay for
+  /// the throughput gained by batching.
+  TORCH_ARG(std::chrono::milliseconds, timeout) = std::chrono::milliseconds(5);
+};
+
+/// Coalesces concurrently submitted single-sample tensors into batches for a
+/// throughput-oriented `forward()`.
+///
+/// Request-serving threads call `submit()` with one sample each and receive a
+/// future for that sample's row of the batched output. Submission is a
+/// lock-free multi-producer push; a single dispatcher thread collects samples
+/// until either `max_batch_size` samples accumulated or `timeout` passed
+/// since the first sample of the batch, stacks them along a new leading
+/// dimension with `at::stack`, runs the batched forward once, and fulfills
+/// each sample's future with the corresponding row of the output. If the
+/// forward throws, every future of that batch receives the error instead.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::nn::Linear model(8, 4);
+///   torch::nn::utils::BatchingQueue queue(
+///       [&](torch::Tensor batch) { return model->forward(batch); },
+///       torch::nn::utils::BatchingQueueOptions().max_batch_size(32).timeout(
+///           std::chrono::milliseconds(2)));
+///
+///   // On each serving thread:
+///   auto future = queue.submit(sample);
+///   future->wait();
+///   torch::Tensor prediction = future->value().toTensor();
+/// \endrst
+///
+/// Destroying the queue stops the dispatcher; samples still pending at that
+/// point have their futures completed with an error rather than being left
+/// unfulfilled.
+class BatchingQueue {
+ public:
+  using Future = c10::ivalue::Future;
+
+  explicit BatchingQueue(
+      std::function<Tensor(Tensor)> forward,
+      BatchingQueueOptions options = {})
+      : forward_(std::move(forward)), options_(options) {
+    dispatcher_ = std::thread([this] { run(); });
+  }
+
+  BatchingQueue(const BatchingQueue&) = delete;
+  BatchingQueue& operator=(const BatchingQueue&) = delete;
+
+  ~BatchingQueue() {
+    shutdown_.store(true, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_one();
+    }
+    dispatcher_.join();
+    // Fail whatever was still queued so that no waiter blocks forever.
+    Node* node = take_all();
+    while (node != nullptr) {
+      Node* next = node->next;
+      node->future->setError(std::make_exception_ptr(
+          std::runtime_error("BatchingQueue was destroyed before the sample "
+                             "could be processed")));
+      delete node;
+      node = next;
+    }
+  }
+
+  /// Submits one sample and returns the future that will hold this sample's
+  /// row of the batched output. Safe to call from any number of threads
+  /// concurrently; the push itself is lock-free.
+  c10::intrusive_ptr<Future> submit(Tensor sample) {
+    auto future = c10::make_intrusive<Future>(c10::TensorType::get());
+    auto* node = new Node{std::move(sample), future, nullptr};
+    Node* head = head_.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!head_.compare_exchange_weak(
+        head, node, std::memory_order_release, std::memory_order_relaxed));
+    if (head == nullptr) {
+      // The queue went empty -> non-empty, so the dispatcher may be asleep.
+      // Taking the mutex closes the race with its predicate check.
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_one();
+    }
+    return future;
+  }
+
+ private:
+  struct Node {
+    Tensor sample;
+    c10::intrusive_ptr<Future> future;
+    Node* next;
+  };
+
+  Node* take_all() {
+    return head_.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  /// Pops everything submitted so far and appends it to `batch` in
+  /// submission order (the stack pops newest-first, so reverse it).
+  void drain_into(std::vector<Node*>& batch) {
+    Node* node = take_all();
+    Node* reversed = nullptr;
+    while (node != nullptr) {
+      Node* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    while (reversed != nullptr) {
+      batch.push_back(reversed);
+      reversed = reversed->next;
+    }
+  }
+
+  void dispatch(const std::vector<Node*>& nodes, size_t begin, size_t end) {
+    std::vector<Tensor> samples;
+    samples.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+      samples.push_back(nodes[i]->sample);
+    }
+    try {
+      Tensor output = forward_(at::stack(samples));
+      TORCH_CHECK(
+          output.defined(), "BatchingQueue forward returned an undefined tensor");
+      TORCH_CHECK(
+          output.size(0) == static_cast<int64_t>(end - begin),
+          "BatchingQueue forward returned ",
+          output.size(0),
+          " rows for a batch of ",
+          end - begin,
+          " samples");
+      for (size_t i = begin; i < end; ++i) {
+        nodes[i]->future->markCompleted(output[static_cast<int64_t>(i - begin)]);
+      }
+    } catch (...) {
+      for (size_t i = begin; i < end; ++i) {
+        nodes[i]->future->setError(std::current_exception());
+      }
+    }
+    for (size_t i = begin; i < end; ++i) {
+      delete nodes[i];
+    }
+  }
+
+  void run() {
+    std::vector<Node*> batch;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] {
+          return shutdown_.load(std::memory_order_acquire) ||
+              head_.load(std::memory_order_acquire) != nullptr;
+        });
+      }
+      if (shutdown_.load(std::memory_order_acquire)) {
+        // Anything still queued is failed by the destructor.
+        return;
+      }
+      const auto deadline =
+          std::chrono::steady_clock::now() + options_.timeout();
+      batch.clear();
+      drain_into(batch);
+      while (batch.size() < options_.max_batch_size() &&
+             !shutdown_.load(std::memory_order_acquire) &&
+             std::chrono::steady_clock::now() < deadline) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const bool woke = cv_.wait_until(lock, deadline, [this] {
+          return shutdown_.load(std::memory_order_acquire) ||
+              head_.load(std::memory_order_acquire) != nullptr;
+        });
+        if (!woke) {
+          break; // Timed out; dispatch what we have.
+        }
+        lock.unlock();
+        drain_into(batch);
+      }
+      // A single drain can exceed `max_batch_size`; dispatch in chunks so the
+      // forward never sees a larger batch than configured.
+      for (size_t begin = 0; begin < batch.size();
+           begin += options_.max_batch_size()) {
+        const size_t end =
+            std::min(begin + options_.max_batch_size(), batch.size());
+        dispatch(batch, begin, end);
+      }
+    }
+  }
+
+  std::function<Tensor(Tensor)> forward_;
+  const BatchingQueueOptions options_;
+  std::atomic<Node*> head_{nullptr};
+  std::atomic<bool> shutdown_{false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread dispatcher_;
+};
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/ordered_dict.h>
+#include <torch/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace torch {
+namespace nn {
+class Module;
+} // namespace nn
+} // namespace torch
+
+namespace torch {
+namespace serialize {
+
+/// Writes checkpoints of a module's state as a chain of delta archives.
+///
+/// `torch::save` rewrites every parameter and buffer on each checkpoint even
+/// when most of them did not change in between (e.g. state for frozen layers
+/// on a minutes-level checkpoint cadence). An `IncrementalCheckpointer`
+/// instead remembers each tensor's version counter (see `c10::VariableVersion`
+/// in `c10/core/TensorImpl.h`) from its previous `save()` and writes only the
+/// tensors that were mutated since then, together with a manifest naming the
+/// previous archive. `load()` follows the manifest chain backwards until every
+/// key has been resolved, so loading the newest delta restores exactly the
+/// same state as a full checkpoint would.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::serialize::IncrementalCheckpointer checkpointer;
+///   checkpointer.save(*model, "checkpoint-0.pt"); // full checkpoint
+///   train_for_a_while();
+///   checkpointer.save(*model, "checkpoint-1.pt"); // delta vs. checkpoint-0
+///
+///   torch::serialize::IncrementalCheckpointer::load(*model, "checkpoint-1.pt");
+/// \endrst
+///
+/// Parent filenames are recorded verbatim, so a chain must be loaded with the
+/// same working directory (or with absolute paths) as it was saved with. The
+/// first `save()` on a fresh instance is always a full checkpoint.
+class TORCH_API IncrementalCheckpointer {
+ public:
+  /// Saves the parameters and buffers of `module` to `filename`, writing only
+  /// the tensors changed since this instance's previous `save()`.
+  void save(const nn::Module& module, const std::string& filename);
+
+  /// Saves `named_tensors` to `filename`, writing only the tensors changed
+  /// since this instance's previous `save()`. Useful for state that does not
+  /// live on a module, such as flattened optimizer buffers.
+  void save(
+      const OrderedDict<std::string, Tensor>& named_tensors,
+      const std::string& filename);
+
+  /// Restores the parameters and buffers of `module` from the delta chain
+  /// ending at `filename`.
+  static void load(nn::Module& module, const std::string& filename);
+
+  /// Collects the named tensors stored in the delta chain ending at
+  /// `filename`, newest version of each key winning.
+  static OrderedDict<std::string, Tensor> load(const std::string& filename);
+
+ private:
+  /// What we remember about a tensor at the time it was last written. The
+  /// version counter alone is not enough: `set_data()` swaps the storage
+  /// without bumping it, so the data pointer is fingerprinted too.
+  struct TensorFingerprint {
+    const void* data;
+    uint32_t version;
+  };
+
+  std::string last_filename_;
+  std::unordered_map<std::string, TensorFingerprint> fingerprints_;
+};
+
+} // namespace serialize
+} // namespace torch
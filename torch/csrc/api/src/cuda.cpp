@@ -2,9 +2,13 @@
 
 #include <ATen/Context.h>
 #include <c10/core/DeviceGuard.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/util/irange.h>
 
 #include <cstddef>
+#include <thread>
+#include <utility>
 
 namespace torch {
 namespace cuda {
@@ -61,5 +65,62 @@ void synchronize(int64_t device_index) {
   at::detail::getCUDAHooks().deviceSynchronize(device_index);
 }
 
+Prefetcher::Prefetcher(at::Device device, size_t depth)
+    : device_(device),
+      depth_(depth),
+      // Placeholder; replaced with a pool stream below once the device has
+      // been validated.
+      copy_stream_(c10::Stream::DEFAULT, device) {
+  TORCH_CHECK(
+      device_.is_cuda(),
+      "Prefetcher requires a CUDA device, but got ",
+      device_);
+  TORCH_CHECK(depth_ > 0, "Prefetcher depth must be positive, but got ", depth);
+  c10::impl::VirtualGuardImpl impl(device_.type());
+  copy_stream_ = impl.getStreamFromGlobalPool(device_, /*isHighPriority=*/false);
+}
+
+void Prefetcher::put(const at::Tensor& source) {
+  TORCH_CHECK(
+      source.device().is_cpu(),
+      "Prefetcher::put expects a CPU tensor, but got one on ",
+      source.device());
+  // Bound in-flight transfers (and thus staging and device memory): once the
+  // queue is full, wait on the host for the oldest copy to complete. Copies
+  // execute in FIFO order on the copy stream, so the front event suffices.
+  while (queue_.size() >= depth_ && !queue_.front().event.query()) {
+    std::this_thread::yield();
+  }
+
+  // Stage through pinned memory so the host-to-device copy is truly
+  // asynchronous; the staging tensor stays alive in the queue entry until
+  // the transfer has been retrieved.
+  at::Tensor staged = source.is_pinned() ? source : source.pin_memory();
+
+  c10::StreamGuard stream_guard(copy_stream_);
+  at::Tensor result = staged.to(device_, /*non_blocking=*/true);
+  c10::Event event(device_.type());
+  event.record(copy_stream_);
+  queue_.push_back(
+      InFlight{std::move(staged), std::move(result), std::move(event)});
+}
+
+at::Tensor Prefetcher::get() {
+  TORCH_CHECK(
+      !queue_.empty(), "Prefetcher::get called with no pending transfer");
+  InFlight entry = std::move(queue_.front());
+  queue_.pop_front();
+
+  c10::impl::VirtualGuardImpl impl(device_.type());
+  c10::Stream current = impl.getStream(device_);
+  // Order the consumer's stream after the copy; no host synchronization.
+  entry.event.block(current);
+  // The result was allocated on the copy stream. Tell the caching allocator
+  // it is consumed on the caller's stream so its memory is not handed out
+  // again until that stream's work has finished.
+  entry.result.record_stream(current);
+  return std::move(entry.result);
+}
+
 } // namespace cuda
 } // namespace torch
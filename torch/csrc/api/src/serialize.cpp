@@ -1,7 +1,17 @@
 #include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/csrc/jit/serialization/pickler.h>
+#include <torch/nn/module.h>
 #include <torch/serialize.h>
+#include <torch/utils.h>
 
+#include <ATen/core/Dict.h>
+#include <ATen/core/List.h>
+#include <c10/core/TensorImpl.h>
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace torch {
@@ -14,4 +24,172 @@ torch::IValue pickle_load(const std::vector<char>& data) {
   return jit::pickle_load(data);
 }
 
+namespace serialize {
+namespace {
+
+// Bump when the manifest layout of incremental archives changes.
+constexpr int64_t kIncrementalFormatVersion = 1;
+
+OrderedDict<std::string, Tensor> module_state(const nn::Module& module) {
+  OrderedDict<std::string, Tensor> state;
+  for (const auto& parameter : module.named_parameters()) {
+    state.insert(parameter.key(), parameter.value());
+  }
+  for (const auto& buffer : module.named_buffers()) {
+    state.insert(buffer.key(), buffer.value());
+  }
+  return state;
+}
+
+} // namespace
+
+void IncrementalCheckpointer::save(
+    const nn::Module& module,
+    const std::string& filename) {
+  save(module_state(module), filename);
+}
+
+void IncrementalCheckpointer::save(
+    const OrderedDict<std::string, Tensor>& named_tensors,
+    const std::string& filename) {
+  const bool full = last_filename_.empty();
+  c10::List<std::string> keys;
+  c10::Dict<std::string, Tensor> deltas;
+  for (const auto& item : named_tensors) {
+    const auto& key = item.key();
+    const auto& tensor = item.value();
+    keys.push_back(key);
+    bool changed = full;
+    TensorFingerprint fingerprint{nullptr, 0};
+    if (tensor.defined()) {
+      const auto& counter = tensor.unsafeGetTensorImpl()->version_counter();
+      fingerprint.data = tensor.data_ptr();
+      if (counter.enabled()) {
+        fingerprint.version = counter.current_version();
+      }
+      if (!changed) {
+        // Inference tensors do not track versions, so they are always dirty.
+        const auto it = fingerprints_.find(key);
+        changed = it == fingerprints_.end() || !counter.enabled() ||
+            it->second.data != fingerprint.data ||
+            it->second.version != fingerprint.version;
+      }
+    } else {
+      changed = true;
+    }
+    if (changed) {
+      deltas.insert(key, tensor);
+    }
+    fingerprints_[key] = fingerprint;
+  }
+
+  OutputArchive archive;
+  archive.write("format_version", c10::IValue(kIncrementalFormatVersion));
+  archive.write("parent", c10::IValue(full ? std::string() : last_filename_));
+  archive.write("keys", c10::IValue(keys));
+  archive.write("deltas", c10::IValue(deltas));
+  archive.save_to(filename);
+  last_filename_ = filename;
+}
+
+void IncrementalCheckpointer::load(
+    nn::Module& module,
+    const std::string& filename) {
+  const auto state = load(filename);
+  torch::NoGradGuard guard;
+  const auto restore = [&state,
+                        &filename](OrderedDict<std::string, Tensor> named) {
+    for (auto& item : named) {
+      const auto* loaded = state.find(item.key());
+      TORCH_CHECK(
+          loaded != nullptr,
+          "Incremental checkpoint chain ending at '",
+          filename,
+          "' has no tensor for '",
+          item.key(),
+          "'");
+      auto& tensor = item.value();
+      // Same restore semantics as `InputArchive::try_read`.
+      if (tensor.defined()) {
+        if (tensor.device() != loaded->device()) {
+          tensor.set_data(*loaded);
+        } else {
+          tensor.set_(*loaded);
+        }
+      } else {
+        tensor = *loaded;
+      }
+    }
+  };
+  restore(module.named_parameters());
+  restore(module.named_buffers());
+}
+
+OrderedDict<std::string, Tensor> IncrementalCheckpointer::load(
+    const std::string& filename) {
+  std::vector<std::string> key_order;
+  std::unordered_map<std::string, Tensor> resolved;
+  std::unordered_set<std::string> visited;
+  std::string current = filename;
+  bool newest = true;
+  while (!current.empty()) {
+    TORCH_CHECK(
+        visited.insert(current).second,
+        "Incremental checkpoint chain contains a cycle at '",
+        current,
+        "'");
+    InputArchive archive;
+    archive.load_from(current);
+    c10::IValue format_version;
+    archive.read("format_version", format_version);
+    TORCH_CHECK(
+        format_version.isInt() &&
+            format_version.toInt() == kIncrementalFormatVersion,
+        "'",
+        current,
+        "' is not an incremental checkpoint this build can read");
+    if (newest) {
+      // The newest archive's manifest defines the key set and its order;
+      // parents only contribute tensors for keys not yet resolved.
+      c10::IValue keys;
+      archive.read("keys", keys);
+      for (const auto& key : keys.toListRef()) {
+        key_order.push_back(key.toStringRef());
+      }
+      newest = false;
+    }
+    c10::IValue deltas;
+    archive.read("deltas", deltas);
+    for (const auto& entry : deltas.toGenericDict()) {
+      // `emplace` keeps the newer version of a key over its parents'.
+      resolved.emplace(entry.key().toStringRef(), entry.value().toTensor());
+    }
+    const bool complete = std::all_of(
+        key_order.begin(), key_order.end(), [&](const std::string& key) {
+          return resolved.count(key) > 0;
+        });
+    if (complete) {
+      break;
+    }
+    c10::IValue parent;
+    archive.read("parent", parent);
+    current = parent.toStringRef();
+  }
+
+  OrderedDict<std::string, Tensor> state;
+  for (const auto& key : key_order) {
+    const auto it = resolved.find(key);
+    TORCH_CHECK(
+        it != resolved.end(),
+        "Incremental checkpoint chain ending at '",
+        filename,
+        "' is missing tensor '",
+        key,
+        "'");
+    state.insert(key, it->second);
+  }
+  return state;
+}
+
+} // namespace serialize
 } // namespace torch
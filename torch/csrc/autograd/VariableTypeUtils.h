@@ -1,5 +1,6 @@
 #pragma once
 
+#include <c10/core/impl/cow/COW.h>
 #include <c10/util/irange.h>
 
 #include <ATen/core/boxing/KernelFunction.h>
@@ -135,6 +136,30 @@ inline void increment_version(const at::Tensor& t) {
   impl::bump_version(t);
 }
 
+// In-place kernels must give copy-on-write storages their own data
+// allocation before writing through them, so that lazy clones (see
+// c10/core/impl/cow/COW.h) keep their values. The generated
+// ADInplaceOrView kernels call this on every mutated argument.
+inline void materialize_cow(const at::Tensor& t) {
+  if (t.defined() && t.has_storage() &&
+      C10_UNLIKELY(c10::impl::cow::is_cow_data_ptr(t.storage().data_ptr()))) {
+    c10::impl::cow::materialize_cow_storage(
+        *t.storage().unsafeGetStorageImpl());
+  }
+}
+
+inline void materialize_cow(const c10::optional<at::Tensor>& t) {
+  if (t.has_value()) {
+    materialize_cow(*t);
+  }
+}
+
+inline void materialize_cow(at::ITensorListRef tensors) {
+  for (const auto& t : tensors) {
+    materialize_cow(t);
+  }
+}
+
 struct Flatten : IterArgs<Flatten> {
   Flatten(variable_list& out) : out(out) {}
   variable_list& out;
@@ -2,13 +2,53 @@
 #include <c10/util/Exception.h>
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/function.h>
+#include <algorithm>
+#include <array>
 #include <mutex>
+#include <sstream>
 
 namespace torch {
 namespace autograd {
 
 bool AnomalyMode::_enabled = false;
 bool AnomalyMode::_check_nan = true;
+std::atomic<bool> SampledAnomalyMode::_enabled{false};
+
+namespace {
+
+// Per-thread ring buffer of recently executed node names. Backward for a
+// given graph task runs its nodes on a fixed set of engine threads, so a
+// per-thread history is both lock-free and exactly the context wanted in
+// the failure report: the nodes that ran just before the one that produced
+// the non-finite value on that thread.
+struct RecentNodeRing {
+  std::array<std::string, SampledAnomalyMode::kRecentNodes> names;
+  // Total number of nodes recorded; names[i % kRecentNodes] holds the
+  // (i+1)-th most recent entry for i < count.
+  uint64_t count = 0;
+};
+
+thread_local RecentNodeRing recent_node_ring;
+
+} // namespace
+
+void SampledAnomalyMode::record_node(std::string name) {
+  auto& ring = recent_node_ring;
+  ring.names[ring.count % kRecentNodes] = std::move(name);
+  ring.count++;
+}
+
+std::string SampledAnomalyMode::recent_nodes_report() {
+  const auto& ring = recent_node_ring;
+  const uint64_t available = std::min<uint64_t>(ring.count, kRecentNodes);
+  std::ostringstream report;
+  for (uint64_t i = 0; i < available; i++) {
+    const uint64_t index = ring.count - available + i;
+    report << "  #" << index << ": " << ring.names[index % kRecentNodes]
+           << "\n";
+  }
+  return report.str();
+}
 
 namespace {
 std::mutex& get_anomaly_guard_lock() {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <torch/csrc/Export.h>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -58,6 +60,44 @@ class TORCH_API DetectAnomalyGuard {
   bool prev_check_nan_;
 };
 
+/// A lightweight, always-on-capable variant of anomaly detection.
+///
+/// Unlike AnomalyMode, which materializes a full NaN reduction over every
+/// node output (and records a Python traceback per node at forward time),
+/// this mode only probes a fixed number of elements per output and keeps a
+/// small per-thread ring buffer of recently executed node names. The cost
+/// per node is bounded and independent of output size, so it is cheap
+/// enough to leave enabled in production runs. When a sampled element is
+/// non-finite, the error message includes the recent-node history of the
+/// executing thread to narrow down where the bad values first appeared.
+///
+/// Only CPU strided floating-point outputs are sampled; reading back GPU
+/// outputs would synchronize the stream and defeat the purpose of a
+/// low-overhead mode.
+struct TORCH_API SampledAnomalyMode {
+  // Upper bound on the number of elements probed per output tensor.
+  static constexpr int64_t kSamplesPerOutput = 64;
+  // Number of node names retained per thread for the failure report.
+  static constexpr size_t kRecentNodes = 64;
+
+  static bool is_enabled() {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+  static void set_enabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  // Appends a node name to the calling thread's ring buffer of recently
+  // executed nodes.
+  static void record_node(std::string name);
+
+  // Renders the calling thread's recent nodes, oldest first, one per line.
+  static std::string recent_nodes_report();
+
+ private:
+  static std::atomic<bool> _enabled;
+};
+
 struct TORCH_API AnomalyMetadata {
   virtual ~AnomalyMetadata();
   virtual void store_stack();
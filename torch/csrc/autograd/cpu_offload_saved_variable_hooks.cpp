@@ -0,0 +1,69 @@
+#include <torch/csrc/autograd/cpu_offload_saved_variable_hooks.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+namespace torch {
+namespace autograd {
+
+namespace {
+thread_local bool cpu_offload_enabled = false;
+}
+
+void CpuOffloadSavedVariableHooks::set_enabled(bool enabled) {
+  cpu_offload_enabled = enabled;
+}
+
+bool CpuOffloadSavedVariableHooks::is_enabled() {
+  return cpu_offload_enabled;
+}
+
+void CpuOffloadSavedVariableHooks::call_pack_hook(const at::Tensor& tensor) {
+  // Only dense tensors on a device with stream support are offloaded; CPU
+  // and sparse tensors are stored as-is, matching save_on_cpu.
+  if (tensor.device().is_cpu() || tensor.layout() != c10::kStrided) {
+    data_ = tensor;
+    return;
+  }
+  at::NoGradGuard no_grad;
+  const auto device = tensor.device();
+  c10::impl::VirtualGuardImpl impl(device.type());
+  const auto producer_stream = impl.getStream(device);
+  const auto offload_stream = impl.getStreamFromGlobalPool(device);
+  // The side stream must observe the producer's writes before copying.
+  c10::Event produced(device.type());
+  produced.record(producer_stream);
+  produced.block(offload_stream);
+  {
+    c10::StreamGuard guard(offload_stream);
+    data_ = at::empty_like(
+        tensor, tensor.options().device(c10::kCPU).pinned_memory(true));
+    data_.copy_(tensor, /*non_blocking=*/true);
+    // Keep the source storage alive until the side-stream copy has finished,
+    // even if the producer releases the tensor right after packing.
+    impl.recordDataPtrOnStream(tensor.storage().data_ptr(), offload_stream);
+  }
+  copy_done_.emplace(device.type());
+  copy_done_->record(offload_stream);
+  device_ = device;
+}
+
+at::Tensor CpuOffloadSavedVariableHooks::call_unpack_hook() {
+  if (!device_.has_value()) {
+    return data_;
+  }
+  at::NoGradGuard no_grad;
+  c10::impl::VirtualGuardImpl impl(device_->type());
+  // Order the copy back after the offload, then let it overlap the backward:
+  // the transfer out of pinned memory is non-blocking and joins the consumer
+  // through ordinary stream ordering.
+  copy_done_->block(impl.getStream(*device_));
+  return data_.to(
+      data_.options().device(*device_),
+      /*non_blocking=*/true,
+      /*copy=*/false);
+}
+
+} // namespace autograd
+} // namespace torch
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/core/Event.h>
+#include <c10/util/Optional.h>
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+namespace torch {
+namespace autograd {
+
+// Native counterpart of torch.autograd.graph.save_on_cpu(pin_memory=True).
+// When enabled (thread-locally, via set_enabled), every SavedVariable packs
+// its tensor by copying it asynchronously to pinned host memory on a side
+// stream, and unpacking copies it back with a non-blocking transfer ordered
+// after the offload through an event. Unlike the Python hooks, no GIL or
+// Python round trip is involved per saved tensor.
+struct TORCH_API CpuOffloadSavedVariableHooks : public SavedVariableHooks {
+  void call_pack_hook(const at::Tensor& tensor) override;
+  at::Tensor call_unpack_hook() override;
+
+  static void set_enabled(bool enabled);
+  static bool is_enabled();
+
+ private:
+  // Pinned host copy of the packed tensor (or the tensor itself when it was
+  // already on CPU or is not a dense tensor).
+  at::Tensor data_;
+  // Device the tensor was offloaded from; nullopt when data_ was stored as-is.
+  c10::optional<c10::Device> device_;
+  // Records completion of the device-to-host copy on the side stream.
+  c10::optional<c10::Event> copy_done_;
+};
+
+} // namespace autograd
+} // namespace torch
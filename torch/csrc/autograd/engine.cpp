@@ -9,6 +9,7 @@
 #include <torch/csrc/utils/memory.h>
 
 #include <ATen/DeviceGuard.h>
+#include <ATen/Dispatch.h>
 #include <ATen/ExpandUtils.h>
 #include <ATen/Parallel.h>
 #include <ATen/SparseCsrTensorUtils.h>
@@ -31,6 +32,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
@@ -279,7 +281,11 @@ void Engine::stop() {
   }
   if (noBackward && wait_duration > 0.0f) {
     for (auto& queue : device_ready_queues_) {
-      queue->pushShutdownTask();
+      // One shutdown task per worker sharing the queue
+      for (const auto i : c10::irange(num_threads_per_device())) {
+        (void)i;
+        queue->pushShutdownTask();
+      }
     }
     // Do not wait for termination of global threads on Windows
     // Because CRT terminates DLL threads before calling
@@ -930,6 +936,39 @@ static variable_list call_function(
   return outputs;
 }
 
+// Probes at most SampledAnomalyMode::kSamplesPerOutput elements of `output`
+// for NaN/inf. Only CPU strided floating-point tensors are sampled: reading
+// back other devices would synchronize their streams, which this mode must
+// not do. The scan reads through const_data_ptr directly, so it neither
+// dispatches an op nor touches autograd.
+static bool sampled_output_has_nonfinite(const at::Tensor& output) {
+  if (!output.device().is_cpu() ||
+      output.layout() != c10::Layout::Strided ||
+      !at::isFloatingType(output.scalar_type()) || output.numel() == 0 ||
+      !output.is_contiguous()) {
+    return false;
+  }
+  const int64_t numel = output.numel();
+  const int64_t step =
+      std::max<int64_t>(1, numel / SampledAnomalyMode::kSamplesPerOutput);
+  bool found = false;
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::kHalf,
+      at::kBFloat16,
+      output.scalar_type(),
+      "sampled_anomaly_check",
+      [&] {
+        const scalar_t* data = output.const_data_ptr<scalar_t>();
+        for (int64_t i = 0; i < numel; i += step) {
+          if (!std::isfinite(static_cast<double>(data[i]))) {
+            found = true;
+            return;
+          }
+        }
+      });
+  return found;
+}
+
 void Engine::evaluate_function(
     std::shared_ptr<GraphTask>& graph_task,
     Node* func,
@@ -946,6 +985,7 @@ void Engine::evaluate_function(
   auto& exec_info_ = graph_task->exec_info_;
   if (!exec_info_.empty()) {
     auto& fn_info = exec_info_.at(func);
+    inputs.flush();
     variable_list new_inputs = inputs.buffer;
     if (!fn_info.needed_) {
       // We always want to call tensor pre-hooks, but want to avoid calling it
@@ -1010,6 +1050,20 @@ void Engine::evaluate_function(
         throw std::runtime_error(ss.str());
       }
     }
+  } else if (SampledAnomalyMode::is_enabled()) {
+    SampledAnomalyMode::record_node(fn.name());
+    for (const auto i : c10::irange(num_outputs)) {
+      auto& output = outputs[i];
+      if (output.defined() && sampled_output_has_nonfinite(output)) {
+        std::stringstream ss;
+        ss << "Function '" << fn.name()
+           << "' returned non-finite values in its " << i
+           << "th output (detected by sampled anomaly mode)."
+           << " Recently executed nodes on this thread (oldest first):\n"
+           << SampledAnomalyMode::recent_nodes_report();
+        throw std::runtime_error(ss.str());
+      }
+    }
   }
 
   // Lock mutex for the accesses to GraphTask dependencies_, not_ready_ and
@@ -1091,15 +1145,95 @@ inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
   return min_topo_nr;
 }
 
+// Steady-state training replays the same autograd graph every iteration, so
+// the node count of this thread's previous backward is a good reservation
+// hint for the next one's bookkeeping tables. Reserving up front avoids
+// rehashing them ~log2(N) times per iteration while the graph is rediscovered.
+static thread_local size_t prev_graph_task_num_nodes = 0;
+
+namespace {
+
+// Note [Cached execution schedules]
+// When the same graph is backward-ed repeatedly (retain_graph training, or
+// repeated autograd.grad calls on one forward), compute_dependencies walks an
+// identical topology every time. We cache the result of the walk — the node
+// set, the dependency counts, and whether CUDA streams need stashing — keyed
+// by the root's outgoing edges. A graph's topology is fixed once its nodes
+// are constructed, so validating a hit only requires checking that every root
+// function is still the same live Node (weak_ptr identity) and that
+// min_topo_nr matches; on a hit the schedule is replayed into the GraphTask
+// without touching next_edges at all. Roots rebuilt by a fresh forward pass
+// have new addresses and simply miss; expired entries are pruned when the
+// cache fills up.
+struct CachedGraphSchedule {
+  std::vector<std::weak_ptr<Node>> roots;
+  uint64_t min_topo_nr = 0;
+  std::vector<std::pair<Node*, int>> dependencies;
+  std::vector<Node*> nodes;
+  bool will_use_cuda = false;
+};
+
+std::mutex schedule_cache_mutex;
+std::unordered_map<Node*, CachedGraphSchedule> schedule_cache;
+constexpr size_t kMaxCachedSchedules = 16;
+
+bool schedule_matches(
+    const CachedGraphSchedule& entry,
+    const edge_list& root_edges,
+    uint64_t min_topo_nr) {
+  if (entry.min_topo_nr != min_topo_nr ||
+      entry.roots.size() != root_edges.size()) {
+    return false;
+  }
+  for (const auto i : c10::irange(root_edges.size())) {
+    const auto locked = entry.roots[i].lock();
+    if (!locked || locked.get() != root_edges[i].function.get()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 auto Engine::compute_dependencies(
     Node* root,
     GraphTask& task,
     uint64_t min_topo_nr) -> void {
   // Computes the number of dependencies for each function which requires grad
+  const auto& root_edges = root->next_edges();
+  Node* cache_key =
+      root_edges.empty() ? nullptr : root_edges.front().function.get();
+  if (cache_key) {
+    std::lock_guard<std::mutex> lock(schedule_cache_mutex);
+    auto it = schedule_cache.find(cache_key);
+    if (it != schedule_cache.end() &&
+        schedule_matches(it->second, root_edges, min_topo_nr)) {
+      // See Note [Cached execution schedules]
+      const auto& entry = it->second;
+      task.dependencies_.reserve(entry.dependencies.size());
+      task.dependencies_.insert(
+          entry.dependencies.begin(), entry.dependencies.end());
+      task.nodes_in_graph_.reserve(entry.nodes.size());
+      task.nodes_in_graph_.insert(entry.nodes.begin(), entry.nodes.end());
+      prev_graph_task_num_nodes = entry.nodes.size();
+      if (entry.will_use_cuda) {
+        task.stash_current_streams();
+      }
+      return;
+    }
+  }
+
   std::vector<Node*> queue{root};
   bool might_use_cuda = at::globalContext().hasCUDA();
   bool will_use_cuda = false;
 
+  if (prev_graph_task_num_nodes > 0) {
+    task.dependencies_.reserve(prev_graph_task_num_nodes);
+    task.nodes_in_graph_.reserve(prev_graph_task_num_nodes);
+    task.not_ready_.reserve(prev_graph_task_num_nodes);
+  }
+
   // Queue contains all nodes that will start propagating gradients.
   // We no longer have to expand functions that don't require grad.
   auto& dependencies = task.dependencies_;
@@ -1122,11 +1256,38 @@ auto Engine::compute_dependencies(
     }
   }
 
+  prev_graph_task_num_nodes = task.nodes_in_graph_.size();
+
   if (will_use_cuda) {
     // Collects current streams for devices where this process has a context,
     // so GraphTask::exec_post_processing can sync them with leaf_streams.
     task.stash_current_streams();
   }
+
+  if (cache_key) {
+    CachedGraphSchedule entry;
+    entry.roots.reserve(root_edges.size());
+    for (const auto& edge : root_edges) {
+      entry.roots.emplace_back(edge.function);
+    }
+    entry.min_topo_nr = min_topo_nr;
+    entry.dependencies.assign(
+        task.dependencies_.begin(), task.dependencies_.end());
+    entry.nodes.assign(task.nodes_in_graph_.begin(), task.nodes_in_graph_.end());
+    entry.will_use_cuda = will_use_cuda;
+
+    std::lock_guard<std::mutex> lock(schedule_cache_mutex);
+    if (schedule_cache.size() >= kMaxCachedSchedules) {
+      for (auto it = schedule_cache.begin(); it != schedule_cache.end();) {
+        it = it->second.roots.front().expired() ? schedule_cache.erase(it)
+                                                : std::next(it);
+      }
+      if (schedule_cache.size() >= kMaxCachedSchedules) {
+        schedule_cache.clear();
+      }
+    }
+    schedule_cache[cache_key] = std::move(entry);
+  }
 }
 
 auto Engine::execute(
@@ -1388,6 +1549,32 @@ auto Engine::ready_queue_by_index(
   }
 }
 
+// Number of worker threads consuming each device ready queue.  The default
+// of one thread per device keeps the historical deterministic execution
+// order.  Setting TORCH_AUTOGRAD_THREADS_PER_DEVICE=N lets independent
+// branches of a graph task execute concurrently on one device, which helps
+// graphs with thousands of small backward nodes; all GraphTask bookkeeping
+// (dependencies, not-ready buffers, outstanding task counts) is already
+// synchronized, so correctness does not depend on a single consumer, but
+// per-device execution order becomes nondeterministic.
+size_t Engine::num_threads_per_device() {
+  static size_t value = []() -> size_t {
+    auto env = getenv("TORCH_AUTOGRAD_THREADS_PER_DEVICE");
+    if (!env) {
+      return 1;
+    }
+    auto parsed = std::atoi(env);
+    if (parsed < 1) {
+      TORCH_WARN(
+          "ignoring invalid value for TORCH_AUTOGRAD_THREADS_PER_DEVICE: ",
+          env);
+      return 1;
+    }
+    return static_cast<size_t>(parsed);
+  }();
+  return value;
+}
+
 auto Engine::start_device_threads() -> void {
   // First always initialize the thread pool for re-entrant threads
   thread_pool_shared_ = std::make_shared<ThreadPoolShared>();
@@ -1420,15 +1607,20 @@ auto Engine::start_device_threads() -> void {
     queue = std::make_shared<ReadyQueue>();
   }
 
+  const auto threads_per_device = num_threads_per_device();
   for (const auto i : c10::irange(num_devices)) {
-    std::thread t(&Engine::thread_init, this, i, device_ready_queues_[i], true);
-    t.detach();
+    for (const auto j : c10::irange(threads_per_device)) {
+      (void)j;
+      std::thread t(
+          &Engine::thread_init, this, i, device_ready_queues_[i], true);
+      t.detach();
+    }
   }
   // Wait for the threads to start
   {
     std::unique_lock<std::mutex> lk(non_reentrant_device_thread_mutex_);
     while (non_reentrant_device_thread_count_.load() !=
-           static_cast<uint32_t>(num_devices)) {
+           static_cast<uint32_t>(num_devices * threads_per_device)) {
       non_reentrant_device_thread_condvar_.wait(lk);
     }
   }
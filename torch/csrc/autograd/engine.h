@@ -216,6 +216,9 @@ struct TORCH_API Engine {
   // start device threads (CUDA, XLA, etc.) in Engine,
   // note that it does NOT start CPU thread.
   void start_device_threads();
+  // number of worker threads consuming each device ready queue, 1 unless
+  // overridden with TORCH_AUTOGRAD_THREADS_PER_DEVICE (see engine.cpp)
+  static size_t num_threads_per_device();
   void increment_non_reentrant_thread_count();
   void decrement_non_reentrant_thread_count();
   virtual void thread_main(const std::shared_ptr<GraphTask>& task);
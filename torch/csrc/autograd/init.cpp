@@ -12,6 +12,7 @@
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/autograd/VariableTypeUtils.h>
 #include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/cpu_offload_saved_variable_hooks.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/profiler.h>
@@ -341,6 +342,24 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def("_enable_record_function", [](bool enable) {
     at::enableRecordFunction(enable);
   });
+  m.def("_enable_op_latency_histograms", [](bool enable) {
+    at::enableOperatorLatencyHistograms(enable);
+  });
+  m.def(
+      "_op_latency_histograms_enabled", at::operatorLatencyHistogramsEnabled);
+  m.def("_get_op_latency_stats", []() {
+    py::dict result;
+    for (const auto& entry : at::getOperatorLatencyStats()) {
+      py::dict stats;
+      stats["count"] = entry.second.count;
+      stats["p50_us"] = entry.second.p50_us;
+      stats["p90_us"] = entry.second.p90_us;
+      stats["p99_us"] = entry.second.p99_us;
+      result[py::str(entry.first)] = std::move(stats);
+    }
+    return result;
+  });
+  m.def("_clear_op_latency_stats", at::clearOperatorLatencyStats);
   m.def("_set_empty_test_observer", [](bool is_global, double sampling_prob) {
     auto cb =
         at::RecordFunctionCallback(nullptr).needsInputs(true).samplingProb(
@@ -369,6 +388,12 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
   m.def("_pop_saved_tensors_default_hooks", []() {
     torch::autograd::PyDefaultSavedVariableHooks::pop_hooks();
   });
+  m.def(
+      "_saved_tensors_cpu_offload_set_enabled",
+      torch::autograd::CpuOffloadSavedVariableHooks::set_enabled);
+  m.def(
+      "_saved_tensors_cpu_offload_is_enabled",
+      torch::autograd::CpuOffloadSavedVariableHooks::is_enabled);
 
   _C_m.def(
       "_register_py_class_for_device",
@@ -645,6 +670,32 @@ static PyObject* is_anomaly_check_nan_enabled(
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject* set_sampled_anomaly_mode_enabled(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK(
+      PyBool_Check(arg),
+      "enabled must be a bool (got ",
+      Py_TYPE(arg)->tp_name,
+      ")");
+  SampledAnomalyMode::set_enabled(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* is_sampled_anomaly_mode_enabled(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  if (SampledAnomalyMode::is_enabled()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject* python_enter_dual_level(PyObject* _unused, PyObject* arg) {
   HANDLE_TH_ERRORS
   // It is unlikely that the depth of forward nesting will overflow int64_t so
@@ -689,6 +740,10 @@ static PyObject* push_on_torch_function_stack(
   HANDLE_TH_ERRORS
   if (arg != Py_None) {
     Py_INCREF(arg);
+    // Modes dispatch __torch_function__ for any argument, so they turn
+    // off the override fast path (see Note [Torch function override fast
+    // path]).
+    torch::note_torch_function_override();
     at::impl::PythonTorchFunctionTLS::push_onto_stack(
         std::make_shared<c10::SafePyObject>(arg, getPyInterpreter()));
   }
@@ -837,6 +892,14 @@ static PyMethodDef methods[] = { // NOLINT
      is_anomaly_check_nan_enabled,
      METH_NOARGS,
      nullptr},
+    {"_set_sampled_anomaly_enabled",
+     set_sampled_anomaly_mode_enabled,
+     METH_O,
+     nullptr},
+    {"_is_sampled_anomaly_enabled",
+     is_sampled_anomaly_mode_enabled,
+     METH_NOARGS,
+     nullptr},
     {"_enter_dual_level", python_enter_dual_level, METH_NOARGS, nullptr},
     {"_exit_dual_level",
      castPyCFunctionWithKeywords(python_exit_dual_level),
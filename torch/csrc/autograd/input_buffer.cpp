@@ -1,5 +1,6 @@
 #include <torch/csrc/autograd/input_buffer.h>
 
+#include <ATen/ATen.h>
 #include <ATen/CachedTensorUtils.h>
 #include <ATen/LegacyBatchedTensorImpl.h>
 #include <ATen/SparseCsrTensorUtils.h>
@@ -12,6 +13,7 @@
 #include <c10/core/Event.h>
 #include <c10/core/StreamGuard.h>
 #include <c10/util/Optional.h>
+#include <c10/util/irange.h>
 
 #include <cstddef>
 #include <utility>
@@ -82,6 +84,17 @@ bool can_accumulate_inplace(const Variable& v) {
       at::caching::adjusted_use_count(v) == 1 && v.has_storage() &&
       v.storage().use_count() == 1);
 }
+
+// Whether the merge of `var` into `old_var` can be held back and batched with
+// the other arrivals for this position. Restricted to the cases where the
+// deferred tree reduction is trivially equivalent to immediate accumulation:
+// no graph is being recorded, both sides are stock dense tensors, and `var`
+// can be consumed in place by the reduction.
+bool can_defer_accumulation(const Variable& old_var, const Variable& var) {
+  return !at::GradMode::is_enabled() && !old_var.is_sparse() &&
+      !old_var.is_sparse_csr() && !at::isTensorSubclassLike(old_var) &&
+      can_accumulate_inplace(var);
+}
 } // anonymous namespace
 
 static void accumulate(
@@ -206,7 +219,25 @@ void InputBuffer::add(
   auto& old_var = buffer[pos];
   if (!old_var.defined()) {
     buffer[pos] = std::move(var);
+  } else if (
+      can_defer_accumulation(old_var, var) &&
+      (pending_.empty() || pending_[pos].empty() ||
+       pending_streams_[pos] == opt_accumulate_stream)) {
+    // Hold the merge back so all the arrivals for this position can be
+    // reduced with a handful of batched _foreach_add_ launches in flush()
+    // rather than one add kernel each. The stream synchronization above has
+    // already run, so it is enough to remember which stream the accumulation
+    // was pinned to.
+    if (pending_.empty()) {
+      pending_.resize(buffer.size());
+      pending_streams_.resize(buffer.size());
+    }
+    pending_streams_[pos] = opt_accumulate_stream;
+    pending_[pos].emplace_back(std::move(var));
   } else {
+    // Merge order doesn't matter (addition commutes), but flush first so the
+    // use-count checks in accumulate() see every reference.
+    flush_pos(pos);
     if (opt_accumulate_stream) {
       c10::OptionalStreamGuard stream_guard{opt_accumulate_stream};
       accumulate(buffer, pos, std::move(var));
@@ -219,6 +250,41 @@ void InputBuffer::add(
   }
 }
 
+void InputBuffer::flush_pos(size_t pos) {
+  if (pending_.empty() || pending_[pos].empty()) {
+    return;
+  }
+  auto& vars = pending_[pos];
+  at::NoGradGuard no_grad;
+  c10::OptionalStreamGuard stream_guard{pending_streams_[pos]};
+  c10::OptionalDeviceGuard device_guard{device_of(vars.front())};
+  // Pairwise tree reduction: each round folds the second half into the first
+  // with a single batched launch, so N arrivals cost ~log2(N) launches.
+  while (vars.size() > 1) {
+    const auto half = vars.size() / 2;
+    at::_foreach_add_(
+        at::TensorList(vars.data(), half),
+        at::TensorList(vars.data() + half, half));
+    if (vars.size() % 2 == 1) {
+      vars[half] = std::move(vars.back());
+      vars.resize(half + 1);
+    } else {
+      vars.resize(half);
+    }
+  }
+  accumulate(buffer, pos, std::move(vars.front()));
+  vars.clear();
+}
+
+void InputBuffer::flush() {
+  if (pending_.empty()) {
+    return;
+  }
+  for (const auto pos : c10::irange(buffer.size())) {
+    flush_pos(pos);
+  }
+}
+
 auto InputBuffer::device() const -> at::Device {
   // Since we pick the first non-CPU tensor, this won't work with
   // mixed device-type operations (e.g., an op that is both CUDA
@@ -238,6 +304,7 @@ auto InputBuffer::device() const -> at::Device {
 }
 
 auto InputBuffer::variables(InputBuffer&& g) -> std::vector<Variable> {
+  g.flush();
   std::vector<Variable> result = std::move(g.buffer);
   return result;
 }
@@ -26,6 +26,8 @@ struct InputBuffer {
   // Accumulates the variable at a specified index.
   // The optional CUDA streams determine which stream the accumulation
   // is run on and how the addition is synchronized.
+  // Accumulations past the first arrival may be deferred and batched; they
+  // are materialized into `buffer` by flush() / variables().
   void add(
       size_t pos,
       Variable&& var,
@@ -35,13 +37,28 @@ struct InputBuffer {
   at::Device device() const;
 
   Variable operator[](size_t pos) {
+    flush_pos(pos);
     return buffer[pos];
   }
 
+  // Completes any deferred accumulations. Called by variables(); only needed
+  // when reading `buffer` directly.
+  void flush();
+
   // Returns the inputs as a list of variables. Destroys given InputBuffer.
   static std::vector<Variable> variables(InputBuffer&& g);
 
   std::vector<Variable> buffer;
+
+ private:
+  void flush_pos(size_t pos);
+
+  // Gradients that arrived after the first for a position, held back so the
+  // merge can run as a batched tree reduction (_foreach_add_) instead of one
+  // add kernel per arrival, and the streams their accumulation was pinned to
+  // by add(). Both are empty until a merge is actually deferred.
+  std::vector<std::vector<Variable>> pending_;
+  std::vector<c10::optional<c10::Stream>> pending_streams_;
 };
 
 } // namespace autograd
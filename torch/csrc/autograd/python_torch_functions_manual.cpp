@@ -147,6 +147,15 @@ static PyObject* THPVariable_from_numpy(PyObject* module, PyObject* arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject* THPVariable__from_numpy_consume(
+    PyObject* module,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  jit::tracer::warn("torch._from_numpy_consume", jit::tracer::WARN_CONSTRUCTOR);
+  return THPVariable_Wrap(torch::utils::tensor_from_numpy_consume(arg));
+  END_HANDLE_TH_ERRORS
+}
+
 static Tensor dispatch_nonzero(const Tensor& self) {
   pybind11::gil_scoped_release no_gil;
   OptionalDeviceGuard device_guard(device_of(self));
@@ -505,6 +514,10 @@ static PyMethodDef torch_functions_manual[] = {
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      nullptr},
     {"from_numpy", THPVariable_from_numpy, METH_STATIC | METH_O, nullptr},
+    {"_from_numpy_consume",
+     THPVariable__from_numpy_consume,
+     METH_STATIC | METH_O,
+     nullptr},
     {"frombuffer",
      castPyCFunctionWithKeywords(THPVariable_frombuffer),
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
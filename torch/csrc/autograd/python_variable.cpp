@@ -26,6 +26,7 @@
 #include <torch/csrc/tensor/python_tensor.h>
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/utils/pycfunction_helpers.h>
+#include <torch/csrc/utils/disable_torch_function.h>
 #include <torch/csrc/utils/pyobject_preservation.h>
 #include <torch/csrc/utils/python_arg_parser.h>
 #include <torch/csrc/utils/python_dispatch.h>
@@ -40,6 +41,7 @@
 #include <c10/core/SymIntArrayRef.h>
 #include <structmember.h>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <utility>
@@ -1780,6 +1782,13 @@ static PyObject* THPVariable_NewWithVar(
       "Creating a Tensor subclass from a class ",
       "that does not inherit from Tensor is not possible. Make sure your class inherits from Tensor.");
 
+  // A live subclass instance is the first chance for __torch_function__
+  // dispatch, so it turns off the override fast path (see Note [Torch
+  // function override fast path]).
+  if (reinterpret_cast<PyObject*>(type) != THPVariableClass) {
+    torch::note_torch_function_override_from_type(type);
+  }
+
   // This function overwrite the Tensor's pyobj field without extra checks
   // Make sure it is not set otherwise we would leak memory
   auto mb_obj =
@@ -2046,6 +2055,77 @@ static int THPVariable_subclass_traverse(
   return 0;
 }
 
+// Note [THPVariable wrapper freelist]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every tensor returned to Python allocates a THPVariable wrapper through
+// CPython's GC allocator and frees it again when the wrapper dies; at
+// millions of short-lived wrappers per second tp_alloc shows up prominently
+// in profiles. Tensor subclasses created through the metaclass therefore get
+// tp_alloc/tp_free overrides backed by a bounded per-thread freelist of
+// instance blocks (GC header included, which is why blocks are recycled via
+// tp_free instead of PyObject_GC_Del and re-tracked on reuse). On reuse the
+// block is zeroed and we replay exactly what PyType_GenericAlloc would have
+// done: take an owning reference to the (heap) type, set refcount 1 and
+// re-track with the GC. Only fixed-size instances participate and the pool
+// holds a single block size -- established by the first freed wrapper, in
+// practice torch.Tensor instances -- anything else falls through to the
+// default allocator. Alloc and free always run under the GIL, but on
+// whichever thread drops the last reference, so blocks may migrate between
+// per-thread pools; both sides stay bounded.
+namespace {
+
+constexpr size_t kVariableWrapperPoolMaxSize = 1024;
+
+struct VariableWrapperPool {
+  std::vector<void*> blocks;
+  // Established by the first block that enters the pool.
+  Py_ssize_t block_size = 0;
+};
+
+VariableWrapperPool& variable_wrapper_pool() {
+  static thread_local VariableWrapperPool pool;
+  return pool;
+}
+
+} // namespace
+
+static PyObject* THPVariable_subclass_alloc(
+    PyTypeObject* type,
+    Py_ssize_t nitems) {
+  auto& pool = variable_wrapper_pool();
+  const Py_ssize_t size = _PyObject_VAR_SIZE(type, nitems);
+  if (nitems == 0 && !pool.blocks.empty() && size == pool.block_size) {
+    auto* obj = (PyObject*)pool.blocks.back();
+    pool.blocks.pop_back();
+    memset(obj, 0, size);
+    // Mirror PyType_GenericAlloc for a GC heap type: the type reference is
+    // owning and freshly allocated instances start out tracked.
+    Py_INCREF(type);
+    obj->ob_refcnt = 1;
+    obj->ob_type = type;
+    PyObject_GC_Track(obj);
+    return obj;
+  }
+  return PyType_GenericAlloc(type, nitems);
+}
+
+static void THPVariable_subclass_free(void* self) {
+  PyTypeObject* type = Py_TYPE((PyObject*)self);
+  if (type->tp_itemsize == 0) {
+    auto& pool = variable_wrapper_pool();
+    const Py_ssize_t size = _PyObject_VAR_SIZE(type, 0);
+    if (pool.block_size == 0) {
+      pool.block_size = size;
+    }
+    if (size == pool.block_size &&
+        pool.blocks.size() < kVariableWrapperPoolMaxSize) {
+      pool.blocks.push_back(self);
+      return;
+    }
+  }
+  PyObject_GC_Del(self);
+}
+
 int THPVariableMetaType_init(PyObject* cls, PyObject* args, PyObject* kwargs) {
   if (PyType_Type.tp_init(cls, args, kwargs) < 0) {
     return -1;
@@ -2053,6 +2133,9 @@ int THPVariableMetaType_init(PyObject* cls, PyObject* args, PyObject* kwargs) {
   ((PyTypeObject*)cls)->tp_dealloc = (destructor)THPVariable_subclass_dealloc;
   ((PyTypeObject*)cls)->tp_traverse =
       (traverseproc)THPVariable_subclass_traverse;
+  // See Note [THPVariable wrapper freelist]
+  ((PyTypeObject*)cls)->tp_alloc = THPVariable_subclass_alloc;
+  ((PyTypeObject*)cls)->tp_free = THPVariable_subclass_free;
   return 0;
 }
 
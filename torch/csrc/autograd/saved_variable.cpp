@@ -1,6 +1,7 @@
 #include <torch/csrc/autograd/saved_variable.h>
 
 #include <torch/csrc/autograd/anomaly_mode.h>
+#include <torch/csrc/autograd/cpu_offload_saved_variable_hooks.h>
 #include <torch/csrc/autograd/edge.h>
 #include <torch/csrc/autograd/engine.h>
 #include <torch/csrc/autograd/function.h>
@@ -109,7 +110,13 @@ void SavedVariable::save_metadata(const Variable& data) {
 }
 
 std::unique_ptr<SavedVariableHooks> SavedVariable::get_default_hooks() {
-  return Engine::get_default_engine().get_default_saved_variable_hooks();
+  auto hooks = Engine::get_default_engine().get_default_saved_variable_hooks();
+  // User-registered default hooks take precedence over the native CPU
+  // offload mode.
+  if (!hooks && CpuOffloadSavedVariableHooks::is_enabled()) {
+    hooks = std::make_unique<CpuOffloadSavedVariableHooks>();
+  }
+  return hooks;
 }
 
 void SavedVariable::reset_data() {
@@ -108,6 +108,8 @@ struct CUDAPluggableAllocator
       bool alloc_trace_record_context) override;
   virtual void attachOutOfMemoryObserver(
       c10::cuda::CUDACachingAllocator::OutOfMemoryObserver observer) override;
+  virtual void attachAllocatorTraceTracker(
+      c10::cuda::CUDACachingAllocator::AllocatorTraceTracker tracker) override;
   virtual std::shared_ptr<c10::cuda::CUDACachingAllocator::AllocatorState>
   getCheckpointState(int device, at::cuda::MempoolId_t id) override;
   virtual c10::cuda::CUDACachingAllocator::CheckpointDelta
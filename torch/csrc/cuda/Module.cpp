@@ -18,9 +18,12 @@
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGeneratorImpl.h>
 #include <ATen/cuda/CachingHostAllocator.h>
+#include <ATen/cuda/DeferredLaunchBatcher.h>
+#include <ATen/cuda/P2PCopyScheduler.h>
 #include <ATen/cuda/Sleep.h>
 #include <ATen/cuda/detail/CUDAHooks.h>
 #include <ATen/cuda/jiterator.h>
+#include <ATen/native/cuda/Copy.h>
 #include <c10/core/StorageImpl.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAFunctions.h>
@@ -32,11 +35,13 @@
 #include <c10/util/CallOnce.h>
 #include <c10/util/irange.h>
 
+#include <torch/cuda.h>
 #include <torch/csrc/CudaIPCTypes.h>
 #include <torch/csrc/Generator.h>
 #include <torch/csrc/cuda/CUDAPluggableAllocator.h>
 #include <torch/csrc/cuda/THCP.h>
 #include <torch/csrc/cuda/python_comm.h>
+#include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/profiler/python/combined_traceback.h>
 #include <torch/csrc/python_headers.h>
 #include <torch/csrc/utils/cuda_lazy_init.h>
@@ -293,6 +298,104 @@ PyObject* THCPModule_cudaHostAllocator(PyObject* _unused, PyObject* noargs) {
   END_HANDLE_TH_ERRORS
 }
 
+PyObject* THCPModule_hostAllocatorPreallocate(
+    PyObject* _unused,
+    PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* nbytes_o = nullptr;
+  PyObject* count_o = nullptr;
+  if (!PyArg_ParseTuple(args, "OO", &nbytes_o, &count_o)) {
+    THPUtils_invalidArguments(
+        args,
+        nullptr,
+        "_cuda_hostAllocatorPreallocate",
+        1,
+        "(int nbytes, int count)");
+    return nullptr;
+  }
+  auto nbytes = PyLong_AsSsize_t(nbytes_o);
+  auto count = PyLong_AsSsize_t(count_o);
+  TORCH_CHECK(nbytes >= 0 && count >= 0, "nbytes and count must be >= 0");
+  {
+    pybind11::gil_scoped_release no_gil;
+    at::cuda::CachingHostAllocator_preallocate(nbytes, count);
+  }
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THCPModule_asyncCopyToHost(PyObject* _unused, PyObject* arg) {
+  HANDLE_TH_ERRORS
+  THPUtils_assert(
+      THPVariable_Check(arg), "invalid argument to _cuda_asyncCopyToHost");
+  const auto& src = THPVariable_Unpack(arg);
+  c10::intrusive_ptr<c10::ivalue::Future> future;
+  {
+    pybind11::gil_scoped_release no_gil;
+    future = at::native::async_copy_to_host(src);
+  }
+  return py::cast(std::make_shared<torch::jit::PythonFutureWrapper>(
+                      std::move(future)))
+      .release()
+      .ptr();
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THCPModule_hostMemoryStats(PyObject* _unused, PyObject* noargs) {
+  HANDLE_TH_ERRORS
+
+  const auto stats = at::cuda::CachingHostAllocator_getStats();
+
+  py::dict result;
+  result["allocated_bytes"] = stats.allocated_bytes;
+  result["cached_bytes"] = stats.cached_bytes;
+  result["num_host_alloc"] = stats.num_host_alloc;
+  result["num_host_free"] = stats.num_host_free;
+
+  py::list size_classes;
+  for (const auto& cls : stats.size_classes) {
+    py::dict entry;
+    entry["block_size"] = cls.block_size;
+    entry["allocated_blocks"] = cls.allocated_blocks;
+    entry["allocated_bytes"] = cls.allocated_bytes;
+    entry["cached_blocks"] = cls.cached_blocks;
+    entry["cached_bytes"] = cls.cached_bytes;
+    size_classes.append(entry);
+  }
+  result["size_classes"] = size_classes;
+
+  return result.release().ptr();
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THCPModule_hostAllocatorSetCacheLimit(
+    PyObject* _unused,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  THPUtils_assert(
+      THPUtils_checkLong(arg),
+      "invalid argument to _cuda_hostAllocatorSetCacheLimit");
+  auto bytes = PyLong_AsSsize_t(arg);
+  TORCH_CHECK(bytes >= 0, "cache limit must be >= 0");
+  at::cuda::CachingHostAllocator_setSizeClassCacheLimit(bytes);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject* THCPModule_hostAllocatorTrim(PyObject* _unused, PyObject* arg) {
+  HANDLE_TH_ERRORS
+  THPUtils_assert(
+      THPUtils_checkDouble(arg), "invalid argument to _cuda_hostAllocatorTrim");
+  const double max_idle_seconds = THPUtils_unpackDouble(arg);
+  TORCH_CHECK(max_idle_seconds >= 0, "max_idle_seconds must be >= 0");
+  {
+    pybind11::gil_scoped_release no_gil;
+    at::cuda::CachingHostAllocator_trim(max_idle_seconds);
+  }
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THCPModule_cudaCachingAllocator_raw_alloc(
     PyObject* _unused,
     PyObject* args) {
@@ -417,6 +520,76 @@ PyObject* THCPModule_cudaJiteratorCompileAndLaunchKernel(
   END_HANDLE_TH_ERRORS
 }
 
+// Pre-compiles the kernels the jiterator callable would otherwise build at
+// first call. See jiterator.py for more details
+PyObject* THCPModule_cudaJiteratorPrewarmKernel(
+    PyObject* _unused,
+    PyObject* args) {
+  HANDLE_TH_ERRORS
+
+  PyObject* code_string_o = nullptr;
+  PyObject* kernel_name_o = nullptr;
+  PyObject* return_by_ref_o = nullptr;
+  PyObject* num_inputs_o = nullptr;
+  PyObject* num_outputs_o = nullptr;
+  PyObject* dtypes_o = nullptr;
+  PyObject* kwargs_o = nullptr;
+  if (!PyArg_ParseTuple(
+          args,
+          "OOOOOO|O",
+          &code_string_o,
+          &kernel_name_o,
+          &return_by_ref_o,
+          &num_inputs_o,
+          &num_outputs_o,
+          &dtypes_o,
+          &kwargs_o)) {
+    return nullptr;
+  }
+
+  const std::string code_string = THPUtils_unpackString(code_string_o);
+  const std::string kernel_name = THPUtils_unpackString(kernel_name_o);
+  const bool return_by_ref = THPUtils_unpackBool(return_by_ref_o);
+  const int num_inputs = static_cast<int>(THPUtils_unpackLong(num_inputs_o));
+  const int num_outputs = static_cast<int>(THPUtils_unpackLong(num_outputs_o));
+
+  THPUtils_assert(
+      PyTuple_Check(dtypes_o),
+      "dtypes argument is expected to "
+      "be a tuple, but got %s",
+      THPUtils_typename(dtypes_o));
+  Py_ssize_t num_dtypes = PyTuple_GET_SIZE(dtypes_o);
+
+  c10::SmallVector<at::ScalarType> dtypes;
+  for (const auto i : c10::irange(num_dtypes)) {
+    PyObject* _dtype = PyTuple_GET_ITEM(dtypes_o, i);
+    THPUtils_assert(
+        THPDtype_Check(_dtype), "%d of dtypes tuple is not a torch.dtype", i);
+
+    dtypes.emplace_back(reinterpret_cast<THPDtype*>(_dtype)->scalar_type);
+  }
+
+  c10::SmallVector<at::Scalar> extra_args;
+  PyObject* key = nullptr;
+  PyObject* value = nullptr;
+  Py_ssize_t pos = 0;
+  while (PyDict_Next(kwargs_o, &pos, &key, &value)) {
+    extra_args.emplace_back(as_scalar(value));
+  }
+
+  at::cuda::PrewarmKernel(
+      code_string,
+      kernel_name,
+      num_inputs,
+      num_outputs,
+      dtypes,
+      extra_args,
+      return_by_ref);
+
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject* THCPModule_cudaCachingAllocator_raw_delete(
     PyObject* _unused,
     PyObject* obj) {
@@ -445,6 +618,10 @@ PyObject* THCPModule_getAllocatorBackend(PyObject* _unused, PyObject* noargs) {
 
 PyObject* THCPModule_cudaSynchronize(PyObject* _unused, PyObject* noargs) {
   HANDLE_TH_ERRORS
+  // Submit any deferred launch segment accumulating on this thread before
+  // blocking, or the work we are about to wait for would never run. See
+  // Note [Deferred launch batching] in DeferredLaunchBatcher.h.
+  at::cuda::flushDeferredLaunchBatch();
   c10::cuda::device_synchronize();
   Py_RETURN_NONE;
   END_HANDLE_TH_ERRORS
@@ -926,6 +1103,22 @@ static void registerCudaDeviceProperties(PyObject* module) {
   m.def("_cudnn_set_conv_benchmark_empty_cache", [](bool enable) {
     return at::native::_cudnn_set_conv_benchmark_empty_cache(enable);
   });
+
+  py::class_<torch::cuda::Prefetcher>(m, "_CudaPrefetcher")
+      .def(
+          py::init<at::Device, size_t>(),
+          py::arg("device"),
+          py::arg("depth") = 2)
+      .def(
+          "put",
+          &torch::cuda::Prefetcher::put,
+          py::arg("source"),
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "get",
+          &torch::cuda::Prefetcher::get,
+          py::call_guard<py::gil_scoped_release>())
+      .def("size", &torch::cuda::Prefetcher::size);
 }
 
 // We choose to ignore certain blocks that are currently allocated
@@ -1166,6 +1359,94 @@ static void registerCudaPluggableAllocator(PyObject* module) {
     c10::cuda::CUDACachingAllocator::releasePool(device, mempool_id);
   });
 
+  m.def("_cuda_createUserPool", [](int device, const std::string& name) {
+    return c10::cuda::CUDACachingAllocator::createUserPool(device, name);
+  });
+
+  m.def(
+      "_cuda_attachCurrentStreamToPool",
+      [](int device, at::cuda::MempoolId_t mempool_id) {
+        auto stream = at::cuda::getCurrentCUDAStream(device);
+        c10::cuda::CUDACachingAllocator::attachPoolToStream(
+            device, stream, mempool_id);
+      });
+
+  m.def("_cuda_detachCurrentStreamFromPool", [](int device) {
+    auto stream = at::cuda::getCurrentCUDAStream(device);
+    c10::cuda::CUDACachingAllocator::detachPoolFromStream(device, stream);
+  });
+
+  m.def(
+      "_cuda_setPoolMemoryCap",
+      [](int device, at::cuda::MempoolId_t mempool_id, size_t cap_bytes) {
+        c10::cuda::CUDACachingAllocator::setPoolMemoryCap(
+            device, mempool_id, cap_bytes);
+      });
+
+  m.def(
+      "_cuda_getPoolStats",
+      [](int device, at::cuda::MempoolId_t mempool_id) {
+        const auto stats =
+            c10::cuda::CUDACachingAllocator::getPoolStats(device, mempool_id);
+        const auto statToDict =
+            [](const c10::cuda::CUDACachingAllocator::Stat& stat) {
+              py::dict dict;
+              dict["current"] = stat.current;
+              dict["peak"] = stat.peak;
+              dict["allocated"] = stat.allocated;
+              dict["freed"] = stat.freed;
+              return dict;
+            };
+        py::dict result;
+        result["allocations"] = statToDict(stats.allocations);
+        result["segments"] = statToDict(stats.segments);
+        result["allocated_bytes"] = statToDict(stats.allocated_bytes);
+        result["reserved_bytes"] = statToDict(stats.reserved_bytes);
+        return result;
+      });
+
+  // Deferred launch batching, see Note [Deferred launch batching] in
+  // DeferredLaunchBatcher.h. Per-thread: each call affects the batcher of
+  // the calling thread only.
+  m.def("_cuda_beginDeferredLaunchBatch", [](size_t flush_threshold) {
+    at::cuda::beginDeferredLaunchBatch(flush_threshold);
+  });
+  m.def("_cuda_noteDeferredLaunchOp", []() {
+    at::cuda::noteDeferredLaunchOp();
+  });
+  m.def("_cuda_flushDeferredLaunchBatch", []() {
+    at::cuda::flushDeferredLaunchBatch();
+  });
+  m.def("_cuda_deferredLaunchBatchActive", []() {
+    return at::cuda::deferredLaunchBatchActive();
+  });
+
+  // Topology-aware peer-to-peer copies, see Note [P2P copy scheduler] in
+  // P2PCopyScheduler.h.
+  m.def("_cuda_p2pCopy", [](const at::Tensor& dst, const at::Tensor& src) {
+    pybind11::gil_scoped_release no_gil;
+    at::cuda::p2p_copy(dst, src);
+  });
+  m.def("_cuda_p2pPerformanceRank", [](int src_device, int dst_device) {
+    return at::cuda::p2p_performance_rank(src_device, dst_device);
+  });
+  m.def("_cuda_p2pCopyStats", []() {
+    py::list result;
+    for (const auto& stats : at::cuda::p2p_copy_stats()) {
+      py::dict dict;
+      dict["src_device"] = stats.src_device;
+      dict["dst_device"] = stats.dst_device;
+      dict["direct_bytes"] = stats.direct_bytes;
+      dict["staged_bytes"] = stats.staged_bytes;
+      dict["transfers"] = stats.transfers;
+      result.append(dict);
+    }
+    return result;
+  });
+  m.def("_cuda_resetP2PCopyStats", []() {
+    at::cuda::reset_p2p_copy_stats();
+  });
+
   m.def(
       "_cuda_checkPoolLiveAllocations",
       [](int device,
@@ -1442,6 +1723,20 @@ static struct PyMethodDef _THCPModule_methods[] = {
      THCPModule_cudaHostAllocator,
      METH_NOARGS,
      nullptr},
+    {"_cuda_hostAllocatorPreallocate",
+     THCPModule_hostAllocatorPreallocate,
+     METH_VARARGS,
+     nullptr},
+    {"_cuda_asyncCopyToHost", THCPModule_asyncCopyToHost, METH_O, nullptr},
+    {"_cuda_hostMemoryStats", THCPModule_hostMemoryStats, METH_NOARGS, nullptr},
+    {"_cuda_hostAllocatorSetCacheLimit",
+     THCPModule_hostAllocatorSetCacheLimit,
+     METH_O,
+     nullptr},
+    {"_cuda_hostAllocatorTrim",
+     THCPModule_hostAllocatorTrim,
+     METH_O,
+     nullptr},
     {"_cuda_cudaCachingAllocator_raw_alloc",
      THCPModule_cudaCachingAllocator_raw_alloc,
      METH_VARARGS,
@@ -1475,6 +1770,10 @@ static struct PyMethodDef _THCPModule_methods[] = {
      THCPModule_cudaJiteratorCompileAndLaunchKernel,
      METH_VARARGS,
      nullptr},
+    {"_cuda_jiterator_prewarm_kernel",
+     THCPModule_cudaJiteratorPrewarmKernel,
+     METH_VARARGS,
+     nullptr},
     {"_cuda_get_cudnn_benchmark_limit",
      THCPModule_benchmarkLimitCuDNN,
      METH_NOARGS,
@@ -160,6 +160,24 @@ class TORCH_API Backend : public torch::CustomClassHolder {
             " does not support allgather_into_tensor_coalesced"));
   }
 
+  // Chunked, streaming variant of `allgather_into_tensor`: each
+  // (outputs[i], inputs[i]) pair is gathered as an independent chunk and gets
+  // its own Work, whose future completes as soon as that chunk has landed.
+  // All chunks are enqueued back-to-back from this one call, so a consumer
+  // (e.g. ZeRO-style sharded training) can overlap the gather of layer i+1
+  // with compute that only waits on layer i's Work.
+  virtual std::vector<c10::intrusive_ptr<Work>> allgather_streamed(
+      std::vector<at::Tensor>& /* outputs */,
+      std::vector<at::Tensor>& /* inputs */,
+      const AllgatherOptions& /* opts */ = AllgatherOptions()) {
+    TORCH_CHECK(
+        false,
+        c10::str(
+            "Backend ",
+            getBackendName(),
+            " does not support allgather_streamed"));
+  }
+
   virtual c10::intrusive_ptr<Work> gather(
       std::vector<std::vector<at::Tensor>>& /* outputTensors */,
       std::vector<at::Tensor>& /* inputTensors */,
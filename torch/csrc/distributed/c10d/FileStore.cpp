@@ -14,6 +14,12 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <functional>
@@ -273,6 +279,104 @@ off_t refresh(
   return pos;
 }
 
+// Waiters back off exponentially between polls so that idle workers in a
+// large job don't hammer the (possibly shared) filesystem with metadata
+// operations. The initial interval matches the historical fixed 10ms poll,
+// so small jobs see the same latency as before.
+constexpr std::chrono::milliseconds kPollIntervalStart(10);
+constexpr std::chrono::milliseconds kPollIntervalMax(250);
+
+std::chrono::milliseconds nextPollInterval(std::chrono::milliseconds current) {
+  return std::min(current * 2, kPollIntervalMax);
+}
+
+// Returns the size of the file at `path`, or -1 if it doesn't exist.
+// Since records are only ever appended, an unchanged size means there is
+// nothing new to read, so waiters can skip opening and locking the file.
+off_t fileSizeFor(const std::string& path) {
+#ifdef _WIN32
+  struct _stat st {};
+  if (syscall(std::bind(::_stat, path.c_str(), &st)) != 0) {
+    return -1;
+  }
+#else
+  struct stat st {};
+  if (syscall([&] { return ::stat(path.c_str(), &st); }) != 0) {
+    return -1;
+  }
+#endif
+  return st.st_size;
+}
+
+// Watches the directory containing the store file so that waiters can be
+// woken as soon as a record is appended, instead of sleeping out their full
+// poll interval. inotify doesn't see writes made by remote hosts on shared
+// filesystems (such as NFS), so the watch is best effort only: when it can't
+// be set up, or events never arrive, callers still make progress through
+// their backoff polling and merely pay the extra latency.
+class FileWatch {
+ public:
+  explicit FileWatch(const std::string& path) {
+#ifdef __linux__
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+      return;
+    }
+    // Watch the parent directory rather than the file itself so that we
+    // also wake up when the file is first created.
+    const auto sep = path.rfind('/');
+    const auto dir = sep == std::string::npos ? "." : path.substr(0, sep);
+    wd_ = inotify_add_watch(
+        fd_, dir.c_str(), IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (wd_ < 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+#else
+    (void)path;
+#endif
+  }
+
+  ~FileWatch() {
+#ifdef __linux__
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+
+  FileWatch(const FileWatch&) = delete;
+  FileWatch& operator=(const FileWatch&) = delete;
+
+  // Sleeps for up to `delay`, returning early if the watched directory may
+  // have changed. Spurious wakeups are fine; the caller re-checks the file.
+  void waitFor(std::chrono::milliseconds delay) {
+#ifdef __linux__
+    if (fd_ >= 0) {
+      struct pollfd pfd {};
+      pfd.fd = fd_;
+      pfd.events = POLLIN;
+      const auto rv = ::poll(&pfd, 1, static_cast<int>(delay.count()));
+      if (rv > 0) {
+        // Drain queued events so the next poll blocks again.
+        char buf[4096];
+        while (::read(fd_, buf, sizeof(buf)) > 0) {
+        }
+      }
+      return;
+    }
+#endif
+    /* sleep override */
+    std::this_thread::sleep_for(delay);
+  }
+
+ private:
+#ifdef __linux__
+  int fd_{-1};
+  int wd_{-1};
+#endif
+};
+
 } // namespace
 
 FileStore::FileStore(std::string path, int numWorkers)
@@ -356,6 +460,7 @@ std::vector<uint8_t> FileStore::compareSet(
 
 std::vector<uint8_t> FileStore::get(const std::string& key) {
   std::string regKey = regularPrefix_ + key;
+  auto pollInterval = kPollIntervalStart;
   const auto start = std::chrono::steady_clock::now();
   while (true) {
     std::unique_lock<std::mutex> l(activeFileOpLock_);
@@ -377,7 +482,8 @@ std::vector<uint8_t> FileStore::get(const std::string& key) {
             " ms");
         TORCH_CHECK(false, err);
       }
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      std::this_thread::sleep_for(pollInterval);
+      pollInterval = nextPollInterval(pollInterval);
       continue;
     }
     // Always refresh since even though the key exists in the cache,
@@ -458,18 +564,27 @@ void FileStore::wait(const std::vector<std::string>& keys) {
 void FileStore::wait(
     const std::vector<std::string>& keys,
     const std::chrono::milliseconds& timeout) {
-  // Not using inotify because it doesn't work on many
-  // shared filesystems (such as NFS).
+  FileWatch watch(path_);
+  auto pollInterval = kPollIntervalStart;
+  // The size the file had when we last ran check(). Since the file is
+  // append-only, re-running check() is pointless until the size changes.
+  off_t checkedSize = -2;
   const auto start = std::chrono::steady_clock::now();
-  while (!check(keys)) {
+  while (true) {
+    const auto size = fileSizeFor(path_);
+    if (size != checkedSize) {
+      if (check(keys)) {
+        return;
+      }
+      checkedSize = size;
+    }
     const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::steady_clock::now() - start);
     if (timeout != kNoTimeout && elapsed > timeout) {
       TORCH_CHECK(false, "Wait timeout");
     }
-
-    /* sleep override */
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    watch.waitFor(pollInterval);
+    pollInterval = nextPollInterval(pollInterval);
   }
 }
 
@@ -7,6 +7,7 @@
 #include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 #include <chrono>
 #include <exception>
+#include <functional>
 #include <ratio>
 #include <tuple>
 
@@ -129,6 +130,123 @@ std::chrono::milliseconds getRemainingTime(
   return remainingMillis;
 }
 
+// Note [Event-driven send/recv completion]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// By default every outstanding send/recv completes on the thread that calls
+// wait() on it, blocking inside the gloo transport per work item. A parameter
+// server with 100+ outstanding sends then parks 100+ threads in the transport
+// and pays a per-op wakeup for every completion. When
+// TORCH_GLOO_EVENT_DRIVEN_WAIT=1, point-to-point works are instead handed to
+// a single process-wide completion poller. The poller cycles over all pending
+// buffers with short bounded waits, retires completed works through the
+// regular Work::finish machinery -- so wait() only blocks on the work's own
+// condition variable -- and enforces the process group timeout from a shared
+// deadline list it scans on the same cycle, instead of arming a timer per op.
+class CompletionPoller {
+ public:
+  struct PendingOp {
+    std::function<bool(std::chrono::milliseconds)> poll;
+    std::function<void()> expire;
+    steady_clock_time_point deadline;
+    bool hasDeadline;
+  };
+
+  static CompletionPoller& get() {
+    static CompletionPoller poller;
+    return poller;
+  }
+
+  void enqueue(PendingOp op) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ops_.push_back(std::move(op));
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  // Bound for a single buffer wait; keeps one full cycle over the pending
+  // list short enough that completions and deadlines are noticed promptly.
+  static constexpr std::chrono::milliseconds kPollSlice{1};
+
+  CompletionPoller() {
+    thread_ = std::thread(&CompletionPoller::run, this);
+  }
+
+  ~CompletionPoller() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+      if (ops_.empty()) {
+        cv_.wait(lock, [&] { return stop_ || !ops_.empty(); });
+        continue;
+      }
+      auto ops = std::move(ops_);
+      ops_.clear();
+      lock.unlock();
+
+      std::vector<PendingOp> pending;
+      pending.reserve(ops.size());
+      const auto now = std::chrono::steady_clock::now();
+      for (auto& op : ops) {
+        if (op.poll(kPollSlice)) {
+          continue;
+        }
+        if (op.hasDeadline && now >= op.deadline) {
+          op.expire();
+          continue;
+        }
+        pending.push_back(std::move(op));
+      }
+
+      lock.lock();
+      // Keep rough FIFO order so older ops are polled first.
+      ops_.insert(
+          ops_.begin(),
+          std::make_move_iterator(pending.begin()),
+          std::make_move_iterator(pending.end()));
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<PendingOp> ops_;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+constexpr std::chrono::milliseconds CompletionPoller::kPollSlice;
+
+// Deliberately not cached: the flag is only consulted when creating a
+// point-to-point work, and reading it per call keeps it testable.
+bool eventDrivenWaitEnabled() {
+  return parseEnvVarFlag("TORCH_GLOO_EVENT_DRIVEN_WAIT");
+}
+
+// Registers a point-to-point work with the completion poller. The lambdas
+// keep the work alive until it retires.
+template <typename WorkT>
+void registerWithPoller(
+    const c10::intrusive_ptr<WorkT>& work,
+    std::chrono::milliseconds timeout) {
+  CompletionPoller::PendingOp op;
+  op.poll = [work](std::chrono::milliseconds slice) {
+    return work->pollCompletion(slice);
+  };
+  op.expire = [work]() { work->finishTimeout(); };
+  op.hasDeadline = timeout > std::chrono::milliseconds::zero();
+  op.deadline = std::chrono::steady_clock::now() + timeout;
+  CompletionPoller::get().enqueue(std::move(op));
+}
+
 // Emit a LOG(ERROR) and throws using TORCH_CHECK with the given messages.
 void logAndThrow(
     const std::string& logMessage,
@@ -535,16 +653,37 @@ void ProcessGroupGloo::AsyncWork::finishWorkGloo() {
 
 ProcessGroupGloo::SendWork::SendWork(
     at::Tensor& tensor,
-    std::unique_ptr<::gloo::transport::UnboundBuffer> buffer)
+    std::unique_ptr<::gloo::transport::UnboundBuffer> buffer,
+    bool pollerManaged)
     : Work(
           -1,
           OpType::SEND,
           "gloo:send",
           c10::optional<std::vector<at::Tensor>>({tensor})),
       tensor_(tensor),
-      buffer_(std::move(buffer)) {}
+      buffer_(std::move(buffer)),
+      pollerManaged_(pollerManaged) {}
 
 bool ProcessGroupGloo::SendWork::wait(std::chrono::milliseconds timeout) {
+  if (pollerManaged_) {
+    // See Note [Event-driven send/recv completion]. Completion, errors and
+    // the group timeout are delivered by the completion poller; only block
+    // on the work state here instead of on the transport.
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (timeout == kNoTimeout) {
+      cv_.wait(lock, [&] { return completed_; });
+    } else {
+      cv_.wait_for(lock, timeout, [&] { return completed_; });
+    }
+    const bool done = completed_;
+    auto exception = exception_;
+    lock.unlock();
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+    return done && opSucceeded_.load();
+  }
+
   bool sendCompleted = false;
   std::exception_ptr exception{nullptr};
   try {
@@ -562,14 +701,45 @@ bool ProcessGroupGloo::SendWork::wait(std::chrono::milliseconds timeout) {
   return sendCompleted;
 }
 
+bool ProcessGroupGloo::SendWork::pollCompletion(
+    std::chrono::milliseconds slice) {
+  if (aborted_.load()) {
+    // Match the blocking path: an aborted wait completes the work without
+    // an exception.
+    finish();
+    return true;
+  }
+  bool sendCompleted = false;
+  std::exception_ptr exception{nullptr};
+  try {
+    sendCompleted = buffer_->waitSend(slice);
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  if (!sendCompleted && !exception) {
+    return false;
+  }
+  opSucceeded_.store(sendCompleted && !exception);
+  finish(exception);
+  return true;
+}
+
+void ProcessGroupGloo::SendWork::finishTimeout() {
+  buffer_->abortWaitSend();
+  finish(std::make_exception_ptr(std::runtime_error(
+      "Timed out waiting for send to complete")));
+}
+
 void ProcessGroupGloo::SendWork::abort() {
+  aborted_.store(true);
   buffer_->abortWaitSend();
 }
 
 ProcessGroupGloo::RecvWork::RecvWork(
     at::Tensor& tensor,
     std::unique_ptr<::gloo::transport::UnboundBuffer> buffer,
-    const char* profilingTitle)
+    const char* profilingTitle,
+    bool pollerManaged)
     : Work(
           -1,
           OpType::UNKNOWN,
@@ -577,7 +747,8 @@ ProcessGroupGloo::RecvWork::RecvWork(
           c10::optional<std::vector<at::Tensor>>({tensor})),
       tensor_(tensor),
       buffer_(std::move(buffer)),
-      srcRank_(-1) {}
+      srcRank_(-1),
+      pollerManaged_(pollerManaged) {}
 
 int ProcessGroupGloo::RecvWork::sourceRank() const {
   std::lock_guard<std::mutex> lock(mutex_);
@@ -585,6 +756,23 @@ int ProcessGroupGloo::RecvWork::sourceRank() const {
 }
 
 bool ProcessGroupGloo::RecvWork::wait(std::chrono::milliseconds timeout) {
+  if (pollerManaged_) {
+    // See Note [Event-driven send/recv completion].
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (timeout == kNoTimeout) {
+      cv_.wait(lock, [&] { return completed_; });
+    } else {
+      cv_.wait_for(lock, timeout, [&] { return completed_; });
+    }
+    const bool done = completed_;
+    auto exception = exception_;
+    lock.unlock();
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+    return done && opSucceeded_.load();
+  }
+
   bool recvCompleted = false;
   std::exception_ptr exception{nullptr};
   try {
@@ -602,7 +790,40 @@ bool ProcessGroupGloo::RecvWork::wait(std::chrono::milliseconds timeout) {
   return recvCompleted;
 }
 
+bool ProcessGroupGloo::RecvWork::pollCompletion(
+    std::chrono::milliseconds slice) {
+  if (aborted_.load()) {
+    finish();
+    return true;
+  }
+  bool recvCompleted = false;
+  std::exception_ptr exception{nullptr};
+  try {
+    int srcRank = -1;
+    recvCompleted = buffer_->waitRecv(&srcRank, slice);
+    if (recvCompleted) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      srcRank_ = srcRank;
+    }
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  if (!recvCompleted && !exception) {
+    return false;
+  }
+  opSucceeded_.store(recvCompleted && !exception);
+  finish(exception);
+  return true;
+}
+
+void ProcessGroupGloo::RecvWork::finishTimeout() {
+  buffer_->abortWaitRecv();
+  finish(std::make_exception_ptr(std::runtime_error(
+      "Timed out waiting for recv to complete")));
+}
+
 void ProcessGroupGloo::RecvWork::abort() {
+  aborted_.store(true);
   buffer_->abortWaitRecv();
 }
 
@@ -808,6 +1029,32 @@ std::shared_ptr<::gloo::Context> ProcessGroupGloo::getContext(uint32_t tag) {
   return contexts_[tag % contexts_.size()];
 }
 
+std::vector<std::shared_ptr<::gloo::Context>> ProcessGroupGloo::
+    getChunkContexts(size_t count) {
+  std::lock_guard<std::mutex> lock(chunkContextsMutex_);
+  while (chunkContexts_.size() < count) {
+    const auto i = chunkContexts_.size();
+    auto context = std::make_shared<::gloo::rendezvous::Context>(rank_, size_);
+    // Use a dedicated prefix so these rendezvous don't collide with the
+    // per-device contexts created in the constructor.
+    auto store = ::gloo::rendezvous::PrefixStore(
+        c10::str("chunk/", std::to_string(i)), *store_);
+    context->setTimeout(options_->timeout);
+    try {
+      context->connectFullMesh(
+          store, options_->devices[i % options_->devices.size()]);
+    } catch (const std::runtime_error& e) {
+      auto err = e.what();
+      // TORCH_CHECK to print the cpp stacktrace.
+      auto msg = c10::str("Gloo connectFullMesh failed with ", err);
+      logAndThrow(msg, msg);
+    }
+    chunkContexts_.push_back(std::move(context));
+  }
+  return std::vector<std::shared_ptr<::gloo::Context>>(
+      chunkContexts_.begin(), chunkContexts_.begin() + count);
+}
+
 void ProcessGroupGloo::runLoop(int workerIndex) {
   std::unique_lock<std::mutex> lock(workMutex_);
 
@@ -1033,6 +1280,97 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
   }
 };
 
+// Very large dense allreduces are split into chunks that run on separate
+// contexts in parallel, pipelining the reduction math of one chunk with the
+// transfer of the others. A single gloo ring can't saturate a fast NIC with
+// one I/O thread, so this trades a small amount of per-chunk latency for
+// bandwidth. The chunk count is a pure function of the tensor size and
+// therefore identical across ranks.
+constexpr size_t kChunkedAllreduceThresholdBytes = 256 * 1024 * 1024;
+constexpr size_t kChunkedAllreduceTargetChunkBytes = 128 * 1024 * 1024;
+constexpr size_t kChunkedAllreduceMaxChunks = 8;
+
+size_t computeAllreduceChunkCount(const std::vector<at::Tensor>& tensors) {
+  // Only single dense contiguous CPU inputs take the chunked path; those are
+  // the flattened buckets this optimization targets.
+  if (tensors.size() != 1 || !tensors[0].is_contiguous()) {
+    return 1;
+  }
+  const size_t bytes = tensors[0].numel() * tensors[0].element_size();
+  if (bytes < kChunkedAllreduceThresholdBytes) {
+    return 1;
+  }
+  return std::min(
+      kChunkedAllreduceMaxChunks,
+      (bytes + kChunkedAllreduceTargetChunkBytes - 1) /
+          kChunkedAllreduceTargetChunkBytes);
+}
+
+class AsyncAllreduceChunkedWork : public AsyncAllreduceWork {
+ public:
+  AsyncAllreduceChunkedWork(
+      std::vector<std::shared_ptr<gloo::Context>> chunkContexts,
+      const std::shared_ptr<gloo::Context>& context,
+      std::vector<at::Tensor>& inputs,
+      ReduceOp reduceOp,
+      uint32_t tag)
+      : AsyncAllreduceWork(context, inputs, reduceOp, tag),
+        chunkContexts_(std::move(chunkContexts)) {}
+
+  void run() override {
+    auto flat = inputs[0].view({-1});
+    const auto numel = flat.numel();
+    const auto numChunks = static_cast<int64_t>(chunkContexts_.size());
+    const int64_t chunkNumel = (numel + numChunks - 1) / numChunks;
+
+    std::mutex errorMutex;
+    std::exception_ptr firstError;
+    auto runChunk = [&](int64_t idx) {
+      try {
+        const int64_t begin = idx * chunkNumel;
+        const int64_t end = std::min(begin + chunkNumel, numel);
+        if (begin >= end) {
+          return;
+        }
+        std::vector<at::Tensor> chunk = {flat.slice(0, begin, end)};
+        allreduceChunk(chunkContexts_[idx], chunk);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!firstError) {
+          firstError = std::current_exception();
+        }
+      }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numChunks - 1);
+    for (int64_t idx = 1; idx < numChunks; idx++) {
+      workers.emplace_back(runChunk, idx);
+    }
+    runChunk(0);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (firstError) {
+      std::rethrow_exception(firstError);
+    }
+  }
+
+ private:
+  void allreduceChunk(
+      const std::shared_ptr<gloo::Context>& chunkContext,
+      std::vector<at::Tensor>& tensors) {
+    const auto& scalarType = tensors[0].scalar_type();
+    gloo::AllreduceOptions opts(chunkContext);
+    opts.setReduceFunction(getFunction(scalarType, reduceOp));
+    opts.setTag(tag);
+    GENERATE_ALL_TYPES(scalarType, setOutputs, opts, tensors);
+    gloo::allreduce(opts);
+  }
+
+  std::vector<std::shared_ptr<gloo::Context>> chunkContexts_;
+};
+
 class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
  public:
   AsyncAllreduceCoalescedWork(
@@ -1473,8 +1811,18 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::allreduce(
   auto context = getContext(tag);
   if (device.type() == at::kCPU) {
     if (layout == c10::kStrided) {
-      work = c10::make_intrusive<AsyncAllreduceWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+      const auto numChunks = computeAllreduceChunkCount(inputs);
+      if (numChunks > 1) {
+        work = c10::make_intrusive<AsyncAllreduceChunkedWork>(
+            getChunkContexts(numChunks),
+            std::move(context),
+            inputs,
+            opts.reduceOp,
+            tag);
+      } else {
+        work = c10::make_intrusive<AsyncAllreduceWork>(
+            std::move(context), inputs, opts.reduceOp, tag);
+      }
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceWork>(
           std::move(context), inputs, tag);
@@ -2631,7 +2979,12 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::send(
 
   // The work captures the tensor to prevent it being deallocated and
   // the unbound buffer to synchronize on completion of the send.
-  return c10::make_intrusive<SendWork>(tensor, std::move(buf));
+  const bool pollerManaged = eventDrivenWaitEnabled();
+  auto work = c10::make_intrusive<SendWork>(tensor, std::move(buf), pollerManaged);
+  if (pollerManaged) {
+    registerWithPoller(work, options_->timeout);
+  }
+  return work;
 }
 
 c10::intrusive_ptr<Work> ProcessGroupGloo::recv(
@@ -2650,7 +3003,13 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::recv(
 
   // The work captures the tensor to prevent it being deallocated and
   // the unbound buffer to synchronize on completion of the recv.
-  return c10::make_intrusive<RecvWork>(tensor, std::move(buf), "gloo:recv");
+  const bool pollerManaged = eventDrivenWaitEnabled();
+  auto work = c10::make_intrusive<RecvWork>(
+      tensor, std::move(buf), "gloo:recv", pollerManaged);
+  if (pollerManaged) {
+    registerWithPoller(work, options_->timeout);
+  }
+  return work;
 }
 
 c10::intrusive_ptr<Work> ProcessGroupGloo::recvAnysource(
@@ -2678,8 +3037,13 @@ c10::intrusive_ptr<Work> ProcessGroupGloo::recvAnysource(
 
   // The work captures the tensor to prevent it being deallocated and
   // the unbound buffer to synchronize on completion of the recv.
-  return c10::make_intrusive<RecvWork>(
-      tensor, std::move(buf), "gloo:recvAnySource");
+  const bool pollerManaged = eventDrivenWaitEnabled();
+  auto work = c10::make_intrusive<RecvWork>(
+      tensor, std::move(buf), "gloo:recvAnySource", pollerManaged);
+  if (pollerManaged) {
+    registerWithPoller(work, options_->timeout);
+  }
+  return work;
 }
 
 namespace {
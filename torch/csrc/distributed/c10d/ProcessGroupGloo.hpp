@@ -2,6 +2,7 @@
 
 #ifdef USE_C10D_GLOO
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -148,15 +149,30 @@ class TORCH_API ProcessGroupGloo : public Backend {
    public:
     explicit SendWork(
         at::Tensor& tensor,
-        std::unique_ptr<::gloo::transport::UnboundBuffer> buffer);
+        std::unique_ptr<::gloo::transport::UnboundBuffer> buffer,
+        bool pollerManaged = false);
 
     bool wait(std::chrono::milliseconds timeout = kNoTimeout) override;
 
     void abort() override;
 
+    // See Note [Event-driven send/recv completion]. Called only from the
+    // completion poller: attempts a short bounded wait on the buffer and
+    // finishes the work on completion. Returns true when the work retired.
+    bool pollCompletion(std::chrono::milliseconds slice);
+
+    // Called from the completion poller when the operation exceeded the
+    // process group timeout.
+    void finishTimeout();
+
    protected:
     at::Tensor tensor_;
     std::unique_ptr<::gloo::transport::UnboundBuffer> buffer_;
+    const bool pollerManaged_;
+    std::atomic<bool> aborted_{false};
+    // Whether the transport operation itself succeeded (as opposed to the
+    // work merely being retired, e.g. after an abort).
+    std::atomic<bool> opSucceeded_{false};
   };
 
   class TORCH_API RecvWork : public Work {
@@ -164,7 +180,8 @@ class TORCH_API ProcessGroupGloo : public Backend {
     explicit RecvWork(
         at::Tensor& tensor,
         std::unique_ptr<::gloo::transport::UnboundBuffer> buffer,
-        const char* profilingTitle = nullptr);
+        const char* profilingTitle = nullptr,
+        bool pollerManaged = false);
 
     int sourceRank() const override;
 
@@ -172,10 +189,18 @@ class TORCH_API ProcessGroupGloo : public Backend {
 
     void abort() override;
 
+    // See Note [Event-driven send/recv completion].
+    bool pollCompletion(std::chrono::milliseconds slice);
+
+    void finishTimeout();
+
    protected:
     at::Tensor tensor_;
     std::unique_ptr<::gloo::transport::UnboundBuffer> buffer_;
     int srcRank_;
+    const bool pollerManaged_;
+    std::atomic<bool> aborted_{false};
+    std::atomic<bool> opSucceeded_{false};
   };
 
   struct TORCH_API Options : public Backend::Options {
@@ -354,6 +379,19 @@ class TORCH_API ProcessGroupGloo : public Backend {
   // to contexts being used in a round-robin fashion.
   std::shared_ptr<::gloo::Context> getContext(uint32_t tag);
 
+  // Returns `count` contexts dedicated to chunked collectives, creating and
+  // connecting the missing ones on first use. Context creation performs a
+  // rendezvous, so this may only be called when every rank in the group
+  // requests at least `count` contexts in the same order. This holds for the
+  // chunked allreduce path because the chunk count is a pure function of the
+  // tensor size, which must match across ranks.
+  std::vector<std::shared_ptr<::gloo::Context>> getChunkContexts(size_t count);
+
+  // Contexts above and beyond `contexts_` used to run the chunks of one large
+  // collective in parallel. Lazily created; guarded by the mutex.
+  std::vector<std::shared_ptr<::gloo::Context>> chunkContexts_;
+  std::mutex chunkContextsMutex_;
+
   // Entrypoint for worker threads.
   void runLoop(int workerIndex);
 
@@ -5,6 +5,8 @@
 
 #ifdef USE_C10D_NCCL
 
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <map>
 #include <stdexcept>
@@ -22,9 +24,14 @@
 #include <c10/util/Optional.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/distributed/c10d/ParamCommsUtils.hpp>
+#include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 #include <torch/csrc/distributed/c10d/TraceUtils.h>
 #include <torch/csrc/distributed/c10d/Utils.hpp>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include <torch/csrc/cuda/nccl.h>
 
 namespace c10d {
@@ -355,6 +362,9 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
       startTraceUpdated_(w.startTraceUpdated_),
       store_(w.store_) {
   exception_ = w.exception_;
+  // Share the callback list so the cleanup thread's copy delivers callbacks
+  // registered on the work handed back to the caller.
+  completionCallbacks_ = w.completionCallbacks_;
 }
 
 ProcessGroupNCCL::WorkNCCL::~WorkNCCL() = default;
@@ -808,7 +818,55 @@ void ProcessGroupNCCL::abort(c10::optional<std::string> abortReason) {
   }
 }
 
+void ProcessGroupNCCL::eagerConnect(
+    std::vector<at::Device> devices,
+    bool async) {
+  if (devices.empty()) {
+    devices.push_back(getDeviceForRank(rank_));
+  }
+  // Only one handshake may be in flight; later calls join earlier ones.
+  waitForEagerConnect();
+
+  auto connect = [this, devices]() {
+    const auto key = getKeyFromDevices(devices);
+    // OpType does not matter, only need to set to not go through send/recv
+    // path.
+    getNCCLComm(key, devices, OpType::ALLREDUCE);
+    LOG(INFO) << "[Rank " << rank_
+              << "] Eagerly initialized NCCL communicators for " << key;
+  };
+
+  if (!async) {
+    connect();
+    return;
+  }
+  eagerConnectThread_ = std::thread([this, connect]() {
+    try {
+      connect();
+    } catch (...) {
+      eagerConnectException_ = std::current_exception();
+    }
+  });
+}
+
+void ProcessGroupNCCL::waitForEagerConnect() {
+  if (eagerConnectThread_.joinable()) {
+    eagerConnectThread_.join();
+  }
+  if (eagerConnectException_) {
+    std::exception_ptr exception = nullptr;
+    std::swap(exception, eagerConnectException_);
+    std::rethrow_exception(exception);
+  }
+}
+
 ProcessGroupNCCL::~ProcessGroupNCCL() {
+  // Join a pending eager-connect handshake before tearing down the
+  // communicators it may still be creating.
+  if (eagerConnectThread_.joinable()) {
+    eagerConnectThread_.join();
+  }
+
   terminateProcessGroup_.store(true);
 
   workMetaListCV_.notify_one();
@@ -876,65 +934,82 @@ void ProcessGroupNCCL::logWorkEnd(WorkNCCL& work) {
 void ProcessGroupNCCL::workCleanupLoop() {
   bool done = false;
   while (!done || !terminateProcessGroup_.load()) {
-    std::unique_lock<std::mutex> lock(workMetaListMutex_);
-    // We busy-poll the work vector every kWatchdogThreadSleepMillis
-    // milliseconds as long as the atomic is True.
-    workMetaListCV_.wait_for(
-        lock,
-        std::chrono::milliseconds(kWatchdogThreadSleepMillis),
-        [&]() -> bool { return terminateProcessGroup_.load(); });
-
-    for (auto it = workMetaList_.begin(); it != workMetaList_.end();
-         /* no increment*/) {
-      auto& work = *it;
-      work.checkAndSetException();
-      bool timedOut = work.checkTimeout();
-
-      // If work hits an exception (either an error or timeout)
-      if (work.exception()) {
-        // Abort work and corresponding communicators
-        work.abort();
-        // PG level abort, which would abort all other communicators on this
-        // rank
-        abort();
-        // Report desync state in case of timeout
-        if (desyncDebug_ && timedOut) {
-          try {
-            auto desyncMsg = retrieveDesyncReport(store_, "NCCL", rank_, size_);
-            LOG(ERROR) << desyncMsg;
-          } catch (const std::exception& e) {
-            LOG(ERROR) << "Failed to retrieve NCCL_DESYNC_DEBUG report. "
-                       << " Please file an issue. Error: " << e.what();
-          } catch (...) {
-            LOG(ERROR)
-                << "Failed to rerieve NCCL_DESYNC_DEBUG report with unknown error."
-                << " Please file an issue.";
+    // Completed works with registered completion callbacks. Callbacks run
+    // after workMetaListMutex_ is released: they may launch follow-up
+    // collectives, and workEnqueue takes the same mutex.
+    std::list<ProcessGroupNCCL::WorkNCCL> callbackWorkList;
+
+    {
+      std::unique_lock<std::mutex> lock(workMetaListMutex_);
+      // We busy-poll the work vector every kWatchdogThreadSleepMillis
+      // milliseconds as long as the atomic is True.
+      workMetaListCV_.wait_for(
+          lock,
+          std::chrono::milliseconds(kWatchdogThreadSleepMillis),
+          [&]() -> bool { return terminateProcessGroup_.load(); });
+
+      for (auto it = workMetaList_.begin(); it != workMetaList_.end();
+           /* no increment*/) {
+        auto& work = *it;
+        work.checkAndSetException();
+        bool timedOut = work.checkTimeout();
+
+        // If work hits an exception (either an error or timeout)
+        if (work.exception()) {
+          // Abort work and corresponding communicators
+          work.abort();
+          // PG level abort, which would abort all other communicators on this
+          // rank
+          abort();
+          // Report desync state in case of timeout
+          if (desyncDebug_ && timedOut) {
+            try {
+              auto desyncMsg = retrieveDesyncReport(store_, "NCCL", rank_, size_);
+              LOG(ERROR) << desyncMsg;
+            } catch (const std::exception& e) {
+              LOG(ERROR) << "Failed to retrieve NCCL_DESYNC_DEBUG report. "
+                         << " Please file an issue. Error: " << e.what();
+            } catch (...) {
+              LOG(ERROR)
+                  << "Failed to rerieve NCCL_DESYNC_DEBUG report with unknown error."
+                  << " Please file an issue.";
+            }
           }
+          // Throw exception
+          work.handleException(asyncErrorHandling_);
         }
-        // Throw exception
-        work.handleException(asyncErrorHandling_);
-      }
 
-      // Work status logging for desync debug
-      if (desyncDebug_) {
-        if (work.isStarted()) {
-          logWorkStart(work);
+        // Work status logging for desync debug
+        if (desyncDebug_) {
+          if (work.isStarted()) {
+            logWorkStart(work);
+          }
+          if (work.isCompleted()) {
+            logWorkEnd(work);
+          }
         }
+
+        // Clean up completed work
         if (work.isCompleted()) {
-          logWorkEnd(work);
+          if (work.hasCompletionCallbacks()) {
+            // The copy shares the callback list (and drops outputs_, like the
+            // copy made by workEnqueue), so callbacks are delivered below with
+            // bounded latency even though the work is erased here.
+            callbackWorkList.emplace_back(work);
+          }
+          it = workMetaList_.erase(it);
+        } else {
+          // Increment the iterator if the current WorkNCCL object is not
+          // completed.
+          ++it;
         }
       }
+      done = workMetaList_.empty();
+    }
 
-      // Clean up completed work
-      if (work.isCompleted()) {
-        it = workMetaList_.erase(it);
-      } else {
-        // Increment the iterator if the current WorkNCCL object is not
-        // completed.
-        ++it;
-      }
+    for (auto& work : callbackWorkList) {
+      work.runCompletionCallbacks();
     }
-    done = workMetaList_.empty();
   }
 }
 
@@ -1398,6 +1473,8 @@ ProcessGroupNCCL::Options::Options(bool is_high_priority_stream)
 static constexpr int CoalActive = 0x01, CoalColl = 0x02, CoalP2P = 0x04;
 
 void ProcessGroupNCCL::startCoalescing() {
+  // Do not mix the automatic window with an explicit coalescing block.
+  flushPendingAllreduces();
   coalescedDevices_.clear();
   coalescedComms_.clear();
   coalescing_state_ |= CoalActive;
@@ -1832,6 +1909,363 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
       "nccl:all_reduce");
 }
 
+// Note [Automatic allreduce coalescing]
+//
+// With Options::coalescing_window_size > 0, all-reduces on small dense
+// floating-point tensors are not issued immediately: they are queued until
+// the window is full, then flattened into one scratch buffer and issued as
+// a single ncclAllReduce, with a copy back into the original tensors
+// afterwards. Many small unfused buffers otherwise pay one kernel-launch
+// and NCCL-protocol round per tensor, which dominates over bandwidth.
+//
+// Flushes happen only at points that are deterministic functions of the
+// program order - the window filling up, a queued tensor not matching the
+// pending batch (dtype/device), a wait()/getFuture() on a returned handle,
+// startCoalescing(), or barrier(). Since every rank runs the same sequence
+// of collectives with the same shapes and options, every rank flushes at
+// the same point in its NCCL issue order, which is what NCCL requires.
+// A time-based window would need a background thread issuing CUDA work at
+// rank-dependent moments and cannot provide that guarantee.
+//
+// The copy-in, the flat all-reduce and the copy-out are all ordered on the
+// queueing thread's current stream (the flat work's wait() only inserts a
+// stream dependency), so callers observe the usual async-collective
+// semantics once they wait on the returned handle.
+
+bool ProcessGroupNCCL::shouldCoalesceAllreduce(
+    const std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) const {
+  if (options_->coalescing_window_size <= 0 || coalescing_state_ != 0) {
+    return false;
+  }
+  if (tensors.size() != 1) {
+    return false;
+  }
+  const auto& tensor = tensors[0];
+  // PREMUL_SUM carries a scaling factor and the other ops are not
+  // loss-free over a flattened buffer boundary; restrict to plain SUM.
+  return opts.reduceOp.op_ == ReduceOp::SUM && tensor.is_cuda() &&
+      tensor.is_non_overlapping_and_dense() &&
+      at::isFloatingType(tensor.scalar_type()) &&
+      tensor.numel() <= options_->coalescing_max_numel;
+}
+
+c10::intrusive_ptr<Work> ProcessGroupNCCL::coalesceAllreduce(
+    std::vector<at::Tensor>& tensors) {
+  auto& tensor = tensors[0];
+
+  bool needFlush = false;
+  {
+    std::lock_guard<std::mutex> lock(pendingAllreduceMutex_);
+    if (pendingAllreduce_ != nullptr) {
+      const auto& first = pendingAllreduce_->tensors.front();
+      needFlush = first.scalar_type() != tensor.scalar_type() ||
+          first.device() != tensor.device();
+    }
+  }
+  if (needFlush) {
+    flushPendingAllreduces();
+  }
+
+  std::shared_ptr<PendingAllreduceBatch> batch;
+  bool windowFull = false;
+  {
+    std::lock_guard<std::mutex> lock(pendingAllreduceMutex_);
+    if (pendingAllreduce_ == nullptr) {
+      pendingAllreduce_ = std::make_shared<PendingAllreduceBatch>();
+    }
+    pendingAllreduce_->tensors.push_back(tensor);
+    batch = pendingAllreduce_;
+    windowFull = static_cast<int64_t>(batch->tensors.size()) >=
+        options_->coalescing_window_size;
+  }
+  if (windowFull) {
+    flushPendingAllreduces();
+  }
+
+  return c10::make_intrusive<CoalescedAllreduceWork>(
+      c10::intrusive_ptr<ProcessGroupNCCL>::unsafe_reclaim_from_nonowning(
+          this),
+      std::move(batch),
+      rank_);
+}
+
+void ProcessGroupNCCL::flushPendingAllreduces() {
+  std::shared_ptr<PendingAllreduceBatch> batch;
+  {
+    std::lock_guard<std::mutex> lock(pendingAllreduceMutex_);
+    batch = std::move(pendingAllreduce_);
+  }
+  if (batch == nullptr) {
+    return;
+  }
+
+  AllreduceOptions opts;
+  opts.reduceOp = ReduceOp::SUM;
+
+  if (batch->tensors.size() == 1) {
+    // Nothing to batch with; skip the flatten round trip.
+    batch->flatWork = allreduce_impl(batch->tensors, opts);
+    batch->flushed = true;
+    return;
+  }
+
+  int64_t totalNumel = 0;
+  for (const auto& tensor : batch->tensors) {
+    totalNumel += tensor.numel();
+  }
+
+  auto flat = at::empty({totalNumel}, batch->tensors.front().options());
+  int64_t offset = 0;
+  for (const auto& tensor : batch->tensors) {
+    flat.narrow(0, offset, tensor.numel()).copy_(tensor.flatten());
+    offset += tensor.numel();
+  }
+
+  std::vector<at::Tensor> flatVec{flat};
+  batch->flatWork = allreduce_impl(flatVec, opts);
+
+  // Order the copy-out after the collective; wait() makes the current
+  // stream wait on the collective's events and does not block the CPU
+  // (unless blocking wait is configured).
+  batch->flatWork->wait();
+  offset = 0;
+  for (auto& tensor : batch->tensors) {
+    tensor.copy_(flat.narrow(0, offset, tensor.numel()).view(tensor.sizes()));
+    offset += tensor.numel();
+  }
+  batch->flushed = true;
+}
+
+ProcessGroupNCCL::CoalescedAllreduceWork::CoalescedAllreduceWork(
+    c10::intrusive_ptr<ProcessGroupNCCL> pg,
+    std::shared_ptr<PendingAllreduceBatch> batch,
+    int rank)
+    : Work(rank, OpType::ALLREDUCE, "nccl:coalesced_all_reduce"),
+      pg_(std::move(pg)),
+      batch_(std::move(batch)) {}
+
+ProcessGroupNCCL::CoalescedAllreduceWork::~CoalescedAllreduceWork() = default;
+
+bool ProcessGroupNCCL::CoalescedAllreduceWork::isCompleted() {
+  return batch_->flushed && batch_->flatWork->isCompleted();
+}
+
+bool ProcessGroupNCCL::CoalescedAllreduceWork::wait(
+    std::chrono::milliseconds timeout) {
+  if (!batch_->flushed) {
+    pg_->flushPendingAllreduces();
+  }
+  return batch_->flatWork->wait(timeout);
+}
+
+void ProcessGroupNCCL::CoalescedAllreduceWork::synchronize() {
+  wait(kNoTimeout);
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> ProcessGroupNCCL::
+    CoalescedAllreduceWork::getFuture() {
+  if (!batch_->flushed) {
+    pg_->flushPendingAllreduces();
+  }
+  return batch_->flatWork->getFuture();
+}
+
+// Note [Hierarchical allreduce]
+//
+// With Options::use_hierarchical_allreduce, a flat all-reduce over M nodes
+// with N ranks each is replaced by three stages:
+//
+//   1. reduce-scatter within the node, leaving each rank one 1/N shard,
+//   2. all-reduce of that shard across nodes, among the ranks that hold
+//      the same shard (the k-th rank of every node), and
+//   3. all-gather within the node.
+//
+// Only the middle stage crosses the node boundary, so cross-node traffic
+// drops by a factor of N - intra-node links (NVLink) carry the rest. The
+// sub-groups are ordinary nested ProcessGroupNCCL instances over prefix
+// stores derived from this group's store: one per node for stages 1/3,
+// and one per local rank index for stage 2. They are constructed lazily
+// on the first eligible call, after the ranks have exchanged hostnames
+// through the store to discover the topology.
+//
+// Whether a call takes the hierarchical path must be a pure function of
+// the options, the tensor's shape/dtype/layout, and the topology - all of
+// which are identical across ranks for a well-formed collective - so that
+// every rank issues the same NCCL operations in the same order.
+//
+// The stages are ordered through the work handles' stream-level wait(),
+// which only inserts inter-stream dependencies; nothing blocks the CPU.
+
+bool ProcessGroupNCCL::shouldUseHierarchicalAllreduce(
+    const std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  if (!options_->use_hierarchical_allreduce || tensors.size() != 1) {
+    return false;
+  }
+  // The scheme reduces shards independently, so the op must distribute
+  // over a split of the buffer. AVG works because the two reductions
+  // divide by the intra- and cross-node sizes respectively, which
+  // multiply to the world size. PREMUL_SUM would apply its factor twice.
+  const auto op = opts.reduceOp.op_;
+  if (op != ReduceOp::SUM && op != ReduceOp::MIN && op != ReduceOp::MAX &&
+      op != ReduceOp::PRODUCT && op != ReduceOp::AVG) {
+    return false;
+  }
+  const auto& tensor = tensors[0];
+  if (!tensor.is_cuda() || !tensor.is_contiguous()) {
+    return false;
+  }
+  if (tensor.numel() < options_->hierarchical_allreduce_min_numel) {
+    return false;
+  }
+  return ensureHierarchicalGroups();
+}
+
+bool ProcessGroupNCCL::ensureHierarchicalGroups() {
+  std::lock_guard<std::mutex> lock(hierarchicalMutex_);
+  if (hierarchicalInitTried_) {
+    return intraNodePg_ != nullptr;
+  }
+  hierarchicalInitTried_ = true;
+
+  try {
+    // Exchange hostnames through the store to discover which ranks share a
+    // node. get() blocks until the peer has published its entry.
+    std::array<char, 256> hostnameBuf{};
+    TORCH_CHECK(
+        gethostname(hostnameBuf.data(), hostnameBuf.size() - 1) == 0,
+        "gethostname failed");
+    const std::string hostname(hostnameBuf.data());
+    store_->set(
+        "hierarchical/host/" + std::to_string(rank_),
+        std::vector<uint8_t>(hostname.begin(), hostname.end()));
+    std::vector<std::string> hosts;
+    hosts.reserve(size_);
+    for (const auto r : c10::irange(size_)) {
+      auto vec = store_->get("hierarchical/host/" + std::to_string(r));
+      hosts.emplace_back(vec.begin(), vec.end());
+    }
+
+    // Nodes are numbered by the first rank that appears on them, so the
+    // numbering is identical on every rank.
+    std::vector<std::string> nodes;
+    for (const auto& host : hosts) {
+      if (std::find(nodes.begin(), nodes.end(), host) == nodes.end()) {
+        nodes.push_back(host);
+      }
+    }
+    const int numNodes = static_cast<int>(nodes.size());
+
+    int localRank = -1;
+    int localSize = 0;
+    for (const auto r : c10::irange(size_)) {
+      if (hosts[r] == hostname) {
+        if (r == rank_) {
+          localRank = localSize;
+        }
+        ++localSize;
+      }
+    }
+    const int nodeId = static_cast<int>(
+        std::find(nodes.begin(), nodes.end(), hostname) - nodes.begin());
+
+    // Stage 2 pairs up the k-th rank of every node, which requires the
+    // same number of ranks on each node.
+    bool uniform = localSize * numNodes == static_cast<int>(size_);
+    if (uniform) {
+      for (const auto& node : nodes) {
+        if (std::count(hosts.begin(), hosts.end(), node) != localSize) {
+          uniform = false;
+          break;
+        }
+      }
+    }
+    if (numNodes < 2 || localSize < 2 || !uniform) {
+      LOG(INFO) << "[Rank " << rank_
+                << "] hierarchical allreduce disabled: requires multiple "
+                   "nodes with a uniform number of ranks per node (got "
+                << numNodes << " node(s), " << localSize
+                << " local rank(s)); using flat allreduce";
+      return false;
+    }
+
+    auto intraStore = c10::make_intrusive<PrefixStore>(
+        "hierarchical/node/" + std::to_string(nodeId), store_);
+    intraNodePg_ = c10::make_intrusive<ProcessGroupNCCL>(
+        intraStore,
+        localRank,
+        localSize,
+        Options::create(options_->is_high_priority_stream));
+    auto crossStore = c10::make_intrusive<PrefixStore>(
+        "hierarchical/cross/" + std::to_string(localRank), store_);
+    crossNodePg_ = c10::make_intrusive<ProcessGroupNCCL>(
+        crossStore,
+        nodeId,
+        numNodes,
+        Options::create(options_->is_high_priority_stream));
+    LOG(INFO) << "[Rank " << rank_
+              << "] hierarchical allreduce enabled: " << numNodes
+              << " nodes x " << localSize << " ranks";
+    return true;
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "[Rank " << rank_
+                 << "] hierarchical allreduce setup failed, using flat "
+                    "allreduce: "
+                 << e.what();
+    intraNodePg_ = nullptr;
+    crossNodePg_ = nullptr;
+    return false;
+  }
+}
+
+c10::intrusive_ptr<Work> ProcessGroupNCCL::hierarchicalAllreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  auto& tensor = tensors[0];
+  const int64_t localSize = intraNodePg_->getSize();
+  const int64_t numel = tensor.numel();
+
+  // The reduce-scatter needs equal per-rank shards; pad into a scratch
+  // buffer when the size doesn't divide evenly. The padding only ever
+  // meets other ranks' padding, so its value never reaches the result.
+  const int64_t paddedNumel =
+      ((numel + localSize - 1) / localSize) * localSize;
+  at::Tensor flat;
+  const bool padded = paddedNumel != numel;
+  if (padded) {
+    flat = at::zeros({paddedNumel}, tensor.options());
+    flat.narrow(0, 0, numel).copy_(tensor.view({numel}));
+  } else {
+    flat = tensor.view({numel});
+  }
+  const int64_t shardNumel = paddedNumel / localSize;
+  // In-place shard (NCCL supports recv == send + rank * recvcount).
+  auto shard = flat.narrow(0, intraNodePg_->getRank() * shardNumel, shardNumel);
+
+  ReduceScatterOptions rsOpts;
+  rsOpts.reduceOp = opts.reduceOp;
+  rsOpts.timeout = opts.timeout;
+  intraNodePg_->_reduce_scatter_base(shard, flat, rsOpts)->wait();
+
+  AllreduceOptions crossOpts;
+  crossOpts.reduceOp = opts.reduceOp;
+  crossOpts.timeout = opts.timeout;
+  std::vector<at::Tensor> shardVec{shard};
+  crossNodePg_->allreduce(shardVec, crossOpts)->wait();
+
+  AllgatherOptions agOpts;
+  agOpts.timeout = opts.timeout;
+  auto work = intraNodePg_->_allgather_base(flat, shard, agOpts);
+
+  if (padded) {
+    // Ordered after the all-gather on the current stream.
+    work->wait();
+    tensor.view({numel}).copy_(flat.narrow(0, 0, numel));
+  }
+  return work;
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
@@ -1853,6 +2287,14 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
       std::vector<int64_t>(), // inSplitSizes
       std::vector<int64_t>()); // outSplitSizes
 
+  if (shouldCoalesceAllreduce(tensors, opts)) {
+    return coalesceAllreduce(tensors);
+  }
+
+  if (shouldUseHierarchicalAllreduce(tensors, opts)) {
+    return hierarchicalAllreduce(tensors, opts);
+  }
+
   // avoidRecordStreams_ note: collective() will stash tensors.
   return allreduce_impl(tensors, opts);
 }
@@ -2232,6 +2674,68 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allgather_into_tensor_coalesced(
       "nccl:all_gather_into_tensor_coalesced");
 }
 
+std::vector<c10::intrusive_ptr<Work>> ProcessGroupNCCL::allgather_streamed(
+    std::vector<at::Tensor>& outputs,
+    std::vector<at::Tensor>& inputs,
+    const AllgatherOptions& /* unused */) {
+  TORCH_CHECK(
+      outputs.size() == inputs.size(),
+      "allgather_streamed: number of output chunks (",
+      outputs.size(),
+      ") must match number of input chunks (",
+      inputs.size(),
+      ")");
+
+  // Each chunk is launched as its own collective so that it gets a dedicated
+  // WorkNCCL (and hence its own end event and future). The chunks go onto the
+  // same NCCL stream back-to-back, so chunk i+1's communication runs while
+  // the consumer computes on chunk i; only the chunks actually waited on
+  // gate the compute stream.
+  std::vector<c10::intrusive_ptr<Work>> works;
+  works.reserve(inputs.size());
+  for (const auto i : c10::irange(inputs.size())) {
+    check_gpu_single_tensor(inputs[i]);
+    check_gpu_single_tensor(outputs[i]);
+    TORCH_CHECK(
+        inputs[i].dtype() == outputs[i].dtype(),
+        "allgather_streamed: chunk ",
+        i,
+        ": output tensor must have the same type as input tensor");
+    TORCH_CHECK(
+        inputs[i].numel() * size_ == outputs[i].numel(),
+        "allgather_streamed: chunk ",
+        i,
+        ": output tensor size must be equal to world_size times input tensor size");
+
+    auto chunk_inputs = std::vector<at::Tensor>{inputs[i]};
+    auto chunk_outputs = std::vector<at::Tensor>{outputs[i]};
+
+    // avoidRecordStreams_ note: collective() will stash inputs and outputs.
+    works.push_back(collective(
+        chunk_inputs,
+        chunk_outputs,
+        [&](at::Tensor& input,
+            at::Tensor& output,
+            ncclComm_t comm,
+            at::cuda::CUDAStream& stream) {
+          if (!avoidRecordStreams_) {
+            c10::cuda::CUDACachingAllocator::recordStream(
+                output.storage().data_ptr(), stream);
+          }
+          return ncclAllGather(
+              input.data_ptr(),
+              output.data_ptr(),
+              input.numel(),
+              getNcclDataType(input.scalar_type()),
+              comm,
+              stream.stream());
+        },
+        OpType::_ALLGATHER_BASE,
+        "nccl:all_gather_streamed"));
+  }
+  return works;
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::reduce_scatter(
     std::vector<at::Tensor>& outputTensors,
     std::vector<std::vector<at::Tensor>>& inputTensors,
@@ -2470,6 +2974,10 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::barrier(const BarrierOptions& opts) {
         at::TensorOptions().device(at::DeviceType::CUDA).dtype(at::kByte)));
   }
 
+  // The barrier must order after any queued small all-reduces. (The byte
+  // barrier tensor itself never qualifies for the coalescing window.)
+  flushPendingAllreduces();
+
   // All reduce to achieve the barrier
   auto work = allreduce(barrierTensors);
 
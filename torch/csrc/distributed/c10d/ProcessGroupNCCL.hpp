@@ -265,6 +265,46 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     friend class ProcessGroupNCCL;
   };
 
+  // A batch of small all-reduces queued by the automatic coalescing window;
+  // see Note [Automatic allreduce coalescing] in ProcessGroupNCCL.cpp.
+  struct PendingAllreduceBatch {
+    std::vector<at::Tensor> tensors;
+    // Work of the flat-buffer all-reduce; set when the batch is flushed.
+    c10::intrusive_ptr<Work> flatWork;
+    bool flushed = false;
+  };
+
+  // Work handle returned for an all-reduce queued in the automatic
+  // coalescing window. The NCCL kernel has not been issued yet when the
+  // handle is created; waiting on (or requesting the future of) the handle
+  // forces the window to flush.
+  class TORCH_API CoalescedAllreduceWork : public Work {
+   public:
+    CoalescedAllreduceWork(
+        c10::intrusive_ptr<ProcessGroupNCCL> pg,
+        std::shared_ptr<PendingAllreduceBatch> batch,
+        int rank);
+
+    ~CoalescedAllreduceWork() override;
+
+    bool isCompleted() override;
+
+    bool wait(std::chrono::milliseconds timeout = kNoTimeout) override;
+
+    void synchronize() override;
+
+    // Note: the future completes with the flat buffer's all-reduce; the
+    // copy-out into the original tensors is already ordered on the stream
+    // that queued the all-reduces.
+    c10::intrusive_ptr<c10::ivalue::Future> getFuture() override;
+
+   protected:
+    c10::intrusive_ptr<ProcessGroupNCCL> pg_;
+    std::shared_ptr<PendingAllreduceBatch> batch_;
+
+    friend class ProcessGroupNCCL;
+  };
+
   struct Options : Backend::Options {
     // NOTE: timeout in ProcessGroupNCCL::Options denote the timeout for
     // operations. This is only used when blockingWait_ is enabled.
@@ -279,6 +319,30 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
     // Schedule NCCL operations on high priority CUDA streams
     bool is_high_priority_stream;
+
+    // Automatically coalesce small all-reduces: a call on a single dense
+    // floating-point CUDA tensor of at most `coalescing_max_numel` elements
+    // (with ReduceOp::SUM) is queued until `coalescing_window_size` such
+    // calls are pending, then the batch is issued as one flat-buffer
+    // ncclAllReduce. Waiting on any queued work flushes the window early.
+    // 0 disables the feature. See Note [Automatic allreduce coalescing] in
+    // ProcessGroupNCCL.cpp.
+    int64_t coalescing_window_size = 0;
+    int64_t coalescing_max_numel = 262144;
+
+    // Perform eligible all-reduces hierarchically: reduce-scatter over
+    // NVLink within the node, all-reduce one shard per rank across nodes,
+    // then all-gather within the node. On an N-GPU-per-node cluster this
+    // cuts cross-node bytes by a factor of N. The process group discovers
+    // the node topology through the store and constructs the intra- and
+    // cross-node sub-communicators internally on first use; it falls back
+    // to a flat all-reduce when the job doesn't span multiple nodes or the
+    // per-node rank counts are not uniform. See Note [Hierarchical
+    // allreduce] in ProcessGroupNCCL.cpp.
+    bool use_hierarchical_allreduce = false;
+    // Tensors smaller than this take the flat all-reduce; the extra
+    // latency of the three-stage scheme only pays off for large buffers.
+    int64_t hierarchical_allreduce_min_numel = 0;
   };
 
   // If you wish to create multiple process groups, each with a potentially
@@ -373,6 +437,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& inputs,
       const AllgatherOptions& opts = AllgatherOptions()) override;
 
+  std::vector<c10::intrusive_ptr<Work>> allgather_streamed(
+      std::vector<at::Tensor>& outputs,
+      std::vector<at::Tensor>& inputs,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
   c10::intrusive_ptr<Work> reduce_scatter(
       std::vector<at::Tensor>& outputTensors,
       std::vector<std::vector<at::Tensor>>& inputTensors,
@@ -445,6 +514,23 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // instead of relying on ProcessGroupNCCL destructor.
   void abort(c10::optional<std::string> abortReason = c10::nullopt);
 
+  // Eagerly establishes and caches the NCCL communicators for `devices`
+  // instead of paying the handshake on the first collective, so startup
+  // readiness probes are not skewed by seconds of synchronized stall.
+  // An empty `devices` defaults to this rank's device. With `async` the
+  // handshake runs on a background thread so it can overlap with model
+  // loading; it must be joined via waitForEagerConnect() before the first
+  // collective on the same devices. Nonblocking communicator init
+  // (TORCH_NCCL_USE_COMM_NONBLOCKING) is honored, so slow ranks do not
+  // serialize the whole world inside the handshake.
+  void eagerConnect(
+      std::vector<at::Device> devices = {},
+      bool async = false);
+
+  // Joins a pending asynchronous eagerConnect() handshake, rethrowing any
+  // error it hit. No-op when nothing is in flight.
+  void waitForEagerConnect();
+
  protected:
   // Helper that broadcasts nccl unique ID to all ranks through the store
   void broadcastUniqueNCCLID(
@@ -527,6 +613,38 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::vector<at::Tensor>& tensors,
       const AllreduceOptions& opts = AllreduceOptions());
 
+  // Whether the given all-reduce call qualifies for the automatic
+  // coalescing window (see Options::coalescing_window_size).
+  bool shouldCoalesceAllreduce(
+      const std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts) const;
+
+  // Queues a qualifying all-reduce in the coalescing window, flushing the
+  // window first if the tensor does not match the pending batch.
+  c10::intrusive_ptr<Work> coalesceAllreduce(std::vector<at::Tensor>& tensors);
+
+  // Issues the pending batch (if any) as one flat-buffer all-reduce.
+  void flushPendingAllreduces();
+
+  // Whether the given all-reduce call qualifies for the two-level scheme
+  // (see Options::use_hierarchical_allreduce). Initializes the sub-groups
+  // on the first eligible call.
+  bool shouldUseHierarchicalAllreduce(
+      const std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
+  // Lazily discovers the node topology through the store and constructs
+  // the intra-node and cross-node sub-groups. Returns false (permanently)
+  // when the topology doesn't support the hierarchical scheme.
+  bool ensureHierarchicalGroups();
+
+  // Runs one all-reduce as intra-node reduce-scatter, cross-node
+  // all-reduce of this rank's shard, intra-node all-gather. See Note
+  // [Hierarchical allreduce].
+  c10::intrusive_ptr<Work> hierarchicalAllreduce(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -627,6 +745,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Watchdog thread which looks for errors on the cached NCCL communicators.
   std::thread ncclCommWatchdogThread_;
 
+  // Background thread running an asynchronous eagerConnect() handshake,
+  // plus the error (if any) it terminated with.
+  std::thread eagerConnectThread_;
+  std::exception_ptr eagerConnectException_;
+
   // Whether or not we should terminate the watchdog and workCleanup threads.
   std::atomic<bool> terminateProcessGroup_;
 
@@ -661,6 +784,22 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Stores communicators for all collectives run inside a coalescing block
   std::vector<std::vector<std::shared_ptr<NCCLComm>>> coalescedComms_;
 
+  // The batch of small all-reduces queued by the automatic coalescing
+  // window; null when nothing is pending. Guarded by
+  // pendingAllreduceMutex_.
+  std::shared_ptr<PendingAllreduceBatch> pendingAllreduce_;
+
+  std::mutex pendingAllreduceMutex_;
+
+  // Sub-groups for the hierarchical all-reduce; null until the first
+  // eligible call, and left null permanently when the topology doesn't
+  // support the scheme. Guarded by hierarchicalMutex_.
+  c10::intrusive_ptr<ProcessGroupNCCL> intraNodePg_;
+  c10::intrusive_ptr<ProcessGroupNCCL> crossNodePg_;
+  bool hierarchicalInitTried_ = false;
+
+  std::mutex hierarchicalMutex_;
+
   // map from the key: "group name + pg counter (ID)" to the
   // unique NCCL ID count. This needs to be group and pg specific
   //
@@ -17,6 +17,11 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <c10/util/ScopeExit.h>
+#endif
+
 #ifdef _WIN32
 #include <torch/csrc/distributed/c10d/WinSockUtils.hpp>
 #else
@@ -174,6 +179,15 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void run();
   void queryFds(std::vector<struct pollfd>& fds);
   void query(int socket);
+  // Serves the request that made `socket` ready plus any further requests
+  // already buffered on it (clients pipeline e.g. SET immediately followed
+  // by WAIT).
+  void serveQueries(int socket);
+  // Drops the wait/wakeup bookkeeping of a closed socket.
+  void clearSocketWaitState(int socket);
+  // Sends the STOP_WAITING responses queued up by wakeupWaitingClients()
+  // during the current event-loop iteration.
+  void flushWakeups();
 
   // The master runs on a single thread so only
   // one handler can be executed at a time
@@ -209,6 +223,11 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   std::unordered_map<int, size_t> keysAwaited_;
   // From key -> the list of sockets watching the key
   std::unordered_map<std::string, std::vector<int>> watchedSockets_;
+  // Sockets whose wait() completed during the current event-loop iteration.
+  // A single SET (or MULTI_SET) can release thousands of waiters at
+  // rendezvous; the responses are coalesced and sent in one batch at the
+  // end of the iteration instead of interleaved with request processing.
+  std::vector<int> pendingWakeups_;
 };
 
 // Simply start the daemon thread
@@ -232,7 +251,7 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
 
     // Now query the socket that has the event
     try {
-      query(fds[fdIdx].fd);
+      serveQueries(fds[fdIdx].fd);
     } catch (...) {
       // There was an error when processing query. Probably an exception
       // occurred in recv/send what would indicate that socket on the other
@@ -243,27 +262,8 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       // we hit an exception here.
 
       // Remove all the tracking state of the close FD
-      for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
-        for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
-          if (*vecIt == fds[fdIdx].fd) {
-            vecIt = it->second.erase(vecIt);
-          } else {
-            ++vecIt;
-          }
-        }
-        if (it->second.empty()) {
-          it = waitingSockets_.erase(it);
-        } else {
-          ++it;
-        }
-      }
-      for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
-        if (it->first == fds[fdIdx].fd) {
-          it = keysAwaited_.erase(it);
-        } else {
-          ++it;
-        }
-      }
+      clearSocketWaitState(fds[fdIdx].fd);
+
       fds.erase(fds.begin() + fdIdx);
       sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
       --fdIdx;
@@ -272,6 +272,50 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
   }
 }
 
+#ifndef _WIN32
+// Whether the socket has more request bytes already buffered; used to
+// serve pipelined requests without a round trip through the event loop.
+bool hasPendingBytes(int socket) {
+  char byte = 0;
+  return ::recv(socket, &byte, 1, MSG_PEEK | MSG_DONTWAIT) > 0;
+}
+#endif
+
+void TCPStoreMasterDaemon::serveQueries(int socket) {
+  query(socket);
+#ifndef _WIN32
+  // Clients pipeline requests (e.g. rendezvous issues SET and WAIT
+  // back-to-back), so drain what has already arrived instead of paying one
+  // event-loop wakeup per request. The cap keeps a chatty client from
+  // starving the other connections.
+  constexpr int kMaxPipelinedQueries = 128;
+  for (int i = 0; i < kMaxPipelinedQueries && hasPendingBytes(socket); ++i) {
+    query(socket);
+  }
+#endif
+}
+
+void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.empty()) {
+      it = waitingSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  keysAwaited_.erase(socket);
+  pendingWakeups_.erase(
+      std::remove(pendingWakeups_.begin(), pendingWakeups_.end(), socket),
+      pendingWakeups_.end());
+}
+
 // query communicates with the worker. The format
 // of the query is as follows:
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
@@ -322,14 +366,27 @@ void TCPStoreMasterDaemon::wakeupWaitingClients(const std::string& key) {
   if (socketsToWait != waitingSockets_.end()) {
     for (int socket : socketsToWait->second) {
       if (--keysAwaited_[socket] == 0) {
-        tcputil::sendValue<WaitResponseType>(
-            socket, WaitResponseType::STOP_WAITING);
+        // A client has at most one wait in flight, so no dedup is needed.
+        pendingWakeups_.push_back(socket);
       }
     }
     waitingSockets_.erase(socketsToWait);
   }
 }
 
+void TCPStoreMasterDaemon::flushWakeups() {
+  for (int socket : pendingWakeups_) {
+    try {
+      tcputil::sendValue<WaitResponseType>(
+          socket, WaitResponseType::STOP_WAITING);
+    } catch (...) {
+      // The waiter went away; the event loop will observe the hangup on its
+      // socket and clear the remaining state.
+    }
+  }
+  pendingWakeups_.clear();
+}
+
 void TCPStoreMasterDaemon::sendKeyUpdatesToClients(
     const std::string& key,
     const enum WatchResponseType& type,
@@ -591,6 +648,73 @@ void TCPStoreMasterDaemon::run() {
       tcputil::addPollfd(fds, rawSocket, POLLIN);
     }
     queryFds(fds);
+    flushWakeups();
+  }
+}
+#elif defined(__linux__)
+void TCPStoreMasterDaemon::run() {
+  // The master daemon multiplexes with epoll(7): poll(2) rescans every
+  // connection on each wakeup, which at a few thousand ranks makes the
+  // daemon CPU-bound on the scan alone. epoll_wait returns only the ready
+  // sockets, so the cost per wakeup is proportional to the work to do.
+  int epollFd = -1;
+  SYSCHECK_ERR_RETURN_NEG1(epollFd = ::epoll_create1(EPOLL_CLOEXEC));
+  auto epollGuard = c10::make_scope_exit([&] { ::close(epollFd); });
+
+  auto registerFd = [epollFd](int fd) {
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    SYSCHECK_ERR_RETURN_NEG1(::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev));
+  };
+
+  registerFd(storeListenSocket_.handle());
+  // See the note in the poll(2) implementation below on why the control
+  // pipe is watched for readability rather than hangup only. EPOLLHUP is
+  // always reported, so registering for EPOLLIN is sufficient.
+  registerFd(controlPipeFd_[0]);
+
+  std::array<struct epoll_event, 64> events{};
+  bool finished = false;
+  while (!finished) {
+    int numEvents = 0;
+    SYSCHECK_ERR_RETURN_NEG1(
+        numEvents = ::epoll_wait(epollFd, events.data(), events.size(), -1));
+
+    for (const auto i : c10::irange(numEvents)) {
+      int eventFd = events[i].data.fd;
+      if (eventFd == storeListenSocket_.handle()) {
+        // TCPStore's listening socket has an event and it should now be
+        // able to accept new connections.
+        Socket socket = storeListenSocket_.accept();
+        int rawSocket = socket.handle();
+        sockets_.emplace_back(std::move(socket));
+        registerFd(rawSocket);
+      } else if (eventFd == controlPipeFd_[0]) {
+        // The main thread will write a byte to the pipe then close it
+        // before joining the background thread
+        finished = true;
+        break;
+      } else {
+        try {
+          serveQueries(eventFd);
+        } catch (...) {
+          // See the comment in queryFds: treat any recv/send failure as the
+          // client closing its connection and drop the socket's state.
+          clearSocketWaitState(eventFd);
+          SYSCHECK_ERR_RETURN_NEG1(
+              ::epoll_ctl(epollFd, EPOLL_CTL_DEL, eventFd, nullptr));
+          auto pos = std::find_if(
+              sockets_.begin(), sockets_.end(), [eventFd](const Socket& s) {
+                return s.handle() == eventFd;
+              });
+          if (pos != sockets_.end()) {
+            sockets_.erase(pos);
+          }
+        }
+      }
+    }
+    flushWakeups();
   }
 }
 #else
@@ -648,6 +772,7 @@ void TCPStoreMasterDaemon::run() {
       break;
     }
     queryFds(fds);
+    flushWakeups();
   }
 }
 #endif
@@ -102,6 +102,39 @@ c10::intrusive_ptr<c10::ivalue::Future> Work::getFuture() {
   TORCH_CHECK(false, "Work::getFuture not implemented.")
 }
 
+void Work::registerCompletionCallback(std::function<void(Work&)> callback) {
+  {
+    std::lock_guard<std::mutex> lock(completionCallbacks_->mutex);
+    if (!completionCallbacks_->ran) {
+      completionCallbacks_->callbacks.emplace_back(std::move(callback));
+      return;
+    }
+  }
+  // The work already completed and its callbacks have run; deliver this one
+  // inline so registration is never silently dropped.
+  callback(*this);
+}
+
+bool Work::hasCompletionCallbacks() {
+  std::lock_guard<std::mutex> lock(completionCallbacks_->mutex);
+  return !completionCallbacks_->callbacks.empty();
+}
+
+void Work::runCompletionCallbacks() {
+  std::vector<std::function<void(Work&)>> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(completionCallbacks_->mutex);
+    if (completionCallbacks_->ran) {
+      return;
+    }
+    completionCallbacks_->ran = true;
+    callbacks.swap(completionCallbacks_->callbacks);
+  }
+  for (auto& callback : callbacks) {
+    callback(*this);
+  }
+}
+
 void Work::finish(std::exception_ptr exception) {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_ = true;
@@ -112,6 +145,7 @@ void Work::finish(std::exception_ptr exception) {
   }
   lock.unlock();
   cv_.notify_all();
+  runCompletionCallbacks();
 }
 
 void Work::finishAndThrow(std::exception_ptr exception) {
@@ -122,8 +156,12 @@ void Work::finishAndThrow(std::exception_ptr exception) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
   }
-  if (exception_) {
-    std::rethrow_exception(exception_);
+  lock.unlock();
+  // Deliver callbacks before rethrowing so chained pipelines observe the
+  // failure even when the caller is about to unwind.
+  runCompletionCallbacks();
+  if (exception) {
+    std::rethrow_exception(exception);
   }
 }
 
@@ -106,6 +106,26 @@ class TORCH_API Work : public torch::CustomClassHolder {
   // work. Only NCCL backend is currently supported.
   virtual c10::intrusive_ptr<c10::ivalue::Future> getFuture();
 
+  // Registers a callback that runs exactly once after this work completes,
+  // whether it completed successfully or with an exception (query the work
+  // inside the callback to tell the two apart). If the work has already
+  // completed, the callback runs inline. Otherwise it is delivered from the
+  // backend's completion thread (e.g. the ProcessGroupNCCL watchdog), so no
+  // user thread has to poll isCompleted(). Callbacks must not block; they may
+  // schedule follow-up collectives, which allows chaining
+  // comm -> transform -> comm pipelines without busy-waiting.
+  void registerCompletionCallback(std::function<void(Work&)> callback);
+
+  // Returns true if any registered callbacks have not run yet.
+  bool hasCompletionCallbacks();
+
+  // Runs pending completion callbacks, at most once across all copies of
+  // this work. Called by finish(); backends that complete work out-of-band
+  // (e.g. via CUDA events) must call this from their completion thread once
+  // isCompleted() returns true. Must not be called with locks held that a
+  // callback-scheduled collective could need.
+  void runCompletionCallbacks();
+
   OpType retrieveOpType();
 
   static c10::intrusive_ptr<Work> create_from_future(
@@ -125,6 +145,18 @@ class TORCH_API Work : public torch::CustomClassHolder {
   bool completed_ = false;
   std::exception_ptr exception_;
 
+  // Completion callbacks live behind a shared_ptr with their own lock so
+  // that backends whose cleanup threads operate on copies of the work
+  // (e.g. ProcessGroupNCCL's watchdog) see callbacks registered on the
+  // original, and so that the callbacks run exactly once across all copies.
+  struct CompletionCallbacks {
+    std::mutex mutex;
+    bool ran = false;
+    std::vector<std::function<void(Work&)>> callbacks;
+  };
+  std::shared_ptr<CompletionCallbacks> completionCallbacks_ =
+      std::make_shared<CompletionCallbacks>();
+
   // Current rank of the node.
   const int rank_;
 
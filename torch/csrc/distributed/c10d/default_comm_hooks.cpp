@@ -1,7 +1,11 @@
+#include <ATen/CPUGeneratorImpl.h>
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
 
+#include <cmath>
+
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/comm.hpp>
 #include <torch/torch.h>
@@ -43,6 +47,115 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+namespace {
+
+// In-place Gram-Schmidt over the (small number of) columns of a 2D
+// matrix. Mirrors _orthogonalize_gram_schmidt in powerSGD_hook.py with
+// epsilon=0; QR is not worth it for the low ranks this hook targets and
+// does not support half precision anyway.
+void orthogonalize(at::Tensor& matrix) {
+  const auto num_cols = matrix.size(1);
+  for (const auto i : c10::irange(num_cols)) {
+    auto col = matrix.narrow(1, i, 1);
+    col.div_(col.norm());
+    if (i + 1 < num_cols) {
+      auto rest = matrix.narrow(1, i + 1, num_cols - i - 1);
+      rest.sub_(col.matmul(col.t().matmul(rest)));
+    }
+  }
+}
+
+// The initial Q must be identical on all ranks, or the compressed factors
+// would not be averaged consistently. Sample it from a CPU generator with
+// a fixed per-bucket seed instead of synchronizing it over the wire.
+constexpr uint64_t kPowerSGDSeed = 190513727;
+
+} // namespace
+
+c10::intrusive_ptr<c10::ivalue::Future> PowerSGDCommHook::runHook(
+    GradBucket& bucket) {
+  // Run vanilla allreduce in the first `start_powerSGD_iter_` iterations;
+  // the compression error hurts convergence the most early in training.
+  if (iter_ < start_powerSGD_iter_) {
+    if (bucket.isLast()) {
+      iter_++;
+    }
+    std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
+    tensors[0] /= state_->getSize();
+    return state_->allreduce(tensors)->getFuture();
+  }
+  if (bucket.isLast()) {
+    iter_++;
+  }
+
+  at::Tensor input = bucket.getBufferRef();
+  const int64_t total_length = input.numel();
+  const auto square_side = static_cast<int64_t>(
+      std::ceil(std::sqrt(static_cast<double>(total_length))));
+  const int64_t padded_total_length = square_side * square_side;
+
+  // View the flattened bucket as a square matrix, padding with zeros.
+  input.resize_({padded_total_length});
+  input.narrow(0, total_length, padded_total_length - total_length).zero_();
+
+  const size_t bucket_index = bucket.getIndex();
+  auto& state = bucket_states_[bucket_index];
+  if (!state.error.defined() || state.error.numel() != padded_total_length) {
+    // First PowerSGD iteration for this bucket (or the bucket was rebuilt
+    // with a different size): allocate the error buffer and the low-rank
+    // factors.
+    state.error = at::zeros({padded_total_length}, input.options());
+    state.p = at::empty(
+        {square_side, matrix_approximation_rank_}, input.options());
+    auto generator = at::detail::createCPUGenerator(
+        kPowerSGDSeed + static_cast<uint64_t>(bucket_index));
+    state.q = at::randn(
+                  {square_side, matrix_approximation_rank_},
+                  generator,
+                  input.options().device(c10::kCPU))
+                  .to(input.device());
+  }
+
+  // Incorporate the local error from the previous iteration, and keep a
+  // copy of the input to compute this iteration's compression error after
+  // decompression.
+  input.add_(state.error);
+  at::Tensor input_cp = input.clone();
+  at::Tensor matrix = input.view({square_side, square_side});
+
+  orthogonalize(state.q);
+  at::matmul_out(state.p, matrix, state.q);
+
+  std::vector<at::Tensor> p_vec = {state.p};
+  auto allreduce_p_fut = state_->allreduce(p_vec)->getFuture();
+
+  const auto world_size = state_->getSize();
+  auto compute_q_and_decompress =
+      [this, bucket_index, matrix, input, input_cp, total_length, world_size](
+          c10::ivalue::Future& /* allreduce_p_fut */) -> c10::IValue {
+    auto& state = bucket_states_[bucket_index];
+    orthogonalize(state.p);
+    at::matmul_out(state.q, matrix.t(), state.p);
+
+    // The second round trip has no more local compute to overlap with, so
+    // wait for it inline (the Python hook does the same).
+    std::vector<at::Tensor> q_vec = {state.q};
+    state_->allreduce(q_vec)->wait();
+
+    state.q.div_(world_size);
+    at::matmul_out(matrix, state.p, state.q.t());
+
+    // Memorize the local compression error for the next iteration.
+    state.error = input_cp - input;
+
+    at::Tensor decompressed = input;
+    decompressed.resize_({total_length});
+    return c10::IValue(decompressed);
+  };
+
+  return allreduce_p_fut->then(compute_q_and_decompress, c10::TensorType::get());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
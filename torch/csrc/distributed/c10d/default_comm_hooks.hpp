@@ -3,11 +3,14 @@
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/comm.hpp>
 
+#include <map>
+
 namespace c10d {
 
 enum class BuiltinCommHookType {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  POWER_SGD = 3,
 };
 
 class AllReduceCommHook : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
@@ -30,6 +33,47 @@ class FP16CompressCommHook : public CppCommHookInterface<c10::intrusive_ptr<Proc
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+// C++ port of the batched PowerSGD gradient compression hook
+// (torch.distributed.algorithms.ddp_comm_hooks.powerSGD_hook.
+// batched_powerSGD_hook, see https://arxiv.org/abs/1905.13727): the
+// flattened bucket is zero-padded to a square matrix M and approximated as
+// P Q^T with rank `matrix_approximation_rank`, so only P and Q
+// (2 * side * rank elements) travel over the wire instead of side^2.
+// Error feedback and a warm-started Q are kept per bucket across
+// iterations; vanilla allreduce is used for the first
+// `start_powerSGD_iter` iterations, where the compression error hurts
+// convergence the most. Unlike the Python hook, the entire transform runs
+// in C++, so no GIL round trip sits on the allreduce path.
+class TORCH_API PowerSGDCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit PowerSGDCommHook(
+      const c10::intrusive_ptr<ProcessGroup>& state,
+      int64_t matrix_approximation_rank = 1,
+      int64_t start_powerSGD_iter = 1000)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state),
+        matrix_approximation_rank_(matrix_approximation_rank),
+        start_powerSGD_iter_(start_powerSGD_iter) {}
+
+  ~PowerSGDCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+
+ private:
+  // Compression state kept per bucket index across iterations.
+  struct BucketState {
+    at::Tensor error; // local compression error (error feedback)
+    at::Tensor p;
+    at::Tensor q; // warm-started across iterations
+  };
+
+  int64_t matrix_approximation_rank_;
+  int64_t start_powerSGD_iter_;
+  // Number of iterations seen so far; incremented on the last bucket.
+  int64_t iter_ = 0;
+  std::map<size_t, BucketState> bucket_states_;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the user.
@@ -32,6 +32,7 @@
 
 #include <fmt/format.h>
 #include <pybind11/chrono.h>
+#include <pybind11/functional.h>
 #include <torch/csrc/distributed/c10d/PrefixStore.hpp>
 
 #include <torch/csrc/distributed/c10d/comm.hpp>
@@ -441,9 +442,10 @@ Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS`` and ``POWER_SGD``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("POWER_SGD", ::c10d::BuiltinCommHookType::POWER_SGD);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -1823,6 +1825,13 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::arg("input_list"),
               py::arg("opts") = ::c10d::AllgatherOptions(),
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "allgather_streamed",
+              &::c10d::Backend::allgather_streamed,
+              py::arg("outputs"),
+              py::arg("inputs"),
+              py::arg("opts") = ::c10d::AllgatherOptions(),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "gather",
               &::c10d::Backend::gather,
@@ -2128,6 +2137,20 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               },
               py::arg("abort_reason") = py::none(),
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "_eager_connect",
+              [](const c10::intrusive_ptr<::c10d::ProcessGroupNCCL>& self,
+                 std::vector<c10::Device> devices,
+                 bool async_op) {
+                self->eagerConnect(std::move(devices), async_op);
+              },
+              py::arg("devices") = std::vector<c10::Device>(),
+              py::arg("async_op") = false,
+              py::call_guard<py::gil_scoped_release>())
+          .def(
+              "_wait_for_eager_connect",
+              &::c10d::ProcessGroupNCCL::waitForEagerConnect,
+              py::call_guard<py::gil_scoped_release>())
           .def("_group_start", &::c10d::ProcessGroupNCCL::groupStart)
           .def("_group_end", &::c10d::ProcessGroupNCCL::groupEnd)
           .def_property_readonly(
@@ -2158,7 +2181,20 @@ Example::
       .def(py::init<bool>(), py::arg("is_high_priority_stream") = false)
       .def_readwrite(
           "is_high_priority_stream",
-          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream);
+          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream)
+      .def_readwrite(
+          "coalescing_window_size",
+          &::c10d::ProcessGroupNCCL::Options::coalescing_window_size)
+      .def_readwrite(
+          "coalescing_max_numel",
+          &::c10d::ProcessGroupNCCL::Options::coalescing_max_numel)
+      .def_readwrite(
+          "use_hierarchical_allreduce",
+          &::c10d::ProcessGroupNCCL::Options::use_hierarchical_allreduce)
+      .def_readwrite(
+          "hierarchical_allreduce_min_numel",
+          &::c10d::ProcessGroupNCCL::Options::
+              hierarchical_allreduce_min_numel);
 #endif
 
 #ifdef USE_C10D_MPI
@@ -2241,6 +2277,24 @@ Example::
           &::c10d::Work::wait,
           py::arg("timeout") = kNoTimeout,
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_register_completion_callback",
+          [](::c10d::Work& work, std::function<void()> callback) {
+            work.registerCompletionCallback(
+                [callback = std::move(callback)](::c10d::Work&) {
+                  callback();
+                });
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          R"(
+            Registers a callable that runs exactly once after the work
+            completes (successfully or with an error), delivered from the
+            backend's completion thread instead of requiring a polling
+            thread. If the work has already completed, the callable runs
+            inline. The callable must not block; it may launch follow-up
+            collectives, which allows chaining communication pipelines
+            without busy-waiting.
+          )")
       .def(
           "get_future",
           [](::c10d::Work& work) -> std::shared_ptr<jit::PythonFutureWrapper> {
@@ -4,6 +4,8 @@
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
 
 #include <functional>
+#include <limits>
+#include <numeric>
 
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/ScalarType.h>
@@ -126,6 +128,18 @@ Reducer::Reducer(
               << bucket_bytes_cap_
               << " first_bucket_bytes_cap: " << first_bucket_bytes_cap;
   }
+
+  // See Note [Timing-driven bucket rebuild]
+  profile_rebucket_enabled_ = (parse_env("DDP_PROFILE_REBUCKET") == "1");
+  if (profile_rebucket_enabled_) {
+    grad_ready_time_sum_ns_.resize(params_.size(), 0);
+    grad_ready_time_count_.resize(params_.size(), 0);
+    if (ddp_debug_level_ != c10d::DebugLevel::Off) {
+      LOG(INFO) << "Reducer will profile gradient-ready times for "
+                << kProfileRebucketPasses
+                << " backward passes before rebuilding buckets.";
+    }
+  }
   // Check whether the module is multi_device_module
   {
     std::set<int> unique_devices;
@@ -622,6 +636,13 @@ void Reducer::autograd_hook(size_t index) {
 
   grad_ready_order_indices_.push_back(index);
 
+  if (profile_rebucket_enabled_ &&
+      profiled_backward_passes_ < kProfileRebucketPasses) {
+    grad_ready_time_sum_ns_[index] +=
+        current_time_in_nanos() - backward_compute_start_time_;
+    grad_ready_time_count_[index] += 1;
+  }
+
   // See Note [Skip allreducing local_used_map_dev]
   if (dynamic_graph_find_unused() || static_graph_first_iteration()) {
     // Since it gets here, this param has been used for this iteration. We want
@@ -1585,6 +1606,11 @@ void Reducer::finalize_backward() {
   if (should_collect_runtime_stats()) {
     record_backward_comm_end_time();
   }
+
+  if (profile_rebucket_enabled_ &&
+      profiled_backward_passes_ < kProfileRebucketPasses) {
+    ++profiled_backward_passes_;
+  }
 }
 
 void Reducer::runGradCallbackForVariable(
@@ -1691,6 +1717,113 @@ void Reducer::sync_bucket_indices(
   }
 }
 
+// Note [Timing-driven bucket rebuild]
+//
+// The default rebuild uses the first backward pass's gradient arrival order
+// and a static byte cap, which can leave the last bucket finishing long
+// after its communication could have started. With DDP_PROFILE_REBUCKET=1
+// the reducer instead records, for the first kProfileRebucketPasses
+// backward passes, when each parameter's gradient became ready relative to
+// the start of its pass. The rebuild then (a) orders parameters by their
+// average ready time, which is more robust to first-iteration jitter than a
+// single pass's arrival order, and (b) additionally closes a bucket
+// wherever the ready-time schedule has a large gap, so the closed bucket's
+// allreduce overlaps the remaining computation instead of waiting for the
+// byte cap to fill. Bucket indices are still broadcast from rank 0 by
+// sync_bucket_indices(), so ranks that observed different timings end up
+// with identical buckets.
+
+void Reducer::sort_rebuilt_params_by_ready_time() {
+  std::vector<double> avg_ready_ns(
+      params_.size(), std::numeric_limits<double>::max());
+  for (const auto i : c10::irange(params_.size())) {
+    if (grad_ready_time_count_[i] > 0) {
+      avg_ready_ns[i] = static_cast<double>(grad_ready_time_sum_ns_[i]) /
+          static_cast<double>(grad_ready_time_count_[i]);
+    }
+  }
+
+  std::vector<size_t> order(rebuilt_param_indices_.size());
+  std::iota(order.begin(), order.end(), 0);
+  // Parameters that never produced a gradient while profiling sort last and
+  // keep their relative order; they are marked ready in bulk at the end of
+  // the backward pass anyway.
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return avg_ready_ns[rebuilt_param_indices_[a]] <
+        avg_ready_ns[rebuilt_param_indices_[b]];
+  });
+
+  std::vector<at::Tensor> sorted_params;
+  std::vector<int64_t> sorted_indices;
+  sorted_params.reserve(rebuilt_params_.size());
+  sorted_indices.reserve(rebuilt_param_indices_.size());
+  for (const auto pos : order) {
+    sorted_params.push_back(rebuilt_params_[pos]);
+    sorted_indices.push_back(rebuilt_param_indices_[pos]);
+  }
+  rebuilt_params_ = std::move(sorted_params);
+  rebuilt_param_indices_ = std::move(sorted_indices);
+}
+
+void Reducer::split_buckets_at_ready_time_gaps(
+    std::vector<std::vector<size_t>>& bucket_indices,
+    std::vector<size_t>& per_bucket_size_limits) {
+  constexpr double kUnobserved = std::numeric_limits<double>::max();
+  auto avg_ready_ns = [&](size_t param_index) -> double {
+    return grad_ready_time_count_[param_index] > 0
+        ? static_cast<double>(grad_ready_time_sum_ns_[param_index]) /
+            static_cast<double>(grad_ready_time_count_[param_index])
+        : kUnobserved;
+  };
+
+  // Split at gaps larger than 5% of the observed backward span; smaller
+  // gaps are not worth the extra collective launch.
+  double earliest = kUnobserved;
+  double latest = 0;
+  for (const auto i : c10::irange(params_.size())) {
+    const double avg = avg_ready_ns(i);
+    if (avg != kUnobserved) {
+      earliest = std::min(earliest, avg);
+      latest = std::max(latest, avg);
+    }
+  }
+  if (latest <= earliest) {
+    return;
+  }
+  const double gap_threshold = (latest - earliest) * 0.05;
+
+  std::vector<std::vector<size_t>> split_buckets;
+  std::vector<size_t> split_limits;
+  for (const auto i : c10::irange(bucket_indices.size())) {
+    const auto& bucket = bucket_indices[i];
+    std::vector<size_t> current;
+    for (const auto j : c10::irange(bucket.size())) {
+      current.push_back(bucket[j]);
+      if (j + 1 < bucket.size()) {
+        const double cur = avg_ready_ns(bucket[j]);
+        const double next = avg_ready_ns(bucket[j + 1]);
+        if (cur != kUnobserved && next != kUnobserved &&
+            next - cur > gap_threshold) {
+          split_buckets.push_back(std::move(current));
+          split_limits.push_back(per_bucket_size_limits[i]);
+          current = std::vector<size_t>();
+        }
+      }
+    }
+    split_buckets.push_back(std::move(current));
+    split_limits.push_back(per_bucket_size_limits[i]);
+  }
+
+  if (ddp_debug_level_ != c10d::DebugLevel::Off &&
+      split_buckets.size() != bucket_indices.size()) {
+    LOG(INFO) << "Timing-driven rebuild split " << bucket_indices.size()
+              << " buckets into " << split_buckets.size()
+              << " at gradient-ready time gaps.";
+  }
+  bucket_indices = std::move(split_buckets);
+  per_bucket_size_limits = std::move(split_limits);
+}
+
 bool Reducer::rebuild_buckets() {
   // Ensure reduction for previous backwards pass is finished. If user's model
   // has unused parameters for example, this will raise an error recommending to
@@ -1702,6 +1835,16 @@ bool Reducer::rebuild_buckets() {
     return false;
   }
 
+  // See Note [Timing-driven bucket rebuild]
+  if (profile_rebucket_enabled_ &&
+      profiled_backward_passes_ < kProfileRebucketPasses) {
+    // Still profiling; drop this pass's arrival dump so the next backward
+    // pass records a fresh one.
+    rebuilt_params_.clear();
+    rebuilt_param_indices_.clear();
+    return false;
+  }
+
   TORCH_INTERNAL_ASSERT(
       rebuilt_params_.size() == rebuilt_param_indices_.size(),
       c10::str(
@@ -1717,6 +1860,10 @@ bool Reducer::rebuild_buckets() {
           params_.size(),
           " versus rebuilt params size of: ",
           rebuilt_param_indices_.size()));
+  if (profile_rebucket_enabled_) {
+    sort_rebuilt_params_by_ready_time();
+  }
+
   std::vector<std::vector<size_t>> rebuilt_bucket_indices;
   std::vector<size_t> bucket_size_limits;
   bucket_size_limits.push_back(first_bucket_bytes_cap_);
@@ -1749,6 +1896,11 @@ bool Reducer::rebuild_buckets() {
     std::reverse(per_bucket_size_limits.begin(), per_bucket_size_limits.end());
   }
 
+  if (profile_rebucket_enabled_) {
+    split_buckets_at_ready_time_gaps(
+        rebuilt_bucket_indices, per_bucket_size_limits);
+  }
+
   if (ddp_debug_level_ != c10d::DebugLevel::Off) {
     TORCH_INTERNAL_ASSERT(
         rebuilt_bucket_indices.size() == per_bucket_size_limits.size())
@@ -1798,6 +1950,10 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::POWER_SGD:
+      comm_hook_ = std::make_unique<c10d::PowerSGDCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook POWER_SGD is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
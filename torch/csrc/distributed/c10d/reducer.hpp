@@ -431,6 +431,28 @@ class TORCH_API Reducer {
   std::vector<int64_t> rebuilt_param_indices_;
   const int64_t bucket_bytes_cap_;
 
+  // Timing-driven rebucketing (DDP_PROFILE_REBUCKET=1); see Note
+  // [Timing-driven bucket rebuild] in reducer.cpp.
+  bool profile_rebucket_enabled_{false};
+  // Number of backward passes to profile before rebuilding buckets.
+  static constexpr int64_t kProfileRebucketPasses = 3;
+  int64_t profiled_backward_passes_{0};
+  // Per parameter: sum of gradient-ready times (nanoseconds relative to the
+  // start of the backward pass) and the number of profiled passes in which
+  // the parameter produced a gradient.
+  std::vector<int64_t> grad_ready_time_sum_ns_;
+  std::vector<int64_t> grad_ready_time_count_;
+
+  // Reorders rebuilt_params_/rebuilt_param_indices_ by average
+  // gradient-ready time.
+  void sort_rebuilt_params_by_ready_time();
+
+  // Splits rebuilt buckets at large gaps in the ready-time schedule so
+  // communication can start during the gap.
+  void split_buckets_at_ready_time_gaps(
+      std::vector<std::vector<size_t>>& bucket_indices,
+      std::vector<size_t>& per_bucket_size_limits);
+
 #ifndef _WIN32
   struct RpcContext {
     using ContextPtr = torch::distributed::autograd::ContextPtr;
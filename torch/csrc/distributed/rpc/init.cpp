@@ -280,6 +280,17 @@ PyObject* rpc_init(PyObject* _unused, PyObject* noargs) {
                           argument is not provided, the default RPC timeout
                           (60s) will be used.
               )")
+          .def(
+              "_set_value_cache_ttl",
+              &PyRRef::setValueCacheTTL,
+              py::arg("ttl"),
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+                  Lets ``to_here`` serve repeated reads from a local copy of
+                  the value for ``ttl`` seconds after each fetch, skipping the
+                  network for slow-changing values. A TTL of zero (the
+                  default) disables caching. Reads may be stale up to the TTL.
+              )")
           .def(
               "local_value",
               &PyRRef::localValue,
@@ -697,6 +708,13 @@ PyObject* rpc_init(PyObject* _unused, PyObject* noargs) {
     return RRefContext::getInstance().getDebugInfo();
   });
 
+  module.def(
+      "_rref_to_here_all",
+      &PyRRef::toHereAll,
+      py::arg("rrefs"),
+      py::arg("timeout") = py::cast(kUnsetRpcTimeout),
+      py::call_guard<py::gil_scoped_release>());
+
   module.def(
       "_cleanup_python_rpc_handler",
       []() { PythonRpcHandler::getInstance().cleanup(); },
@@ -84,6 +84,10 @@ enum MessageType {
   RREF_BACKWARD_REQ = 0x17 | MessageTypeFlags::REQUEST_TYPE,
   RREF_BACKWARD_RESP = 0x18 | MessageTypeFlags::RESPONSE_TYPE,
 
+  // Messages to fetch several co-located RRef values in one round trip.
+  MULTI_RREF_FETCH_CALL = 0x19 | MessageTypeFlags::REQUEST_TYPE,
+  MULTI_RREF_FETCH_RET = 0x1a | MessageTypeFlags::RESPONSE_TYPE,
+
   // Other internal message types
   EXCEPTION = 0x37 | MessageTypeFlags::RESPONSE_TYPE,
   UNKNOWN = 0x3c
@@ -208,6 +208,47 @@ py::object PyRRef::toHere(const float timeoutSeconds) const {
   }
 }
 
+std::vector<py::object> PyRRef::toHereAll(
+    const std::vector<PyRRef>& rrefs,
+    const float timeoutSeconds) {
+  std::vector<py::object> results(rrefs.size());
+
+  // Batch the user RRefs holding non-Python values; everything else keeps its
+  // existing fetch path.
+  std::vector<size_t> batchedIndices;
+  std::vector<c10::intrusive_ptr<UserRRef>> batchedRRefs;
+  for (size_t i = 0; i < rrefs.size(); ++i) {
+    const auto& rref = rrefs[i].rref_;
+    if (rref->isOwner() || rref->isPyObj()) {
+      results[i] = rrefs[i].toHere(timeoutSeconds);
+    } else {
+      batchedIndices.emplace_back(i);
+      batchedRRefs.emplace_back(
+          c10::static_intrusive_pointer_cast<UserRRef>(rref));
+    }
+  }
+
+  auto values = UserRRef::toHereAll(batchedRRefs, timeoutSeconds);
+  {
+    // acquiring GIL as torch::jit::toPyObject creates new py::object
+    // without grabbing the GIL.
+    pybind11::gil_scoped_acquire ag;
+    for (size_t j = 0; j < values.size(); ++j) {
+      results[batchedIndices[j]] = torch::jit::toPyObject(std::move(values[j]));
+    }
+  }
+  return results;
+}
+
+void PyRRef::setValueCacheTTL(double seconds) {
+  TORCH_CHECK(
+      !rref_->isOwner(),
+      "Value caching only applies to user RRefs; the owner always reads "
+      "the local value.");
+  c10::static_intrusive_pointer_cast<UserRRef>(rref_)->setValueCacheTTL(
+      seconds);
+}
+
 py::object PyRRef::localValue() const {
   TORCH_CHECK(
       rref_->isOwner(),
@@ -27,6 +27,17 @@ class PYBIND11_EXPORT PyRRef {
   py::object toHere(
       const float timeoutSeconds =
           torch::distributed::rpc::kUnsetRpcTimeout) const;
+  // Fetch the values of several RRefs with one message per owner worker.
+  // Owner RRefs are served locally and Python-object RRefs fall back to
+  // per-RRef fetches; the rest go through UserRRef::toHereAll.
+  static std::vector<py::object> toHereAll(
+      const std::vector<PyRRef>& rrefs,
+      const float timeoutSeconds =
+          torch::distributed::rpc::kUnsetRpcTimeout);
+  // Enables serving repeated toHere() reads from a local copy for the given
+  // number of seconds after each fetch. Zero disables caching. Only valid on
+  // user RRefs.
+  void setValueCacheTTL(double seconds);
   py::object localValue() const;
   std::string str() const;
   py::tuple pickle() const;
@@ -1,6 +1,7 @@
 #include <torch/csrc/distributed/rpc/request_callback_no_python.h>
 
 #include <c10/core/StreamGuard.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/distributed/autograd/context/container.h>
 #include <torch/csrc/distributed/autograd/engine/dist_engine.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/cleanup_autograd_context_req.h>
@@ -252,6 +253,32 @@ c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
   C10_THROW_ERROR(Error, "Python call not supported!");
 }
 
+c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
+    processMultiRRefFetchCall(RpcCommandBase& rpc) const {
+  auto& mrf = static_cast<MultiRRefFetchCall&>(rpc);
+
+  c10::List<c10::intrusive_ptr<JitFuture>> valueFutures(
+      c10::FutureType::create(c10::AnyType::get()));
+  valueFutures.reserve(mrf.rrefIds().size());
+  for (const auto& rrefId : mrf.rrefIds()) {
+    valueFutures.emplace_back(retrieveOwnerRRef(rrefId));
+  }
+
+  return c10::collectAll(valueFutures)
+      ->then(
+          [](JitFuture& future) {
+            auto futures = future.value().toList();
+            std::vector<IValue> values;
+            values.reserve(futures.size());
+            for (const auto i : c10::irange(futures.size())) {
+              values.emplace_back(futures.get(i).toFuture()->value());
+            }
+            return withStorages(
+                MultiRRefFetchRet(std::move(values)).toMessage());
+          },
+          c10::getCustomClassType<c10::intrusive_ptr<Message>>());
+}
+
 c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::processRRefUserDelete(
     RpcCommandBase& rpc) const {
   auto& rud = static_cast<RRefUserDelete&>(rpc);
@@ -521,6 +548,9 @@ c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::processRpc(
     case MessageType::PYTHON_RREF_FETCH_CALL: {
       return processPythonRRefFetchCall(rpc);
     }
+    case MessageType::MULTI_RREF_FETCH_CALL: {
+      return processMultiRRefFetchCall(rpc);
+    }
     case MessageType::RREF_USER_DELETE: {
       return processRRefUserDelete(rpc);
     }
@@ -10,6 +10,8 @@
 #include <torch/csrc/distributed/rpc/rref_proto.h>
 #include <torch/csrc/distributed/rpc/utils.h>
 
+#include <map>
+
 namespace {
 // If the type is subtype of named type, return its qualifiedname, otherwise
 // return its type str.
@@ -140,6 +142,9 @@ IValue UserRRef::toHere(const float timeoutSeconds) const {
       !deletedOnOwner_,
       *this,
       " has been deleted. Cannot call to_here() on it after deletion.");
+  if (auto cachedValue = tryGetCachedValue()) {
+    return *std::move(cachedValue);
+  }
   auto toHereKey = std::string("");
   if (torch::autograd::profiler::profilerEnabled()) {
     toHereKey = fmt::format(
@@ -197,13 +202,128 @@ IValue UserRRef::toHere(const float timeoutSeconds) const {
       "or PYTHON_RREF_FETCH_RET");
   RpcCommandBase& rpc = *response;
   auto& rrefFetchRet = static_cast<RRefFetchRet&>(rpc);
+  IValue ret;
   if (isPyObj()) {
     // wrap python serialized vector of ivalues into tuple, this
     // made the C++ toHere interface to return single IValue
-    return ivalue::Tuple::create(rrefFetchRet.values());
+    ret = ivalue::Tuple::create(rrefFetchRet.values());
   } else {
-    return rrefFetchRet.values().front();
+    ret = rrefFetchRet.values().front();
+  }
+  maybeCacheValue(ret);
+  return ret;
+}
+
+std::vector<IValue> UserRRef::toHereAll(
+    const std::vector<c10::intrusive_ptr<UserRRef>>& rrefs,
+    const float timeoutSeconds) {
+  std::vector<IValue> results(rrefs.size());
+  // Indices that still need a network fetch, grouped by owner so that each
+  // owner is visited with a single message.
+  std::map<worker_id_t, std::vector<size_t>> byOwner;
+  for (size_t i = 0; i < rrefs.size(); ++i) {
+    const auto& rref = rrefs[i];
+    TORCH_CHECK(rref, "to_here_all expects non-null RRefs.");
+    TORCH_CHECK(
+        !rref->isPyObj(),
+        *rref,
+        " holds a Python object. Batched fetches only support non-Python "
+        "values; call to_here() on it instead.");
+    TORCH_CHECK(
+        !rref->getTimedOut(),
+        "RRef creation via rpc.remote() timed out, and it "
+        "is possible that the RRef on the owner node does not exist.");
+    // see Note [Best-Effort Check on Deleted UserRRefs]
+    TORCH_CHECK(
+        !rref->deletedOnOwner_,
+        *rref,
+        " has been deleted. Cannot call to_here_all() on it after deletion.");
+    TORCH_CHECK(
+        !rref->type_->is_module(),
+        *rref,
+        " is an RRef to a ScriptModule. It can't be sent through RPC from "
+        "owner, ",
+        rref->ownerWorkerInfo(),
+        ".");
+    if (auto cachedValue = rref->tryGetCachedValue()) {
+      results[i] = *std::move(cachedValue);
+      continue;
+    }
+    byOwner[rref->ownerId_].emplace_back(i);
+  }
+
+  auto agent = RpcAgent::getCurrentRpcAgent();
+  std::vector<std::pair<std::vector<size_t>, c10::intrusive_ptr<JitFuture>>>
+      pendingFetches;
+  pendingFetches.reserve(byOwner.size());
+  for (auto& entry : byOwner) {
+    std::vector<RRefId> rrefIds;
+    rrefIds.reserve(entry.second.size());
+    for (const auto idx : entry.second) {
+      rrefIds.emplace_back(rrefs[idx]->rrefId());
+    }
+    auto jitFuture = autograd::sendMessageWithAutograd(
+        *agent,
+        agent->getWorkerInfo(entry.first),
+        MultiRRefFetchCall(entry.first, std::move(rrefIds)).toMessage(),
+        true /* forceGradRecording */,
+        timeoutSeconds,
+        true /* forceDisableProfiling */);
+    pendingFetches.emplace_back(std::move(entry.second), std::move(jitFuture));
+  }
+
+  for (auto& pendingFetch : pendingFetches) {
+    pendingFetch.second->waitAndThrow();
+    auto messagePtr = pendingFetch.second->constValue().toCustomClass<Message>();
+    MessageType msgType = messagePtr->type();
+    auto response = deserializeResponse(*messagePtr, msgType);
+    TORCH_INTERNAL_ASSERT(
+        msgType == MessageType::MULTI_RREF_FETCH_RET,
+        "Message type should be MULTI_RREF_FETCH_RET");
+    auto& rrefFetchRet = static_cast<RRefFetchRet&>(*response);
+    const auto& values = rrefFetchRet.values();
+    TORCH_INTERNAL_ASSERT(
+        values.size() == pendingFetch.first.size(),
+        "MULTI_RREF_FETCH_RET is expected to carry one value per RRef");
+    for (size_t j = 0; j < values.size(); ++j) {
+      const auto idx = pendingFetch.first[j];
+      rrefs[idx]->maybeCacheValue(values[j]);
+      results[idx] = values[j];
+    }
+  }
+  return results;
+}
+
+void UserRRef::setValueCacheTTL(double seconds) {
+  TORCH_CHECK(seconds >= 0, "Value cache TTL can't be negative.");
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  cacheTTLSeconds_ = seconds;
+  if (seconds == 0) {
+    cachedValue_ = IValue();
+  }
+}
+
+c10::optional<IValue> UserRRef::tryGetCachedValue() const {
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  if (cacheTTLSeconds_ == 0 || cachedValue_.isNone()) {
+    return c10::nullopt;
+  }
+  if (std::chrono::steady_clock::now() >= cacheExpiry_) {
+    cachedValue_ = IValue();
+    return c10::nullopt;
+  }
+  return cachedValue_;
+}
+
+void UserRRef::maybeCacheValue(const IValue& value) const {
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  if (cacheTTLSeconds_ == 0) {
+    return;
   }
+  cachedValue_ = value;
+  cacheExpiry_ = std::chrono::steady_clock::now() +
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(cacheTTLSeconds_));
 }
 
 RRefForkData UserRRef::fork() const {
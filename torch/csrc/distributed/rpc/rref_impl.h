@@ -9,6 +9,7 @@
 #include <torch/csrc/distributed/rpc/types.h>
 
 #include <atomic>
+#include <chrono>
 
 namespace torch {
 namespace distributed {
@@ -315,6 +316,21 @@ class TORCH_API UserRRef final : public RRef {
       const float timeoutSeconds =
           torch::distributed::rpc::kUnsetRpcTimeout) const;
 
+  // Fetch the values of multiple UserRRefs with one message per owner worker
+  // instead of one round trip per RRef. All given RRefs must hold non-Python
+  // values, as Python objects need their own serialization format and keep
+  // using toHere(). Values are returned in the order of the input RRefs.
+  static std::vector<IValue> toHereAll(
+      const std::vector<c10::intrusive_ptr<UserRRef>>& rrefs,
+      const float timeoutSeconds =
+          torch::distributed::rpc::kUnsetRpcTimeout);
+
+  // Let toHere() serve repeated reads from a local copy of the value for
+  // ``seconds`` after each fetch. A TTL of zero (the default) disables
+  // caching and drops any stored copy. Intended for slow-changing values
+  // such as parameter-server weights; reads may be stale up to the TTL.
+  void setValueCacheTTL(double seconds);
+
   void tryDel() override;
 
   // Will be called when refcount reaches 0.
@@ -335,8 +351,22 @@ class TORCH_API UserRRef final : public RRef {
     confirmedByOwner_ = true;
   }
 
+  // Returns the cached value if caching is enabled and the copy is still
+  // within its TTL.
+  c10::optional<IValue> tryGetCachedValue() const;
+
+  // Stores a copy of the fetched value when caching is enabled.
+  void maybeCacheValue(const IValue& value) const;
+
   const ForkId forkId_;
 
+  // Guards the TTL value cache below. The cached members are mutable because
+  // toHere() is const and fills the cache as a side effect.
+  mutable std::mutex cacheMutex_;
+  mutable IValue cachedValue_;
+  mutable std::chrono::steady_clock::time_point cacheExpiry_;
+  double cacheTTLSeconds_{0};
+
   // Indicates if this user has sent delete message to it's owner.
   // Note, thread safety is needed because delete message could be sent by
   // either the destructor called by Python garbage collection or RRefContext
@@ -79,6 +79,29 @@ class TORCH_API PythonRRefFetchCall final : public RRefMessageBase {
   const worker_id_t fromWorkerId_;
 };
 
+// A user uses this message to fetch the values of several RRefs co-located on
+// one owner in a single round trip. Only non-Python RRefs may be batched, as
+// Python object values need their own serialization format.
+class TORCH_API MultiRRefFetchCall final : public RpcCommandBase {
+ public:
+  MultiRRefFetchCall(worker_id_t fromWorkerId, std::vector<RRefId> rrefIds)
+      : fromWorkerId_(fromWorkerId), rrefIds_(std::move(rrefIds)) {}
+
+  inline worker_id_t fromWorkerId() const {
+    return fromWorkerId_;
+  }
+
+  const std::vector<RRefId>& rrefIds() const;
+
+  c10::intrusive_ptr<Message> toMessageImpl() && override;
+  static std::unique_ptr<MultiRRefFetchCall> fromMessage(
+      const Message& message);
+
+ private:
+  const worker_id_t fromWorkerId_;
+  const std::vector<RRefId> rrefIds_;
+};
+
 // OwnerRRef uses this message to send the RRef value to a remote UserRRef
 class TORCH_API RRefFetchRet : public RpcCommandBase {
  public:
@@ -111,6 +134,17 @@ class TORCH_API PythonRRefFetchRet final : public RRefFetchRet {
       const Message& message);
 };
 
+// Carries one value per RRefId in the matching MultiRRefFetchCall, in the
+// same order.
+class TORCH_API MultiRRefFetchRet final : public RRefFetchRet {
+ public:
+  explicit MultiRRefFetchRet(std::vector<at::IValue> values)
+      : RRefFetchRet(std::move(values), MessageType::MULTI_RREF_FETCH_RET) {}
+
+  static std::unique_ptr<MultiRRefFetchRet> fromMessage(
+      const Message& message);
+};
+
 // UserRRef (regardless it's the creator or not) uses this message to notify
 // OwnerRRef on delete.
 class TORCH_API RRefUserDelete final : public ForkMessageBase {
@@ -599,20 +599,39 @@ void TensorPipeAgent::pipeWrite(
     std::vector<c10::Device>&& devices,
     std::vector<c10::Stream> streams,
     std::function<void(const tensorpipe::Error&)> fn) noexcept {
-  tensorpipe::Message tpMessage;
-  TensorpipeWriteBuffers tpBuffers;
-
-  std::tie(tpMessage, tpBuffers) =
-      tensorpipeSerialize(std::move(rpcMessage), std::move(devices), streams);
-
-  pipe->write(
-      std::move(tpMessage),
-      [tpBuffers{
-           std::make_shared<TensorpipeWriteBuffers>(std::move(tpBuffers))},
-       fn{std::move(fn)},
-       streams{std::move(streams)}](const tensorpipe::Error& error) {
-        fn(error);
-      });
+  // Serialization is deferred to the thread pool so that callers (notably the
+  // trainer thread inside send()) only pay for bookkeeping on the critical
+  // path. Tensor data is handed to TensorPipe by pointer, so the deferred work
+  // is the pickle pass over the metadata, not a copy of the tensor payloads.
+  // Messages carry their own IDs, hence the order in which deferred writes hit
+  // the pipe doesn't matter for request/response matching.
+  threadPool_.run([pipe,
+                   rpcMessage{std::move(rpcMessage)},
+                   devices{std::move(devices)},
+                   streams{std::move(streams)},
+                   fn{std::move(fn)}]() mutable {
+    tensorpipe::Message tpMessage;
+    TensorpipeWriteBuffers tpBuffers;
+
+    try {
+      std::tie(tpMessage, tpBuffers) = tensorpipeSerialize(
+          std::move(rpcMessage), std::move(devices), streams);
+    } catch (const std::exception& e) {
+      // pipeWrite is noexcept: before serialization moved off the caller
+      // thread a failure here was fatal, and the thread pool would otherwise
+      // swallow the exception and leave the RPC to time out silently.
+      LOG(FATAL) << "Failed to serialize outgoing RPC message: " << e.what();
+    }
+
+    pipe->write(
+        std::move(tpMessage),
+        [tpBuffers{
+             std::make_shared<TensorpipeWriteBuffers>(std::move(tpBuffers))},
+         fn{std::move(fn)},
+         streams{std::move(streams)}](const tensorpipe::Error& error) {
+          fn(error);
+        });
+  });
 }
 
 void TensorPipeAgent::sendCompletedResponseMessage(
@@ -116,6 +116,9 @@ std::unique_ptr<RpcCommandBase> deserializeRequest(const Message& request) {
     case MessageType::PYTHON_RREF_FETCH_CALL: {
       return PythonRRefFetchCall::fromMessage(request);
     }
+    case MessageType::MULTI_RREF_FETCH_CALL: {
+      return MultiRRefFetchCall::fromMessage(request);
+    }
     case MessageType::RREF_USER_DELETE: {
       return RRefUserDelete::fromMessage(request);
     }
@@ -166,6 +169,9 @@ std::unique_ptr<RpcCommandBase> deserializeResponse(
     case MessageType::PYTHON_RREF_FETCH_RET: {
       return PythonRRefFetchRet::fromMessage(response);
     }
+    case MessageType::MULTI_RREF_FETCH_RET: {
+      return MultiRRefFetchRet::fromMessage(response);
+    }
     case MessageType::RREF_ACK: {
       return RRefAck::fromMessage(response);
     }
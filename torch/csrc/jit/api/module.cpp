@@ -2,6 +2,7 @@
 #include <ATen/record_function.h>
 #include <c10/util/Exception.h>
 #include <c10/util/StringUtil.h>
+#include <c10/util/flat_hash_map.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/autograd/generated/variable_factories.h>
 #include <torch/csrc/jit/api/function_impl.h>
@@ -12,6 +13,7 @@
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/freeze_module.h>
+#include <torch/csrc/jit/passes/frozen_auto_layout.h>
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
@@ -19,6 +21,8 @@
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
+#include <mutex>
+
 namespace torch::jit {
 
 namespace {
@@ -100,6 +104,342 @@ void assert_ignored_attributes_not_referenced(
       "'. This is not permitted.");
 }
 
+// Note [Compiled clone plans]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Module::deepcopy is hot in serving setups that clone a template module per
+// worker or per request. The generic IValue::deepcopy walks the object graph
+// recursively, consults an IValue-keyed hash map for every subvalue to
+// preserve aliasing, and does string-keyed __getstate__/__setstate__ method
+// lookups for every object it visits. The shape of that walk is fixed by the
+// module's type (plus the sizes of its container attributes), so the first
+// deepcopy of a ClassType records a flat instruction list describing it:
+// which positions are tensors to clone, which are immutable leaves to copy
+// as-is, and where an alias resolves to the output of an earlier
+// instruction. Later deepcopies of modules with the same type replay the
+// list in one linear pass over the source.
+//
+// Replay re-reads every leaf from the source object (attribute values change
+// between clones; only the structure is cached) and validates tags,
+// container sizes and alias identity as it goes, so a stale or mismatched
+// plan can produce a fallback to the generic path but never a wrong copy.
+// Values the plan doesn't model — objects with __getstate__, enums, sparse
+// or storageless tensors, capsules — make recording fail, and such types
+// always take the generic path.
+struct CloneInstruction {
+  enum class Op : uint8_t {
+    kCopyImmutable, // primitives and strings; the IValue is copied as-is
+    kCloneTensor,
+    kBuildTuple, // arg: element count
+    kBuildList, // arg: element count
+    kBuildDict, // arg: entry count
+    kBuildObject, // arg: slot count
+    kAlias, // arg: position of the earlier instruction whose output to reuse
+  };
+  Op op;
+  int64_t arg;
+};
+
+// Identity used to resolve aliases, mirroring IValue::HashAliasedIValue:
+// storage pointer for tensors, object pointer for the other reference
+// types. Returns nullptr for values that cannot alias and nullopt for
+// tensors whose alias analysis the plan does not attempt.
+c10::optional<const void*> cloneAliasKey(const IValue& v) {
+  if (v.isTensor()) {
+    const auto& t = v.toTensor();
+    if (!t.defined() || t.is_sparse() || t.is_sparse_csr() ||
+        !t.has_storage()) {
+      return c10::nullopt;
+    }
+    return t.storage().unsafeGetStorageImpl();
+  }
+  if (v.isTuple() || v.isList() || v.isGenericDict() || v.isObject()) {
+    return v.internalToPointer();
+  }
+  return static_cast<const void*>(nullptr);
+}
+
+bool isCloneImmutable(const IValue& v) {
+  return v.isString() || v.isNone() || v.isDouble() || v.isInt() ||
+      v.isSymInt() || v.isSymFloat() || v.isSymBool() || v.isBool() ||
+      v.isDevice();
+}
+
+class ClonePlan {
+ public:
+  // Records the deepcopy of `src` as a flat instruction list. Returns false
+  // if the value graph contains something replay doesn't handle; in that
+  // case the plan must not be used.
+  bool record(const IValue& src) {
+    plan_.clear();
+    ska::flat_hash_map<const void*, int64_t> seen;
+    return recordValue(src, seen);
+  }
+
+  // Replays the recorded instructions against `src`. Returns nullopt on any
+  // structural mismatch; the caller then falls back to the generic deepcopy.
+  c10::optional<IValue> replay(const IValue& src) const {
+    ReplayState state;
+    state.outputs.resize(plan_.size());
+    auto result = replayValue(src, state);
+    if (result && state.ip != plan_.size()) {
+      return c10::nullopt;
+    }
+    return result;
+  }
+
+ private:
+  struct ReplayState {
+    size_t ip = 0;
+    std::vector<IValue> outputs;
+    ska::flat_hash_map<const void*, int64_t> seen;
+    // Types already checked for __getstate__/__setstate__ in this replay.
+    ska::flat_hash_set<const c10::ClassType*> checked_types;
+  };
+
+  bool recordValue(
+      const IValue& src,
+      ska::flat_hash_map<const void*, int64_t>& seen) {
+    auto key = cloneAliasKey(src);
+    if (!key) {
+      return false;
+    }
+    auto pos = static_cast<int64_t>(plan_.size());
+    if (*key != nullptr) {
+      auto it = seen.find(*key);
+      if (it != seen.end()) {
+        plan_.push_back({CloneInstruction::Op::kAlias, it->second});
+        return true;
+      }
+      seen.emplace(*key, pos);
+    }
+    if (src.isTensor()) {
+      plan_.push_back({CloneInstruction::Op::kCloneTensor, 0});
+      return true;
+    }
+    if (src.isTuple()) {
+      const auto& elements = src.toTupleRef().elements();
+      plan_.push_back(
+          {CloneInstruction::Op::kBuildTuple,
+           static_cast<int64_t>(elements.size())});
+      for (const auto& e : elements) {
+        if (!recordValue(e, seen)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (src.isList()) {
+      auto list = src.toList();
+      plan_.push_back(
+          {CloneInstruction::Op::kBuildList,
+           static_cast<int64_t>(list.size())});
+      for (const IValue v : list) {
+        if (!recordValue(v, seen)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (src.isGenericDict()) {
+      auto dict = src.toGenericDict();
+      plan_.push_back(
+          {CloneInstruction::Op::kBuildDict,
+           static_cast<int64_t>(dict.size())});
+      for (const auto& entry : dict) {
+        if (!recordValue(entry.key(), seen) ||
+            !recordValue(entry.value(), seen)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (src.isObject()) {
+      auto obj = src.toObject();
+      auto classType = obj->type();
+      if (classType->hasMethod("__getstate__") &&
+          classType->hasMethod("__setstate__")) {
+        return false;
+      }
+      plan_.push_back(
+          {CloneInstruction::Op::kBuildObject,
+           static_cast<int64_t>(obj->slots().size())});
+      for (const auto& slot : obj->slots()) {
+        if (slot.isCapsule()) {
+          // Custom class without serialization methods; the generic path
+          // produces the informative error for this.
+          return false;
+        }
+        if (!recordValue(slot, seen)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (isCloneImmutable(src)) {
+      plan_.push_back({CloneInstruction::Op::kCopyImmutable, 0});
+      return true;
+    }
+    // Enums, futures, generators, ...
+    return false;
+  }
+
+  c10::optional<IValue> replayValue(const IValue& src, ReplayState& state)
+      const {
+    if (state.ip >= plan_.size()) {
+      return c10::nullopt;
+    }
+    const CloneInstruction inst = plan_[state.ip];
+    const auto pos = static_cast<int64_t>(state.ip++);
+    auto key = cloneAliasKey(src);
+    if (!key) {
+      return c10::nullopt;
+    }
+    if (*key != nullptr) {
+      auto it = state.seen.find(*key);
+      if (it != state.seen.end()) {
+        if (inst.op != CloneInstruction::Op::kAlias ||
+            inst.arg != it->second) {
+          return c10::nullopt;
+        }
+        return state.outputs[it->second];
+      }
+      if (inst.op == CloneInstruction::Op::kAlias) {
+        return c10::nullopt;
+      }
+      state.seen.emplace(*key, pos);
+    } else if (inst.op == CloneInstruction::Op::kAlias) {
+      return c10::nullopt;
+    }
+    IValue result;
+    switch (inst.op) {
+      case CloneInstruction::Op::kCopyImmutable: {
+        if (!isCloneImmutable(src)) {
+          return c10::nullopt;
+        }
+        result = src;
+      } break;
+      case CloneInstruction::Op::kCloneTensor: {
+        if (!src.isTensor()) {
+          return c10::nullopt;
+        }
+        result = IValue(src.toTensor().clone());
+      } break;
+      case CloneInstruction::Op::kBuildTuple: {
+        if (!src.isTuple()) {
+          return c10::nullopt;
+        }
+        const auto& elements = src.toTupleRef().elements();
+        if (static_cast<int64_t>(elements.size()) != inst.arg) {
+          return c10::nullopt;
+        }
+        std::vector<IValue> copied;
+        copied.reserve(elements.size());
+        for (const auto& e : elements) {
+          auto child = replayValue(e, state);
+          if (!child) {
+            return c10::nullopt;
+          }
+          copied.emplace_back(std::move(*child));
+        }
+        result = IValue(c10::ivalue::Tuple::create(std::move(copied)));
+      } break;
+      case CloneInstruction::Op::kBuildList: {
+        if (!src.isList()) {
+          return c10::nullopt;
+        }
+        auto list = src.toList();
+        if (static_cast<int64_t>(list.size()) != inst.arg) {
+          return c10::nullopt;
+        }
+        auto copied = c10::impl::GenericList(list.elementType());
+        copied.reserve(list.size());
+        for (const IValue v : list) {
+          auto child = replayValue(v, state);
+          if (!child) {
+            return c10::nullopt;
+          }
+          copied.push_back(std::move(*child));
+        }
+        result = IValue(copied);
+      } break;
+      case CloneInstruction::Op::kBuildDict: {
+        if (!src.isGenericDict()) {
+          return c10::nullopt;
+        }
+        auto dict = src.toGenericDict();
+        if (static_cast<int64_t>(dict.size()) != inst.arg) {
+          return c10::nullopt;
+        }
+        auto copied = c10::impl::GenericDict(dict.keyType(), dict.valueType());
+        for (const auto& entry : dict) {
+          auto copied_key = replayValue(entry.key(), state);
+          if (!copied_key) {
+            return c10::nullopt;
+          }
+          auto copied_value = replayValue(entry.value(), state);
+          if (!copied_value) {
+            return c10::nullopt;
+          }
+          copied.insert(std::move(*copied_key), std::move(*copied_value));
+        }
+        result = IValue(copied);
+      } break;
+      case CloneInstruction::Op::kBuildObject: {
+        if (!src.isObject()) {
+          return c10::nullopt;
+        }
+        auto obj = src.toObject();
+        if (static_cast<int64_t>(obj->slots().size()) != inst.arg) {
+          return c10::nullopt;
+        }
+        auto classType = obj->type();
+        if (state.checked_types.insert(classType.get()).second) {
+          if (classType->hasMethod("__getstate__") &&
+              classType->hasMethod("__setstate__")) {
+            return c10::nullopt;
+          }
+        }
+        // copy() preserves the weak/strong compilation-unit reference; the
+        // shallow slot values are all overwritten below.
+        auto copied = obj->copy();
+        for (const auto i : c10::irange(obj->slots().size())) {
+          auto child = replayValue(obj->getSlot(i), state);
+          if (!child) {
+            return c10::nullopt;
+          }
+          copied->setSlot(i, std::move(*child));
+        }
+        result = IValue(std::move(copied));
+      } break;
+      case CloneInstruction::Op::kAlias: {
+        // Handled by the alias bookkeeping above; reaching here means the
+        // source no longer aliases what it did at record time.
+        return c10::nullopt;
+      }
+    }
+    if (*key != nullptr) {
+      state.outputs[pos] = result;
+    }
+    return result;
+  }
+
+  std::vector<CloneInstruction> plan_;
+};
+
+std::mutex& clonePlanCacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+ska::flat_hash_map<const c10::ClassType*, std::shared_ptr<const ClonePlan>>&
+clonePlanCache() {
+  static ska::flat_hash_map<
+      const c10::ClassType*,
+      std::shared_ptr<const ClonePlan>>
+      cache;
+  return cache;
+}
+
 } // namespace
 
 static ObjectPtr create_module_object(
@@ -313,7 +653,37 @@ Module Module::copy() const {
 }
 
 Module Module::deepcopy() const {
-  return Module(_ivalue()->deepcopy());
+  // See Note [Compiled clone plans].
+  const auto& obj = _ivalue();
+  const auto* cls = obj->type().get();
+  std::shared_ptr<const ClonePlan> plan;
+  {
+    std::lock_guard<std::mutex> lock(clonePlanCacheMutex());
+    auto it = clonePlanCache().find(cls);
+    if (it != clonePlanCache().end()) {
+      plan = it->second;
+    }
+  }
+  IValue self(obj);
+  if (plan) {
+    if (auto copied = plan->replay(self)) {
+      return Module(copied->toObject());
+    }
+    // The module's structure drifted since the plan was recorded (e.g. a
+    // container attribute changed size); re-record below.
+  }
+  auto fresh = std::make_shared<ClonePlan>();
+  const bool plannable = fresh->record(self);
+  Module copy(obj->deepcopy());
+  {
+    std::lock_guard<std::mutex> lock(clonePlanCacheMutex());
+    if (plannable) {
+      clonePlanCache()[cls] = std::move(fresh);
+    } else {
+      clonePlanCache().erase(cls);
+    }
+  }
+  return copy;
 }
 
 Module Module::clone(bool inplace) const {
@@ -488,7 +858,10 @@ namespace {
 void optimize_for_inference(std::shared_ptr<Graph> graph) {
   FuseFrozenConvAddRelu(graph);
   ConvertFrozenOpsToMKLDNN(graph);
-  FrozenLinearTranspose(graph);
+  // Measures linear vs. transposed-weight matmul on this machine and only
+  // rewrites the layouts that win, instead of transposing unconditionally
+  // (FrozenLinearTranspose remains available as a standalone pass).
+  FrozenLinearAutoLayout(graph);
 }
 } // namespace
 
@@ -15,10 +15,10 @@ Object::Object(
           type->numAttributes())) {}
 
 c10::optional<Method> Object::find_method(const std::string& basename) const {
-  for (Function* fn : type()->methods()) {
-    if (fn->name() == basename) {
-      return Method(_ivalue(), fn);
-    }
+  // Resolved through the ClassType name index rather than a scan over
+  // methods(); this is on the dispatch path for custom-class calls.
+  if (Function* fn = type()->findMethod(basename)) {
+    return Method(_ivalue(), fn);
   }
   return c10::nullopt;
 }
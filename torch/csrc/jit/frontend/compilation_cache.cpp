@@ -0,0 +1,216 @@
+#include <torch/csrc/jit/frontend/compilation_cache.h>
+
+#include <c10/util/xxh64.h>
+#include <caffe2/serialize/versions.h>
+#include <torch/csrc/jit/api/compilation_unit.h>
+#include <torch/csrc/jit/api/function_impl.h>
+#include <torch/csrc/jit/frontend/function_schema_parser.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Bump when the on-disk layout (schema line + IR text) changes.
+constexpr uint64_t kFrontendCacheFormatVersion = 1;
+
+std::mutex cache_dir_mutex;
+std::string cache_dir = []() {
+  const char* env = std::getenv("TORCH_JIT_FRONTEND_CACHE_DIR");
+  return env != nullptr ? std::string(env) : std::string();
+}();
+
+std::atomic<int64_t> cache_hits{0};
+std::atomic<int64_t> cache_misses{0};
+std::atomic<int64_t> cache_stores{0};
+
+std::string currentCacheDir() {
+  std::lock_guard<std::mutex> lock(cache_dir_mutex);
+  return cache_dir;
+}
+
+std::string artifactPath(
+    const std::string& dir,
+    const Def& def,
+    const c10::optional<size_t>& operator_set_version) {
+  const auto source = def.range().text().str();
+  uint64_t seed = c10::util::xxh64(
+      &caffe2::serialize::kProducedFileFormatVersion,
+      sizeof(caffe2::serialize::kProducedFileFormatVersion),
+      kFrontendCacheFormatVersion);
+  if (operator_set_version.has_value()) {
+    const uint64_t version = *operator_set_version;
+    seed = c10::util::xxh64(&version, sizeof(version), seed);
+  }
+  const uint64_t key = c10::util::xxh64(source.data(), source.size(), seed);
+  std::ostringstream path;
+  path << dir << "/" << std::hex << std::setw(16) << std::setfill('0') << key
+       << ".jit";
+  return path.str();
+}
+
+bool typeIsCacheSafe(const c10::TypePtr& type) {
+  if (type->kind() == c10::TypeKind::ClassType ||
+      type->kind() == c10::TypeKind::InterfaceType ||
+      type->kind() == c10::TypeKind::FunctionType) {
+    return false;
+  }
+  for (const auto& contained : type->containedTypes()) {
+    if (!typeIsCacheSafe(contained)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool blockIsCacheSafe(const Block* block) {
+  for (const Value* input : block->inputs()) {
+    if (!typeIsCacheSafe(input->type())) {
+      return false;
+    }
+  }
+  for (const Node* node : block->nodes()) {
+    // Tensor constants are materialized with uninitialized contents by
+    // the IR parser and subgraph attributes do not round-trip through
+    // IR text at all.
+    for (const auto& name : node->attributeNames()) {
+      const auto kind = node->kindOf(name);
+      if (kind == AttributeKind::t || kind == AttributeKind::ts ||
+          kind == AttributeKind::g || kind == AttributeKind::gs ||
+          kind == AttributeKind::ival) {
+        return false;
+      }
+    }
+    for (const Value* output : node->outputs()) {
+      if (!typeIsCacheSafe(output->type())) {
+        return false;
+      }
+    }
+    for (const Block* sub : node->blocks()) {
+      if (!blockIsCacheSafe(sub)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool graphIsCacheSafe(const Graph& graph) {
+  return blockIsCacheSafe(graph.block());
+}
+
+} // namespace
+
+void setFrontendCompilationCacheDir(std::string dir) {
+  std::lock_guard<std::mutex> lock(cache_dir_mutex);
+  cache_dir = std::move(dir);
+}
+
+std::string getFrontendCompilationCacheDir() {
+  return currentCacheDir();
+}
+
+FrontendCompilationCacheStats getFrontendCompilationCacheStats() {
+  FrontendCompilationCacheStats stats;
+  stats.hits = cache_hits.load();
+  stats.misses = cache_misses.load();
+  stats.stores = cache_stores.load();
+  return stats;
+}
+
+bool tryLoadFromCompilationCache(
+    const Def& def,
+    const Self* self,
+    GraphFunction& method) {
+  const auto dir = currentCacheDir();
+  if (dir.empty() || self != nullptr) {
+    return false;
+  }
+  const auto path =
+      artifactPath(dir, def, method.graph()->get_op_version());
+  std::ifstream file(path);
+  if (!file) {
+    ++cache_misses;
+    return false;
+  }
+  std::string schema_line;
+  if (!std::getline(file, schema_line)) {
+    ++cache_misses;
+    return false;
+  }
+  std::stringstream body;
+  body << file.rdbuf();
+  try {
+    auto schema = parseSchema(schema_line);
+    // Parse into a scratch graph first so that a malformed artifact
+    // cannot leave the method's graph partially populated.
+    auto parsed = std::make_shared<Graph>();
+    parseIR(body.str(), parsed.get());
+    method.graph()->cloneFrom(*parsed);
+    method.setSchema(std::move(schema));
+  } catch (const std::exception&) {
+    ++cache_misses;
+    return false;
+  }
+  ++cache_hits;
+  return true;
+}
+
+void tryStoreInCompilationCache(
+    const Def& def,
+    const Self* self,
+    GraphFunction& method) {
+  const auto dir = currentCacheDir();
+  if (dir.empty() || self != nullptr) {
+    return;
+  }
+  if (!graphIsCacheSafe(*method.graph())) {
+    return;
+  }
+  std::ostringstream schema_text;
+  schema_text << method.getSchema();
+  const auto graph_text =
+      method.graph()->toString(/*print_source_locations=*/false);
+  // Verify the artifact round-trips before publishing it; schemas with
+  // unprintable defaults or graphs the parser cannot digest are simply
+  // not cached.
+  try {
+    parseSchema(schema_text.str());
+    Graph check;
+    parseIR(graph_text, &check);
+  } catch (const std::exception&) {
+    return;
+  }
+  const auto path =
+      artifactPath(dir, def, method.graph()->get_op_version());
+  const auto tmp_path = path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::trunc);
+    if (!file) {
+      return;
+    }
+    file << schema_text.str() << "\n" << graph_text;
+    if (!file) {
+      return;
+    }
+  }
+  // Publish atomically so concurrent processes never read a torn file.
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return;
+  }
+  ++cache_stores;
+}
+
+} // namespace jit
+} // namespace torch
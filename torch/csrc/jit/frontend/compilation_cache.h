@@ -0,0 +1,63 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/csrc/jit/frontend/tree_views.h>
+
+#include <cstdint>
+#include <string>
+
+namespace torch {
+namespace jit {
+
+struct GraphFunction;
+struct Self;
+
+// A content-addressed on-disk cache for frontend compilation results.
+//
+// Re-running the IR emitter over a large library of scripted utilities
+// costs tens of seconds of pure frontend time per process. When a cache
+// directory is configured (via setFrontendCompilationCacheDir or the
+// TORCH_JIT_FRONTEND_CACHE_DIR environment variable), the graph and
+// schema emitted for a free function are serialized as IR text keyed by
+// a hash of the function's source, the serialization format version and
+// the operator set version; later processes parse the cached artifact
+// instead of re-running to_ir.
+//
+// Only self-contained functions are cached: methods (which compile
+// against a class type), graphs that reference classes, interfaces or
+// other functions, and graphs holding tensor constants or subgraph
+// attributes are all skipped, since those do not round-trip through IR
+// text independently of the compilation environment. The cache assumes
+// the compilation environment for identical source is stable across
+// processes (i.e. the same library), which is the intended use case.
+//
+// The cache is disabled by default.
+
+TORCH_API void setFrontendCompilationCacheDir(std::string dir);
+TORCH_API std::string getFrontendCompilationCacheDir();
+
+struct FrontendCompilationCacheStats {
+  int64_t hits = 0;
+  int64_t misses = 0;
+  int64_t stores = 0;
+};
+TORCH_API FrontendCompilationCacheStats getFrontendCompilationCacheStats();
+
+// Populates `method`'s graph and schema from a cached artifact for
+// `def`, returning true on a hit. Always a miss for methods or when the
+// cache is disabled.
+TORCH_API bool tryLoadFromCompilationCache(
+    const Def& def,
+    const Self* self,
+    GraphFunction& method);
+
+// Serializes `method`'s emitted graph and schema for `def` if it is
+// cache-safe. Best effort: serialization or filesystem failures leave
+// the cache untouched.
+TORCH_API void tryStoreInCompilationCache(
+    const Def& def,
+    const Self* self,
+    GraphFunction& method);
+
+} // namespace jit
+} // namespace torch
@@ -7,6 +7,7 @@
 #include <caffe2/serialize/versions.h>
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/frontend/canonicalize_modified_loop.h>
+#include <torch/csrc/jit/frontend/compilation_cache.h>
 #include <torch/csrc/jit/frontend/convert_to_ssa.h>
 #include <torch/csrc/jit/frontend/lexer.h>
 #include <torch/csrc/jit/frontend/parser.h>
@@ -5378,7 +5379,13 @@ std::unique_ptr<Function> CompilationUnit::define(
       call_name = atoms.at(atoms.size() - 2) + "." + atoms.at(atoms.size() - 1);
     }
     ErrorReport::CallStack call(call_name, def.range());
+    // Reuse a previously emitted graph for identical source instead of
+    // re-running the IR emitter (no-op unless a cache dir is configured).
+    if (tryLoadFromCompilationCache(def, self, method)) {
+      return;
+    }
     to_ir(def, _resolver, self, method);
+    tryStoreInCompilationCache(def, self, method);
   };
   auto name = prefix ? QualifiedName(*prefix, def.name().name())
                      : QualifiedName(def.name().name());
@@ -203,8 +203,6 @@ class BytecodeDeserializer final {
       ExtraFilesMap& extra_files);
 
  private:
-  TypePtr resolveTypeName(const c10::QualifiedName& qn);
-  void init_upgrader(mobile::Function* function);
   void parseMethods(
       c10::ivalue::TupleElements&& vals,
       c10::optional<c10::ivalue::TupleElements>&& debug_handles,
@@ -212,11 +210,6 @@ class BytecodeDeserializer final {
   c10::IValue readArchive(
       const std::string& archive_name,
       std::shared_ptr<mobile::CompilationUnit> mcu);
-  void parseFunctionSchema(
-      const std::string& function_name,
-      IValue* schemaTable,
-      const int64_t& model_version,
-      mobile::Function* function);
   std::shared_ptr<CompilationUnit> compilation_unit_;
   std::unordered_set<std::string> imported_libs_;
   std::unique_ptr<PyTorchStreamReader> reader_{};
@@ -237,21 +230,18 @@ BytecodeDeserializer::BytecodeDeserializer(
       reader_(std::move(reader)),
       module_load_options_(module_load_options) {}
 
-TypePtr BytecodeDeserializer::resolveTypeName(const c10::QualifiedName& qn) {
-  return resolveTypeNameMobile(qn, compilation_unit_);
-}
-
-// It requires compilation_unit_ when parsing function schema. Keep it in
-// BytecodeDeserializer. It may be refacotred later to make it independent
-// of the specific BytecodeDeserializer, like parsing other tables
-void BytecodeDeserializer::parseFunctionSchema(
+// It requires the compilation unit when parsing function schema, to resolve
+// class type names. The unit is passed in so that the parse can also run
+// lazily, after the BytecodeDeserializer is gone.
+void parseFunctionSchema(
     const std::string& function_name,
     IValue* schemaTable,
     const int64_t& model_version,
-    mobile::Function* function) {
+    mobile::Function* function,
+    const std::shared_ptr<CompilationUnit>& compilation_unit) {
   // function schema
   if (schemaTable) { // (schema is optional for back compat)
-    auto parseArgList = [this,
+    auto parseArgList = [&compilation_unit,
                          function](c10::ivalue::TupleElements&& argTables) {
       std::vector<c10::Argument> args;
       for (auto& argTable : argTables) {
@@ -259,10 +249,11 @@ void BytecodeDeserializer::parseFunctionSchema(
         auto name =
             expect_field(argTableElements, "name", BYTECODE_INDEX_ARGUMENT_NAME)
                 .toStringRef();
-        c10::TypePtr type = resolveTypeName(
+        c10::TypePtr type = resolveTypeNameMobile(
             (expect_field(
                  argTableElements, "type", BYTECODE_INDEX_ARGUMENT_TYPE))
-                .toStringRef());
+                .toStringRef(),
+            compilation_unit);
         IValue default_value = expect_field(
             argTableElements,
             "default_value",
@@ -300,12 +291,97 @@ void BytecodeDeserializer::parseFunctionSchema(
   }
 }
 
-void BytecodeDeserializer::init_upgrader(mobile::Function* function) {
+void init_upgrader(mobile::Function* function) {
   for (auto& byteCodeFunctionWithOperator : getUpgraderBytecodeList()) {
     function->append_function(byteCodeFunctionWithOperator.function);
   }
 }
 
+// Parses one entry of the bytecode method table into a runnable function.
+// Factored out of parseMethods so that, with
+// MobileModuleLoadOptions::LAZY_METHOD_PARSING, the same parse can run from a
+// closure on the first lookup of the method, long after the deserializer is
+// gone.
+std::unique_ptr<mobile::Function> parseMethod(
+    c10::ivalue::TupleElements&& m_tuple,
+    c10::ivalue::TupleElements&& debug_handles_m_tuple,
+    uint64_t bytecode_version,
+    uint64_t operator_version,
+    uint64_t module_load_options,
+    const std::shared_ptr<CompilationUnit>& compilation_unit) {
+  const std::string& function_name = m_tuple[0].toStringRef();
+  auto codeTableElements =
+      std::move(std::move(m_tuple[1]).toTupleRef()).elements();
+  IValue* schemaTable = // older files do not store function schema
+      (bytecode_version > 0x4L ||
+       (bytecode_version == 0x4L && m_tuple.size() >= 3))
+      ? &m_tuple[2]
+      : nullptr;
+  auto function =
+      std::make_unique<mobile::Function>(c10::QualifiedName(function_name));
+
+  auto ins_list =
+      std::move(
+          expect_field(
+              codeTableElements, "instructions", BYTECODE_INDEX_INSTRUCTION)
+              .toTupleRef())
+          .elements();
+  auto ops_list =
+      std::move(expect_field(
+                    codeTableElements, "operators", BYTECODE_INDEX_OPERATOR)
+                    .toTupleRef())
+          .elements();
+  auto consts_list =
+      std::move(expect_field(
+                    codeTableElements, "constants", BYTECODE_INDEX_CONSTANT)
+                    .toTupleRef())
+          .elements();
+  auto types_list =
+      std::move(expect_field(codeTableElements, "types", BYTECODE_INDEX_TYPE)
+                    .toTupleRef())
+          .elements();
+  int64_t register_size =
+      expect_field(
+          codeTableElements, "register_size", BYTECODE_INDEX_REGISTER_SIZE)
+          .toInt();
+
+  init_upgrader(function.get());
+  // 1. First pass all operators from models
+  parseOperators(std::move(ops_list), module_load_options, function.get());
+
+  // 2. Decides if upgrader is needed
+  bool use_upgrader =
+      (operator_version < caffe2::serialize::kProducedFileFormatVersion);
+
+  parseInstructions(
+      function_name,
+      std::move(ins_list),
+      debug_handles_m_tuple,
+      function.get());
+
+  // 3. If upgrader is needed, change change the OP instrunction to CALL
+  // instruction (In next PR, use_upgrader will be parsed to parseInstruction
+  // function and do the actual change)
+  if (use_upgrader) {
+    applyUpgrader(function.get(), operator_version);
+  }
+
+  parseConstants(consts_list, function.get());
+
+  parseTypes(types_list, function.get());
+
+  function->set_register_size(register_size);
+
+  parseFunctionSchema(
+      function_name,
+      schemaTable,
+      bytecode_version,
+      function.get(),
+      compilation_unit);
+
+  return function;
+}
+
 void BytecodeDeserializer::parseMethods(
     c10::ivalue::TupleElements&& vals,
     c10::optional<c10::ivalue::TupleElements>&& debug_handles,
@@ -340,82 +416,50 @@ void BytecodeDeserializer::parseMethods(
         "The numbers of bytecode values and debug info values do not match.");
   }
 
+  const bool lazy_method_parsing =
+      module_load_options_ & MobileModuleLoadOptions::LAZY_METHOD_PARSING;
+
   // Process all methods in this mobile module.
   for (const auto i : c10::irange(method_i_start, vals.size())) {
     auto element = std::move(vals[i]);
     auto m_tuple = std::move(element.toTupleRef()).elements();
-    const std::string& function_name = m_tuple[0].toStringRef();
-    auto codeTableElements =
-        std::move(std::move(m_tuple[1]).toTupleRef()).elements();
-    IValue* schemaTable = // older files do not store function schema
-        (bytecode_version_ > 0x4L ||
-         (bytecode_version_ == 0x4L && m_tuple.size() >= 3))
-        ? &m_tuple[2]
-        : nullptr;
-    auto function =
-        std::make_unique<mobile::Function>(c10::QualifiedName(function_name));
-
-    auto ins_list =
-        std::move(
-            expect_field(
-                codeTableElements, "instructions", BYTECODE_INDEX_INSTRUCTION)
-                .toTupleRef())
-            .elements();
-    auto ops_list =
-        std::move(expect_field(
-                      codeTableElements, "operators", BYTECODE_INDEX_OPERATOR)
-                      .toTupleRef())
-            .elements();
-    auto consts_list =
-        std::move(expect_field(
-                      codeTableElements, "constants", BYTECODE_INDEX_CONSTANT)
-                      .toTupleRef())
-            .elements();
-    auto types_list =
-        std::move(expect_field(codeTableElements, "types", BYTECODE_INDEX_TYPE)
-                      .toTupleRef())
-            .elements();
-    int64_t register_size =
-        expect_field(
-            codeTableElements, "register_size", BYTECODE_INDEX_REGISTER_SIZE)
-            .toInt();
 
     c10::ivalue::TupleElements debug_handles_m_tuple;
     if (debug_handles) {
       debug_handles_m_tuple =
           std::move(std::move((*debug_handles)[i]).toTupleRef()).elements();
     }
-    init_upgrader(function.get());
-    // 1. First pass all operators from models
-    parseOperators(std::move(ops_list), module_load_options_, function.get());
 
-    // 2. Decides if upgrader is needed
-    bool use_upgrader =
-        (operator_version_ < caffe2::serialize::kProducedFileFormatVersion);
-
-    parseInstructions(
-        function_name,
-        std::move(ins_list),
-        debug_handles_m_tuple,
-        function.get());
-
-    // 3. If upgrader is needed, change change the OP instrunction to CALL
-    // instruction (In next PR, use_upgrader will be parsed to parseInstruction
-    // function and do the actual change)
-    if (use_upgrader) {
-      applyUpgrader(function.get(), operator_version_);
+    if (lazy_method_parsing) {
+      // Hold on to the unparsed tuples; the parse runs on the first
+      // find_method()/get_method() for this method.
+      c10::QualifiedName qn(m_tuple[0].toStringRef());
+      mcu.register_lazy_function(
+          std::move(qn),
+          [m_tuple = std::move(m_tuple),
+           debug_handles_m_tuple = std::move(debug_handles_m_tuple),
+           bytecode_version = bytecode_version_,
+           operator_version = operator_version_,
+           module_load_options = module_load_options_,
+           compilation_unit = compilation_unit_]() mutable {
+            return parseMethod(
+                std::move(m_tuple),
+                std::move(debug_handles_m_tuple),
+                bytecode_version,
+                operator_version,
+                module_load_options,
+                compilation_unit);
+          });
+      continue;
     }
 
-    parseConstants(consts_list, function.get());
-
-    parseTypes(types_list, function.get());
-
-    function->set_register_size(register_size);
-
-    parseFunctionSchema(
-        function_name, schemaTable, bytecode_version_, function.get());
-
-    mcu.register_function(std::move(function));
+    mcu.register_function(parseMethod(
+        std::move(m_tuple),
+        std::move(debug_handles_m_tuple),
+        bytecode_version_,
+        operator_version_,
+        module_load_options_,
+        compilation_unit_));
   }
 }
 
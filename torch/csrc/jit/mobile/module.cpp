@@ -20,6 +20,40 @@ void CompilationUnit::register_function(std::unique_ptr<Function> fn) {
   methods_.emplace_back(std::move(fn));
 }
 
+void CompilationUnit::register_lazy_function(
+    c10::QualifiedName qualname,
+    std::function<std::unique_ptr<Function>()> parse) {
+  std::lock_guard<std::mutex> guard(lazy_methods_mutex_);
+  lazy_methods_.emplace_back(LazyMethod{std::move(qualname), std::move(parse)});
+}
+
+Function* CompilationUnit::materialize(size_t idx) {
+  auto fn = lazy_methods_[idx].parse();
+  TORCH_INTERNAL_ASSERT(
+      fn != nullptr, "lazy method parsing returned no function");
+  Function* raw_fn = fn.get();
+  lazy_methods_.erase(lazy_methods_.begin() + idx);
+  methods_.emplace_back(std::move(fn));
+  return raw_fn;
+}
+
+Function* CompilationUnit::find_lazy_method(const std::string& basename) {
+  std::lock_guard<std::mutex> guard(lazy_methods_mutex_);
+  for (const auto i : c10::irange(lazy_methods_.size())) {
+    if (lazy_methods_[i].qualname.name() == basename) {
+      return materialize(i);
+    }
+  }
+  return nullptr;
+}
+
+void CompilationUnit::materialize_all() {
+  std::lock_guard<std::mutex> guard(lazy_methods_mutex_);
+  while (!lazy_methods_.empty()) {
+    materialize(lazy_methods_.size() - 1);
+  }
+}
+
 const Function* CompilationUnit::find_function(
     const c10::QualifiedName& qn) const {
   for (auto& fn : methods_) {
@@ -27,6 +61,16 @@ const Function* CompilationUnit::find_function(
       return fn.get();
     }
   }
+  // The method may have been registered for lazy parsing; parsing registers
+  // it, hence the const_cast.
+  // NOLINTNEXTLINE
+  auto* self = const_cast<CompilationUnit*>(this);
+  std::lock_guard<std::mutex> guard(self->lazy_methods_mutex_);
+  for (const auto i : c10::irange(self->lazy_methods_.size())) {
+    if (self->lazy_methods_[i].qualname == qn) {
+      return self->materialize(i);
+    }
+  }
   return nullptr;
 }
 
@@ -93,6 +137,9 @@ c10::optional<Method> Module::find_method(const std::string& basename) const {
       return c10::make_optional<Method>(Method(this, fn.get()));
     }
   }
+  if (auto* fn = cu_->find_lazy_method(basename)) {
+    return c10::make_optional<Method>(Method(this, fn));
+  }
   return c10::nullopt;
 }
 
@@ -229,6 +276,7 @@ bool Module::is_training() const {
 }
 
 const std::vector<Method> Module::get_methods() const {
+  cu_->materialize_all();
   std::vector<Method> methods;
   for (std::unique_ptr<Function>& fn : cu_->methods()) {
     methods.emplace_back(this, fn.get());
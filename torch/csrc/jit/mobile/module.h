@@ -5,6 +5,9 @@
 #include <torch/csrc/jit/mobile/method.h>
 #include <torch/csrc/jit/mobile/quantization.h>
 
+#include <functional>
+#include <mutex>
+
 namespace torch {
 namespace jit {
 namespace mobile {
@@ -34,6 +37,15 @@ using Stack = std::vector<c10::IValue>;
 class CompilationUnit {
  public:
   void register_function(std::unique_ptr<Function> fn);
+  // Registers the not-yet-parsed bytecode of a method; `parse` runs on the
+  // first find_function()/find_lazy_method() for this method and its result
+  // joins methods(). See MobileModuleLoadOptions::LAZY_METHOD_PARSING.
+  // Note: methods() only returns already-parsed functions, and a lookup that
+  // triggers parsing mutates the method list, so it is not safe to race
+  // against other lookups (same caveat as register_function()).
+  void register_lazy_function(
+      c10::QualifiedName qualname,
+      std::function<std::unique_ptr<Function>()> parse);
   std::vector<std::unique_ptr<Function>>& methods() {
     return methods_;
   }
@@ -42,13 +54,29 @@ class CompilationUnit {
   }
   Function* find_function(const c10::QualifiedName& qn);
   const Function* find_function(const c10::QualifiedName& qn) const;
+  // Parses and registers the pending lazy method with the given basename, if
+  // any. Returns nullptr when no such method is pending.
+  Function* find_lazy_method(const std::string& basename);
+  // Parses any still-pending lazy methods.
+  void materialize_all();
 
   void unsafeRemoveFunction(const int64_t index) {
     methods_.erase(methods_.begin() + index);
   }
 
  private:
+  struct LazyMethod {
+    c10::QualifiedName qualname;
+    std::function<std::unique_ptr<Function>()> parse;
+  };
+
+  // Requires lazy_methods_mutex_ to be held.
+  Function* materialize(size_t idx);
+
   std::vector<std::unique_ptr<Function>> methods_;
+  std::vector<LazyMethod> lazy_methods_;
+  // Serializes concurrent first lookups of unparsed methods.
+  std::mutex lazy_methods_mutex_;
 };
 
 // A Torch Mobile Module is a representation of the model (trained in case
@@ -11,6 +11,12 @@ enum MobileModuleLoadOptions {
   // files automatically without explicit entries mapping. Refer to PR for a
   // detail: https://github.com/pytorch/pytorch/pull/99747
   PARSE_ALL_EXTRA_FILE_MAPS = 2,
+  // LAZY_METHOD_PARSING defers parsing of each method's bytecode (operators,
+  // instructions, constants, types and schema) until the method is first
+  // looked up through Module::find_method()/get_method(). Apps that only call
+  // a couple of the serialized methods skip the parse cost of the rest at
+  // startup.
+  LAZY_METHOD_PARSING = 4,
 };
 
 const uint64_t kDefaultMobileLoadOptions =
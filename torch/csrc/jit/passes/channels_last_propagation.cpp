@@ -0,0 +1,242 @@
+#include <c10/core/MemoryFormat.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/channels_last_propagation.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace jit {
+namespace {
+
+// Cost model, counted in full-tensor copies. A convolution forced to run
+// NCHW when the backend prefers NHWC pays for an implicit transpose of the
+// activation and of the result, so moving one convolution into a
+// channels-last region is worth about two copies; every conversion the pass
+// inserts costs one.
+constexpr size_t kCopiesSavedPerAnchor = 2;
+
+// Ops that benefit from running channels-last. Restricted to 2-d
+// convolutions with a statically known 4-d activation so that the inserted
+// aten::contiguous calls are guaranteed to be valid.
+bool isAnchor(Node* node) {
+  if (node->kind() != aten::conv2d && node->kind() != aten::_convolution) {
+    return false;
+  }
+  auto tt = node->input(0)->type()->cast<TensorType>();
+  return tt && tt->dim() == 4;
+}
+
+// Ops that neither prefer nor disturb a memory format: they accept
+// channels-last inputs and hand the layout through to their outputs. Shape
+// ops (view, flatten, ...) are deliberately absent; tensors reaching them
+// are converted back to contiguous at the region boundary.
+bool isLayoutAgnostic(Node* node) {
+  static const std::unordered_set<Symbol> agnostic = {
+      aten::relu,
+      aten::relu_,
+      aten::relu6,
+      aten::relu6_,
+      aten::hardtanh,
+      aten::hardtanh_,
+      aten::hardswish,
+      aten::hardswish_,
+      aten::hardsigmoid,
+      aten::hardsigmoid_,
+      aten::sigmoid,
+      aten::tanh,
+      aten::gelu,
+      aten::silu,
+      aten::silu_,
+      aten::leaky_relu,
+      aten::leaky_relu_,
+      aten::add,
+      aten::add_,
+      aten::sub,
+      aten::mul,
+      aten::div,
+      aten::batch_norm,
+      aten::dropout,
+      aten::max_pool2d,
+      aten::avg_pool2d,
+      aten::adaptive_avg_pool2d,
+      aten::upsample_nearest2d,
+  };
+  return agnostic.count(node->kind()) != 0;
+}
+
+class ChannelsLastPropagator {
+ public:
+  explicit ChannelsLastPropagator(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)) {}
+
+  bool run() {
+    for (Node* node : graph_->block()->nodes()) {
+      if (isAnchor(node) && !visited_.count(node)) {
+        auto region = growRegion(node);
+        if (isProfitable(region)) {
+          convertRegion(region);
+        }
+      }
+    }
+    return graph_modified_;
+  }
+
+ private:
+  using Region = std::unordered_set<Node*>;
+
+  bool inTopLevelBlock(Node* node) {
+    return node->owningBlock() == graph_->block();
+  }
+
+  // Grows the connected component of anchors and layout-agnostic ops
+  // containing `seed`, following both producer and consumer edges so that
+  // convolutions joined through shared elementwise ops land in one region.
+  Region growRegion(Node* seed) {
+    Region region;
+    std::vector<Node*> worklist{seed};
+    while (!worklist.empty()) {
+      Node* node = worklist.back();
+      worklist.pop_back();
+      if (!region.insert(node).second) {
+        continue;
+      }
+      visited_.insert(node);
+      auto maybe_extend = [&](Node* other) {
+        if (inTopLevelBlock(other) && !region.count(other) &&
+            (isAnchor(other) || isLayoutAgnostic(other))) {
+          worklist.push_back(other);
+        }
+      };
+      for (Value* input : node->inputs()) {
+        maybe_extend(input->node());
+      }
+      for (Value* output : node->outputs()) {
+        for (const Use& use : output->uses()) {
+          maybe_extend(use.user);
+        }
+      }
+    }
+    return region;
+  }
+
+  // Activation inputs that need an up-front conversion: only the first input
+  // of each anchor, and only when it is produced outside the region. Weights
+  // are left alone; the convolution's own format selection already accounts
+  // for the weight layout once the activation is channels-last.
+  std::vector<Value*> entryValues(const Region& region) {
+    std::vector<Value*> entries;
+    std::unordered_set<Value*> seen;
+    for (Node* node : region) {
+      if (!isAnchor(node)) {
+        continue;
+      }
+      Value* activation = node->input(0);
+      if (!region.count(activation->node()) &&
+          seen.insert(activation).second) {
+        entries.push_back(activation);
+      }
+    }
+    return entries;
+  }
+
+  // Values computed in the region but observed outside it (including graph
+  // outputs). These get converted back to contiguous so that downstream
+  // stride-sensitive ops (aten::view and friends) and the graph's own output
+  // contract are unaffected by the region's internal layout.
+  std::vector<Value*> exitValues(const Region& region) {
+    std::vector<Value*> exits;
+    for (Node* node : region) {
+      for (Value* output : node->outputs()) {
+        for (const Use& use : output->uses()) {
+          if (!region.count(use.user)) {
+            exits.push_back(output);
+            break;
+          }
+        }
+      }
+    }
+    return exits;
+  }
+
+  bool isProfitable(const Region& region) {
+    size_t anchors = 0;
+    for (Node* node : region) {
+      anchors += isAnchor(node);
+    }
+    size_t conversions = entryValues(region).size() + exitValues(region).size();
+    return anchors * kCopiesSavedPerAnchor > conversions;
+  }
+
+  Value* insertContiguous(
+      Value* value,
+      at::MemoryFormat memory_format,
+      Node* insert_point) {
+    WithInsertPoint guard(insert_point);
+    Value* format = graph_->insertConstant(memory_format);
+    Node* contiguous = graph_->create(aten::contiguous, {value, format});
+    contiguous->output()->setType(value->type());
+    contiguous->insertBefore(insert_point);
+    return contiguous->output();
+  }
+
+  void convertRegion(const Region& region) {
+    // One conversion per distinct entry value, shared by all anchors that
+    // consume it.
+    std::unordered_map<Value*, Value*> converted;
+    for (Node* node : region) {
+      if (!isAnchor(node)) {
+        continue;
+      }
+      Value* activation = node->input(0);
+      if (region.count(activation->node())) {
+        continue;
+      }
+      auto it = converted.find(activation);
+      if (it == converted.end()) {
+        // Insert right after the producer (or at the top of the graph for
+        // inputs) so the converted value dominates every anchor that uses it.
+        Node* insert_point = activation->node()->kind() == prim::Param
+            ? *graph_->block()->nodes().begin()
+            : activation->node()->next();
+        Value* channels_last = insertContiguous(
+            activation, at::MemoryFormat::ChannelsLast, insert_point);
+        it = converted.emplace(activation, channels_last).first;
+      }
+      node->replaceInput(0, it->second);
+    }
+    for (Value* output : exitValues(region)) {
+      Value* contiguous = insertContiguous(
+          output, at::MemoryFormat::Contiguous, output->node()->next());
+      const std::vector<Use> uses = output->uses();
+      for (const Use& use : uses) {
+        if (!region.count(use.user) && use.user != contiguous->node()) {
+          use.user->replaceInput(use.offset, contiguous);
+        }
+      }
+    }
+    graph_modified_ = true;
+    GRAPH_DEBUG("Converted a region of ", region.size(), " nodes");
+  }
+
+  std::shared_ptr<Graph> graph_;
+  std::unordered_set<Node*> visited_;
+  bool graph_modified_ = false;
+};
+
+} // namespace
+
+bool PropagateChannelsLast(std::shared_ptr<Graph>& graph) {
+  ChannelsLastPropagator propagator(graph);
+  bool changed = propagator.run();
+  if (changed) {
+    GRAPH_DUMP("After PropagateChannelsLast: ", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Assigns a consistent channels-last memory format to regions of the graph
+// anchored on 2-d convolutions. Eager mode picks the format per op, so a
+// graph that interleaves layout-preferring and layout-agnostic ops can bounce
+// tensors between NCHW and NHWC on every convolution. This pass grows regions
+// from convolutions through layout-agnostic ops, applies a simple copy-count
+// cost model, and for profitable regions converts the convolution activations
+// to channels-last on entry and restores contiguous tensors on every value
+// leaving the region. Returns true if the graph was modified.
+TORCH_API bool PropagateChannelsLast(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
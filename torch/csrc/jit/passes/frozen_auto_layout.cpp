@@ -0,0 +1,204 @@
+#include <ATen/core/grad_mode.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/frozen_auto_layout.h>
+#include <torch/csrc/jit/passes/utils/optimization_utils.h>
+#include <torch/csrc/jit/runtime/graph_iterator.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/add.h>
+#include <ATen/ops/linear.h>
+#include <ATen/ops/matmul.h>
+#include <ATen/ops/randn.h>
+#include <ATen/ops/transpose.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace torch {
+namespace jit {
+namespace {
+
+using Tensor = at::Tensor;
+
+// Benchmark parameters. A couple of warmup runs get cuBLAS/oneDNN heuristic
+// selection and allocator warmup out of the way; best-of keeps the
+// measurement robust against scheduling noise.
+constexpr int kWarmupIters = 2;
+constexpr int kTimedIters = 5;
+// Rewriting churns constants and the graph, so require a clear win.
+constexpr double kMinSpeedup = 1.05;
+
+// Batch size assumed when the graph carries no shape information for the
+// activation. Biased toward the small-batch inference case freezing targets.
+constexpr int64_t kDefaultBatchSize = 32;
+
+double benchmark(const std::function<Tensor()>& fn) {
+  for (const auto i : c10::irange(kWarmupIters)) {
+    (void)i;
+    fn().sum().item<double>();
+  }
+  double best = std::numeric_limits<double>::infinity();
+  for (const auto i : c10::irange(kTimedIters)) {
+    (void)i;
+    const auto start = std::chrono::steady_clock::now();
+    // Reducing to a scalar forces completion of asynchronously dispatched
+    // work (e.g. on CUDA) and costs both candidates the same.
+    fn().sum().item<double>();
+    const auto end = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double>(end - start).count());
+  }
+  return best;
+}
+
+class AutoLayoutFrozenLinear {
+ public:
+  AutoLayoutFrozenLinear(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)) {}
+
+  bool run() {
+    // Can't delete nodes while also iterating over it
+    DepthFirstGraphNodeIterator graph_it(graph_);
+
+    for (auto next_node = graph_it.next(); next_node != nullptr;) {
+      Node* node = next_node;
+      next_node = graph_it.next();
+
+      if (is_constant_linear_op(node)) {
+        maybe_transpose_linear(node);
+      }
+    }
+    return graph_modified_;
+  }
+
+ private:
+  bool is_constant_linear_op(Node* node) {
+    if (node->kind() != aten::linear) {
+      return false;
+    }
+
+    // This also filters out out-variants of the linear op.
+    return !nonConstantParameters(node);
+  }
+
+  // Builds an input matching what the graph knows about the activation's
+  // shape: the profiled sizes flattened to 2-D if complete, otherwise a
+  // default batch over the weight's input features.
+  Tensor representative_input(Node* node, const Tensor& weight) {
+    const int64_t in_features = weight.size(1);
+    int64_t rows = kDefaultBatchSize;
+    if (auto tt = node->input(0)->type()->cast<TensorType>()) {
+      if (auto sizes = tt->sizes().concrete_sizes()) {
+        if (!sizes->empty()) {
+          rows = 1;
+          for (size_t i = 0; i + 1 < sizes->size(); ++i) {
+            rows *= (*sizes)[i];
+          }
+        }
+      }
+    }
+    return at::randn({rows, in_features}, weight.options());
+  }
+
+  void maybe_transpose_linear(Node* node) {
+    auto weight = node->namedInput("weight");
+    Tensor weight_tensor = constant_as<Tensor>(weight).value();
+    if (weight_tensor.dim() != 2 ||
+        !at::isFloatingType(weight_tensor.scalar_type())) {
+      return;
+    }
+    auto bias = node->namedInput("bias");
+    c10::optional<Tensor> bias_tensor;
+    if (bias->type() != NoneType::get()) {
+      bias_tensor = constant_as<Tensor>(bias).value();
+    }
+
+    Tensor input;
+    Tensor weight_t_tensor;
+    double linear_time = 0;
+    double matmul_time = 0;
+    try {
+      at::NoGradGuard no_grad;
+      input = representative_input(node, weight_tensor);
+      weight_t_tensor = at::transpose(weight_tensor, 1, 0)
+                            .clone(at::MemoryFormat::Contiguous);
+      linear_time = benchmark([&] {
+        return at::linear(input, weight_tensor, bias_tensor);
+      });
+      matmul_time = benchmark([&] {
+        auto out = at::matmul(input, weight_t_tensor);
+        return bias_tensor ? at::add(out, *bias_tensor) : out;
+      });
+    } catch (const std::exception&) {
+      // Benchmarking is best-effort; an op the machine can't run with
+      // synthetic inputs just keeps its current layout.
+      return;
+    }
+
+    GRAPH_DEBUG(
+        "FrozenLinearAutoLayout: ",
+        getHeader(node),
+        " linear ",
+        linear_time,
+        "s vs transposed matmul ",
+        matmul_time,
+        "s");
+    if (linear_time < matmul_time * kMinSpeedup) {
+      return;
+    }
+    replace_linear_with_matmul(node, std::move(weight_t_tensor));
+  }
+
+  // Same rewrite as FrozenLinearTranspose, reusing the transposed weight
+  // that was already materialized for the benchmark.
+  void replace_linear_with_matmul(Node* node, Tensor weight_t_tensor) {
+    graph_modified_ = true;
+    Node* matmul = nullptr;
+
+    {
+      WithInsertPoint insert_guard(node);
+      Value* weight_t = graph_->insertConstant(std::move(weight_t_tensor));
+      matmul = graph_->create(aten::matmul, {node->inputs()[0], weight_t});
+      matmul->insertAfter(node);
+    }
+
+    WithInsertPoint insert_guard(matmul);
+    auto bias = node->namedInput("bias");
+    if (bias->type() == NoneType::get()) {
+      node->replaceAllUsesWith(matmul);
+    } else {
+      Value* bias_scale = graph_->insertConstant(1);
+      Node* bias_result =
+          graph_->create(aten::add, {matmul->output(), bias, bias_scale});
+      bias_result->insertAfter(matmul);
+      node->replaceAllUsesWith(bias_result);
+    }
+    node->destroy();
+  }
+
+  std::shared_ptr<Graph> graph_;
+  bool graph_modified_ = false;
+};
+
+} // namespace
+
+TORCH_API bool FrozenLinearAutoLayout(std::shared_ptr<Graph>& graph) {
+  AutoLayoutFrozenLinear auto_layout(graph);
+  GRAPH_DUMP("Before FrozenLinearAutoLayout", graph);
+  bool changed = auto_layout.run();
+  if (changed) {
+    GRAPH_DUMP("After FrozenLinearAutoLayout", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Auto-tunes the weight layout of frozen linear modules for the machine the
+// pass runs on. For every aten::linear with constant parameters it times the
+// op as-is against a transposed-weight aten::matmul on a representative
+// input shape, and rewrites to the transposed form only when it measures
+// faster. A generalization of FrozenLinearTranspose, which always rewrites.
+TORCH_API bool FrozenLinearAutoLayout(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
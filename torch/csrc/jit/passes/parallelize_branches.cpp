@@ -0,0 +1,268 @@
+#include <torch/csrc/jit/passes/parallelize_branches.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// A region is only worth the fork/join overhead if it does some real work.
+constexpr size_t kMinRegionSize = 2;
+
+// Nodes that may participate in a forked region. Constants are excluded
+// (they are cloned into subgraphs instead, so sharing one between regions
+// does not merge them), as are nodes with sub-blocks, side effects, or
+// existing fork/wait structure.
+bool isEligibleNode(Node* node) {
+  return node->kind() != prim::Constant && node->blocks().empty() &&
+      !node->hasSideEffects() && node->kind() != prim::fork &&
+      node->kind() != aten::wait;
+}
+
+size_t findRoot(std::vector<size_t>& parent, size_t x) {
+  while (parent[x] != x) {
+    parent[x] = parent[parent[x]];
+    x = parent[x];
+  }
+  return x;
+}
+
+void uniteRoots(std::vector<size_t>& parent, size_t a, size_t b) {
+  parent[findRoot(parent, a)] = findRoot(parent, b);
+}
+
+struct Region {
+  // nodes in block (topological) order
+  std::vector<Node*> nodes;
+  // values produced outside the region (excluding constants) that it consumes
+  std::vector<Value*> inputs;
+  // values it produces that are consumed outside the region
+  std::vector<Value*> outputs;
+};
+
+bool computeRegionBoundary(Region& region) {
+  std::unordered_set<Node*> in_region(
+      region.nodes.begin(), region.nodes.end());
+  std::unordered_set<Value*> seen_inputs;
+  for (Node* node : region.nodes) {
+    for (Value* input : node->inputs()) {
+      Node* producer = input->node();
+      if (in_region.count(producer) || producer->kind() == prim::Constant) {
+        continue;
+      }
+      if (seen_inputs.insert(input).second) {
+        region.inputs.push_back(input);
+      }
+      // All external inputs must already be defined where the fork node will
+      // be inserted (just before the region's first node); block order is
+      // topological so this only fails for producers interleaved with the
+      // region, in which case we skip forking it.
+      if (!producer->isBefore(region.nodes.front())) {
+        return false;
+      }
+    }
+    for (Value* output : node->outputs()) {
+      for (const Use& use : output->uses()) {
+        if (!in_region.count(use.user)) {
+          region.outputs.push_back(output);
+          break;
+        }
+      }
+    }
+  }
+  return !region.outputs.empty();
+}
+
+// Clones the region into a fresh subgraph and replaces it with
+// prim::fork(subgraph) + aten::wait. Waits are inserted immediately before
+// the earliest external consumer, so independent forks issued earlier keep
+// running in the meantime.
+void forkRegion(Graph* graph, const Region& region) {
+  auto subgraph = std::make_shared<Graph>();
+  std::unordered_map<Value*, Value*> value_map;
+  for (Value* input : region.inputs) {
+    Value* subgraph_input = subgraph->addInput()->copyMetadata(input);
+    value_map[input] = subgraph_input;
+  }
+  auto map_value = [&](Value* v) -> Value* {
+    auto it = value_map.find(v);
+    if (it != value_map.end()) {
+      return it->second;
+    }
+    // Must be a constant; clone it into the subgraph on first use.
+    TORCH_INTERNAL_ASSERT(v->node()->kind() == prim::Constant);
+    Node* cloned = subgraph->createClone(v->node(), map_value);
+    subgraph->insertNode(cloned);
+    for (size_t i = 0; i < v->node()->outputs().size(); ++i) {
+      value_map[v->node()->outputs()[i]] = cloned->outputs()[i];
+    }
+    return value_map.at(v);
+  };
+  for (Node* node : region.nodes) {
+    Node* cloned = subgraph->createClone(node, map_value);
+    subgraph->insertNode(cloned);
+    for (size_t i = 0; i < node->outputs().size(); ++i) {
+      value_map[node->outputs()[i]] = cloned->outputs()[i];
+    }
+  }
+
+  TypePtr out_type;
+  if (region.outputs.size() == 1) {
+    subgraph->registerOutput(value_map.at(region.outputs[0]));
+    out_type = region.outputs[0]->type();
+  } else {
+    std::vector<Value*> subgraph_outputs;
+    std::vector<TypePtr> out_types;
+    for (Value* output : region.outputs) {
+      subgraph_outputs.push_back(value_map.at(output));
+      out_types.push_back(output->type());
+    }
+    Node* tuple = subgraph->createTuple(subgraph_outputs);
+    subgraph->insertNode(tuple);
+    subgraph->registerOutput(tuple->output());
+    out_type = TupleType::create(std::move(out_types));
+  }
+
+  Node* fork_node = graph->create(prim::fork, 1);
+  fork_node->g_(attr::Subgraph, std::move(subgraph));
+  for (Value* input : region.inputs) {
+    fork_node->addInput(input);
+  }
+  fork_node->output()->setType(FutureType::create(out_type));
+  fork_node->insertBefore(region.nodes.front());
+
+  // Join right before the earliest node that needs a region output.
+  Node* earliest_user = nullptr;
+  for (Value* output : region.outputs) {
+    for (const Use& use : output->uses()) {
+      if (earliest_user == nullptr || use.user->isBefore(earliest_user)) {
+        earliest_user = use.user;
+      }
+    }
+  }
+  Node* wait_node = graph->create(aten::wait, 1);
+  wait_node->addInput(fork_node->output());
+  wait_node->output()->setType(out_type);
+  wait_node->insertBefore(earliest_user);
+
+  if (region.outputs.size() == 1) {
+    region.outputs[0]->replaceAllUsesWith(wait_node->output());
+  } else {
+    Node* unpack = graph->create(prim::TupleUnpack, region.outputs.size());
+    unpack->addInput(wait_node->output());
+    unpack->insertAfter(wait_node);
+    for (size_t i = 0; i < region.outputs.size(); ++i) {
+      unpack->outputs()[i]->setType(region.outputs[i]->type());
+      region.outputs[i]->replaceAllUsesWith(unpack->outputs()[i]);
+    }
+  }
+
+  for (auto it = region.nodes.rbegin(); it != region.nodes.rend(); ++it) {
+    (*it)->destroy();
+  }
+}
+
+} // namespace
+
+bool ParallelizeIndependentBranches(std::shared_ptr<Graph>& graph) {
+  Block* block = graph->block();
+
+  // Restrict to pure, straight-line graphs: no sub-blocks, no side effects
+  // and no mutation anywhere, so regions can be reordered relative to each
+  // other purely by data dependencies.
+  std::vector<Node*> nodes;
+  for (Node* node : block->nodes()) {
+    if (node->kind() == prim::Constant) {
+      continue;
+    }
+    if (!isEligibleNode(node)) {
+      return false;
+    }
+    nodes.push_back(node);
+  }
+  if (nodes.size() < 2 * kMinRegionSize) {
+    return false;
+  }
+  AliasDb alias_db(graph);
+  for (Node* node : nodes) {
+    if (alias_db.isMutable(node)) {
+      return false;
+    }
+  }
+
+  // Union-find over data dependencies partitions the block into maximal
+  // data-independent regions. Graphs that combine their branches at the end
+  // (a cat, a sum, the TupleConstruct feeding Return) collapse into a single
+  // region under plain union-find, so when that happens we peel nodes off the
+  // topological tail — leaving them in the main graph, after the waits — and
+  // repartition until at least two forkable regions emerge or too little of
+  // the graph is left to be worth forking.
+  std::unordered_map<Node*, size_t> node_index;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    node_index[nodes[i]] = i;
+  }
+
+  std::vector<Region> forkable;
+  for (size_t num_active = nodes.size(); num_active >= 2 * kMinRegionSize;
+       --num_active) {
+    std::vector<size_t> parent(num_active);
+    for (size_t i = 0; i < num_active; ++i) {
+      parent[i] = i;
+    }
+    for (size_t i = 0; i < num_active; ++i) {
+      for (Value* input : nodes[i]->inputs()) {
+        auto it = node_index.find(input->node());
+        if (it != node_index.end() && it->second < num_active) {
+          uniteRoots(parent, i, it->second);
+        }
+      }
+    }
+
+    std::unordered_map<size_t, Region> regions_by_root;
+    std::vector<size_t> root_order;
+    for (size_t i = 0; i < num_active; ++i) {
+      size_t root = findRoot(parent, i);
+      if (regions_by_root.emplace(root, Region()).second) {
+        root_order.push_back(root);
+      }
+      regions_by_root[root].nodes.push_back(nodes[i]);
+    }
+
+    for (size_t root : root_order) {
+      Region& region = regions_by_root[root];
+      if (region.nodes.size() < kMinRegionSize) {
+        continue;
+      }
+      if (computeRegionBoundary(region)) {
+        forkable.push_back(std::move(region));
+      }
+    }
+    if (forkable.size() >= 2) {
+      break;
+    }
+    forkable.clear();
+  }
+  // Forking a single region only adds overhead; there is nothing to overlap.
+  if (forkable.size() < 2) {
+    return false;
+  }
+
+  for (const Region& region : forkable) {
+    forkRegion(graph.get(), region);
+  }
+  GRAPH_UPDATE(
+      "ParallelizeIndependentBranches forked ",
+      forkable.size(),
+      " regions");
+  GRAPH_DUMP("After ParallelizeIndependentBranches: ", graph);
+  return true;
+}
+
+} // namespace jit
+} // namespace torch
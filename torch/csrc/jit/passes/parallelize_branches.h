@@ -0,0 +1,16 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Rewrites data-independent regions of a pure, straight-line graph into
+// prim::fork subgraphs joined with aten::wait, so the interpreter can overlap
+// their execution (and, when torch_jit_parallelize_branches is set, run each
+// forked region on a side stream of the devices its inputs live on).
+// Returns true if the graph was modified.
+TORCH_API bool ParallelizeIndependentBranches(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,137 @@
+#include <torch/csrc/jit/passes/pass_instrumentation.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+std::atomic<bool> instrumentation_enabled{false};
+
+struct InstrumentationState {
+  std::mutex mutex;
+  std::vector<PassInstrumentationEvent> events;
+};
+
+InstrumentationState& state() {
+  static InstrumentationState s;
+  return s;
+}
+
+int64_t nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t countNodes(const Block* block) {
+  int64_t count = 0;
+  for (const Node* node : block->nodes()) {
+    count++;
+    for (const Block* subblock : node->blocks()) {
+      count += countNodes(subblock);
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+bool passInstrumentationEnabled() {
+  return instrumentation_enabled.load(std::memory_order_relaxed);
+}
+
+void setPassInstrumentationEnabled(bool enabled) {
+  instrumentation_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<PassInstrumentationEvent> getPassInstrumentationEvents() {
+  std::lock_guard<std::mutex> lock(state().mutex);
+  return state().events;
+}
+
+std::vector<PassInstrumentationSummary> getPassInstrumentationSummaries() {
+  std::lock_guard<std::mutex> lock(state().mutex);
+  std::map<std::string, PassInstrumentationSummary> by_name;
+  for (const auto& event : state().events) {
+    auto& summary = by_name[event.pass_name];
+    summary.pass_name = event.pass_name;
+    summary.runs++;
+    summary.total_us += event.duration_us;
+    summary.total_node_delta += event.nodes_after - event.nodes_before;
+  }
+  std::vector<PassInstrumentationSummary> result;
+  result.reserve(by_name.size());
+  for (auto& entry : by_name) {
+    result.push_back(std::move(entry.second));
+  }
+  return result;
+}
+
+void clearPassInstrumentation() {
+  std::lock_guard<std::mutex> lock(state().mutex);
+  state().events.clear();
+}
+
+std::string dumpPassInstrumentationTrace() {
+  const auto events = getPassInstrumentationEvents();
+  std::ostringstream trace;
+  trace << "[";
+  bool first = true;
+  for (const auto& event : events) {
+    if (!first) {
+      trace << ",";
+    }
+    first = false;
+    trace << "{\"name\":\"" << event.pass_name << "\",\"ph\":\"X\""
+          << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us
+          << ",\"pid\":0,\"tid\":" << event.thread_id
+          << ",\"args\":{\"nodes_before\":" << event.nodes_before
+          << ",\"nodes_after\":" << event.nodes_after << "}}";
+  }
+  trace << "]";
+  return trace.str();
+}
+
+namespace detail {
+
+InstrumentedPassScope::InstrumentedPassScope(
+    const char* pass_name,
+    const Graph& graph)
+    : graph_(graph),
+      pass_name_(pass_name),
+      enabled_(passInstrumentationEnabled()) {
+  if (!enabled_) {
+    return;
+  }
+  nodes_before_ = countNodes(graph_.block());
+  start_us_ = nowUs();
+}
+
+InstrumentedPassScope::~InstrumentedPassScope() {
+  if (!enabled_) {
+    return;
+  }
+  PassInstrumentationEvent event;
+  event.pass_name = pass_name_;
+  event.start_us = start_us_;
+  event.duration_us = nowUs() - start_us_;
+  event.nodes_before = nodes_before_;
+  event.nodes_after = countNodes(graph_.block());
+  event.thread_id = static_cast<uint64_t>(
+      std::hash<std::thread::id>()(std::this_thread::get_id()));
+  std::lock_guard<std::mutex> lock(state().mutex);
+  state().events.push_back(std::move(event));
+}
+
+} // namespace detail
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+// Opt-in instrumentation for graph transformation passes.
+//
+// When enabled, every pass routed through instrumentedPass() (the profiling
+// graph executor's optimization pipelines do this) records its wall time and
+// the graph's node count before and after, so slow warmups can be attributed
+// to individual passes. Recorded data is queryable as raw per-invocation
+// events or aggregated per-pass summaries (rerun counts, total time, total
+// node delta), and dumpable as a chrome://tracing-compatible trace. The
+// Python surface is torch._C._jit_set_pass_instrumentation_enabled and
+// friends.
+//
+// Instrumentation is process-wide and thread-safe; the disabled fast path is
+// a single relaxed atomic load per pass.
+
+// One recorded pass invocation.
+struct PassInstrumentationEvent {
+  std::string pass_name;
+  // Time since the steady clock's epoch; events are globally ordered.
+  int64_t start_us = 0;
+  int64_t duration_us = 0;
+  int64_t nodes_before = 0;
+  int64_t nodes_after = 0;
+  // Identifies which thread ran the pass in the trace dump.
+  uint64_t thread_id = 0;
+};
+
+// Aggregated view of all invocations of one pass.
+struct PassInstrumentationSummary {
+  std::string pass_name;
+  int64_t runs = 0;
+  int64_t total_us = 0;
+  int64_t total_node_delta = 0;
+};
+
+TORCH_API bool passInstrumentationEnabled();
+TORCH_API void setPassInstrumentationEnabled(bool enabled);
+TORCH_API std::vector<PassInstrumentationEvent> getPassInstrumentationEvents();
+TORCH_API std::vector<PassInstrumentationSummary>
+getPassInstrumentationSummaries();
+TORCH_API void clearPassInstrumentation();
+// Serializes all recorded events in the chrome trace event format, suitable
+// for chrome://tracing or perfetto.
+TORCH_API std::string dumpPassInstrumentationTrace();
+
+namespace detail {
+// RAII recorder; measures between construction and destruction. Prefer
+// instrumentedPass() below.
+class TORCH_API InstrumentedPassScope {
+ public:
+  InstrumentedPassScope(const char* pass_name, const Graph& graph);
+  ~InstrumentedPassScope();
+  InstrumentedPassScope(const InstrumentedPassScope&) = delete;
+  InstrumentedPassScope& operator=(const InstrumentedPassScope&) = delete;
+
+ private:
+  const Graph& graph_;
+  const char* pass_name_;
+  bool enabled_;
+  int64_t start_us_ = 0;
+  int64_t nodes_before_ = 0;
+};
+} // namespace detail
+
+// Runs `fn` as an instrumented pass over `graph`, e.g.
+//   instrumentedPass("EliminateDeadCode", *graph, [&] {
+//     EliminateDeadCode(graph);
+//   });
+template <typename F>
+void instrumentedPass(const char* pass_name, const Graph& graph, F&& fn) {
+  detail::InstrumentedPassScope scope(pass_name, graph);
+  std::forward<F>(fn)();
+}
+
+} // namespace jit
+} // namespace torch
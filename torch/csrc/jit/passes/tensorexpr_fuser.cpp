@@ -1,5 +1,6 @@
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 
+#include <ATen/Parallel.h>
 #include <ATen/core/interned_strings.h>
 #include <ATen/core/symbol.h>
 #include <ATen/record_function.h>
@@ -25,6 +26,8 @@
 #include <torch/csrc/jit/tensorexpr/kernel.h>
 #include <torch/csrc/utils/memory.h>
 
+#include <atomic>
+
 #include <utility>
 
 // NOLINTNEXTLINE
@@ -1364,12 +1367,62 @@ void FuseTensorExprs(
   GRAPH_DUMP("After TExprFuser: ", graph);
 }
 
-static Operation createTensorExprOp(const Node* node) {
-  bool dynamic_shape_fusion_node =
-      node->hasAttribute(attr::striding_inputs_desc);
-  if (!dynamic_shape_fusion_node) {
-    auto kernel =
-        std::make_shared<tensorexpr::TensorExprKernel>(node->g(attr::Subgraph));
+// The graph text elides the contents of tensor (and other non-scalar)
+// constants, so subgraphs embedding them could collide in the kernel cache
+// even though they compute different things. Only graphs whose constants
+// print losslessly are safe to cache by their text.
+static bool allConstantsPrintLosslessly(const std::shared_ptr<Graph>& graph) {
+  for (const Node* n : graph->nodes()) {
+    if (n->kind() != prim::Constant) {
+      continue;
+    }
+    if (!n->hasAttribute(attr::value)) {
+      // None constant
+      continue;
+    }
+    switch (n->kindOf(attr::value)) {
+      case AttributeKind::i:
+      case AttributeKind::f:
+      case AttributeKind::c:
+      case AttributeKind::s:
+      case AttributeKind::is:
+      case AttributeKind::fs:
+      case AttributeKind::ss:
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+static Operation createStaticShapeTensorExprOp(const Node* node) {
+  auto subgraph = node->g(attr::Subgraph);
+  auto& kernel_cache = tensorexpr::TensorExprKernelCache::get();
+
+  // The canonical graph text carries the profiled sizes, strides, dtypes
+  // and devices in its type annotations, so it serves as the shape
+  // signature: re-specializations of previously seen shapes reuse the
+  // compiled kernel instead of paying for compilation again.
+  std::string shape_signature;
+  const bool use_cache =
+      kernel_cache.enabled() && allConstantsPrintLosslessly(subgraph);
+  if (use_cache) {
+    shape_signature = subgraph->toString(/*print_source_locations*/ false);
+    if (auto kernel = kernel_cache.lookup(shape_signature)) {
+      return [kernel](Stack& stack) {
+        RECORD_FUNCTION(kernel->getKernelName(), std::vector<c10::IValue>());
+        kernel->run(stack);
+        return 0;
+      };
+    }
+  }
+
+  if (!tensorexpr::asyncCompilationEnabled()) {
+    auto kernel = std::make_shared<tensorexpr::TensorExprKernel>(subgraph);
+    if (use_cache) {
+      kernel_cache.insert(shape_signature, kernel);
+    }
     return [kernel](Stack& stack) {
       RECORD_FUNCTION(kernel->getKernelName(), std::vector<c10::IValue>());
       kernel->run(stack);
@@ -1377,6 +1430,53 @@ static Operation createTensorExprOp(const Node* node) {
     };
   }
 
+  // Compile the kernel for this newly seen shape set in the background and
+  // serve the interpreter in the meantime, so that novel shapes don't pause
+  // execution for the duration of the compile. The kernel compiles from a
+  // copy of the subgraph because TensorExprKernel mutates the graph it is
+  // given while the interpreter fallback may still be running it. The slot
+  // is published with release/acquire ordering; if compilation fails, the
+  // fallback simply stays in place.
+  auto kernel_slot =
+      std::make_shared<std::shared_ptr<tensorexpr::TensorExprKernel>>();
+  auto kernel_ready = std::make_shared<std::atomic<bool>>(false);
+  auto fallback_code = std::make_shared<Code>(subgraph, "");
+  at::launch([kernel_slot,
+              kernel_ready,
+              use_cache,
+              shape_signature,
+              graph = subgraph->copy()]() {
+    try {
+      auto kernel = std::make_shared<tensorexpr::TensorExprKernel>(graph);
+      if (use_cache) {
+        tensorexpr::TensorExprKernelCache::get().insert(
+            shape_signature, kernel);
+      }
+      *kernel_slot = std::move(kernel);
+      kernel_ready->store(true, std::memory_order_release);
+    } catch (const std::exception& e) {
+      GRAPH_DEBUG("Background kernel compilation failed: ", e.what());
+    }
+  });
+  return [kernel_slot, kernel_ready, fallback_code](Stack& stack) {
+    if (kernel_ready->load(std::memory_order_acquire)) {
+      const auto& kernel = *kernel_slot;
+      RECORD_FUNCTION(kernel->getKernelName(), std::vector<c10::IValue>());
+      kernel->run(stack);
+    } else {
+      InterpreterState(*fallback_code).run(stack);
+    }
+    return 0;
+  };
+}
+
+static Operation createTensorExprOp(const Node* node) {
+  bool dynamic_shape_fusion_node =
+      node->hasAttribute(attr::striding_inputs_desc);
+  if (!dynamic_shape_fusion_node) {
+    return createStaticShapeTensorExprOp(node);
+  }
+
   // Handle the case when dynamic shape fusion is enabled.
   VLOG(1) << "Compiling a new kernel for " << *node;
   std::vector<int64_t> sym_shapes;
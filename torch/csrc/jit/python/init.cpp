@@ -37,10 +37,12 @@
 #include <torch/csrc/jit/passes/fold_conv_bn.h>
 #include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/passes/frozen_concat_linear.h>
+#include <torch/csrc/jit/passes/channels_last_propagation.h>
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_conv_folding.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_linear_folding.h>
+#include <torch/csrc/jit/passes/frozen_auto_layout.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
@@ -55,6 +57,9 @@
 #include <torch/csrc/jit/passes/metal_rewrite.h>
 #include <torch/csrc/jit/passes/mobile_optimizer_type.h>
 #include <torch/csrc/jit/passes/normalize_ops.h>
+#include <torch/csrc/jit/passes/parallelize_branches.h>
+#include <torch/csrc/jit/frontend/compilation_cache.h>
+#include <torch/csrc/jit/passes/pass_instrumentation.h>
 #include <torch/csrc/jit/passes/peephole.h>
 #include <torch/csrc/jit/passes/peephole_list_idioms.h>
 #include <torch/csrc/jit/passes/quantization/dedup_module_uses.h>
@@ -404,6 +409,8 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_convert_frozen_ops_to_mkldnn", &ConvertFrozenOpsToMKLDNN)
       .def("_jit_pass_fuse_frozen_conv_add_relu", &FuseFrozenConvAddRelu)
       .def("_jit_pass_transpose_frozen_linear", &FrozenLinearTranspose)
+      .def("_jit_pass_auto_layout_frozen_linear", &FrozenLinearAutoLayout)
+      .def("_jit_pass_propagate_channels_last", &PropagateChannelsLast)
       .def("_jit_pass_optimize_frozen_graph", &OptimizeFrozenGraph)
       .def(
           "_jit_pass_optimize_for_inference",
@@ -828,6 +835,37 @@ void initJITBindings(PyObject* module) {
             size_t num_runs = getNumProfiledRuns();
             return num_runs;
           })
+      .def(
+          "_jit_set_tiered_execution",
+          [](bool enabled) {
+            bool old_state = getTieredExecutionMode();
+            getTieredExecutionMode() = enabled;
+            return old_state;
+          })
+      .def(
+          "_jit_tiered_execution_enabled",
+          [] {
+            bool enabled = getTieredExecutionMode();
+            return enabled;
+          })
+      .def(
+          "_jit_set_tier_thresholds",
+          [](size_t profile_at, size_t optimize_at, size_t hot_calls_per_sec) {
+            getTierProfileThreshold() = profile_at;
+            getTierOptimizeThreshold() = optimize_at;
+            getTierHotCallsPerSecond() = hot_calls_per_sec;
+          },
+          py::arg("profile_at"),
+          py::arg("optimize_at"),
+          py::arg("hot_calls_per_sec") = 100)
+      .def(
+          "_jit_get_tier_thresholds",
+          [] {
+            size_t profile_at = getTierProfileThreshold();
+            size_t optimize_at = getTierOptimizeThreshold();
+            size_t hot_calls_per_sec = getTierHotCallsPerSecond();
+            return std::make_tuple(profile_at, optimize_at, hot_calls_per_sec);
+          })
       .def(
           "_jit_set_bailout_depth",
           [](size_t depth) {
@@ -873,6 +911,65 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_get_inline_everything_mode",
           []() { return getInlineEverythingMode(); })
+      .def(
+          "_jit_set_pass_instrumentation_enabled",
+          [](bool enabled) { setPassInstrumentationEnabled(enabled); })
+      .def(
+          "_jit_pass_instrumentation_enabled",
+          []() { return passInstrumentationEnabled(); })
+      .def(
+          "_jit_get_pass_instrumentation_summaries",
+          []() {
+            py::list result;
+            for (const auto& summary : getPassInstrumentationSummaries()) {
+              py::dict entry;
+              entry["pass_name"] = summary.pass_name;
+              entry["runs"] = summary.runs;
+              entry["total_us"] = summary.total_us;
+              entry["total_node_delta"] = summary.total_node_delta;
+              result.append(std::move(entry));
+            }
+            return result;
+          })
+      .def(
+          "_jit_get_pass_instrumentation_events",
+          []() {
+            py::list result;
+            for (const auto& event : getPassInstrumentationEvents()) {
+              py::dict entry;
+              entry["pass_name"] = event.pass_name;
+              entry["start_us"] = event.start_us;
+              entry["duration_us"] = event.duration_us;
+              entry["nodes_before"] = event.nodes_before;
+              entry["nodes_after"] = event.nodes_after;
+              result.append(std::move(entry));
+            }
+            return result;
+          })
+      .def(
+          "_jit_clear_pass_instrumentation",
+          []() { clearPassInstrumentation(); })
+      .def(
+          "_jit_dump_pass_instrumentation_trace",
+          []() { return dumpPassInstrumentationTrace(); })
+      .def(
+          "_jit_set_frontend_cache_dir",
+          [](std::string dir) {
+            setFrontendCompilationCacheDir(std::move(dir));
+          })
+      .def(
+          "_jit_get_frontend_cache_dir",
+          []() { return getFrontendCompilationCacheDir(); })
+      .def(
+          "_jit_get_frontend_cache_stats",
+          []() {
+            const auto stats = getFrontendCompilationCacheStats();
+            py::dict result;
+            result["hits"] = stats.hits;
+            result["misses"] = stats.misses;
+            result["stores"] = stats.stores;
+            return result;
+          })
       .def(
           "_jit_get_logging_option",
           []() { return ::torch::jit::get_jit_logging_levels(); })
@@ -942,6 +1039,11 @@ void initJITBindings(PyObject* module) {
           })
       .def("_jit_set_texpr_fuser_enabled", &setTensorExprFuserEnabled)
       .def("_jit_texpr_fuser_enabled", &tensorExprFuserEnabled)
+      .def("_jit_set_storage_deduplication", &setStorageDeduplication)
+      .def("_jit_get_storage_deduplication", &getStorageDeduplication)
+      .def(
+          "_jit_storage_deduplication_saved_bytes",
+          &getStorageDeduplicationSavedBytes)
       .def("_jit_texpr_fallback_allowed", &tensorexpr::fallbackAllowed)
       .def("_jit_texpr_set_fallback_allowed", &tensorexpr::setFallbackAllowed)
       .def("_jit_set_texpr_reductions_enabled", &setTexprReductionsEnabled)
@@ -1125,6 +1227,11 @@ void initJITBindings(PyObject* module) {
             return retval;
           })
       .def("_jit_pass_batch_mm", BatchMM)
+      .def(
+          "_jit_pass_parallelize_branches",
+          [](std::shared_ptr<Graph>& graph) {
+            return ParallelizeIndependentBranches(graph);
+          })
       .def(
           "_jit_decay_packed_param_input_types",
           [](Graph& g) {
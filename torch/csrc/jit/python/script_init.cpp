@@ -1520,6 +1520,20 @@ void initJitScriptBindings(PyObject* module) {
                 .get_executor()
                 .debugFlushCompilationCache();
           })
+      .def(
+          "_serialize_warm_start_plan",
+          [](const StrongFunctionPtr& self) {
+            return py::bytes(toGraphFunction(*self.function_)
+                                 .get_executor()
+                                 .serializeWarmStartPlan());
+          })
+      .def(
+          "_load_warm_start_plan",
+          [](const StrongFunctionPtr& self, const std::string& serialized) {
+            return toGraphFunction(*self.function_)
+                .get_executor()
+                .loadWarmStartPlan(serialized);
+          })
       .def_property_readonly(
           "name",
           [](const StrongFunctionPtr& self) { return self.function_->name(); })
@@ -1581,6 +1595,16 @@ void initJitScriptBindings(PyObject* module) {
           [](Method& self) {
             return self.get_executor().debugFlushCompilationCache();
           })
+      .def(
+          "_serialize_warm_start_plan",
+          [](Method& self) {
+            return py::bytes(self.get_executor().serializeWarmStartPlan());
+          })
+      .def(
+          "_load_warm_start_plan",
+          [](Method& self, const std::string& serialized) {
+            return self.get_executor().loadWarmStartPlan(serialized);
+          })
       .def_property_readonly(
           "code_with_constants",
           [](Method& self) {
@@ -842,6 +842,14 @@ GraphExecutorState GraphExecutor::getDebugState() {
   return pImpl->getDebugState();
 }
 
+std::string GraphExecutor::serializeWarmStartPlan() {
+  return pImpl->serializeWarmStartPlan();
+}
+
+bool GraphExecutor::loadWarmStartPlan(const std::string& serialized) {
+  return pImpl->loadWarmStartPlan(serialized);
+}
+
 void GraphExecutor::debugFlushCompilationCache() {
   if (auto ppImpl =
           std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
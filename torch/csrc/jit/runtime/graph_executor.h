@@ -85,6 +85,17 @@ struct TORCH_API GraphExecutor {
       c10::optional<size_t> remaining_bailout_depth = c10::nullopt);
   GraphExecutorState getDebugState();
 
+  // Serializes the optimized execution plan so a later process can skip
+  // re-profiling and re-optimization; see Note [Warm-start execution plans].
+  // Returns an empty string if no optimized plan is available yet or the
+  // plan cannot be serialized faithfully.
+  std::string serializeWarmStartPlan();
+
+  // Installs a plan produced by serializeWarmStartPlan in a previous process.
+  // Returns false (leaving the executor untouched) if the payload was made
+  // from a different graph or under different pipeline settings.
+  bool loadWarmStartPlan(const std::string& serialized);
+
   void debugFlushCompilationCache();
 
   bool isOptimized() const;
@@ -83,6 +83,15 @@ struct GraphExecutorImplBase {
   virtual GraphExecutorState getDebugState() = 0;
   virtual ~GraphExecutorImplBase() = default;
 
+  // Warm-start plans are only supported by the profiling executor; the
+  // other executors just report "nothing to serialize".
+  virtual std::string serializeWarmStartPlan() {
+    return std::string();
+  }
+  virtual bool loadWarmStartPlan(const std::string& serialized) {
+    return false;
+  }
+
   virtual bool isOptimized() const {
     return false;
   }
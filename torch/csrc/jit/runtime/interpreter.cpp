@@ -3,6 +3,8 @@
 #include <ATen/Parallel.h>
 #include <ATen/core/ivalue.h>
 #include <ATen/record_function.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/core/thread_pool.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
@@ -34,6 +36,7 @@
 using torch::distributed::autograd::DistAutogradContainer;
 #endif
 
+#include <algorithm>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -112,8 +115,11 @@ struct TLSCurrentInterpreterGuard {
 
 // InterpreterState state that and used to compute a Code
 struct InterpreterStateImpl : c10::intrusive_ptr_target {
-  InterpreterStateImpl(const Code& code, TaskLauncher taskLauncher)
-      : taskLauncher_(std::move(taskLauncher)) {
+  InterpreterStateImpl(
+      const Code& code,
+      TaskLauncher taskLauncher,
+      std::vector<c10::Device> devices = {})
+      : taskLauncher_(std::move(taskLauncher)), devices_(std::move(devices)) {
     enterFrame(code, 0);
   }
 
@@ -141,6 +147,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
   int64_t stack_start_ = -1;
   c10::intrusive_ptr<Future> future_;
   TaskLauncher taskLauncher_;
+  // devices the future produced by this interpreter completes on; when
+  // non-empty, the future records events on these devices' current streams at
+  // markCompleted so waiters can join without a device-wide sync
+  std::vector<c10::Device> devices_;
 
   // this holds all the tensors for this interpreter run
   // we don't bother minimizing the size of this vector, since the extra
@@ -165,6 +175,9 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 
   void enterFrame(const Code& code, size_t base_pointer) {
     frames.emplace_back(Frame{code.pImpl, 0, base_pointer, c10::nullopt});
+    Frame& frame = frames.back();
+    frame.instructions = frame.function->instructions_.data();
+    frame.operators = frame.function->operator_table_.data();
     registers.resize(registers.size() + code.pImpl->register_size_);
   }
 
@@ -215,7 +228,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 // Also blocks should be ended properly with either `INST_NEXT` (for going
 // to the next instruction), or `INST_DISPATCH` (for jumping to a computed
 // position using `INST_FETCH`).
-#define INST_FETCH(X) (frame.function->instructions_[frame.pc += (X)])
+#define INST_FETCH(X) (frame.instructions[frame.pc += (X)])
 #define INST_GUARD                                   \
   profiling::InstructionSpan span {                  \
     *frame.function->instructions_source()[frame.pc] \
@@ -289,7 +302,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 #ifndef NDEBUG
             size_t init_size = stack.size();
 #endif
-            frame.function->operator_table_[inst.X](stack);
+            frame.operators[inst.X](stack);
 #ifndef NDEBUG
             frame.function->assert_stack_size(inst.X, init_size, stack.size());
 #endif
@@ -301,7 +314,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 #ifndef NDEBUG
             size_t init_size = stack.size();
 #endif
-            frame.function->operator_table_[inst.X](stack);
+            frame.operators[inst.X](stack);
 #ifndef NDEBUG
             frame.function->assert_stack_size(inst.X, init_size, stack.size());
 #endif
@@ -718,12 +731,42 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             // Move inputs to a separate stack
             auto& forked_fn =
                 toGraphFunction(*frame.function->function_table_[inst.X]);
+            // In parallelize-branches mode, run the fork on a side stream of
+            // each device its inputs live on. Declaring those devices on the
+            // forked future makes waiters join via recorded events instead of
+            // a device-wide synchronization.
+            std::vector<c10::Device> fork_devices;
+            std::vector<c10::Stream> fork_streams;
+            if (FLAGS_torch_jit_parallelize_branches) {
+              IValue::HashAliasedIValues sub_values;
+              for (auto it = stack.end() - inst.N; it != stack.end(); ++it) {
+                it->getSubValues(sub_values);
+              }
+              for (const auto& sub_value : sub_values) {
+                if (!sub_value.isTensor()) {
+                  continue;
+                }
+                const auto device = sub_value.toTensor().device();
+                if (!device.is_cpu() &&
+                    std::find(
+                        fork_devices.begin(), fork_devices.end(), device) ==
+                        fork_devices.end()) {
+                  fork_devices.push_back(device);
+                  c10::impl::VirtualGuardImpl impl(device.type());
+                  fork_streams.push_back(impl.getStreamFromGlobalPool(device));
+                }
+              }
+            }
             InterpreterState forked_interpreter(
-                forked_fn.get_executor().getPlanFor(stack).code, taskLauncher_);
+                forked_fn.get_executor().getPlanFor(stack).code,
+                taskLauncher_,
+                fork_devices);
             InterpreterContinuation continuation(
                 forked_interpreter,
                 Stack(stack.end() - inst.N, stack.end()),
-                getDistAutogradContextId());
+                getDistAutogradContextId(),
+                c10::nullopt,
+                std::move(fork_streams));
             drop(stack, inst.N);
             push(stack, forked_interpreter.getFuture());
             taskLauncher_(std::move(continuation));
@@ -1032,8 +1075,8 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 
   c10::intrusive_ptr<Future> getOrCreateFuture() {
     if (!future_) {
-      future_ =
-          c10::make_intrusive<Future>(frames.front().function->return_type_);
+      future_ = c10::make_intrusive<Future>(
+          frames.front().function->return_type_, devices_);
     }
     return future_;
   }
@@ -1164,10 +1207,14 @@ size_t Code::register_size() const {
   return pImpl->register_size_;
 }
 
-InterpreterState::InterpreterState(const Code& code, TaskLauncher taskLauncher)
+InterpreterState::InterpreterState(
+    const Code& code,
+    TaskLauncher taskLauncher,
+    std::vector<c10::Device> devices)
     : pImpl(c10::make_intrusive<InterpreterStateImpl>(
           code,
-          std::move(taskLauncher))) {}
+          std::move(taskLauncher),
+          std::move(devices))) {}
 InterpreterState::~InterpreterState() = default;
 
 void InterpreterState::run(Stack& stack) {
@@ -1191,11 +1238,19 @@ void InterpreterContinuation::operator()() {
   auto prev_dist_id = DistAutogradContainer::currentContextId();
   DistAutogradContainer::forceCurrentContextId(dist_autograd_context_id_);
 #endif
+  auto run = [&]() {
+    if (streams_.empty()) {
+      state.runAsync(stack);
+    } else {
+      c10::MultiStreamGuard stream_guard(streams_);
+      state.runAsync(stack);
+    }
+  };
   if (tls_state_ != c10::nullopt) {
     at::ThreadLocalStateGuard g(*tls_state_);
-    state.runAsync(stack);
+    run();
   } else {
-    state.runAsync(stack);
+    run();
   }
 #ifdef USE_RPC
   DistAutogradContainer::forceCurrentContextId(prev_dist_id);
@@ -1,4 +1,6 @@
 #pragma once
+#include <c10/core/Device.h>
+#include <c10/core/Stream.h>
 #include <c10/util/Optional.h>
 #include <memory>
 #include <vector>
@@ -16,6 +18,7 @@ C10_CLANG_DIAGNOSTIC_IGNORE("-Wdeprecated-copy-dtor")
 
 C10_DECLARE_bool(torch_jit_disable_warning_prints);
 C10_DECLARE_bool(torch_jit_enable_rethrow_caught_exception);
+C10_DECLARE_bool(torch_jit_parallelize_branches);
 
 namespace at {
 class Tensor;
@@ -94,9 +97,13 @@ struct TORCH_API MobileCode : Code {
 };
 
 struct InterpreterState {
+  // `devices` is forwarded to the Future this interpreter completes, so that
+  // consumers on other streams join via events rather than a full device sync;
+  // see Note [Lazy Future Callbacks] in aten/src/ATen/core/ivalue_inl.h.
   TORCH_API InterpreterState(
       const Code& code,
-      TaskLauncher taskLauncher = at::launch);
+      TaskLauncher taskLauncher = at::launch,
+      std::vector<c10::Device> devices = {});
   TORCH_API void run(Stack& stack);
   TORCH_API c10::intrusive_ptr<Future> runAsync(Stack& stack);
   c10::intrusive_ptr<Future> getFuture();
@@ -133,10 +140,12 @@ struct InterpreterContinuation {
       const InterpreterState& state_,
       Stack stack_,
       int64_t dist_autograd_context_id = 0,
-      c10::optional<at::ThreadLocalState> tls_state = c10::nullopt)
+      c10::optional<at::ThreadLocalState> tls_state = c10::nullopt,
+      std::vector<c10::Stream> streams = {})
       : state(state_),
         stack(std::move(stack_)),
-        tls_state_(std::move(tls_state)) {
+        tls_state_(std::move(tls_state)),
+        streams_(std::move(streams)) {
 #ifdef USE_DISTRIBUTED
     dist_autograd_context_id_ = dist_autograd_context_id;
 #endif
@@ -148,6 +157,9 @@ struct InterpreterContinuation {
   InterpreterState state;
   Stack stack;
   c10::optional<at::ThreadLocalState> tls_state_ = c10::nullopt;
+  // When non-empty, the continuation runs with these as the current streams
+  // (one per device), letting forked work overlap the caller's stream.
+  std::vector<c10::Stream> streams_;
 #ifdef USE_DISTRIBUTED
   int64_t dist_autograd_context_id_;
 #endif
@@ -36,6 +36,16 @@ struct Frame {
   // symbol table for a frame
   ShapeSymbolTable symbols2dims;
 
+  // Raw views of `function`'s instruction and operator tables, cached when
+  // the frame is entered so the hot dispatch loop does a single indexed
+  // load per instruction instead of chasing function -> vector -> data.
+  // The underlying vectors never grow while a frame is live (bailout
+  // blocks are merged at construction; at runtime only opcodes are patched
+  // in place, see FAIL_GUARD), so these stay valid for the frame's
+  // lifetime.
+  const Instruction* instructions = nullptr;
+  const Operation* operators = nullptr;
+
   static size_t genId();
 };
 
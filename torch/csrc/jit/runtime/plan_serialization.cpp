@@ -0,0 +1,252 @@
+#include <torch/csrc/jit/runtime/plan_serialization.h>
+
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/irparser.h>
+
+#include <cctype>
+#include <sstream>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+bool isSerializableBlock(const Block* block) {
+  for (const Node* n : block->nodes()) {
+    // The printer deliberately skips every attribute of a
+    // DifferentiableGraph except Subgraph, so its reverse graph would be
+    // lost in the round trip.
+    if (n->kind() == prim::DifferentiableGraph) {
+      return false;
+    }
+    for (const Symbol name : n->attributeNames()) {
+      switch (n->kindOf(name)) {
+        case AttributeKind::t:
+        case AttributeKind::ts:
+        case AttributeKind::gs:
+        case AttributeKind::ival:
+          // Printed as summaries ("<Tensor>", "[<Tensors>]", ...) or with
+          // data the parser would reinitialize randomly.
+          return false;
+        case AttributeKind::g:
+          if (name != attr::Subgraph) {
+            return false;
+          }
+          if (!isSerializableBlock(n->g(name)->block())) {
+            return false;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+    for (const Block* b : n->blocks()) {
+      if (!isSerializableBlock(b)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Mirrors Graph::print, except that source-location comments are suppressed
+// everywhere (Graph::print only suppresses them in the top-level graph, not
+// in the `with ...` subgraph trailers, and parseIR can't skip them).
+void printPlanGraph(std::ostream& out, const Graph& graph) {
+  out << "graph(";
+  size_t i = 0;
+  for (const Value* input : graph.inputs()) {
+    if (i++ > 0) {
+      out << ",\n      ";
+    }
+    out << "%" << input->debugName() << " : " << *input->type();
+  }
+  out << "):\n";
+  std::vector<const Node*> groups;
+  for (const Node* n : graph.nodes()) {
+    n->print(out, 1, &groups, /*print_source_locations=*/false);
+  }
+  out << "  return (";
+  i = 0;
+  for (const Value* output : graph.outputs()) {
+    if (i++ > 0) {
+      out << ", ";
+    }
+    out << "%" << output->debugName();
+  }
+  out << ")\n";
+  i = 0;
+  for (const Node* fg : groups) {
+    out << "with " << fg->kind().toQualString() << "_" << i++ << " = ";
+    printPlanGraph(out, *fg->g(attr::Subgraph));
+  }
+}
+
+// Collects the `<kind>_<index>` names of fusion-group nodes referenced in a
+// printed graph body, in order of appearance. These are exactly the names the
+// `with ...` trailers following the body will define.
+std::vector<std::string> findGroupNames(const std::string& body) {
+  std::vector<std::string> names;
+  size_t pos = 0;
+  while ((pos = body.find(" = ", pos)) != std::string::npos) {
+    const size_t start = pos + 3;
+    pos = start;
+    const size_t end = body.find_first_of("[(", start);
+    if (end == std::string::npos) {
+      continue;
+    }
+    const std::string token = body.substr(start, end - start);
+    const size_t underscore = token.rfind('_');
+    if (token.find("::") == std::string::npos ||
+        underscore == std::string::npos || underscore + 1 == token.size()) {
+      continue;
+    }
+    bool all_digits = true;
+    for (size_t j = underscore + 1; j < token.size(); ++j) {
+      all_digits = all_digits && isdigit(static_cast<unsigned char>(token[j]));
+    }
+    if (all_digits) {
+      names.push_back(token);
+    }
+  }
+  return names;
+}
+
+// Replaces the single definition-site occurrence of `= <name>(` or
+// `= <name>[` in the body with the suffix-stripped node kind.
+void stripGroupSuffix(std::string& body, const std::string& name) {
+  const std::string needle = "= " + name;
+  size_t pos = 0;
+  while ((pos = body.find(needle, pos)) != std::string::npos) {
+    const size_t after = pos + needle.size();
+    if (after < body.size() && (body[after] == '(' || body[after] == '[')) {
+      body.erase(pos + 2 + name.rfind('_'), name.size() - name.rfind('_'));
+      return;
+    }
+    pos = after;
+  }
+  TORCH_CHECK(
+      false, "Malformed serialized plan: no definition of group ", name);
+}
+
+// Walks `block` in print order and attaches `subgraphs` to the nodes whose
+// kinds match `kinds`, consuming both in lockstep.
+void attachSubgraphs(
+    Block* block,
+    const std::vector<std::string>& kinds,
+    const std::vector<std::shared_ptr<Graph>>& subgraphs,
+    size_t& next) {
+  for (Node* n : block->nodes()) {
+    if (next < kinds.size() && kinds[next] == n->kind().toQualString() &&
+        !n->hasAttribute(attr::Subgraph)) {
+      n->g_(attr::Subgraph, subgraphs[next]);
+      ++next;
+    }
+    for (Block* b : n->blocks()) {
+      attachSubgraphs(b, kinds, subgraphs, next);
+    }
+  }
+}
+
+// Parses one `graph(...): ... return (...)` body starting at `pos`, plus the
+// `with ...` trailers defining the subgraphs its body references. Leaves
+// `pos` just past the consumed text.
+std::shared_ptr<Graph> parsePlanGraphAt(const std::string& text, size_t& pos) {
+  // The body ends at the first line reading "  return (...)"; nested block
+  // returns print as "-> (...)" and are indented deeper, so they can't be
+  // confused with it.
+  size_t body_end = std::string::npos;
+  for (size_t line_start = pos; line_start < text.size();) {
+    size_t line_end = text.find('\n', line_start);
+    if (line_end == std::string::npos) {
+      line_end = text.size() - 1;
+    }
+    if (text.compare(line_start, 10, "  return (") == 0) {
+      body_end = line_end + 1;
+      break;
+    }
+    line_start = line_end + 1;
+  }
+  TORCH_CHECK(
+      body_end != std::string::npos,
+      "Malformed serialized plan: missing return statement");
+
+  std::string body = text.substr(pos, body_end - pos);
+  pos = body_end;
+
+  const std::vector<std::string> group_names = findGroupNames(body);
+  std::vector<std::string> group_kinds;
+  for (const auto i : c10::irange(group_names.size())) {
+    const std::string& name = group_names[i];
+    TORCH_CHECK(
+        name.substr(name.rfind('_') + 1) == std::to_string(i),
+        "Malformed serialized plan: group ",
+        name,
+        " out of order");
+    group_kinds.push_back(name.substr(0, name.rfind('_')));
+    stripGroupSuffix(body, name);
+  }
+
+  auto graph = std::make_shared<Graph>();
+  parseIR(body, graph.get());
+
+  // Each trailer defines one group of this graph; a group's own trailers are
+  // consumed by the recursive call before the next one of ours is read.
+  std::vector<std::shared_ptr<Graph>> subgraphs;
+  for (const std::string& name : group_names) {
+    TORCH_CHECK(
+        text.compare(pos, 5, "with ") == 0,
+        "Malformed serialized plan: expected `with ",
+        name,
+        " = ...`");
+    pos += 5;
+    const size_t eq = text.find(" = ", pos);
+    TORCH_CHECK(
+        eq != std::string::npos && text.compare(pos, eq - pos, name) == 0,
+        "Malformed serialized plan: mismatched group name for ",
+        name);
+    pos = eq + 3;
+    subgraphs.push_back(parsePlanGraphAt(text, pos));
+  }
+
+  size_t next = 0;
+  attachSubgraphs(graph->block(), group_kinds, subgraphs, next);
+  TORCH_CHECK(
+      next == subgraphs.size(),
+      "Malformed serialized plan: failed to reattach all subgraphs");
+  return graph;
+}
+
+} // namespace
+
+bool isSerializablePlanGraph(const Graph& graph) {
+  return isSerializableBlock(graph.block());
+}
+
+std::string serializePlanGraph(const std::shared_ptr<Graph>& graph) {
+  std::ostringstream out;
+  printPlanGraph(out, *graph);
+  return out.str();
+}
+
+std::shared_ptr<Graph> parsePlanGraph(const std::string& serialized) {
+  size_t pos = 0;
+  auto graph = parsePlanGraphAt(serialized, pos);
+  TORCH_CHECK(
+      pos >= serialized.size(),
+      "Malformed serialized plan: trailing text after graph");
+  return graph;
+}
+
+uint64_t planFingerprint(const std::string& data) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : data) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+} // namespace jit
+} // namespace torch
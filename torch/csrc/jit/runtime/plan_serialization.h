@@ -0,0 +1,42 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace torch {
+namespace jit {
+
+// Helpers for serializing optimized execution-plan graphs to text and
+// rebuilding them in another process. See Note [Warm-start execution plans]
+// in profiling_graph_executor_impl.cpp for how these are used.
+//
+// Graph::print emits nodes carrying a Subgraph attribute (TensorExprGroup,
+// FallbackGraph, fusion groups in general) as `with <kind>_<index> =
+// graph(...)` trailers, which parseIR does not understand. serializePlanGraph
+// produces that format (minus source-location comments) and parsePlanGraph
+// round-trips it, reattaching the subgraph attributes.
+
+// Returns true if `graph` can be faithfully round-tripped through text.
+// Graphs holding tensor (or tensor-list) attributes are rejected because the
+// printed form doesn't preserve their data; prim::DifferentiableGraph is
+// rejected because its backward subgraph and gradient metadata are not
+// printed at all.
+TORCH_API bool isSerializablePlanGraph(const Graph& graph);
+
+// Serializes `graph`, including the subgraphs of fusion-group-like nodes.
+// The caller is expected to have checked isSerializablePlanGraph first.
+TORCH_API std::string serializePlanGraph(const std::shared_ptr<Graph>& graph);
+
+// Rebuilds a graph produced by serializePlanGraph. Throws c10::Error on
+// malformed input.
+TORCH_API std::shared_ptr<Graph> parsePlanGraph(const std::string& serialized);
+
+// Stable 64-bit FNV-1a hash, used to fingerprint the source graph and pass
+// pipeline configuration a serialized plan was produced under.
+TORCH_API uint64_t planFingerprint(const std::string& data);
+
+} // namespace jit
+} // namespace torch
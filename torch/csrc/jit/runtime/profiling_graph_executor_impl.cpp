@@ -26,6 +26,8 @@
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_grad_of.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
+#include <torch/csrc/jit/passes/parallelize_branches.h>
+#include <torch/csrc/jit/passes/pass_instrumentation.h>
 #include <torch/csrc/jit/passes/pass_manager.h>
 #include <torch/csrc/jit/passes/peephole.h>
 #include <torch/csrc/jit/passes/remove_expands.h>
@@ -36,7 +38,10 @@
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/passes/update_differentiable_graph_requires_grad.h>
 #include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <torch/csrc/jit/runtime/plan_serialization.h>
+#include <algorithm>
 #include <mutex>
+#include <sstream>
 
 C10_DEFINE_bool(
     torch_jit_enable_new_executor,
@@ -58,8 +63,37 @@ C10_DEFINE_bool(
     false,
     "fuse on 12 dynamic compilations");
 
+C10_DEFINE_bool(
+    torch_jit_parallelize_branches,
+    false,
+    "Fork data-independent regions of straight-line graphs and run each fork "
+    "on a side stream of the devices its inputs live on");
+
 constexpr size_t kDefaultNumProfiledRuns = 1;
 constexpr size_t kDefaultBailoutDepth = 20;
+constexpr size_t kDefaultTierProfileThreshold = 50;
+constexpr size_t kDefaultTierOptimizeThreshold = 60;
+constexpr size_t kDefaultTierHotCallsPerSecond = 100;
+
+C10_DEFINE_bool(
+    torch_jit_tiered_execution,
+    false,
+    "Interpret graphs without profiling instrumentation until they have "
+    "seen enough calls to be worth specializing");
+
+C10_DEFINE_int64(
+    torch_jit_tier_profile_threshold,
+    kDefaultTierProfileThreshold,
+    "Number of calls below which a graph is interpreted without profiling");
+C10_DEFINE_int64(
+    torch_jit_tier_optimize_threshold,
+    kDefaultTierOptimizeThreshold,
+    "Number of calls above which a graph is fully optimized");
+C10_DEFINE_int64(
+    torch_jit_tier_hot_calls_per_second,
+    kDefaultTierHotCallsPerSecond,
+    "Observed call rate at which a graph is promoted out of the "
+    "interpret-only tier before reaching the call-count threshold");
 
 C10_DEFINE_int64(
     torch_jit_num_profiled_runs,
@@ -139,6 +173,68 @@ std::atomic<size_t>& getNumProfiledRuns() {
   return num_profiled_runs;
 }
 
+// Note [Tiered execution]
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// The executor normally instruments every graph with profiling nodes on
+// its very first call and optimizes after getNumProfiledRuns() runs. For
+// processes that load many graphs of which only a few are hot, that means
+// cold graphs pay profiling instrumentation forever (they never reach the
+// run count that retires it) while every graph gets specialized machinery
+// it may not need. With getTieredExecutionMode() enabled, each executor
+// moves through three tiers driven by its own call count:
+//
+//   tier 0 (< getTierProfileThreshold() calls): an uninstrumented plan
+//     built with only the profiling-insensitive passes; cold graphs stay
+//     here and never pay for profiling;
+//   tier 1: the usual instrumented profiling plan, sized so that
+//     optimization triggers at getTierOptimizeThreshold() total calls;
+//   tier 2: the fully optimized plan.
+//
+// The profile threshold adapts to observed call frequency: a graph whose
+// call rate exceeds getTierHotCallsPerSecond() is promoted to tier 1
+// immediately, so hot graphs do not wait out the full interpret-only
+// budget before specializing.
+
+static std::atomic<bool> tiered_execution_mode{false};
+static std::atomic<size_t> tier_profile_threshold{kDefaultTierProfileThreshold};
+static std::atomic<size_t> tier_optimize_threshold{
+    kDefaultTierOptimizeThreshold};
+static std::atomic<size_t> tier_hot_calls_per_second{
+    kDefaultTierHotCallsPerSecond};
+
+std::atomic<bool>& getTieredExecutionMode() {
+  static const bool init = []() {
+    return tiered_execution_mode = FLAGS_torch_jit_tiered_execution;
+  }();
+  (void)init; // Silence clang-tidy.
+  return tiered_execution_mode;
+}
+
+std::atomic<size_t>& getTierProfileThreshold() {
+  static const size_t init = []() {
+    return tier_profile_threshold = FLAGS_torch_jit_tier_profile_threshold;
+  }();
+  (void)init; // Silence clang-tidy.
+  return tier_profile_threshold;
+}
+
+std::atomic<size_t>& getTierOptimizeThreshold() {
+  static const size_t init = []() {
+    return tier_optimize_threshold = FLAGS_torch_jit_tier_optimize_threshold;
+  }();
+  (void)init; // Silence clang-tidy.
+  return tier_optimize_threshold;
+}
+
+std::atomic<size_t>& getTierHotCallsPerSecond() {
+  static const size_t init = []() {
+    return tier_hot_calls_per_second =
+               FLAGS_torch_jit_tier_hot_calls_per_second;
+  }();
+  (void)init; // Silence clang-tidy.
+  return tier_hot_calls_per_second;
+}
+
 size_t getBailoutDepth() {
   // Initialize bailout_depth from command-line flag.
   size_t depth = 0;
@@ -310,15 +406,16 @@ static bool guardDifferentiableGraph(Node* dnode) {
 
 void runNooptPassPipeline(std::shared_ptr<Graph>& graph) {
   GRAPH_DEBUG("Before Inliner (beginning of runNooptPassPipeline)\n", *graph);
-  Inline(*graph);
+  instrumentedPass("Inline", *graph, [&] { Inline(*graph); });
   GRAPH_DEBUG("After Inline, Before NoGrad\n", *graph);
-  LowerGradOf(*graph);
+  instrumentedPass("LowerGradOf", *graph, [&] { LowerGradOf(*graph); });
   GRAPH_DEBUG("After LowerGradOf, before RemoveExpands\n", *graph);
-  RemoveExpands(graph);
+  instrumentedPass("RemoveExpands", *graph, [&] { RemoveExpands(graph); });
   GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-  CanonicalizeOps(graph);
+  instrumentedPass("CanonicalizeOps", *graph, [&] { CanonicalizeOps(graph); });
   GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
   GRAPH_DEBUG(
       "After EliminateDeadCode (end of runNooptPassPipeline)\n", *graph);
 }
@@ -328,58 +425,74 @@ static void runPreAutodiffPassPipeline(std::shared_ptr<Graph>& graph) {
       "Before InsertGuards (beginning of runPreAutodiffPassPipeline)\n",
       *graph);
 
-  LowerGradOf(*graph);
+  instrumentedPass("LowerGradOf", *graph, [&] { LowerGradOf(*graph); });
   GRAPH_DEBUG("After LowerGradOf, before specializeAutogradZero\n", *graph);
 
-  specializeAutogradZero(graph);
+  instrumentedPass(
+      "specializeAutogradZero", *graph, [&] { specializeAutogradZero(graph); });
   GRAPH_DEBUG("After specializeAutogradZero\n", *graph);
   // runRequiredPasses
   {
-    RemoveExpands(graph);
+    instrumentedPass("RemoveExpands", *graph, [&] { RemoveExpands(graph); });
     GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-    CanonicalizeOps(graph);
+    instrumentedPass(
+        "CanonicalizeOps", *graph, [&] { CanonicalizeOps(graph); });
     GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-    EliminateDeadCode(graph);
+    instrumentedPass(
+        "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
     GRAPH_DEBUG("After EliminateDeadCode", *graph);
   }
-  PeepholeOptimize(graph);
+  instrumentedPass(
+      "PeepholeOptimize", *graph, [&] { PeepholeOptimize(graph); });
   GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-  ConstantPropagation(graph);
+  instrumentedPass(
+      "ConstantPropagation", *graph, [&] { ConstantPropagation(graph); });
 
   // runOptimization:
   {
-    EliminateDeadCode(graph);
+    instrumentedPass(
+        "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
     GRAPH_DEBUG(
         "After EliminateDeadCode, before EliminateCommonSubexpression\n",
         *graph);
-    EliminateCommonSubexpression(graph);
+    instrumentedPass("EliminateCommonSubexpression", *graph, [&] {
+      EliminateCommonSubexpression(graph);
+    });
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before PeepholeOptimize\n",
         *graph);
 
-    PeepholeOptimize(graph);
+    instrumentedPass(
+        "PeepholeOptimize", *graph, [&] { PeepholeOptimize(graph); });
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    instrumentedPass(
+        "ConstantPropagation", *graph, [&] { ConstantPropagation(graph); });
     GRAPH_DEBUG("After ConstantPropagation, before ConstantPooling\n", *graph);
-    ConstantPooling(graph);
+    instrumentedPass(
+        "ConstantPooling", *graph, [&] { ConstantPooling(graph); });
     GRAPH_DEBUG("After ConstantPooling, before UnrollLoops\n", *graph);
 
-    UnrollLoops(graph);
+    instrumentedPass("UnrollLoops", *graph, [&] { UnrollLoops(graph); });
     GRAPH_DEBUG("After UnrollLoops, before RemoveListMutation\n", *graph);
     // run again with unrolled loops
-    RemoveListMutation(graph);
+    instrumentedPass(
+        "RemoveListMutation", *graph, [&] { RemoveListMutation(graph); });
     GRAPH_DEBUG("After RemoveListMutation, before PeepholeOptimize\n", *graph);
-    PeepholeOptimize(graph);
+    instrumentedPass(
+        "PeepholeOptimize", *graph, [&] { PeepholeOptimize(graph); });
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    instrumentedPass(
+        "ConstantPropagation", *graph, [&] { ConstantPropagation(graph); });
     GRAPH_DEBUG(
         "After ConstantPropagation, before EliminateCommonSubexpression\n",
         *graph);
 
-    EliminateCommonSubexpression(graph);
+    instrumentedPass("EliminateCommonSubexpression", *graph, [&] {
+      EliminateCommonSubexpression(graph);
+    });
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before CheckInplace\n", *graph);
-    CheckInplace(graph);
+    instrumentedPass("CheckInplace", *graph, [&] { CheckInplace(graph); });
   }
   GRAPH_DEBUG(
       "After CheckInplace (end of runPreAutodiffPassPipeline)\n", *graph);
@@ -407,14 +520,17 @@ void ProfilingGraphExecutorImpl::runNoGradOptimizations(
   // runNondiffOptimization
   {
     // Run custom passes that different backends can register.
-    for (const auto& passPair : getCustomPrePasses()) {
-      passPair.first(graph);
-    }
+    instrumentedPass("CustomPrePasses", *graph, [&] {
+      for (const auto& passPair : getCustomPrePasses()) {
+        passPair.first(graph);
+      }
+    });
     GRAPH_DEBUG("After customPrePasses, before LowerSimpleTuples\n", *graph);
 
     // TupleConstruct / TupleUnpack pairs can still be present at this point
     // and must be removed for fusion.
-    LowerSimpleTuples(graph);
+    instrumentedPass(
+        "LowerSimpleTuples", *graph, [&] { LowerSimpleTuples(graph); });
     GRAPH_DEBUG("After LowerSimpleTuples\n", *graph);
 
     if (tensorExprFuserEnabled()) {
@@ -426,36 +542,44 @@ void ProfilingGraphExecutorImpl::runNoGradOptimizations(
       // inserting proper type checks. Once we're done with these optimizations
       // we will wipe the tensor type information from the IR, so that it's not
       // accidentally used by any other pass.
-      RemoveProfileNodesAndSpecializeTypes(graph);
+      instrumentedPass("RemoveProfileNodesAndSpecializeTypes", *graph, [&] {
+        RemoveProfileNodesAndSpecializeTypes(graph);
+      });
       GRAPH_DEBUG(
           "After RemoveProfileNodesAndSpecializeTypes, before BatchMM\n",
           *graph);
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      instrumentedPass("BatchMM", *graph, [&] { BatchMM(graph); });
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
       auto min_size = getFusionGroupInlining() ? 2 : 1;
       bool dyn_shapes = getCurrentBehavior(remaining_bailout_depth) ==
           FusionBehavior::DYNAMIC;
-      FuseTensorExprs(graph, min_size, /* composed op*/ false, dyn_shapes);
+      instrumentedPass("FuseTensorExprs", *graph, [&] {
+        FuseTensorExprs(graph, min_size, /* composed op*/ false, dyn_shapes);
+      });
       GRAPH_DEBUG("After Fusion, before customPostPasses\n", *graph);
     } else {
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      instrumentedPass("BatchMM", *graph, [&] { BatchMM(graph); });
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
 
-      FuseGraph(graph, true);
+      instrumentedPass("FuseGraph", *graph, [&] { FuseGraph(graph, true); });
       GRAPH_DEBUG("After Fusion, before customPostPasses\n", *graph);
     }
 
     // Run custom post-fusion passes
     // e.g. NVFuser
-    for (const auto& passPair : getCustomPostPasses()) {
-      passPair.first(graph);
-    }
+    instrumentedPass("CustomPostPasses", *graph, [&] {
+      for (const auto& passPair : getCustomPostPasses()) {
+        passPair.first(graph);
+      }
+    });
     GRAPH_DEBUG(
         "After customPostPasses, before RemoveTensorTypeSpecializations \n",
         *graph);
-    RemoveTensorTypeSpecializations(graph);
+    instrumentedPass("RemoveTensorTypeSpecializations", *graph, [&] {
+      RemoveTensorTypeSpecializations(graph);
+    });
     GRAPH_DEBUG("After RemoveTensorTypeSpecializations\n", *graph);
   }
   GRAPH_DEBUG("End of runNoGradOptimizations\n");
@@ -473,9 +597,12 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
   runPreAutodiffPassPipeline(copy);
 
   if (needsGradientInProfilingMode(copy->block())) {
-    auto diff_nodes = CreateAutodiffSubgraphs(
-        copy,
-        getAutodiffSubgraphInlining() ? autodiffSubgraphNodeThreshold : 1);
+    std::vector<Node*> diff_nodes;
+    instrumentedPass("CreateAutodiffSubgraphs", *copy, [&] {
+      diff_nodes = CreateAutodiffSubgraphs(
+          copy,
+          getAutodiffSubgraphInlining() ? autodiffSubgraphNodeThreshold : 1);
+    });
     GRAPH_DEBUG("After CreateAutodiffSubgraphs\n", *copy);
     size_t idx = 0;
     for (Node* dnode : diff_nodes) {
@@ -503,9 +630,11 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
       packGradient(gradient, dnode);
       GRAPH_DEBUG("Finished optimizing diff node ", idx++);
     }
-    InlineAutodiffSubgraphs(
-        copy,
-        getAutodiffSubgraphInlining() ? autodiffSubgraphNodeThreshold : 1);
+    instrumentedPass("InlineAutodiffSubgraphs", *copy, [&] {
+      InlineAutodiffSubgraphs(
+          copy,
+          getAutodiffSubgraphInlining() ? autodiffSubgraphNodeThreshold : 1);
+    });
     replaceFallbackGraphWithFallbackFunction(copy->block());
     ProfilingRecord::removeProfilingNodes(copy->block());
     GRAPH_DEBUG(
@@ -513,7 +642,7 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
   } else {
     runNoGradOptimizations(copy, remaining_bailout_depth);
   }
-  EliminateDeadCode(copy);
+  instrumentedPass("EliminateDeadCode", *copy, [&] { EliminateDeadCode(copy); });
   GRAPH_DEBUG("After runProfilingOptimizations:\n", *copy);
 }
 
@@ -530,21 +659,24 @@ void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
   GRAPH_DEBUG("After inlining, before ClearProfilingInformation\n", *graph);
   ClearProfilingInformation(graph);
   GRAPH_DEBUG("After ClearProfilingInformation, before LowerGradOf\n", *graph);
-  LowerGradOf(*graph);
+  instrumentedPass("LowerGradOf", *graph, [&] { LowerGradOf(*graph); });
   GRAPH_DEBUG("After LowerGradOf, before ClearUndefinedness\n", *graph);
   // clear any residual undefinedness
   // as double backward graph inputs'
   // may carry over undefinedness
   // from profiled backward graphs
-  ClearUndefinedness(graph);
+  instrumentedPass(
+      "ClearUndefinedness", *graph, [&] { ClearUndefinedness(graph); });
   // runRequiredPasses
   {
     GRAPH_DEBUG("After ClearUndefinedness, before RemoveExpands\n", *graph);
-    RemoveExpands(graph);
+    instrumentedPass("RemoveExpands", *graph, [&] { RemoveExpands(graph); });
     GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-    CanonicalizeOps(graph);
+    instrumentedPass(
+        "CanonicalizeOps", *graph, [&] { CanonicalizeOps(graph); });
     GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-    EliminateDeadCode(graph);
+    instrumentedPass(
+        "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
   }
   if (!getGraphExecutorOptimize()) {
     GRAPH_DEBUG(
@@ -554,25 +686,32 @@ void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
   }
 
   GRAPH_DEBUG("After EliminateDeadCode, before DecomposeOps\n", *graph);
-  DecomposeOps(graph);
+  instrumentedPass("DecomposeOps", *graph, [&] { DecomposeOps(graph); });
   GRAPH_DEBUG("After DecomposeOps, before ConstantPropagation\n", *graph);
-  ConstantPropagation(graph);
+  instrumentedPass(
+      "ConstantPropagation", *graph, [&] { ConstantPropagation(graph); });
   GRAPH_DEBUG("After ConstantPropagation, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
   GRAPH_DEBUG(
       "After EliminateDeadCode, before EliminateCommonSubexpression\n", *graph);
-  EliminateCommonSubexpression(graph);
+  instrumentedPass("EliminateCommonSubexpression", *graph, [&] {
+    EliminateCommonSubexpression(graph);
+  });
   GRAPH_DEBUG(
       "After EliminateCommonSubexpression, before ConstantPooling\n", *graph);
-  ConstantPooling(graph);
+  instrumentedPass("ConstantPooling", *graph, [&] { ConstantPooling(graph); });
   GRAPH_DEBUG("After ConstantPooling, before PeepholeOptimize\n", *graph);
-  PeepholeOptimize(graph);
+  instrumentedPass(
+      "PeepholeOptimize", *graph, [&] { PeepholeOptimize(graph); });
   GRAPH_DEBUG("After PeepholeOptimize, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  instrumentedPass(
+      "EliminateDeadCode", *graph, [&] { EliminateDeadCode(graph); });
   GRAPH_DEBUG("After EliminateDeadCode, before LowerSimpleTuples\n", *graph);
-  LowerSimpleTuples(graph);
+  instrumentedPass(
+      "LowerSimpleTuples", *graph, [&] { LowerSimpleTuples(graph); });
   GRAPH_DEBUG("After LowerSimpleTuples, before CheckInplace\n", *graph);
-  CheckInplace(graph);
+  instrumentedPass("CheckInplace", *graph, [&] { CheckInplace(graph); });
   GRAPH_DEBUG(
       "After CheckInplace (end of runProfilingInsensitiveOptimizations)\n",
       *graph);
@@ -585,6 +724,32 @@ ProfilingGraphExecutorImpl::ProfilingGraphExecutorImpl(
   fusion_strategy_ = getFusionStrategy();
 }
 
+bool ProfilingGraphExecutorImpl::shouldStartProfiling() {
+  const auto now = std::chrono::steady_clock::now();
+  if (!first_call_time_) {
+    first_call_time_ = now;
+  }
+  ++cold_calls_;
+  if (cold_calls_ >= getTierProfileThreshold()) {
+    return true;
+  }
+  // A rapidly-called graph should not wait out the full interpret-only
+  // budget; promote it as soon as its observed rate marks it hot. A few
+  // calls are required first so one tight burst of two calls does not
+  // produce a nonsense rate estimate.
+  constexpr size_t kMinCallsForRateEstimate = 8;
+  if (cold_calls_ >= kMinCallsForRateEstimate) {
+    const double elapsed =
+        std::chrono::duration<double>(now - *first_call_time_).count();
+    if (elapsed > 0 &&
+        static_cast<double>(cold_calls_) / elapsed >=
+            static_cast<double>(getTierHotCallsPerSecond())) {
+      return true;
+    }
+  }
+  return false;
+}
+
 size_t ProfilingGraphExecutorImpl::getInstantiatedBailoutDepth() {
   // Initialize bailout_depth from command-line flag.
   size_t depth = 0;
@@ -637,11 +802,31 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
     return *optimized_plan_;
   }
 
+  // Tier 0: interpret without instrumentation until the graph has earned
+  // profiling. See Note [Tiered execution].
+  if (getTieredExecutionMode() && !pr_ && !shouldStartProfiling()) {
+    if (!cold_plan_) {
+      auto copy = graph->copy();
+      runProfilingInsensitiveOptimizations(copy);
+      GRAPH_DUMP("Tier-0 Graph: ", copy);
+      cold_plan_ = ExecutionPlan(copy, function_name_);
+    }
+    return *cold_plan_;
+  }
+
   // if a profiling graph hasn't been created yet
   if (!pr_) {
     auto copy = graph->copy();
     runProfilingInsensitiveOptimizations(copy);
     pr_ = ProfilingRecord::instrumentGraph(copy);
+    if (getTieredExecutionMode()) {
+      // Size the profiling tier so full optimization lands at the
+      // configured total call count.
+      const size_t profile_at = getTierProfileThreshold();
+      const size_t optimize_at = getTierOptimizeThreshold();
+      pr_->profiling_count_ = std::max<size_t>(
+          1, optimize_at > profile_at ? optimize_at - profile_at : 1);
+    }
     // `InsertProfileNodesForSpecializeAutogradZero` profiles a definition vs a
     // use and it doesn't expect any profile nodes between a graph input and its
     // consumer, `aten::_grad_sum_to_size`. This means we need to run it first,
@@ -668,6 +853,11 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   auto copy = pr_->graph()->copy();
   ProfilingRecord::removeProfileCounter(copy->block());
   runProfilingOptimizations(copy, *remaining_bailout_depth_);
+  // Snapshot for serializeWarmStartPlan, taken while fallback paths are
+  // still plain FallbackGraph nodes (fallback *functions* hold raw
+  // GraphFunction pointers and can't be serialized).
+  // See Note [Warm-start execution plans].
+  warm_start_source_ = copy->copy();
   // replaces a fallback graph inserted by
   // specialize_autogradzero if one exists
   replaceFallbackGraphWithFallbackFunction(copy->block());
@@ -678,18 +868,40 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   return *optimized_plan_;
 }
 
+// Note [Lock-free plan publication]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Once profiling and optimization have completed, optimized_plan_ is never
+// modified again (short of debugFlushCompilationCache), yet every forward()
+// call used to serialize on compile_mutex just to read it. With many
+// concurrent serving threads that lock is hot. Instead, after the optimized
+// plan is constructed under the mutex, a raw pointer to it is published into
+// an atomic; steady-state callers read the atomic with acquire ordering and
+// never touch the mutex. The release store pairs with the acquire load to
+// make the fully-constructed plan visible. debugFlushCompilationCache
+// unpublishes (nulls the atomic) before resetting the plan, so readers that
+// miss fall back to the locked path.
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     c10::optional<size_t> remaining_bailout_depth) {
-  std::lock_guard<std::mutex> lock(compile_mutex);
+  // IMPORTANT: This is a hot path of calling a torchscript function. Try not
+  // to add any code above this.
+  if (const auto* plan = published_plan_.load(std::memory_order_acquire)) {
+    return *plan;
+  }
 
-  // IMPORTANT: This is a hot path of calling a torchscript function. Try not to
-  // add any code above this.
-  if (optimized_plan_) {
-    return *optimized_plan_;
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (!optimized_plan_) {
+    // if depth is not set, use
+    const ExecutionPlan& plan =
+        getOptimizedPlanFor(stack, remaining_bailout_depth);
+    if (!optimized_plan_) {
+      // Still profiling (or running the no-opt fallback); not steady state
+      // yet, so nothing to publish.
+      return plan;
+    }
   }
-  // if depth is not set, use
-  return getOptimizedPlanFor(stack, remaining_bailout_depth);
+  published_plan_.store(&*optimized_plan_, std::memory_order_release);
+  return *optimized_plan_;
 }
 
 GraphExecutorState ProfilingGraphExecutorImpl::getDebugState() {
@@ -700,6 +912,98 @@ GraphExecutorState ProfilingGraphExecutorImpl::getDebugState() {
   return state;
 }
 
+// Note [Warm-start execution plans]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Reaching an optimized plan requires getNumProfiledRuns() profiling
+// executions plus the full optimization pipeline, per graph. A serving
+// process loading hundreds of TorchScript graphs pays that cost on every
+// restart even though it always arrives at the same plans. To skip it,
+// serializeWarmStartPlan writes out the optimized graph (after profiling
+// optimizations, before fallback graphs are lowered to fallback function
+// calls) together with a fingerprint of the source graph and the pipeline
+// knobs that shaped it, and loadWarmStartPlan rebuilds the plan in a fresh
+// executor, re-running only the cheap tail of the pipeline (fallback
+// lowering and final optimizations). Callers are expected to stash the
+// payloads next to the model, e.g. in the archive's _extra_files, and feed
+// them back after load.
+//
+// The fingerprint makes a stale payload a silent miss, not a wrong plan:
+// if the model, the executor/fuser toggles, or the fusion strategy changed,
+// loadWarmStartPlan returns false and the executor profiles as usual. It is
+// not a security boundary; payloads are trusted like the model itself.
+//
+// Not every plan can be round-tripped through the textual IR form (see
+// plan_serialization.h); serializeWarmStartPlan returns an empty string for
+// those, and callers should simply not persist anything.
+
+uint64_t ProfilingGraphExecutorImpl::warmStartFingerprint() const {
+  std::ostringstream key;
+  key << graph->toString(/*print_source_locations=*/false);
+  key << "executor=" << getExecutorMode() << " profiling=" << getProfilingMode()
+      << " optimize=" << getGraphExecutorOptimize()
+      << " texpr=" << tensorExprFuserEnabled() << " strategy=";
+  for (const auto& pair : fusion_strategy_) {
+    key << (pair.first == FusionBehavior::STATIC ? "s" : "d") << pair.second
+        << ";";
+  }
+  return planFingerprint(key.str());
+}
+
+static constexpr const char* kWarmStartHeader = "torch.jit.warm_start.v1";
+
+std::string ProfilingGraphExecutorImpl::serializeWarmStartPlan() {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (!optimized_plan_ || !warm_start_source_ ||
+      !isSerializablePlanGraph(*warm_start_source_)) {
+    return std::string();
+  }
+  std::ostringstream out;
+  out << kWarmStartHeader << " fingerprint=" << warmStartFingerprint() << "\n";
+  out << serializePlanGraph(warm_start_source_);
+  return out.str();
+}
+
+bool ProfilingGraphExecutorImpl::loadWarmStartPlan(
+    const std::string& serialized) {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (optimized_plan_) {
+    // Already compiled; too late to warm start.
+    return false;
+  }
+  const std::string prefix = std::string(kWarmStartHeader) + " fingerprint=";
+  const size_t header_end = serialized.find('\n');
+  if (serialized.compare(0, prefix.size(), prefix) != 0 ||
+      header_end == std::string::npos) {
+    return false;
+  }
+  uint64_t fingerprint = 0;
+  try {
+    fingerprint = std::stoull(
+        serialized.substr(prefix.size(), header_end - prefix.size()));
+  } catch (const std::exception&) {
+    return false;
+  }
+  if (fingerprint != warmStartFingerprint()) {
+    return false;
+  }
+  try {
+    auto copy = parsePlanGraph(serialized.substr(header_end + 1));
+    if (!remaining_bailout_depth_.has_value()) {
+      remaining_bailout_depth_ = getInstantiatedBailoutDepth();
+    }
+    warm_start_source_ = copy->copy();
+    replaceFallbackGraphWithFallbackFunction(copy->block());
+    runFinalOptimizations(copy);
+    GRAPH_DUMP("Warm-started Graph: ", copy);
+    optimized_plan_ = ExecutionPlan(copy, function_name_);
+  } catch (const std::exception& e) {
+    TORCH_WARN("Failed to load warm-start plan: ", e.what());
+    return false;
+  }
+  published_plan_.store(&*optimized_plan_, std::memory_order_release);
+  return true;
+}
+
 static Node* insertFallbackFunctionCall(
     Graph* graph,
     GraphFunction* func,
@@ -774,6 +1078,9 @@ void ProfilingGraphExecutorImpl::replaceFallbackGraphWithFallbackFunction(
 void ProfilingGraphExecutorImpl::runFinalOptimizations(
     std::shared_ptr<Graph>& graph) {
   AddIfThenElseOp(graph);
+  if (FLAGS_torch_jit_parallelize_branches) {
+    ParallelizeIndependentBranches(graph);
+  }
 }
 
 } // namespace jit
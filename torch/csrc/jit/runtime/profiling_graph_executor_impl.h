@@ -3,6 +3,9 @@
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/runtime/graph_executor_impl.h>
 
+#include <atomic>
+#include <chrono>
+
 C10_DECLARE_bool(torch_jit_static_then_dynamic);
 
 C10_DECLARE_bool(torch_jit_always_dynamic);
@@ -12,6 +15,16 @@ namespace jit {
 
 TORCH_API void runNooptPassPipeline(std::shared_ptr<Graph>& graph);
 
+// Tiered execution knobs, see Note [Tiered execution]. When the mode is
+// enabled, a graph is interpreted without profiling instrumentation until
+// it has seen getTierProfileThreshold() calls (or its observed call rate
+// exceeds getTierHotCallsPerSecond()), profiles until
+// getTierOptimizeThreshold() calls, and is fully optimized afterwards.
+TORCH_API std::atomic<bool>& getTieredExecutionMode();
+TORCH_API std::atomic<size_t>& getTierProfileThreshold();
+TORCH_API std::atomic<size_t>& getTierOptimizeThreshold();
+TORCH_API std::atomic<size_t>& getTierHotCallsPerSecond();
+
 struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   ProfilingGraphExecutorImpl(
       const std::shared_ptr<Graph>& graph,
@@ -23,12 +36,22 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   GraphExecutorState getDebugState() override;
   ~ProfilingGraphExecutorImpl() override = default;
 
+  std::string serializeWarmStartPlan() override;
+  bool loadWarmStartPlan(const std::string& serialized) override;
+
   void debugFlushCompilationCache() {
     std::lock_guard<std::mutex> lock(compile_mutex);
+    // Unpublish before resetting so lock-free readers fall back to the
+    // mutex path (see Note [Lock-free plan publication]).
+    published_plan_.store(nullptr, std::memory_order_release);
     pr_.reset();
     fallback_plan_.reset();
     profiling_plan_.reset();
     optimized_plan_.reset();
+    warm_start_source_.reset();
+    cold_plan_.reset();
+    cold_calls_ = 0;
+    first_call_time_.reset();
     // prevent memory leaks
     fallback_functions_.clear();
     remaining_bailout_depth_.reset();
@@ -55,10 +78,28 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
       std::shared_ptr<Graph>& graph,
       size_t remaining_bailout_depth);
   void runFinalOptimizations(std::shared_ptr<Graph>& graph);
+  uint64_t warmStartFingerprint() const;
+  // prereq - holding compile_mutex. Counts the call and decides whether
+  // this graph has earned promotion out of the interpret-only tier.
+  // See Note [Tiered execution].
+  bool shouldStartProfiling();
   std::unique_ptr<ProfilingRecord> pr_;
+  // Interpret-only plan served while the graph is in tier 0.
+  // See Note [Tiered execution].
+  c10::optional<ExecutionPlan> cold_plan_;
+  size_t cold_calls_{0};
+  c10::optional<std::chrono::steady_clock::time_point> first_call_time_;
+  // Snapshot of the optimized graph taken before fallback graphs are turned
+  // into fallback function calls; this is what serializeWarmStartPlan
+  // writes out. See Note [Warm-start execution plans].
+  std::shared_ptr<Graph> warm_start_source_;
   c10::optional<ExecutionPlan>
       profiling_plan_; // plan to run in order to profiling the code
   c10::optional<ExecutionPlan> optimized_plan_;
+  // Once optimization completes, points at *optimized_plan_ so that
+  // steady-state getPlanFor calls skip compile_mutex entirely.
+  // See Note [Lock-free plan publication].
+  std::atomic<const ExecutionPlan*> published_plan_{nullptr};
   FusionStrategy fusion_strategy_;
 
   // this plan is used if getGraphExecutorOptimize is unset
@@ -12,6 +12,7 @@
 #include <bitset>
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -27,6 +28,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace torch {
 namespace jit {
 
@@ -1612,6 +1617,71 @@ int64_t stringFindImpl(
   return result;
 }
 
+// Note [SIMD substring search]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TorchScript text-preprocessing graphs lean heavily on aten::split.str and
+// aten::replace, and std::string::find is a byte-at-a-time scan in most
+// standard library implementations. stringFastFind drives the scan with
+// memchr on the first needle byte (which libc implements with SSE/AVX) and
+// verifies candidates with memcmp. When AVX2 is available at compile time,
+// it first filters 32 candidate positions per iteration by comparing the
+// first and last needle bytes across a 32-byte block, so the memcmp
+// verification only runs on positions where both already match.
+std::string::size_type stringFastFind(
+    const std::string& haystack,
+    const std::string& needle,
+    std::string::size_type pos) {
+  const auto h_size = haystack.size();
+  const auto n_size = needle.size();
+  if (n_size == 0) {
+    return pos <= h_size ? pos : std::string::npos;
+  }
+  if (pos >= h_size || n_size > h_size - pos) {
+    return std::string::npos;
+  }
+  const char* const h = haystack.data();
+  // One past the last position a match could start at.
+  const char* const h_end = h + h_size - n_size + 1;
+  const char* cur = h + pos;
+#if defined(__AVX2__)
+  if (n_size >= 2) {
+    const __m256i first = _mm256_set1_epi8(needle.front());
+    const __m256i last = _mm256_set1_epi8(needle.back());
+    while (cur + 32 <= h_end) {
+      const __m256i block_first =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur));
+      const __m256i block_last = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(cur + n_size - 1));
+      uint32_t mask =
+          static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+              _mm256_cmpeq_epi8(block_first, first),
+              _mm256_cmpeq_epi8(block_last, last))));
+      while (mask != 0) {
+        const auto offset = __builtin_ctz(mask);
+        if (std::memcmp(cur + offset + 1, needle.data() + 1, n_size - 2) ==
+            0) {
+          return (cur + offset) - h;
+        }
+        mask &= mask - 1;
+      }
+      cur += 32;
+    }
+  }
+#endif
+  while (cur < h_end) {
+    cur = static_cast<const char*>(
+        std::memchr(cur, needle.front(), h_end - cur));
+    if (cur == nullptr) {
+      return std::string::npos;
+    }
+    if (std::memcmp(cur + 1, needle.data() + 1, n_size - 1) == 0) {
+      return cur - h;
+    }
+    ++cur;
+  }
+  return std::string::npos;
+}
+
 // String Ops
 // Implementations located in torch/csrc/jit/runtime/register_prim_ops.cpp
 static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
@@ -1672,9 +1742,25 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
             throw std::runtime_error("ValueError: empty separator");
           }
 
+          // Count separators first so the output list is allocated once
+          // instead of growing piece by piece (see Note [SIMD substring
+          // search]).
+          size_t num_seps = 0;
+          while ((pos = stringFastFind(string, separator, pos)) !=
+                 std::string::npos) {
+            num_seps++;
+            pos += separator.size();
+          }
+          if (max >= 0) {
+            num_seps = std::min(num_seps, static_cast<size_t>(max));
+          }
+          splits.reserve(num_seps + 1);
+          pos = 0;
+
           auto count = 0;
 
-          while ((pos = string.find(separator, pos)) != std::string::npos) {
+          while ((pos = stringFastFind(string, separator, pos)) !=
+                 std::string::npos) {
             count++;
             if (max >= 0 && count > max) {
               break;
@@ -2155,15 +2241,39 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
           std::string string = pop(stack).toStringRef();
           int64_t occurrences = 0;
           std::string::size_type pos = 0;
-          while ((pos = string.find(old_str, pos)) != std::string::npos) {
+          if (old_str.empty()) {
+            // An empty pattern matches at every boundary; splicing in place
+            // also keeps the search position advancing.
+            while ((pos = string.find(old_str, pos)) != std::string::npos) {
+              if (max >= 0 && ++occurrences > max) {
+                break;
+              }
+              string = string.replace(pos, old_str.length(), new_str);
+              pos += new_str.length();
+            }
+            push(stack, string);
+            return;
+          }
+
+          // Stream unmatched spans and replacements into a fresh buffer so
+          // each match costs an append rather than an O(n) in-place splice
+          // (see Note [SIMD substring search]).
+          std::string::size_type prev_pos = 0;
+          std::string result;
+          result.reserve(string.size());
+          while ((pos = stringFastFind(string, old_str, pos)) !=
+                 std::string::npos) {
             if (max >= 0 && ++occurrences > max) {
               break;
             }
-            string = string.replace(pos, old_str.length(), new_str);
-            pos += new_str.length();
+            result.append(string, prev_pos, pos - prev_pos);
+            result.append(new_str);
+            pos += old_str.length();
+            prev_pos = pos;
           }
+          result.append(string, prev_pos, std::string::npos);
 
-          push(stack, string);
+          push(stack, std::move(result));
         },
         aliasAnalysisFromSchema()),
     OperatorGeneratorArgs(
@@ -2221,7 +2331,8 @@ static const std::vector<OperatorGeneratorArgs> stringOpGenArgs{
           std::string::size_type pos = 0;
           c10::List<std::string> splits;
           auto count = 0;
-          while ((pos = string.find(separator, pos)) != std::string::npos) {
+          while ((pos = stringFastFind(string, separator, pos)) !=
+                 std::string::npos) {
             count++;
             if (max >= 0 && count > max) {
               break;
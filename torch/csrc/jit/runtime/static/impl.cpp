@@ -7,6 +7,7 @@
 #include <c10/core/InferenceMode.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/MaybeOwned.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 #include <caffe2/core/scope_guard.h>
 #include <caffe2/core/timer.h>
@@ -297,7 +298,8 @@ std::pair<std::shared_ptr<Graph>, c10::optional<Module>> PrepareForStaticModule(
             << opts.manage_output_tensors << ", use_copy_variants "
             << opts.use_copy_variants << ", use_maybe_copy_variants "
             << opts.use_maybe_copy_variants << ", enable_tensorexpr_fusion "
-            << opts.enable_tensorexpr_fusion;
+            << opts.enable_tensorexpr_fusion << ", bucketed_memory_planning "
+            << opts.bucketed_memory_planning;
 
   Module module = m.copy();
   if (!is_frozen) {
@@ -1058,6 +1060,76 @@ void BlockRunner::create_memory_planner() {
 
 namespace {
 
+// Note [Shape-bucketed memory plans]
+// A memory plan records the high-water byte size of each managed storage
+// group, so with mixed input shapes (e.g. bucketed batch sizes 1/2/4/8)
+// a single plan converges to the largest bucket and every small-batch run
+// allocates and touches far more memory than it needs. When
+// bucketed_memory_planning is enabled, BlockRunner keeps one planner per
+// input-shape key instead: before each run we hash the sizes of the input
+// tensors and swap the matching planner into planner_, stashing the
+// previous one. A bucket's first run executes without a planner (dynamic
+// allocation, as for the very first run today) and its plan is created by
+// the Deallocator at the end of that run, so each plan converges to its
+// own bucket's sizes. Planners only hold per-run state between allocate()
+// and deallocate(), which makes swapping them between runs safe. The
+// number of buckets is capped; once full, unseen shapes reuse whichever
+// planner is active and grow it, matching the old behavior.
+constexpr size_t kMaxPlanBuckets = 8;
+
+size_t hash_input_shapes(
+    const std::vector<IValue>& args,
+    const KeywordArgs& kwargs) {
+  // Reserve 0 for "no bucket selected yet".
+  size_t key = 1;
+  for (const auto& arg : args) {
+    if (arg.isTensor()) {
+      key = c10::hash_combine(key, c10::get_hash(arg.toTensor().sizes()));
+    }
+  }
+  for (const auto& kv : kwargs) {
+    if (kv.second.isTensor()) {
+      key = c10::hash_combine(key, c10::get_hash(kv.second.toTensor().sizes()));
+    }
+  }
+  return key;
+}
+
+} // namespace
+
+void BlockRunner::select_memory_planner_bucket(
+    const std::vector<c10::IValue>& args,
+    const KeywordArgs& kwargs) {
+  if (!static_module_.opts().bucketed_memory_planning) {
+    return;
+  }
+  if (manage_output_tensors_enabled_) {
+    // Output tensor buffers outlive the run that allocated them, so the
+    // planner that owns them cannot be swapped out.
+    return;
+  }
+  const auto key = hash_input_shapes(args, kwargs);
+  if (key == active_plan_bucket_) {
+    return;
+  }
+  auto it = planner_buckets_.find(key);
+  if (it == planner_buckets_.end() && planner_buckets_.size() >= kMaxPlanBuckets) {
+    // Bucket table is full; keep the active plan and let it grow.
+    return;
+  }
+  // Take the new bucket's planner out before inserting; insertion may
+  // rehash and invalidate `it`.
+  std::unique_ptr<MemoryPlanner> next_planner;
+  if (it != planner_buckets_.end()) {
+    next_planner = std::move(it->second);
+  }
+  planner_buckets_[active_plan_bucket_] = std::move(planner_);
+  planner_ = std::move(next_planner);
+  active_plan_bucket_ = key;
+}
+
+namespace {
+
 void destroyNodeOutputs(ProcessedNode& p_node) {
   const auto borrows_outputs = borrowsOutputs(p_node.node()->kind());
   const auto num_outputs = static_cast<uint32_t>(p_node.num_outputs());
@@ -1090,6 +1162,8 @@ void BlockRunner::clean_up_intermediate_ivalues() noexcept {
 
 void BlockRunner::resetMemory() noexcept {
   planner_.reset();
+  planner_buckets_.clear();
+  active_plan_bucket_ = 0;
   // We must clean up intermediate values before inputs in case
   // there are borrowed inputs and static runtime owns the only
   // reference (e.g. the inputs were std::move'd into the runtime)
@@ -1277,6 +1351,7 @@ c10::IValue BlockRunner::run_impl(
   {
     auto on_exit = Deallocator(*this);
 
+    select_memory_planner_bucket(args, kwargs);
     if (planner_) {
       DCHECK(!manage_output_tensors_enabled_ || checkOutputTensorMemoryLeaks());
       planner_->allocate();
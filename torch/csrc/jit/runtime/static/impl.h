@@ -174,6 +174,12 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // maintain a separate memory plan per input-shape bucket instead of a
+  // single plan that high-waters across all observed shapes. Useful for
+  // bucketed-batch serving (e.g. batch 1/2/4/8), where a single plan sized
+  // for the largest bucket over-allocates every small-batch iteration.
+  // See Note [Shape-bucketed memory plans].
+  bool bucketed_memory_planning{false};
 };
 
 /*
@@ -728,6 +734,13 @@ class TORCH_API BlockRunner {
 
   void create_memory_planner();
 
+  // Swap in the memory planner for the bucket matching the input shapes.
+  // See Note [Shape-bucketed memory plans]. No-op unless
+  // bucketed_memory_planning is set.
+  void select_memory_planner_bucket(
+      const std::vector<c10::IValue>& args,
+      const KeywordArgs& kwargs);
+
   float benchmark_model(
       const std::vector<std::vector<c10::IValue>>& args_list,
       const std::vector<KeywordArgs>& kwargs_list,
@@ -749,6 +762,10 @@ class TORCH_API BlockRunner {
 
   bool manage_output_tensors_enabled_ = false;
   std::unique_ptr<MemoryPlanner> planner_;
+  // Inactive per-shape-bucket planners, keyed by input shape hash.
+  // See Note [Shape-bucketed memory plans].
+  c10::FastMap<size_t, std::unique_ptr<MemoryPlanner>> planner_buckets_;
+  size_t active_plan_bucket_ = 0;
   // [Shared values array]
   // ProcessedNodes reference their inputs and outputs with
   // offsets into this array, which saves memory.
@@ -293,6 +293,18 @@ void tupleConstruct(Stack& stack, size_t num_inputs) {
       stack.back() = std::move(tuple);
       break;
     }
+    case 4: {
+      auto tuple = c10::ivalue::Tuple::create(
+          std::move(stack[stack.size() - 4]),
+          std::move(stack[stack.size() - 3]),
+          std::move(stack[stack.size() - 2]),
+          std::move(stack[stack.size() - 1]));
+      stack.pop_back();
+      stack.pop_back();
+      stack.pop_back();
+      stack.back() = std::move(tuple);
+      break;
+    }
     default: {
       std::vector<IValue> elems{
           std::make_move_iterator(stack.end() - num_inputs),
@@ -1,6 +1,9 @@
 #include <torch/csrc/jit/serialization/export.h>
 
+#include <c10/core/Event.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/util/Exception.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/backends/backend_debug_handler.h>
 #include <torch/csrc/jit/backends/backend_debug_info.h>
@@ -32,6 +35,7 @@
 #include <ATen/core/jit_type.h>
 #include <ATen/core/qualified_name.h>
 #include <cerrno>
+#include <cstdlib>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -542,22 +546,74 @@ void ScriptModuleSerializer::writeArchive(
   data_pickle.pushIValue(value);
   data_pickle.stop();
   // write out tensor data
-  size_t i = 0;
   std::string prefix = archive_name + "/";
 
-  TORCH_INTERNAL_ASSERT(tensor_names.size() == data_pickle.tensorData().size());
+  const auto& tensor_data = data_pickle.tensorData();
+  TORCH_INTERNAL_ASSERT(tensor_names.size() == tensor_data.size());
+
+  // With TORCH_SAVE_ASYNC_D2H=1, device tensors are staged into pinned host
+  // buffers with a non-blocking copy one tensor ahead of the writer, so zip
+  // writing overlaps the next device-to-host transfer instead of blocking
+  // on a synchronous .cpu() per tensor.  An event recorded after each copy
+  // tells the writer when the staging buffer is safe to read.
+  struct StagedTensor {
+    at::Tensor host;
+    c10::Event done;
+  };
+  static const bool async_d2h = []() {
+    auto env = std::getenv("TORCH_SAVE_ASYNC_D2H");
+    return env && env[0] == '1' && env[1] == '\0';
+  }();
+  auto stage = [&](const at::Tensor& td) -> c10::optional<StagedTensor> {
+    if (!async_d2h || !td.device().is_cuda()) {
+      return c10::nullopt;
+    }
+    auto flat = at::empty({0}, td.options())
+                    .set_(
+                        td.storage(),
+                        /* storage_offset = */ 0,
+                        /* size = */
+                        {static_cast<int64_t>(
+                            td.storage().nbytes() / td.element_size())},
+                        /* stride = */ {1});
+    auto host = at::empty(
+        flat.sizes(), flat.options().device(at::kCPU).pinned_memory(true));
+    host.copy_(flat, /*non_blocking=*/true);
+    c10::Event done(td.device().type());
+    c10::impl::VirtualGuardImpl impl(td.device().type());
+    done.record(impl.getStream(td.device()));
+    return StagedTensor{std::move(host), std::move(done)};
+  };
 
-  for (const auto& td : data_pickle.tensorData()) {
-    std::string tensor_name = tensor_names[i++];
+  c10::optional<StagedTensor> next_staged;
+  if (!skip_tensor_data && !tensor_data.empty()) {
+    next_staged = stage(tensor_data[0]);
+  }
+  for (const auto i : c10::irange(tensor_data.size())) {
+    const auto& td = tensor_data[i];
+    const std::string& tensor_name = tensor_names[i];
+    auto staged = std::move(next_staged);
+    next_staged = c10::nullopt;
+    if (!skip_tensor_data && i + 1 < tensor_data.size()) {
+      next_staged = stage(tensor_data[i + 1]);
+    }
     if (td.is_meta() || skip_tensor_data) {
       writer_.writeRecord(tensor_dir + tensor_name, nullptr, 0);
       continue;
     }
-    WriteableTensorData writable_td = getWriteableTensorData(td);
     if (use_storage_context && serialized_tensors.count(tensor_name)) {
       // storage has been serialzed already, skip
       continue;
     }
+    if (staged.has_value()) {
+      staged->done.synchronize();
+      writer_.writeRecord(
+          tensor_dir + tensor_name,
+          staged->host.data_ptr(),
+          staged->host.storage().nbytes());
+      continue;
+    }
+    WriteableTensorData writable_td = getWriteableTensorData(td);
     writer_.writeRecord(
         tensor_dir + tensor_name,
         writable_td.data(),
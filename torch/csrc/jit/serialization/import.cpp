@@ -5,6 +5,7 @@
 #include <caffe2/serialize/in_memory_adapter.h>
 #include <caffe2/serialize/inline_container.h>
 #include <caffe2/serialize/istream_adapter.h>
+#include <caffe2/serialize/mmap_adapter.h>
 #include <caffe2/serialize/read_adapter_interface.h>
 #include <caffe2/serialize/versions.h>
 
@@ -36,9 +37,14 @@
 #include <torch/csrc/jit/serialization/unpickler.h>
 
 #include <ATen/ATen.h>
+#include <c10/core/impl/cow/COW.h>
 #include <fmt/format.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -51,6 +57,18 @@ using caffe2::serialize::MemoryReadAdapter;
 using caffe2::serialize::PyTorchStreamReader;
 using caffe2::serialize::ReadAdapterInterface;
 
+static bool use_mmap_load() {
+#ifdef _WIN32
+  return false;
+#else
+  static bool enabled = []() {
+    auto env = std::getenv("TORCH_MMAP_LOAD");
+    return env && env[0] == '1' && env[1] == '\0';
+  }();
+  return enabled;
+#endif
+}
+
 static void postSetStateValidate(const IValue& v) {
   auto obj = v.toObject();
   const auto& objType = obj->type();
@@ -77,6 +95,118 @@ static void postSetStateValidate(const IValue& v) {
 
 namespace {
 
+std::atomic<bool> storage_dedup_enabled{false};
+std::atomic<size_t> storage_dedup_saved_bytes{0};
+
+// FNV-1a over the storage bytes. Collisions are fine: matches are
+// confirmed with memcmp before any aliasing happens.
+uint64_t contentHash(const void* data, size_t nbytes) {
+  const auto* p = static_cast<const unsigned char*>(data);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < nbytes; ++i) {
+    hash = (hash ^ p[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// Process-wide registry of storages seen by previous loads, keyed by
+// content hash and held weakly so it never extends a module's lifetime.
+// See setStorageDeduplication() in import.h for the user contract.
+class StorageDedupRegistry {
+ public:
+  static StorageDedupRegistry& get() {
+    static StorageDedupRegistry registry;
+    return registry;
+  }
+
+  // If a still-alive registered storage has the same bytes as `storage`,
+  // returns a copy-on-write alias of it; otherwise registers `storage`
+  // for future loads and returns an empty Storage.
+  c10::Storage dedup(const c10::Storage& storage) {
+    c10::StorageImpl* impl = storage.unsafeGetStorageImpl();
+    const size_t nbytes = impl->nbytes();
+    const uint64_t hash = contentHash(impl->data(), nbytes);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = by_hash_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      auto candidate = it->second.lock();
+      if (!candidate) {
+        // The module that registered this storage is gone.
+        it = by_hash_.erase(it);
+        continue;
+      }
+      if (candidate.get() != impl && candidate->nbytes() == nbytes &&
+          std::memcmp(candidate->data(), impl->data(), nbytes) == 0) {
+        auto alias = c10::impl::cow::lazy_clone_storage(*candidate);
+        if (alias) {
+          storage_dedup_saved_bytes.fetch_add(
+              nbytes, std::memory_order_relaxed);
+          return c10::Storage(std::move(alias));
+        }
+      }
+      ++it;
+    }
+    by_hash_.emplace(hash, storage.getWeakStorageImpl());
+    return c10::Storage();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_multimap<uint64_t, c10::weak_intrusive_ptr<c10::StorageImpl>>
+      by_hash_;
+};
+
+// Walks every tensor reachable from `root` and redirects its storage to
+// a shared copy-on-write alias when an identical storage from an
+// earlier load is available. Views sharing a storage all get the same
+// replacement.
+void dedupStorages(const IValue& root) {
+  std::unordered_map<c10::StorageImpl*, c10::Storage> replacements;
+  root.visit([&](const IValue& value) {
+    if (!value.isTensor()) {
+      return false;
+    }
+    const at::Tensor& tensor = value.toTensor();
+    if (!tensor.defined() || !tensor.has_storage()) {
+      return false;
+    }
+    const c10::Storage& storage = tensor.storage();
+    // Only simple CPU storages can be aliased copy-on-write.
+    if (storage.device_type() != c10::DeviceType::CPU ||
+        storage.nbytes() == 0 || storage.data() == nullptr) {
+      return false;
+    }
+    c10::StorageImpl* impl = storage.unsafeGetStorageImpl();
+    auto it = replacements.find(impl);
+    if (it == replacements.end()) {
+      it = replacements
+               .emplace(impl, StorageDedupRegistry::get().dedup(storage))
+               .first;
+    }
+    if (it->second) {
+      tensor.unsafeGetTensorImpl()->set_storage_keep_dtype(it->second);
+    }
+    return false;
+  });
+}
+
+} // namespace
+
+void setStorageDeduplication(bool enabled) {
+  storage_dedup_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool getStorageDeduplication() {
+  return storage_dedup_enabled.load(std::memory_order_relaxed);
+}
+
+size_t getStorageDeduplicationSavedBytes() {
+  return storage_dedup_saved_bytes.load(std::memory_order_relaxed);
+}
+
+namespace {
+
 // This is a deserializer class which loads script modules from pt files.
 // Content of the file is written using PyTorchStreamWriter, for details please
 // check caffe2/serialize/inline_container.h.
@@ -287,6 +417,14 @@ Module ScriptModuleDeserializer::deserialize(
   auto m_ivalue = readArchive("data");
   auto m = Module(m_ivalue.toObject());
   rewriteQuantizedConvForBC(m);
+  if (getStorageDeduplication()) {
+    // Share identical weights with previously loaded modules, e.g. the
+    // common base weights of many fine-tuned variants of one model.
+    dedupStorages(m_ivalue);
+    for (const auto& constant : constants_table_) {
+      dedupStorages(constant);
+    }
+  }
   // Checking for and loading saved traced inputs
   if (restore_shapes && reader_->hasRecord("traced_inputs.pkl")) {
     auto dict = readArchive("traced_inputs").toGenericDict();
@@ -429,7 +567,14 @@ Module import_ir_module(
   // NOTE: Zipformat can be large files. So using stream version directly
   // instead of reading the file all at once.
   if (getFileFormat(filename) != FileFormat::FlatbufferFileFormat) {
-    auto reader = torch::make_unique<PyTorchStreamReader>(filename);
+    // With TORCH_MMAP_LOAD=1 the archive is memory mapped and aligned,
+    // uncompressed tensor records are used as tensor storage in place
+    // instead of being copied into freshly allocated buffers, cutting load
+    // time and peak RSS for large models (see MmapReadAdapter).
+    auto reader = use_mmap_load()
+        ? torch::make_unique<PyTorchStreamReader>(
+              std::make_shared<caffe2::serialize::MmapReadAdapter>(filename))
+        : torch::make_unique<PyTorchStreamReader>(filename);
     reader->setShouldLoadDebugSymbol(load_debug_files);
     ScriptModuleDeserializer deserializer(std::move(cu), std::move(reader));
     return deserializer.deserialize(device, extra_files, restore_shapes);
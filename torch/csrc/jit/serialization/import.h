@@ -18,6 +18,19 @@ namespace jit {
 
 class DeserializationStorageContext;
 
+// Cross-module storage deduplication. When enabled, torch::jit::load
+// content-hashes every CPU tensor storage in a freshly loaded module and,
+// when an identical storage from an earlier load is still alive, replaces
+// it with a copy-on-write alias of the shared allocation (see
+// c10/core/impl/cow/COW.h). Loading many fine-tuned variants of one base
+// model then keeps a single copy of the unchanged base weights; a module
+// that mutates a shared tensor materializes its own copy on first write.
+// Off by default because hashing adds load-time cost.
+TORCH_API void setStorageDeduplication(bool enabled);
+TORCH_API bool getStorageDeduplication();
+// Lifetime count of bytes deduplicated away by aliasing.
+TORCH_API size_t getStorageDeduplicationSavedBytes();
+
 TORCH_API Module import_ir_module(
     std::shared_ptr<CompilationUnit> cu,
     const std::string& filename,
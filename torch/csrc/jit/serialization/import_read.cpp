@@ -1,8 +1,20 @@
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 namespace torch::jit {
 
+namespace {
+// Upper bound on the threads used to materialize tensor payloads.  Past a
+// handful of in-flight reads the archive source (NVMe, page cache) is
+// saturated and extra threads only add contention.
+constexpr size_t kMaxStorageLoaderThreads = 8;
+} // namespace
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     const std::string& pickle_prefix,
@@ -50,6 +62,56 @@ IValue readArchiveAndTensors(
       type_parser,
       storage_context);
   unpickler.set_version(stream_reader.version());
+  if (stream_reader.supportsConcurrentReads()) {
+    // Materialize tensor payloads with a batch of concurrent record reads
+    // once parsing finishes, instead of one synchronous getRecord() per
+    // storage.  Correctness doesn't depend on the thread count; compressed
+    // records degrade to serialized extraction inside
+    // getRecordConcurrently().
+    unpickler.setBulkStorageLoader(
+        [&](std::vector<DeferredStorageRead>&& reads) {
+          const size_t num_threads = std::min(
+              {reads.size(),
+               static_cast<size_t>(
+                   std::max(1u, std::thread::hardware_concurrency())),
+               kMaxStorageLoaderThreads});
+          std::atomic<size_t> next{0};
+          std::atomic<bool> failed{false};
+          std::exception_ptr error;
+          std::mutex error_mutex;
+          auto drain = [&]() {
+            while (!failed.load(std::memory_order_relaxed)) {
+              const size_t i = next.fetch_add(1);
+              if (i >= reads.size()) {
+                break;
+              }
+              try {
+                const auto& r = reads[i];
+                stream_reader.getRecordConcurrently(
+                    tensor_dir_path + r.record_name, r.dst, r.nbytes);
+              } catch (...) {
+                std::lock_guard<std::mutex> guard(error_mutex);
+                if (!error) {
+                  error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+              }
+            }
+          };
+          std::vector<std::thread> workers;
+          workers.reserve(num_threads - 1);
+          for (size_t i = 0; i + 1 < num_threads; ++i) {
+            workers.emplace_back(drain);
+          }
+          drain();
+          for (auto& worker : workers) {
+            worker.join();
+          }
+          if (error) {
+            std::rethrow_exception(error);
+          }
+        });
+  }
   return unpickler.parse_ivalue();
 }
 
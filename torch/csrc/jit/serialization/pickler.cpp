@@ -19,6 +19,12 @@ using ::c10::IValue;
 // See https://docs.python.org/3/library/pickle.html#data-stream-format
 constexpr static uint8_t PROTOCOL_VERSION = 2;
 
+// Protocol 3 additionally enables the compact binary tensor metadata framing
+// (TENSOR_META). It is a PyTorch extension that Python's pickle module cannot
+// read, so it is never emitted unless explicitly requested via
+// setProtocolVersion.
+constexpr static uint8_t COMPACT_TENSOR_PROTOCOL_VERSION = 3;
+
 // NOLINTNEXTLINE(bugprone-exception-escape)
 Pickler::~Pickler() {
   flush();
@@ -26,7 +32,16 @@ Pickler::~Pickler() {
 
 void Pickler::protocol() {
   push<PickleOpCode>(PickleOpCode::PROTO);
-  push<uint8_t>(PROTOCOL_VERSION);
+  push<uint8_t>(protocol_);
+}
+
+void Pickler::setProtocolVersion(uint8_t protocol) {
+  TORCH_CHECK(
+      protocol >= PROTOCOL_VERSION &&
+          protocol <= COMPACT_TENSOR_PROTOCOL_VERSION,
+      "Unsupported pickle protocol requested: ",
+      static_cast<int>(protocol));
+  protocol_ = protocol;
 }
 
 void Pickler::startTuple() {
@@ -334,6 +349,15 @@ void Pickler::pushBytes(const std::string& string) {
   }
 }
 
+void Pickler::pushVarint(uint64_t value) {
+  // LEB128: 7 bits per byte, high bit set on all but the last byte
+  while (value >= 0x80) {
+    push<uint8_t>(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  push<uint8_t>(static_cast<uint8_t>(value));
+}
+
 void Pickler::pushGlobal(
     c10::string_view module_name,
     c10::string_view class_name) {
@@ -430,6 +454,13 @@ void Pickler::pushLiteralTensor(const IValue& ivalue) {
   }
 
   bool quantized = tensor.is_quantized();
+
+  if (protocol_ >= COMPACT_TENSOR_PROTOCOL_VERSION && !quantized &&
+      torch::jit::getTensorMetadata(tensor).empty()) {
+    pushLiteralTensorCompact(tensor);
+    return;
+  }
+
   // The arguments to this function are:
   //    storage, storage_offset, size, stride, requires_grad, backward_hooks
   pushGlobal(
@@ -509,6 +540,28 @@ void Pickler::pushLiteralTensor(const IValue& ivalue) {
   push<PickleOpCode>(PickleOpCode::REDUCE);
 }
 
+void Pickler::pushLiteralTensorCompact(const at::Tensor& tensor) {
+  // Protocol >= 3 framing for dense, non-quantized tensors. The storage is
+  // pushed through the usual (memoized) persistent id machinery; TENSOR_META
+  // then replaces the _rebuild_tensor_v2 GLOBAL/MARK/TUPLE/REDUCE sequence
+  // with fixed-width dtype/requires_grad bytes and varint packed
+  // offset/sizes/strides. The net stack effect (one tensor pushed) matches
+  // the verbose form, so memoization of the result composes unchanged.
+  pushStorageOfTensor(tensor);
+
+  push<PickleOpCode>(PickleOpCode::TENSOR_META);
+  push<uint8_t>(static_cast<uint8_t>(tensor.scalar_type()));
+  push<uint8_t>(tensor.requires_grad() ? 1 : 0);
+  pushVarint(static_cast<uint64_t>(tensor.storage_offset()));
+  pushVarint(static_cast<uint64_t>(tensor.dim()));
+  for (auto size : tensor.sizes()) {
+    pushVarint(static_cast<uint64_t>(size));
+  }
+  for (auto stride : tensor.strides()) {
+    pushVarint(static_cast<uint64_t>(stride));
+  }
+}
+
 void Pickler::pushSpecializedList(
     const IValue& ivalue,
     const char* list_name,
@@ -89,7 +89,15 @@ enum class PickleOpCode : char {
   NEWOBJ_EX = '\x92',
   STACK_GLOBAL = '\x93',
   MEMOIZE = '\x94',
-  FRAME = '\x95'
+  FRAME = '\x95',
+
+  // PyTorch extension, emitted only when the pickle protocol is explicitly
+  // raised to kCompactTensorProtocolVersion (see Pickler::setProtocolVersion).
+  // Pops a storage off the stack and pushes a tensor rebuilt from compact
+  // binary metadata (enum dtype, varint offset/sizes/strides) instead of the
+  // torch._utils._rebuild_tensor_v2 GLOBAL/REDUCE sequence. Not readable by
+  // Python's pickle module.
+  TENSOR_META = '\xf8'
 };
 
 using ::c10::IValue;
@@ -146,6 +154,13 @@ class TORCH_API Pickler {
   // Push protocol onto the stack
   void protocol();
 
+  // Raise the pickle protocol version, opting in to the compact binary
+  // tensor metadata framing (TENSOR_META) at protocol 3. Protocol 3 output
+  // can only be read back by this codebase's Unpickler, so it must be
+  // negotiated with the peer (e.g. over RPC) before use; the default
+  // protocol 2 stays Python-compatible. Call before protocol().
+  void setProtocolVersion(uint8_t protocol);
+
   // Push STOP PickleOpCode onto the stack
   void stop();
 
@@ -176,6 +191,7 @@ class TORCH_API Pickler {
   void pushTensor(const IValue& ivalue);
   void pushTensorReference(const IValue& ivalue);
   void pushLiteralTensor(const IValue& ivalue);
+  void pushLiteralTensorCompact(const at::Tensor& tensor);
   void pushLiteralSparseTensor(const at::Tensor& tensor);
   void pushTuple(const IValue& ivalue);
   void pushString(const std::string& string);
@@ -196,6 +212,8 @@ class TORCH_API Pickler {
   // raw string data is appended directly to the byte stream
   void pushBytes(const std::string& string);
   void pushTensorData(const at::Tensor& tensor);
+  // LEB128; used by the protocol 3 compact tensor metadata framing
+  void pushVarint(uint64_t value);
 
   // Add a BINPUT op and return the memoization id used
   size_t pushNextBinPut();
@@ -241,6 +259,9 @@ class TORCH_API Pickler {
   // Stack of opcodes/data
   std::vector<char> stack_;
 
+  // Pickle protocol emitted by protocol(); 3 enables TENSOR_META
+  uint8_t protocol_{2};
+
   // External table of tensors to serialize. If this is missing, then tensors
   // are serialized directly into the pickle
   std::vector<at::Tensor>* tensor_table_;
@@ -1,5 +1,6 @@
 #include <ATen/ATen.h>
 #include <ATen/core/Dict.h>
+#include <c10/core/CPUAllocator.h>
 #ifdef USE_RPC
 #include <torch/csrc/distributed/rpc/rref_context.h>
 #endif
@@ -208,6 +209,12 @@ IValue Unpickler::parse_ivalue() {
       stack_.size() == 1,
       "Unpickler expected 1 element on the stack, but found ",
       stack_.size());
+  if (!deferred_storage_reads_.empty()) {
+    // Fill the storage payloads that BINPERSID deferred; the result must
+    // be fully materialized before it is handed back to the caller.
+    bulk_storage_loader_(std::move(deferred_storage_reads_));
+    deferred_storage_reads_.clear();
+  }
   if (version_ <= 2) {
     // See [type tag serialization]
     restoreAccurateTypeTagsIfPossible(stack_[0]);
@@ -245,9 +252,10 @@ void Unpickler::run() {
       int(static_cast<uint8_t>(opcode)));
   uint8_t protocol = read<uint8_t>();
   TORCH_CHECK(
-      protocol == 2,
-      "Only Pickle protocol 2 is supported, found protocol = ",
+      protocol == 2 || protocol == 3,
+      "Only Pickle protocols 2 and 3 are supported, found protocol = ",
       protocol);
+  protocol_ = protocol;
 
   while (true) {
     PickleOpCode opcode = readInstruction();
@@ -552,7 +560,19 @@ PickleOpCode Unpickler::readInstruction() {
           // If there are no elements in the tensor, there's no point in
           // reading a zero (0) byte file from the input stream and paying
           // that cost.
-          storage_ptr = read_record_(key);
+          if (bulk_storage_loader_ && device.is_cpu() &&
+              !use_storage_device_) {
+            // Defer the payload read: allocate the buffer now so the
+            // storage can be wired into the unpickled value immediately,
+            // and batch the actual read so the loader can overlap it with
+            // the other storages (see setBulkStorageLoader()).
+            const size_t nbytes = numel * dtype.itemsize();
+            storage_ptr = c10::GetCPUAllocator()->allocate(nbytes);
+            deferred_storage_reads_.push_back(
+                DeferredStorageRead{key, storage_ptr.get(), nbytes});
+          } else {
+            storage_ptr = read_record_(key);
+          }
         }
 
         storage = at::Storage(
@@ -593,6 +613,40 @@ PickleOpCode Unpickler::readInstruction() {
       }
       stack_.emplace_back(std::move(tensor));
     } break;
+    case PickleOpCode::TENSOR_META: {
+      // Compact tensor metadata framing; see Pickler::pushLiteralTensorCompact
+      TORCH_CHECK(
+          protocol_ >= 3,
+          "TENSOR_META opcode is only valid at pickle protocol 3, found protocol = ",
+          static_cast<int>(protocol_));
+      auto scalar_type = static_cast<at::ScalarType>(read<uint8_t>());
+      bool requires_grad = read<uint8_t>() != 0;
+      int64_t storage_offset = static_cast<int64_t>(readVarint());
+      size_t ndim = readVarint();
+      std::vector<int64_t> size(ndim);
+      for (auto& s : size) {
+        s = static_cast<int64_t>(readVarint());
+      }
+      std::vector<int64_t> stride(ndim);
+      for (auto& s : stride) {
+        s = static_cast<int64_t>(readVarint());
+      }
+      TORCH_CHECK(!stack_.empty(), "Parsing error: stack_ is empty");
+      auto storage_tensor = pop(stack_).toTensor();
+      TORCH_CHECK(
+          storage_tensor.scalar_type() == scalar_type,
+          "TENSOR_META dtype ",
+          scalar_type,
+          " does not match storage dtype ",
+          storage_tensor.scalar_type());
+      at::Tensor result = at::empty({0}, storage_tensor.options());
+      at::TensorImpl* impl = result.unsafeGetTensorImpl();
+      impl->set_storage_keep_dtype(storage_tensor.storage());
+      impl->set_storage_offset(storage_offset);
+      impl->set_sizes_and_strides(size, stride);
+      result = autograd::make_variable(result, requires_grad);
+      stack_.emplace_back(std::move(result));
+    } break;
     case PickleOpCode::SETITEM: {
       // At this OpCode, stack looks like
       // | Stack Bottom |
@@ -1055,6 +1109,20 @@ void Unpickler::readSlowWithBuffer(char* dest, size_t sz) {
   buffer_remaining_ -= needed;
 }
 
+// Read an LEB128 varint, used by the protocol 3 compact tensor metadata
+// framing (see Pickler::pushVarint)
+uint64_t Unpickler::readVarint() {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    uint8_t byte = read<uint8_t>();
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+  AT_ERROR("Malformed varint in pickler archive.");
+}
+
 // Read a number of bytes from the input stream
 std::string Unpickler::readBytes(size_t length) {
   std::string data;
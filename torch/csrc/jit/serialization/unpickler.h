@@ -18,6 +18,17 @@ using ObjLoader = std::function<
 
 class DeserializationStorageContext;
 
+// A storage payload read that the Unpickler has batched up instead of
+// issuing synchronously (see Unpickler::setBulkStorageLoader). `dst` points
+// at `nbytes` of preallocated CPU memory owned by the storage already bound
+// into the unpickled value; the loader's job is to fill it from the record
+// named `record_name`.
+struct DeferredStorageRead {
+  std::string record_name;
+  void* dst;
+  size_t nbytes;
+};
+
 // [unpickler refactor] there is some cruft around PickleOpCode::BUILD,
 // PickleOpCode::NEWOBJ, and the last_opcode_ member below that should be
 // deleted at some point, the Pickler doesn't produce it and it's only around to
@@ -90,6 +101,20 @@ class TORCH_API Unpickler {
     version_ = version_number;
   }
 
+  // Install a loader that fills batches of CPU storage payloads after the
+  // pickle program has been fully parsed, instead of the Unpickler calling
+  // read_record_ synchronously per storage.  The loader is free to issue
+  // the reads concurrently (e.g. via PyTorchStreamReader::
+  // getRecordConcurrently), which is where large checkpoints win: tensor
+  // records can stream from disk in parallel rather than one at a time.
+  // Storages that are remapped to a non-CPU device still go through
+  // read_record_, since their payload must be resident before the device
+  // copy happens during parsing.
+  void setBulkStorageLoader(
+      std::function<void(std::vector<DeferredStorageRead>&&)> loader) {
+    bulk_storage_loader_ = std::move(loader);
+  }
+
   static c10::TypePtr defaultTypeParser(const std::string& str) {
     ScriptTypeParser parser;
     return parser.parseType(str);
@@ -114,6 +139,7 @@ class TORCH_API Unpickler {
   }
   void readSlowWithBuffer(char* dest, size_t sz);
   std::string readBytes(size_t num_bytes);
+  uint64_t readVarint();
 
   double readFloat();
   void readGlobal(
@@ -163,6 +189,11 @@ class TORCH_API Unpickler {
   IValue empty_tuple_;
 
   std::function<at::DataPtr(const std::string&)> read_record_;
+  // Optional; when set, BINPERSID defers CPU storage payload reads into
+  // deferred_storage_reads_ and parse_ivalue() flushes them through this
+  // loader once parsing completes.
+  std::function<void(std::vector<DeferredStorageRead>&&)> bulk_storage_loader_;
+  std::vector<DeferredStorageRead> deferred_storage_reads_;
   c10::optional<at::Device> device_;
   // When set to true, Unpickler will ignore the pickled device and use the
   // device of the DataPtr returned by the read_record_ function. The default
@@ -178,6 +209,10 @@ class TORCH_API Unpickler {
   // See [type tag serialization]
   uint64_t version_;
 
+  // Pickle protocol of the archive being read; set by run(). Protocol 3
+  // enables the compact tensor metadata framing (TENSOR_META).
+  uint8_t protocol_ = 0;
+
   // See [NOTE] skip_next_read_global
   uint8_t skip_next_read_global = 0;
 };
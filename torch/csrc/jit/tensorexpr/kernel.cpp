@@ -78,6 +78,64 @@ static bool fallbackEnforced() {
   return false;
 }
 
+bool asyncCompilationEnabled() {
+  static const char* enable_c_str =
+      std::getenv("PYTORCH_TENSOREXPR_ASYNC_COMPILE");
+  if (!enable_c_str) {
+    return false;
+  }
+  return std::string(enable_c_str) != "0";
+}
+
+static size_t kernelCacheCapacity() {
+  static const char* capacity_c_str =
+      std::getenv("PYTORCH_TENSOREXPR_KERNEL_CACHE_SIZE");
+  if (!capacity_c_str) {
+    return 256;
+  }
+  return std::stoul(std::string(capacity_c_str));
+}
+
+TensorExprKernelCache::TensorExprKernelCache()
+    : maxSize_(kernelCacheCapacity()) {}
+
+TensorExprKernelCache& TensorExprKernelCache::get() {
+  static TensorExprKernelCache cache;
+  return cache;
+}
+
+std::shared_ptr<TensorExprKernel> TensorExprKernelCache::lookup(
+    const std::string& shapeSignature) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = entries_.find(shapeSignature);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->second;
+}
+
+void TensorExprKernelCache::insert(
+    const std::string& shapeSignature,
+    std::shared_ptr<TensorExprKernel> kernel) {
+  if (!enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = entries_.find(shapeSignature);
+  if (it != entries_.end()) {
+    lru_.splice(lru_.begin(), lru_, it->second);
+    it->second->second = std::move(kernel);
+    return;
+  }
+  if (lru_.size() >= maxSize_) {
+    entries_.erase(lru_.back().first);
+    lru_.pop_back();
+  }
+  lru_.emplace_front(shapeSignature, std::move(kernel));
+  entries_[shapeSignature] = lru_.begin();
+}
+
 static int64_t randomTransformsRequested() {
   const char* enable_c_str =
       std::getenv("PYTORCH_TENSOREXPR_RANDOM_TRANSFORM_SEED");
@@ -10,6 +10,9 @@
 #include <torch/csrc/jit/tensorexpr/lowerings.h>
 #include <torch/csrc/jit/tensorexpr/tensor.h>
 
+#include <list>
+#include <mutex>
+
 namespace torch {
 namespace jit {
 namespace tensorexpr {
@@ -361,6 +364,42 @@ class TORCH_API TensorExprKernel {
   MemoryLayoutPolicy memory_layout_policy_ = MemoryLayoutPolicy::kContiguous;
 };
 
+// Bounded LRU cache of compiled kernels, keyed by the shape signature of
+// their subgraph (the canonical graph text, which carries the profiled
+// sizes, strides, dtypes and devices in its type annotations). Fusion
+// groups specialized to previously seen shapes pick up the compiled
+// kernel instead of compiling again. Entries are shared_ptrs, so evicting
+// one never invalidates a kernel that is still referenced by an operator.
+class TORCH_API TensorExprKernelCache {
+ public:
+  // Process-wide cache instance.
+  static TensorExprKernelCache& get();
+
+  // Returns true if caching is enabled (i.e. the capacity is non-zero).
+  bool enabled() const {
+    return maxSize_ > 0;
+  }
+
+  // Returns the cached kernel for the given shape signature, or nullptr.
+  // A hit moves the entry to the front of the LRU order.
+  std::shared_ptr<TensorExprKernel> lookup(const std::string& shapeSignature);
+
+  // Inserts a kernel, evicting the least recently used entry when the
+  // cache is full. No-op if caching is disabled.
+  void insert(
+      const std::string& shapeSignature,
+      std::shared_ptr<TensorExprKernel> kernel);
+
+ private:
+  TensorExprKernelCache();
+
+  using Entry = std::pair<std::string, std::shared_ptr<TensorExprKernel>>;
+  std::mutex mutex_;
+  size_t maxSize_;
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+};
+
 TORCH_API int& getTECudaPointwiseLoopLevels();
 TORCH_API int& getTECudaPointwiseBlockCount();
 TORCH_API int& getTECudaPointwiseBlockSize();
@@ -370,6 +409,7 @@ TORCH_API bool fallbackAllowed();
 TORCH_API bool setFallbackAllowed(bool value);
 TORCH_API bool& getCatWoConditionals();
 TORCH_API bool& getOptConditionals();
+TORCH_API bool asyncCompilationEnabled();
 
 TORCH_API c10::optional<at::Device> pickDeviceType(
     const at::ArrayRef<torch::jit::Value*>& inputs);
@@ -20,12 +20,17 @@ C10_DIAGNOSTIC_POP()
 #pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #pragma GCC diagnostic pop
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
 #include <llvm/ExecutionEngine/Orc/SymbolStringPool.h>
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/Mangler.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
 #include <llvm/Support/Host.h>
@@ -141,15 +146,130 @@ static void registerIntrinsics(
 namespace llvm {
 namespace orc {
 
+// The object-cache hook below needs the IRCompiler-based
+// CompileFunctionCreator, which is only available from LLVM 10 on.
+#if LLVM_VERSION_MAJOR >= 10
+#define TORCH_NNC_OBJECT_CACHE 1
+#endif
+
+#ifdef TORCH_NNC_OBJECT_CACHE
+// Returns the directory for the persisted kernel object cache, or nullptr
+// when the cache is disabled (the default). Pointing this at a shared,
+// writable directory lets every process on a host (or fleet, via a shared
+// filesystem) reuse object code that any other process already compiled,
+// instead of re-JITing identical kernels on each restart.
+static const char* objectCacheDir() {
+  static const char* cache_dir_c_str =
+      std::getenv("PYTORCH_TENSOREXPR_OBJECT_CACHE_DIR");
+  return cache_dir_c_str;
+}
+
+// Cache key for a module: SHA1 over the kernel IR together with everything
+// that affects the generated code — the LLVM version and the target triple,
+// CPU and feature set — so that stale objects from a different toolchain or
+// host generation are never loaded.
+static std::string moduleCacheKey(const Module& M, const TargetMachine& TM) {
+  std::string ir;
+  raw_string_ostream irStream(ir);
+  irStream << M;
+  irStream.flush();
+  SHA1 hasher;
+  hasher.update(ir);
+  hasher.update(LLVM_VERSION_STRING);
+  hasher.update(TM.getTargetTriple().str());
+  hasher.update(TM.getTargetCPU());
+  hasher.update(TM.getTargetFeatureString());
+  return toHex(hasher.final());
+}
+
+namespace {
+// Best-effort disk cache of compiled kernel objects. Failures to read or
+// write are silently ignored; the compiler then proceeds as if the cache
+// were empty. Writers go through a unique temporary file plus rename so
+// concurrent workers never observe a partially written object.
+class PytorchObjectCache : public ObjectCache {
+ public:
+  explicit PytorchObjectCache(std::string cacheDir)
+      : cacheDir_(std::move(cacheDir)) {
+    sys::fs::create_directories(cacheDir_);
+  }
+
+  void notifyObjectCompiled(const Module* M, MemoryBufferRef Obj) override {
+    SmallString<256> tmpPath;
+    int tmpFD = -1;
+    if (sys::fs::createUniqueFile(
+            objectPath(M->getModuleIdentifier()) + ".tmp-%%%%%%",
+            tmpFD,
+            tmpPath)) {
+      return;
+    }
+    {
+      raw_fd_ostream os(tmpFD, /*shouldClose*/ true);
+      os << Obj.getBuffer();
+    }
+    if (sys::fs::rename(tmpPath, objectPath(M->getModuleIdentifier()))) {
+      sys::fs::remove(tmpPath);
+    }
+  }
+
+  std::unique_ptr<MemoryBuffer> getObject(const Module* M) override {
+    auto buf = MemoryBuffer::getFile(objectPath(M->getModuleIdentifier()));
+    if (!buf) {
+      return nullptr;
+    }
+    return std::move(*buf);
+  }
+
+ private:
+  std::string objectPath(StringRef key) const {
+    return cacheDir_ + "/" + key.str() + ".o";
+  }
+
+  std::string cacheDir_;
+};
+} // namespace
+
+static std::unique_ptr<PytorchObjectCache> makeObjectCache() {
+  const char* dir = objectCacheDir();
+  if (!dir) {
+    return nullptr;
+  }
+  return std::make_unique<PytorchObjectCache>(dir);
+}
+#endif // TORCH_NNC_OBJECT_CACHE
+
 // Lightly modified implementation from LLVM's Kaleidoscope JIT tutorial:
 // https://llvm.org/docs/tutorial/BuildingAJIT1.html
 #if LLVM_VERSION_MAJOR >= 9
 class TORCH_API PytorchLLVMJITImpl {
  private:
   std::unique_ptr<TargetMachine> TM;
+#ifdef TORCH_NNC_OBJECT_CACHE
+  std::unique_ptr<PytorchObjectCache> objectCache_;
+#endif
   std::unique_ptr<LLJIT> LLJ;
   std::unordered_set<std::string> intrinsics;
 
+  std::unique_ptr<LLJIT> makeLLJIT(
+      const c10::optional<std::string>& triple,
+      const c10::optional<std::string>& cpu,
+      const c10::optional<std::string>& attrs) {
+    LLJITBuilder builder;
+    builder.setJITTargetMachineBuilder(
+        makeTargetMachineBuilder(triple, cpu, attrs));
+#ifdef TORCH_NNC_OBJECT_CACHE
+    if (objectCache_) {
+      builder.setCompileFunctionCreator(
+          [cache = objectCache_.get()](JITTargetMachineBuilder JTMB)
+              -> Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> {
+            return std::make_unique<ConcurrentIRCompiler>(
+                std::move(JTMB), cache);
+          });
+    }
+#endif
+    return assertSuccess(builder.create());
+  }
+
  public:
   PytorchLLVMJITImpl(
       c10::optional<std::string> triple,
@@ -157,10 +277,10 @@ class TORCH_API PytorchLLVMJITImpl {
       c10::optional<std::string> attrs)
       : TM(assertSuccess(makeTargetMachineBuilder(triple, cpu, attrs)
                              .createTargetMachine())),
-        LLJ(assertSuccess(LLJITBuilder()
-                              .setJITTargetMachineBuilder(
-                                  makeTargetMachineBuilder(triple, cpu, attrs))
-                              .create())) {
+#ifdef TORCH_NNC_OBJECT_CACHE
+        objectCache_(makeObjectCache()),
+#endif
+        LLJ(makeLLJIT(triple, cpu, attrs)) {
     auto ProcSymbolsGenerator =
         assertSuccess(DynamicLibrarySearchGenerator::GetForCurrentProcess(
             LLJ->getDataLayout().getGlobalPrefix()));
@@ -179,6 +299,12 @@ class TORCH_API PytorchLLVMJITImpl {
   }
 
   void addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> C) {
+#ifdef TORCH_NNC_OBJECT_CACHE
+    if (objectCache_) {
+      // The module identifier doubles as the object-cache key.
+      M->setModuleIdentifier(moduleCacheKey(*M, *TM));
+    }
+#endif
     assertSuccess(
         LLJ->addIRModule(ThreadSafeModule(std::move(M), std::move(C))),
         "Failed to add module to compile layer");
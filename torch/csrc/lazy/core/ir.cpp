@@ -56,6 +56,22 @@ hash_t OpKind::hash() const {
   return StringHash(op.toQualString());
 }
 
+hash_t OperandHashes(
+    const OpList& operands,
+    const hash_t& seed,
+    bool bakeInSizes) {
+  hash_t hash = seed;
+  for (auto& operand : operands) {
+    if (!operand) {
+      hash = HashCombine(hash, static_cast<uint64_t>(kNullOpt));
+      continue;
+    }
+    auto operand_hash = bakeInSizes ? operand.shapeHash() : operand.hash();
+    hash = HashCombine(hash, operand_hash);
+  }
+  return hash;
+}
+
 bool Node::enableDynamicShape() {
   static bool enabled = std::getenv("LTC_ENABLE_DYNAMIC_SHAPES") != nullptr;
   return enabled || FLAGS_ltc_enable_dynamic_shapes;
@@ -68,7 +84,8 @@ Node::Node(
     OpKind op,
     OpList operands,
     std::vector<Shape>&& shapes,
-    size_t num_outputs)
+    size_t num_outputs,
+    hash_t hash_seed)
     : Node(op, num_outputs) {
   // Move shapes into node
   shapes_.insert(
@@ -87,26 +104,53 @@ Node::Node(
 
     AddOperand(operand.node, operand.index);
   }
+
+  ComputeHashes(operands, hash_seed);
 }
 
 Node::Node(
     OpKind op,
     OpList operands,
     const std::function<Shape()>& shape_fn,
-    size_t num_outputs)
-    : Node(op, operands, std::vector<Shape>{}, num_outputs) {
+    size_t num_outputs,
+    hash_t hash_seed)
+    : Node(op, operands, std::vector<Shape>{}, num_outputs, hash_seed) {
   addComputedShape(shape_fn);
 }
 
-Node::Node(OpKind op, OpList operands, size_t num_outputs)
-    : Node(op, operands, std::vector<Shape>{}, num_outputs) {}
+Node::Node(OpKind op, OpList operands, size_t num_outputs, hash_t hash_seed)
+    : Node(op, operands, std::vector<Shape>{}, num_outputs, hash_seed) {}
 
-Node::Node(OpKind op, Shape shape, size_t num_outputs) : Node(op, num_outputs) {
+Node::Node(OpKind op, Shape shape, size_t num_outputs, hash_t hash_seed)
+    : Node(op, num_outputs) {
   shapes_.push_back(std::move(shape));
+  ComputeHashes({}, hash_seed);
 }
 
 Node::~Node() = default;
 
+void Node::ComputeHashes(OpList operands, const hash_t& hash_seed) {
+  const hash_t seed = HashCombine(op_.hash(), hash_seed);
+  auto dag_hash = [&](bool bake_in_sizes) {
+    hash_t hash = OperandHashes(operands, seed, bake_in_sizes);
+    for (auto& shape : shapes_) {
+      hash = HashCombine(hash, shape.hash(bake_in_sizes));
+    }
+    return hash;
+  };
+  shape_hash_ = dag_hash(/*bake_in_sizes=*/true);
+  dag_hash_ =
+      enableDynamicShape() ? dag_hash(/*bake_in_sizes=*/false) : shape_hash_;
+}
+
+hash_t Node::hash() const {
+  return dag_hash_;
+}
+
+hash_t Node::shapeHash() const {
+  return shape_hash_;
+}
+
 // Retrieves the full shape of the IR Node.
 c10::ArrayRef<Shape> Node::shapes() const {
   return shapes_;
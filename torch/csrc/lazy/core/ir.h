@@ -67,6 +67,9 @@ inline std::ostream& operator<<(std::ostream& stream, const OpKind& op) {
 
 using OpList = c10::ArrayRef<Value>;
 
+// Combines the cached hashes of `operands` into `seed`. Each operand hash is
+// O(1) to retrieve (see Note [Incremental graph hashing]), so hashing a new
+// node costs O(#operands) regardless of how deep the dag below it is.
 hash_t OperandHashes(
     const OpList& operands,
     const hash_t& seed,
@@ -94,20 +97,26 @@ class TORCH_API Node {
       OpKind op,
       OpList operands,
       std::vector<Shape>&& shapes,
-      size_t num_outputs = 1);
+      size_t num_outputs = 1,
+      hash_t hash_seed = kHashSeed);
 
   // Construct node with operands and shape generated from a function
   Node(
       OpKind op,
       OpList operands,
       const std::function<Shape()>& shape_fn,
-      size_t num_outputs = 1);
+      size_t num_outputs = 1,
+      hash_t hash_seed = kHashSeed);
 
   // Construct node with operands and no shape
-  Node(OpKind op, OpList operands, size_t num_outputs = 1);
+  Node(
+      OpKind op,
+      OpList operands,
+      size_t num_outputs = 1,
+      hash_t hash_seed = kHashSeed);
 
   // Construct node with shape and no operands
-  Node(OpKind op, Shape shape, size_t num_outputs = 1);
+  Node(OpKind op, Shape shape, size_t num_outputs = 1, hash_t hash_seed = kHashSeed);
 
   virtual ~Node();
 
@@ -137,11 +146,20 @@ class TORCH_API Node {
   // Gets operand at index i if index is valid, or kNullOutput otherwise.
   virtual const Output& nullable_operand(size_t i) const;
 
+  // Note [Incremental graph hashing]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Both dag hashes are computed once at node construction by structurally
+  // combining op, shapes and the *cached* hashes of the operands, and then
+  // stored on the node. Hashing a freshly traced graph therefore only pays
+  // for the nodes that were actually (re)created, and the per-step
+  // compilation cache lookup in LazyGraphExecutor combines the stored root
+  // hashes instead of rehashing the whole IR graph.
+
   // Returns the hash of the dag used to look up the compiled graph
-  virtual hash_t hash() const = 0;
+  virtual hash_t hash() const;
 
   // Returns the hash of the dag used to for shape caching
-  virtual hash_t shapeHash() const = 0;
+  virtual hash_t shapeHash() const;
 
   const MetaData& metadata() const {
     return metadata_;
@@ -160,10 +178,22 @@ class TORCH_API Node {
   virtual std::string ToString() const;
 
  private:
+  // Combines op, operand and shape hashes into the stored dag hashes; called
+  // from the constructors once operands and shapes are in place.
+  void ComputeHashes(OpList operands, const hash_t& hash_seed);
+
   // The ID of the operation captured by this node.
   OpKind op_;
   size_t num_outputs_ = 1;
 
+  // See Note [Incremental graph hashing].
+  // The hash of the dag WITH size info. Used for shape caching.
+  hash_t shape_hash_{0};
+  // The hash of the dag used to look up the compiled graph by a hash. We use
+  // the dag hash WITHOUT size info if dynamic shape is enabled and the dag
+  // hash WITH size info otherwise.
+  hash_t dag_hash_{0};
+
   // The IR specific metadata attached to the IR node.
   MetaData metadata_;
   // The IR framework user can attach a user defined metadata object deriving
@@ -38,14 +38,32 @@ size_t Shape::numel() const {
   return elts;
 }
 
+// Folded into the hash in place of the concrete extent of a symbolic dim.
+static const uint64_t kDynamicDimHashSentinel = 0x7f1d8f5a2c3b9e41;
+
 hash_t Shape::hash(bool bakeInSizes) const {
   if (bakeInSizes) {
     return HashCombine(
         Hash(scalar_type_),
         DataHash(sizes_.data(), sizes_.size() * sizeof(int64_t)));
-  } else {
+  }
+  if (!is_symbolic_.has_value()) {
     return HashCombine(Hash(scalar_type_), Hash(sizes_.size()));
   }
+  // Shape-polymorphic cache keys for dynamic shape mode: static dims keep
+  // their extents baked in while dims known to be symbolic contribute only a
+  // sentinel, so traces that differ in a dynamic dimension (e.g. sequence
+  // length) map to the same compiled computation instead of recompiling.
+  // The concrete extents still reach the compiled computation through its
+  // tensor arguments at run time.
+  hash_t hash = HashCombine(Hash(scalar_type_), Hash(sizes_.size()));
+  for (const auto i : c10::irange(sizes_.size())) {
+    hash = HashCombine(
+        hash,
+        is_symbolic_->at(i) ? hash_t(kDynamicDimHashSentinel)
+                            : Hash(sizes_[i]));
+  }
+  return hash;
 }
 
 Shape Shape::with_symbolic_dims(
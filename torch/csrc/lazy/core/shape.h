@@ -52,6 +52,10 @@ class TORCH_API Shape {
       c10::optional<std::vector<bool>> symbolic_dims) const;
 
   size_t numel() const;
+  // With bakeInSizes the hash covers every concrete extent (used for shape
+  // caching). Without it, the hash keys the compilation cache in dynamic
+  // shape mode: rank and static dims are baked in while dims marked
+  // symbolic are abstracted away.
   hash_t hash(bool bakeInSizes) const;
 
   bool operator==(const Shape& other) const;
@@ -16,40 +16,13 @@ std::string GetFirstUserFrameInPythonIfEnabled() {
 namespace torch {
 namespace lazy {
 
-static hash_t OperandHashes(
-    const OpList& operands,
-    const c10::ArrayRef<Shape>& shapes,
-    const hash_t& seed,
-    bool bakeInSizes) {
-  hash_t hash = seed;
-  for (auto& operand : operands) {
-    if (!operand) {
-      hash = HashCombine(hash, static_cast<uint64_t>(kNullOpt));
-      continue;
-    }
-    auto operand_hash = bakeInSizes ? operand.shapeHash() : operand.hash();
-    hash = HashCombine(hash, operand_hash);
-  }
-  for (auto& shape : shapes) {
-    hash = HashCombine(hash, shape.hash(bakeInSizes));
-  }
-  return hash;
-}
-
 TsNode::TsNode(
     OpKind op,
     OpList operands,
     std::vector<Shape>&& shapes,
     size_t num_outputs,
     hash_t hash_seed)
-    : Node(op, operands, std::move(shapes), num_outputs) {
-  hash_seed = HashCombine(op.hash(), hash_seed);
-  shape_hash_ = OperandHashes(operands, this->shapes(), hash_seed, true);
-  dag_hash_ =
-      (enableDynamicShape()
-           ? OperandHashes(operands, this->shapes(), hash_seed, false)
-           : shape_hash_);
-}
+    : Node(op, operands, std::move(shapes), num_outputs, hash_seed) {}
 
 TsNode::TsNode(
     OpKind op,
@@ -67,14 +40,6 @@ TsNode::TsNode(OpKind op, OpList operands, size_t num_outputs, hash_t hash_seed)
 TsNode::TsNode(OpKind op, Shape shape, size_t num_outputs, hash_t hash_seed)
     : TsNode(op, {}, {std::move(shape)}, num_outputs, hash_seed) {}
 
-hash_t TsNode::hash() const {
-  return dag_hash_;
-}
-
-hash_t TsNode::shapeHash() const {
-  return shape_hash_;
-}
-
 const std::string TsNode::getPythonStacktrace() const {
   return GetFirstUserFrameInPythonIfEnabled();
 }
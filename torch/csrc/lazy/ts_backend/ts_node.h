@@ -43,10 +43,6 @@ class TORCH_API TsNode : public lazy::Node {
 
   ~TsNode() override = default;
 
-  hash_t hash() const override;
-
-  hash_t shapeHash() const override;
-
   const std::string getPythonStacktrace() const;
 
   // Lower is a backend-specific method since it returns a backend specific
@@ -55,14 +51,6 @@ class TORCH_API TsNode : public lazy::Node {
   virtual TSOpVector Lower(
       std::shared_ptr<torch::jit::GraphFunction> function,
       TSLoweringContext* loctx) const;
-
- private:
-  // The hash of the dag WITH size info. Used for shape caching
-  hash_t shape_hash_;
-  // The hash of the dag used to look up the compiled graph by a hash
-  // in this case, we will use the dag hash WITHOUT size info if dynamic shape
-  // is enabled and use the dag hash WITH size info otherwise.
-  hash_t dag_hash_;
 };
 
 // Note: this OpKind is separate from ltc_ops.h since it would be a circular
@@ -8,6 +8,9 @@
 #include <torch/csrc/profiler/collection.h>
 #include <torch/csrc/profiler/python/combined_traceback.h>
 #include <torch/csrc/profiler/standalone/execution_graph_observer.h>
+#include <torch/csrc/profiler/standalone/sampling_profiler.h>
+#include <torch/csrc/profiler/standalone/shm_track_observer.h>
+#include <torch/csrc/profiler/standalone/trace_stream_observer.h>
 #include <torch/csrc/utils/pybind.h>
 
 namespace torch {
@@ -294,6 +297,40 @@ void initPythonBindings(PyObject* module) {
   m.def(
       "_disable_execution_graph_observer",
       &torch::profiler::impl::disableExecutionGraphObserver);
+
+  // Streaming trace sink for continuous profiling with bounded memory.
+  m.def(
+      "_add_trace_stream_observer",
+      &torch::profiler::impl::addTraceStreamObserver,
+      py::arg("output_path_prefix"),
+      py::arg("max_bytes_per_file") = 256 * 1024 * 1024,
+      py::arg("max_files") = 4);
+  m.def(
+      "_remove_trace_stream_observer",
+      &torch::profiler::impl::removeTraceStreamObserver);
+
+  // Shared-memory track event ring for external trace collectors.
+  m.def(
+      "_add_shm_track_observer",
+      &torch::profiler::impl::addShmTrackObserver,
+      py::arg("shm_path"),
+      py::arg("buffer_bytes") = 8 * 1024 * 1024);
+  m.def(
+      "_remove_shm_track_observer",
+      &torch::profiler::impl::removeShmTrackObserver);
+
+  // Always-on sampling profiler: aggregates shadow stack snapshots into
+  // collapsed flame graph lines.
+  m.def(
+      "_enable_sampling_profiler",
+      &torch::profiler::impl::enableSamplingProfiler,
+      py::arg("hz") = 100.0);
+  m.def(
+      "_disable_sampling_profiler",
+      &torch::profiler::impl::disableSamplingProfiler);
+  m.def(
+      "_sampling_profiler_enabled",
+      &torch::profiler::impl::samplingProfilerEnabled);
   m.def(
       "_set_record_concrete_inputs_enabled_val",
       &torch::profiler::impl::set_record_concrete_inputs_enabled_val);
@@ -0,0 +1,225 @@
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ATen/record_function.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/profiler/standalone/sampling_profiler.h>
+
+using namespace at;
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+namespace {
+
+// Deep enough for any realistic op nesting; deeper frames are dropped but the
+// depth counter keeps counting so pushes and pops stay balanced.
+constexpr size_t kMaxStackDepth = 64;
+
+// One shadow stack per recording thread. The owning thread is the only
+// writer; the sampler thread reads `depth` and then the frames without any
+// lock. A racy read can only observe a stack that existed a moment ago or a
+// truncated one, which is acceptable for a sampling profiler.
+struct ShadowStack {
+  std::array<const char*, kMaxStackDepth> frames{};
+  std::atomic<int64_t> depth{0};
+  std::atomic<bool> alive{true};
+};
+
+struct SamplerState {
+  // Guards `stacks` and `interned_names`. Hot threads take it once per
+  // distinct op name (interning) and once per thread (registration).
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ShadowStack>> stacks;
+  // Never cleared: thread-local interning caches keep pointers into the pool
+  // across enable/disable cycles. Bounded by the number of distinct op names.
+  std::unordered_set<std::string> interned_names;
+
+  std::thread sampler;
+  std::mutex cv_mutex;
+  std::condition_variable cv;
+  bool stop{false};
+
+  std::chrono::microseconds interval{10000};
+  // Only touched by the sampler thread while it runs, and by
+  // disableSamplingProfiler() after the join.
+  std::map<std::string, uint64_t> samples;
+  CallbackHandle cb_handle{INVALID_CALLBACK_HANDLE};
+};
+
+std::atomic<bool> sampling_enabled{false};
+
+SamplerState& state() {
+  static SamplerState s;
+  return s;
+}
+
+// Returns a pointer for `name` that stays valid after the RecordFunction is
+// gone (fn.name() does not). Hot threads hit the thread-local cache; the
+// global pool mutex is only taken on the first sighting of a name per thread.
+const char* internName(const char* name) {
+  thread_local std::unordered_map<std::string, const char*> cache;
+  auto it = cache.find(name);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto& s = state();
+  const char* stable = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(s.mutex);
+    stable = s.interned_names.emplace(name).first->c_str();
+  }
+  cache.emplace(name, stable);
+  return stable;
+}
+
+// Registers the calling thread's shadow stack on first use and flags it dead
+// on thread exit so the sampler skips it. The shared_ptr keeps the storage
+// valid while the sampler may still be reading it.
+struct ThreadShadowStack {
+  ThreadShadowStack() : stack(std::make_shared<ShadowStack>()) {
+    auto& s = state();
+    std::lock_guard<std::mutex> guard(s.mutex);
+    s.stacks.push_back(stack);
+  }
+  ~ThreadShadowStack() {
+    stack->depth.store(0, std::memory_order_release);
+    stack->alive.store(false, std::memory_order_release);
+  }
+  std::shared_ptr<ShadowStack> stack;
+};
+
+ShadowStack& localStack() {
+  thread_local ThreadShadowStack tls;
+  return *tls.stack;
+}
+
+std::unique_ptr<ObserverContext> onSamplingEnter(const RecordFunction& fn) {
+  auto& stack = localStack();
+  const auto d = stack.depth.load(std::memory_order_relaxed);
+  if (static_cast<size_t>(d) < kMaxStackDepth) {
+    stack.frames[d] = internName(fn.name());
+  }
+  stack.depth.store(d + 1, std::memory_order_release);
+  return nullptr;
+}
+
+void onSamplingExit(const RecordFunction& /* fn */, ObserverContext* /* ctx */) {
+  auto& stack = localStack();
+  const auto d = stack.depth.load(std::memory_order_relaxed);
+  if (d > 0) {
+    stack.depth.store(d - 1, std::memory_order_release);
+  }
+}
+
+void samplerLoop() {
+  auto& s = state();
+  std::vector<std::shared_ptr<ShadowStack>> stacks_snapshot;
+  std::string key;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(s.cv_mutex);
+      if (s.cv.wait_for(lock, s.interval, [&s] { return s.stop; })) {
+        return;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> guard(s.mutex);
+      stacks_snapshot = s.stacks;
+    }
+    for (const auto& stack : stacks_snapshot) {
+      if (!stack->alive.load(std::memory_order_acquire)) {
+        continue;
+      }
+      const auto d = std::min(
+          stack->depth.load(std::memory_order_acquire),
+          static_cast<int64_t>(kMaxStackDepth));
+      if (d <= 0) {
+        continue;
+      }
+      key.clear();
+      for (const auto i : c10::irange(d)) {
+        const char* frame = stack->frames[i];
+        if (frame == nullptr) {
+          break;
+        }
+        if (!key.empty()) {
+          key.push_back(';');
+        }
+        key.append(frame);
+      }
+      if (!key.empty()) {
+        ++s.samples[key];
+      }
+    }
+  }
+}
+
+} // namespace
+
+bool enableSamplingProfiler(double hz) {
+  TORCH_CHECK(
+      hz > 0 && hz <= 10000,
+      "sampling rate must be in (0, 10000] Hz, got ",
+      hz);
+  if (sampling_enabled.exchange(true)) {
+    LOG(WARNING) << "Sampling profiler is already enabled.";
+    return false;
+  }
+  auto& s = state();
+  s.samples.clear();
+  s.stop = false;
+  s.interval =
+      std::chrono::microseconds(static_cast<int64_t>(1000000.0 / hz));
+  s.cb_handle = addGlobalCallback(
+      RecordFunctionCallback(&onSamplingEnter, &onSamplingExit));
+  s.sampler = std::thread(samplerLoop);
+  VLOG(1) << "Enabled PyTorch sampling profiler at " << hz << " Hz";
+  return true;
+}
+
+std::string disableSamplingProfiler() {
+  if (!sampling_enabled.load()) {
+    LOG(WARNING) << "Sampling profiler was not enabled.";
+    return "";
+  }
+  auto& s = state();
+  removeCallback(s.cb_handle);
+  s.cb_handle = INVALID_CALLBACK_HANDLE;
+  {
+    std::lock_guard<std::mutex> lock(s.cv_mutex);
+    s.stop = true;
+  }
+  s.cv.notify_all();
+  s.sampler.join();
+
+  std::string result;
+  for (const auto& kv : s.samples) {
+    result += fmt::format("{} {}\n", kv.first, kv.second);
+  }
+  s.samples.clear();
+  sampling_enabled.store(false);
+  VLOG(1) << "Disabled PyTorch sampling profiler";
+  return result;
+}
+
+bool samplingProfilerEnabled() {
+  return sampling_enabled.load();
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
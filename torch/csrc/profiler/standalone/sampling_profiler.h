@@ -0,0 +1,28 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <string>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Starts the sampling profiler: a lightweight RecordFunction callback keeps a
+// per-thread shadow stack of interned op names, and a background thread wakes
+// up `hz` times per second to snapshot every live shadow stack. Aggregation
+// happens entirely on the background thread; the cost on hot threads is a
+// pointer push/pop plus a thread-local interning cache lookup per op, which
+// is cheap enough to leave enabled on long-running inference jobs.
+TORCH_API bool enableSamplingProfiler(double hz = 100.0);
+
+// Stops sampling and returns the aggregated samples in collapsed flame graph
+// format: one "root;child;leaf <count>" line per observed stack, suitable for
+// flamegraph.pl or speedscope.
+TORCH_API std::string disableSamplingProfiler();
+
+// Whether the sampling profiler is currently running.
+TORCH_API bool samplingProfilerEnabled();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
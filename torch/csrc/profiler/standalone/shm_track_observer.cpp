@@ -0,0 +1,223 @@
+#include <torch/csrc/profiler/standalone/shm_track_observer.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // !_WIN32
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <ATen/record_function.h>
+#include <torch/csrc/profiler/util.h>
+
+using namespace at;
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+namespace {
+
+// Note [Shm track event protocol]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The mapped region starts with a 64-byte ShmTrackHeader followed by
+// `capacity` 64-byte ShmTrackEvent records used as a ring. Writers claim a
+// monotonic index with a relaxed fetch_add on header.head and publish into
+// slot `index % capacity` under a per-record sequence lock:
+//
+//   seq = 2 * index + 1   (odd: record is being written)
+//   ... payload stores ...
+//   seq = 2 * index + 2   (even: record is published)
+//
+// A reader copies the payload between two acquire loads of `seq` and keeps
+// the copy only if both loads returned the same even value; the encoded
+// index also tells the reader how far the ring has wrapped. Old records are
+// overwritten without coordination - this is a tracing ring, and dropping
+// the oldest events under overload is the intended failure mode.
+//
+// Begin/end pairing is positional per thread (`tid`), exactly like nvtx
+// range push/pop: a consumer turns them into slice begin/end events on a
+// per-thread track.
+
+constexpr uint64_t kShmTrackMagic = 0x544b525448435254ULL; // "TRCHTRKT"
+constexpr uint32_t kShmTrackVersion = 1;
+
+constexpr uint8_t kPhaseBegin = 0;
+constexpr uint8_t kPhaseEnd = 1;
+
+struct alignas(64) ShmTrackHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t capacity; // number of records in the ring
+  int32_t pid;
+  uint32_t reserved;
+  std::atomic<uint64_t> head; // monotonic count of claimed records
+};
+static_assert(
+    sizeof(ShmTrackHeader) == 64,
+    "ShmTrackHeader must occupy exactly one cache line");
+
+struct alignas(64) ShmTrackEvent {
+  std::atomic<uint64_t> seq;
+  int64_t ts_ns;
+  uint64_t tid;
+  uint8_t phase; // kPhaseBegin / kPhaseEnd
+  uint8_t scope; // at::RecordScope
+  char name[38]; // truncated, NUL padded; empty for end events
+};
+static_assert(
+    sizeof(ShmTrackEvent) == 64,
+    "ShmTrackEvent must occupy exactly one cache line");
+
+static_assert(
+    std::atomic<uint64_t>::is_always_lock_free,
+    "the shm ring requires lock-free 64-bit atomics");
+
+struct ShmTrackObserver {
+  ShmTrackObserver() = default;
+
+  ~ShmTrackObserver() {
+#ifndef _WIN32
+    if (header != nullptr) {
+      munmap(header, mapped_bytes);
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+#endif // !_WIN32
+  }
+
+  ShmTrackHeader* header{nullptr};
+  ShmTrackEvent* records{nullptr};
+  size_t mapped_bytes{0};
+  int fd{-1};
+  CallbackHandle cb_handle{INVALID_CALLBACK_HANDLE};
+};
+
+using ObserverManager = GlobalStateManager<ShmTrackObserver>;
+
+void writeShmTrackEvent(
+    ShmTrackObserver& ob,
+    uint8_t phase,
+    const RecordFunction& fn) {
+  auto& header = *ob.header;
+  const uint64_t index =
+      header.head.fetch_add(1, std::memory_order_relaxed);
+  auto& rec = ob.records[index % header.capacity];
+
+  rec.seq.store(2 * index + 1, std::memory_order_release);
+  rec.ts_ns = getTime();
+  rec.tid = fn.threadId();
+  rec.phase = phase;
+  rec.scope = static_cast<std::underlying_type_t<RecordScope>>(fn.scope());
+  if (phase == kPhaseBegin) {
+    strncpy(rec.name, fn.name(), sizeof(rec.name) - 1);
+    rec.name[sizeof(rec.name) - 1] = '\0';
+  } else {
+    rec.name[0] = '\0';
+  }
+  rec.seq.store(2 * index + 2, std::memory_order_release);
+}
+
+std::unique_ptr<ObserverContext> onShmTrackEnter(const RecordFunction& fn) {
+  auto* ob = ObserverManager::get();
+  if (ob != nullptr) {
+    writeShmTrackEvent(*ob, kPhaseBegin, fn);
+  }
+  return nullptr;
+}
+
+void onShmTrackExit(const RecordFunction& fn, ObserverContext* /* ctx */) {
+  auto* ob = ObserverManager::get();
+  if (ob != nullptr) {
+    writeShmTrackEvent(*ob, kPhaseEnd, fn);
+  }
+}
+
+} // namespace
+
+bool addShmTrackObserver(const std::string& shm_path, size_t buffer_bytes) {
+#ifdef _WIN32
+  (void)shm_path;
+  (void)buffer_bytes;
+  LOG(WARNING) << "Shm track observer is only supported on POSIX platforms.";
+  return false;
+#else // _WIN32
+  const size_t capacity =
+      buffer_bytes < sizeof(ShmTrackHeader)
+      ? 0
+      : (buffer_bytes - sizeof(ShmTrackHeader)) / sizeof(ShmTrackEvent);
+  TORCH_CHECK(
+      capacity >= 2,
+      "buffer_bytes is too small for the shm track ring: ",
+      buffer_bytes);
+  if (ObserverManager::get() != nullptr) {
+    LOG(WARNING) << "Shm track observer is already registered.";
+    return false;
+  }
+
+  ObserverManager::push(std::make_shared<ShmTrackObserver>());
+  auto& ob = *ObserverManager::get();
+  ob.mapped_bytes =
+      sizeof(ShmTrackHeader) + capacity * sizeof(ShmTrackEvent);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  ob.fd = open(shm_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (ob.fd < 0 || ftruncate(ob.fd, ob.mapped_bytes) != 0) {
+    LOG(WARNING) << "Failed to create shm track buffer '" << shm_path << "'";
+    ObserverManager::pop();
+    return false;
+  }
+  void* mapped = mmap(
+      nullptr,
+      ob.mapped_bytes,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      ob.fd,
+      0);
+  if (mapped == MAP_FAILED) {
+    LOG(WARNING) << "Failed to map shm track buffer '" << shm_path << "'";
+    ObserverManager::pop();
+    return false;
+  }
+
+  // ftruncate zero-filled the region; only the header needs real values.
+  ob.header = new (mapped) ShmTrackHeader();
+  ob.records = reinterpret_cast<ShmTrackEvent*>(
+      static_cast<char*>(mapped) + sizeof(ShmTrackHeader));
+  ob.header->record_size = sizeof(ShmTrackEvent);
+  ob.header->capacity = capacity;
+  ob.header->pid = static_cast<int32_t>(getpid());
+  ob.header->head.store(0, std::memory_order_relaxed);
+  ob.header->version = kShmTrackVersion;
+  // Written last so a concurrently attaching consumer never sees a valid
+  // magic with a half-initialized header.
+  ob.header->magic = kShmTrackMagic;
+
+  ob.cb_handle = addGlobalCallback(
+      RecordFunctionCallback(&onShmTrackEnter, &onShmTrackExit));
+  VLOG(1) << "Added PyTorch shm track observer, path=" << shm_path;
+  return true;
+#endif // _WIN32
+}
+
+void removeShmTrackObserver() {
+  auto* ob = ObserverManager::get();
+  if (ob == nullptr) {
+    LOG(WARNING) << "Shm track observer was not registered.";
+    return;
+  }
+  removeCallback(ob->cb_handle);
+  ObserverManager::pop();
+  VLOG(1) << "Removed PyTorch shm track observer";
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <cstddef>
+#include <string>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Adds a global observer that emits RecordFunction scopes as fixed-size
+// begin/end track events into a memory-mapped ring buffer, so an external
+// trace collector (e.g. a perfetto producer sidecar) can consume torch op
+// spans from shared memory without attaching the full profiler or Kineto.
+// `shm_path` is mapped with MAP_SHARED and is typically a file under
+// /dev/shm; the layout is a 64-byte header followed by 64-byte records,
+// each published under a per-record sequence lock (see
+// Note [Shm track event protocol] in shm_track_observer.cpp).
+// The hot path is one atomic increment plus one cache line write per
+// event - no locks, no allocation, no formatting.
+TORCH_API bool addShmTrackObserver(
+    const std::string& shm_path,
+    size_t buffer_bytes = 8 * 1024 * 1024);
+
+// Removes the observer and unmaps the buffer. Records already written stay
+// valid for consumers that mapped the file.
+TORCH_API void removeShmTrackObserver();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,201 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <processthreadsapi.h>
+#else
+#include <unistd.h>
+#endif // _WIN32
+
+#include <fmt/format.h>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <ATen/record_function.h>
+#include <torch/csrc/profiler/standalone/trace_stream_observer.h>
+#include <torch/csrc/profiler/util.h>
+
+using namespace at;
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+namespace {
+
+inline int32_t streamProcessId() {
+#ifndef _WIN32
+  return static_cast<int32_t>(getpid());
+#else
+  return static_cast<int32_t>(GetCurrentProcessId());
+#endif
+}
+
+inline std::string jsonStrEscape(const char* str) {
+  std::ostringstream ostream;
+  for (const char* p = str; *p != '\0'; ++p) {
+    const char ch = *p;
+    if (ch == '"') {
+      ostream << "\\\"";
+    } else if (ch == '\\') {
+      ostream << "\\\\";
+    } else if ('\x00' <= ch && ch <= '\x1f') {
+      ostream << fmt::format("\\u{:04x}", static_cast<int>(ch));
+    } else {
+      ostream << ch;
+    }
+  }
+  return ostream.str();
+}
+
+// TraceStreamObserver holds the rotating output chunk and the RecordFunction
+// callback handle. Events are formatted outside the lock; the mutex only
+// guards the stream and rotation bookkeeping, so the memory footprint is
+// bounded by one formatted event per recording thread regardless of how long
+// the observer stays attached.
+struct TraceStreamObserver {
+  TraceStreamObserver() = default;
+
+  // Full path of the chunk with the given rotation index.
+  std::string chunkName(size_t index) const {
+    return fmt::format("{}.{}.json", path_prefix, index % max_files);
+  }
+
+  // Opens (and truncates) the chunk for `chunk_index`.
+  bool openChunk() {
+    out.close();
+    out.clear();
+    out.open(chunkName(chunk_index), std::ofstream::out | std::ofstream::trunc);
+    if (!out) {
+      LOG(WARNING) << "Failed to open trace stream chunk '"
+                   << chunkName(chunk_index) << "'";
+      return false;
+    }
+    bytes_written = 0;
+    return true;
+  }
+
+  // Appends one formatted event line, rotating first if the current chunk is
+  // full. Must be called with `mutex` held.
+  void write(const std::string& line) {
+    if (bytes_written >= max_bytes_per_file) {
+      ++chunk_index;
+      if (!openChunk()) {
+        return;
+      }
+    }
+    out << line;
+    bytes_written += line.size();
+  }
+
+  std::mutex mutex;
+  std::ofstream out;
+  std::string path_prefix;
+  size_t max_bytes_per_file{0};
+  size_t max_files{0};
+  size_t bytes_written{0};
+  size_t chunk_index{0};
+  int32_t pid{-1};
+  CallbackHandle cb_handle{INVALID_CALLBACK_HANDLE};
+};
+
+using ObserverManager = GlobalStateManager<TraceStreamObserver>;
+
+struct TraceStreamContext : public ObserverContext {
+  int64_t start_time_ns{0};
+};
+
+std::unique_ptr<ObserverContext> onTraceStreamEnter(
+    const RecordFunction& /* fn */) {
+  if (ObserverManager::get() == nullptr) {
+    return nullptr;
+  }
+  auto ctx = std::make_unique<TraceStreamContext>();
+  ctx->start_time_ns = getTime();
+  return ctx;
+}
+
+void onTraceStreamExit(const RecordFunction& fn, ObserverContext* ctx_ptr) {
+  const auto end_time_ns = getTime();
+  auto* ob = ObserverManager::get();
+  auto* ctx = static_cast<TraceStreamContext*>(ctx_ptr);
+  if (ob == nullptr || ctx == nullptr) {
+    return;
+  }
+
+  // Chrome trace style complete event, one JSON object per line. Formatting
+  // happens before the lock is taken.
+  const auto line = fmt::format(
+      "{{\"name\": \"{}\", \"ph\": \"X\", \"ts\": {}, \"dur\": {}, "
+      "\"pid\": {}, \"tid\": {}, \"args\": {{\"scope\": {}, \"seq\": {}}}}}\n",
+      jsonStrEscape(fn.name()),
+      ctx->start_time_ns / 1000,
+      (end_time_ns - ctx->start_time_ns) / 1000,
+      ob->pid,
+      fn.threadId(),
+      static_cast<std::underlying_type_t<RecordScope>>(fn.scope()),
+      fn.seqNr());
+
+  try {
+    const std::lock_guard<std::mutex> lock(ob->mutex);
+    ob->write(line);
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Exception in trace stream observer: " << e.what();
+  }
+}
+
+} // namespace
+
+bool addTraceStreamObserver(
+    const std::string& output_path_prefix,
+    size_t max_bytes_per_file,
+    size_t max_files) {
+  TORCH_CHECK(max_bytes_per_file > 0, "max_bytes_per_file must be positive");
+  TORCH_CHECK(max_files > 0, "max_files must be positive");
+  if (ObserverManager::get() != nullptr) {
+    LOG(WARNING) << "Trace stream observer is already registered.";
+    return false;
+  }
+
+  ObserverManager::push(std::make_shared<TraceStreamObserver>());
+  auto& ob = *ObserverManager::get();
+  ob.path_prefix = output_path_prefix;
+  ob.max_bytes_per_file = max_bytes_per_file;
+  ob.max_files = max_files;
+  ob.pid = streamProcessId();
+  if (!ob.openChunk()) {
+    ObserverManager::pop();
+    return false;
+  }
+
+  ob.cb_handle = addGlobalCallback(
+      RecordFunctionCallback(&onTraceStreamEnter, &onTraceStreamExit));
+  VLOG(1) << "Added PyTorch trace stream observer, output="
+          << output_path_prefix;
+  return true;
+}
+
+void removeTraceStreamObserver() {
+  auto* ob = ObserverManager::get();
+  if (ob == nullptr) {
+    LOG(WARNING) << "Trace stream observer was not registered.";
+    return;
+  }
+  removeCallback(ob->cb_handle);
+  {
+    const std::lock_guard<std::mutex> lock(ob->mutex);
+    ob->out.flush();
+    ob->out.close();
+  }
+  ObserverManager::pop();
+  VLOG(1) << "Removed PyTorch trace stream observer";
+}
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <cstddef>
+#include <string>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Adds a global observer that streams finished op events straight to disk as
+// they complete, instead of accumulating them in memory until the profiler is
+// disabled. Events are appended as JSON Lines to rotating chunk files named
+// `<output_path_prefix>.<n>.json`; once a chunk exceeds max_bytes_per_file
+// the next chunk is started, and after max_files chunks the oldest chunk is
+// overwritten. Memory usage is bounded by a single formatted event,
+// which makes continuous profiling of long-running jobs feasible.
+TORCH_API bool addTraceStreamObserver(
+    const std::string& output_path_prefix,
+    size_t max_bytes_per_file = 256 * 1024 * 1024,
+    size_t max_files = 4);
+
+// Flushes the current chunk and removes the streaming observer.
+TORCH_API void removeTraceStreamObserver();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
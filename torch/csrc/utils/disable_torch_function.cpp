@@ -6,6 +6,8 @@
 
 #include <ATen/PythonTorchFunctionTLS.h>
 
+#include <atomic>
+
 namespace torch {
 PyObject* disabled_torch_function = nullptr;
 PyObject* disabled_torch_dispatch = nullptr;
@@ -303,7 +305,53 @@ inline bool has_torch_function_attr(PyObject* obj) {
 }
 
 namespace torch {
+
+// Note [Torch function override fast path]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Most processes never create a Tensor subclass with a live
+// __torch_function__ and never push a torch function mode, yet every
+// Python-side op pays for the mode TLS lookup and type checks below. We
+// keep a process-global generation counter that is bumped the first time
+// anything capable of dispatching __torch_function__ on a Tensor shows
+// up: a subclass instance whose type carries a non-disabled
+// __torch_function__ (latched in THPVariable_NewWithVar), or a torch
+// function mode push. While the counter is still zero, a plain Tensor
+// argument can short-circuit the whole check with a single relaxed load:
+// no subclass instance exists, and a mode being active would have bumped
+// the counter when it was pushed. The latch is one-way and conservative,
+// so popping a mode or collecting a subclass never re-enables it.
+static std::atomic<uint64_t> torch_function_override_generation_{0};
+
+bool torch_function_overrides_seen() {
+  return torch_function_override_generation_.load(std::memory_order_relaxed) !=
+      0;
+}
+
+uint64_t torch_function_override_generation() {
+  return torch_function_override_generation_.load(std::memory_order_relaxed);
+}
+
+void note_torch_function_override() {
+  torch_function_override_generation_.fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+void note_torch_function_override_from_type(PyTypeObject* type) {
+  if (reinterpret_cast<PyObject*>(type) == THPVariableClass) {
+    return;
+  }
+  // Subclasses that opt out via _disabled_torch_function_impl (e.g.
+  // nn.Parameter) never dispatch, so they keep the fast path alive.
+  if (has_torch_function_attr(reinterpret_cast<PyObject*>(type))) {
+    note_torch_function_override();
+  }
+}
+
 auto check_has_torch_function(PyObject* obj, bool ignore_mode) -> bool {
+  // See Note [Torch function override fast path]
+  if (!torch_function_overrides_seen() && THPVariable_CheckExact(obj)) {
+    return false;
+  }
   if (!ignore_mode && at::impl::torch_function_mode_enabled())
     return true;
   PyTypeObject* tp = Py_TYPE(obj);
@@ -375,3 +423,10 @@ PyObject* THPModule_has_torch_function_variadic(
   }
   Py_RETURN_FALSE;
 }
+
+PyObject* THPModule_torch_function_override_generation(
+    PyObject*,
+    PyObject*) {
+  return PyLong_FromUnsignedLongLong(
+      torch::torch_function_override_generation());
+}
@@ -18,6 +18,19 @@ void set_disabled_torch_dispatch_impl(PyObject* value);
 // overloaded list even if they don't actually have __torch_function__
 bool check_has_torch_function(PyObject* obj, bool ignore_mode = false);
 
+// See Note [Torch function override fast path]. True once anything capable
+// of __torch_function__ dispatch on a Tensor has been observed.
+bool torch_function_overrides_seen();
+// Monotonic counter bumped on every observation; lets callers build their
+// own generation-keyed caches on top of the latch.
+uint64_t torch_function_override_generation();
+// Records an override observation (e.g. a torch function mode push),
+// permanently disabling the fast path.
+void note_torch_function_override();
+// Records an observation iff `type` is a Tensor subclass carrying a live
+// (non-disabled) __torch_function__; called on subclass instantiation.
+void note_torch_function_override_from_type(PyTypeObject* type);
+
 struct DisableTorchDispatch {
   DisableTorchDispatch()
       : guard_(c10::DispatchKey::Python),
@@ -39,3 +52,4 @@ PyObject* THPModule_has_torch_function_variadic(
     PyObject*,
     PyObject* const* args,
     Py_ssize_t nargs);
+PyObject* THPModule_torch_function_override_generation(PyObject*, PyObject*);
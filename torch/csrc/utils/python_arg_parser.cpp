@@ -14,6 +14,7 @@
 #include <ATen/TracerMode.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -1506,13 +1507,57 @@ PythonArgs PythonArgParser::raw_parse(
     return PythonArgs(traceable, signature, parsed_args);
   }
 
-  for (auto& signature : signatures_) {
+  // Each binding site constructs one static PythonArgParser, so the parser
+  // doubles as a per-call-site inline cache for overload resolution: remember
+  // which signature matched for the tuple of positional argument types and try
+  // it first on subsequent calls, skipping the failed parses of the overloads
+  // that precede it. The cache is only sound when overload selection is
+  // determined by the Python types alone, so three kinds of calls take the
+  // ordered scan below unconditionally: calls with kwargs, calls with
+  // list/tuple arguments (parameter checks depend on element types), and
+  // calls with 0-dim tensor arguments (scalar-typed parameters accept those
+  // based on requires_grad() and dtype -- see FunctionParameter::check -- so
+  // two calls with identical argument types can select different overloads).
+  // A mispredicted entry is harmless: the cached signature fails to parse and
+  // we fall back to the scan.
+  const size_t nargs = args != nullptr ? PyTuple_GET_SIZE(args) : 0;
+  bool cacheable = kwargs == nullptr && nargs <= kMaxCachedArgs;
+  std::array<PyTypeObject*, kMaxCachedArgs> arg_types{};
+  for (size_t i = 0; cacheable && i < nargs; i++) {
+    PyObject* obj = PyTuple_GET_ITEM(args, i);
+    if (PyList_Check(obj) || PyTuple_Check(obj)) {
+      cacheable = false;
+    } else if (THPVariable_Check(obj) && THPVariable_Unpack(obj).dim() == 0) {
+      cacheable = false;
+    } else {
+      arg_types[i] = Py_TYPE(obj);
+    }
+  }
+  if (cacheable && nargs == cached_nargs_ &&
+      std::equal(
+          arg_types.begin(), arg_types.begin() + nargs, cached_arg_types_.begin())) {
+    auto& signature = signatures_[cached_signature_];
     if (signature.parse(self, args, kwargs, parsed_args, false)) {
       check_deprecated(signature);
       return PythonArgs(traceable, signature, parsed_args);
     }
   }
 
+  for (const auto i : c10::irange(signatures_.size())) {
+    auto& signature = signatures_[i];
+    if (signature.parse(self, args, kwargs, parsed_args, false)) {
+      if (cacheable) {
+        // Note: cache the position in signatures_, not signature.index; the
+        // constructor reorders signatures_ after indices are assigned.
+        cached_nargs_ = nargs;
+        cached_arg_types_ = arg_types;
+        cached_signature_ = static_cast<int>(i);
+      }
+      check_deprecated(signature);
+      return PythonArgs(traceable, signature, parsed_args);
+    }
+  }
+
   print_error(self, args, kwargs, parsed_args);
 }
 
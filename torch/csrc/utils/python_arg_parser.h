@@ -75,6 +75,7 @@
 
 #include <array>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -176,6 +177,14 @@ struct PYBIND11_EXPORT PythonArgParser {
   std::string function_name;
   size_t max_args;
   bool traceable;
+
+  // Inline cache for overload resolution, keyed by the tuple of positional
+  // argument types observed on a previous call (see raw_parse). Guarded by
+  // the GIL, like the rest of the parser state.
+  static constexpr size_t kMaxCachedArgs = 8;
+  std::array<PyTypeObject*, kMaxCachedArgs> cached_arg_types_{};
+  size_t cached_nargs_ = std::numeric_limits<size_t>::max();
+  int cached_signature_ = -1;
 };
 
 struct PYBIND11_EXPORT FunctionSignature {
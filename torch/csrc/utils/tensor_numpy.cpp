@@ -15,6 +15,9 @@ at::Tensor tensor_from_numpy(
     bool warn_if_not_writeable /*=true*/) {
   throw std::runtime_error("PyTorch was compiled without NumPy support");
 }
+at::Tensor tensor_from_numpy_consume(PyObject* obj) {
+  throw std::runtime_error("PyTorch was compiled without NumPy support");
+}
 
 bool is_numpy_available() {
   throw std::runtime_error("PyTorch was compiled without NumPy support");
@@ -212,23 +215,12 @@ void warn_numpy_not_writeable() {
       "suppressed for the rest of this program.");
 }
 
-at::Tensor tensor_from_numpy(
-    PyObject* obj,
-    bool warn_if_not_writeable /*=true*/) {
-  if (!is_numpy_available()) {
-    throw std::runtime_error("Numpy is not available");
-  }
-  if (!PyArray_Check(obj)) {
-    throw TypeError("expected np.ndarray (got %s)", Py_TYPE(obj)->tp_name);
-  }
-  auto array = (PyArrayObject*)obj;
-
-  // warn_if_not_writable is true when a copy of numpy variable is created.
-  // the warning is suppressed when a copy is being created.
-  if (!PyArray_ISWRITEABLE(array) && warn_if_not_writeable) {
-    warn_numpy_not_writeable();
-  }
-
+// Shared validation for the borrowing and consuming from_numpy entry points:
+// converts sizes and strides to element counts and rejects layouts we cannot
+// represent. Arbitrary (e.g. Fortran-ordered) strides pass through as-is; the
+// resulting tensor stays non-contiguous until an op needs it otherwise.
+static std::pair<std::vector<int64_t>, std::vector<int64_t>>
+numpy_sizes_and_strides(PyArrayObject* array) {
   int ndim = PyArray_NDIM(array);
   auto sizes = to_aten_shape(ndim, PyArray_DIMS(array));
   auto strides = to_aten_shape(ndim, PyArray_STRIDES(array));
@@ -253,17 +245,38 @@ at::Tensor tensor_from_numpy(
     }
   }
 
-  void* data_ptr = PyArray_DATA(array);
   if (!PyArray_EquivByteorders(PyArray_DESCR(array)->byteorder, NPY_NATIVE)) {
     throw ValueError(
         "given numpy array has byte order different from the native byte order. "
         "Conversion between byte orders is currently not supported.");
   }
+  return std::make_pair(std::move(sizes), std::move(strides));
+}
+
+at::Tensor tensor_from_numpy(
+    PyObject* obj,
+    bool warn_if_not_writeable /*=true*/) {
+  if (!is_numpy_available()) {
+    throw std::runtime_error("Numpy is not available");
+  }
+  if (!PyArray_Check(obj)) {
+    throw TypeError("expected np.ndarray (got %s)", Py_TYPE(obj)->tp_name);
+  }
+  auto array = (PyArrayObject*)obj;
+
+  // warn_if_not_writable is true when a copy of numpy variable is created.
+  // the warning is suppressed when a copy is being created.
+  if (!PyArray_ISWRITEABLE(array) && warn_if_not_writeable) {
+    warn_numpy_not_writeable();
+  }
+
+  auto sizes_and_strides = numpy_sizes_and_strides(array);
+  void* data_ptr = PyArray_DATA(array);
   Py_INCREF(obj);
   return at::lift_fresh(at::from_blob(
       data_ptr,
-      sizes,
-      strides,
+      sizes_and_strides.first,
+      sizes_and_strides.second,
       [obj](void* data) {
         pybind11::gil_scoped_acquire gil;
         Py_DECREF(obj);
@@ -271,6 +284,80 @@ at::Tensor tensor_from_numpy(
       at::device(kCPU).dtype(numpy_dtype_to_aten(PyArray_TYPE(array)))));
 }
 
+// Ownership-transfer variant of tensor_from_numpy. tensor_from_numpy keeps
+// the whole ndarray wrapper alive for the lifetime of the tensor; this
+// version transfers ownership of the underlying buffer instead, so the
+// producer can drop the array immediately after the handoff:
+//
+//  - If the array owns its buffer (NPY_ARRAY_OWNDATA), the buffer is stolen
+//    outright: the flag is cleared and the tensor's DataPtr frees the buffer
+//    through NumPy's allocator. The tensor is installed as the array's base
+//    object so reads through the (now non-owning) array stay valid.
+//  - If the buffer belongs to a base object (e.g. a capsule handed out by a
+//    foreign allocator), that reference is transferred to the DataPtr, tying
+//    the buffer's lifetime to the tensor rather than the ndarray wrapper.
+//
+// Strides are taken as-is in both cases, so Fortran-ordered and otherwise
+// non-contiguous inputs are accepted without a copy.
+at::Tensor tensor_from_numpy_consume(PyObject* obj) {
+  if (!is_numpy_available()) {
+    throw std::runtime_error("Numpy is not available");
+  }
+  if (!PyArray_Check(obj)) {
+    throw TypeError("expected np.ndarray (got %s)", Py_TYPE(obj)->tp_name);
+  }
+  auto array = (PyArrayObject*)obj;
+  if (!PyArray_ISWRITEABLE(array)) {
+    throw ValueError(
+        "from_numpy_consume: cannot take ownership of a non-writable array. "
+        "Copy the array, or use torch.from_numpy for a read-only view.");
+  }
+
+  auto sizes_and_strides = numpy_sizes_and_strides(array);
+  void* data_ptr = PyArray_DATA(array);
+  auto options =
+      at::device(kCPU).dtype(numpy_dtype_to_aten(PyArray_TYPE(array)));
+
+  if (PyArray_CHKFLAGS(array, NPY_ARRAY_OWNDATA) &&
+      PyArray_BASE(array) == nullptr) {
+    PyArray_CLEARFLAGS(array, NPY_ARRAY_OWNDATA);
+    auto tensor = at::lift_fresh(at::from_blob(
+        data_ptr,
+        sizes_and_strides.first,
+        sizes_and_strides.second,
+        [](void* data) {
+          // PyDataMem_FREE may invoke allocation tracing hooks.
+          pybind11::gil_scoped_acquire gil;
+          PyDataMem_FREE(data);
+        },
+        options));
+    // Keep reads through the stolen-from array valid: the array holds the
+    // tensor (which now owns the buffer), mirroring tensor_to_numpy.
+    PyObject* py_tensor = THPVariable_Wrap(tensor);
+    if (!py_tensor)
+      throw python_error();
+    if (PyArray_SetBaseObject(array, py_tensor) == -1) {
+      throw python_error();
+    }
+    return tensor;
+  }
+
+  // The buffer is owned by the array's base object (or, lacking one, by the
+  // array itself); hold that instead of the wrapper.
+  PyObject* base = PyArray_BASE(array);
+  PyObject* owner = base != nullptr ? base : obj;
+  Py_INCREF(owner);
+  return at::lift_fresh(at::from_blob(
+      data_ptr,
+      sizes_and_strides.first,
+      sizes_and_strides.second,
+      [owner](void* data) {
+        pybind11::gil_scoped_acquire gil;
+        Py_DECREF(owner);
+      },
+      options));
+}
+
 int aten_to_numpy_dtype(const ScalarType scalar_type) {
   switch (scalar_type) {
     case kDouble:
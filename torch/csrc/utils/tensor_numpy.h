@@ -8,6 +8,7 @@ namespace utils {
 
 PyObject* tensor_to_numpy(const at::Tensor& tensor, bool force = false);
 at::Tensor tensor_from_numpy(PyObject* obj, bool warn_if_not_writeable = true);
+at::Tensor tensor_from_numpy_consume(PyObject* obj);
 
 int aten_to_numpy_dtype(const at::ScalarType scalar_type);
 at::ScalarType numpy_dtype_to_aten(int dtype);
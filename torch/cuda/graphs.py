@@ -175,6 +175,152 @@ class graph:
         # returning None should propagate exceptions from either capture_end or stream_ctx.__exit__()
 
 
+def make_graphed_inference_callable(callable, sample_args, num_warmup_iters=3, pool=None):
+    r"""
+    Accepts a callable (function or :class:`nn.Module<torch.nn.Module>`) whose
+    forward pass is replayed from a single CUDA graph, and returns a graphed
+    version suitable for inference loops.
+
+    Unlike :func:`~torch.cuda.make_graphed_callables`, the returned callable
+    records no autograd graph and appends no backward node. It targets
+    latency-sensitive serving loops (for example, per-step decoders) where the
+    same computation runs many times with fresh input values: the capture
+    allocates stable placeholder storages for the inputs and outputs from the
+    graph's memory pool, and each call only copies new argument values into the
+    input placeholders (skipped when an argument already aliases its
+    placeholder) before replaying the graph.
+
+    Arguments:
+        callable (torch.nn.Module or Python function): Callable to graph.
+        sample_args (tuple of Tensors): Sample args for the callable. These
+            tensors become the input placeholders: their shapes, dtypes and
+            memory layouts must match the real per-call arguments.
+        num_warmup_iters (int): The number of warmup iterations. Default: ``3``.
+        pool (optional): Token (returned by :func:`~torch.cuda.graph_pool_handle`
+            or :meth:`other_Graph_instance.pool()<torch.cuda.CUDAGraph.pool>`)
+            hinting this graph's capture may share memory from the specified
+            pool. See :ref:`Graph memory management<graph-memory-management>`.
+
+    .. warning::
+        This API is in beta and may change in future releases.
+
+    .. warning::
+        The returned callable's outputs are the placeholder tensors themselves.
+        They are overwritten by the next call, so callers that need a result to
+        outlive the following step must clone it.
+
+    .. warning::
+        ``sample_args`` must contain only Tensors. Other types are not allowed.
+
+    .. warning::
+        If ``callable`` is an :class:`~torch.nn.Module`, its parameters and
+        buffers are baked into the capture by address. Updating them in place
+        after graphing is visible to replays; reassigning them is not.
+    """
+    flatten_sample_args, _ = _tree_flatten(sample_args)
+    assert all(isinstance(arg, torch.Tensor) for arg in flatten_sample_args), \
+        "In the beta API, sample_args must contain only Tensors. Other types are not allowed."
+
+    fwd_graph = CUDAGraph()
+
+    # Warmup
+    # Hopefully prevents cudnn benchmarking and other lazy-initialization cuda work
+    # from ending up in the capture.
+    torch.cuda.synchronize()
+    with torch.cuda.stream(torch.cuda.Stream()), torch.no_grad():
+        for _ in range(num_warmup_iters):
+            outputs = callable(*sample_args)
+        del outputs
+    torch.cuda.synchronize()
+
+    with torch.no_grad():
+        with graph(fwd_graph, pool=pool):
+            outputs = callable(*sample_args)
+
+    flatten_outputs, output_unflatten_spec = _tree_flatten(outputs)
+    assert all(isinstance(o, torch.Tensor) for o in flatten_outputs), \
+        "In the beta API, the callable must return only Tensors (or nests of Tensors)."
+
+    # The sample args were live during capture, so their storages are stable
+    # for the graph's lifetime and double as the input placeholders.
+    static_inputs = tuple(flatten_sample_args)
+    static_outputs = tuple(flatten_outputs)
+
+    def graphed_inference(*user_args):
+        flatten_user_args, _ = _tree_flatten(user_args)
+        assert len(flatten_user_args) == len(static_inputs), \
+            "Expected {} argument Tensors but got {}".format(len(static_inputs), len(flatten_user_args))
+        for placeholder, arg in zip(static_inputs, flatten_user_args):
+            # don't copy if the caller reused the placeholder itself
+            if placeholder.data_ptr() != arg.data_ptr():
+                placeholder.copy_(arg, non_blocking=True)
+        fwd_graph.replay()
+        return _tree_unflatten(static_outputs, output_unflatten_spec)
+
+    return graphed_inference
+
+
+def make_graphed_step(step_fn, num_warmup_iters=3, pool=None):
+    r"""
+    Wraps a zero-argument callable that updates tensors in place - typically
+    an optimizer step built from foreach ops - so that the whole sequence of
+    kernel launches replays as a single CUDA graph launch.
+
+    A many-parameter optimizer still issues dozens of multi_tensor_apply
+    launches per step. Once the tensor lists are stable across steps the
+    launch pattern is fixed, so the wrapper runs the first
+    ``num_warmup_iters`` calls eagerly on a side stream (keeping lazy
+    initialization out of the capture), captures the next call into a
+    :class:`~torch.cuda.CUDAGraph`, and replays the graph on that and every
+    later call. Each wrapped call performs exactly one update.
+
+    Arguments:
+        step_fn (Python function): Zero-argument callable whose work is pure
+            in-place GPU mutation of a fixed set of tensors.
+        num_warmup_iters (int): The number of eager warmup calls. Default: ``3``.
+        pool (optional): Token (returned by :func:`~torch.cuda.graph_pool_handle`
+            or :meth:`other_Graph_instance.pool()<torch.cuda.CUDAGraph.pool>`)
+            hinting this graph's capture may share memory from the specified
+            pool. See :ref:`Graph memory management<graph-memory-management>`.
+
+    .. warning::
+        This API is in beta and may change in future releases.
+
+    .. warning::
+        ``step_fn`` must be capture-safe: no CPU/GPU syncs (``.item()``,
+        value-dependent control flow) and all state it touches must stay in
+        the same storages across calls. For built-in optimizers that means
+        GPU-resident state, e.g. ``capturable=True`` for Adam/AdamW.
+
+    .. warning::
+        The capture runs under ``torch.no_grad()``; replays do not record
+        autograd history, matching in-place optimizer semantics.
+    """
+    state = {"graph": None, "warmup_calls": 0}
+
+    def graphed_step():
+        if state["graph"] is not None:
+            state["graph"].replay()
+            return
+        if state["warmup_calls"] < num_warmup_iters:
+            state["warmup_calls"] += 1
+            torch.cuda.synchronize()
+            with torch.cuda.stream(torch.cuda.Stream()), torch.no_grad():
+                step_fn()
+            torch.cuda.synchronize()
+            return
+        step_graph = CUDAGraph()
+        with torch.no_grad():
+            with graph(step_graph, pool=pool):
+                step_fn()
+        state["graph"] = step_graph
+        # Capture does not execute, so replay once to keep one-update-per-call
+        # semantics.
+        step_graph.replay()
+
+    return graphed_step
+
+
 def make_graphed_callables(callables, sample_args, num_warmup_iters=3, allow_unused_input=False):
     r"""
     Accepts callables (functions or :class:`nn.Module<torch.nn.Module>`\ s)
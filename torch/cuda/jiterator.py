@@ -49,6 +49,9 @@ class _JittedFunction:
 
         parsed_code = _CodeParser(code_string)
         self.kernel_name = parsed_code.function_name
+        self.num_params = len([
+            param for param in parsed_code.function_params.strip("()").split(",")
+            if param.strip()])
 
         self.kwargs_dict = kwargs
         self.is_cuda_available = torch.cuda.is_available()
@@ -75,6 +78,42 @@ class _JittedFunction:
             tensors,
             expanded_kwargs)
 
+    def prewarm(self, *dtypes: "torch.dtype", **kwargs):
+        """
+        Pre-compile this function's kernels for the given input dtypes on the
+        current device, so the first call doesn't stall on NVRTC compilation.
+
+        Compiles the kernels that would otherwise be built lazily at first
+        invocation, for each dtype. The compiled kernels also land in the
+        on-disk kernel cache (see PYTORCH_KERNEL_CACHE_PATH), so other
+        processes on the same hardware skip compilation entirely.
+
+        Kernels that dynamically cast between mismatched input/output dtypes
+        are not pre-warmed; calls needing them still compile on first use.
+        """
+        assert self.is_cuda_available, "Jiterator is only supported on CUDA and ROCm GPUs, none are available."
+
+        expanded_kwargs = self.kwargs_dict.copy()
+        for key, value in kwargs.items():
+            if key in self.kwargs_dict:
+                expanded_kwargs[key] = value
+            else:
+                raise KeyError(f"{key} is not declared in function definition")
+
+        # Function params are tensor inputs, then (for return-by-ref kernels)
+        # output references, then declared scalar kwargs.
+        num_inputs = self.num_params - len(self.kwargs_dict)
+        if self.return_by_ref:
+            num_inputs -= self.num_outputs
+        torch._C._cuda_jiterator_prewarm_kernel(
+            self.code_string,
+            self.kernel_name,
+            self.return_by_ref,
+            num_inputs,
+            self.num_outputs,
+            dtypes,
+            expanded_kwargs)
+
 
 def _create_jit_fn(code_string: str, **kwargs) -> Callable:
     """
@@ -18,7 +18,8 @@ from torch.types import Device
 from torch import _C
 
 __all__ = ["caching_allocator_alloc", "caching_allocator_delete", "set_per_process_memory_fraction",
-           "empty_cache", "memory_stats", "memory_stats_as_nested_dict", "reset_accumulated_memory_stats",
+           "empty_cache", "memory_stats", "memory_stats_as_nested_dict", "host_memory_stats",
+           "reset_accumulated_memory_stats",
            "reset_peak_memory_stats", "reset_max_memory_allocated", "reset_max_memory_cached",
            "memory_allocated", "max_memory_allocated", "memory_reserved", "max_memory_reserved",
            "memory_cached", "max_memory_cached", "memory_snapshot", "memory_summary", "list_gpu_processes",
@@ -246,6 +247,30 @@ def memory_stats_as_nested_dict(device: Union[Device, int] = None) -> Dict[str,
     return torch._C._cuda_memoryStats(device)
 
 
+def host_memory_stats() -> Dict[str, Any]:
+    r"""Returns a dictionary of statistics for the pinned (page-locked) host
+    memory cache backing :meth:`~torch.Tensor.pin_memory`.
+
+    The caching host allocator rounds every allocation up to a power of two,
+    so blocks fall into power-of-two size classes. The result contains:
+
+    - ``"allocated_bytes"``: pinned bytes currently handed out to clients.
+    - ``"cached_bytes"``: pinned bytes held idle on the free list.
+    - ``"num_host_alloc"`` / ``"num_host_free"``: lifetime counts of
+      ``cudaHostAlloc`` / ``cudaFreeHost`` calls.
+    - ``"size_classes"``: a per-size-class breakdown of the above, one dict
+      per class that has seen traffic.
+
+    .. note::
+        See :ref:`cuda-memory-management` for details about GPU memory
+        management; this function covers the host-side (CPU) pinned memory
+        cache, which is process-wide rather than per-device.
+    """
+    if not is_initialized():
+        return {}
+    return torch._C._cuda_hostMemoryStats()
+
+
 def reset_accumulated_memory_stats(device: Union[Device, int] = None) -> None:
     r"""Resets the "accumulated" (historical) stats tracked by the CUDA memory allocator.
 
@@ -711,6 +736,52 @@ def _dump_snapshot(filename='snapshot_dump', device: Union[Device, int] = None):
         f.write(segment_plot(s))
 
 
+def _snapshot_diff(before, after):
+    """Compares two snapshots from :func:`torch.cuda.memory._snapshot`.
+
+    Segments are matched by ``(device, address)``. Returns a dict with:
+
+    - ``segments_added``/``segments_removed``: segment dicts present in only
+      one of the snapshots (i.e. cudaMalloc/cudaFree happened in between).
+    - ``segments_changed``: ``(before, after)`` pairs of segment dicts whose
+      allocated or active bytes changed.
+    - ``delta``: net change in ``reserved``, ``allocated`` and ``active``
+      bytes between the two snapshots.
+
+    This only compares allocator state; use ``device_traces`` (recorded via
+    :func:`torch.cuda.memory._record_memory_history`) for the event history
+    between the two snapshots.
+    """
+    def _by_addr(snapshot):
+        return {(seg["device"], seg["address"]): seg for seg in snapshot["segments"]}
+
+    before_segments = _by_addr(before)
+    after_segments = _by_addr(after)
+
+    segments_added = [seg for key, seg in after_segments.items() if key not in before_segments]
+    segments_removed = [seg for key, seg in before_segments.items() if key not in after_segments]
+    segments_changed = [
+        (before_segments[key], seg) for key, seg in after_segments.items()
+        if key in before_segments and (
+            seg["allocated_size"] != before_segments[key]["allocated_size"]
+            or seg["active_size"] != before_segments[key]["active_size"])
+    ]
+
+    def _total(snapshot, field):
+        return sum(seg[field] for seg in snapshot["segments"])
+
+    return {
+        "segments_added": segments_added,
+        "segments_removed": segments_removed,
+        "segments_changed": segments_changed,
+        "delta": {
+            "reserved": _total(after, "total_size") - _total(before, "total_size"),
+            "allocated": _total(after, "allocated_size") - _total(before, "allocated_size"),
+            "active": _total(after, "active_size") - _total(before, "active_size"),
+        },
+    }
+
+
 def _save_segment_usage(filename='output.svg', snapshot=None):
     if snapshot is None:
         snapshot = _snapshot()
@@ -0,0 +1,217 @@
+"""Preregistered CUDA memory-pool transport for same-node processes.
+
+The regular CUDA sharing path (see ``reductions.py``) creates an IPC
+memory handle per shared storage and tracks it with cross-process
+reference counting, which is the right default but adds per-message
+cost and cleanup jitter when two processes exchange tensors at high
+rate.  :class:`CudaIPCPool` amortizes all of that to connection setup:
+the producer allocates one persistent device pool and a small control
+ring in CPU shared memory, the consumer maps both exactly once, and
+every message afterwards is a device-to-device copy into a pool slot
+plus an offset/metadata handoff through the ring -- no new IPC handles,
+no allocations, no ref-count traffic.
+
+The ring is single-producer/single-consumer: one process calls
+:meth:`CudaIPCPool.send`, the process that unpickled the endpoint calls
+:meth:`CudaIPCPoolEndpoint.recv`.  Synchronization between the
+producer's copy and the consumer's read uses one preallocated
+interprocess CUDA event per slot.
+
+Usage::
+
+    # producer process
+    pool = CudaIPCPool(device='cuda:0', slot_bytes=1 << 20, num_slots=16)
+    queue.put(pool.endpoint())  # one-time setup cost
+    for step in range(...):
+        pool.send(activation)
+
+    # consumer process
+    endpoint = queue.get()
+    for step in range(...):
+        activation = endpoint.recv()
+"""
+
+import time
+
+import torch
+
+__all__ = ["CudaIPCPool", "CudaIPCPoolEndpoint"]
+
+# ring slot layout, in int64 words
+_SLOT_DTYPE = 0
+_SLOT_NDIM = 1
+_SLOT_SHAPE = 2
+_MAX_DIMS = 8
+_SLOT_WORDS = _SLOT_SHAPE + _MAX_DIMS
+# ring header layout
+_HEAD = 0  # messages published by the producer
+_TAIL = 1  # messages consumed
+_HEADER_WORDS = 2
+
+_SUPPORTED_DTYPES = [
+    torch.float32,
+    torch.float64,
+    torch.float16,
+    torch.bfloat16,
+    torch.int64,
+    torch.int32,
+    torch.int16,
+    torch.int8,
+    torch.uint8,
+    torch.bool,
+]
+_DTYPE_TO_CODE = {dtype: code for code, dtype in enumerate(_SUPPORTED_DTYPES)}
+
+
+def _spin_until(predicate, timeout, what):
+    start = time.monotonic()
+    while not predicate():
+        if timeout is not None and time.monotonic() - start > timeout:
+            raise RuntimeError(f"CudaIPCPool: timed out waiting for {what}")
+        time.sleep(0)
+
+
+class CudaIPCPool:
+    """Producer half of the pool transport; see the module docstring."""
+
+    def __init__(self, device, slot_bytes=1 << 20, num_slots=16):
+        self._device = torch.device(device)
+        if self._device.type != "cuda":
+            raise ValueError(
+                f"CudaIPCPool expects a CUDA device, got {self._device}"
+            )
+        if slot_bytes % 256 != 0:
+            # keeps every slot aligned well enough to view as any dtype
+            raise ValueError("slot_bytes must be a multiple of 256")
+        self._slot_bytes = slot_bytes
+        self._num_slots = num_slots
+        with torch.cuda.device(self._device):
+            self._pool = torch.empty(
+                slot_bytes * num_slots, dtype=torch.uint8, device=self._device
+            )
+            self._events = [
+                torch.cuda.Event(interprocess=True) for _ in range(num_slots)
+            ]
+            # event handles can only be exported once the event exists on
+            # the driver side, which recording guarantees
+            for event in self._events:
+                event.record()
+            torch.cuda.current_stream().synchronize()
+        self._ring = torch.zeros(
+            _HEADER_WORDS + _SLOT_WORDS * num_slots, dtype=torch.int64
+        ).share_memory_()
+
+    def endpoint(self):
+        """Returns the picklable consumer endpoint.
+
+        Send it to the peer process once (e.g. through a
+        :class:`torch.multiprocessing` queue); unpickling maps the pool
+        and the ring into the peer.
+        """
+        return CudaIPCPoolEndpoint(
+            self._pool,
+            self._ring,
+            [event.ipc_handle() for event in self._events],
+            self._device.index,
+            self._slot_bytes,
+            self._num_slots,
+        )
+
+    def send(self, tensor, timeout=None):
+        """Copies ``tensor`` into the next pool slot and publishes it.
+
+        Blocks (spinning) while the ring is full.  The copy runs on the
+        current stream; the consumer orders its read after it through
+        the slot's interprocess event.
+        """
+        if tensor.device != self._device:
+            raise ValueError(
+                f"expected a tensor on {self._device}, got {tensor.device}"
+            )
+        if tensor.dtype not in _DTYPE_TO_CODE:
+            raise ValueError(f"unsupported dtype {tensor.dtype}")
+        if tensor.dim() > _MAX_DIMS:
+            raise ValueError(f"at most {_MAX_DIMS} dimensions supported")
+        nbytes = tensor.numel() * tensor.element_size()
+        if nbytes > self._slot_bytes:
+            raise ValueError(
+                f"tensor of {nbytes} bytes does not fit a {self._slot_bytes}"
+                " byte slot"
+            )
+        ring = self._ring
+        _spin_until(
+            lambda: ring[_HEAD].item() - ring[_TAIL].item() < self._num_slots,
+            timeout,
+            "a free slot",
+        )
+        seq = int(ring[_HEAD].item())
+        slot = seq % self._num_slots
+        region = self._pool.narrow(0, slot * self._slot_bytes, nbytes)
+        region.view(tensor.dtype).copy_(tensor.reshape(-1))
+        self._events[slot].record()
+        base = _HEADER_WORDS + _SLOT_WORDS * slot
+        ring[base + _SLOT_DTYPE] = _DTYPE_TO_CODE[tensor.dtype]
+        ring[base + _SLOT_NDIM] = tensor.dim()
+        for d in range(tensor.dim()):
+            ring[base + _SLOT_SHAPE + d] = tensor.size(d)
+        # publishing the head is the last store, so a consumer that sees
+        # it also sees the slot metadata written above
+        ring[_HEAD] = seq + 1
+
+
+class CudaIPCPoolEndpoint:
+    """Consumer half of the pool transport; see the module docstring.
+
+    Constructed by :meth:`CudaIPCPool.endpoint` and mapped into the
+    consumer process by pickling -- the pool tensor travels through the
+    regular CUDA IPC reducer (once) and the ring through CPU shared
+    memory.
+    """
+
+    def __init__(self, pool, ring, event_handles, device_index, slot_bytes, num_slots):
+        self._pool = pool
+        self._ring = ring
+        self._event_handles = event_handles
+        self._device_index = device_index
+        self._slot_bytes = slot_bytes
+        self._num_slots = num_slots
+        self._events = [None] * num_slots
+
+    def _event(self, slot):
+        if self._events[slot] is None:
+            self._events[slot] = torch.cuda.Event.from_ipc_handle(
+                self._device_index, self._event_handles[slot]
+            )
+        return self._events[slot]
+
+    def recv(self, timeout=None):
+        """Returns a copy of the next published tensor.
+
+        Blocks (spinning) until a message is available.  The slot is
+        only recycled once the copy out of it has finished, so the
+        returned tensor is safe to use indefinitely.
+        """
+        ring = self._ring
+        _spin_until(
+            lambda: ring[_HEAD].item() > ring[_TAIL].item(),
+            timeout,
+            "a message",
+        )
+        seq = int(ring[_TAIL].item())
+        slot = seq % self._num_slots
+        base = _HEADER_WORDS + _SLOT_WORDS * slot
+        dtype = _SUPPORTED_DTYPES[int(ring[base + _SLOT_DTYPE].item())]
+        ndim = int(ring[base + _SLOT_NDIM].item())
+        shape = [int(ring[base + _SLOT_SHAPE + d].item()) for d in range(ndim)]
+        numel = 1
+        for s in shape:
+            numel *= s
+        nbytes = numel * torch.empty((), dtype=dtype).element_size()
+        self._event(slot).wait()  # order the read after the producer's copy
+        region = self._pool.narrow(0, slot * self._slot_bytes, nbytes)
+        result = region.view(dtype).reshape(shape).clone()
+        # the producer may overwrite the slot as soon as the tail moves,
+        # so the copy must have completed on the device first
+        torch.cuda.current_stream(self._device_index).synchronize()
+        ring[_TAIL] = seq + 1
+        return result
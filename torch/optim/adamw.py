@@ -58,10 +58,10 @@ class AdamW(Optimizer):
             # higher prec copy of params to do update math in higher prec to
             # alleviate the loss of information.
             if not all(
-                p.is_cuda and torch.is_floating_point(p)
+                p.device.type in ("cpu", "cuda") and torch.is_floating_point(p)
                 for pg in self.param_groups for p in pg['params']
             ):
-                raise RuntimeError("`fused=True` requires all the params to be CUDA, floating point Tensor")
+                raise RuntimeError("`fused=True` requires all the params to be floating point Tensors on CPU or CUDA")
             if foreach:
                 raise RuntimeError("`fused` and `foreach` cannot be `True` together.")
 
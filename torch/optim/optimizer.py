@@ -81,7 +81,7 @@ _foreach_doc = r"""foreach (bool, optional): whether foreach implementation of o
             foreach over the for-loop implementation on CUDA, since it is usually
             significantly more performant. (default: None)"""
 
-_fused_doc = r"""fused (bool, optional): whether the fused implementation (CUDA only) is used.
+_fused_doc = r"""fused (bool, optional): whether the fused implementation (CPU or CUDA) is used.
             Currently, `torch.float64`, `torch.float32`, `torch.float16`, and `torch.bfloat16`
             are supported. (default: None)
 
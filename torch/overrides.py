@@ -105,6 +105,7 @@ def get_ignored_functions() -> Set[Callable]:
         torch.wait,
         torch.as_tensor,
         torch.from_numpy,
+        torch._from_numpy_consume,
         torch.get_device,
         torch.tensor,
         torch.default_generator,
@@ -299,6 +300,7 @@ def get_ignored_functions() -> Set[Callable]:
         Tensor._is_zerotensor,
         Tensor._is_all_true,
         Tensor._is_any_true,
+        Tensor._lazy_clone,
         Tensor._addmm_activation,
         Tensor.to_padded_tensor,
     }
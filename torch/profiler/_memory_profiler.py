@@ -200,6 +200,18 @@ def get_scopes(event: Optional[_ProfilerEvent]) -> Tuple[RecordScope, ...]:
     return tuple(scopes)
 
 
+def format_stack(event: Optional[_ProfilerEvent]) -> Tuple[str, ...]:
+    """Render the merged Python and C++ caller stack of an event, outermost
+    frame first. Python frames come from the python_tracer (PyCall / PyCCall
+    events interleave with TorchOps in the op tree), so with_stack=True
+    attributes allocations to the owning module and not just the active op."""
+    stack = []
+    while event:
+        stack.append(event.name)
+        event = event.parent
+    return tuple(reversed(stack))
+
+
 class SchemaMatcher:
     """Lookup operator schema based on profiled name.
 
@@ -699,6 +711,17 @@ class MemoryProfile:
             for time, action, (key, version) in events
         )
 
+    @property
+    def allocation_stacks(self) -> Dict[TensorKey, Tuple[str, ...]]:
+        """Merged Python + C++ stack under which each tensor was allocated,
+        keyed by TensorKey. Tensors that predate profiling have no stack."""
+        stacks: Dict[TensorKey, Tuple[str, ...]] = {}
+        for node in self._data_flow_graph.flow_nodes:
+            for key, edge in node._edges.items():
+                if edge.is_allocation and key not in stacks:
+                    stacks[key] = format_stack(node._event)
+        return stacks
+
     def _is_gradient(self, *args, **kwargs) -> bool:
         return self._categories.get(*args, **kwargs) == Category.GRADIENT
 
@@ -946,9 +969,11 @@ class MemoryProfileTimeline:
         elements, to denote any actions (pre-existing, create, destroy,
         or increment_version) that occurred to a specific Tensor for a
         chunk of memory. The categories help map each (TensorKey,
-        version) pair into a category."""
+        version) pair into a category. The stacks map each TensorKey to
+        the merged Python + C++ stack its allocation was made under."""
         self.timeline = memory_profile.timeline
         self.categories = memory_profile._categories
+        self.stacks = memory_profile.allocation_stacks
 
     def _coalesce_timeline(self, device_str):
         """Convert the memory timeline and categories into a memory plot
@@ -1016,6 +1041,47 @@ class MemoryProfileTimeline:
         with open(path, 'w') as f:
             json.dump([times, sizes], f)
 
+    def export_memory_timeline_raw(self, path, device_str) -> None:
+        """Saves the raw memory events for the given device as a compact
+        JSON dict of the form
+
+            {"elements": [[timestamp, action, numbytes, category, stack_id],
+                          ...],
+             "stacks": [[frame, ...], ...]}
+
+        where action and category are enum indices (category -1 for unknown)
+        and stack_id indexes into the deduplicated "stacks" table of merged
+        Python + C++ allocation stacks (-1 when no stack was recorded, e.g.
+        for tensors that predate profiling). Unlike export_memory_timeline,
+        this keeps per-allocation attribution, so peak memory can be broken
+        down by owning module offline."""
+        device = torch.device(device_str)
+        stack_table: List[Tuple[str, ...]] = []
+        stack_ids: Dict[Tuple[str, ...], int] = {}
+        elements = []
+        for t, action, (key, version), numbytes in self.timeline:
+            if not isinstance(key, TensorKey) or key.device != device:
+                continue
+            category = self.categories.get(key, version)
+            stack = self.stacks.get(key)
+            if stack is None:
+                stack_id = -1
+            else:
+                stack_id = stack_ids.setdefault(stack, len(stack_table))
+                if stack_id == len(stack_table):
+                    stack_table.append(stack)
+            elements.append([
+                t,
+                action.value,
+                numbytes,
+                -1 if category is None else category.value,
+                stack_id,
+            ])
+
+        import json
+        with open(path, 'w') as f:
+            json.dump({"elements": elements, "stacks": stack_table}, f)
+
     def export_memory_timeline_html(self, path, device, figsize=(20, 12), title=None) -> None:
         """Exports the memory timeline as an HTML file which contains
         the memory timeline plot embedded as a PNG file."""
@@ -247,6 +247,11 @@ class _KinetoProfile:
         are memory usage for each category. The memory timeline plot will
         be saved a JSON (by default) or gzipped JSON.
 
+        If the path ends with ``raw.json.gz``, raw memory events with
+        per-allocation stack attribution are exported instead (see
+        ``MemoryProfileTimeline.export_memory_timeline_raw``), which keeps
+        enough information to break peak memory down by owning module.
+
         Input: (path of file, device)
         Output: File written as JSON or gzipped JSON
         """
@@ -264,7 +269,10 @@ class _KinetoProfile:
         elif path.endswith('.gz'):
             fp = tempfile.NamedTemporaryFile('w+t', suffix='.json', delete=False)
             fp.close()
-            self.mem_tl.export_memory_timeline(fp.name, device)
+            if path.endswith('raw.json.gz'):
+                self.mem_tl.export_memory_timeline_raw(fp.name, device)
+            else:
+                self.mem_tl.export_memory_timeline(fp.name, device)
             with open(fp.name) as fin:
                 with gzip.open(path, 'wt') as fout:
                     fout.writelines(fin)
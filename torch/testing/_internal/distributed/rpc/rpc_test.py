@@ -2715,6 +2715,44 @@ class RpcTest(RpcAgentTestFixture, RpcTestCommon):
         )
         self.assertEqual(rref.to_here(), my_function(n, n + 1, n + 2))
 
+    @dist_init
+    def test_rref_to_here_all(self):
+        n = self.rank + 1
+        dst_rank = n % self.world_size
+        # Builtin-op rrefs are fetched in one message per owner; the Python
+        # UDF rref exercises the per-rref fallback.
+        rrefs = [
+            rpc.remote(
+                worker_name(dst_rank),
+                torch.add,
+                args=(torch.ones(n, n), i),
+            )
+            for i in range(3)
+        ]
+        rrefs.append(
+            rpc.remote(worker_name(dst_rank), my_function, args=(n, n + 1, n + 2))
+        )
+        values = torch._C._distributed_rpc._rref_to_here_all(rrefs)
+        for i in range(3):
+            self.assertEqual(values[i], torch.ones(n, n) + i)
+        self.assertEqual(values[3], my_function(n, n + 1, n + 2))
+
+    @dist_init
+    def test_rref_value_cache_ttl(self):
+        n = self.rank + 1
+        dst_rank = n % self.world_size
+        rref = rpc.remote(
+            worker_name(dst_rank), torch.add, args=(torch.ones(n, n), 1)
+        )
+        rref._set_value_cache_ttl(60)
+        expected = torch.ones(n, n) + 1
+        self.assertEqual(rref.to_here(), expected)
+        # Served from the local copy; still returns the same value.
+        self.assertEqual(rref.to_here(), expected)
+        # Disabling caching drops the copy and fetches again.
+        rref._set_value_cache_ttl(0)
+        self.assertEqual(rref.to_here(), expected)
+
     @staticmethod
     def _multi_kwargs_fn(n, sparse=False):
         if sparse:
@@ -6,6 +6,27 @@ from ._crash_handler import enable_minidumps, disable_minidumps, enable_minidump
 from .cpp_backtrace import get_cpp_backtrace
 from .backend_registration import rename_privateuse1_backend, generate_methods_for_privateuse1_backend
 
+def pin_module_to_numa_node(module, numa_node):
+    r"""Pin the memory of a module's parameters and buffers to a NUMA node.
+
+    Moves the pages backing each CPU parameter and buffer of ``module`` to
+    ``numa_node`` and makes future CPU allocations from the calling thread
+    prefer that node, so intermediate tensors created while running the
+    module stay local to the thread pool that executes it. Call this from
+    the thread (pool) that will run inference on ``module``.
+
+    This is a no-op unless PyTorch was built with NUMA support and the
+    ``caffe2_cpu_numa_enabled`` flag is set.
+    """
+    if not torch._C._numa_enabled():
+        return
+    torch._C._set_alloc_numa_node(numa_node)
+    import itertools
+    for tensor in itertools.chain(module.parameters(), module.buffers()):
+        if tensor.device.type == 'cpu':
+            torch._C._numa_move_tensor(tensor, numa_node)
+
+
 # Set the module for a given object for nicer printing
 def set_module(obj, mod):
     if not isinstance(mod, str):
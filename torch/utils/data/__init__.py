@@ -32,6 +32,7 @@ from torch.utils.data.dataloader import (
     default_convert,
 )
 from torch.utils.data.distributed import DistributedSampler
+from torch.utils.data._utils.shared_memory import mark_shareable
 from torch.utils.data.datapipes._decorator import (
     argument_validation,
     functional_datapipe,
@@ -67,6 +68,7 @@ __all__ = ['BatchSampler',
            'functional_datapipe',
            'get_worker_info',
            'guaranteed_datapipes_determinism',
+           'mark_shareable',
            'non_deterministic',
            'random_split',
            'runtime_validation',
@@ -0,0 +1,101 @@
+r"""Automatic fork-safe sharing of dataset tensors across DataLoader workers.
+
+Datasets holding large lookup tensors get replicated into every worker:
+under the ``spawn`` start method the dataset is pickled per worker, and
+even under ``fork`` a worker that mutates an inherited tensor silently
+writes through shared-memory storage into its siblings and the parent.
+This module lets users mark such tensors shareable; the DataLoader then
+
+1. moves marked tensors to shared-memory storage *before* workers start,
+   so children inherit the mapping zero-copy instead of receiving a
+   pickled replica, and
+2. wraps those storages in a copy-on-write alias inside each worker, so
+   the first in-worker write materializes a private copy instead of
+   mutating memory shared with other processes.
+
+Only CPU tensors can be shared this way; marking a CUDA tensor is an
+error at sharing time, matching ``Tensor.share_memory_``.
+"""
+
+import torch
+
+__all__ = ["mark_shareable", "share_marked_tensors", "protect_shared_tensors"]
+
+_SHAREABLE_ATTR = "_torch_data_shareable"
+
+# Copy-on-write guard storages created by protect_shared_tensors. Each one
+# keeps its context's refcount above one for the life of the worker, so a
+# write to the dataset tensor always materializes a private copy rather
+# than stealing the shared mapping back.
+_cow_guards = []
+
+
+def mark_shareable(tensor):
+    r"""Marks a tensor so the DataLoader shares its storage across workers.
+
+    Marked tensors are moved to shared memory before worker processes
+    start and are protected copy-on-write inside each worker; see the
+    module docstring. Returns the tensor for chaining.
+    """
+    if not isinstance(tensor, torch.Tensor):
+        raise TypeError(
+            f"mark_shareable expects a Tensor, but got {type(tensor).__name__}")
+    setattr(tensor, _SHAREABLE_ATTR, True)
+    return tensor
+
+
+def _marked_tensors(obj, memo):
+    # Walks the object graph the way the pickler would reach it: container
+    # elements, dict values and instance attributes. Yields marked tensors.
+    if id(obj) in memo:
+        return
+    memo.add(id(obj))
+    if isinstance(obj, torch.Tensor):
+        if getattr(obj, _SHAREABLE_ATTR, False):
+            yield obj
+        return
+    if isinstance(obj, dict):
+        values = obj.values()
+    elif isinstance(obj, (list, tuple, set, frozenset)):
+        values = obj
+    elif hasattr(obj, "__dict__"):
+        values = vars(obj).values()
+    else:
+        return
+    for value in values:
+        yield from _marked_tensors(value, memo)
+
+
+def share_marked_tensors(obj):
+    r"""Moves every marked tensor reachable from `obj` to shared memory.
+
+    Called by the DataLoader on the dataset before worker processes are
+    created. Returns the number of tensors shared.
+    """
+    count = 0
+    for tensor in _marked_tensors(obj, set()):
+        if not tensor.is_shared():
+            tensor.share_memory_()
+        count += 1
+    return count
+
+
+def protect_shared_tensors(obj):
+    r"""Wraps marked shared tensors in copy-on-write storage.
+
+    Called in each worker process after it starts. Afterwards, reads
+    still go to the inherited shared mapping, but the first write to a
+    protected tensor copies its storage private to the worker instead of
+    mutating memory shared with the parent and sibling workers. Returns
+    the number of tensors protected.
+    """
+    count = 0
+    for tensor in _marked_tensors(obj, set()):
+        storage = tensor.untyped_storage()
+        if not tensor.is_shared():
+            # Not actually in shared memory (e.g. the dataset was rebuilt
+            # by worker_init_fn); a write is already private.
+            continue
+        _cow_guards.append(storage._new_cow_alias_cpu())
+        count += 1
+    return count
@@ -246,6 +246,12 @@ def _worker_loop(dataset_kind, dataset, index_queue, data_queue, done_event,
         init_exception = None
 
         try:
+            # Protect inherited shared-memory tensors copy-on-write before
+            # any user code can write to them; see
+            # torch/utils/data/_utils/shared_memory.py.
+            from . import shared_memory
+            shared_memory.protect_shared_tensors(dataset)
+
             if init_fn is not None:
                 init_fn(worker_id)
 
@@ -1011,6 +1011,11 @@ class _MultiProcessingDataLoaderIter(_BaseDataLoaderIter):
             self._worker_init_fn = functools.partial(
                 _sharding_worker_init_fn, self._worker_init_fn, self._world_size, self._rank)
 
+        # Move tensors marked with torch.utils.data.mark_shareable to
+        # shared memory before any worker exists, so every worker inherits
+        # one mapping zero-copy instead of receiving a pickled replica.
+        _utils.shared_memory.share_marked_tensors(self._dataset)
+
         # No certainty which module multiprocessing_context is
         self._worker_result_queue = multiprocessing_context.Queue()  # type: ignore[var-annotated]
         self._worker_pids_set = False
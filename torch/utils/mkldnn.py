@@ -1,3 +1,5 @@
+from typing import Optional
+
 import torch
 
 
@@ -33,6 +35,52 @@ class MkldnnLinear(torch.jit.ScriptModule):
         return y
 
 
+class MkldnnPrepackedLinear(torch.jit.ScriptModule):
+    """nn.Linear replacement that keeps the weight in oneDNN's blocked layout.
+
+    Unlike MkldnnLinear, inputs and outputs stay dense, so a single hot Linear
+    can be swapped without converting the rest of the model to the MKLDNN
+    layout. The weight is reordered once at construction time, which avoids
+    oneDNN's per-call weight repack. For ``dtype=torch.bfloat16`` the input is
+    expected to be bfloat16 as well. When the leading input dimensions are
+    fixed, pass their product as ``batch_size`` so the layout can be chosen
+    for that shape.
+    """
+    def __init__(self, dense_module, dtype, batch_size=None):
+        super().__init__()
+        self.batch_size = -1 if batch_size is None else batch_size
+        self.register_buffer(
+            'weight',
+            torch.ops.mkldnn._reorder_linear_weight(
+                dense_module.weight.to_mkldnn(dtype), batch_size))
+        if dense_module.bias is not None:
+            # Bias stays dense and fp32; see the accuracy note in MkldnnLinear.
+            self.register_buffer('bias', dense_module.bias.detach().float())
+        else:
+            # TODO: Remove this once ScriptModule supports registering None buffer
+            self.register_buffer(
+                'bias',
+                torch.zeros([dense_module.weight.size(0)], dtype=torch.float))
+
+    @torch.jit.script_method
+    def __getstate__(self):
+        return (self.weight.to_dense(), self.bias, self.batch_size, self.training)
+
+    @torch.jit.script_method
+    def __setstate__(self, state):
+        batch_size: Optional[int] = None if state[2] == -1 else state[2]
+        self.weight = torch.ops.mkldnn._reorder_linear_weight(
+            state[0].to_mkldnn(), batch_size)
+        self.bias = state[1]
+        self.batch_size = state[2]
+        self.training = state[3]
+
+    @torch.jit.script_method
+    def forward(self, x):
+        return torch.ops.mkldnn._linear_pointwise(
+            x, self.weight, self.bias, "none", [], None)
+
+
 class _MkldnnConvNd(torch.jit.ScriptModule):
     """Common base of MkldnnConv1d and MkldnnConv2d"""
     __constants__ = ['stride', 'padding', 'dilation', 'groups']
@@ -95,10 +143,20 @@ class MkldnnConv2d(_MkldnnConvNd):
             self.dilation,
             self.groups))
 
+    @torch.jit.script_method
+    def __getstate__(self):
+        # Also save the prepacked blob and a oneDNN build/ISA fingerprint so
+        # deserialization can skip the weight reorder when they still match.
+        return (self.weight.to_dense(), self.bias.to_dense(), self.training,
+                torch.ops.mkldnn._export_weight_pack(self.weight),
+                torch.ops.mkldnn._weight_pack_fingerprint())
+
     @torch.jit.script_method
     def __setstate__(self, state):
-        self.weight = torch._C._nn.mkldnn_reorder_conv2d_weight(
+        self.weight = torch.ops.mkldnn._rehydrate_conv2d_weight_pack(
             state[0].to_mkldnn(),
+            state[3],
+            state[4],
             self.padding,
             self.stride,
             self.dilation,
@@ -117,10 +175,18 @@ class MkldnnConv3d(_MkldnnConvNd):
             self.dilation,
             self.groups))
 
+    @torch.jit.script_method
+    def __getstate__(self):
+        return (self.weight.to_dense(), self.bias.to_dense(), self.training,
+                torch.ops.mkldnn._export_weight_pack(self.weight),
+                torch.ops.mkldnn._weight_pack_fingerprint())
+
     @torch.jit.script_method
     def __setstate__(self, state):
-        self.weight = torch._C._nn.mkldnn_reorder_conv3d_weight(
+        self.weight = torch.ops.mkldnn._rehydrate_conv3d_weight_pack(
             state[0].to_mkldnn(),
+            state[3],
+            state[4],
             self.padding,
             self.stride,
             self.dilation,
@@ -230,3 +296,25 @@ def to_mkldnn(module, dtype=torch.float):
         return new_m
 
     return m_fn_rec(module, dtype)
+
+
+def prepack_linear(module, dtype=torch.float, batch_size=None):
+    """Replaces every nn.Linear in `module` with MkldnnPrepackedLinear.
+
+    Inputs and outputs of the converted modules stay dense, so this is an
+    opt-in way to eliminate per-call weight repacking in eager mode without
+    converting the surrounding model to the MKLDNN layout. Inference only;
+    the prepacked weight does not support autograd.
+    """
+    assert dtype in [torch.float, torch.bfloat16], \
+        "MKLDNN only support float or bfloat16 path now"
+
+    def m_fn_rec(m):
+        new_m = m
+        if isinstance(m, torch.nn.Linear):
+            new_m = MkldnnPrepackedLinear(m, dtype, batch_size)
+        for name, sub_m in m.named_children():
+            setattr(new_m, name, m_fn_rec(sub_m))
+        return new_m
+
+    return m_fn_rec(module)
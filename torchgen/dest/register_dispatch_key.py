@@ -150,6 +150,14 @@ void resize_out(const Tensor &out, IntArrayRef sizes, IntArrayRef strides, const
       "Expected out tensor to have dtype ", options.dtype(), ", but got ", out.dtype(), " instead");
   TORCH_CHECK(options.device() == out.device(),
       "Expected out tensor to have device ", options.device(), ", but got ", out.device(), " instead");
+  // Fast path: an out tensor whose sizes already match needs neither a
+  // resize nor a restride (preexisting strides are authoritative, see
+  // below), so skip the resize_output machinery with a single compare.
+  // Hot for out= ops called in a loop with correctly-sized outputs, e.g.
+  // foreach-style optimizer steps.
+  if (out.sizes() == sizes) {
+    return;
+  }
   const bool resized = at::native::resize_output(out, sizes);
   // Only restride if a resize occurred; otherwise we ignore the (advisory)
   // strides from the meta function and directly use the output tensor's
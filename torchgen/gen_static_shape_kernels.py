@@ -0,0 +1,271 @@
+import argparse
+import os
+from dataclasses import dataclass
+from typing import Any, Dict, List, Sequence, Tuple
+
+import yaml
+
+from torchgen.code_template import CodeTemplate
+from torchgen.yaml_utils import YamlLoader
+
+# Generates kernels that are fully specialized for a fixed set of
+# operator/shape/dtype combinations, for deployments that run a small,
+# known-in-advance workload (e.g. a single exported edge model).
+#
+# The input is a shape manifest, a yaml list of entries like
+#
+#   - op: add.Tensor
+#     dtype: float32
+#     shape: [8, 128]
+#
+# For every entry we emit a kernel whose sizes and element count are
+# constexpr, whose loop runs over contiguous data with no stride
+# arithmetic, and which the compiler can unroll and vectorize for the
+# exact trip count.  Each kernel is registered for the CPU dispatch key
+# through TORCH_LIBRARY_IMPL in its own translation unit, so linking the
+# generated file into the binary overrides the stock kernel.  Dispatch
+# keys cannot see shapes, so the generated wrapper guards on
+# shape/dtype/contiguity itself and falls back to the direct at::cpu::
+# entry point (no dispatcher round trip) when the guard fails.
+#
+# Only operators this generator knows how to specialize may appear in
+# the manifest; the menu is deliberately small and elementwise-only,
+# since those are the kernels where constexpr trip counts pay off and
+# where a scalar expression fully describes the semantics.
+
+
+@dataclass(frozen=True)
+class SupportedOp:
+    # operator name as registered with the dispatcher, e.g. "add.Tensor"
+    name: str
+    # number of tensor inputs
+    arity: int
+    # whether the signature carries a trailing at::Scalar alpha
+    has_alpha: bool
+    # scalar computation, in terms of a (, b) and alpha_v
+    expr: str
+
+
+_SUPPORTED_OPS: Dict[str, SupportedOp] = {
+    op.name: op
+    for op in [
+        SupportedOp("add.Tensor", 2, True, "a[i] + alpha_v * b[i]"),
+        SupportedOp("sub.Tensor", 2, True, "a[i] - alpha_v * b[i]"),
+        SupportedOp("mul.Tensor", 2, False, "a[i] * b[i]"),
+        SupportedOp("div.Tensor", 2, False, "a[i] / b[i]"),
+        SupportedOp("relu", 1, False, "a[i] > scalar_t(0) ? a[i] : scalar_t(0)"),
+        SupportedOp("sigmoid", 1, False, "scalar_t(1) / (scalar_t(1) + std::exp(-a[i]))"),
+        SupportedOp("tanh", 1, False, "std::tanh(a[i])"),
+    ]
+}
+
+_SUPPORTED_DTYPES: Dict[str, Tuple[str, str]] = {
+    # manifest name -> (c++ type, at::ScalarType enumerator)
+    "float32": ("float", "at::kFloat"),
+    "float64": ("double", "at::kDouble"),
+}
+
+
+@dataclass(frozen=True)
+class ManifestEntry:
+    op: SupportedOp
+    cpp_type: str
+    scalar_type: str
+    shape: Tuple[int, ...]
+
+
+def parse_manifest(manifest: Any) -> List[ManifestEntry]:
+    assert isinstance(manifest, list), "shape manifest must be a yaml list"
+    entries = []
+    for e in manifest:
+        assert isinstance(e, dict) and set(e.keys()) == {"op", "dtype", "shape"}, (
+            f"manifest entries must have exactly op/dtype/shape keys, got {e}"
+        )
+        assert e["op"] in _SUPPORTED_OPS, (
+            f'operator "{e["op"]}" cannot be shape-specialized; '
+            f"supported: {sorted(_SUPPORTED_OPS.keys())}"
+        )
+        assert e["dtype"] in _SUPPORTED_DTYPES, (
+            f'dtype "{e["dtype"]}" cannot be shape-specialized; '
+            f"supported: {sorted(_SUPPORTED_DTYPES.keys())}"
+        )
+        shape = tuple(e["shape"])
+        assert len(shape) > 0 and all(
+            isinstance(d, int) and d > 0 for d in shape
+        ), f"shape must be a non-empty list of positive ints, got {e['shape']}"
+        cpp_type, scalar_type = _SUPPORTED_DTYPES[e["dtype"]]
+        entries.append(ManifestEntry(_SUPPORTED_OPS[e["op"]], cpp_type, scalar_type, shape))
+    duplicates = [
+        (e.op.name, e.scalar_type, e.shape)
+        for i, e in enumerate(entries)
+        if (e.op.name, e.scalar_type, e.shape)
+        in [(o.op.name, o.scalar_type, o.shape) for o in entries[:i]]
+    ]
+    assert not duplicates, f"duplicate op/dtype/shape combos in manifest: {duplicates}"
+    return entries
+
+
+UNARY_BLOCK = CodeTemplate(
+    """\
+  { // ${comment}
+    using scalar_t = ${cpp_type};
+    if (C10_LIKELY(
+            self.scalar_type() == ${scalar_type} &&
+            self.sizes() == at::IntArrayRef(${sizes_var}) &&
+            self.is_contiguous())) {
+      at::Tensor out = at::empty(${sizes_var}, self.options());
+      const scalar_t* a = self.const_data_ptr<scalar_t>();
+      scalar_t* o = out.mutable_data_ptr<scalar_t>();
+      for (int64_t i = 0; i < ${numel}; ++i) {
+        o[i] = ${expr};
+      }
+      return out;
+    }
+  }
+"""
+)
+
+BINARY_BLOCK = CodeTemplate(
+    """\
+  { // ${comment}
+    using scalar_t = ${cpp_type};
+    if (C10_LIKELY(
+            self.scalar_type() == ${scalar_type} &&
+            other.scalar_type() == ${scalar_type} &&
+            self.sizes() == at::IntArrayRef(${sizes_var}) &&
+            other.sizes() == at::IntArrayRef(${sizes_var}) &&
+            self.is_contiguous() && other.is_contiguous())) {
+      at::Tensor out = at::empty(${sizes_var}, self.options());
+      const scalar_t* a = self.const_data_ptr<scalar_t>();
+      const scalar_t* b = other.const_data_ptr<scalar_t>();
+      scalar_t* o = out.mutable_data_ptr<scalar_t>();${alpha_load}
+      for (int64_t i = 0; i < ${numel}; ++i) {
+        o[i] = ${expr};
+      }
+      return out;
+    }
+  }
+"""
+)
+
+WRAPPER = CodeTemplate(
+    """\
+at::Tensor ${fn}(const at::Tensor& self${other_param}${alpha_param}) {
+${blocks}
+  return at::cpu::${fallback}(self${other_arg}${alpha_arg});
+}
+"""
+)
+
+FILE_TEMPLATE = CodeTemplate(
+    """\
+// ${generated_comment}
+// Kernels specialized for a fixed operator/shape/dtype manifest.  Each
+// wrapper guards on the manifest shapes and falls back to the generic
+// CPU kernel otherwise; see torchgen/gen_static_shape_kernels.py.
+#include <ATen/ATen.h>
+#include <ATen/CPUFunctions.h>
+#include <torch/library.h>
+
+#include <cmath>
+
+namespace {
+
+${kernels}
+} // namespace
+
+TORCH_LIBRARY_IMPL(aten, CPU, m) {
+  ${registrations}
+}
+"""
+)
+
+
+def gen_static_shape_kernels(entries: Sequence[ManifestEntry]) -> str:
+    # one wrapper per operator; each manifest entry for that operator
+    # contributes a guarded specialized block inside it
+    kernels = []
+    registrations = []
+    seen_ops: List[str] = []
+    for e in entries:
+        if e.op.name not in seen_ops:
+            seen_ops.append(e.op.name)
+    for op_name in seen_ops:
+        op = _SUPPORTED_OPS[op_name]
+        fn = f"specialized_{op.name.replace('.', '_')}"
+        blocks = []
+        for i, entry in enumerate(entries):
+            if entry.op.name != op_name:
+                continue
+            numel = 1
+            for d in entry.shape:
+                numel *= d
+            sizes_var = f"spec{i}_sizes"
+            sizes_literal = ", ".join(str(d) for d in entry.shape)
+            kernels.append(f"constexpr int64_t {sizes_var}[] = {{{sizes_literal}}};")
+            template = UNARY_BLOCK if op.arity == 1 else BINARY_BLOCK
+            blocks.append(
+                template.substitute(
+                    comment=f"{entry.cpp_type}, shape [{sizes_literal}]",
+                    cpp_type=entry.cpp_type,
+                    scalar_type=entry.scalar_type,
+                    numel=str(numel),
+                    sizes_var=sizes_var,
+                    expr=op.expr,
+                    alpha_load="\n      const auto alpha_v = alpha.to<scalar_t>();"
+                    if op.has_alpha
+                    else "",
+                ).rstrip("\n")
+            )
+        kernels.append(
+            WRAPPER.substitute(
+                fn=fn,
+                blocks=blocks,
+                fallback=op.name.split(".")[0],
+                other_param=", const at::Tensor& other" if op.arity == 2 else "",
+                other_arg=", other" if op.arity == 2 else "",
+                alpha_param=", const at::Scalar& alpha" if op.has_alpha else "",
+                alpha_arg=", alpha" if op.has_alpha else "",
+            )
+        )
+        registrations.append(f'm.impl("{op.name}", &{fn});')
+    return FILE_TEMPLATE.substitute(
+        generated_comment="@" + "generated by torchgen/gen_static_shape_kernels.py",
+        kernels=kernels,
+        registrations=registrations,
+    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Generate shape-specialized ATen kernels from a manifest"
+    )
+    parser.add_argument(
+        "--manifest",
+        type=str,
+        required=True,
+        help="path to the operator/shape/dtype manifest yaml",
+    )
+    parser.add_argument(
+        "--output-dir",
+        type=str,
+        required=True,
+        help="output directory for StaticShapeKernels.cpp",
+    )
+    parser.add_argument(
+        "--dry-run", action="store_true", help="do not write the output file"
+    )
+    options = parser.parse_args()
+
+    with open(options.manifest) as f:
+        entries = parse_manifest(yaml.load(f, Loader=YamlLoader))
+
+    generated = gen_static_shape_kernels(entries)
+    if not options.dry_run:
+        os.makedirs(options.output_dir, exist_ok=True)
+        with open(os.path.join(options.output_dir, "StaticShapeKernels.cpp"), "w") as f:
+            f.write(generated)
+
+
+if __name__ == "__main__":
+    main()
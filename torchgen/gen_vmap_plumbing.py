@@ -202,12 +202,21 @@ def gen_vmap_plumbing(native_function: NativeFunction) -> Optional[str]:
     sig = DispatcherSignature.from_schema(schema)
     returns = schema.returns
 
-    # Only support cases where all returns are Tensors or vector<Tensor>
+    # Only support cases where all returns are Tensors, vector<Tensor>, or
+    # (Sym)Ints. Scalar returns are passed through unbatched (see
+    # gen_returns), which ops like _scaled_dot_product_flash_attention rely
+    # on for their max_q/max_k outputs.
     if not accepts_at_least_one_tensor_input(schema):
         return None
     if len(returns) == 0:
         return gen_vmap_plumbing_no_returns(native_function)
-    if not all(ret.type.is_tensor_like() for ret in returns):
+    return_symint_overrides = [
+        "_scaled_dot_product_flash_attention",
+    ]
+    if (
+        not all(ret.type.is_tensor_like() for ret in returns)
+        and schema.name.unambiguous_name() not in return_symint_overrides
+    ):
         return None
     # in-place views need special handling
     if "inplace_view" in native_function.tags: